@@ -1,11 +1,41 @@
 ﻿// Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ClickToMove.h"
+#include "ClickToMoveStats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DEFINE_STAT(STAT_ClickToMove_PathQuery);
+DEFINE_STAT(STAT_ClickToMove_ProjectToNavmesh);
+DEFINE_STAT(STAT_ClickToMove_FollowerTick);
+DEFINE_STAT(STAT_ClickToMove_PathQueueTick);
+DEFINE_STAT(STAT_ClickToMove_CoarseRoute);
+DEFINE_STAT(STAT_ClickToMove_PathRequests);
+DEFINE_STAT(STAT_ClickToMove_Repaths);
+DEFINE_STAT(STAT_ClickToMove_IncrementalRepaths);
+DEFINE_STAT(STAT_ClickToMove_PathPoints);
+DEFINE_STAT(STAT_ClickToMove_ActiveFollowers);
+DEFINE_STAT(STAT_ClickToMove_PathRequestsQueued);
+DEFINE_STAT(STAT_ClickToMove_PathRequestsCoalesced);
+DEFINE_STAT(STAT_ClickToMove_PathRequestsSolved);
+DEFINE_STAT(STAT_ClickToMove_PathQueueLength);
+DEFINE_STAT(STAT_ClickToMove_ProjectionCacheHits);
+DEFINE_STAT(STAT_ClickToMove_ServerPathOrders);
+DEFINE_STAT(STAT_ClickToMove_RouteLegs);
+
+UE_TRACE_CHANNEL_DEFINE(ClickToMoveChannel);
+
+TAutoConsoleVariable<int32> CVarClickToMoveDebugDraw(
+	TEXT("ClickToMove.Debug.Draw"),
+	1,
+	TEXT("Allow ClickToMove per-frame debug drawing (autorun follower, path vertices, nav projection). ")
+	TEXT("0 skips it even when the component debug flags are on (useful for soak tests in Development builds)."),
+	ECVF_Cheat);
 
 #define LOCTEXT_NAMESPACE "FClickToMoveModule"
 
 void FClickToMoveModule::StartupModule()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FClickToMoveModule::StartupModule);
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
 }
 
@@ -0,0 +1,62 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+/**
+ * ClickToMove profiling
+ *
+ * - Stats:    "stat ClickToMove" in any non-shipping build.
+ * - Insights: run with -trace=cpu,ClickToMove (or "Trace.Enable ClickToMove") to get the CPU scopes below
+ *             on their own channel, independent of the engine's default cpu channel noise. "Trace.Disable ClickToMove"
+ *             turns them off again at runtime (Development and Test builds).
+ * - Debug:    ClickToMove.Debug.Draw 0 turns off all per-frame debug drawing (soak tests in Development builds).
+ */
+
+DECLARE_STATS_GROUP(TEXT("ClickToMove"), STATGROUP_ClickToMove, STATCAT_Advanced);
+
+// Cycle counters
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Path Query"), STAT_ClickToMove_PathQuery, STATGROUP_ClickToMove, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Project To Navmesh"), STAT_ClickToMove_ProjectToNavmesh, STATGROUP_ClickToMove, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Follower Tick"), STAT_ClickToMove_FollowerTick, STATGROUP_ClickToMove, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Path Queue Tick"), STAT_ClickToMove_PathQueueTick, STATGROUP_ClickToMove, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Coarse Route"), STAT_ClickToMove_CoarseRoute, STATGROUP_ClickToMove, );
+
+// Per-frame counters (reset every frame, so they read as "per frame" rates)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Path Requests"), STAT_ClickToMove_PathRequests, STATGROUP_ClickToMove, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Re-paths"), STAT_ClickToMove_Repaths, STATGROUP_ClickToMove, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Incremental Re-paths"), STAT_ClickToMove_IncrementalRepaths, STATGROUP_ClickToMove, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Path Points Received"), STAT_ClickToMove_PathPoints, STATGROUP_ClickToMove, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Followers"), STAT_ClickToMove_ActiveFollowers, STATGROUP_ClickToMove, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Path Requests Queued"), STAT_ClickToMove_PathRequestsQueued, STATGROUP_ClickToMove, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Path Requests Coalesced"), STAT_ClickToMove_PathRequestsCoalesced, STATGROUP_ClickToMove, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Path Requests Solved"), STAT_ClickToMove_PathRequestsSolved, STATGROUP_ClickToMove, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Path Queue Length"), STAT_ClickToMove_PathQueueLength, STATGROUP_ClickToMove, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Projection Cache Hits"), STAT_ClickToMove_ProjectionCacheHits, STATGROUP_ClickToMove, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Server Path Orders"), STAT_ClickToMove_ServerPathOrders, STATGROUP_ClickToMove, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Route Legs"), STAT_ClickToMove_RouteLegs, STATGROUP_ClickToMove, );
+
+UE_TRACE_CHANNEL_EXTERN(ClickToMoveChannel);
+
+extern TAutoConsoleVariable<int32> CVarClickToMoveDebugDraw;
+
+/** Cycle stat + Insights CPU scope on the ClickToMove channel, with one name. */
+#define CLICKTOMOVE_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, ClickToMoveChannel)
+
+/** Insights CPU scope on the ClickToMove channel only (entry points without a stat of their own). */
+#define CLICKTOMOVE_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, ClickToMoveChannel)
+
+/** True when per-frame debug drawing is allowed (ClickToMove.Debug.Draw != 0). Game thread only. */
+FORCEINLINE bool ClickToMoveDebugDrawEnabled()
+{
+	return CVarClickToMoveDebugDraw.GetValueOnGameThread() != 0;
+}
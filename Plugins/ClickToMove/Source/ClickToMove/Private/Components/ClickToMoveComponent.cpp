@@ -4,61 +4,117 @@
 
 #include "Components/ClickToMoveComponent.h"
 
+#include "ClickToMoveStats.h"                 // STATGROUP_ClickToMove, Insights channel, ClickToMove.Debug.Draw
+
 #include "NavigationPath.h"                // UNavigationPath: container for path points computed by the nav system
 #include "NavigationSystem.h"              // UNavigationSystemV1: entry point for navigation queries/projection
+#include "NavigationData.h"                // ANavigationData: nav data used to build async path-finding queries
+#include "NavFilters/NavigationQueryFilter.h" // UNavigationQueryFilter: default query filter for async queries
 #include "Components/SplineComponent.h"    // USplineComponent: optional helper for path visualization/math
+#include "Components/InstancedStaticMeshComponent.h" // Path preview: every dot in one instanced draw
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
 #include "DrawDebugHelpers.h"              // Debug draw primitives (spheres/lines/boxes)
 #include "GameFramework/Controller.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
+#include "Camera/PlayerCameraManager.h"       // Camera view point used as part of the held projection cache key
+#include "Subsystems/ClickToMovePathFollowerSubsystem.h" // Batched path following for all followers in the world
+#include "Subsystems/ClickToMovePathRequestSubsystem.h"  // Shared time-sliced path request queue
+#include "Navigation/ClickToMoveWaypointGraph.h"         // Coarse route for hierarchical pathing
 #include "Engine/World.h"
+#include "Net/UnrealNetwork.h"                  // DOREPLIFETIME_CONDITION for the owner-only server path
 
-// Constructor: allow ticking, but we enable it only during autorun.
-// This keeps idle cost low. CharacterMovement handles actual physics/motion.
+// Constructor: UClickToMovePathFollowerSubsystem advances the path, so the component only ticks for late cursor
+// sampling, and only on frames with a held sample. This keeps idle cost at zero. CharacterMovement handles actual physics/motion.
 UClickToMoveComponent::UClickToMoveComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork; // after UpdateCameraManager: same view as the frame being rendered
 	SetIsReplicatedByDefault(false); // client-driven; CharacterMovement replicates. We only run logic on local PC.
+	                                 // bUseServerPathing turns replication on in BeginPlay.
 }
 
 void UClickToMoveComponent::BeginPlay()
 {
 	Super::BeginPlay();
-	
-	EnsureSplineNoAttach(); // Create unattached/unregistered spline for optional visualization. No scene cost.
 
-	// Start with ticking disabled; autorun flow will enable as needed to avoid per-frame overhead when idle.
-	SetComponentTickEnabled(false);
+	// Server pathing needs the RPC + owner-only path replication; everyone else stays a local-only component.
+	if (bUseServerPathing)
+	{
+		SetIsReplicated(true);
+	}
+
+	// Flush cached projections whenever navigation changes (dynamic rebuilds, streamed-in nav data).
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &ThisClass::HandleNavigationDataChanged);
+		NavSys->OnNavDataRegisteredEvent.AddUniqueDynamic(this, &ThisClass::HandleNavigationDataChanged);
+	}
+
+	// The visualization spline is created lazily in StartFollowingPath (only when bBuildPathSpline is set).
 }
 
-void UClickToMoveComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
-	FActorComponentTickFunction* ThisTickFunction)
+void UClickToMoveComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	
-	// Only drive autorun path following when active.
-	// This gate is critical to ensure Tick does nothing when there is no path to follow.
-	if (bIsAutoRunning)
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME_CONDITION(UClickToMoveComponent, ServerPath, COND_OwnerOnly);
+}
+
+void UClickToMoveComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Make sure an in-flight async query cannot call back into a component that is going away,
+	// and that the follower subsystem stops steering our pawn (or our group).
+	StopMovement();
+	StopGroupMove();
+
+	if (PathPreview)
 	{
-		AutoRun();
+		PathPreview->DestroyComponent();
+		PathPreview = nullptr;
 	}
+	PathPreviewPoints.Reset();
+	PathPreviewFirstInstance.Reset();
+
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &ThisClass::HandleNavigationDataChanged);
+		NavSys->OnNavDataRegisteredEvent.RemoveDynamic(this, &ThisClass::HandleNavigationDataChanged);
+	}
+	InvalidateNavProjectionCache();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UClickToMoveComponent::OnClickPressed()
 {
 	// Reset hold state timer (used to distinguish short vs long press on release).
 	// Also stop any ongoing autorun so holding starts a new movement order.
-	SetAutoRunActive(false);
+	// Clears any previous path and invalidates any async path still being solved for the previous order.
+	// Snapshot the live path first: a short press near the old goal can keep most of it (incremental re-path).
+	PreviousPathPoints.Reset();
+	PreviousPathIndex = INDEX_NONE;
+	if (const UClickToMovePathFollowerSubsystem* Followers = UClickToMovePathFollowerSubsystem::Get(this))
+	{
+		if (const TArray<FVector>* LivePath = Followers->GetFollowerPath(FollowerHandle))
+		{
+			PreviousPathPoints = *LivePath;
+			PreviousPathIndex = Followers->GetFollowerPathIndex(FollowerHandle);
+		}
+	}
+
+	StopMovement();
 	FollowTime = 0.f;
-	SetComponentTickEnabled(false);
 
-	// Clear any previous path to ensure we don't reuse stale points.
-	PathPoints.Reset();
-	PathIndex = INDEX_NONE;
+	// Never reuse a projection from a previous hold.
+	InvalidateHeldProjectionCache();
 }
 
 void UClickToMoveComponent::OnClickHeld(const bool bUseInternalHitResult, const FHitResult& InHitResult)
 {
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMoveComponent::OnClickHeld);
 	// Local-only guard: only the local PlayerController should drive movement.
 	// Prevents server or remote clients from issuing AddMovementInput here.
 	const APlayerController* PC = GetOwnerPC();
@@ -80,28 +136,75 @@ void UClickToMoveComponent::OnClickHeld(const bool bUseInternalHitResult, const
 		FollowTime += World->GetDeltaSeconds();
 	}
 
-	// Either do an internal trace or use the provided hit result from elsewhere (e.g., HighlightInteraction).
-	// We prefer to minimize tracing, but when we do, we use a dedicated NAVIGATION channel for walkable surfaces.
-	FVector RawHitPoint = CachedDestination; // default to last known destination in case we fail a trace
-	bool bHaveBlockingHit = false;
+	// Late sampling: the cursor is sampled in TickComponent, after this frame's camera update.
+	if (bLateHeldCursorSampling)
+	{
+		bHeldSamplePending = true;
+		SetComponentTickEnabled(true);
+		return;
+	}
 
-	if (bUseInternalHitResult)
+	UpdateHeldMove(PC, [this, PC, bUseInternalHitResult, &InHitResult](FHitResult& OutHit) -> bool
 	{
-		// Internal cursor trace under the mouse using the configured channel.
-		// bTraceComplex=false for performance; switch to true only if you require per-triangle hits.
-		FHitResult HitResult;
-		if (PC->GetHitResultUnderCursor(CursorTraceChannel, /*bTraceComplex=*/false, HitResult))
+		if (bUseInternalHitResult)
 		{
-			RawHitPoint = HitResult.ImpactPoint;
-			bHaveBlockingHit = true;
+			// Internal cursor trace under the mouse using the configured channel.
+			// bTraceComplex=false for performance; switch to true only if you require per-triangle hits.
+			return PC->GetHitResultUnderCursor(CursorTraceChannel, /*bTraceComplex=*/false, OutHit);
 		}
+		// External hit provided (e.g., from a highlight system using its own channel).
+		OutHit = InHitResult;
+		return InHitResult.bBlockingHit;
+	});
+}
+
+void UClickToMoveComponent::TickComponent(const float DeltaTime, const ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// No hold this frame (released, targeting, or the option was turned off): stop ticking until the next one.
+	const APlayerController* PC = GetOwnerPC();
+	if (!bHeldSamplePending || !PC || !PC->IsLocalController())
+	{
+		bHeldSamplePending = false;
+		SetComponentTickEnabled(false);
+		return;
 	}
-	else if (InHitResult.bBlockingHit)
+	bHeldSamplePending = false;
+
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMoveComponent::LateHeldSample);
+	UpdateHeldMove(PC, [this, PC](FHitResult& OutHit) -> bool
 	{
-		// External hit provided (e.g., from a highlight system using its own channel).
-		// We still project to navmesh below to ensure reachability.
-		RawHitPoint = InHitResult.ImpactPoint;
-		bHaveBlockingHit = true;
+		return LateCursorHitProvider.IsBound()
+			? LateCursorHitProvider.Execute(OutHit)
+			: PC->GetHitResultUnderCursor(CursorTraceChannel, /*bTraceComplex=*/false, OutHit);
+	});
+}
+
+void UClickToMoveComponent::UpdateHeldMove(const APlayerController* PC, const TFunctionRef<bool(FHitResult&)> GetCursorHit)
+{
+	// Projection cache: if the cursor and camera have not moved since the last projected hit, the ground point
+	// under the cursor is the same, so skip the trace and ProjectPointToNavmesh and keep steering toward it.
+	FVector2D CacheCursor;
+	FVector CacheCameraLocation;
+	FRotator CacheCameraRotation;
+	const bool bHaveCacheKey = bUseHeldProjectionCache && GetHeldProjectionKey(PC, CacheCursor, CacheCameraLocation, CacheCameraRotation);
+	if (bHaveCacheKey && CanReuseHeldProjection(CacheCursor, CacheCameraLocation, CacheCameraRotation))
+	{
+		CachedDestination = HeldCacheProjected;
+		ApplyMoveToward(CachedDestination);
+		return;
+	}
+
+	// Either do an internal trace or use the provided hit result from elsewhere (e.g., HighlightInteraction).
+	// We prefer to minimize tracing, but when we do, we use a dedicated NAVIGATION channel for walkable surfaces.
+	// Either way we still project to navmesh below to ensure reachability.
+	FVector RawHitPoint = CachedDestination; // default to last known destination in case we fail a trace
+	FHitResult HitResult;
+	const bool bHaveBlockingHit = GetCursorHit(HitResult);
+	if (bHaveBlockingHit)
+	{
+		RawHitPoint = HitResult.ImpactPoint;
 	}
 
 	// Project to navmesh so clicks on static meshes still produce a valid move goal.
@@ -113,8 +216,57 @@ void UClickToMoveComponent::OnClickHeld(const bool bUseInternalHitResult, const
 		{
 			CachedDestination = Projected; // store the latest navigable location under the cursor
 			ApplyMoveToward(CachedDestination); // immediate steering while holding (no path building)
+
+			// Remember the key this projection was produced for, so the next frames can reuse it.
+			if (bHaveCacheKey)
+			{
+				bHasHeldProjectionCache = true;
+				HeldCacheCursor = CacheCursor;
+				HeldCacheCameraLocation = CacheCameraLocation;
+				HeldCacheCameraRotation = CacheCameraRotation;
+				HeldCacheProjected = Projected;
+			}
+			return;
 		}
 	}
+
+	// Trace or projection failed: do not keep reusing an older point for this key.
+	InvalidateHeldProjectionCache();
+}
+
+bool UClickToMoveComponent::GetHeldProjectionKey(const APlayerController* PC, FVector2D& OutCursor,
+	FVector& OutCameraLocation, FRotator& OutCameraRotation) const
+{
+	if (!PC || !PC->PlayerCameraManager)
+	{
+		return false;
+	}
+
+	// Same viewport-space cursor position that GetHitResultUnderCursor deprojects.
+	float MouseX = 0.f, MouseY = 0.f;
+	if (!PC->GetMousePosition(MouseX, MouseY))
+	{
+		return false;
+	}
+
+	OutCursor = FVector2D(MouseX, MouseY);
+	OutCameraLocation = PC->PlayerCameraManager->GetCameraLocation();
+	OutCameraRotation = PC->PlayerCameraManager->GetCameraRotation();
+	return true;
+}
+
+bool UClickToMoveComponent::CanReuseHeldProjection(const FVector2D& Cursor, const FVector& CameraLocation,
+	const FRotator& CameraRotation) const
+{
+	if (!bHasHeldProjectionCache)
+	{
+		return false;
+	}
+
+	// Cheap squared-distance checks first; rotation equality uses per-axis tolerance.
+	return FVector2D::DistSquared(Cursor, HeldCacheCursor) <= FMath::Square(HeldCacheCursorTolerancePx)
+		&& FVector::DistSquared(CameraLocation, HeldCacheCameraLocation) <= FMath::Square(HeldCacheCameraLocationTolerance)
+		&& CameraRotation.Equals(HeldCacheCameraRotation, HeldCacheCameraRotationTolerance);
 }
 
 void UClickToMoveComponent::OnClickReleased()
@@ -135,6 +287,147 @@ USplineComponent* UClickToMoveComponent::EnsureSplineNoAttach()
 	return Spline;
 }
 
+UInstancedStaticMeshComponent* UClickToMoveComponent::EnsurePathPreview(APawn* Pawn)
+{
+	if (!PathPreviewMesh || !Pawn)
+	{
+		return nullptr;
+	}
+
+	// Lives on the pawn (a hidden PlayerController renders none of its components); possessing another pawn moves it.
+	if (PathPreview && (!IsValid(PathPreview) || PathPreview->GetOwner() != Pawn))
+	{
+		if (IsValid(PathPreview))
+		{
+			PathPreview->DestroyComponent();
+		}
+		PathPreview = nullptr;
+		PathPreviewPoints.Reset();
+		PathPreviewFirstInstance.Reset();
+	}
+
+	if (!PathPreview)
+	{
+		// World-space instances: absolute transform at the origin and no attachment, so the dots stay put while the pawn walks.
+		UInstancedStaticMeshComponent* Preview = NewObject<UInstancedStaticMeshComponent>(Pawn,
+			MakeUniqueObjectName(Pawn, UInstancedStaticMeshComponent::StaticClass(), TEXT("ClickToMovePathPreview")));
+		Preview->SetUsingAbsoluteLocation(true);
+		Preview->SetUsingAbsoluteRotation(true);
+		Preview->SetUsingAbsoluteScale(true);
+		Preview->SetMobility(EComponentMobility::Movable);
+		Preview->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Preview->SetCanEverAffectNavigation(false);
+		Preview->SetCastShadow(false);
+		Preview->SetNumCustomDataFloats(1); // [0] = consumed
+		Preview->SetStaticMesh(PathPreviewMesh);
+		if (PathPreviewMaterial)
+		{
+			Preview->SetMaterial(0, PathPreviewMaterial);
+		}
+		Preview->RegisterComponent();
+		PathPreview = Preview;
+	}
+	return PathPreview;
+}
+
+void UClickToMoveComponent::UpdatePathPreview(APawn* Pawn, const TArray<FVector>& InPathPoints, const int32 StartIndex)
+{
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMoveComponent::UpdatePathPreview);
+	UInstancedStaticMeshComponent* Preview = EnsurePathPreview(Pawn);
+	if (!Preview || InPathPoints.Num() < 2)
+	{
+		HidePathPreview();
+		return;
+	}
+
+	// Rebuild only for a new path; the same points just get their consumed flags re-applied below.
+	if (PathPreviewPoints != InPathPoints)
+	{
+		const int32 NumPoints = InPathPoints.Num();
+		float TotalLength = 0.f;
+		for (int32 Point = 1; Point < NumPoints; ++Point)
+		{
+			TotalLength += FVector::Dist2D(InPathPoints[Point - 1], InPathPoints[Point]);
+		}
+		const float Spacing = FMath::Max(PathPreviewSpacing, TotalLength / FMath::Max(PathPreviewMaxInstances - 1, 1));
+
+		TArray<FTransform> Transforms;
+		Transforms.Reserve(FMath::Min(FMath::CeilToInt32(TotalLength / Spacing) + 1, PathPreviewMaxInstances));
+		PathPreviewFirstInstance.SetNumUninitialized(NumPoints + 1);
+		PathPreviewFirstInstance[0] = 0;
+
+		// No dot under the pawn (point 0), none crowding the destination dot added after the loop.
+		const FVector HeightOffset(0.f, 0.f, PathPreviewHeightOffset);
+		const float LastSpacedDot = TotalLength - Spacing * 0.5f;
+		float NextDot = Spacing;
+		float SegmentStart = 0.f;
+		FQuat Facing = FQuat::Identity;
+		for (int32 Point = 1; Point < NumPoints; ++Point)
+		{
+			PathPreviewFirstInstance[Point] = Transforms.Num();
+
+			const FVector& From = InPathPoints[Point - 1];
+			const FVector& To = InPathPoints[Point];
+			const float SegmentLength = FVector::Dist2D(From, To);
+			if (SegmentLength > UE_KINDA_SMALL_NUMBER)
+			{
+				Facing = FRotator(0.f, (To - From).Rotation().Yaw, 0.f).Quaternion();
+			}
+
+			while (NextDot <= SegmentStart + SegmentLength && NextDot <= LastSpacedDot)
+			{
+				const float Alpha = (NextDot - SegmentStart) / SegmentLength;
+				Transforms.Emplace(Facing, FMath::Lerp(From, To, Alpha) + HeightOffset, PathPreviewScale);
+				NextDot += Spacing;
+			}
+			SegmentStart += SegmentLength;
+		}
+		Transforms.Emplace(Facing, InPathPoints.Last() + HeightOffset, PathPreviewScale);
+		PathPreviewFirstInstance[NumPoints] = Transforms.Num();
+
+		// Fresh instances start with custom data 0 (not consumed).
+		Preview->ClearInstances();
+		Preview->AddInstances(Transforms, /*bShouldReturnIndices=*/false, /*bWorldSpace=*/true, /*bUpdateNavigation=*/false);
+		PathPreviewPoints = InPathPoints;
+		PathPreviewConsumed = 0;
+	}
+
+	Preview->SetVisibility(true);
+	SetPathPreviewProgress(StartIndex);
+}
+
+void UClickToMoveComponent::SetPathPreviewProgress(const int32 PathIndex)
+{
+	UInstancedStaticMeshComponent* Preview = PathPreview;
+	if (!Preview || !PathPreviewFirstInstance.IsValidIndex(PathIndex))
+	{
+		return;
+	}
+
+	// Instances are laid out in path order, so the consumed set is always a prefix: only the delta changes.
+	const int32 Consumed = PathPreviewFirstInstance[PathIndex];
+	if (Consumed == PathPreviewConsumed)
+	{
+		return;
+	}
+	const float Value = Consumed > PathPreviewConsumed ? 1.f : 0.f;
+	const int32 First = FMath::Min(Consumed, PathPreviewConsumed);
+	const int32 Last = FMath::Max(Consumed, PathPreviewConsumed);
+	for (int32 Instance = First; Instance < Last; ++Instance)
+	{
+		Preview->SetCustomDataValue(Instance, 0, Value, /*bMarkRenderStateDirty=*/Instance == Last - 1);
+	}
+	PathPreviewConsumed = Consumed;
+}
+
+void UClickToMoveComponent::HidePathPreview()
+{
+	if (PathPreview)
+	{
+		PathPreview->SetVisibility(false);
+	}
+}
+
 AController* UClickToMoveComponent::GetOwnerController() const
 {
 	// If Owner is a Controller, return it directly.
@@ -172,15 +465,37 @@ APawn* UClickToMoveComponent::GetControlledPawn() const
 	return nullptr;
 }
 
+void UClickToMoveComponent::SetAutoRunActive(const bool bInActive)
+{
+	bIsAutoRunning = bInActive;
+
+	// Pausing keeps the path so autorun can resume where it left off (e.g., after WASD input).
+	if (FollowerHandle.IsValid())
+	{
+		if (UClickToMovePathFollowerSubsystem* Followers = UClickToMovePathFollowerSubsystem::Get(this))
+		{
+			Followers->SetFollowerPaused(FollowerHandle, !bInActive);
+		}
+	}
+}
+
 void UClickToMoveComponent::StopMovement()
 {
-	// Disable autorun mode and ticking to avoid per-frame work.
-	SetAutoRunActive(false);
-	SetComponentTickEnabled(false);
+	// Disable autorun mode.
+	bIsAutoRunning = false;
+
+	// Drop any in-flight async path so it cannot restart autorun after we stopped.
+	CancelPendingPathRequest();
+
+	// Release the follower so subsequent orders start cleanly.
+	if (UClickToMovePathFollowerSubsystem* Followers = UClickToMovePathFollowerSubsystem::Get(this))
+	{
+		Followers->StopFollowing(FollowerHandle);
+	}
+	FollowerHandle.Reset();
 
-	// Clear autorun state so subsequent orders start cleanly.
-	PathPoints.Reset();
-	PathIndex = INDEX_NONE;
+	ResetRoute();
+	HidePathPreview();
 }
 
 void UClickToMoveComponent::ApplyMoveToward(const FVector& DestinationWorld) const
@@ -206,16 +521,28 @@ void UClickToMoveComponent::ApplyMoveToward(const FVector& DestinationWorld) con
 
 bool UClickToMoveComponent::ProjectPointToNavmesh(const FVector& InWorld, FVector& OutProjected) const
 {
+	CLICKTOMOVE_SCOPE_CYCLE_COUNTER(STAT_ClickToMove_ProjectToNavmesh);
+
 	// Get the current world; during shutdown or very early lifecycle this may be null.
 	const UWorld* World = GetWorld();
 	if (!World) return false;
 
+	// Repeat clicks in static areas: answer from the LRU (nav rebuilds flush it).
+	bool bCachedProjected = false;
+	if (bUseNavProjectionCache && FindCachedNavProjection(InWorld, OutProjected, bCachedProjected))
+	{
+		return bCachedProjected;
+	}
+
 	// Retrieve the nav system for this world; returns null if nav is disabled or no nav data is present.
 	if (const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World))
 	{
+		// Runs every frame while holding, so it also honors the global debug-draw CVar.
+		const bool bDrawProjectDebug = bDebugProjectToNav && ClickToMoveDebugDrawEnabled();
+
 		// Visualize the search volume (optional): a box centered at InWorld with half-extents NavProjectExtent.
 		// This helps understand where the projection is allowed to search for a navigable point.
-		if (bDebugProjectToNav)
+		if (bDrawProjectDebug)
 		{
 			DrawDebugBox(
 				GetWorld(),
@@ -242,7 +569,7 @@ bool UClickToMoveComponent::ProjectPointToNavmesh(const FVector& InWorld, FVecto
 		{
 			OutProjected = NavLoc.Location; // Successfully found a reachable nav position.
 			
-			if (bDebugProjectToNav)
+			if (bDrawProjectDebug)
 			{
 				// Visualize the projected point and the vector from the input to the projected result.
 				DrawDebugSphere(
@@ -268,140 +595,98 @@ bool UClickToMoveComponent::ProjectPointToNavmesh(const FVector& InWorld, FVecto
 					/*Thickness=*/DebugLineThickness
 				);
 			}
-			
+
+			if (bUseNavProjectionCache)
+			{
+				StoreNavProjection(InWorld, OutProjected, true);
+				StoreNavProjection(OutProjected, OutProjected, true); // projecting a nav point yields itself
+			}
 			return true;
 		}
+
+		// Only a real miss is cached; "no nav system" is not a property of this location.
+		if (bUseNavProjectionCache)
+		{
+			StoreNavProjection(InWorld, InWorld, false);
+		}
 	}
 	// No world, no nav system, or projection failed within the extents.
 	return false;
 }
 
-void UClickToMoveComponent::AutoRun()
+FIntVector UClickToMoveComponent::QuantizeNavProjectionKey(const FVector& InWorld) const
 {
-	// Local-only guard to avoid feeding inputs on non-local controllers.
-	const APlayerController* PC = GetOwnerPC();
-	if (!PC || !PC->IsLocalController())
-	{
-		return;
-	}
-
-	APawn* Pawn = GetControlledPawn();
-	// Stop cleanly if context is invalid (e.g., pawn destroyed or spline missing).
-	if (!Pawn) { StopMovement(); return; }
-
-	// Follow nav path points sequentially for accuracy.
-	// We require at least two points (start + one target), a valid PathIndex, and that the index is within bounds.
-	if (PathPoints.Num() >= 2 && PathIndex != INDEX_NONE && PathIndex < PathPoints.Num())
-	{
-		// Current pawn position and the current target path point.
-		const FVector PawnLoc = Pawn->GetActorLocation();
-
-		// Compute effective acceptance radius:
-		// Base AcceptanceRadius, optionally scaled by current 2D speed (clamped to min/max).
-		float EffectiveAcceptance = AcceptanceRadius;
-		if (bScaleAcceptanceBySpeed)
-		{
-			const float Speed2D = Pawn->GetVelocity().Size2D(); // uu/s
-			EffectiveAcceptance = FMath::Clamp(
-				AcceptanceRadius + Speed2D * AcceptanceSpeedScale,
-				AcceptanceRadiusMin,
-				AcceptanceRadiusMax
-			);
-		}
-		
-		const FVector CurrentTarget = PathPoints[PathIndex];
+	const float Cell = FMath::Max(NavProjectionCacheQuantization, 1.f);
+	return FIntVector(
+		FMath::FloorToInt(InWorld.X / Cell),
+		FMath::FloorToInt(InWorld.Y / Cell),
+		FMath::FloorToInt(InWorld.Z / Cell));
+}
 
-		// Arrival/advance check:
-		// When close enough to the current target (2D distance ignores height discrepancies), step to the next point.
-		if (FVector::DistSquared2D(PawnLoc, CurrentTarget) <= FMath::Square(EffectiveAcceptance))
+bool UClickToMoveComponent::FindCachedNavProjection(const FVector& InWorld, FVector& OutProjected, bool& bOutProjected) const
+{
+	const FIntVector Key = QuantizeNavProjectionKey(InWorld);
+	for (FNavProjectionCacheEntry& Entry : NavProjectionCache)
+	{
+		if (Entry.Key == Key && Entry.Extent.Equals(NavProjectExtent))
 		{
-			++PathIndex;
-
-			// If we've consumed all points, we reached the end of the path; stop autorun.
-			if (PathIndex >= PathPoints.Num())
+			Entry.LastUsed = ++NavProjectionCacheClock;
+			bOutProjected = Entry.bProjected;
+			if (Entry.bProjected)
 			{
-				StopMovement();
-				return;
+				OutProjected = Entry.Projected;
 			}
+			INC_DWORD_STAT(STAT_ClickToMove_ProjectionCacheHits);
+			return true;
 		}
+	}
+	return false;
+}
 
-		// Aim point with optional lookahead toward the next path point (soften turns).
-		// We blend between the current target and the next point to "round the corner".
-		FVector AimPoint = PathPoints[PathIndex];
-		if (bUseLookahead && (PathIndex + 1) < PathPoints.Num())
+void UClickToMoveComponent::StoreNavProjection(const FVector& InWorld, const FVector& Projected, const bool bProjected) const
+{
+	const FIntVector Key = QuantizeNavProjectionKey(InWorld);
+
+	// Overwrite the same key, else fill a free slot, else evict the least recently used entry.
+	int32 Slot = NavProjectionCache.IndexOfByPredicate([&Key, this](const FNavProjectionCacheEntry& Entry)
+	{
+		return Entry.Key == Key && Entry.Extent.Equals(NavProjectExtent);
+	});
+	if (Slot == INDEX_NONE)
+	{
+		if (NavProjectionCache.Num() < FMath::Max(NavProjectionCacheSize, 1))
 		{
-			const FVector NextPoint = PathPoints[PathIndex + 1];
-			AimPoint = FMath::Lerp(AimPoint, NextPoint, LookaheadBlendAlpha);
+			Slot = NavProjectionCache.AddDefaulted();
 		}
-
-		// Debug visualization (only in non-shipping/test builds)
-		#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+		else
+		{
+			Slot = 0;
+			for (int32 Index = 1; Index < NavProjectionCache.Num(); ++Index)
+			{
+				if (NavProjectionCache[Index].LastUsed < NavProjectionCache[Slot].LastUsed)
 				{
-					constexpr float DebugLifetime = 0.06f; // short-lived, refreshed each tick
-
-					// 1) Acceptance circle at current target in the XY plane.
-					// DrawDebugCircle signature: (World, Center, Radius, Segments, Color, bPersistent, LifeTime, Depth, Thickness, YAxis, ZAxis, bDrawAxis)
-					// To draw in XY plane, use YAxis = X axis (1,0,0), ZAxis = Y axis (0,1,0).
-					DrawDebugCircle(
-						GetWorld(),
-						CurrentTarget,
-						/*Radius=*/EffectiveAcceptance,
-						/*Segments=*/32,
-						/*Color=*/FColor::Green,
-						/*bPersistentLines=*/false,
-						/*LifeTime=*/DebugLifetime,
-						/*DepthPriority=*/0,
-						/*Thickness=*/1.5f,
-						/*YAxis=*/FVector(1.f, 0.f, 0.f),
-						/*ZAxis=*/FVector(0.f, 1.f, 0.f),
-						/*bDrawAxis=*/false
-					);
-
-					// 2) Markers: current target (yellow), next target (orange), aim point (cyan)
-					DrawDebugSphere(GetWorld(), CurrentTarget, 10.f, 8, FColor::Yellow, false, DebugLifetime);
-					if (PathIndex + 1 < PathPoints.Num())
-					{
-						DrawDebugSphere(GetWorld(), PathPoints[PathIndex + 1], 10.f, 8, FColor::Orange, false, DebugLifetime);
-					}
-					DrawDebugSphere(GetWorld(), AimPoint, 10.f, 8, FColor::Cyan, false, DebugLifetime);
-
-					// 3) Aim line from pawn to aim point
-					DrawDebugLine(GetWorld(), PawnLoc, AimPoint, FColor::Cyan, false, DebugLifetime, 0, 2.0f);
-
-					// 4) On-screen readout (helpful to verify scaling and lookahead live)
-					if (GEngine)
-					{
-						const float Speed2D = Pawn->GetVelocity().Size2D();
-						GEngine->AddOnScreenDebugMessage(
-							/*Key=*/42, /*Time=*/0.f, FColor::Yellow,
-							FString::Printf(TEXT("Idx %d/%d  Speed2D=%.1f  EffAcc=%.1f  Lookahead=%s a=%.2f"),
-								PathIndex, PathPoints.Num(),
-								Speed2D, EffectiveAcceptance,
-								bUseLookahead ? TEXT("ON") : TEXT("OFF"),
-								LookaheadBlendAlpha)
-						);
-					}
+					Slot = Index;
 				}
-		#endif
-		
-		// Steer directly toward the aim point (2D vector keeps top-down motion planar).
-		const FVector Direction = (AimPoint - PawnLoc).GetSafeNormal2D();
-		if (!Direction.IsNearlyZero())
-		{
-			Pawn->AddMovementInput(Direction, 1.f);
+			}
 		}
-		return;
-
-		// Note:
-		// - Spline remains available for visualization but is not used to derive direction,
-		//   which avoids "tangent flips" when sampling the closest point to the pawn.
 	}
-	// Fallback: invalid path state (e.g., no points); stop to avoid running forever.
-	StopMovement();
+
+	FNavProjectionCacheEntry& Entry = NavProjectionCache[Slot];
+	Entry.Key = Key;
+	Entry.Extent = NavProjectExtent;
+	Entry.Projected = Projected;
+	Entry.bProjected = bProjected;
+	Entry.LastUsed = ++NavProjectionCacheClock;
+}
+
+void UClickToMoveComponent::HandleNavigationDataChanged(ANavigationData* NavData)
+{
+	InvalidateNavProjectionCache();
 }
 
 void UClickToMoveComponent::FindPathToLocation()
 {
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMoveComponent::FindPathToLocation);
 	// Only short presses build an autorun path; long holds already moved the pawn.
 	// This produces the common ARPG behavior: hold to steer; click to autorun.
 	if (FollowTime > ShortPressThreshold)
@@ -412,11 +697,29 @@ void UClickToMoveComponent::FindPathToLocation()
 	}
 
 	APawn* Pawn = GetControlledPawn();
-	// If there is no pawn or spline, abort safely (cannot follow a path).
-	if (!Pawn || !Spline)
+	// If there is no pawn, abort safely (cannot follow a path).
+	if (!Pawn)
+	{
+		FollowTime = 0.f;
+		SetIsTargeting(false);
+		return;
+	}
+
+	// Server pathing on a remote client: send the raw destination (the server projects it; clients may have no
+	// nav data) and steer straight at it until the server path replicates back.
+	const AActor* Owner = GetOwner();
+	if (bUseServerPathing && Owner && !Owner->HasAuthority())
 	{
+		CancelPendingPathRequest();
+		++ServerOrderId;
+		bAwaitingServerPath = true;
+		ServerRequestMoveTo(CachedDestination, ServerOrderId);
+		StartFollowingPath({ Pawn->GetActorLocation(), CachedDestination });
+
 		FollowTime = 0.f;
 		SetIsTargeting(false);
+		PreviousPathPoints.Reset();
+		PreviousPathIndex = INDEX_NONE;
 		return;
 	}
 
@@ -431,42 +734,787 @@ void UClickToMoveComponent::FindPathToLocation()
 		return;
 	}
 	
-	// Build a nav path synchronously (fine for single-click flows).
-	// For continuous updates (e.g., click-drag path preview), consider async path queries.
-	if (UNavigationPath* NavPath = UNavigationSystemV1::FindPathToLocationSynchronously(
-		this, Pawn->GetActorLocation(), GoalOnNav, Pawn))
+	// Stats: every short-press path is a request; one issued while a path was live (at press time) is a re-path.
+	INC_DWORD_STAT(STAT_ClickToMove_PathRequests);
+	if (PreviousPathIndex != INDEX_NONE)
 	{
-		// Ensure the path is valid and contains at least one segment (start + goal).
-		if (NavPath->IsValid() && !NavPath->PathPoints.IsEmpty())
-		{
-
-			// Cache points for accurate sequential following.
-			// Index 0 is the starting point (typically the pawn's current location).
-			PathPoints = NavPath->PathPoints;   // <-- PathPoints is cached here
-			PathIndex  = 1;                     // 0 is start (pawn location); begin with the next point
-			
-			// Populate spline for optional visualization or debug math.
-			Spline->ClearSplinePoints(false);
-			for (const FVector& PathPoint : NavPath->PathPoints)
-			{
-				Spline->AddSplinePoint(PathPoint, ESplineCoordinateSpace::World, false);
-				#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-				// Visualize each path vertex to help diagnose navmesh cornering.
-				DrawDebugSphere(GetWorld(), PathPoint, 12.f, 8, FColor::Green, false, 5.f);
-				#endif
-			}
-			Spline->UpdateSpline();
-
-			// Use final path point as authoritative final destination (useful for HUD/UX).
-			CachedDestination = NavPath->PathPoints.Last();
+		INC_DWORD_STAT(STAT_ClickToMove_Repaths);
+	}
 
-			// Enable autorun and ticking to start following the path next frame.
-			SetComponentTickEnabled(true);
-			SetAutoRunActive(true);
-		}
+	// Long trip over a baked waypoint graph: coarse route now, real nav paths leg by leg.
+	if (bUseHierarchicalPathing && TryStartHierarchicalRoute(Pawn, GoalOnNav))
+	{
+		// The first leg is queued; it lands in OnRouteLegFound.
+	}
+	// Async mode: submit the query and start steering toward the goal right away; the path lands in OnAsyncPathFound.
+	// If the query cannot be issued (e.g., no nav data for this agent), fall through to the queued solve.
+	else if (bUseAsyncPathfinding && RequestPathAsync(Pawn, GoalOnNav))
+	{
+		// Straight-line placeholder path so the click feels immediate; OnAsyncPathFound swaps in the real one.
+		// Arriving on the placeholder finishes the follower, which also cancels the query (goal already reached).
+		StartFollowingPath({ Pawn->GetActorLocation(), GoalOnNav });
+		bAwaitingAsyncPath = true;
+	}
+	// Default: hand the solve to the shared path request queue (time-sliced, local player first).
+	// It is solved later this frame (or the next one under load) and lands in OnQueuedPathFound.
+	else
+	{
+		RequestPathQueued(Pawn, GoalOnNav, CanReusePreviousPathPrefix(Pawn, GoalOnNav));
 	}
 
 	// Reset transient input state for the next click cycle, regardless of success or failure.
 	FollowTime = 0.f;
 	SetIsTargeting(false);
-}
\ No newline at end of file
+	PreviousPathPoints.Reset();
+	PreviousPathIndex = INDEX_NONE;
+}
+
+bool UClickToMoveComponent::CanReusePreviousPathPrefix(const APawn* Pawn, const FVector& GoalOnNav) const
+{
+	if (!bUseIncrementalRepath || !Pawn || !PreviousPathPoints.IsValidIndex(PreviousPathIndex))
+	{
+		return false;
+	}
+
+	// Only worth it when the destination barely moved; otherwise the old prefix is likely the wrong way.
+	if (FVector::DistSquared2D(PreviousPathPoints.Last(), GoalOnNav) > FMath::Square(IncrementalRepathRadius))
+	{
+		return false;
+	}
+
+	// Corridor check: the pawn must still reach the kept anchor in a straight line on the current navmesh
+	// (the hold part of the short press may have nudged it, or the navmesh may have changed under it).
+	FVector HitLocation;
+	const bool bBlocked = UNavigationSystemV1::NavigationRaycast(
+		GetWorld(), Pawn->GetActorLocation(), PreviousPathPoints[PreviousPathIndex],
+		HitLocation, nullptr, Pawn->GetController());
+	return !bBlocked;
+}
+
+bool UClickToMoveComponent::RequestPathQueued(APawn* Pawn, const FVector& GoalOnNav, const bool bKeepPreviousPrefix)
+{
+	UClickToMovePathRequestSubsystem* PathRequests = UClickToMovePathRequestSubsystem::Get(this);
+	if (!PathRequests || !Pawn)
+	{
+		return false;
+	}
+
+	// Only one request per component is ever relevant: drop the previous one and bump the generation.
+	CancelPendingPathRequest();
+	const uint32 RequestGeneration = PathRequestGeneration;
+
+	// Incremental re-path: keep the previous points [0..PreviousPathIndex] and only solve from that point on.
+	FVector Start = Pawn->GetActorLocation();
+	if (bKeepPreviousPrefix && PreviousPathPoints.IsValidIndex(PreviousPathIndex))
+	{
+		Start = PreviousPathPoints[PreviousPathIndex];
+		PendingPathPrefix = MoveTemp(PreviousPathPoints);
+		PendingPathPrefix.SetNum(PreviousPathIndex + 1, EAllowShrinking::No);
+	}
+	PendingQueuedGoal = GoalOnNav;
+
+	PendingQueuedRequestId = PathRequests->SubmitRequest(
+		this,
+		Pawn,
+		Start,
+		GoalOnNav,
+		EClickToMovePathRequestPriority::LocalPlayer,
+		FClickToMovePathRequestFinished::CreateUObject(this, &ThisClass::OnQueuedPathFound, RequestGeneration)
+	);
+
+	return PendingQueuedRequestId != 0;
+}
+
+void UClickToMoveComponent::OnQueuedPathFound(const uint32 RequestId, const TArray<FVector>& InPathPoints,
+	const uint32 RequestGeneration)
+{
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMoveComponent::OnQueuedPathFound);
+	// Stale: a newer order (or a stop) happened after this request was queued.
+	if (RequestGeneration != PathRequestGeneration || RequestId != PendingQueuedRequestId)
+	{
+		return;
+	}
+
+	PendingQueuedRequestId = 0;
+
+	if (InPathPoints.IsEmpty())
+	{
+		// Tail solve failed from the kept anchor: retry once as a full path from the pawn.
+		if (!PendingPathPrefix.IsEmpty())
+		{
+			PendingPathPrefix.Reset();
+			RequestPathQueued(GetControlledPawn(), PendingQueuedGoal, /*bKeepPreviousPrefix=*/false);
+		}
+		return;
+	}
+
+	if (PendingPathPrefix.IsEmpty())
+	{
+		StartFollowingPath(InPathPoints);
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_ClickToMove_IncrementalRepaths);
+
+	// Splice: kept prefix (ending at the anchor) + tail without its first point (the anchor itself).
+	// A degenerate tail (goal == anchor) still leaves a valid path ending at the anchor.
+	TArray<FVector> SplicedPath = MoveTemp(PendingPathPrefix);
+	PendingPathPrefix.Reset();
+	const int32 StartIndex = SplicedPath.Num() - 1;
+	SplicedPath.Append(InPathPoints.GetData() + 1, InPathPoints.Num() - 1);
+
+	StartFollowingPath(SplicedPath, StartIndex);
+}
+
+bool UClickToMoveComponent::RequestPathAsync(APawn* Pawn, const FVector& GoalOnNav)
+{
+	UWorld* World = GetWorld();
+	UNavigationSystemV1* NavSys = World ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(World) : nullptr;
+	if (!NavSys || !Pawn)
+	{
+		return false;
+	}
+
+	// Resolve nav data for this agent (supports multiple agent sizes); the sync path does the same internally.
+	const FNavAgentProperties& AgentProps = Pawn->GetNavAgentPropertiesRef();
+	const ANavigationData* NavData = NavSys->GetNavDataForProps(AgentProps, Pawn->GetNavAgentLocation());
+	if (!NavData)
+	{
+		return false;
+	}
+
+	// Only one query per component is ever relevant: abort the previous one and bump the generation.
+	CancelPendingPathRequest();
+	const uint32 RequestGeneration = PathRequestGeneration;
+
+	const FPathFindingQuery Query(
+		Pawn,
+		*NavData,
+		Pawn->GetActorLocation(),
+		GoalOnNav,
+		UNavigationQueryFilter::GetQueryFilter(*NavData, Pawn, nullptr)
+	);
+
+	// The generation rides along as a delegate payload so the callback can detect stale results.
+	// Only the submission is timed here; the solve itself runs on the nav system's worker.
+	CLICKTOMOVE_SCOPE_CYCLE_COUNTER(STAT_ClickToMove_PathQuery);
+	PendingAsyncQueryId = NavSys->FindPathAsync(
+		AgentProps,
+		Query,
+		FNavPathQueryDelegate::CreateUObject(this, &ThisClass::OnAsyncPathFound, RequestGeneration)
+	);
+
+	return PendingAsyncQueryId != INVALID_NAVQUERYID;
+}
+
+void UClickToMoveComponent::OnAsyncPathFound(uint32 QueryId, ENavigationQueryResult::Type Result,
+	FNavPathSharedPtr NavPath, const uint32 RequestGeneration)
+{
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMoveComponent::OnAsyncPathFound);
+	// Stale: a newer order (or a stop) happened after this query was submitted.
+	if (RequestGeneration != PathRequestGeneration || QueryId != PendingAsyncQueryId)
+	{
+		return;
+	}
+
+	PendingAsyncQueryId = INVALID_NAVQUERYID;
+	bAwaitingAsyncPath = false;
+
+	if (Result != ENavigationQueryResult::Success || !NavPath.IsValid() || !NavPath->IsValid() || NavPath->GetPathPoints().IsEmpty())
+	{
+		// No path: stop steering toward the goal rather than walking into a wall forever.
+		StopMovement();
+		return;
+	}
+
+	INC_DWORD_STAT_BY(STAT_ClickToMove_PathPoints, NavPath->GetPathPoints().Num());
+
+	TArray<FVector> NewPathPoints;
+	NewPathPoints.Reserve(NavPath->GetPathPoints().Num());
+	for (const FNavPathPoint& NavPoint : NavPath->GetPathPoints())
+	{
+		NewPathPoints.Add(NavPoint.Location);
+	}
+
+	StartFollowingPath(NewPathPoints);
+}
+
+void UClickToMoveComponent::CancelPendingPathRequest()
+{
+	// Invalidate whatever is in flight, even if we cannot reach the nav system to abort it.
+	++PathRequestGeneration;
+	bAwaitingAsyncPath = false;
+	bAwaitingServerPath = false;
+	PendingPathPrefix.Reset();
+
+	if (PendingQueuedRequestId != 0)
+	{
+		if (UClickToMovePathRequestSubsystem* PathRequests = UClickToMovePathRequestSubsystem::Get(this))
+		{
+			PathRequests->CancelRequest(this);
+		}
+		PendingQueuedRequestId = 0;
+	}
+
+	if (PendingAsyncQueryId != INVALID_NAVQUERYID)
+	{
+		if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+		{
+			NavSys->AbortAsyncFindPathRequest(PendingAsyncQueryId);
+		}
+		PendingAsyncQueryId = INVALID_NAVQUERYID;
+	}
+}
+
+void UClickToMoveComponent::ServerRequestMoveTo_Implementation(const FVector_NetQuantize& Destination, const uint16 OrderId)
+{
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMoveComponent::ServerRequestMoveTo_Implementation);
+	INC_DWORD_STAT(STAT_ClickToMove_ServerPathOrders);
+
+	APawn* Pawn = GetControlledPawn();
+	UClickToMovePathRequestSubsystem* PathRequests = UClickToMovePathRequestSubsystem::Get(this);
+
+	// Always answer: an empty path tells the client to stop steering at the unreachable destination.
+	FVector GoalOnNav = Destination;
+	if (!Pawn || !PathRequests || !ProjectPointToNavmesh(Destination, GoalOnNav))
+	{
+		ServerPath.Points.Reset();
+		ServerPath.OrderId = OrderId;
+		return;
+	}
+
+	// Newer orders from the same client supersede (and coalesce with) the queued one.
+	CancelPendingPathRequest();
+	PendingQueuedRequestId = PathRequests->SubmitRequest(
+		this,
+		Pawn,
+		Pawn->GetActorLocation(),
+		GoalOnNav,
+		EClickToMovePathRequestPriority::LocalPlayer,
+		FClickToMovePathRequestFinished::CreateUObject(this, &ThisClass::OnServerPathFound, PathRequestGeneration, OrderId)
+	);
+}
+
+void UClickToMoveComponent::OnServerPathFound(const uint32 RequestId, const TArray<FVector>& InPathPoints,
+	const uint32 RequestGeneration, const uint16 OrderId)
+{
+	if (RequestGeneration != PathRequestGeneration || RequestId != PendingQueuedRequestId)
+	{
+		return;
+	}
+	PendingQueuedRequestId = 0;
+
+	// Quantize once here; the owner-only property replicates the whole list with this order id.
+	ServerPath.Points.Reset(InPathPoints.Num());
+	for (const FVector& Point : InPathPoints)
+	{
+		ServerPath.Points.Emplace(Point);
+	}
+	ServerPath.OrderId = OrderId;
+}
+
+void UClickToMoveComponent::OnRep_ServerPath()
+{
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMoveComponent::OnRep_ServerPath);
+	// Only the answer to our latest order matters; a press/stop since then cleared bAwaitingServerPath.
+	if (!bAwaitingServerPath || ServerPath.OrderId != ServerOrderId)
+	{
+		return;
+	}
+	bAwaitingServerPath = false;
+
+	if (ServerPath.Points.Num() < 2)
+	{
+		StopMovement();
+		return;
+	}
+
+	// The server solved from its own pawn position; start from where the client pawn is now.
+	TArray<FVector> NewPathPoints;
+	NewPathPoints.Reserve(ServerPath.Points.Num());
+	for (const FVector_NetQuantize10& Point : ServerPath.Points)
+	{
+		NewPathPoints.Add(Point);
+	}
+	if (const APawn* Pawn = GetControlledPawn())
+	{
+		NewPathPoints[0] = Pawn->GetActorLocation();
+	}
+
+	StartFollowingPath(NewPathPoints);
+}
+
+void UClickToMoveComponent::StartFollowingPath(const TArray<FVector>& InPathPoints, const int32 StartIndex)
+{
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMoveComponent::StartFollowingPath);
+	// Local-only guard: only the local PlayerController's pawn is driven by click-to-move.
+	const APlayerController* PC = GetOwnerPC();
+	UClickToMovePathFollowerSubsystem* Followers = UClickToMovePathFollowerSubsystem::Get(this);
+	APawn* Pawn = GetControlledPawn();
+	if (!PC || !PC->IsLocalController() || !Followers || !Pawn || InPathPoints.Num() < 2)
+	{
+		StopMovement();
+		return;
+	}
+
+	// Index 0 is the starting point (typically the pawn's current location); the follower begins at index 1.
+	// Reuse the live follower (async arrival, re-path) instead of re-registering.
+	if (!Followers->SetFollowerPath(FollowerHandle, InPathPoints, StartIndex))
+	{
+		FollowerHandle = Followers->StartFollowing(
+			Pawn,
+			InPathPoints,
+			MakeFollowSettings(),
+			FClickToMoveFollowerFinished::CreateUObject(this, &ThisClass::OnFollowerFinished),
+			StartIndex
+		);
+	}
+
+	// Path preview: instances change here only, progress arrives through the follower's advanced callback
+	// (which also paces hierarchical route legs).
+	if (FollowerHandle.IsValid() && (bShowPathPreview || !RouteWaypoints.IsEmpty()))
+	{
+		if (bShowPathPreview)
+		{
+			UpdatePathPreview(Pawn, InPathPoints, Followers->GetFollowerPathIndex(FollowerHandle));
+		}
+		Followers->SetFollowerAdvancedDelegate(FollowerHandle,
+			FClickToMoveFollowerAdvanced::CreateUObject(this, &ThisClass::OnFollowerAdvanced));
+	}
+
+	// Populate spline only when visualization asked for it; nothing reads it at runtime.
+	if (bBuildPathSpline)
+	{
+		if (USplineComponent* PathSpline = EnsureSplineNoAttach())
+		{
+			PathSpline->ClearSplinePoints(false);
+			for (const FVector& PathPoint : InPathPoints)
+			{
+				PathSpline->AddSplinePoint(PathPoint, ESplineCoordinateSpace::World, false);
+			}
+			PathSpline->UpdateSpline();
+		}
+	}
+
+	#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	if (bDebugAutoRun && ClickToMoveDebugDrawEnabled())
+	{
+		// Visualize each path vertex to help diagnose navmesh cornering.
+		for (const FVector& PathPoint : InPathPoints)
+		{
+			DrawDebugSphere(GetWorld(), PathPoint, 12.f, 8, FColor::Green, false, 5.f);
+		}
+	}
+	#endif
+
+	// Use final path point as authoritative final destination (useful for HUD/UX).
+	CachedDestination = InPathPoints.Last();
+
+	// Enable autorun; the follower subsystem starts steering on its next tick.
+	SetAutoRunActive(true);
+}
+
+void UClickToMoveComponent::OnFollowerFinished(const bool bReachedGoal)
+{
+	// The subsystem already released the follower; just clear our side (and any pending async query).
+	FollowerHandle.Reset();
+
+	// Hierarchical route: the end of a leg was reached before the next leg was solved. Keep autorun on and wait for it.
+	if (bReachedGoal && !RouteWaypoints.IsEmpty())
+	{
+		APawn* Pawn = GetControlledPawn();
+		if (PendingQueuedRequestId != 0 || (Pawn && RequestNextRouteLeg(Pawn, Pawn->GetActorLocation())))
+		{
+			return;
+		}
+	}
+	StopMovement();
+}
+
+void UClickToMoveComponent::OnFollowerAdvanced(const int32 PathIndex)
+{
+	SetPathPreviewProgress(PathIndex);
+	MaybeRequestNextRouteLeg(PathIndex);
+}
+
+AClickToMoveWaypointGraph* UClickToMoveComponent::GetWaypointGraph()
+{
+	if (!WaypointGraph.IsValid())
+	{
+		WaypointGraph = AClickToMoveWaypointGraph::Find(GetWorld());
+	}
+	return WaypointGraph.Get();
+}
+
+bool UClickToMoveComponent::TryStartHierarchicalRoute(APawn* Pawn, const FVector& GoalOnNav)
+{
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMoveComponent::TryStartHierarchicalRoute);
+	const FVector PawnLocation = Pawn->GetActorLocation();
+	if (FVector::DistSquared2D(PawnLocation, GoalOnNav) < FMath::Square(HierarchicalPathMinDistance))
+	{
+		return false;
+	}
+
+	const AClickToMoveWaypointGraph* Graph = GetWaypointGraph();
+	TArray<FVector> Route;
+	if (!Graph || !Graph->FindRoute(PawnLocation, GoalOnNav, Route) || Route.IsEmpty())
+	{
+		return false;
+	}
+
+	CancelPendingPathRequest();
+	RouteWaypoints = MoveTemp(Route);
+	RouteWaypoints.Add(GoalOnNav);
+	RouteNextWaypoint = 0;
+	if (!RequestNextRouteLeg(Pawn, PawnLocation))
+	{
+		ResetRoute();
+		return false;
+	}
+	return true;
+}
+
+bool UClickToMoveComponent::RequestNextRouteLeg(APawn* Pawn, const FVector& LegStart)
+{
+	UClickToMovePathRequestSubsystem* PathRequests = UClickToMovePathRequestSubsystem::Get(this);
+	if (!PathRequests || !Pawn || !RouteWaypoints.IsValidIndex(RouteNextWaypoint))
+	{
+		return false;
+	}
+
+	// Not CancelPendingPathRequest: bumping the generation here would orphan the order this leg belongs to.
+	const int32 Target = FMath::Min(RouteNextWaypoint + FMath::Max(HierarchicalLegWaypoints, 1) - 1, RouteWaypoints.Num() - 1);
+	RouteNextWaypoint = Target + 1;
+	PendingRouteLegStart = LegStart;
+	PendingQueuedGoal = RouteWaypoints[Target];
+	INC_DWORD_STAT(STAT_ClickToMove_RouteLegs);
+
+	PendingQueuedRequestId = PathRequests->SubmitRequest(
+		this,
+		Pawn,
+		LegStart,
+		PendingQueuedGoal,
+		EClickToMovePathRequestPriority::LocalPlayer,
+		FClickToMovePathRequestFinished::CreateUObject(this, &ThisClass::OnRouteLegFound, PathRequestGeneration)
+	);
+	return PendingQueuedRequestId != 0;
+}
+
+void UClickToMoveComponent::MaybeRequestNextRouteLeg(const int32 PathIndex)
+{
+	if (RouteWaypoints.IsEmpty() || PendingQueuedRequestId != 0 || RouteNextWaypoint >= RouteWaypoints.Num())
+	{
+		return;
+	}
+
+	// Two points of lead so the next leg is normally spliced in before the pawn reaches the current leg's end.
+	const UClickToMovePathFollowerSubsystem* Followers = UClickToMovePathFollowerSubsystem::Get(this);
+	const TArray<FVector>* LivePath = Followers ? Followers->GetFollowerPath(FollowerHandle) : nullptr;
+	if (LivePath && PathIndex >= LivePath->Num() - 2)
+	{
+		RequestNextRouteLeg(GetControlledPawn(), LivePath->Last());
+	}
+}
+
+void UClickToMoveComponent::OnRouteLegFound(const uint32 RequestId, const TArray<FVector>& InPathPoints,
+	const uint32 RequestGeneration)
+{
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMoveComponent::OnRouteLegFound);
+	if (RequestGeneration != PathRequestGeneration || RequestId != PendingQueuedRequestId)
+	{
+		return;
+	}
+	PendingQueuedRequestId = 0;
+
+	APawn* Pawn = GetControlledPawn();
+	if (InPathPoints.IsEmpty())
+	{
+		// Coarse waypoint unreachable (graph older than the navmesh): one direct solve from the leg start to the goal.
+		if (PendingQueuedGoal != RouteWaypoints.Last())
+		{
+			RouteNextWaypoint = RouteWaypoints.Num() - 1;
+			if (RequestNextRouteLeg(Pawn, PendingRouteLegStart))
+			{
+				return;
+			}
+		}
+		// Let the live leg (if any) finish; its arrival ends the order.
+		ResetRoute();
+		if (!FollowerHandle.IsValid())
+		{
+			StopMovement();
+		}
+		return;
+	}
+
+	// Bounded path: pawn + the unwalked rest of the live leg + the new leg (its first point is the live leg's end).
+	TArray<FVector> NewPathPoints;
+	const UClickToMovePathFollowerSubsystem* Followers = UClickToMovePathFollowerSubsystem::Get(this);
+	const TArray<FVector>* LivePath = Followers ? Followers->GetFollowerPath(FollowerHandle) : nullptr;
+	const int32 LiveIndex = Followers ? Followers->GetFollowerPathIndex(FollowerHandle) : INDEX_NONE;
+	if (Pawn && LivePath && LivePath->IsValidIndex(LiveIndex))
+	{
+		NewPathPoints.Reserve(1 + LivePath->Num() - LiveIndex + InPathPoints.Num() - 1);
+		NewPathPoints.Add(Pawn->GetActorLocation());
+		NewPathPoints.Append(LivePath->GetData() + LiveIndex, LivePath->Num() - LiveIndex);
+		NewPathPoints.Append(InPathPoints.GetData() + 1, InPathPoints.Num() - 1);
+	}
+	else
+	{
+		// First leg, or the pawn already stands at the previous leg's end.
+		NewPathPoints = InPathPoints;
+		if (Pawn)
+		{
+			NewPathPoints[0] = Pawn->GetActorLocation();
+		}
+	}
+
+	// The final leg ends the route; from here on it is a regular path.
+	if (RouteNextWaypoint >= RouteWaypoints.Num())
+	{
+		ResetRoute();
+	}
+	StartFollowingPath(NewPathPoints);
+
+	// Short legs can already be in their last segment.
+	if (FollowerHandle.IsValid() && Followers)
+	{
+		MaybeRequestNextRouteLeg(Followers->GetFollowerPathIndex(FollowerHandle));
+	}
+}
+
+void UClickToMoveComponent::ResetRoute()
+{
+	RouteWaypoints.Reset();
+	RouteNextWaypoint = 0;
+}
+
+void UClickToMoveComponent::MoveGroupToLocation(const TArray<APawn*>& Members, const FVector& Destination)
+{
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMoveComponent::MoveGroupToLocation);
+	StopGroupMove();
+
+	// Only pawns we are allowed to drive: the follower feeds AddMovementInput, which must run where movement is simulated.
+	FVector Centroid = FVector::ZeroVector;
+	for (APawn* Member : Members)
+	{
+		if (IsValid(Member) && (Member->HasAuthority() || Member->IsLocallyControlled()))
+		{
+			GroupMembers.AddDefaulted_GetRef().Pawn = Member;
+			Centroid += Member->GetActorLocation();
+		}
+	}
+	if (GroupMembers.IsEmpty())
+	{
+		return;
+	}
+	Centroid /= GroupMembers.Num();
+
+	// Leader = member closest to the group's center, so the shared corridor starts where most of the group is.
+	APawn* Leader = nullptr;
+	float BestDistSq = TNumericLimits<float>::Max();
+	for (const FGroupMember& Member : GroupMembers)
+	{
+		const float DistSq = FVector::DistSquared2D(Member.Pawn->GetActorLocation(), Centroid);
+		if (DistSq < BestDistSq)
+		{
+			BestDistSq = DistSq;
+			Leader = Member.Pawn.Get();
+		}
+	}
+
+	FVector GoalOnNav = Destination;
+	UClickToMovePathRequestSubsystem* PathRequests = UClickToMovePathRequestSubsystem::Get(this);
+	if (!PathRequests || !ProjectPointToNavmesh(Destination, GoalOnNav))
+	{
+		GroupMembers.Reset();
+		return;
+	}
+
+	GroupLeader = Leader;
+	GroupDestination = GoalOnNav;
+
+	// The leader pawn is the requester, so group orders never coalesce with this component's own click requests.
+	PathRequests->SubmitRequest(
+		Leader,
+		Leader,
+		Leader->GetActorLocation(),
+		GoalOnNav,
+		EClickToMovePathRequestPriority::LocalPlayer,
+		FClickToMovePathRequestFinished::CreateUObject(this, &ThisClass::OnGroupLeaderPathFound, GroupRequestGeneration)
+	);
+}
+
+void UClickToMoveComponent::StopGroupMove()
+{
+	++GroupRequestGeneration;
+
+	UClickToMovePathFollowerSubsystem* Followers = UClickToMovePathFollowerSubsystem::Get(this);
+	UClickToMovePathRequestSubsystem* PathRequests = UClickToMovePathRequestSubsystem::Get(this);
+	for (FGroupMember& Member : GroupMembers)
+	{
+		if (Followers)
+		{
+			Followers->StopFollowing(Member.FollowerHandle);
+		}
+		if (PathRequests && Member.Pawn.IsValid())
+		{
+			PathRequests->CancelRequest(Member.Pawn.Get());
+		}
+	}
+
+	GroupMembers.Reset();
+	GroupLeader.Reset();
+}
+
+void UClickToMoveComponent::OnGroupLeaderPathFound(uint32 RequestId, const TArray<FVector>& InPathPoints,
+	const uint32 RequestGeneration)
+{
+	UClickToMovePathFollowerSubsystem* Followers = UClickToMovePathFollowerSubsystem::Get(this);
+	if (RequestGeneration != GroupRequestGeneration || !Followers || InPathPoints.Num() < 2)
+	{
+		return;
+	}
+
+	// Formation frame: face along the final leg of the leader path.
+	const FVector Goal = InPathPoints.Last();
+	FVector Forward = (Goal - InPathPoints.Last(1)).GetSafeNormal2D();
+	if (Forward.IsNearlyZero())
+	{
+		Forward = FVector::ForwardVector;
+	}
+	const FVector Right(-Forward.Y, Forward.X, 0.f);
+
+	// Grid slots centered on the goal: ceil(sqrt(N)) columns, rows stacked behind the goal.
+	const int32 NumMembers = GroupMembers.Num();
+	const int32 Columns = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumMembers))));
+	const int32 Rows = FMath::DivideAndRoundUp(NumMembers, Columns);
+	TArray<FVector> Slots;
+	Slots.Reserve(NumMembers);
+	for (int32 Index = 0; Index < NumMembers; ++Index)
+	{
+		const int32 Row = Index / Columns;
+		const int32 Column = Index % Columns;
+		const int32 ColumnsInRow = FMath::Min(Columns, NumMembers - Row * Columns);
+		const float Along = (0.5f * (Rows - 1) - Row) * FormationSpacing;
+		const float Across = (Column - 0.5f * (ColumnsInRow - 1)) * FormationSpacing;
+		Slots.Add(Goal + Forward * Along + Right * Across);
+	}
+
+	// One batched projection for every slot instead of N ProjectPointToNavmesh calls.
+	TBitArray<> SlotProjected;
+	BatchProjectPointsToNavmesh(GroupLeader.Get(), Slots, SlotProjected);
+
+	UClickToMovePathRequestSubsystem* PathRequests = UClickToMovePathRequestSubsystem::Get(this);
+	const FClickToMoveFollowSettings FollowSettings = MakeFollowSettings();
+	for (int32 Index = 0; Index < NumMembers; ++Index)
+	{
+		FGroupMember& Member = GroupMembers[Index];
+		APawn* Pawn = Member.Pawn.Get();
+		if (!Pawn)
+		{
+			continue;
+		}
+
+		const FVector MemberLocation = Pawn->GetActorLocation();
+		Member.Slot = SlotProjected[Index] ? Slots[Index] : Goal;
+
+		// Shared corridor: member start -> leader interior points -> own slot.
+		TArray<FVector> MemberPath;
+		MemberPath.Reserve(InPathPoints.Num());
+		MemberPath.Add(MemberLocation);
+		MemberPath.Append(InPathPoints.GetData() + 1, InPathPoints.Num() - 2);
+		MemberPath.Add(Member.Slot);
+
+		// Individual re-path only when the slot is off-mesh or the member cannot get onto the corridor directly.
+		FVector HitLocation;
+		const bool bCorridorBlocked = UNavigationSystemV1::NavigationRaycast(
+			GetWorld(), MemberLocation, MemberPath[1], HitLocation, nullptr, Pawn->GetController());
+		if ((!SlotProjected[Index] || bCorridorBlocked) && PathRequests)
+		{
+			PathRequests->SubmitRequest(
+				Pawn,
+				Pawn,
+				MemberLocation,
+				Member.Slot,
+				EClickToMovePathRequestPriority::AI,
+				FClickToMovePathRequestFinished::CreateUObject(this, &ThisClass::OnGroupMemberPathFound, RequestGeneration, Index)
+			);
+			continue;
+		}
+
+		Member.FollowerHandle = Followers->StartFollowing(Pawn, MemberPath, FollowSettings, FClickToMoveFollowerFinished());
+	}
+}
+
+void UClickToMoveComponent::OnGroupMemberPathFound(uint32 RequestId, const TArray<FVector>& InPathPoints,
+	const uint32 RequestGeneration, const int32 MemberIndex)
+{
+	UClickToMovePathFollowerSubsystem* Followers = UClickToMovePathFollowerSubsystem::Get(this);
+	if (RequestGeneration != GroupRequestGeneration || !Followers || !GroupMembers.IsValidIndex(MemberIndex))
+	{
+		return;
+	}
+
+	FGroupMember& Member = GroupMembers[MemberIndex];
+	if (APawn* Pawn = Member.Pawn.Get())
+	{
+		Member.FollowerHandle = Followers->StartFollowing(Pawn, InPathPoints, MakeFollowSettings(), FClickToMoveFollowerFinished());
+	}
+}
+
+bool UClickToMoveComponent::BatchProjectPointsToNavmesh(const APawn* Querier, TArray<FVector>& InOutPoints,
+	TBitArray<>& OutProjected) const
+{
+	CLICKTOMOVE_SCOPE_CYCLE_COUNTER(STAT_ClickToMove_ProjectToNavmesh);
+
+	OutProjected.Init(false, InOutPoints.Num());
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	ANavigationData* NavData = (NavSys && Querier)
+		? NavSys->GetNavDataForProps(Querier->GetNavAgentPropertiesRef(), Querier->GetNavAgentLocation())
+		: nullptr;
+	if (!NavData)
+	{
+		return false;
+	}
+
+	TArray<FNavigationProjectionWork> Workload;
+	Workload.Reserve(InOutPoints.Num());
+	for (const FVector& Point : InOutPoints)
+	{
+		Workload.Emplace(Point);
+	}
+
+	NavSys->BatchProjectPoints(Workload, NavProjectExtent, NavData,
+		UNavigationQueryFilter::GetQueryFilter(*NavData, Querier, nullptr), Querier);
+
+	bool bAllProjected = true;
+	for (int32 Index = 0; Index < Workload.Num(); ++Index)
+	{
+		if (Workload[Index].bResult)
+		{
+			InOutPoints[Index] = Workload[Index].OutLocation.Location;
+			OutProjected[Index] = true;
+		}
+		else
+		{
+			bAllProjected = false;
+		}
+	}
+	return bAllProjected;
+}
+
+FClickToMoveFollowSettings UClickToMoveComponent::MakeFollowSettings() const
+{
+	FClickToMoveFollowSettings Settings;
+	Settings.AcceptanceRadius = AcceptanceRadius;
+	Settings.bScaleAcceptanceBySpeed = bScaleAcceptanceBySpeed;
+	Settings.AcceptanceSpeedScale = AcceptanceSpeedScale;
+	Settings.AcceptanceRadiusMin = AcceptanceRadiusMin;
+	Settings.AcceptanceRadiusMax = AcceptanceRadiusMax;
+	Settings.bUseLookahead = bUseLookahead;
+	Settings.LookaheadDistance = LookaheadDistance;
+	Settings.bDrawDebug = bDebugAutoRun;
+	return Settings;
+}
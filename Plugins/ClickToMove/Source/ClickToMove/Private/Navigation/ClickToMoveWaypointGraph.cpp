@@ -0,0 +1,275 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Navigation/ClickToMoveWaypointGraph.h"
+
+#include "ClickToMoveStats.h"
+
+#include "Algo/Reverse.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"                   // TActorIterator
+#include "NavigationData.h"
+#include "NavigationPath.h"
+#include "NavigationSystem.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogClickToMoveWaypointGraph, Log, All);
+
+AClickToMoveWaypointGraph::AClickToMoveWaypointGraph()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	SetCanBeDamaged(false);
+
+	// Baked data only; loaded with the level on every machine, never replicated.
+	bReplicates = false;
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+AClickToMoveWaypointGraph* AClickToMoveWaypointGraph::Find(const UWorld* World)
+{
+	if (!World)
+	{
+		return nullptr;
+	}
+	for (TActorIterator<AClickToMoveWaypointGraph> It(const_cast<UWorld*>(World)); It; ++It)
+	{
+		if (It->GetNumNodes() > 0)
+		{
+			return *It;
+		}
+	}
+	return nullptr;
+}
+
+void AClickToMoveWaypointGraph::BuildGraph()
+{
+	CLICKTOMOVE_TRACE_SCOPE(AClickToMoveWaypointGraph::BuildGraph);
+	UWorld* World = GetWorld();
+	UNavigationSystemV1* NavSys = World ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(World) : nullptr;
+	const ANavigationData* NavData = NavSys ? NavSys->GetDefaultNavDataInstance() : nullptr;
+	if (!NavData)
+	{
+		UE_LOG(LogClickToMoveWaypointGraph, Warning, TEXT("%s: no navigation data to build the waypoint graph from."), *GetName());
+		return;
+	}
+
+	const FBox Bounds = NavData->GetBounds();
+	if (!Bounds.IsValid)
+	{
+		return;
+	}
+
+	Modify();
+	BakedCellSize = FMath::Max(CellSize, 100.f);
+	GridOrigin = FVector2D(Bounds.Min.X, Bounds.Min.Y);
+	NodeLocations.Reset();
+	NodeCells.Reset();
+	CellToNode.Reset();
+
+	// Nodes: one projected point per column.
+	const int32 NumX = FMath::Max(FMath::CeilToInt32((Bounds.Max.X - Bounds.Min.X) / BakedCellSize), 1);
+	const int32 NumY = FMath::Max(FMath::CeilToInt32((Bounds.Max.Y - Bounds.Min.Y) / BakedCellSize), 1);
+	const FVector ProjectExtent(BakedCellSize * 0.5f, BakedCellSize * 0.5f, Bounds.GetExtent().Z + 100.f);
+	for (int32 X = 0; X < NumX; ++X)
+	{
+		for (int32 Y = 0; Y < NumY; ++Y)
+		{
+			const FVector Center(GridOrigin.X + (X + 0.5f) * BakedCellSize, GridOrigin.Y + (Y + 0.5f) * BakedCellSize, Bounds.GetCenter().Z);
+			FNavLocation NavLocation;
+			if (NavSys->ProjectPointToNavigation(Center, NavLocation, ProjectExtent, NavData))
+			{
+				CellToNode.Add(FIntPoint(X, Y), NodeLocations.Num());
+				NodeLocations.Add(NavLocation.Location);
+				NodeCells.Add(FIntPoint(X, Y));
+			}
+		}
+	}
+
+	// Edges: real nav paths to the 8 neighbors, kept when the detour is small. Offline, so the cost does not matter.
+	static const FIntPoint Neighbors[] = {
+		{ 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 }, { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
+
+	EdgeOffsets.Reset(NodeLocations.Num() + 1);
+	EdgeTargets.Reset();
+	EdgeCosts.Reset();
+	for (int32 Node = 0; Node < NodeLocations.Num(); ++Node)
+	{
+		EdgeOffsets.Add(EdgeTargets.Num());
+		for (const FIntPoint& Offset : Neighbors)
+		{
+			const int32* Other = CellToNode.Find(NodeCells[Node] + Offset);
+			if (!Other)
+			{
+				continue;
+			}
+
+			const UNavigationPath* NavPath = UNavigationSystemV1::FindPathToLocationSynchronously(
+				this, NodeLocations[Node], NodeLocations[*Other]);
+			if (!NavPath || !NavPath->IsValid() || NavPath->IsPartial())
+			{
+				continue;
+			}
+
+			const float PathLength = NavPath->GetPathLength();
+			if (PathLength <= FVector::Dist(NodeLocations[Node], NodeLocations[*Other]) * MaxEdgeDetour)
+			{
+				EdgeTargets.Add(*Other);
+				EdgeCosts.Add(PathLength);
+			}
+		}
+	}
+	EdgeOffsets.Add(EdgeTargets.Num());
+
+	ScratchCost.Empty();
+	ScratchParent.Empty();
+	ScratchStamp.Empty();
+	MarkPackageDirty();
+
+	UE_LOG(LogClickToMoveWaypointGraph, Log, TEXT("%s: built %d waypoint nodes, %d edges."), *GetName(), NodeLocations.Num(), EdgeTargets.Num());
+}
+
+FIntPoint AClickToMoveWaypointGraph::GetCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32((Location.X - GridOrigin.X) / BakedCellSize),
+		FMath::FloorToInt32((Location.Y - GridOrigin.Y) / BakedCellSize));
+}
+
+int32 AClickToMoveWaypointGraph::FindNearestNode(const FVector& Location) const
+{
+	if (CellToNode.Num() != NodeCells.Num())
+	{
+		CellToNode.Reset();
+		CellToNode.Reserve(NodeCells.Num());
+		for (int32 Node = 0; Node < NodeCells.Num(); ++Node)
+		{
+			CellToNode.Add(NodeCells[Node], Node);
+		}
+	}
+
+	const FIntPoint Cell = GetCell(Location);
+	int32 Best = INDEX_NONE;
+	double BestDistSq = TNumericLimits<double>::Max();
+	for (int32 X = -1; X <= 1; ++X)
+	{
+		for (int32 Y = -1; Y <= 1; ++Y)
+		{
+			if (const int32* Node = CellToNode.Find(Cell + FIntPoint(X, Y)))
+			{
+				const double DistSq = FVector::DistSquared(NodeLocations[*Node], Location);
+				if (DistSq < BestDistSq)
+				{
+					BestDistSq = DistSq;
+					Best = *Node;
+				}
+			}
+		}
+	}
+	return Best;
+}
+
+bool AClickToMoveWaypointGraph::FindRoute(const FVector& Start, const FVector& Goal, TArray<FVector>& OutWaypoints) const
+{
+	CLICKTOMOVE_SCOPE_CYCLE_COUNTER(STAT_ClickToMove_CoarseRoute);
+	OutWaypoints.Reset();
+
+	const int32 NumNodes = NodeLocations.Num();
+	if (NumNodes == 0 || BakedCellSize <= 0.f || EdgeOffsets.Num() != NumNodes + 1)
+	{
+		return false;
+	}
+
+	const int32 StartNode = FindNearestNode(Start);
+	const int32 GoalNode = FindNearestNode(Goal);
+	if (StartNode == INDEX_NONE || GoalNode == INDEX_NONE)
+	{
+		return false;
+	}
+	if (StartNode == GoalNode)
+	{
+		return true;
+	}
+
+	if (ScratchStamp.Num() != NumNodes)
+	{
+		ScratchCost.SetNumUninitialized(NumNodes);
+		ScratchParent.SetNumUninitialized(NumNodes);
+		ScratchStamp.SetNumZeroed(NumNodes);
+		QueryStamp = 0;
+	}
+	if (++QueryStamp == 0)
+	{
+		// Wrapped: old stamps could alias the new one.
+		FMemory::Memzero(ScratchStamp.GetData(), ScratchStamp.Num() * sizeof(uint32));
+		QueryStamp = 1;
+	}
+
+	struct FOpenEntry
+	{
+		float Estimate; // cost so far + straight distance to the goal
+		float Cost;
+		int32 Node;
+	};
+	const auto ByEstimate = [](const FOpenEntry& A, const FOpenEntry& B) { return A.Estimate < B.Estimate; };
+
+	const FVector& GoalLocation = NodeLocations[GoalNode];
+	TArray<FOpenEntry> Open;
+	Open.Reserve(64);
+
+	ScratchCost[StartNode] = 0.f;
+	ScratchParent[StartNode] = INDEX_NONE;
+	ScratchStamp[StartNode] = QueryStamp;
+	Open.HeapPush({ static_cast<float>(FVector::Dist(NodeLocations[StartNode], GoalLocation)), 0.f, StartNode }, ByEstimate);
+
+	bool bFound = false;
+	while (Open.Num() > 0)
+	{
+		FOpenEntry Entry;
+		Open.HeapPop(Entry, ByEstimate, EAllowShrinking::No);
+
+		// Lazy deletion: a cheaper way to this node was pushed after this entry.
+		if (Entry.Cost > ScratchCost[Entry.Node])
+		{
+			continue;
+		}
+		if (Entry.Node == GoalNode)
+		{
+			bFound = true;
+			break;
+		}
+
+		for (int32 Edge = EdgeOffsets[Entry.Node]; Edge < EdgeOffsets[Entry.Node + 1]; ++Edge)
+		{
+			const int32 Next = EdgeTargets[Edge];
+			const float Cost = Entry.Cost + EdgeCosts[Edge];
+			if (ScratchStamp[Next] != QueryStamp || Cost < ScratchCost[Next])
+			{
+				ScratchStamp[Next] = QueryStamp;
+				ScratchCost[Next] = Cost;
+				ScratchParent[Next] = Entry.Node;
+				Open.HeapPush({ Cost + static_cast<float>(FVector::Dist(NodeLocations[Next], GoalLocation)), Cost, Next }, ByEstimate);
+			}
+		}
+	}
+
+	if (!bFound)
+	{
+		return false;
+	}
+
+	// Walk back from the goal, skipping both end nodes (the caller starts at the pawn and ends on the real goal).
+	for (int32 Node = ScratchParent[GoalNode]; Node != INDEX_NONE && Node != StartNode; Node = ScratchParent[Node])
+	{
+		OutWaypoints.Add(NodeLocations[Node]);
+	}
+	Algo::Reverse(OutWaypoints);
+	return true;
+}
+
+SIZE_T AClickToMoveWaypointGraph::GetAllocatedSize() const
+{
+	return NodeLocations.GetAllocatedSize() + NodeCells.GetAllocatedSize() + EdgeOffsets.GetAllocatedSize()
+		+ EdgeTargets.GetAllocatedSize() + EdgeCosts.GetAllocatedSize() + CellToNode.GetAllocatedSize()
+		+ ScratchCost.GetAllocatedSize() + ScratchParent.GetAllocatedSize() + ScratchStamp.GetAllocatedSize();
+}
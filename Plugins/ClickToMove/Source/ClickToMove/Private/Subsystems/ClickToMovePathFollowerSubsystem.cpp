@@ -0,0 +1,454 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/ClickToMovePathFollowerSubsystem.h"
+
+#include "ClickToMoveStats.h"
+
+#include "Algo/BinarySearch.h"
+#include "Async/ParallelFor.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+
+// Below this many followers the ParallelFor dispatch costs more than the math it spreads out.
+static TAutoConsoleVariable<int32> CVarClickToMoveFollowerParallelThreshold(
+	TEXT("ClickToMove.Follower.ParallelThreshold"),
+	64,
+	TEXT("Minimum number of active path followers before the per-follower math runs through ParallelFor (<= 0 disables)."),
+	ECVF_Default);
+
+UClickToMovePathFollowerSubsystem* UClickToMovePathFollowerSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UClickToMovePathFollowerSubsystem>() : nullptr;
+}
+
+FClickToMoveFollowerHandle UClickToMovePathFollowerSubsystem::StartFollowing(APawn* Pawn, const TArray<FVector>& InPathPoints,
+	const FClickToMoveFollowSettings& InSettings, FClickToMoveFollowerFinished OnFinished, const int32 StartIndex)
+{
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMovePathFollowerSubsystem::StartFollowing);
+	FClickToMoveFollowerHandle Handle;
+
+	// Need a pawn and at least start + one target point (same requirement the component always had).
+	if (!Pawn || InPathPoints.Num() < 2)
+	{
+		return Handle;
+	}
+
+	Handle.Id = NextHandleId++;
+
+	const int32 Index = HandleIds.Add(Handle.Id);
+	Pawns.Add(Pawn);
+	Paths.Add(InPathPoints);
+	BuildArcLengthTable(InPathPoints, PathDistances.AddDefaulted_GetRef());
+	PathIndices.Add(FMath::Clamp(StartIndex, 1, InPathPoints.Num() - 1)); // 0 is start (pawn location); begin with the next point
+	Settings.Add(InSettings);
+	Paused.Add(false);
+	FinishedDelegates.Add(MoveTemp(OnFinished));
+	AdvancedDelegates.AddDefaulted();
+
+	Locations.AddZeroed();
+	Velocities.AddZeroed();
+	PreviousPathIndices.AddZeroed();
+	AimPoints.AddZeroed();
+	Directions.AddZeroed();
+	EffectiveAcceptances.AddZeroed();
+	StepResults.Add(EStepResult::Continue);
+
+	IdToIndex.Add(Handle.Id, Index);
+	return Handle;
+}
+
+bool UClickToMovePathFollowerSubsystem::SetFollowerPath(const FClickToMoveFollowerHandle& Handle, const TArray<FVector>& InPathPoints,
+	const int32 StartIndex)
+{
+	CLICKTOMOVE_TRACE_SCOPE(UClickToMovePathFollowerSubsystem::SetFollowerPath);
+	const int32 Index = FindIndex(Handle);
+	if (Index == INDEX_NONE || InPathPoints.Num() < 2)
+	{
+		return false;
+	}
+
+	Paths[Index] = InPathPoints;
+	BuildArcLengthTable(InPathPoints, PathDistances[Index]);
+	PathIndices[Index] = FMath::Clamp(StartIndex, 1, InPathPoints.Num() - 1);
+	return true;
+}
+
+void UClickToMovePathFollowerSubsystem::SetFollowerAdvancedDelegate(const FClickToMoveFollowerHandle& Handle,
+	FClickToMoveFollowerAdvanced OnAdvanced)
+{
+	const int32 Index = FindIndex(Handle);
+	if (Index != INDEX_NONE)
+	{
+		AdvancedDelegates[Index] = MoveTemp(OnAdvanced);
+	}
+}
+
+void UClickToMovePathFollowerSubsystem::SetFollowerPaused(const FClickToMoveFollowerHandle& Handle, const bool bPaused)
+{
+	const int32 Index = FindIndex(Handle);
+	if (Index != INDEX_NONE)
+	{
+		Paused[Index] = bPaused;
+	}
+}
+
+void UClickToMovePathFollowerSubsystem::StopFollowing(FClickToMoveFollowerHandle& Handle)
+{
+	const int32 Index = FindIndex(Handle);
+	if (Index != INDEX_NONE)
+	{
+		RemoveAt(Index);
+	}
+	Handle.Reset();
+}
+
+int32 UClickToMovePathFollowerSubsystem::GetFollowerPathIndex(const FClickToMoveFollowerHandle& Handle) const
+{
+	const int32 Index = FindIndex(Handle);
+	return Index != INDEX_NONE ? PathIndices[Index] : INDEX_NONE;
+}
+
+const TArray<FVector>* UClickToMovePathFollowerSubsystem::GetFollowerPath(const FClickToMoveFollowerHandle& Handle) const
+{
+	const int32 Index = FindIndex(Handle);
+	return Index != INDEX_NONE ? &Paths[Index] : nullptr;
+}
+
+SIZE_T UClickToMovePathFollowerSubsystem::GetAllocatedSize() const
+{
+	SIZE_T Bytes = HandleIds.GetAllocatedSize() + Pawns.GetAllocatedSize() + Paths.GetAllocatedSize()
+		+ PathDistances.GetAllocatedSize() + PathIndices.GetAllocatedSize() + Settings.GetAllocatedSize()
+		+ Paused.GetAllocatedSize() + FinishedDelegates.GetAllocatedSize() + AdvancedDelegates.GetAllocatedSize()
+		+ Locations.GetAllocatedSize() + Velocities.GetAllocatedSize() + PreviousPathIndices.GetAllocatedSize() + AimPoints.GetAllocatedSize() + Directions.GetAllocatedSize()
+		+ EffectiveAcceptances.GetAllocatedSize() + StepResults.GetAllocatedSize() + IdToIndex.GetAllocatedSize();
+	for (int32 Index = 0; Index < Paths.Num(); ++Index)
+	{
+		Bytes += Paths[Index].GetAllocatedSize() + PathDistances[Index].GetAllocatedSize();
+	}
+	return Bytes;
+}
+
+void UClickToMovePathFollowerSubsystem::Deinitialize()
+{
+	// World teardown: drop everything silently; owners are being destroyed with the world.
+	while (HandleIds.Num() > 0)
+	{
+		RemoveAt(HandleIds.Num() - 1);
+	}
+
+	Super::Deinitialize();
+}
+
+TStatId UClickToMovePathFollowerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UClickToMovePathFollowerSubsystem, STATGROUP_Tickables);
+}
+
+void UClickToMovePathFollowerSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	CLICKTOMOVE_SCOPE_CYCLE_COUNTER(STAT_ClickToMove_FollowerTick);
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	const int32 NumFollowers = Pawns.Num();
+	SET_DWORD_STAT(STAT_ClickToMove_ActiveFollowers, NumFollowers);
+	if (NumFollowers == 0)
+	{
+		return;
+	}
+
+	// 1) Gather (game thread): pawn state is read once so the math phase never touches UObjects.
+	for (int32 Index = 0; Index < NumFollowers; ++Index)
+	{
+		if (const APawn* Pawn = Pawns[Index].Get())
+		{
+			Locations[Index] = Pawn->GetActorLocation();
+			Velocities[Index] = Pawn->GetVelocity();
+			StepResults[Index] = EStepResult::Continue;
+			PreviousPathIndices[Index] = PathIndices[Index];
+		}
+		else
+		{
+			StepResults[Index] = EStepResult::Invalid;
+		}
+	}
+
+	// 2) Step: independent per follower, so it parallelizes trivially once there are enough of them.
+	const int32 ParallelThreshold = CVarClickToMoveFollowerParallelThreshold.GetValueOnGameThread();
+	const bool bSingleThreaded = ParallelThreshold <= 0 || NumFollowers < ParallelThreshold;
+	ParallelFor(NumFollowers, [this](const int32 Index) { StepFollower(Index); }, bSingleThreaded);
+
+	// 3) Apply (game thread): feed movement input, collect finished followers.
+	#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	const bool bDebugDrawAllowed = ClickToMoveDebugDrawEnabled();
+	#endif
+	TArray<TPair<int32, bool>, TInlineAllocator<8>> Finished; // (handle id, bReachedGoal)
+	TArray<TPair<FClickToMoveFollowerAdvanced, int32>, TInlineAllocator<4>> Advanced; // (delegate, new path index)
+	for (int32 Index = 0; Index < NumFollowers; ++Index)
+	{
+		if (StepResults[Index] != EStepResult::Continue)
+		{
+			Finished.Emplace(HandleIds[Index], StepResults[Index] == EStepResult::Arrived);
+			continue;
+		}
+
+		if (PathIndices[Index] != PreviousPathIndices[Index] && AdvancedDelegates[Index].IsBound())
+		{
+			Advanced.Emplace(AdvancedDelegates[Index], PathIndices[Index]);
+		}
+
+		if (Paused[Index] || Directions[Index].IsNearlyZero())
+		{
+			continue;
+		}
+
+		if (APawn* Pawn = Pawns[Index].Get())
+		{
+			Pawn->AddMovementInput(Directions[Index], 1.f);
+		}
+
+		#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+		if (bDebugDrawAllowed && Settings[Index].bDrawDebug)
+		{
+			DrawFollowerDebug(Index);
+		}
+		#endif
+	}
+
+	// 4) Remove first, then notify: callbacks may immediately start a new follower for the same pawn.
+	TArray<TPair<FClickToMoveFollowerFinished, bool>, TInlineAllocator<8>> ToNotify;
+	for (const TPair<int32, bool>& Entry : Finished)
+	{
+		const int32 Index = IdToIndex.FindRef(Entry.Key, INDEX_NONE);
+		if (Index != INDEX_NONE)
+		{
+			ToNotify.Emplace(MoveTemp(FinishedDelegates[Index]), Entry.Value);
+			RemoveAt(Index);
+		}
+	}
+	for (TPair<FClickToMoveFollowerAdvanced, int32>& Entry : Advanced)
+	{
+		Entry.Key.ExecuteIfBound(Entry.Value);
+	}
+	for (TPair<FClickToMoveFollowerFinished, bool>& Entry : ToNotify)
+	{
+		Entry.Key.ExecuteIfBound(Entry.Value);
+	}
+
+	LastTickMicroseconds = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0;
+	LastTickFrame = GFrameCounter;
+}
+
+int32 UClickToMovePathFollowerSubsystem::FindIndex(const FClickToMoveFollowerHandle& Handle) const
+{
+	if (!Handle.IsValid())
+	{
+		return INDEX_NONE;
+	}
+	const int32* Index = IdToIndex.Find(Handle.Id);
+	return Index ? *Index : INDEX_NONE;
+}
+
+void UClickToMovePathFollowerSubsystem::RemoveAt(const int32 Index)
+{
+	const int32 LastIndex = HandleIds.Num() - 1;
+	IdToIndex.Remove(HandleIds[Index]);
+
+	// The last slot moves into Index; repoint its handle before the swap.
+	if (Index != LastIndex)
+	{
+		IdToIndex[HandleIds[LastIndex]] = Index;
+	}
+
+	HandleIds.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Pawns.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Paths.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PathDistances.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PathIndices.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Settings.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Paused.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	FinishedDelegates.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	AdvancedDelegates.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	Locations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PreviousPathIndices.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	AimPoints.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Directions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	EffectiveAcceptances.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StepResults.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void UClickToMovePathFollowerSubsystem::StepFollower(const int32 Index)
+{
+	Directions[Index] = FVector::ZeroVector;
+
+	// Pawn already flagged invalid in the gather phase; paused followers keep their state untouched.
+	if (StepResults[Index] != EStepResult::Continue || Paused[Index])
+	{
+		return;
+	}
+
+	const TArray<FVector>& Path = Paths[Index];
+	int32& PathIndex = PathIndices[Index];
+
+	// Invalid path state (e.g., no points); stop to avoid running forever.
+	if (Path.Num() < 2 || PathIndex == INDEX_NONE || PathIndex >= Path.Num())
+	{
+		StepResults[Index] = EStepResult::Invalid;
+		return;
+	}
+
+	const FClickToMoveFollowSettings& S = Settings[Index];
+	const FVector& PawnLoc = Locations[Index];
+
+	// Compute effective acceptance radius:
+	// Base AcceptanceRadius, optionally scaled by current 2D speed (clamped to min/max).
+	float EffectiveAcceptance = S.AcceptanceRadius;
+	if (S.bScaleAcceptanceBySpeed)
+	{
+		const float Speed2D = Velocities[Index].Size2D(); // uu/s
+		EffectiveAcceptance = FMath::Clamp(
+			S.AcceptanceRadius + Speed2D * S.AcceptanceSpeedScale,
+			S.AcceptanceRadiusMin,
+			S.AcceptanceRadiusMax
+		);
+	}
+	EffectiveAcceptances[Index] = EffectiveAcceptance;
+
+	// Arrival/advance check:
+	// When close enough to the current target (2D distance ignores height discrepancies), step to the next point.
+	if (FVector::DistSquared2D(PawnLoc, Path[PathIndex]) <= FMath::Square(EffectiveAcceptance))
+	{
+		++PathIndex;
+
+		// If we've consumed all points, we reached the end of the path.
+		if (PathIndex >= Path.Num())
+		{
+			StepResults[Index] = EStepResult::Arrived;
+			return;
+		}
+	}
+
+	// Aim point with optional arc-length lookahead (soften turns).
+	// Project the pawn onto the segment it is on (PathIndex - 1 -> PathIndex), convert that to a distance along
+	// the path, then aim at the point LookaheadDistance further along. Near corners the aim point slides around
+	// the corner smoothly instead of jumping when PathIndex advances.
+	FVector AimPoint = Path[PathIndex];
+	if (S.bUseLookahead && S.LookaheadDistance > 0.f)
+	{
+		const TArray<float>& Distances = PathDistances[Index];
+		const FVector& SegmentStart = Path[PathIndex - 1];
+		const FVector2D Segment(AimPoint - SegmentStart);
+		const FVector2D ToPawn(PawnLoc - SegmentStart);
+		const float SegmentLengthSq = Segment.SizeSquared();
+		const float T = SegmentLengthSq > KINDA_SMALL_NUMBER
+			? FMath::Clamp(FVector2D::DotProduct(ToPawn, Segment) / SegmentLengthSq, 0.f, 1.f)
+			: 1.f;
+		const float DistanceOnPath = FMath::Lerp(Distances[PathIndex - 1], Distances[PathIndex], T);
+		AimPoint = SamplePathAtDistance(Path, Distances, DistanceOnPath + S.LookaheadDistance);
+	}
+	AimPoints[Index] = AimPoint;
+
+	// Steer directly toward the aim point (2D vector keeps top-down motion planar).
+	Directions[Index] = (AimPoint - PawnLoc).GetSafeNormal2D();
+}
+
+void UClickToMovePathFollowerSubsystem::BuildArcLengthTable(const TArray<FVector>& Path, TArray<float>& OutDistances)
+{
+	OutDistances.SetNumUninitialized(Path.Num());
+	float Accumulated = 0.f;
+	for (int32 Point = 0; Point < Path.Num(); ++Point)
+	{
+		if (Point > 0)
+		{
+			Accumulated += FVector::Dist2D(Path[Point - 1], Path[Point]);
+		}
+		OutDistances[Point] = Accumulated;
+	}
+}
+
+FVector UClickToMovePathFollowerSubsystem::SamplePathAtDistance(const TArray<FVector>& Path, const TArray<float>& Distances,
+	const float Distance)
+{
+	if (Distance <= 0.f)
+	{
+		return Path[0];
+	}
+	if (Distance >= Distances.Last())
+	{
+		return Path.Last();
+	}
+
+	// First point whose cumulative distance exceeds Distance; the sample lies on the segment ending there.
+	const int32 End = FMath::Clamp(Algo::UpperBound(Distances, Distance), 1, Path.Num() - 1);
+	const float SegmentLength = Distances[End] - Distances[End - 1];
+	const float Alpha = SegmentLength > KINDA_SMALL_NUMBER ? (Distance - Distances[End - 1]) / SegmentLength : 1.f;
+	return FMath::Lerp(Path[End - 1], Path[End], Alpha);
+}
+
+void UClickToMovePathFollowerSubsystem::DrawFollowerDebug(const int32 Index) const
+{
+	#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	const UWorld* World = GetWorld();
+	const TArray<FVector>& Path = Paths[Index];
+	const int32 PathIndex = PathIndices[Index];
+	if (!World || !Path.IsValidIndex(PathIndex))
+	{
+		return;
+	}
+
+	constexpr float DebugLifetime = 0.06f; // short-lived, refreshed each tick
+	const FVector& CurrentTarget = Path[PathIndex];
+	const FVector& AimPoint = AimPoints[Index];
+
+	// 1) Acceptance circle at current target in the XY plane.
+	// To draw in XY plane, use YAxis = X axis (1,0,0), ZAxis = Y axis (0,1,0).
+	DrawDebugCircle(
+		World,
+		CurrentTarget,
+		/*Radius=*/EffectiveAcceptances[Index],
+		/*Segments=*/32,
+		/*Color=*/FColor::Green,
+		/*bPersistentLines=*/false,
+		/*LifeTime=*/DebugLifetime,
+		/*DepthPriority=*/0,
+		/*Thickness=*/1.5f,
+		/*YAxis=*/FVector(1.f, 0.f, 0.f),
+		/*ZAxis=*/FVector(0.f, 1.f, 0.f),
+		/*bDrawAxis=*/false
+	);
+
+	// 2) Markers: current target (yellow), next target (orange), aim point (cyan)
+	DrawDebugSphere(World, CurrentTarget, 10.f, 8, FColor::Yellow, false, DebugLifetime);
+	if (PathIndex + 1 < Path.Num())
+	{
+		DrawDebugSphere(World, Path[PathIndex + 1], 10.f, 8, FColor::Orange, false, DebugLifetime);
+	}
+	DrawDebugSphere(World, AimPoint, 10.f, 8, FColor::Cyan, false, DebugLifetime);
+
+	// 3) Aim line from pawn to aim point
+	DrawDebugLine(World, Locations[Index], AimPoint, FColor::Cyan, false, DebugLifetime, 0, 2.0f);
+
+	// 4) On-screen readout (helpful to verify scaling and lookahead live); keyed per follower.
+	if (GEngine)
+	{
+		const FClickToMoveFollowSettings& S = Settings[Index];
+		GEngine->AddOnScreenDebugMessage(
+			/*Key=*/static_cast<uint64>(42 + HandleIds[Index]), /*Time=*/0.f, FColor::Yellow,
+			FString::Printf(TEXT("Idx %d/%d  Speed2D=%.1f  EffAcc=%.1f  Lookahead=%s d=%.0f"),
+				PathIndex, Path.Num(),
+				Velocities[Index].Size2D(), EffectiveAcceptances[Index],
+				S.bUseLookahead ? TEXT("ON") : TEXT("OFF"),
+				S.LookaheadDistance)
+		);
+	}
+	#endif
+}
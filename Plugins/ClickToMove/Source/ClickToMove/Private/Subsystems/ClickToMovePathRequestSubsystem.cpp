@@ -0,0 +1,178 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/ClickToMovePathRequestSubsystem.h"
+
+#include "ClickToMoveStats.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "NavigationPath.h"
+#include "NavigationSystem.h"
+
+static TAutoConsoleVariable<float> CVarClickToMovePathQueueBudgetMs(
+	TEXT("ClickToMove.PathQueue.BudgetMs"),
+	1.0f,
+	TEXT("Per-frame game-thread budget (milliseconds) for queued ClickToMove path solves. ")
+	TEXT("At least one request is solved per frame regardless; <= 0 drains the whole queue every frame."),
+	ECVF_Default);
+
+UClickToMovePathRequestSubsystem* UClickToMovePathRequestSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UClickToMovePathRequestSubsystem>() : nullptr;
+}
+
+uint32 UClickToMovePathRequestSubsystem::SubmitRequest(const UObject* Requester, APawn* Querier, const FVector& Start,
+	const FVector& Goal, const EClickToMovePathRequestPriority Priority, FClickToMovePathRequestFinished OnFinished)
+{
+	if (!Requester || !Querier)
+	{
+		return 0;
+	}
+
+	INC_DWORD_STAT(STAT_ClickToMove_PathRequestsQueued);
+
+	FPendingPathRequest Request;
+	Request.RequestId = NextRequestId++;
+	if (NextRequestId == 0)
+	{
+		NextRequestId = 1; // 0 stays reserved on wrap-around
+	}
+	Request.Requester = FObjectKey(Requester);
+	Request.Querier = Querier;
+	Request.Start = Start;
+	Request.Goal = Goal;
+	Request.Priority = Priority;
+	Request.OnFinished = MoveTemp(OnFinished);
+
+	// Coalesce: the newest order from a requester supersedes the queued one.
+	// Same priority keeps the queue slot (no starvation for click-spam); otherwise re-insert in the new band.
+	const int32 ExistingIndex = FindPendingIndex(Request.Requester);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		INC_DWORD_STAT(STAT_ClickToMove_PathRequestsCoalesced);
+		if (Pending[ExistingIndex].Priority == Priority)
+		{
+			const uint32 RequestId = Request.RequestId;
+			Pending[ExistingIndex] = MoveTemp(Request);
+			return RequestId;
+		}
+		Pending.RemoveAt(ExistingIndex, 1, EAllowShrinking::No);
+	}
+
+	const uint32 RequestId = Request.RequestId;
+	InsertByPriority(MoveTemp(Request));
+	return RequestId;
+}
+
+void UClickToMovePathRequestSubsystem::CancelRequest(const UObject* Requester)
+{
+	const int32 Index = FindPendingIndex(FObjectKey(Requester));
+	if (Index != INDEX_NONE)
+	{
+		Pending.RemoveAt(Index, 1, EAllowShrinking::No);
+	}
+}
+
+bool UClickToMovePathRequestSubsystem::HasPendingRequest(const UObject* Requester) const
+{
+	return FindPendingIndex(FObjectKey(Requester)) != INDEX_NONE;
+}
+
+void UClickToMovePathRequestSubsystem::Deinitialize()
+{
+	// World teardown: requesters are going away with the world; drop silently.
+	Pending.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UClickToMovePathRequestSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UClickToMovePathRequestSubsystem, STATGROUP_Tickables);
+}
+
+void UClickToMovePathRequestSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	CLICKTOMOVE_SCOPE_CYCLE_COUNTER(STAT_ClickToMove_PathQueueTick);
+
+	const float BudgetMs = CVarClickToMovePathQueueBudgetMs.GetValueOnGameThread();
+	const double StartSeconds = FPlatformTime::Seconds();
+	const double EndSeconds = StartSeconds + BudgetMs * 0.001;
+
+	TArray<FVector> PathPoints;
+	int32 NumSolved = 0;
+	while (Pending.Num() > 0)
+	{
+		// Always make progress; after that, stop once the budget is spent.
+		if (NumSolved > 0 && BudgetMs > 0.f && FPlatformTime::Seconds() >= EndSeconds)
+		{
+			break;
+		}
+
+		// Pop before solving/notifying: the callback may submit a follow-up request for the same requester.
+		FPendingPathRequest Request = MoveTemp(Pending[0]);
+		Pending.RemoveAt(0, 1, EAllowShrinking::No);
+
+		PathPoints.Reset();
+		SolveRequest(Request, PathPoints);
+		++NumSolved;
+
+		Request.OnFinished.ExecuteIfBound(Request.RequestId, PathPoints);
+	}
+
+	SET_DWORD_STAT(STAT_ClickToMove_PathRequestsSolved, NumSolved);
+	SET_DWORD_STAT(STAT_ClickToMove_PathQueueLength, Pending.Num());
+
+	LastTickMicroseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000000.0;
+	LastTickFrame = GFrameCounter;
+}
+
+void UClickToMovePathRequestSubsystem::InsertByPriority(FPendingPathRequest&& Request)
+{
+	// First slot with a strictly lower priority; equal priorities stay FIFO.
+	int32 InsertIndex = Pending.Num();
+	for (int32 Index = 0; Index < Pending.Num(); ++Index)
+	{
+		if (Pending[Index].Priority < Request.Priority)
+		{
+			InsertIndex = Index;
+			break;
+		}
+	}
+	Pending.Insert(MoveTemp(Request), InsertIndex);
+}
+
+int32 UClickToMovePathRequestSubsystem::FindPendingIndex(const FObjectKey& Requester) const
+{
+	return Pending.IndexOfByPredicate([&Requester](const FPendingPathRequest& Request)
+	{
+		return Request.Requester == Requester;
+	});
+}
+
+void UClickToMovePathRequestSubsystem::SolveRequest(const FPendingPathRequest& Request, TArray<FVector>& OutPathPoints) const
+{
+	APawn* Querier = Request.Querier.Get();
+	if (!Querier)
+	{
+		return;
+	}
+
+	CLICKTOMOVE_SCOPE_CYCLE_COUNTER(STAT_ClickToMove_PathQuery);
+
+	// Querier as pathfinding context resolves nav data/filter for its agent size.
+	const UNavigationPath* NavPath = UNavigationSystemV1::FindPathToLocationSynchronously(
+		Querier, Request.Start, Request.Goal, Querier);
+	if (NavPath && NavPath->IsValid() && NavPath->PathPoints.Num() > 0)
+	{
+		OutPathPoints = NavPath->PathPoints;
+		INC_DWORD_STAT_BY(STAT_ClickToMove_PathPoints, NavPath->PathPoints.Num());
+	}
+}
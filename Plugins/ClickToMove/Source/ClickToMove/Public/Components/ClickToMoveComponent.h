@@ -7,14 +7,43 @@
 #include "CoreMinimal.h"
 #include "ClickToMove.h"                 // Defines the NAVIGATION trace channel macro used for cursor tracing
 #include "Components/ActorComponent.h"
+#include "Engine/NetSerialization.h"        // FVector_NetQuantize / FVector_NetQuantize10 for server-pathing RPC + replication
+#include "AI/Navigation/NavigationTypes.h" // FNavPathSharedPtr / ENavigationQueryResult for async path callbacks
+#include "Subsystems/ClickToMovePathFollowerSubsystem.h" // FClickToMoveFollowerHandle / FClickToMoveFollowSettings
 #include "ClickToMoveComponent.generated.h"
 
 // Forward declarations to keep compile units light and avoid extra header includes here.
 // We avoid including heavy headers in the .h to reduce compile times.
 class USplineComponent;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+class UMaterialInterface;
+class AClickToMoveWaypointGraph;
 class AController;
 class APlayerController;
 class APawn;
+class ANavigationData;
+
+// Late cursor sampling: returns this frame's cursor hit on the component's cursor trace channel (true = blocking hit).
+DECLARE_DELEGATE_RetVal_OneParam(bool, FClickToMoveCursorHitProvider, FHitResult& /*OutHit*/);
+
+/**
+ * Server-computed autorun path, replicated to the owning client only (bUseServerPathing).
+ * Points are quantized to 0.1 units; OrderId ties the path to the client order that requested it.
+ */
+USTRUCT()
+struct FClickToMoveReplicatedPath
+{
+	GENERATED_BODY()
+
+	// Waypoints (index 0 = server-side pawn location when solved). Empty = no path found.
+	UPROPERTY()
+	TArray<FVector_NetQuantize10> Points;
+
+	// Client order id echoed back by the server.
+	UPROPERTY()
+	uint16 OrderId = 0;
+};
 
 /**
  * UClickToMoveComponent
@@ -27,7 +56,9 @@ class APawn;
  *
  * - Short-press autorun:
  *   On LMB release, if the press duration is short (<= ShortPressThreshold), we build a path on the navmesh
- *   and then step through its points over time (autorun), driving AddMovementInput toward each point in sequence.
+ *   and hand it to UClickToMovePathFollowerSubsystem, which steps through its points (autorun) together with
+ *   every other follower in the world, driving AddMovementInput toward each point in sequence.
+ *   The component only keeps a follower handle; autorun never ticks it.
  *
  * Responsibilities and ownership
  * - This component is intended to be placed on a PlayerController (preferred) or a Pawn.
@@ -36,13 +67,62 @@ class APawn;
  * Networking model
  * - All decisions and AddMovementInput calls are executed only for local PlayerControllers (client-side).
  *   CharacterMovement replicates the resulting movement to the server/other clients.
+ * - Optional server pathing (bUseServerPathing): a remote client sends only the destination (one reliable RPC per
+ *   order); the server solves the path and replicates it owner-only as quantized waypoints. The client steers
+ *   straight at the destination until the path arrives, then follows it locally (CharacterMovement prediction).
+ *   Clients therefore need no navigation data of their own for autorun.
+ * - Server pathing covers autorun orders only. Hold-to-move keeps steering with local AddMovementInput in every mode:
+ *   the owning client's CharacterMovement already sends one compressed saved move per frame, and the server checks
+ *   those moves (ServerMove correction), so movement stays server-validated. A server-driven hold would add a
+ *   destination RPC roughly every frame on top of that, plus a round trip of steering latency.
+ *
+ * Path requests
+ * - Short-press releases submit their solve to UClickToMovePathRequestSubsystem, the shared time-sliced queue
+ *   (local player priority). The path is usually solved later the same frame and lands in OnQueuedPathFound.
+ *
+ * Async pathfinding (opt-in)
+ * - With bUseAsyncPathfinding, short-press releases submit an async query to the nav system instead of
+ *   solving the path on the game thread. Until the path arrives, autorun steers straight at CachedDestination.
+ * - Every new order bumps PathRequestGeneration; callbacks carrying an older generation are dropped.
+ *
+ * Incremental re-pathing
+ * - A short press whose goal lands within IncrementalRepathRadius of the previous path's goal keeps the
+ *   previous path up to its current target point and only solves a path from that point to the new goal.
+ *   The previous leg must still be clear on the navmesh (nav raycast pawn -> current target), else a full solve runs.
+ *
+ * Group (formation) moves
+ * - MoveGroupToLocation solves one leader path for the whole selection, lays out per-member slots around the goal
+ *   (grid facing the leader's final heading) and projects all slots with a single batched navmesh projection.
+ *   Members share the leader's corridor and end on their own slot; a member only gets an individual path when its
+ *   slot did not project or its first leg onto the shared corridor is blocked.
+ *
+ * Late cursor sampling (bLateHeldCursorSampling)
+ * - OnClickHeld only records the hold; the cursor sample, trace, projection and steering run in a TG_PostUpdateWork
+ *   tick, after the camera has been updated for this frame, so the move target matches the view being rendered.
+ * - The hit comes from the LateCursorHitProvider when one is set (e.g., the shared per-frame cursor hit cache),
+ *   else from the internal trace. The component only ticks on frames with a held sample.
  *
  * Spline notes
- * - A USplineComponent is created via NewObject and intentionally not attached/registered.
- *   It is used purely for optional path visualization or math; there is no automatic scene participation.
+ * - Nothing consumes the spline at runtime, so it is only built when bBuildPathSpline is set.
+ *   It is then created lazily via NewObject and intentionally not attached/registered; it exists purely for
+ *   optional path visualization or math, with no automatic scene participation.
+ *
+ * Hierarchical pathing (bUseHierarchicalPathing)
+ * - Orders farther than HierarchicalPathMinDistance first plan a coarse route over the level's baked
+ *   AClickToMoveWaypointGraph, then solve real nav paths one leg (HierarchicalLegWaypoints coarse waypoints) at a time
+ *   through the path request queue. The next leg is queued when the follower nears the end of the current one, and
+ *   the path handed to the follower is trimmed to the unwalked rest of the current leg plus the new leg.
+ * - No graph, no coarse route, or both ends near the same node: the regular full solve runs.
+ *
+ * Path preview (bShowPathPreview)
+ * - The autorun path is shown as dots/decals of PathPreviewMesh laid out every PathPreviewSpacing units, all in one
+ *   UInstancedStaticMeshComponent created on the controlled pawn (a PlayerController is hidden, so nothing on it renders).
+ * - Instances are rebuilt only when the path points change; as the follower consumes points, the dots behind the pawn
+ *   get per-instance custom data [0] = 1 (0 = still ahead). The material is expected to fade/mask on it.
+ * - Works in every build configuration; unrelated to the debug spheres/lines below.
  *
  * Design goals
- * - Minimize per-tick work: only tick when autorun is active (path is being followed).
+ * - Minimize per-tick work: no component tick (late cursor sampling aside); all followers advance in one batched subsystem tick.
  * - Separate responsibilities: clicking/holding establishes goals; autorun consumes cached path points.
  * - Robustness: project cursor hits onto navmesh so non-walkable clicks still produce a valid target.
  */
@@ -56,10 +136,6 @@ public:
 	// Use BeginPlay for initialization that depends on the world/owner being fully initialized.
 	UClickToMoveComponent();
 
-	// We enable ticking only during autorun; keep it disabled otherwise for performance.
-	// TickComponent drives the per-frame autorun step when a path is active.
-	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
 	// ===== Input forwarding (call these from your PlayerController) =====
 
 	// LMB pressed (start of a click): stop autorun and reset press timers/state.
@@ -71,6 +147,7 @@ public:
 	// - If bUseInternalHitResult is true, perform an internal cursor trace on the NAVIGATION channel.
 	// - Otherwise, use the provided InHitResult (commonly from a highlight/interaction system).
 	// In both cases, we project the point to the navmesh to ensure a reachable target.
+	// With bUseHeldProjectionCache, the trace + projection are skipped while the cursor and camera stay put.
 	// While holding, movement is direct steering toward the projected cursor location (no path building).
 	UFUNCTION(BlueprintCallable, Category="ClickToMove|Input")
 	void OnClickHeld(bool bUseInternalHitResult, const FHitResult& InHitResult);
@@ -89,34 +166,77 @@ public:
 	void SetIsTargeting(const bool bInTargeting) { bIsTargeting = bInTargeting; }
 
 	// Optional external toggle for autorun (normally managed internally).
-	// Can be used by higher-level systems to cancel or force autorun.
+	// Can be used by higher-level systems to pause (false) or resume (true) following the current path.
 	UFUNCTION(BlueprintCallable, Category="ClickToMove")
-	void SetAutoRunActive(const bool bInActive) { bIsAutoRunning = bInActive; }
+	void SetAutoRunActive(bool bInActive);
+
+	// True while a path is being followed (or an async path is pending) and autorun is not paused.
+	UFUNCTION(BlueprintPure, Category="ClickToMove")
+	bool IsAutoRunning() const { return bIsAutoRunning; }
 
-	// Forcefully stop autorun and disable ticking (used by higher-level systems if needed).
+	// Forcefully stop autorun and release the follower (used by higher-level systems if needed).
 	// Clears cached path state so a subsequent order starts from a clean slate.
 	UFUNCTION(BlueprintCallable, Category="ClickToMove|Orders")
 	void StopMovement();
 
+	// ===== Group orders =====
+
+	// RTS-style squad move: one path query for all Members (see "Group (formation) moves" above).
+	// Only pawns this machine may drive (authority or locally controlled) are moved. Replaces any previous group order.
+	UFUNCTION(BlueprintCallable, Category="ClickToMove|Orders")
+	void MoveGroupToLocation(const TArray<APawn*>& Members, const FVector& Destination);
+
+	// Stop every member of the current group order and drop its pending path requests.
+	UFUNCTION(BlueprintCallable, Category="ClickToMove|Orders")
+	void StopGroupMove();
+
+	// Late cursor sampling: where the late tick gets its cursor hit (unbound = internal trace on CursorTraceChannel).
+	void SetLateCursorHitProvider(FClickToMoveCursorHitProvider InProvider) { LateCursorHitProvider = MoveTemp(InProvider); }
+
+	// Channel used for cursor hits that feed hold-to-move.
+	// External hit providers should trace this channel when passing InHitResult to OnClickHeld.
+	UFUNCTION(BlueprintPure, Category="ClickToMove")
+	ECollisionChannel GetCursorTraceChannel() const { return CursorTraceChannel; }
+
 protected:
-	// Component lifecycle start:
-	// - Create the optional spline helper (unattached/unregistered).
-	// - Disable ticking; we only tick during autorun.
+	// Component lifecycle start.
+	// The optional spline helper is created lazily (only when bBuildPathSpline is set).
 	// Avoid heavy work or gameplay logic here (no world time yet).
 	virtual void BeginPlay() override;
 
-	// Autorun step: called from Tick when bIsAutoRunning == true.
-	// Follows path points sequentially to achieve accurate, corner-hugging motion.
-	// Uses 2D distances to avoid false non-arrivals due to minor Z differences (stairs/ramps).
-	void AutoRun();
+	// Late cursor sampling only (bLateHeldCursorSampling): runs this frame's held sample, then turns itself off.
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// Component lifecycle end: abort any in-flight async path query and release the follower
+	// so neither a nav callback nor the follower subsystem touches a dead component.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// On short-press release:
 	// - Project the desired goal to the navmesh.
 	// - Build a path to that goal.
-	// - Cache the path points and enable autorun + ticking.
+	// - Register the path with the follower subsystem and enable autorun.
 	// If no valid path is found, autorun is not started.
 	void FindPathToLocation();
 
+	// Async path query callback (game thread).
+	// RequestGeneration is bound as a payload when the query is submitted; results for an older generation are stale
+	// (the player clicked again, pressed, or movement was stopped) and are discarded.
+	void OnAsyncPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr NavPath, uint32 RequestGeneration);
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// Server pathing: client -> server move order (destination only). The server projects and solves it.
+	UFUNCTION(Server, Reliable)
+	void ServerRequestMoveTo(const FVector_NetQuantize& Destination, uint16 OrderId);
+
+	// Server pathing: the owner received a new server path; follow it if it answers the latest order.
+	UFUNCTION()
+	void OnRep_ServerPath();
+
+	// Nav system callback (generation finished / nav data registered): any cached projection may be stale now.
+	UFUNCTION()
+	void HandleNavigationDataChanged(ANavigationData* NavData);
+
 private:
 	// ===== Internals =====
 
@@ -131,6 +251,10 @@ private:
 	APlayerController* GetOwnerPC() const;
 	APawn* GetControlledPawn() const;
 
+	// Hold-to-move body: held projection cache, cursor hit (GetCursorHit, skipped on a cache hit), navmesh projection
+	// and steering. Runs from OnClickHeld, or from the late tick with bLateHeldCursorSampling.
+	void UpdateHeldMove(const APlayerController* PC, TFunctionRef<bool(FHitResult&)> GetCursorHit);
+
 	// Drive AddMovementInput toward a world destination (shared by held/internal/external traces).
 	// This does not teleport; it simply feeds the CharacterMovement with an input vector for this frame.
 	void ApplyMoveToward(const FVector& DestinationWorld) const;
@@ -140,6 +264,97 @@ private:
 	// Use this to convert arbitrary cursor hits (including non-walkable meshes) into reachable goals.
 	bool ProjectPointToNavmesh(const FVector& InWorld, FVector& OutProjected) const;
 
+	// Submit an async path query from the pawn to GoalOnNav. Returns false if the query could not be issued
+	// (no nav system / nav data), in which case the caller falls back to the queued solve (UClickToMovePathRequestSubsystem).
+	bool RequestPathAsync(APawn* Pawn, const FVector& GoalOnNav);
+
+	// Abort the in-flight async query / queued request (if any) and invalidate its generation so a late callback is ignored.
+	void CancelPendingPathRequest();
+
+	// Hand a freshly built path (sync or async) to the follower subsystem, populate the optional spline, and start autorun.
+	// Reuses the live follower when there is one (e.g., async path replacing the straight-line placeholder).
+	// StartIndex is the first point to steer toward (1 for a fresh path; the splice point for an incremental re-path).
+	void StartFollowingPath(const TArray<FVector>& InPathPoints, int32 StartIndex = 1);
+
+	// Incremental re-path test: GoalOnNav is close to the previous goal and the pawn can still reach the previous
+	// path's current target point in a straight nav raycast.
+	bool CanReusePreviousPathPrefix(const APawn* Pawn, const FVector& GoalOnNav) const;
+
+	// Submit the path solve to UClickToMovePathRequestSubsystem (LocalPlayer priority). With bKeepPreviousPrefix the
+	// solve starts at the previous path's current target and the result is spliced onto the kept prefix.
+	bool RequestPathQueued(APawn* Pawn, const FVector& GoalOnNav, bool bKeepPreviousPrefix);
+
+	// Path request queue callback (bound with the request generation, like OnAsyncPathFound).
+	void OnQueuedPathFound(uint32 RequestId, const TArray<FVector>& InPathPoints, uint32 RequestGeneration);
+
+	// Follower subsystem callback: the path was consumed (or the pawn became invalid).
+	void OnFollowerFinished(bool bReachedGoal);
+
+	// Follower subsystem callback (bound only with the path preview): the follower now steers toward PathIndex.
+	void OnFollowerAdvanced(int32 PathIndex);
+
+	// Hierarchical pathing: plan the coarse route and queue its first leg. False = use the regular solve.
+	bool TryStartHierarchicalRoute(APawn* Pawn, const FVector& GoalOnNav);
+
+	// Hierarchical pathing: queue the solve from LegStart to the next leg target (RouteNextWaypoint onward).
+	bool RequestNextRouteLeg(APawn* Pawn, const FVector& LegStart);
+
+	// Hierarchical pathing: queue the next leg once the follower heads into the last segment(s) of the current one.
+	void MaybeRequestNextRouteLeg(int32 PathIndex);
+
+	// Path request queue callback for a route leg (bound with the request generation, like OnQueuedPathFound).
+	void OnRouteLegFound(uint32 RequestId, const TArray<FVector>& InPathPoints, uint32 RequestGeneration);
+
+	// Hierarchical pathing: forget the coarse route.
+	void ResetRoute();
+
+	// Level waypoint graph (cached; looked up again when it went away).
+	AClickToMoveWaypointGraph* GetWaypointGraph();
+
+	// Path preview: create (or move to a new pawn) the instanced mesh component. Null when there is no mesh/pawn.
+	UInstancedStaticMeshComponent* EnsurePathPreview(APawn* Pawn);
+
+	// Path preview: lay out instances for InPathPoints if they differ from the shown path, then show it consumed up to StartIndex.
+	void UpdatePathPreview(APawn* Pawn, const TArray<FVector>& InPathPoints, int32 StartIndex);
+
+	// Path preview: flag the instances of every segment before PathIndex as consumed (custom data only, no rebuild).
+	void SetPathPreviewProgress(int32 PathIndex);
+
+	// Path preview: hide it; instances are kept in case the same path is shown again.
+	void HidePathPreview();
+
+	// Snapshot of the acceptance/lookahead config for the follower subsystem.
+	FClickToMoveFollowSettings MakeFollowSettings() const;
+
+	// Server pathing: queued solve for a remote client's order finished; publish it through ServerPath.
+	void OnServerPathFound(uint32 RequestId, const TArray<FVector>& InPathPoints, uint32 RequestGeneration, uint16 OrderId);
+
+	// Group order: the shared leader path arrived; lay out slots, batch-project them and start every member.
+	void OnGroupLeaderPathFound(uint32 RequestId, const TArray<FVector>& InPathPoints, uint32 RequestGeneration);
+
+	// Group order: an individual path for MemberIndex (slot unreachable via the shared corridor) arrived.
+	void OnGroupMemberPathFound(uint32 RequestId, const TArray<FVector>& InPathPoints, uint32 RequestGeneration, int32 MemberIndex);
+
+	// Project every point in InOutPoints onto the navmesh with one batched query (NavProjectExtent).
+	// OutProjected[i] is false where no navmesh was found; those points are left untouched.
+	bool BatchProjectPointsToNavmesh(const APawn* Querier, TArray<FVector>& InOutPoints, TBitArray<>& OutProjected) const;
+
+	// Hold-to-move projection cache key: cursor position in viewport pixels + camera view point.
+	// Returns false when the key cannot be built (no cursor position / camera manager); callers then re-query.
+	bool GetHeldProjectionKey(const APlayerController* PC, FVector2D& OutCursor, FVector& OutCameraLocation, FRotator& OutCameraRotation) const;
+
+	// True if the cached held projection can be reused for this key (cursor/camera within tolerances).
+	bool CanReuseHeldProjection(const FVector2D& Cursor, const FVector& CameraLocation, const FRotator& CameraRotation) const;
+
+	// Forget the cached held projection (new press, or the last re-query failed).
+	void InvalidateHeldProjectionCache() { bHasHeldProjectionCache = false; }
+
+	// Navmesh projection LRU (see bUseNavProjectionCache). Find returns true on a hit and fills the cached result.
+	bool FindCachedNavProjection(const FVector& InWorld, FVector& OutProjected, bool& bOutProjected) const;
+	void StoreNavProjection(const FVector& InWorld, const FVector& Projected, bool bProjected) const;
+	FIntVector QuantizeNavProjectionKey(const FVector& InWorld) const;
+	void InvalidateNavProjectionCache() const { NavProjectionCache.Reset(); }
+
 private:
 	// ===== Config (per-instance; reasonable defaults) =====
 
@@ -168,15 +383,21 @@ private:
 	UPROPERTY(EditAnywhere, Category="ClickToMove|Config", meta=(ClampMin="0.0"))
 	float AcceptanceRadiusMax = 120.f;
 
-	// Optional: look ahead toward the next path point to soften turns.
-	// We use a simple blend between the current target and the next point.
+	// Optional: look ahead along the path to soften turns.
+	// The aim point is a fixed distance ahead of the pawn's projection onto the path (arc length),
+	// so cornering is consistent regardless of how long the individual path segments are.
 	UPROPERTY(EditAnywhere, Category="ClickToMove|Config")
 	bool bUseLookahead = true;
 
-	// 0 = no lookahead (aim at current point only), 1 = fully aim at next point.
-	// Typical values 0.2..0.5 gently round corners without cutting too much.
-	UPROPERTY(EditAnywhere, Category="ClickToMove|Config", meta=(ClampMin="0.0", ClampMax="1.0"))
-	float LookaheadBlendAlpha = 0.3f;
+	// Distance along the path (units, measured in 2D) between the pawn's position on the path and the aim point.
+	// 0 = aim at the current path point only. Roughly 1-3x the capsule radius rounds corners without cutting them.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config", meta=(ClampMin="0.0", EditCondition="bUseLookahead"))
+	float LookaheadDistance = 120.f;
+
+	// Draw per-frame autorun debug (acceptance circle, current/next/aim markers, on-screen readout).
+	// Only honored in non-shipping/test builds.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Debug")
+	bool bDebugAutoRun = true;
 
 	// Trace channel used by the component for internal cursor traces while holding.
 	// NAVIGATION comes from ClickToMove.h and should be configured to block walkable ground.
@@ -190,6 +411,110 @@ private:
 	UPROPERTY(EditAnywhere, Category="ClickToMove|Config")
 	FVector NavProjectExtent = FVector(200.f, 200.f, 200.f);
 
+	// Opt-in: build autorun paths with the nav system's async path query instead of the shared path request queue.
+	// Removes game-thread path solves (spiky on large tiled navmeshes); the path arrives a frame or more later,
+	// and autorun steers directly toward CachedDestination in the meantime.
+	// If the async query cannot be issued, the queued solve is used as a fallback.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config")
+	bool bUseAsyncPathfinding = false;
+
+	// Networked mode: remote clients send only the destination; the server solves and replicates the path
+	// (quantized, owner-only). Listen-server hosts and standalone are unaffected. Enables component replication.
+	// Autorun orders only; hold-to-move stays client-steered (see "Networking model" in the class comment).
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Network")
+	bool bUseServerPathing = false;
+
+	// Re-query only the tail of the previous path when a new click lands close to the previous goal (click spam).
+	// Applies to queued solves; async orders always query the full path.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Re-path")
+	bool bUseIncrementalRepath = true;
+
+	// Max 2D distance (units) between the previous goal and the new goal for the previous path prefix to be kept.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Re-path", meta=(ClampMin="0.0", EditCondition="bUseIncrementalRepath"))
+	float IncrementalRepathRadius = 200.f;
+
+	// Cache ProjectPointToNavmesh results (hits and misses) keyed on quantized position + NavProjectExtent.
+	// Projected goals are also stored as their own key, so re-projecting an already projected point
+	// (FindPathToLocation after OnClickHeld) is a hit. Flushed whenever the nav system finishes (re)building.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Projection Cache")
+	bool bUseNavProjectionCache = true;
+
+	// Max cached projections; the least recently used entry is evicted.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Projection Cache", meta=(ClampMin="1", EditCondition="bUseNavProjectionCache"))
+	int32 NavProjectionCacheSize = 16;
+
+	// Grid size (units) used to quantize query positions into cache keys. Larger = more hits, coarser goals.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Projection Cache", meta=(ClampMin="1.0", EditCondition="bUseNavProjectionCache"))
+	float NavProjectionCacheQuantization = 10.f;
+
+	// Reuse the last projected destination in OnClickHeld while the cursor and camera have not moved
+	// (beyond the tolerances below), skipping both the cursor trace and ProjectPointToNavmesh for that frame.
+	// Off by default; opt in per component.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Hold Cache")
+	bool bUseHeldProjectionCache = false;
+
+	// Cursor movement (viewport pixels) under which the cached projection is reused.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Hold Cache", meta=(ClampMin="0.0", EditCondition="bUseHeldProjectionCache"))
+	float HeldCacheCursorTolerancePx = 2.f;
+
+	// Camera translation (units) under which the camera is considered static.
+	// Follow cameras move with the pawn; raise this slightly to keep hits while walking slowly.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Hold Cache", meta=(ClampMin="0.0", EditCondition="bUseHeldProjectionCache"))
+	float HeldCacheCameraLocationTolerance = 1.f;
+
+	// Camera rotation (degrees, per axis) under which the camera is considered static.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Hold Cache", meta=(ClampMin="0.0", EditCondition="bUseHeldProjectionCache"))
+	float HeldCacheCameraRotationTolerance = 0.1f;
+
+	// Plan long orders over the level's AClickToMoveWaypointGraph and refine them leg by leg (see above).
+	// Queued solves only: hierarchical orders ignore bUseAsyncPathfinding and incremental re-pathing.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Hierarchical")
+	bool bUseHierarchicalPathing = false;
+
+	// Orders closer than this (2D units) always use one regular solve.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Hierarchical", meta=(ClampMin="0.0", EditCondition="bUseHierarchicalPathing"))
+	float HierarchicalPathMinDistance = 6000.f;
+
+	// Coarse waypoints covered by each refined leg. Higher = fewer, longer nav queries.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Hierarchical", meta=(ClampMin="1", EditCondition="bUseHierarchicalPathing"))
+	int32 HierarchicalLegWaypoints = 2;
+
+	// Sample the cursor for hold-to-move late in the frame (after the camera update) instead of in the input handler.
+	// The InHitResult passed to OnClickHeld is then ignored; see SetLateCursorHitProvider.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Latency")
+	bool bLateHeldCursorSampling = false;
+
+	// Distance (units) between neighboring formation slots for group orders.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Config|Formation", meta=(ClampMin="0.0"))
+	float FormationSpacing = 150.f;
+
+	// Show the autorun path with instanced PathPreviewMesh dots (see "Path preview" above).
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Path Preview")
+	bool bShowPathPreview = false;
+
+	// Dot/decal mesh. Its material should read PerInstanceCustomData[0] (1 = consumed) to hide walked-over dots.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Path Preview", meta=(EditCondition="bShowPathPreview"))
+	TObjectPtr<UStaticMesh> PathPreviewMesh = nullptr;
+
+	// Optional material override for slot 0 of PathPreviewMesh.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Path Preview", meta=(EditCondition="bShowPathPreview"))
+	TObjectPtr<UMaterialInterface> PathPreviewMaterial = nullptr;
+
+	// Distance (units, along the path) between dots. The final destination always gets one.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Path Preview", meta=(ClampMin="1.0", EditCondition="bShowPathPreview"))
+	float PathPreviewSpacing = 75.f;
+
+	// Upper bound on dots; long paths widen the spacing instead of adding instances.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Path Preview", meta=(ClampMin="2", EditCondition="bShowPathPreview"))
+	int32 PathPreviewMaxInstances = 128;
+
+	// Dot scale and height above the path points (nav points sit on the navmesh, slightly under the floor surface).
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Path Preview", meta=(EditCondition="bShowPathPreview"))
+	FVector PathPreviewScale = FVector(0.2f, 0.2f, 0.2f);
+
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Path Preview", meta=(EditCondition="bShowPathPreview"))
+	float PathPreviewHeightOffset = 5.f;
+
 	// ===== Runtime State (Visible for debugging) =====
 
 	// Latest cursor world point (while holding), or the final nav point (during autorun).
@@ -202,8 +527,8 @@ private:
 	UPROPERTY(VisibleInstanceOnly, Category="ClickToMove|State", meta=(ClampMin="0.0"))
 	float FollowTime = 0.f;
 
-	// True when following a built path (enables Tick to call AutoRun).
-	// This gate ensures we don’t waste cycles when there’s no path to follow.
+	// True when following a built path (the follower subsystem is steering the pawn).
+	// False while paused via SetAutoRunActive(false) or when no path is active.
 	UPROPERTY(VisibleInstanceOnly, Category="ClickToMove|State")
 	bool bIsAutoRunning = false;
 
@@ -212,21 +537,108 @@ private:
 	UPROPERTY(VisibleInstanceOnly, Category="ClickToMove|State")
 	bool bIsTargeting = false;
 
-	// Cached path points returned from the navmesh when we built a path for autorun.
-	// Index 0 is the start (current pawn location); we begin traveling from index 1.
-	// PathPoints are consumed by AutoRun to steer accurately from one corner to the next.
-	UPROPERTY(VisibleInstanceOnly, Category="ClickToMove|State")
-	TArray<FVector> PathPoints;
+	// Handle to our follower in UClickToMovePathFollowerSubsystem (path points + index live there).
+	// Invalid when no path is active.
+	FClickToMoveFollowerHandle FollowerHandle;
 
-	// Current index into PathPoints array (the target point we are moving toward).
-	// Initialized to 1 on a newly built path; INDEX_NONE indicates no active path.
-	// AutoRun advances this index as points are reached.
+	// True while an async path query is in flight; the follower steers straight at CachedDestination until it resolves.
 	UPROPERTY(VisibleInstanceOnly, Category="ClickToMove|State")
-	int32 PathIndex = INDEX_NONE;
+	bool bAwaitingAsyncPath = false;
+
+	// Monotonic counter bumped for every new movement order (or cancellation).
+	// Async callbacks compare their bound generation against this value and drop stale results.
+	uint32 PathRequestGeneration = 0;
+
+	// Late cursor sampling: a hold was recorded this frame; LateCursorHitProvider supplies its hit.
+	bool bHeldSamplePending = false;
+	FClickToMoveCursorHitProvider LateCursorHitProvider;
+
+	// Hold-to-move projection cache (see bUseHeldProjectionCache). Valid only while bHasHeldProjectionCache is true.
+	bool bHasHeldProjectionCache = false;
+	FVector2D HeldCacheCursor = FVector2D::ZeroVector;
+	FVector HeldCacheCameraLocation = FVector::ZeroVector;
+	FRotator HeldCacheCameraRotation = FRotator::ZeroRotator;
+	FVector HeldCacheProjected = FVector::ZeroVector;
+
+	// Nav system query id of the in-flight async request (INVALID_NAVQUERYID when idle); used to abort it early.
+	uint32 PendingAsyncQueryId = INVALID_NAVQUERYID;
+
+	// Path that was live when the current click started (OnClickPressed stops it), kept for incremental re-pathing.
+	// PreviousPathIndex is the point the follower was heading to; INDEX_NONE when no path was live.
+	TArray<FVector> PreviousPathPoints;
+	int32 PreviousPathIndex = INDEX_NONE;
+
+	// Id of our request in UClickToMovePathRequestSubsystem (0 when none is queued).
+	uint32 PendingQueuedRequestId = 0;
+
+	// Goal of the queued request, and the kept prefix to splice its result onto (empty for a full solve).
+	FVector PendingQueuedGoal = FVector::ZeroVector;
+	TArray<FVector> PendingPathPrefix;
+
+	// Navmesh projection LRU entries (small; linear scan). LastUsed is compared against NavProjectionCacheClock.
+	struct FNavProjectionCacheEntry
+	{
+		FIntVector Key = FIntVector::ZeroValue;
+		FVector Extent = FVector::ZeroVector;
+		FVector Projected = FVector::ZeroVector;
+		bool bProjected = false;
+		uint32 LastUsed = 0;
+	};
+	mutable TArray<FNavProjectionCacheEntry> NavProjectionCache;
+	mutable uint32 NavProjectionCacheClock = 0;
+
+	// Latest server-computed path for this client (bUseServerPathing; owner-only).
+	UPROPERTY(ReplicatedUsing=OnRep_ServerPath)
+	FClickToMoveReplicatedPath ServerPath;
+
+	// Client: id of the last order sent to the server, and whether we still want its path.
+	uint16 ServerOrderId = 0;
+	bool bAwaitingServerPath = false;
+
+	// One member of the current group order.
+	struct FGroupMember
+	{
+		TWeakObjectPtr<APawn> Pawn;
+		FVector Slot = FVector::ZeroVector;        // projected slot (or the group goal when the slot did not project)
+		FClickToMoveFollowerHandle FollowerHandle;
+	};
+
+	// Current group order (empty when none). GroupLeader issues the shared path request.
+	TArray<FGroupMember> GroupMembers;
+	TWeakObjectPtr<APawn> GroupLeader;
+	FVector GroupDestination = FVector::ZeroVector;
+
+	// Bumped by every group order / StopGroupMove; queued callbacks with an older value are ignored.
+	uint32 GroupRequestGeneration = 0;
+
+	// Hierarchical route: coarse waypoints ending at the goal, and the first one no leg has been requested for.
+	// Empty when the current order is not hierarchical.
+	TArray<FVector> RouteWaypoints;
+	int32 RouteNextWaypoint = 0;
+
+	// Start of the leg currently in the queue (a failed leg is retried from here straight to the goal).
+	FVector PendingRouteLegStart = FVector::ZeroVector;
+
+	TWeakObjectPtr<AClickToMoveWaypointGraph> WaypointGraph;
+
+	// Path preview instances (world space; owned by the controlled pawn). Created on first use.
+	UPROPERTY(Transient, VisibleInstanceOnly, Category="ClickToMove|Path Preview")
+	TObjectPtr<UInstancedStaticMeshComponent> PathPreview = nullptr;
+
+	// Path the preview instances were built for, PathPreviewFirstInstance[k] = first instance on the segment
+	// ending at point k ([Num] = instance count), and how many leading instances are flagged consumed.
+	TArray<FVector> PathPreviewPoints;
+	TArray<int32> PathPreviewFirstInstance;
+	int32 PathPreviewConsumed = 0;
 
 	// ===== Optional Helpers =====
 
-	// Optional spline used to visualize the path (debug). Not attached/registered by default.
+	// Build the optional path spline for every new path (visualization/tools only; autorun never reads it).
+	// Off by default so successful paths do not pay for spline point allocation/UpdateSpline.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Debug")
+	bool bBuildPathSpline = false;
+
+	// Optional spline used to visualize the path (debug). Created on first use; not attached/registered by default.
 	// You can attach/register it manually if you want it to render in-game/editor.
 	UPROPERTY(VisibleInstanceOnly, Category="ClickToMove|Debug")
 	TObjectPtr<USplineComponent> Spline = nullptr;
@@ -0,0 +1,109 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ClickToMoveWaypointGraph.generated.h"
+
+/**
+ * AClickToMoveWaypointGraph
+ *
+ * High-level behavior
+ * - Coarse waypoint graph for long click-to-move trips (UClickToMoveComponent::bUseHierarchicalPathing).
+ *   Place one per level, build the navmesh, then press "Build Graph". Nodes and edges are saved with the level;
+ *   nothing is generated at runtime.
+ *
+ * Build (editor, offline)
+ * - The default nav data bounds are cut into CellSize x CellSize columns. Each column's center is projected onto the
+ *   navmesh (one node per column: stacked floors collapse to whichever one the projection finds).
+ * - Neighboring nodes (8-connected) are linked when a real nav path exists between them and is at most
+ *   MaxEdgeDetour times their straight-line distance; the edge cost is that path length.
+ * - Edges are stored in compressed rows (EdgeOffsets / EdgeTargets / EdgeCosts) for cache-friendly A*.
+ *
+ * Queries (runtime)
+ * - FindRoute runs A* between the nodes nearest the start and goal (grid cell lookup, no scan) and returns the
+ *   node locations in between. The caller solves the real path leg by leg toward them.
+ * - A* scratch (costs, parents) is kept between queries and invalidated with a stamp, so a query never clears it.
+ */
+UCLASS(NotBlueprintable)
+class CLICKTOMOVE_API AClickToMoveWaypointGraph : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AClickToMoveWaypointGraph();
+
+	/** First waypoint graph placed in World, or null. */
+	static AClickToMoveWaypointGraph* Find(const UWorld* World);
+
+	/** Rebuild the graph from the current navmesh (editor; needs built navigation). */
+	UFUNCTION(CallInEditor, Category="ClickToMove|Waypoint Graph")
+	void BuildGraph();
+
+	/**
+	 * Coarse route from Start to Goal: locations of the nodes strictly between the node nearest Start and the node
+	 * nearest Goal (empty when both ends share a node). Returns false when an end has no node nearby or no route exists.
+	 */
+	bool FindRoute(const FVector& Start, const FVector& Goal, TArray<FVector>& OutWaypoints) const;
+
+	/** Number of baked nodes (0 = not built). */
+	int32 GetNumNodes() const { return NodeLocations.Num(); }
+
+	/** Heap bytes of the baked graph and the query scratch. */
+	SIZE_T GetAllocatedSize() const;
+
+protected:
+	// Column size (units) of the coarse grid. Larger = fewer nodes and longer refined legs.
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Waypoint Graph", meta=(ClampMin="100.0"))
+	float CellSize = 2000.f;
+
+	// Neighbors are linked only when their nav path is at most this many times their straight distance
+	// (keeps walls and cliffs from becoming long detour edges).
+	UPROPERTY(EditAnywhere, Category="ClickToMove|Waypoint Graph", meta=(ClampMin="1.0"))
+	float MaxEdgeDetour = 1.5f;
+
+	// ===== Baked data (written by BuildGraph) =====
+
+	// Cell size the graph was built with, and the world XY of cell (0, 0)'s corner.
+	UPROPERTY(VisibleAnywhere, Category="ClickToMove|Waypoint Graph|Baked")
+	float BakedCellSize = 0.f;
+
+	UPROPERTY(VisibleAnywhere, Category="ClickToMove|Waypoint Graph|Baked")
+	FVector2D GridOrigin = FVector2D::ZeroVector;
+
+	// Node i: projected location and grid cell.
+	UPROPERTY(VisibleAnywhere, Category="ClickToMove|Waypoint Graph|Baked")
+	TArray<FVector> NodeLocations;
+
+	UPROPERTY()
+	TArray<FIntPoint> NodeCells;
+
+	// Edges of node i are [EdgeOffsets[i], EdgeOffsets[i + 1]) in EdgeTargets/EdgeCosts (NumNodes + 1 offsets).
+	UPROPERTY()
+	TArray<int32> EdgeOffsets;
+
+	UPROPERTY()
+	TArray<int32> EdgeTargets;
+
+	UPROPERTY()
+	TArray<float> EdgeCosts;
+
+private:
+	/** Grid cell containing Location (baked grid). */
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/** Closest node in Location's cell or the 8 around it, or INDEX_NONE. */
+	int32 FindNearestNode(const FVector& Location) const;
+
+	/** Cell -> node lookup, rebuilt from NodeCells on first query after load/build. */
+	mutable TMap<FIntPoint, int32> CellToNode;
+
+	/** A* scratch; an entry is valid for the current query only when its stamp matches QueryStamp. */
+	mutable TArray<float> ScratchCost;
+	mutable TArray<int32> ScratchParent;
+	mutable TArray<uint32> ScratchStamp;
+	mutable uint32 QueryStamp = 0;
+};
@@ -0,0 +1,196 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ClickToMovePathFollowerSubsystem.generated.h"
+
+class APawn;
+
+// Fired once when a follower leaves the subsystem on its own.
+// bReachedGoal is true when the last path point was reached, false when the pawn/path became invalid.
+DECLARE_DELEGATE_OneParam(FClickToMoveFollowerFinished, bool /*bReachedGoal*/);
+
+// Fired when a follower's target index moves forward (every point before PathIndex is consumed).
+// Runs from the subsystem tick; receivers must not start/stop followers from it.
+DECLARE_DELEGATE_OneParam(FClickToMoveFollowerAdvanced, int32 /*PathIndex*/);
+
+/**
+ * Opaque handle to a follower owned by UClickToMovePathFollowerSubsystem.
+ * Ids are never reused within a world, so a stale handle simply stops resolving.
+ */
+struct FClickToMoveFollowerHandle
+{
+	int32 Id = INDEX_NONE;
+
+	bool IsValid() const { return Id != INDEX_NONE; }
+	void Reset() { Id = INDEX_NONE; }
+};
+
+/**
+ * Per-follower steering parameters (copied from the owning component when following starts).
+ * Mirrors the UClickToMoveComponent acceptance/lookahead config so any pawn can be driven the same way.
+ */
+struct FClickToMoveFollowSettings
+{
+	// Base distance (2D) at which a path point counts as reached.
+	float AcceptanceRadius = 50.f;
+
+	// EffectiveAcceptance = clamp(AcceptanceRadius + Speed2D * AcceptanceSpeedScale, Min, Max) when enabled.
+	bool bScaleAcceptanceBySpeed = true;
+	float AcceptanceSpeedScale = 0.05f;
+	float AcceptanceRadiusMin = 30.f;
+	float AcceptanceRadiusMax = 120.f;
+
+	// Aim at the point LookaheadDistance (2D arc length) ahead of the pawn's projection onto the path.
+	bool bUseLookahead = true;
+	float LookaheadDistance = 120.f;
+
+	// Draw per-frame autorun debug (acceptance circle, targets, aim line) for this follower.
+	bool bDrawDebug = false;
+};
+
+/**
+ * UClickToMovePathFollowerSubsystem
+ *
+ * High-level behavior
+ * - Owns every active path follower in the world (player autorun, AI pets, summons, formations) and advances
+ *   them all from a single tick, instead of one component tick per follower.
+ *
+ * Data layout
+ * - Structure-of-arrays: pawn pointers, path points, path index, settings and per-frame scratch live in parallel
+ *   dense arrays (swap-removed). Handles map to dense slots through IdToIndex.
+ * - Each path carries a cumulative 2D arc-length table (PathDistances[i][k] = length from point 0 to point k),
+ *   built once per path, so lookahead sampling is a binary search instead of a per-frame walk.
+ *
+ * Tick pipeline
+ * 1) Game thread: gather pawn location/velocity (invalid pawns are flagged).
+ * 2) Math: acceptance test, index advance and aim direction for every follower; runs through ParallelFor once the
+ *    follower count reaches ClickToMove.Follower.ParallelThreshold. Pure math, no UObject access.
+ * 3) Game thread: AddMovementInput for every live follower, then remove finished followers and fire their
+ *    FClickToMoveFollowerFinished delegates (after removal, so callbacks may start/stop followers safely).
+ *    Followers whose index moved this frame fire their optional FClickToMoveFollowerAdvanced delegate first.
+ *
+ * Networking
+ * - The subsystem does not decide authority. Callers only register pawns they are allowed to drive
+ *   (UClickToMoveComponent registers for local PlayerControllers only).
+ */
+UCLASS()
+class CLICKTOMOVE_API UClickToMovePathFollowerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UClickToMovePathFollowerSubsystem* Get(const UObject* WorldContextObject);
+
+	// ===== Follower API =====
+
+	/**
+	 * Start following InPathPoints (index 0 = start; steering begins at StartIndex, normally 1).
+	 * Returns an invalid handle on bad input.
+	 */
+	FClickToMoveFollowerHandle StartFollowing(APawn* Pawn, const TArray<FVector>& InPathPoints,
+		const FClickToMoveFollowSettings& Settings, FClickToMoveFollowerFinished OnFinished, int32 StartIndex = 1);
+
+	/**
+	 * Replace a live follower's path (re-path / async path arrival). Steering resumes at StartIndex
+	 * (1 for a fresh path; the splice point when an already-consumed prefix was kept).
+	 */
+	bool SetFollowerPath(const FClickToMoveFollowerHandle& Handle, const TArray<FVector>& InPathPoints, int32 StartIndex = 1);
+
+	/** Optional progress callback (path preview); fires only on frames where the follower's index advances. */
+	void SetFollowerAdvancedDelegate(const FClickToMoveFollowerHandle& Handle, FClickToMoveFollowerAdvanced OnAdvanced);
+
+	/** Paused followers keep their path and index but receive no movement input. */
+	void SetFollowerPaused(const FClickToMoveFollowerHandle& Handle, bool bPaused);
+
+	/** Remove a follower without firing its finished delegate. Resets the handle. */
+	void StopFollowing(FClickToMoveFollowerHandle& Handle);
+
+	/** True while the handle refers to a live follower. */
+	bool IsFollowing(const FClickToMoveFollowerHandle& Handle) const { return Handle.IsValid() && IdToIndex.Contains(Handle.Id); }
+
+	/** Current target index into the follower's path (INDEX_NONE if the handle is stale). */
+	int32 GetFollowerPathIndex(const FClickToMoveFollowerHandle& Handle) const;
+
+	/** The follower's path points (null if the handle is stale). Do not hold on to the pointer across frames. */
+	const TArray<FVector>* GetFollowerPath(const FClickToMoveFollowerHandle& Handle) const;
+
+	/** Number of live followers (paused ones included). */
+	int32 GetNumFollowers() const { return Pawns.Num(); }
+
+	/** Cost of the latest tick (microseconds, delegates included) and the frame it ran on (GFrameCounter). */
+	double GetLastTickMicroseconds() const { return LastTickMicroseconds; }
+	uint64 GetLastTickFrame() const { return LastTickFrame; }
+
+	/** Heap bytes of the follower arrays and their path buffers. */
+	SIZE_T GetAllocatedSize() const;
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Pawns.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** Result of one follower step. */
+	enum class EStepResult : uint8
+	{
+		Continue,   // steer along Directions[i]
+		Arrived,    // consumed the last path point
+		Invalid     // pawn gone or path unusable
+	};
+
+	/** Dense slot of a handle, or INDEX_NONE. */
+	int32 FindIndex(const FClickToMoveFollowerHandle& Handle) const;
+
+	/** Swap-remove the follower at dense slot Index, keeping IdToIndex in sync. */
+	void RemoveAt(int32 Index);
+
+	/** Pure per-follower math (safe on worker threads): advance index, compute aim + direction. */
+	void StepFollower(int32 Index);
+
+	/** Fill OutDistances with the cumulative 2D arc length at every path point (OutDistances[0] == 0). */
+	static void BuildArcLengthTable(const TArray<FVector>& Path, TArray<float>& OutDistances);
+
+	/** Point at arc length Distance along Path (clamped to the path ends); O(log n) via the distance table. */
+	static FVector SamplePathAtDistance(const TArray<FVector>& Path, const TArray<float>& Distances, float Distance);
+
+	/** Draw the autorun debug shapes for one follower (game thread only). */
+	void DrawFollowerDebug(int32 Index) const;
+
+	// ===== Structure-of-arrays follower storage (all arrays share the same dense index) =====
+
+	TArray<int32> HandleIds;
+	TArray<TWeakObjectPtr<APawn>> Pawns;
+	TArray<TArray<FVector>> Paths;
+	TArray<TArray<float>> PathDistances;
+	TArray<int32> PathIndices;
+	TArray<FClickToMoveFollowSettings> Settings;
+	TArray<bool> Paused;
+	TArray<FClickToMoveFollowerFinished> FinishedDelegates;
+	TArray<FClickToMoveFollowerAdvanced> AdvancedDelegates;
+
+	// Per-frame scratch (written in the gather/step phases, read in the apply phase).
+	TArray<FVector> Locations;
+	TArray<FVector> Velocities;
+	TArray<int32> PreviousPathIndices;
+	TArray<FVector> AimPoints;
+	TArray<FVector> Directions;
+	TArray<float> EffectiveAcceptances;
+	TArray<EStepResult> StepResults;
+
+	/** Handle id -> dense slot. */
+	TMap<int32, int32> IdToIndex;
+
+	/** Next handle id to hand out. */
+	int32 NextHandleId = 0;
+
+	double LastTickMicroseconds = 0.0;
+	uint64 LastTickFrame = 0;
+};
@@ -0,0 +1,110 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ClickToMovePathRequestSubsystem.generated.h"
+
+class APawn;
+
+// Fired once per completed request. PathPoints is empty when no path was found (or the querier went away).
+DECLARE_DELEGATE_TwoParams(FClickToMovePathRequestFinished, uint32 /*RequestId*/, const TArray<FVector>& /*PathPoints*/);
+
+/** Scheduling priority; higher values are served first, FIFO within the same priority. */
+enum class EClickToMovePathRequestPriority : uint8
+{
+	Background,  // ambient AI, pets wandering
+	AI,          // AI orders that should land soon
+	LocalPlayer  // direct local player input (click-to-move)
+};
+
+/**
+ * UClickToMovePathRequestSubsystem
+ *
+ * High-level behavior
+ * - One shared queue for synchronous path solves (click-to-move, AI, summons), drained from a single tick under a
+ *   per-frame millisecond budget (ClickToMove.PathQueue.BudgetMs). Whatever does not fit waits for the next frame.
+ * - At least one request is solved per tick, so a single expensive query can never stall the queue.
+ *
+ * Coalescing
+ * - A requester has at most one pending request. Submitting again replaces start/goal/callback in place
+ *   (the superseded request never fires); the returned id changes so callers can detect stale results.
+ *
+ * Notes
+ * - Queues are expected to hold tens of entries; lookups are linear over a small dense array.
+ * - Completion callbacks run on the game thread from Tick; they may submit or cancel requests.
+ */
+UCLASS()
+class CLICKTOMOVE_API UClickToMovePathRequestSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UClickToMovePathRequestSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Queue a path solve from Start to Goal for Querier's nav agent.
+	 * Requester identifies the caller for coalescing/cancellation (usually the component or controller issuing it).
+	 * Returns the request id (0 if the request was rejected).
+	 */
+	uint32 SubmitRequest(const UObject* Requester, APawn* Querier, const FVector& Start, const FVector& Goal,
+		EClickToMovePathRequestPriority Priority, FClickToMovePathRequestFinished OnFinished);
+
+	/** Drop Requester's pending request (if any) without firing its callback. */
+	void CancelRequest(const UObject* Requester);
+
+	/** True while Requester has a request waiting in the queue. */
+	bool HasPendingRequest(const UObject* Requester) const;
+
+	/** Number of queued requests. */
+	int32 GetNumPendingRequests() const { return Pending.Num(); }
+
+	/** Cost of the latest tick (microseconds, callbacks included) and the frame it ran on (GFrameCounter). */
+	double GetLastTickMicroseconds() const { return LastTickMicroseconds; }
+	uint64 GetLastTickFrame() const { return LastTickFrame; }
+
+	/** Heap bytes of the request queue. */
+	SIZE_T GetAllocatedSize() const { return Pending.GetAllocatedSize(); }
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Pending.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	struct FPendingPathRequest
+	{
+		uint32 RequestId = 0;
+		FObjectKey Requester;
+		TWeakObjectPtr<APawn> Querier;
+		FVector Start = FVector::ZeroVector;
+		FVector Goal = FVector::ZeroVector;
+		EClickToMovePathRequestPriority Priority = EClickToMovePathRequestPriority::Background;
+		FClickToMovePathRequestFinished OnFinished;
+	};
+
+	/** Insert keeping the queue sorted by priority (descending), FIFO within a priority. */
+	void InsertByPriority(FPendingPathRequest&& Request);
+
+	/** Dense index of Requester's pending request, or INDEX_NONE. */
+	int32 FindPendingIndex(const FObjectKey& Requester) const;
+
+	/** Solve one request on the game thread; empty output when no path exists. */
+	void SolveRequest(const FPendingPathRequest& Request, TArray<FVector>& OutPathPoints) const;
+
+	/** Front of the array is served first. */
+	TArray<FPendingPathRequest> Pending;
+
+	/** Next request id to hand out (0 is reserved for "no request"). */
+	uint32 NextRequestId = 1;
+
+	double LastTickMicroseconds = 0.0;
+	uint64 LastTickFrame = 0;
+};
@@ -38,12 +38,15 @@ public class GASAttachEditor : ModuleRules
 				"InputCore",
                 "CoreUObject",
 				"Engine",
+				"DeveloperSettings",
 				"Slate",
 				"SlateCore",
 				"GameplayAbilities",
 				"GameplayTags",
 				"AssetRegistry",
 				"ApplicationCore",
+				"GASCore",
+				"HighlightActor",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -8,8 +8,10 @@
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Text/STextBlock.h"
 #include "SGASAttachEditor.h"
+#include "GASAttachEditorSettings.h"
 #if WITH_EDITOR
 #include "SGASTagLookAsset.h"
+#include "TagLookAsset/GASTagTriggerIndex.h"
 #include "WorkspaceMenuStructureModule.h"
 #include "WorkspaceMenuStructure.h"
 #include "ToolMenus.h"
@@ -37,6 +39,12 @@ void FGASAttachEditorModule::StartupModule()
 
 	FGASAttachEditorCommands::Register();
 
+#if WITH_EDITOR
+	// Tag查询器的索引在后台提前建立
+	// The tag look-up index is built ahead of time in the background
+	FGASTagTriggerIndex::Get().Initialize();
+#endif
+
 	PluginCommands = MakeShareable(new FUICommandList);
 #if WITH_EDITOR
 	const IWorkspaceMenuStructure& MenuStructure =  WorkspaceMenu::GetMenuStructure();
@@ -58,6 +66,14 @@ void FGASAttachEditorModule::ShutdownModule()
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
 
+	if (UObjectInitialized())
+	{
+		UGASAttachEditorSettings::Get()->FlushSave();
+	}
+
+#if WITH_EDITOR
+	FGASTagTriggerIndex::Get().Shutdown();
+#endif
 
 #if WITH_EDITOR
 	UToolMenus::UnRegisterStartupCallback(this);
@@ -0,0 +1,185 @@
+#include "GASViewportPicker.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "AttributeSet.h"
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Interaction/HighlightRegistrySubsystem.h"
+#include "Widgets/SViewport.h"
+
+namespace GASViewportPicker
+{
+	// 命中丢失多久后才清除悬停（秒）
+	// How long a missed pick keeps the hover (seconds)
+	constexpr double HoverGraceSeconds = 0.15;
+
+	// 预览文本刷新间隔（秒）
+	// Preview text refresh interval (seconds)
+	constexpr double PreviewIntervalSeconds = 0.1;
+
+	// 预览中最多显示的属性数（按属性集声明顺序，生命等关键属性在前）
+	// Attributes shown in the preview (declaration order, so the vitals come first)
+	constexpr int32 MaxPreviewAttributes = 6;
+}
+
+FGASViewportPicker::~FGASViewportPicker()
+{
+	Stop();
+}
+
+void FGASViewportPicker::Start(UWorld* InWorld)
+{
+	Stop();
+	if (!InWorld)
+	{
+		return;
+	}
+
+	World = InWorld;
+	DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateRaw(this, &FGASViewportPicker::DrawPreview));
+}
+
+void FGASViewportPicker::Stop()
+{
+	if (DrawHandle.IsValid())
+	{
+		UDebugDrawService::Unregister(DrawHandle);
+		DrawHandle.Reset();
+	}
+
+	World.Reset();
+	SetHovered(nullptr);
+}
+
+void FGASViewportPicker::Tick(const double CurrentTime)
+{
+	UWorld* PickWorld = World.Get();
+	if (!PickWorld)
+	{
+		return;
+	}
+
+	APlayerController* PlayerController = PickWorld->GetFirstPlayerController();
+	UHighlightRegistrySubsystem* Registry = UHighlightRegistrySubsystem::Get(PickWorld);
+	FHitResult Hit;
+	if (PlayerController && PlayerController->IsLocalController() && Registry && Registry->PickUnderCursor(PlayerController, Hit)
+		&& UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Hit.GetActor()))
+	{
+		LastHitTime = CurrentTime;
+		if (Hit.GetActor() != HoveredActor.Get())
+		{
+			SetHovered(Hit.GetActor());
+			LastPreviewTime = 0.0;
+		}
+	}
+	else if (HoveredActor.IsValid() && CurrentTime - LastHitTime > GASViewportPicker::HoverGraceSeconds)
+	{
+		SetHovered(nullptr);
+	}
+
+	if (HoveredAbilitySystem.IsValid() && CurrentTime - LastPreviewTime >= GASViewportPicker::PreviewIntervalSeconds)
+	{
+		UpdatePreview(CurrentTime);
+	}
+}
+
+bool FGASViewportPicker::IsOverViewport(const FVector2D& ScreenPosition) const
+{
+	const UWorld* PickWorld = World.Get();
+	const UGameViewportClient* GameViewport = PickWorld ? PickWorld->GetGameViewport() : nullptr;
+	const TSharedPtr<SViewport> ViewportWidget = GameViewport ? GameViewport->GetGameViewportWidget() : nullptr;
+	return ViewportWidget.IsValid() && ViewportWidget->GetTickSpaceGeometry().IsUnderLocation(ScreenPosition);
+}
+
+void FGASViewportPicker::SetHovered(AActor* Actor)
+{
+	HoveredActor = Actor;
+	HoveredAbilitySystem = Actor ? UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor) : nullptr;
+	PreviewLines.Reset();
+}
+
+void FGASViewportPicker::UpdatePreview(const double CurrentTime)
+{
+	LastPreviewTime = CurrentTime;
+	PreviewLines.Reset();
+
+	const UAbilitySystemComponent* AbilitySystem = HoveredAbilitySystem.Get();
+	const AActor* Actor = HoveredActor.Get();
+	if (!AbilitySystem || !Actor)
+	{
+		return;
+	}
+
+	PreviewLines.Add(FString::Printf(TEXT("%s  (GE %d, Tags %d)"), *Actor->GetName(),
+		AbilitySystem->GetActiveGameplayEffects().GetNumGameplayEffects(), AbilitySystem->GetOwnedGameplayTags().Num()));
+
+	for (const UAttributeSet* AttributeSet : AbilitySystem->GetSpawnedAttributes())
+	{
+		if (!AttributeSet)
+		{
+			continue;
+		}
+
+		for (TFieldIterator<FProperty> It(AttributeSet->GetClass()); It; ++It)
+		{
+			if (PreviewLines.Num() > GASViewportPicker::MaxPreviewAttributes)
+			{
+				return;
+			}
+
+			if (!FGameplayAttribute::IsGameplayAttributeDataProperty(*It))
+			{
+				continue;
+			}
+
+			const FGameplayAttribute Attribute(*It);
+			PreviewLines.Add(FString::Printf(TEXT("%s  %.2f"), *Attribute.GetName(), AbilitySystem->GetNumericAttribute(Attribute)));
+		}
+	}
+}
+
+void FGASViewportPicker::DrawPreview(UCanvas* Canvas, APlayerController* PlayerController)
+{
+	const AActor* Actor = HoveredActor.Get();
+	if (!Canvas || !GEngine || !Actor || PreviewLines.IsEmpty() || !PlayerController || PlayerController->GetWorld() != World.Get())
+	{
+		return;
+	}
+
+	const FVector ScreenLocation = Canvas->Project(Actor->GetActorLocation() + FVector(0.f, 0.f, Actor->GetSimpleCollisionHalfHeight()));
+	if (ScreenLocation.Z <= 0.f)
+	{
+		return;
+	}
+
+	UFont* Font = GEngine->GetSmallFont();
+	float Width = 0.f;
+	float LineHeight = 0.f;
+	for (const FString& Line : PreviewLines)
+	{
+		float LineWidth = 0.f;
+		Canvas->StrLen(Font, Line, LineWidth, LineHeight);
+		Width = FMath::Max(Width, LineWidth);
+	}
+
+	// 预览框画在角色头顶上方
+	// The preview box sits above the actor's head
+	const float Padding = 4.f;
+	const float Height = LineHeight * PreviewLines.Num();
+	const float X = ScreenLocation.X - Width * 0.5f;
+	const float Y = ScreenLocation.Y - Height - Padding * 2.f;
+
+	Canvas->SetDrawColor(FColor(0, 0, 0, 160));
+	Canvas->DrawTile(Canvas->DefaultTexture, X - Padding, Y - Padding, Width + Padding * 2.f, Height + Padding * 2.f, 0.f, 0.f, 1.f, 1.f);
+
+	Canvas->SetDrawColor(FColor::White);
+	for (int32 Index = 0; Index < PreviewLines.Num(); ++Index)
+	{
+		Canvas->DrawText(Font, PreviewLines[Index], X, Y + LineHeight * Index);
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UAbilitySystemComponent;
+class UCanvas;
+class APlayerController;
+class AActor;
+class UWorld;
+
+// 视口拾取：用HighlightActor的屏幕空间注册表找到光标下的ASC（不做射线检测），
+// 并且只为悬停的角色在视口中画属性预览
+// Viewport picking: finds the ASC under the cursor through the HighlightActor screen-space registry (no traces)
+// and draws an attribute preview in the viewport for the hovered actor only
+class FGASViewportPicker
+{
+public:
+	~FGASViewportPicker();
+
+	// 开始拾取World本地玩家视口中的角色
+	// Start picking actors in World's local player viewport
+	void Start(UWorld* InWorld);
+
+	void Stop();
+
+	bool IsActive() const { return World.IsValid(); }
+
+	// 更新悬停的角色（注册表每帧只为每个控制器构建一次屏幕空间，与游戏自己的悬停共用）
+	// Update the hovered actor (the registry builds screen space once per frame per controller, shared with the game's own hover)
+	void Tick(double CurrentTime);
+
+	UAbilitySystemComponent* GetHoveredAbilitySystem() const { return HoveredAbilitySystem.Get(); }
+
+	// 屏幕坐标是否在拾取世界的游戏视口上（只有视口里的点击才算选中）
+	// Whether a screen position is over the picked world's game viewport (only clicks there select)
+	bool IsOverViewport(const FVector2D& ScreenPosition) const;
+
+private:
+
+	void SetHovered(AActor* Actor);
+
+	// 重建预览文本（切换悬停角色时立即重建，之后按间隔刷新）
+	// Rebuild the preview text (immediately on a hover change, then throttled)
+	void UpdatePreview(double CurrentTime);
+
+	void DrawPreview(UCanvas* Canvas, APlayerController* PlayerController);
+
+private:
+
+	TWeakObjectPtr<UWorld> World;
+
+	TWeakObjectPtr<AActor> HoveredActor;
+
+	TWeakObjectPtr<UAbilitySystemComponent> HoveredAbilitySystem;
+
+	// 最后一次拾取命中的时间（短暂丢失命中时保持悬停，避免闪烁）
+	// Last time the pick hit (hover is kept through brief misses so it does not flicker)
+	double LastHitTime = 0.0;
+
+	double LastPreviewTime = 0.0;
+
+	TArray<FString> PreviewLines;
+
+	FDelegateHandle DrawHandle;
+};
@@ -11,7 +11,9 @@ FGASAttributesNode::~FGASAttributesNode()
 
 TSharedRef<FGASAttributesNode> FGASAttributesNode::Create(TWeakObjectPtr<UAbilitySystemComponent> InASComponent, const FGameplayAttribute& InAttribute)
 {
-	return MakeShareable(new FGASAttributesNode(InASComponent, InAttribute));
+	TSharedRef<FGASAttributesNode> Node = MakeShareable(new FGASAttributesNode(InASComponent, InAttribute));
+	Node->Refresh();
+	return Node;
 }
 
 FName FGASAttributesNode::GetGAName() const
@@ -23,9 +25,12 @@ FName FGASAttributesNode::GetGAName() const
 
 float FGASAttributesNode::GetNumericAttribute() const
 {
-	if (!ASComponent.IsValid()) return -1.f;
+	return NumericAttribute;
+}
 
-	return ASComponent->GetNumericAttribute(Attribute);
+void FGASAttributesNode::Refresh()
+{
+	NumericAttribute = ASComponent.IsValid() ? ASComponent->GetNumericAttribute(Attribute) : -1.f;
 }
 
 FGASAttributesNode::FGASAttributesNode(TWeakObjectPtr<UAbilitySystemComponent> InASComponent, const FGameplayAttribute InAttribute)
@@ -43,8 +48,6 @@ void SGASAttributesTreeItem::Construct(const FArguments& InArgs, const TSharedRe
 
 	GAName = WidgetInfo->GetGAName();
 
-	NumericAttribute = WidgetInfo->GetNumericAttribute();
-
 	SMultiColumnTableRow< TSharedRef<FGASAttributesNodeBase> >::Construct(SMultiColumnTableRow< TSharedRef<FGASAttributesNodeBase> >::FArguments().Padding(0), InOwnerTableView);
 }
 
@@ -70,7 +73,7 @@ TSharedRef<SWidget> SGASAttributesTreeItem::GenerateWidgetForColumn(const FName&
 			.Padding(FMargin(2.0f, 0.0f))
 			[
 				SNew(STextBlock)
-				.Text(FText::AsNumber(NumericAttribute))
+				.Text(this, &SGASAttributesTreeItem::GetNumericAttributeText)
 				.Justification(ETextJustify::Center)
 			];
 	}
@@ -78,5 +81,10 @@ TSharedRef<SWidget> SGASAttributesTreeItem::GenerateWidgetForColumn(const FName&
 	return SNullWidget::NullWidget;
 }
 
+FText SGASAttributesTreeItem::GetNumericAttributeText() const
+{
+	return FText::AsNumber(WidgetInfo->GetNumericAttribute());
+}
+
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -29,6 +29,10 @@ public:
 	// Current attribute value
 	virtual float GetNumericAttribute() const = 0;
 
+	// 从ASC重新读取属性值（节点保持不变，行控件绑定到该值）
+	// Re-read the value from the ASC (the node is kept, its row is bound to the value)
+	virtual void Refresh() = 0;
+
 protected:
 
 	FGASAttributesNodeBase(){};
@@ -53,13 +57,17 @@ public:
 
 	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
 
+protected:
+	// 绑定到节点当前值
+	// Bound to the node's current value
+	FText GetNumericAttributeText() const;
+
 protected:
 	/** 关于我们正在可视化的小部件的信息 */
 	/** Information about the widget we are visualizing */
 	TSharedPtr<FGASAttributesNodeBase> WidgetInfo;
 
 	FName GAName;
-	float NumericAttribute;
 };
 
 class FGASAttributesNode : public FGASAttributesNodeBase
@@ -76,6 +84,9 @@ public:
 
 	virtual float GetNumericAttribute() const override;
 
+	virtual void Refresh() override;
+
+	const FGameplayAttribute& GetAttribute() const { return Attribute; }
 
 private:
 
@@ -86,4 +97,8 @@ protected:
 	TWeakObjectPtr<UAbilitySystemComponent> ASComponent;
 
 	FGameplayAttribute Attribute;
+
+	// 上次刷新的值
+	// Value as of the last refresh
+	float NumericAttribute = -1.f;
 };
@@ -31,13 +31,13 @@ void SCharacterTagsViewItem::Construct(const FArguments& InArgs)
 #if WITH_EDITOR
 			.ButtonStyle(FAppStyle::Get(), "NoBorder")
 #endif
-			.ToolTipText(TagsItem.IsValid() ? TagsItem->GetTagTipName() : FText())
+			.ToolTipText(this, &SCharacterTagsViewItem::GetTagTipText)
 			.HAlign(HAlign_Center)
 			.VAlign(VAlign_Center)
 			.OnClicked(this, &SCharacterTagsViewItem::HandleOnClicked)
 			[
 				SAssignNew(ShowTextTag,STextBlock)
-				.Text(TagsItem.IsValid() ? TagsItem->GetTagName() : FText())
+				.Text(this, &SCharacterTagsViewItem::GetTagText)
 				.TextStyle(&InTextStyle)
 				
 			]
@@ -53,6 +53,16 @@ FReply SCharacterTagsViewItem::HandleOnClicked()
 	return FReply::Handled();
 }
 
+FText SCharacterTagsViewItem::GetTagText() const
+{
+	return TagsItem.IsValid() ? TagsItem->GetTagName() : FText();
+}
+
+FText SCharacterTagsViewItem::GetTagTipText() const
+{
+	return TagsItem.IsValid() ? TagsItem->GetTagTipName() : FText();
+}
+
 FText FGASCharacterTags::GetTagTipName() const
 {
 	if (!ASComponent.IsValid())
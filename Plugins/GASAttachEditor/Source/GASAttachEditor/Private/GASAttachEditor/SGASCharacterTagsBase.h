@@ -21,6 +21,10 @@ public:
 	// Get tag comment name
 	virtual FText GetTagTipName() const = 0;
 
+	// 获取Tag（列表比对用）
+	// Get the tag (used to diff the tag lists)
+	virtual FGameplayTag GetGameplayTag() const = 0;
+
 protected:
 
 	FGASCharacterTagsBase(){};
@@ -55,6 +59,12 @@ protected:
 
 	FReply HandleOnClicked();
 
+	// 标签文本实时绑定（行控件在列表比对时保留，计数会变化）
+	// Bound text: rows survive list diffs while the tag count keeps changing
+	FText GetTagText() const;
+
+	FText GetTagTipText() const;
+
 protected:
 	/** The data for this item */
 	TSharedPtr<FGASCharacterTagsBase> TagsItem;
@@ -74,6 +84,8 @@ public:
 
 	virtual FText GetTagTipName() const override;
 
+	virtual FGameplayTag GetGameplayTag() const override { return GameplayTag; }
+
 	static TSharedRef<FGASCharacterTags> Create(TWeakObjectPtr<UAbilitySystemComponent> InASComponent, FGameplayTag InGameplayTag, FName InWidegtName);
 
 private:
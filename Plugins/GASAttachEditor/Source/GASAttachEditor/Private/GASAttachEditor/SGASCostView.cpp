@@ -0,0 +1,422 @@
+#include "SGASCostView.h"
+
+#if GASCORE_EFFECT_PROFILER
+
+#include "AbilitySystemComponent.h"
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "GameplayEffect.h"
+#include "HAL/IConsoleManager.h"
+#include "Subsystems/GASCoreAbilitySystemRegistrySubsystem.h"
+#include "Utilities/GASCoreNetBandwidth.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "SGASAttachEditor"
+
+namespace GASCostView
+{
+	// 采样间隔（速率取相邻两次采样的差）
+	// Sample interval (rates are the difference between two samples)
+	static constexpr double SampleInterval = 1.0;
+
+	static const FName ColumnName(TEXT("Name"));
+	static const FName ColumnEffects(TEXT("Effects"));
+	static const FName ColumnAggregators(TEXT("Aggregators"));
+	static const FName ColumnAttributeChanges(TEXT("AttributeChanges"));
+	static const FName ColumnActivations(TEXT("Activations"));
+	static const FName ColumnBytes(TEXT("Bytes"));
+	static const FName ColumnMilliseconds(TEXT("Milliseconds"));
+
+	// 有激活修改器的属性数：每个这样的属性都有一个聚合器
+	// Attributes modified by an uninhibited active effect: each of them has a live aggregator
+	static int32 CountAggregators(const UAbilitySystemComponent& AbilitySystem)
+	{
+		TSet<FGameplayAttribute> Attributes;
+		for (const FActiveGameplayEffect& Effect : &AbilitySystem.GetActiveGameplayEffects())
+		{
+			if (!Effect.Spec.Def || Effect.bIsInhibited)
+			{
+				continue;
+			}
+			for (const FGameplayModifierInfo& Modifier : Effect.Spec.Def->Modifiers)
+			{
+				Attributes.Add(Modifier.Attribute);
+			}
+		}
+		return Attributes.Num();
+	}
+
+	// 两次采样之间的每秒速率（计数器被重置后为0）
+	// Per-second rate between two samples (0 after the counters were reset)
+	static float GetRate(const double Current, const double Last, const double Elapsed)
+	{
+		return Elapsed > 0.0 && Current >= Last ? static_cast<float>((Current - Last) / Elapsed) : 0.f;
+	}
+
+	static void SetEnabled(const TCHAR* Name, const bool bEnabled)
+	{
+		if (IConsoleVariable* Variable = IConsoleManager::Get().FindConsoleVariable(Name))
+		{
+			Variable->Set(bEnabled, ECVF_SetByCode);
+		}
+	}
+}
+
+// 一行：每列一个数值
+// One row: one value per column
+class SGASCostRow : public SMultiColumnTableRow<TSharedPtr<FGASCostEntry>>
+{
+public:
+	SLATE_BEGIN_ARGS(SGASCostRow)
+		{}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView, const TSharedPtr<FGASCostEntry>& InEntry)
+	{
+		Entry = InEntry;
+		SMultiColumnTableRow<TSharedPtr<FGASCostEntry>>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnId) override
+	{
+		using namespace GASCostView;
+
+		FText Text;
+		if (ColumnId == ColumnName)
+		{
+			Text = FText::FromString(Entry->Name);
+		}
+		else if (ColumnId == ColumnEffects)
+		{
+			Text = FText::AsNumber(Entry->ActiveEffects);
+		}
+		else if (ColumnId == ColumnAggregators)
+		{
+			Text = FText::AsNumber(Entry->Aggregators);
+		}
+		else if (ColumnId == ColumnAttributeChanges)
+		{
+			Text = FText::FromString(FString::Printf(TEXT("%.1f"), Entry->AttributeChangesPerSecond));
+		}
+		else if (ColumnId == ColumnActivations)
+		{
+			Text = FText::FromString(FString::Printf(TEXT("%.1f"), Entry->ActivationsPerSecond));
+		}
+		else if (ColumnId == ColumnBytes)
+		{
+			Text = FText::FromString(FString::Printf(TEXT("%.0f"), Entry->BytesPerSecond));
+		}
+		else if (ColumnId == ColumnMilliseconds)
+		{
+			Text = FText::FromString(FString::Printf(TEXT("%.3f"), Entry->MillisecondsPerSecond));
+		}
+
+		return SNew(STextBlock)
+			.Text(Text);
+	}
+
+private:
+	TSharedPtr<FGASCostEntry> Entry;
+};
+
+void SGASCostView::Construct(const FArguments& InArgs)
+{
+	using namespace GASCostView;
+
+	World = InArgs._World;
+	OnAbilitySystemSelected = InArgs._OnAbilitySystemSelected;
+	SortColumn = ColumnMilliseconds;
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.f)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SNew(SCheckBox)
+				.IsChecked(this, &SGASCostView::GetProfileState)
+				.OnCheckStateChanged(this, &SGASCostView::HandleProfileStateChanged)
+				.ToolTipText(LOCTEXT("CostProfileTip", "GASCore.EffectProfiler.Enable and GASCore.NetBandwidth.Enable"))
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("CostProfile", "Profile"))
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SNew(SCheckBox)
+				.IsChecked(this, &SGASCostView::GetOverlayState)
+				.OnCheckStateChanged(this, &SGASCostView::HandleOverlayStateChanged)
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("CostOverlay", "Viewport Overlay"))
+				]
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SAssignNew(EntryList, SListView<TSharedPtr<FGASCostEntry>>)
+			.ListItemsSource(&Entries)
+			.SelectionMode(ESelectionMode::Single)
+			.OnGenerateRow(this, &SGASCostView::OnGenerateEntryRow)
+			.OnMouseButtonDoubleClick(this, &SGASCostView::HandleMouseButtonDoubleClick)
+			.HeaderRow
+			(
+				SNew(SHeaderRow)
+
+				+ SHeaderRow::Column(ColumnName)
+				.DefaultLabel(LOCTEXT("CostColumnName", "Ability System"))
+				.FillWidth(0.28f)
+				.SortMode(this, &SGASCostView::GetColumnSortMode, ColumnName)
+				.OnSort(this, &SGASCostView::OnColumnSortModeChanged)
+
+				+ SHeaderRow::Column(ColumnEffects)
+				.DefaultLabel(LOCTEXT("CostColumnEffects", "Active GEs"))
+				.FillWidth(0.12f)
+				.SortMode(this, &SGASCostView::GetColumnSortMode, ColumnEffects)
+				.OnSort(this, &SGASCostView::OnColumnSortModeChanged)
+
+				+ SHeaderRow::Column(ColumnAggregators)
+				.DefaultLabel(LOCTEXT("CostColumnAggregators", "Aggregators"))
+				.FillWidth(0.12f)
+				.SortMode(this, &SGASCostView::GetColumnSortMode, ColumnAggregators)
+				.OnSort(this, &SGASCostView::OnColumnSortModeChanged)
+
+				+ SHeaderRow::Column(ColumnAttributeChanges)
+				.DefaultLabel(LOCTEXT("CostColumnAttributeChanges", "Attr Changes/s"))
+				.FillWidth(0.12f)
+				.SortMode(this, &SGASCostView::GetColumnSortMode, ColumnAttributeChanges)
+				.OnSort(this, &SGASCostView::OnColumnSortModeChanged)
+
+				+ SHeaderRow::Column(ColumnActivations)
+				.DefaultLabel(LOCTEXT("CostColumnActivations", "Activations/s"))
+				.FillWidth(0.12f)
+				.SortMode(this, &SGASCostView::GetColumnSortMode, ColumnActivations)
+				.OnSort(this, &SGASCostView::OnColumnSortModeChanged)
+
+				+ SHeaderRow::Column(ColumnBytes)
+				.DefaultLabel(LOCTEXT("CostColumnBytes", "Rep Bytes/s"))
+				.FillWidth(0.12f)
+				.SortMode(this, &SGASCostView::GetColumnSortMode, ColumnBytes)
+				.OnSort(this, &SGASCostView::OnColumnSortModeChanged)
+
+				+ SHeaderRow::Column(ColumnMilliseconds)
+				.DefaultLabel(LOCTEXT("CostColumnMilliseconds", "GAS ms/s"))
+				.FillWidth(0.12f)
+				.SortMode(this, &SGASCostView::GetColumnSortMode, ColumnMilliseconds)
+				.OnSort(this, &SGASCostView::OnColumnSortModeChanged)
+			)
+		]
+	];
+
+	Sample(FPlatformTime::Seconds());
+}
+
+SGASCostView::~SGASCostView()
+{
+	if (OverlayHandle.IsValid())
+	{
+		UDebugDrawService::Unregister(OverlayHandle);
+	}
+}
+
+void SGASCostView::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastSampleTime >= GASCostView::SampleInterval)
+	{
+		Sample(Now);
+	}
+}
+
+ECheckBoxState SGASCostView::GetProfileState() const
+{
+	return GASCoreEffectProfiler::IsEnabled() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SGASCostView::HandleProfileStateChanged(const ECheckBoxState NewState)
+{
+	const bool bEnabled = NewState == ECheckBoxState::Checked;
+	GASCostView::SetEnabled(TEXT("GASCore.EffectProfiler.Enable"), bEnabled);
+#if GASCORE_NET_BANDWIDTH
+	GASCostView::SetEnabled(TEXT("GASCore.NetBandwidth.Enable"), bEnabled);
+#endif
+}
+
+ECheckBoxState SGASCostView::GetOverlayState() const
+{
+	return OverlayHandle.IsValid() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SGASCostView::HandleOverlayStateChanged(const ECheckBoxState NewState)
+{
+	if (NewState == ECheckBoxState::Checked && !OverlayHandle.IsValid())
+	{
+		OverlayHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateSP(this, &SGASCostView::DrawOverlay));
+	}
+	else if (NewState != ECheckBoxState::Checked && OverlayHandle.IsValid())
+	{
+		UDebugDrawService::Unregister(OverlayHandle);
+		OverlayHandle.Reset();
+	}
+}
+
+void SGASCostView::DrawOverlay(UCanvas* Canvas, APlayerController* /*PlayerController*/)
+{
+	if (!Canvas || !GEngine)
+	{
+		return;
+	}
+
+	// 服务器行也画在客户端视口里（PIE中各世界的位置一致）
+	// Server rows are drawn over client viewports too (PIE worlds share positions)
+	Canvas->SetDrawColor(FColor::Yellow);
+	for (const TSharedPtr<FGASCostEntry>& Entry : Entries)
+	{
+		const UAbilitySystemComponent* AbilitySystem = Entry->AbilitySystem.Get();
+		const AActor* Avatar = AbilitySystem ? AbilitySystem->GetAvatarActor_Direct() : nullptr;
+		if (!Avatar)
+		{
+			continue;
+		}
+
+		const FVector ScreenLocation = Canvas->Project(Avatar->GetActorLocation() + FVector(0.f, 0.f, Avatar->GetSimpleCollisionHalfHeight()));
+		if (ScreenLocation.Z <= 0.f)
+		{
+			continue;
+		}
+
+		const FString Text = FString::Printf(TEXT("GE %d  Agg %d  Attr %.1f/s  Act %.1f/s  %.0f B/s  %.3f ms/s"),
+			Entry->ActiveEffects, Entry->Aggregators, Entry->AttributeChangesPerSecond, Entry->ActivationsPerSecond,
+			Entry->BytesPerSecond, Entry->MillisecondsPerSecond);
+		Canvas->DrawText(GEngine->GetSmallFont(), Text, ScreenLocation.X, ScreenLocation.Y);
+	}
+}
+
+void SGASCostView::Sample(const double Now)
+{
+	const double Elapsed = Now - LastSampleTime;
+	LastSampleTime = Now;
+
+	TArray<TSharedPtr<FGASCostEntry>> NewEntries;
+	const TWeakObjectPtr<UWorld> DebugWorld = World.Get();
+	if (const UGASCoreAbilitySystemRegistrySubsystem* Registry = UGASCoreAbilitySystemRegistrySubsystem::Get(DebugWorld.Get()))
+	{
+		for (const TWeakObjectPtr<UAbilitySystemComponent>& Weak : Registry->GetAbilitySystems())
+		{
+			UAbilitySystemComponent* AbilitySystem = Weak.Get();
+			if (!AbilitySystem)
+			{
+				continue;
+			}
+
+			const TSharedPtr<FGASCostEntry>* Existing = Entries.FindByPredicate([AbilitySystem](const TSharedPtr<FGASCostEntry>& Entry)
+			{
+				return Entry->AbilitySystem == AbilitySystem;
+			});
+			const TSharedPtr<FGASCostEntry> Entry = Existing ? *Existing : MakeShared<FGASCostEntry>();
+			const double EntryElapsed = Existing ? Elapsed : 0.0;
+
+			const AActor* Actor = AbilitySystem->GetAvatarActor_Direct() ? AbilitySystem->GetAvatarActor_Direct() : AbilitySystem->GetOwnerActor();
+			Entry->AbilitySystem = AbilitySystem;
+			Entry->Name = Actor ? Actor->GetName() : AbilitySystem->GetName();
+			Entry->ActiveEffects = AbilitySystem->GetActiveGameplayEffects().GetNumGameplayEffects();
+			Entry->Aggregators = GASCostView::CountAggregators(*AbilitySystem);
+
+			const FGASCoreAbilitySystemCost Cost = GASCoreEffectProfiler::GetAbilitySystemCost(AbilitySystem);
+			int64 Bits = 0;
+#if GASCORE_NET_BANDWIDTH
+			Bits = GASCoreNetBandwidth::GetAbilitySystemBits(*AbilitySystem);
+#endif
+			Entry->AttributeChangesPerSecond = GASCostView::GetRate(Cost.AttributeChanges, Entry->LastCost.AttributeChanges, EntryElapsed);
+			Entry->ActivationsPerSecond = GASCostView::GetRate(Cost.AbilityActivations, Entry->LastCost.AbilityActivations, EntryElapsed);
+			Entry->MillisecondsPerSecond = GASCostView::GetRate(Cost.Microseconds, Entry->LastCost.Microseconds, EntryElapsed) / 1000.f;
+			Entry->BytesPerSecond = GASCostView::GetRate(Bits, Entry->LastBits, EntryElapsed) / 8.f;
+			Entry->LastCost = Cost;
+			Entry->LastBits = Bits;
+
+			NewEntries.Add(Entry);
+		}
+	}
+
+	Entries = MoveTemp(NewEntries);
+	SortEntries();
+}
+
+void SGASCostView::SortEntries()
+{
+	using namespace GASCostView;
+
+	const bool bAscending = SortMode == EColumnSortMode::Ascending;
+	const FName Column = SortColumn;
+	Entries.StableSort([bAscending, Column](const TSharedPtr<FGASCostEntry>& A, const TSharedPtr<FGASCostEntry>& B)
+	{
+		if (Column == ColumnName)
+		{
+			return bAscending ? A->Name < B->Name : B->Name < A->Name;
+		}
+
+		const auto GetValue = [Column](const FGASCostEntry& Entry) -> float
+		{
+			if (Column == ColumnEffects) return Entry.ActiveEffects;
+			if (Column == ColumnAggregators) return Entry.Aggregators;
+			if (Column == ColumnAttributeChanges) return Entry.AttributeChangesPerSecond;
+			if (Column == ColumnActivations) return Entry.ActivationsPerSecond;
+			if (Column == ColumnBytes) return Entry.BytesPerSecond;
+			return Entry.MillisecondsPerSecond;
+		};
+		return bAscending ? GetValue(*A) < GetValue(*B) : GetValue(*B) < GetValue(*A);
+	});
+
+	if (EntryList.IsValid())
+	{
+		EntryList->RequestListRefresh();
+	}
+}
+
+EColumnSortMode::Type SGASCostView::GetColumnSortMode(const FName ColumnId) const
+{
+	return ColumnId == SortColumn ? SortMode : EColumnSortMode::None;
+}
+
+void SGASCostView::OnColumnSortModeChanged(const EColumnSortPriority::Type /*SortPriority*/, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
+{
+	SortColumn = ColumnId;
+	SortMode = InSortMode;
+	SortEntries();
+}
+
+void SGASCostView::HandleMouseButtonDoubleClick(TSharedPtr<FGASCostEntry> InEntry)
+{
+	if (InEntry.IsValid())
+	{
+		OnAbilitySystemSelected.ExecuteIfBound(InEntry->AbilitySystem);
+	}
+}
+
+TSharedRef<ITableRow> SGASCostView::OnGenerateEntryRow(TSharedPtr<FGASCostEntry> InEntry, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SGASCostRow, OwnerTable, InEntry);
+}
+
+#undef LOCTEXT_NAMESPACE
+
+#endif
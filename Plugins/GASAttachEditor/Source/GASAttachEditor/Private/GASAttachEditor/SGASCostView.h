@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Widgets/Views/SListView.h"
+#include "Utilities/GASCoreEffectProfiler.h"
+
+#if GASCORE_EFFECT_PROFILER
+
+class UAbilitySystemComponent;
+class UCanvas;
+class APlayerController;
+
+DECLARE_DELEGATE_OneParam(FGASOnCostAbilitySystemSelected, TWeakObjectPtr<UAbilitySystemComponent>);
+
+// 每个ASC的开销（一行一个ASC，按列排序）
+// Cost of one ASC (one row per ASC, sortable by column)
+struct FGASCostEntry
+{
+	TWeakObjectPtr<UAbilitySystemComponent> AbilitySystem;
+
+	FString Name;
+
+	int32 ActiveEffects = 0;
+
+	// 有激活修改器的属性数（= 存活的聚合器）
+	// Attributes with at least one active modifier (= live aggregators)
+	int32 Aggregators = 0;
+
+	float AttributeChangesPerSecond = 0.f;
+
+	float ActivationsPerSecond = 0.f;
+
+	float BytesPerSecond = 0.f;
+
+	// GAS回调耗时（毫秒/秒）
+	// Milliseconds per second spent in profiled GAS work on this ASC
+	float MillisecondsPerSecond = 0.f;
+
+	// 上次采样的累计值（计算速率用）
+	// Cumulative totals at the last sample (rates are the difference)
+	FGASCoreAbilitySystemCost LastCost;
+	int64 LastBits = 0;
+};
+
+// 开销视图：调试世界中每个ASC的GE数、聚合器数、属性变化/技能激活/复制字节/GAS耗时的每秒速率，可排序，也可在视口中叠加显示
+// Cost view: per ASC of the debugged world, the active GE and aggregator counts plus attribute changes, ability
+// activations, replicated bytes and GAS milliseconds per second (GASCoreEffectProfiler / GASCoreNetBandwidth), sortable
+// by column and optionally drawn over the avatars in the game viewports
+class SGASCostView : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGASCostView)
+		{}
+
+		// 调试的世界
+		// Debugged world
+		SLATE_ATTRIBUTE(TWeakObjectPtr<UWorld>, World)
+
+		// 双击一行：在调试器中选中该ASC
+		// Row double-clicked: select that ASC in the debugger
+		SLATE_EVENT(FGASOnCostAbilitySystemSelected, OnAbilitySystemSelected)
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual ~SGASCostView() override;
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+private:
+	// 采样开关（GASCore.EffectProfiler.Enable + GASCore.NetBandwidth.Enable）
+	// Sampling toggle (GASCore.EffectProfiler.Enable + GASCore.NetBandwidth.Enable)
+	ECheckBoxState GetProfileState() const;
+	void HandleProfileStateChanged(ECheckBoxState NewState);
+
+	// 视口叠加
+	// Viewport overlay
+	ECheckBoxState GetOverlayState() const;
+	void HandleOverlayStateChanged(ECheckBoxState NewState);
+	void DrawOverlay(UCanvas* Canvas, APlayerController* PlayerController);
+
+	// 采样一次：更新行和速率
+	// One sample: refresh the rows and their rates
+	void Sample(double Now);
+
+	void SortEntries();
+
+	EColumnSortMode::Type GetColumnSortMode(FName ColumnId) const;
+	void OnColumnSortModeChanged(EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type InSortMode);
+
+	void HandleMouseButtonDoubleClick(TSharedPtr<FGASCostEntry> InEntry);
+
+	TSharedRef<ITableRow> OnGenerateEntryRow(TSharedPtr<FGASCostEntry> InEntry, const TSharedRef<STableViewBase>& OwnerTable);
+
+private:
+	TAttribute<TWeakObjectPtr<UWorld>> World;
+
+	FGASOnCostAbilitySystemSelected OnAbilitySystemSelected;
+
+	TArray<TSharedPtr<FGASCostEntry>> Entries;
+
+	TSharedPtr<SListView<TSharedPtr<FGASCostEntry>>> EntryList;
+
+	FName SortColumn;
+
+	EColumnSortMode::Type SortMode = EColumnSortMode::Descending;
+
+	double LastSampleTime = 0.0;
+
+	FDelegateHandle OverlayHandle;
+};
+
+#endif
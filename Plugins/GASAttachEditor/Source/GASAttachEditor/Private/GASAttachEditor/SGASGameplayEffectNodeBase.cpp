@@ -11,33 +11,22 @@ FGASGameplayEffectNode::~FGASGameplayEffectNode()
 {
 }
 
-TSharedRef<FGASGameplayEffectNode> FGASGameplayEffectNode::Create(const UWorld* InWorld, const FActiveGameplayEffect& InGameplayEffect)
+TSharedRef<FGASGameplayEffectNode> FGASGameplayEffectNode::Create(const UWorld* InWorld, UAbilitySystemComponent* InASComponent, const FActiveGameplayEffectHandle InHandle)
 {
-	return MakeShareable(new FGASGameplayEffectNode(InWorld, InGameplayEffect));
+	TSharedRef<FGASGameplayEffectNode> Node = MakeShareable(new FGASGameplayEffectNode(InWorld, InASComponent, InHandle));
+	Node->Refresh();
+	return Node;
 }
 
-FText FGASGameplayEffectNode::GetDurationText() const
+FText FGASGameplayEffectNode::MakeDurationText(const FActiveGameplayEffect& GameplayEffect) const
 {
-	FText DurationText;
-	if (!World)
-	{
-		if (ModSpec && ModInfo)
-		{
-			UEnum* e = StaticEnum<EGameplayModOp::Type>();
-			FString ModifierOpStr = e->GetNameStringByValue(ModInfo->ModifierOp);
-			DurationText = FText::Format(LOCTEXT("GameplayEffectMod", "Mod: {0}, Value: {1}"), FText::FromString(ModifierOpStr), ModSpec->GetEvaluatedMagnitude());
-		}
-
-		return DurationText;
-	}
-
-	DurationText = LOCTEXT("GameplayEffectInfiniteDurationText", "Infinite Duration");
+	FText Text = LOCTEXT("GameplayEffectInfiniteDurationText", "Infinite Duration");
 
 	FNumberFormattingOptions NumberFormatOptions;
 	NumberFormatOptions.MaximumFractionalDigits = 2;
 	if (GameplayEffect.GetDuration() > 0.f)
 	{
-		DurationText = FText::Format(LOCTEXT("GameplayEffectDurationStr", "Duration: {0},Remaining: {1} (Start: {2} / {3} / {4})"),
+		Text = FText::Format(LOCTEXT("GameplayEffectDurationStr", "Duration: {0},Remaining: {1} (Start: {2} / {3} / {4})"),
 			FText::AsNumber(GameplayEffect.GetDuration(), &NumberFormatOptions),
 			FText::AsNumber(GameplayEffect.GetTimeRemaining(World->GetTimeSeconds()), &NumberFormatOptions),
 			FText::AsNumber(GameplayEffect.StartServerWorldTime, &NumberFormatOptions),
@@ -47,101 +36,123 @@ FText FGASGameplayEffectNode::GetDurationText() const
 
 	if (GameplayEffect.GetPeriod() > 0.f)
 	{
-		DurationText = FText::Format(LOCTEXT("GameplayEffectPeriod","{0} Period: {1}"), DurationText, FText::AsNumber(GameplayEffect.GetPeriod(), &NumberFormatOptions));
+		Text = FText::Format(LOCTEXT("GameplayEffectPeriod","{0} Period: {1}"), Text, FText::AsNumber(GameplayEffect.GetPeriod(), &NumberFormatOptions));
 	}
 
-	return DurationText;
+	return Text;
 }
 
-FText FGASGameplayEffectNode::GetStackText() const
+bool FGASGameplayEffectNode::Refresh()
 {
-	FText StackText;
+	// 修改器子节点由父节点刷新；效果已移除时保留最后的值（由调用方丢弃节点）
+	// Modifier children are refreshed by their parent; a removed effect keeps its last values (the caller drops it)
+	const FActiveGameplayEffect* GameplayEffect = World && ASComponent.IsValid() ? ASComponent->GetActiveGameplayEffect(Handle) : nullptr;
+	if (!GameplayEffect)
+	{
+		return false;
+	}
+
+	const FGameplayEffectSpec& Spec = GameplayEffect->Spec;
+	GAName = *GetNameSafe(Spec.Def);
+	DurationText = MakeDurationText(*GameplayEffect);
+	LevelStr = *LexToSanitizedString(Spec.GetLevel());
 
-	if (World && GameplayEffect.Spec.GetStackCount() > 1)
+	StackText = FText();
+	if (Spec.GetStackCount() > 1)
 	{
-		if (GameplayEffect.Spec.Def->StackingType == EGameplayEffectStackingType::AggregateBySource)
+		if (Spec.Def && Spec.Def->StackingType == EGameplayEffectStackingType::AggregateBySource)
 		{
-			StackText =  FText::Format(LOCTEXT("GameplayEffectStacksForm", "Stacks: {0},From: {1}"), GameplayEffect.Spec.GetStackCount(), FText::FromString(GetNameSafe(GameplayEffect.Spec.GetContext().GetInstigatorAbilitySystemComponent()->GetAvatarActor_Direct())));
+			const UAbilitySystemComponent* Instigator = Spec.GetContext().GetInstigatorAbilitySystemComponent();
+			StackText = FText::Format(LOCTEXT("GameplayEffectStacksForm", "Stacks: {0},From: {1}"), Spec.GetStackCount(),
+				FText::FromString(GetNameSafe(Instigator ? Instigator->GetAvatarActor_Direct() : nullptr)));
 		}
 		else
 		{
-			StackText =  FText::Format(LOCTEXT("GameplayEffectStacks", "Stacks: {0}"), GameplayEffect.Spec.GetStackCount());
+			StackText = FText::Format(LOCTEXT("GameplayEffectStacks", "Stacks: {0}"), Spec.GetStackCount());
 		}
 	}
 
-	return StackText;
-}
-
-FName FGASGameplayEffectNode::GetLevelStr() const
-{
-	if (!World) return FName();
-
-	return *LexToSanitizedString(GameplayEffect.Spec.GetLevel());
-}
-
-FText FGASGameplayEffectNode::GetPredictedText() const
-{
-	FText PredictionText;
+	PredictedText = FText();
+	if (GameplayEffect->PredictionKey.IsValidKey())
+	{
+		PredictedText = GameplayEffect->PredictionKey.WasLocallyGenerated()
+			? LOCTEXT("GameplayEffectPredictedWaiting", "Predicted and Waiting")
+			: LOCTEXT("GameplayEffectPredictedCaught", "Predicted and Caught Up");
+	}
 
-	if (World && GameplayEffect.PredictionKey.IsValidKey())
+	FGameplayTagContainer GrantedTags;
+	Spec.GetAllGrantedTags(GrantedTags);
+	GrantedTagsName = *GrantedTags.ToStringSimple();
+
+	// 每个修改器一个子节点：数量不变时原地更新
+	// One child per modifier, updated in place while the count is unchanged
+	const int32 NumModifiers = Spec.Def ? FMath::Min(Spec.Modifiers.Num(), Spec.Def->Modifiers.Num()) : 0;
+	const bool bChildrenChanged = ChildNodes.Num() != NumModifiers;
+	if (bChildrenChanged)
 	{
-		if (GameplayEffect.PredictionKey.WasLocallyGenerated())
-		{
-			PredictionText =  LOCTEXT("GameplayEffectPredictedWaiting", "Predicted and Waiting");
-		}
-		else
+		ChildNodes.Reset(NumModifiers);
+		for (int32 ModIdx = 0; ModIdx < NumModifiers; ++ModIdx)
 		{
-			PredictionText = LOCTEXT("GameplayEffectPredictedCaught", "Predicted and Caught Up");
+			AddChildNode(MakeShareable(new FGASGameplayEffectNode()));
 		}
 	}
+	for (int32 ModIdx = 0; ModIdx < NumModifiers; ++ModIdx)
+	{
+		StaticCastSharedRef<FGASGameplayEffectNode>(ChildNodes[ModIdx])->SetModifier(Spec.Modifiers[ModIdx], Spec.Def->Modifiers[ModIdx]);
+	}
 
-	return PredictionText;
+	return bChildrenChanged;
 }
 
-FName FGASGameplayEffectNode::GetGrantedTagsName() const
+void FGASGameplayEffectNode::SetModifier(const FModifierSpec& ModSpec, const FGameplayModifierInfo& ModInfo)
 {
-	if (!World) return FName();
+	GAName = *ModInfo.Attribute.GetName();
 
-	FGameplayTagContainer GrantedTags;
-	GameplayEffect.Spec.GetAllGrantedTags(GrantedTags);
+	UEnum* e = StaticEnum<EGameplayModOp::Type>();
+	FString ModifierOpStr = e->GetNameStringByValue(ModInfo.ModifierOp);
+	DurationText = FText::Format(LOCTEXT("GameplayEffectMod", "Mod: {0}, Value: {1}"), FText::FromString(ModifierOpStr), ModSpec.GetEvaluatedMagnitude());
+}
 
-	return *GrantedTags.ToStringSimple();
+FText FGASGameplayEffectNode::GetDurationText() const
+{
+	return DurationText;
 }
 
-FName FGASGameplayEffectNode::GetGAName() const
+FText FGASGameplayEffectNode::GetStackText() const
 {
-	if (ModSpec && ModInfo)
-	{
-		return *ModInfo->Attribute.GetName();
-	}
+	return StackText;
+}
 
-	return *GetNameSafe(GameplayEffect.Spec.Def);
+FName FGASGameplayEffectNode::GetLevelStr() const
+{
+	return LevelStr;
 }
 
-FGASGameplayEffectNode::FGASGameplayEffectNode(const UWorld* InWorld, const FActiveGameplayEffect InGameplayEffect)
+FText FGASGameplayEffectNode::GetPredictedText() const
 {
-	GameplayEffect = InGameplayEffect;
-	World = InWorld;
-	ModInfo = nullptr;
-	ModSpec = nullptr;
+	return PredictedText;
+}
 
-	CreateChild();
+FName FGASGameplayEffectNode::GetGrantedTagsName() const
+{
+	return GrantedTagsName;
 }
 
-FGASGameplayEffectNode::FGASGameplayEffectNode(const FModifierSpec* InModSpec,const FGameplayModifierInfo* InModInfo)
+FName FGASGameplayEffectNode::GetGAName() const
 {
-	World = nullptr;
-	ModInfo = InModInfo;
-	ModSpec = InModSpec;
+	return GAName;
 }
 
-void FGASGameplayEffectNode::CreateChild()
+FGASGameplayEffectNode::FGASGameplayEffectNode(const UWorld* InWorld, UAbilitySystemComponent* InASComponent, const FActiveGameplayEffectHandle InHandle)
 {
-	for (int32 ModIdx = 0; ModIdx < GameplayEffect.Spec.Modifiers.Num(); ++ModIdx)
-	{
-		if (GameplayEffect.Spec.Def == nullptr) break;
-		AddChildNode(MakeShareable(new FGASGameplayEffectNode(&GameplayEffect.Spec.Modifiers[ModIdx], &GameplayEffect.Spec.Def->Modifiers[ModIdx])));
-	}
+	World = InWorld;
+	ASComponent = InASComponent;
+	Handle = InHandle;
+}
+
+FGASGameplayEffectNode::FGASGameplayEffectNode()
+{
+	World = nullptr;
 }
 
 void SGASGameplayEffectTreeItem::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
@@ -151,15 +162,34 @@ void SGASGameplayEffectTreeItem::Construct(const FArguments& InArgs, const TShar
 
 	check(WidgetInfo.IsValid());
 
-	GAName = WidgetInfo->GetGAName();
-	DurationText = WidgetInfo->GetDurationText();
-	StackText = WidgetInfo->GetStackText();
-	LevelStr = WidgetInfo->GetLevelStr();
-	GrantedTagsName = WidgetInfo->GetGrantedTagsName();
-	
 	SMultiColumnTableRow< TSharedRef<FGASGameplayEffectNodeBase> >::Construct(SMultiColumnTableRow< TSharedRef<FGASGameplayEffectNodeBase> >::FArguments().Padding(0), InOwnerTableView);
 }
 
+FText SGASGameplayEffectTreeItem::GetGANameText() const
+{
+	return FText::FromName(WidgetInfo->GetGAName());
+}
+
+FText SGASGameplayEffectTreeItem::GetDurationText() const
+{
+	return WidgetInfo->GetDurationText();
+}
+
+FText SGASGameplayEffectTreeItem::GetStackText() const
+{
+	return WidgetInfo->GetStackText();
+}
+
+FText SGASGameplayEffectTreeItem::GetLevelText() const
+{
+	return FText::FromName(WidgetInfo->GetLevelStr());
+}
+
+FText SGASGameplayEffectTreeItem::GetGrantedTagsText() const
+{
+	return FText::FromName(WidgetInfo->GetGrantedTagsName());
+}
+
 TSharedRef<SWidget> SGASGameplayEffectTreeItem::GenerateWidgetForColumn(const FName& ColumnName)
 {
 	if (NAME_GAGameplayEffectName == ColumnName)
@@ -184,7 +214,7 @@ TSharedRef<SWidget> SGASGameplayEffectTreeItem::GenerateWidgetForColumn(const FN
 				.Padding(FMargin(2.0f, 0.0f))
 				[
 					SNew(STextBlock)
-					.Text(FText::FromName(GAName))
+					.Text(this, &SGASGameplayEffectTreeItem::GetGANameText)
 					.Justification(ETextJustify::Center)
 				]
 			];
@@ -197,7 +227,7 @@ TSharedRef<SWidget> SGASGameplayEffectTreeItem::GenerateWidgetForColumn(const FN
 			.Padding(FMargin(2.0f, 0.0f))
 			[
 				SNew(STextBlock)
-				.Text(DurationText)
+				.Text(this, &SGASGameplayEffectTreeItem::GetDurationText)
 				.Justification(ETextJustify::Center)
 			];
 	}
@@ -209,7 +239,7 @@ TSharedRef<SWidget> SGASGameplayEffectTreeItem::GenerateWidgetForColumn(const FN
 			.Padding(FMargin(2.0f, 0.0f))
 			[
 				SNew(STextBlock)
-				.Text(StackText)
+				.Text(this, &SGASGameplayEffectTreeItem::GetStackText)
 				.Justification(ETextJustify::Center)
 			];
 	}
@@ -221,7 +251,7 @@ TSharedRef<SWidget> SGASGameplayEffectTreeItem::GenerateWidgetForColumn(const FN
 			.Padding(FMargin(2.0f, 0.0f))
 			[
 				SNew(STextBlock)
-				.Text(FText::FromName(LevelStr))
+				.Text(this, &SGASGameplayEffectTreeItem::GetLevelText)
 				.Justification(ETextJustify::Center)
 			];
 	}
@@ -233,9 +263,9 @@ TSharedRef<SWidget> SGASGameplayEffectTreeItem::GenerateWidgetForColumn(const FN
 			.Padding(FMargin(2.0f, 0.0f))
 			[
 				SNew(STextBlock)
-				.Text(FText::FromName(GrantedTagsName))
+				.Text(this, &SGASGameplayEffectTreeItem::GetGrantedTagsText)
 				.Justification(ETextJustify::Center)
-				.ToolTipText(FText::FromName(GrantedTagsName))
+				.ToolTipText(this, &SGASGameplayEffectTreeItem::GetGrantedTagsText)
 			];
 	}
 
@@ -41,6 +41,11 @@ public:
 	// 当前含有的Tag信息
 	virtual FName GetGrantedTagsName() const = 0;
 
+	// 从ASC重新读取显示的值（节点保持不变，行控件绑定到这些值）；返回子节点是否变化（需要刷新树）
+	// Re-read the displayed values from the ASC (the node is kept, rows are bound to the values); returns whether the
+	// child nodes changed (the tree needs a refresh)
+	virtual bool Refresh() = 0;
+
 public:
 	// 将给定节点添加到此小部件的子级列表中（此节点将保留对实例的强引用）
 	void AddChildNode(TSharedRef<FGASGameplayEffectNodeBase> InChildNode);
@@ -76,15 +81,18 @@ public:
 
 	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
 
+protected:
+	// 绑定到节点当前值（节点原地更新，不重建行）
+	// Bound to the node's current values (nodes update in place, rows are not regenerated)
+	FText GetGANameText() const;
+	FText GetDurationText() const;
+	FText GetStackText() const;
+	FText GetLevelText() const;
+	FText GetGrantedTagsText() const;
+
 protected:
 	/** 关于我们正在可视化的小部件的信息 */
 	TSharedPtr<FGASGameplayEffectNodeBase> WidgetInfo;
-
-	FName GAName;
-	FText DurationText;
-	FText StackText;
-	FName LevelStr;
-	FName GrantedTagsName;
 };
 
 class FGASGameplayEffectNode : public FGASGameplayEffectNodeBase
@@ -92,8 +100,9 @@ class FGASGameplayEffectNode : public FGASGameplayEffectNodeBase
 public:
 	virtual ~FGASGameplayEffectNode() override;
 
-	static TSharedRef<FGASGameplayEffectNode> Create(const UWorld* World, const FActiveGameplayEffect& InGameplayEffect);
-
+	// 按激活句柄创建（节点身份 = 句柄），创建时读取一次
+	// Created per active handle (the handle is the node identity) and read once
+	static TSharedRef<FGASGameplayEffectNode> Create(const UWorld* World, UAbilitySystemComponent* InASComponent, FActiveGameplayEffectHandle InHandle);
 
 public:
 
@@ -109,23 +118,35 @@ public:
 
 	virtual FName GetGrantedTagsName() const override;
 
+	virtual bool Refresh() override;
+
+	FActiveGameplayEffectHandle GetHandle() const { return Handle; }
+
 private:
 
-	explicit FGASGameplayEffectNode(const UWorld* World, const FActiveGameplayEffect InGameplayEffect);
+	explicit FGASGameplayEffectNode(const UWorld* World, UAbilitySystemComponent* InASComponent, FActiveGameplayEffectHandle InHandle);
 
-	explicit FGASGameplayEffectNode(const FModifierSpec* ModSpec,const FGameplayModifierInfo* ModInfo);
+	// 修改器子节点（由父节点刷新）
+	// Modifier child node (refreshed by its parent)
+	FGASGameplayEffectNode();
 
-protected:
+	void SetModifier(const FModifierSpec& ModSpec, const FGameplayModifierInfo& ModInfo);
 
-	void CreateChild();
+	FText MakeDurationText(const FActiveGameplayEffect& GameplayEffect) const;
 
 protected:
 	const UWorld* World;
 
 	TWeakObjectPtr<UAbilitySystemComponent> ASComponent;
 
-	FActiveGameplayEffect GameplayEffect;
+	FActiveGameplayEffectHandle Handle;
 
-	const FModifierSpec* ModSpec;
-	const FGameplayModifierInfo* ModInfo;
+	// 上次刷新的显示值
+	// Displayed values as of the last refresh
+	FName GAName;
+	FText DurationText;
+	FText StackText;
+	FName LevelStr;
+	FText PredictedText;
+	FName GrantedTagsName;
 };
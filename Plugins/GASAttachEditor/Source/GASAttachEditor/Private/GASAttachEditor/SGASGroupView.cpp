@@ -0,0 +1,525 @@
+#include "SGASGroupView.h"
+
+#include "AbilitySystemComponent.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "GASAttachEditorSettings.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/AppStyle.h"
+#include "Subsystems/GASCoreAbilitySystemRegistrySubsystem.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Layout/SSplitter.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "SGASAttachEditor"
+
+namespace GASGroupView
+{
+	static constexpr int32 NumBuckets = 10;
+
+	static const FName ColumnName(TEXT("Name"));
+	static const FName ColumnCount(TEXT("Count"));
+	static const FName ColumnMin(TEXT("Min"));
+	static const FName ColumnMean(TEXT("Mean"));
+	static const FName ColumnMax(TEXT("Max"));
+	static const FName ColumnHistogram(TEXT("Histogram"));
+
+	static void FillStats(FGASGroupAttributeStats& Stats, const TArray<float>& Values)
+	{
+		Stats.Count = Values.Num();
+		Stats.Min = Values[0];
+		Stats.Max = Values[0];
+		double Sum = 0.0;
+		for (const float Value : Values)
+		{
+			Stats.Min = FMath::Min(Stats.Min, Value);
+			Stats.Max = FMath::Max(Stats.Max, Value);
+			Sum += Value;
+		}
+		Stats.Mean = static_cast<float>(Sum / Stats.Count);
+
+		// 所有值相同时全部落在第一个桶
+		// Identical values all land in the first bucket
+		const float Range = Stats.Max - Stats.Min;
+		Stats.Buckets.Init(0, NumBuckets);
+		for (const float Value : Values)
+		{
+			const int32 Bucket = Range > UE_SMALL_NUMBER ? FMath::Min(FMath::FloorToInt32((Value - Stats.Min) / Range * NumBuckets), NumBuckets - 1) : 0;
+			++Stats.Buckets[Bucket];
+		}
+	}
+
+	static FText FormatValue(const float Value)
+	{
+		FNumberFormattingOptions NumberFormatOptions;
+		NumberFormatOptions.MaximumFractionalDigits = 2;
+		return FText::AsNumber(Value, &NumberFormatOptions);
+	}
+}
+
+void SGASHistogram::Construct(const FArguments& InArgs)
+{
+	Stats = InArgs._Stats;
+}
+
+int32 SGASHistogram::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	if (!Stats.IsValid() || Stats->Buckets.IsEmpty())
+	{
+		return LayerId;
+	}
+
+	int32 MaxCount = 1;
+	for (const int32 Count : Stats->Buckets)
+	{
+		MaxCount = FMath::Max(MaxCount, Count);
+	}
+
+	const FSlateBrush* Brush = FAppStyle::GetBrush("WhiteBrush");
+	const FVector2f Size = AllottedGeometry.GetLocalSize();
+	const float BarWidth = Size.X / Stats->Buckets.Num();
+	for (int32 Index = 0; Index < Stats->Buckets.Num(); ++Index)
+	{
+		const int32 Count = Stats->Buckets[Index];
+		if (Count == 0)
+		{
+			continue;
+		}
+
+		const float BarHeight = FMath::Max(1.f, Size.Y * Count / MaxCount);
+		FSlateDrawElement::MakeBox(
+			OutDrawElements,
+			LayerId,
+			AllottedGeometry.ToPaintGeometry(FVector2f(FMath::Max(1.f, BarWidth - 1.f), BarHeight), FSlateLayoutTransform(FVector2f(Index * BarWidth, Size.Y - BarHeight))),
+			Brush,
+			ESlateDrawEffect::None,
+			FLinearColor(0.2f, 0.6f, 1.f) * InWidgetStyle.GetColorAndOpacityTint());
+	}
+
+	return LayerId + 1;
+}
+
+FVector2D SGASHistogram::ComputeDesiredSize(float /*LayoutScaleMultiplier*/) const
+{
+	return FVector2D(120.f, 16.f);
+}
+
+// 属性统计行
+// Attribute statistics row
+class SGASGroupAttributeRow : public SMultiColumnTableRow<TSharedPtr<FGASGroupAttributeStats>>
+{
+public:
+	SLATE_BEGIN_ARGS(SGASGroupAttributeRow)
+		{}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView, const TSharedPtr<FGASGroupAttributeStats>& InStats)
+	{
+		Stats = InStats;
+		SMultiColumnTableRow<TSharedPtr<FGASGroupAttributeStats>>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnId) override
+	{
+		using namespace GASGroupView;
+
+		// 条目原地更新：文本绑定到条目
+		// Entries update in place: the texts are bound to the entry
+		const TSharedPtr<FGASGroupAttributeStats> Entry = Stats;
+		if (ColumnId == ColumnHistogram)
+		{
+			return SNew(SGASHistogram)
+				.Stats(Entry)
+				.ToolTipText_Lambda([Entry]
+				{
+					return FText::Format(LOCTEXT("GroupHistogramTip", "{0} buckets over [{1}, {2}]"),
+						FText::AsNumber(Entry->Buckets.Num()), FormatValue(Entry->Min), FormatValue(Entry->Max));
+				});
+		}
+
+		TAttribute<FText> Text;
+		if (ColumnId == ColumnName)
+		{
+			Text = FText::FromString(Entry->Name);
+		}
+		else if (ColumnId == ColumnCount)
+		{
+			Text = TAttribute<FText>::CreateLambda([Entry] { return FText::AsNumber(Entry->Count); });
+		}
+		else if (ColumnId == ColumnMin)
+		{
+			Text = TAttribute<FText>::CreateLambda([Entry] { return FormatValue(Entry->Min); });
+		}
+		else if (ColumnId == ColumnMean)
+		{
+			Text = TAttribute<FText>::CreateLambda([Entry] { return FormatValue(Entry->Mean); });
+		}
+		else if (ColumnId == ColumnMax)
+		{
+			Text = TAttribute<FText>::CreateLambda([Entry] { return FormatValue(Entry->Max); });
+		}
+
+		return SNew(STextBlock)
+			.Text(Text);
+	}
+
+private:
+	TSharedPtr<FGASGroupAttributeStats> Stats;
+};
+
+void SGASGroupView::Construct(const FArguments& InArgs)
+{
+	using namespace GASGroupView;
+
+	World = InArgs._World;
+
+	// 筛选条件从设置里恢复
+	// Filters are restored from the settings
+	const FGASAttachEditorFilterPreset& Filter = UGASAttachEditorSettings::Get()->ActiveFilter;
+	SelectedClass = Filter.GroupClass.Get();
+	RequiredTag = Filter.GroupRequiredTag;
+	ExcludedTag = Filter.GroupExcludedTag;
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.f)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SNew(SComboButton)
+				.OnGetMenuContent(this, &SGASGroupView::OnGetClassMenu)
+				.ContentPadding(2)
+				.ButtonContent()
+				[
+					SNew(STextBlock)
+					.Text(this, &SGASGroupView::GetClassText)
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SAssignNew(RequiredTagText, SEditableTextBox)
+				.MinDesiredWidth(160.f)
+				.HintText(LOCTEXT("GroupRequiredTag", "Has tag"))
+				.Text(FText::FromName(RequiredTag.GetTagName()))
+				.OnTextCommitted(this, &SGASGroupView::HandleTagFilterCommitted, false)
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SAssignNew(ExcludedTagText, SEditableTextBox)
+				.MinDesiredWidth(160.f)
+				.HintText(LOCTEXT("GroupExcludedTag", "Without tag"))
+				.Text(FText::FromName(ExcludedTag.GetTagName()))
+				.OnTextCommitted(this, &SGASGroupView::HandleTagFilterCommitted, true)
+			]
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			.VAlign(VAlign_Center)
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SNew(STextBlock)
+				.Text_Lambda([this] { return SummaryText; })
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SNew(SSplitter)
+
+			+ SSplitter::Slot()
+			.Value(0.65f)
+			[
+				SAssignNew(AttributeList, SListView<TSharedPtr<FGASGroupAttributeStats>>)
+				.ListItemsSource(&AttributeItems)
+				.SelectionMode(ESelectionMode::None)
+				.OnGenerateRow(this, &SGASGroupView::OnGenerateAttributeRow)
+				.HeaderRow
+				(
+					SNew(SHeaderRow)
+
+					+ SHeaderRow::Column(ColumnName)
+					.DefaultLabel(LOCTEXT("GroupColumnName", "Attribute"))
+					.FillWidth(0.3f)
+
+					+ SHeaderRow::Column(ColumnCount)
+					.DefaultLabel(LOCTEXT("GroupColumnCount", "Count"))
+					.FillWidth(0.1f)
+
+					+ SHeaderRow::Column(ColumnMin)
+					.DefaultLabel(LOCTEXT("GroupColumnMin", "Min"))
+					.FillWidth(0.1f)
+
+					+ SHeaderRow::Column(ColumnMean)
+					.DefaultLabel(LOCTEXT("GroupColumnMean", "Mean"))
+					.FillWidth(0.1f)
+
+					+ SHeaderRow::Column(ColumnMax)
+					.DefaultLabel(LOCTEXT("GroupColumnMax", "Max"))
+					.FillWidth(0.1f)
+
+					+ SHeaderRow::Column(ColumnHistogram)
+					.DefaultLabel(LOCTEXT("GroupColumnHistogram", "Distribution"))
+					.FillWidth(0.3f)
+				)
+			]
+
+			+ SSplitter::Slot()
+			.Value(0.35f)
+			[
+				SAssignNew(TagList, SListView<TSharedPtr<FGASGroupTagStats>>)
+				.ListItemsSource(&TagItems)
+				.SelectionMode(ESelectionMode::None)
+				.OnGenerateRow(this, &SGASGroupView::OnGenerateTagRow)
+			]
+		]
+	];
+
+	Aggregate();
+}
+
+void SGASGroupView::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// 每次遍历整个注册表，间隔见设置
+	// Each pass walks the whole registry, the interval comes from the settings
+	if (FPlatformTime::Seconds() - LastAggregateTime >= UGASAttachEditorSettings::Get()->GroupRefreshInterval)
+	{
+		Aggregate();
+	}
+}
+
+TSharedRef<SWidget> SGASGroupView::OnGetClassMenu()
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+
+	MenuBuilder.AddMenuEntry(LOCTEXT("GroupAllClasses", "All Classes"), FText(), FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &SGASGroupView::HandleClassSelected, TWeakObjectPtr<UClass>())));
+
+	for (const TWeakObjectPtr<UClass>& Class : SeenClasses)
+	{
+		if (Class.IsValid())
+		{
+			MenuBuilder.AddMenuEntry(FText::FromString(Class->GetName()), FText(), FSlateIcon(),
+				FUIAction(FExecuteAction::CreateSP(this, &SGASGroupView::HandleClassSelected, Class)));
+		}
+	}
+
+	return MenuBuilder.MakeWidget();
+}
+
+FText SGASGroupView::GetClassText() const
+{
+	return SelectedClass.IsValid() ? FText::FromString(SelectedClass->GetName()) : LOCTEXT("GroupAllClasses", "All Classes");
+}
+
+void SGASGroupView::HandleClassSelected(const TWeakObjectPtr<UClass> InClass)
+{
+	SelectedClass = InClass;
+
+	UGASAttachEditorSettings* Settings = UGASAttachEditorSettings::Get();
+	Settings->ActiveFilter.GroupClass = InClass.Get();
+	Settings->RequestSave();
+
+	Aggregate();
+}
+
+void SGASGroupView::HandleTagFilterCommitted(const FText& InText, ETextCommit::Type /*CommitType*/, const bool bExcluded)
+{
+	const FString TagName = InText.ToString().TrimStartAndEnd();
+	const FGameplayTag Tag = TagName.IsEmpty() ? FGameplayTag() : FGameplayTag::RequestGameplayTag(FName(*TagName), false);
+
+	const TSharedPtr<SEditableTextBox>& TextBox = bExcluded ? ExcludedTagText : RequiredTagText;
+	TextBox->SetError(!TagName.IsEmpty() && !Tag.IsValid() ? LOCTEXT("GroupUnknownTag", "Unknown gameplay tag") : FText());
+
+	(bExcluded ? ExcludedTag : RequiredTag) = Tag;
+
+	UGASAttachEditorSettings* Settings = UGASAttachEditorSettings::Get();
+	(bExcluded ? Settings->ActiveFilter.GroupExcludedTag : Settings->ActiveFilter.GroupRequiredTag) = Tag;
+	Settings->RequestSave();
+
+	Aggregate();
+}
+
+void SGASGroupView::RefreshFiltersFromSettings()
+{
+	const FGASAttachEditorFilterPreset& Filter = UGASAttachEditorSettings::Get()->ActiveFilter;
+	SelectedClass = Filter.GroupClass.Get();
+	RequiredTag = Filter.GroupRequiredTag;
+	ExcludedTag = Filter.GroupExcludedTag;
+
+	RequiredTagText->SetText(FText::FromName(RequiredTag.GetTagName()));
+	RequiredTagText->SetError(FText());
+	ExcludedTagText->SetText(FText::FromName(ExcludedTag.GetTagName()));
+	ExcludedTagText->SetError(FText());
+
+	Aggregate();
+}
+
+void SGASGroupView::Aggregate()
+{
+	LastAggregateTime = FPlatformTime::Seconds();
+
+	// 一次遍历：筛选成员，收集属性值和Tag计数
+	// One pass: filter the members, collect attribute values and tag counts
+	TMap<FGameplayAttribute, TArray<float>> Values;
+	TMap<FGameplayTag, int32> TagCounts;
+	TArray<TWeakObjectPtr<UClass>> Classes;
+	int32 NumRegistered = 0;
+	NumMembers = 0;
+
+	const TWeakObjectPtr<UWorld> DebugWorld = World.Get();
+	if (const UGASCoreAbilitySystemRegistrySubsystem* Registry = UGASCoreAbilitySystemRegistrySubsystem::Get(DebugWorld.Get()))
+	{
+		FGameplayTagContainer OwnedTags;
+		for (const TWeakObjectPtr<UAbilitySystemComponent>& Weak : Registry->GetAbilitySystems())
+		{
+			const UAbilitySystemComponent* AbilitySystem = Weak.Get();
+			if (!AbilitySystem)
+			{
+				continue;
+			}
+			++NumRegistered;
+
+			const AActor* Avatar = AbilitySystem->GetAvatarActor_Direct();
+			if (Avatar)
+			{
+				Classes.AddUnique(Avatar->GetClass());
+			}
+			if (SelectedClass.IsValid() && (!Avatar || !Avatar->IsA(SelectedClass.Get())))
+			{
+				continue;
+			}
+			if ((RequiredTag.IsValid() && !AbilitySystem->HasMatchingGameplayTag(RequiredTag))
+				|| (ExcludedTag.IsValid() && AbilitySystem->HasMatchingGameplayTag(ExcludedTag)))
+			{
+				continue;
+			}
+			++NumMembers;
+
+			for (const UAttributeSet* Set : AbilitySystem->GetSpawnedAttributes())
+			{
+				if (!Set)
+				{
+					continue;
+				}
+				for (TFieldIterator<FStructProperty> It(Set->GetClass()); It; ++It)
+				{
+					if (FGameplayAttribute::IsGameplayAttributeDataProperty(*It))
+					{
+						const FGameplayAttribute Attribute(*It);
+						Values.FindOrAdd(Attribute).Add(AbilitySystem->GetNumericAttribute(Attribute));
+					}
+				}
+			}
+
+			OwnedTags.Reset();
+			AbilitySystem->GetOwnedGameplayTags(OwnedTags);
+			for (const FGameplayTag& Tag : OwnedTags)
+			{
+				++TagCounts.FindOrAdd(Tag);
+			}
+		}
+	}
+
+	SeenClasses = MoveTemp(Classes);
+	SummaryText = FText::Format(LOCTEXT("GroupSummary", "{0} of {1} ability systems"), FText::AsNumber(NumMembers), FText::AsNumber(NumRegistered));
+
+	// 属性条目：复用已有条目，列表只在属性集合变化时刷新
+	// Attribute entries: existing ones are reused, the list refreshes only when the set of attributes changed
+	TMap<FGameplayAttribute, TSharedPtr<FGASGroupAttributeStats>> PreviousAttributeStats = MoveTemp(AttributeStatsByAttribute);
+	AttributeStatsByAttribute.Reset();
+	TArray<TSharedPtr<FGASGroupAttributeStats>> NewAttributeItems;
+	for (const TPair<FGameplayAttribute, TArray<float>>& Pair : Values)
+	{
+		TSharedPtr<FGASGroupAttributeStats> Stats = PreviousAttributeStats.FindRef(Pair.Key);
+		if (!Stats.IsValid())
+		{
+			Stats = MakeShared<FGASGroupAttributeStats>();
+			Stats->Attribute = Pair.Key;
+			Stats->Name = Pair.Key.GetName();
+		}
+		GASGroupView::FillStats(*Stats, Pair.Value);
+
+		AttributeStatsByAttribute.Add(Pair.Key, Stats);
+		NewAttributeItems.Add(Stats);
+	}
+	NewAttributeItems.Sort([](const TSharedPtr<FGASGroupAttributeStats>& A, const TSharedPtr<FGASGroupAttributeStats>& B) { return A->Name < B->Name; });
+	if (NewAttributeItems != AttributeItems)
+	{
+		AttributeItems = MoveTemp(NewAttributeItems);
+		if (AttributeList.IsValid())
+		{
+			AttributeList->RequestListRefresh();
+		}
+	}
+
+	// Tag条目：按拥有数从多到少
+	// Tag entries: most common first
+	TMap<FGameplayTag, TSharedPtr<FGASGroupTagStats>> PreviousTagStats = MoveTemp(TagStatsByTag);
+	TagStatsByTag.Reset();
+	TArray<TSharedPtr<FGASGroupTagStats>> NewTagItems;
+	for (const TPair<FGameplayTag, int32>& Pair : TagCounts)
+	{
+		TSharedPtr<FGASGroupTagStats> Stats = PreviousTagStats.FindRef(Pair.Key);
+		if (!Stats.IsValid())
+		{
+			Stats = MakeShared<FGASGroupTagStats>();
+			Stats->Tag = Pair.Key;
+		}
+		Stats->Count = Pair.Value;
+
+		TagStatsByTag.Add(Pair.Key, Stats);
+		NewTagItems.Add(Stats);
+	}
+	NewTagItems.Sort([](const TSharedPtr<FGASGroupTagStats>& A, const TSharedPtr<FGASGroupTagStats>& B)
+	{
+		return A->Count != B->Count ? A->Count > B->Count : A->Tag.GetTagName().LexicalLess(B->Tag.GetTagName());
+	});
+	if (NewTagItems != TagItems)
+	{
+		TagItems = MoveTemp(NewTagItems);
+		if (TagList.IsValid())
+		{
+			TagList->RequestListRefresh();
+		}
+	}
+}
+
+TSharedRef<ITableRow> SGASGroupView::OnGenerateAttributeRow(TSharedPtr<FGASGroupAttributeStats> InStats, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SGASGroupAttributeRow, OwnerTable, InStats);
+}
+
+TSharedRef<ITableRow> SGASGroupView::OnGenerateTagRow(TSharedPtr<FGASGroupTagStats> InStats, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<TSharedPtr<FGASGroupTagStats>>, OwnerTable)
+		[
+			SNew(STextBlock)
+			.Text_Lambda([this, InStats]
+			{
+				return FText::Format(LOCTEXT("GroupTagCount", "{0}  {1} ({2}%)"), FText::FromName(InStats->Tag.GetTagName()),
+					FText::AsNumber(InStats->Count), FText::AsNumber(NumMembers > 0 ? FMath::RoundToInt32(100.f * InStats->Count / NumMembers) : 0));
+			})
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "GameplayTagContainer.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/SLeafWidget.h"
+#include "Widgets/Views/SListView.h"
+
+class SEditableTextBox;
+
+// 一个属性在组内的统计（最小/平均/最大 + 直方图）
+// Group statistics of one attribute (min / mean / max + histogram)
+struct FGASGroupAttributeStats
+{
+	FGameplayAttribute Attribute;
+
+	FString Name;
+
+	int32 Count = 0;
+
+	float Min = 0.f;
+
+	float Max = 0.f;
+
+	float Mean = 0.f;
+
+	// 在 [Min, Max] 上等宽分桶
+	// Equal-width buckets over [Min, Max]
+	TArray<int32> Buckets;
+};
+
+// 组内拥有某Tag的ASC数
+// Group members owning a tag
+struct FGASGroupTagStats
+{
+	FGameplayTag Tag;
+
+	int32 Count = 0;
+};
+
+// 直方图：每个桶一根柱子，高度按最大桶归一
+// Histogram: one bar per bucket, heights normalized to the fullest bucket
+class SGASHistogram : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGASHistogram)
+		{}
+		SLATE_ARGUMENT(TSharedPtr<FGASGroupAttributeStats>, Stats)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+	TSharedPtr<FGASGroupAttributeStats> Stats;
+};
+
+// 组模式：按类和Tag筛选调试世界的ASC，节流地遍历一次注册表，统计每个属性的分布（直方图）和每个Tag的拥有数
+// Group mode: filters the debugged world's ASCs by avatar class and tags and, in one throttled pass over the ASC
+// registry, aggregates every attribute's distribution (histogram) and how many members own each tag
+class SGASGroupView : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGASGroupView)
+		{}
+
+		// 调试的世界
+		// Debugged world
+		SLATE_ATTRIBUTE(TWeakObjectPtr<UWorld>, World)
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+	// 从设置重新读取筛选条件（应用预设后）并立即统计
+	// Re-read the filters from the settings (after a preset was applied) and aggregate right away
+	void RefreshFiltersFromSettings();
+
+private:
+	// 类筛选
+	// Class filter
+	TSharedRef<SWidget> OnGetClassMenu();
+	FText GetClassText() const;
+	void HandleClassSelected(TWeakObjectPtr<UClass> InClass);
+
+	// 必须拥有 / 必须没有的Tag（按层级匹配）
+	// Required / excluded tags (hierarchical match)
+	void HandleTagFilterCommitted(const FText& InText, ETextCommit::Type CommitType, bool bExcluded);
+
+	// 遍历注册表一次，更新所有统计
+	// One pass over the registry: refresh every statistic
+	void Aggregate();
+
+	TSharedRef<ITableRow> OnGenerateAttributeRow(TSharedPtr<FGASGroupAttributeStats> InStats, const TSharedRef<STableViewBase>& OwnerTable);
+
+	TSharedRef<ITableRow> OnGenerateTagRow(TSharedPtr<FGASGroupTagStats> InStats, const TSharedRef<STableViewBase>& OwnerTable);
+
+private:
+	TAttribute<TWeakObjectPtr<UWorld>> World;
+
+	TWeakObjectPtr<UClass> SelectedClass;
+
+	TSharedPtr<SEditableTextBox> RequiredTagText;
+
+	TSharedPtr<SEditableTextBox> ExcludedTagText;
+
+	FGameplayTag RequiredTag;
+
+	FGameplayTag ExcludedTag;
+
+	// 上次遍历时见到的化身类（类菜单）
+	// Avatar classes seen by the last pass (class menu)
+	TArray<TWeakObjectPtr<UClass>> SeenClasses;
+
+	FText SummaryText;
+
+	double LastAggregateTime = 0.0;
+
+	// 统计条目按属性/Tag保留，原地更新
+	// Entries are kept per attribute / tag and updated in place
+	TMap<FGameplayAttribute, TSharedPtr<FGASGroupAttributeStats>> AttributeStatsByAttribute;
+
+	TMap<FGameplayTag, TSharedPtr<FGASGroupTagStats>> TagStatsByTag;
+
+	TArray<TSharedPtr<FGASGroupAttributeStats>> AttributeItems;
+
+	TArray<TSharedPtr<FGASGroupTagStats>> TagItems;
+
+	TSharedPtr<SListView<TSharedPtr<FGASGroupAttributeStats>>> AttributeList;
+
+	TSharedPtr<SListView<TSharedPtr<FGASGroupTagStats>>> TagList;
+
+	int32 NumMembers = 0;
+};
@@ -0,0 +1,247 @@
+#include "SGASRemoteInspector.h"
+
+#if GASCORE_SNAPSHOT_STREAM
+
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "SGASAttachEditor"
+
+void SGASRemoteInspector::Construct(const FArguments& InArgs)
+{
+	StatusText = LOCTEXT("RemoteDisconnected", "Not connected. Start the server with GASCore.SnapshotStream.Port <port>.");
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.f)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SNew(SBox)
+				.WidthOverride(160.f)
+				[
+					SAssignNew(HostText, SEditableTextBox)
+					.ToolTipText(LOCTEXT("RemoteHost", "Server host"))
+					.Text(FText::FromString(TEXT("127.0.0.1")))
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SNew(SBox)
+				.WidthOverride(70.f)
+				[
+					SAssignNew(PortText, SEditableTextBox)
+					.ToolTipText(LOCTEXT("RemotePort", "GASCore.SnapshotStream.Port of the server"))
+					.Text(FText::FromString(TEXT("7790")))
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SNew(SButton)
+				.OnClicked(this, &SGASRemoteInspector::HandleConnectClicked)
+				.Text(this, &SGASRemoteInspector::GetConnectText)
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SNew(SComboButton)
+				.OnGetMenuContent(this, &SGASRemoteInspector::OnGetComponentMenu)
+				.ContentPadding(2)
+				.ButtonContent()
+				[
+					SNew(STextBlock)
+					.Text(this, &SGASRemoteInspector::GetComponentText)
+				]
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(FMargin(6.f, 2.f))
+		[
+			SNew(STextBlock)
+			.Text_Lambda([this] { return StatusText; })
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SNew(SBorder)
+			.Padding(2.f)
+			[
+				SAssignNew(LineList, SListView<TSharedPtr<FString>>)
+				.ListItemsSource(&Lines)
+				.SelectionMode(ESelectionMode::None)
+				.OnGenerateRow(this, &SGASRemoteInspector::OnGenerateLineRow)
+			]
+		]
+	];
+}
+
+void SGASRemoteInspector::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	const bool bWasConnected = Client.IsConnected();
+	const bool bWasConnecting = Client.IsConnecting();
+	Client.Tick();
+	if (bWasConnecting && Client.IsConnected())
+	{
+		StatusText = FText::Format(LOCTEXT("RemoteConnected", "Connected to {0}."), FText::FromString(ConnectTarget));
+	}
+	else if ((bWasConnected || bWasConnecting) && !Client.IsConnected() && !Client.IsConnecting())
+	{
+		SelectedId = 0;
+		StatusText = FText::FromString(Client.GetLastError());
+	}
+
+	if (BuiltRevision != Client.GetRevision())
+	{
+		RebuildLines();
+	}
+}
+
+FReply SGASRemoteInspector::HandleConnectClicked()
+{
+	if (Client.IsConnected() || Client.IsConnecting())
+	{
+		Client.Disconnect();
+		SelectedId = 0;
+		StatusText = LOCTEXT("RemoteDisconnectedByUser", "Disconnected.");
+		return FReply::Handled();
+	}
+
+	const FString Host = HostText->GetText().ToString().TrimStartAndEnd();
+	const int32 Port = FCString::Atoi(*PortText->GetText().ToString());
+
+	// Completes in Tick: the editor keeps running while the host resolves and the handshake is pending.
+	FString Error;
+	ConnectTarget = FString::Printf(TEXT("%s:%d"), *Host, Port);
+	if (Client.Connect(Host, Port, Error))
+	{
+		StatusText = FText::Format(LOCTEXT("RemoteConnecting", "Connecting to {0}..."), FText::FromString(ConnectTarget));
+	}
+	else
+	{
+		StatusText = FText::FromString(Error);
+	}
+	return FReply::Handled();
+}
+
+FText SGASRemoteInspector::GetConnectText() const
+{
+	if (Client.IsConnecting())
+	{
+		return LOCTEXT("RemoteCancel", "Cancel");
+	}
+	return Client.IsConnected() ? LOCTEXT("RemoteDisconnect", "Disconnect") : LOCTEXT("RemoteConnect", "Connect");
+}
+
+TSharedRef<SWidget> SGASRemoteInspector::OnGetComponentMenu()
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+
+	for (const FGASCoreRemoteComponent& Component : Client.GetComponents())
+	{
+		MenuBuilder.AddMenuEntry(FText::FromString(Component.Name), FText(), FSlateIcon(),
+			FUIAction(FExecuteAction::CreateSP(this, &SGASRemoteInspector::HandleComponentSelected, Component.Id)));
+	}
+	return MenuBuilder.MakeWidget();
+}
+
+FText SGASRemoteInspector::GetComponentText() const
+{
+	const FGASCoreRemoteComponent* Component = Client.GetComponents().FindByPredicate([this](const FGASCoreRemoteComponent& Entry)
+	{
+		return Entry.Id == SelectedId;
+	});
+	return Component ? FText::FromString(Component->Name) : LOCTEXT("RemoteNoComponent", "Select Remote ASC");
+}
+
+void SGASRemoteInspector::HandleComponentSelected(uint32 Id)
+{
+	SelectedId = Id;
+	Client.Select({ Id });
+}
+
+void SGASRemoteInspector::RebuildLines()
+{
+	BuiltRevision = Client.GetRevision();
+	Lines.Reset();
+
+	if (const FGASCoreRemoteSnapshot* Snapshot = Client.GetSnapshot(SelectedId))
+	{
+		Lines.Add(MakeShared<FString>(FString::Printf(TEXT("Server time %.2f s"), Snapshot->ServerTime)));
+
+		Lines.Add(MakeShared<FString>(FString::Printf(TEXT("Attributes (%d)"), Snapshot->Attributes.Num())));
+		for (const TPair<FString, float>& Attribute : Snapshot->Attributes)
+		{
+			Lines.Add(MakeShared<FString>(FString::Printf(TEXT("    %s = %.2f"), *Attribute.Key, Attribute.Value)));
+		}
+
+		TArray<FString> SortedLines;
+		for (const TPair<FString, int32>& Tag : Snapshot->Tags)
+		{
+			SortedLines.Add(FString::Printf(TEXT("    %s [%d]"), *Tag.Key, Tag.Value));
+		}
+		SortedLines.Sort();
+		Lines.Add(MakeShared<FString>(FString::Printf(TEXT("Tags (%d)"), SortedLines.Num())));
+		for (FString& Line : SortedLines)
+		{
+			Lines.Add(MakeShared<FString>(MoveTemp(Line)));
+		}
+
+		SortedLines.Reset();
+		for (const TPair<int32, FGASCoreRemoteSnapshot::FEffect>& Effect : Snapshot->Effects)
+		{
+			SortedLines.Add(Effect.Value.EndTime < 0.f
+				? FString::Printf(TEXT("    %s (x%d)"), *Effect.Value.Name, Effect.Value.StackCount)
+				: FString::Printf(TEXT("    %s (x%d, %.1f s left)"), *Effect.Value.Name, Effect.Value.StackCount,
+					FMath::Max(Effect.Value.EndTime - Snapshot->ServerTime, 0.0)));
+		}
+		SortedLines.Sort();
+		Lines.Add(MakeShared<FString>(FString::Printf(TEXT("GameplayEffects (%d)"), SortedLines.Num())));
+		for (FString& Line : SortedLines)
+		{
+			Lines.Add(MakeShared<FString>(MoveTemp(Line)));
+		}
+	}
+
+	if (LineList.IsValid())
+	{
+		LineList->RequestListRefresh();
+	}
+}
+
+TSharedRef<ITableRow> SGASRemoteInspector::OnGenerateLineRow(TSharedPtr<FString> InLine, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<TSharedPtr<FString>>, OwnerTable)
+		[
+			SNew(STextBlock)
+			.Text(FText::FromString(InLine.IsValid() ? *InLine : FString()))
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
+
+#endif
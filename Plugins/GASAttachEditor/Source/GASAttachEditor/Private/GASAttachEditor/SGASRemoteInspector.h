@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Utilities/GASCoreSnapshotStream.h"
+
+#if GASCORE_SNAPSHOT_STREAM
+
+class SEditableTextBox;
+
+// 远程服务器查看：连接服务器的ASC快照流（GASCore.SnapshotStream.Port），查看专用服务器上的权威状态
+// Remote inspection: connects to a server's ASC snapshot stream (GASCore.SnapshotStream.Port) to show the authoritative
+// state of a dedicated server without a server world in this process
+class SGASRemoteInspector : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGASRemoteInspector)
+		{}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+private:
+	FReply HandleConnectClicked();
+
+	FText GetConnectText() const;
+
+	// 选择远程ASC
+	// Select a remote ASC
+	TSharedRef<SWidget> OnGetComponentMenu();
+	FText GetComponentText() const;
+	void HandleComponentSelected(uint32 Id);
+
+	void RebuildLines();
+
+	TSharedRef<ITableRow> OnGenerateLineRow(TSharedPtr<FString> InLine, const TSharedRef<STableViewBase>& OwnerTable);
+
+private:
+	FGASCoreSnapshotStreamClient Client;
+
+	TSharedPtr<SEditableTextBox> HostText;
+
+	TSharedPtr<SEditableTextBox> PortText;
+
+	// 当前连接目标（host:port，用于状态文本）
+	// Host:port of the current connection attempt (status text)
+	FString ConnectTarget;
+
+	// 当前选择的远程ASC（0 = 未选择）
+	// Selected remote ASC (0 = none)
+	uint32 SelectedId = 0;
+
+	uint64 BuiltRevision = MAX_uint64;
+
+	FText StatusText;
+
+	TArray<TSharedPtr<FString>> Lines;
+
+	TSharedPtr<SListView<TSharedPtr<FString>>> LineList;
+};
+
+#endif
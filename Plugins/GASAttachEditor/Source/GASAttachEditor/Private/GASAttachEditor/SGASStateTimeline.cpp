@@ -0,0 +1,400 @@
+#include "SGASStateTimeline.h"
+
+#if GASCORE_STATE_RECORDER
+
+#include "AbilitySystemComponent.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Widgets/Input/SSlider.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Layout/SSplitter.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "SGASAttachEditor"
+
+namespace GASStateTimeline
+{
+	// 跟随最新帧时的刷新间隔（回放需要从头累加事件）
+	// Rebuild interval while following live (a replay folds every retained event)
+	static constexpr double FollowRebuildInterval = 0.2;
+
+	static FString GetEventText(const FGASCoreRecordedEvent& Event)
+	{
+		const FString Name = GASCoreStateRecorder::GetName(Event.Key).ToString();
+		switch (Event.Type)
+		{
+		case EGASCoreRecordedEventType::Attribute:
+			return FString::Printf(TEXT("%s = %.2f"), *Name, Event.Value);
+		case EGASCoreRecordedEventType::Tag:
+			return Event.Value > 0.f
+				? FString::Printf(TEXT("+ %s [%d]"), *Name, FMath::RoundToInt32(Event.Value))
+				: FString::Printf(TEXT("- %s"), *Name);
+		case EGASCoreRecordedEventType::EffectAdded:
+			return FString::Printf(TEXT("+ %s (x%d)"), *GASCoreStateRecorder::GetEffectName(Event.Key).ToString(), FMath::RoundToInt32(Event.Value));
+		case EGASCoreRecordedEventType::EffectRemoved:
+			return FString::Printf(TEXT("- %s"), *GASCoreStateRecorder::GetEffectName(Event.Key).ToString());
+		case EGASCoreRecordedEventType::AbilityActivated:
+			return FString::Printf(TEXT("> %s activated"), *Name);
+		case EGASCoreRecordedEventType::AbilityEnded:
+			return FString::Printf(TEXT("< %s ended"), *Name);
+		}
+		return FString();
+	}
+
+	/** Header line plus one sorted line per entry. */
+	template <typename ValueType, typename FormatType>
+	static void AddSection(TArray<TSharedPtr<FString>>& OutLines, const TCHAR* Header, const TMap<int32, ValueType>& Entries, FormatType&& Format)
+	{
+		OutLines.Add(MakeShared<FString>(FString::Printf(TEXT("%s (%d)"), Header, Entries.Num())));
+
+		TArray<FString> Lines;
+		for (const TPair<int32, ValueType>& Entry : Entries)
+		{
+			Lines.Add(TEXT("    ") + Format(Entry.Key, Entry.Value));
+		}
+		Lines.Sort();
+		for (FString& Line : Lines)
+		{
+			OutLines.Add(MakeShared<FString>(MoveTemp(Line)));
+		}
+	}
+}
+
+void SGASStateTimeline::Construct(const FArguments& InArgs)
+{
+	AbilitySystem = InArgs._AbilitySystem;
+	SelectedSource = GASCoreStateRecorder::GetNumSources() - 1;
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.f)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SNew(SCheckBox)
+				.IsChecked(this, &SGASStateTimeline::GetRecordState)
+				.OnCheckStateChanged(this, &SGASStateTimeline::HandleRecordStateChanged)
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("TimelineRecord", "Record Selected"))
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SNew(SCheckBox)
+				.IsChecked(this, &SGASStateTimeline::GetFollowLiveState)
+				.OnCheckStateChanged(this, &SGASStateTimeline::HandleFollowLiveStateChanged)
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("TimelineFollowLive", "Follow Live"))
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SNew(SComboButton)
+				.OnGetMenuContent(this, &SGASStateTimeline::OnGetSourceMenu)
+				.ContentPadding(2)
+				.ButtonContent()
+				[
+					SNew(STextBlock)
+					.Text(this, &SGASStateTimeline::GetSourceText)
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SNew(SButton)
+				.OnClicked(this, &SGASStateTimeline::HandleClearClicked)
+				.Text(LOCTEXT("TimelineClear", "Clear"))
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.f)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.ToolTipText(LOCTEXT("TimelinePrevious", "Previous frame with changes"))
+				.OnClicked(this, &SGASStateTimeline::HandleStepClicked, -1)
+				.Text(FText::FromString(TEXT("<")))
+			]
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			.VAlign(VAlign_Center)
+			.Padding(FMargin(4.f, 0.f))
+			[
+				SNew(SSlider)
+				.Value(this, &SGASStateTimeline::GetSliderValue)
+				.OnValueChanged(this, &SGASStateTimeline::HandleSliderValueChanged)
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.ToolTipText(LOCTEXT("TimelineNext", "Next frame with changes"))
+				.OnClicked(this, &SGASStateTimeline::HandleStepClicked, 1)
+				.Text(FText::FromString(TEXT(">")))
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(FMargin(6.f, 2.f))
+		[
+			SNew(STextBlock)
+			.Text_Lambda([this] { return FrameText; })
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SNew(SSplitter)
+			.Orientation(Orient_Horizontal)
+
+			+ SSplitter::Slot()
+			.Value(0.6f)
+			[
+				SNew(SBorder)
+				.Padding(2.f)
+				[
+					SAssignNew(StateList, SListView<TSharedPtr<FString>>)
+					.ListItemsSource(&StateLines)
+					.SelectionMode(ESelectionMode::None)
+					.OnGenerateRow(this, &SGASStateTimeline::OnGenerateLineRow)
+				]
+			]
+
+			+ SSplitter::Slot()
+			.Value(0.4f)
+			[
+				SNew(SBorder)
+				.Padding(2.f)
+				[
+					SAssignNew(EventList, SListView<TSharedPtr<FString>>)
+					.ListItemsSource(&EventLines)
+					.SelectionMode(ESelectionMode::None)
+					.OnGenerateRow(this, &SGASStateTimeline::OnGenerateLineRow)
+				]
+			]
+		]
+	];
+
+	RebuildLines();
+}
+
+void SGASStateTimeline::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	if (!bFollowLive || BuiltRevision == GASCoreStateRecorder::GetRevision() || InCurrentTime - LastRebuildTime < GASStateTimeline::FollowRebuildInterval)
+	{
+		return;
+	}
+
+	LastRebuildTime = InCurrentTime;
+	SetFrame(GASCoreStateRecorder::GetNumFrames() - 1);
+}
+
+ECheckBoxState SGASStateTimeline::GetRecordState() const
+{
+	return GASCoreStateRecorder::IsWatching(AbilitySystem.Get().Get()) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SGASStateTimeline::HandleRecordStateChanged(ECheckBoxState NewState)
+{
+	UAbilitySystemComponent* ASC = AbilitySystem.Get().Get();
+	if (!ASC)
+	{
+		return;
+	}
+
+	if (NewState == ECheckBoxState::Checked)
+	{
+		if (GASCoreStateRecorder::Watch(ASC))
+		{
+			SelectedSource = GASCoreStateRecorder::GetNumSources() - 1;
+			bFollowLive = true;
+		}
+	}
+	else
+	{
+		GASCoreStateRecorder::Unwatch(ASC);
+	}
+}
+
+FReply SGASStateTimeline::HandleClearClicked()
+{
+	GASCoreStateRecorder::Reset();
+	SelectedSource = INDEX_NONE;
+	SetFrame(INDEX_NONE);
+	return FReply::Handled();
+}
+
+ECheckBoxState SGASStateTimeline::GetFollowLiveState() const
+{
+	return bFollowLive ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SGASStateTimeline::HandleFollowLiveStateChanged(ECheckBoxState NewState)
+{
+	bFollowLive = NewState == ECheckBoxState::Checked;
+}
+
+TSharedRef<SWidget> SGASStateTimeline::OnGetSourceMenu()
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+
+	for (int32 Source = 0; Source < GASCoreStateRecorder::GetNumSources(); ++Source)
+	{
+		MenuBuilder.AddMenuEntry(FText::FromString(GASCoreStateRecorder::GetSourceName(Source)), FText(), FSlateIcon(),
+			FUIAction(FExecuteAction::CreateLambda([this, Source]
+			{
+				SelectedSource = Source;
+				RebuildLines();
+			})));
+	}
+	return MenuBuilder.MakeWidget();
+}
+
+FText SGASStateTimeline::GetSourceText() const
+{
+	const int32 NumSources = GASCoreStateRecorder::GetNumSources();
+	return SelectedSource >= 0 && SelectedSource < NumSources
+		? FText::FromString(GASCoreStateRecorder::GetSourceName(SelectedSource))
+		: LOCTEXT("TimelineNoSource", "No Recording");
+}
+
+float SGASStateTimeline::GetSliderValue() const
+{
+	const int32 NumFrames = GASCoreStateRecorder::GetNumFrames();
+	return NumFrames > 1 ? float(FMath::Clamp(SelectedFrame, 0, NumFrames - 1)) / float(NumFrames - 1) : 1.f;
+}
+
+void SGASStateTimeline::HandleSliderValueChanged(float NewValue)
+{
+	bFollowLive = false;
+	SetFrame(FMath::RoundToInt32(NewValue * float(GASCoreStateRecorder::GetNumFrames() - 1)));
+}
+
+FReply SGASStateTimeline::HandleStepClicked(int32 Direction)
+{
+	bFollowLive = false;
+
+	TArray<FGASCoreRecordedEvent> Events;
+	const int32 NumFrames = GASCoreStateRecorder::GetNumFrames();
+	for (int32 Frame = SelectedFrame + Direction; Frame >= 0 && Frame < NumFrames; Frame += Direction)
+	{
+		GASCoreStateRecorder::GetFrameEvents(Frame, Events);
+		if (Events.ContainsByPredicate([this](const FGASCoreRecordedEvent& Event) { return Event.Source == SelectedSource; }))
+		{
+			SetFrame(Frame);
+			break;
+		}
+	}
+	return FReply::Handled();
+}
+
+void SGASStateTimeline::SetFrame(int32 NewFrame)
+{
+	SelectedFrame = FMath::Min(NewFrame, GASCoreStateRecorder::GetNumFrames() - 1);
+	RebuildLines();
+}
+
+void SGASStateTimeline::RebuildLines()
+{
+	BuiltRevision = GASCoreStateRecorder::GetRevision();
+	StateLines.Reset();
+	EventLines.Reset();
+
+	const int32 NumFrames = GASCoreStateRecorder::GetNumFrames();
+	if (SelectedSource < 0 || SelectedSource >= GASCoreStateRecorder::GetNumSources() || SelectedFrame < 0 || SelectedFrame >= NumFrames)
+	{
+		FrameText = LOCTEXT("TimelineEmpty", "Select an ASC and enable Record Selected.");
+	}
+	else
+	{
+		const FGASCoreRecordedFrame& Frame = GASCoreStateRecorder::GetFrame(SelectedFrame);
+		FrameText = FText::Format(LOCTEXT("TimelineFrame", "Frame {0} / {1}    {2} s    engine frame {3}{4}"),
+			FText::AsNumber(SelectedFrame + 1), FText::AsNumber(NumFrames), FText::AsNumber(Frame.Time),
+			FText::AsNumber(Frame.EngineFrame),
+			Frame.NumDropped > 0 ? FText::Format(LOCTEXT("TimelineDropped", "    ({0} attribute changes deferred)"), FText::AsNumber(Frame.NumDropped)) : FText());
+
+		TArray<FGASCoreRecordedState> States;
+		GASCoreStateRecorder::BuildState(SelectedFrame, States);
+		const FGASCoreRecordedState& State = States[SelectedSource];
+
+		using namespace GASStateTimeline;
+		AddSection(StateLines, TEXT("Attributes"), State.Attributes, [](const int32 Key, const float Value)
+		{
+			return FString::Printf(TEXT("%s = %.2f"), *GASCoreStateRecorder::GetName(Key).ToString(), Value);
+		});
+		AddSection(StateLines, TEXT("Tags"), State.Tags, [](const int32 Key, const int32 Count)
+		{
+			return FString::Printf(TEXT("%s [%d]"), *GASCoreStateRecorder::GetName(Key).ToString(), Count);
+		});
+		AddSection(StateLines, TEXT("GameplayEffects"), State.Effects, [](const int32 HandleId, const int32 StackCount)
+		{
+			return FString::Printf(TEXT("%s (x%d)"), *GASCoreStateRecorder::GetEffectName(HandleId).ToString(), StackCount);
+		});
+		AddSection(StateLines, TEXT("Active Abilities"), State.Abilities, [](const int32 Key, const int32 Count)
+		{
+			return FString::Printf(TEXT("%s (x%d)"), *GASCoreStateRecorder::GetName(Key).ToString(), Count);
+		});
+
+		TArray<FGASCoreRecordedEvent> Events;
+		GASCoreStateRecorder::GetFrameEvents(SelectedFrame, Events);
+		for (const FGASCoreRecordedEvent& Event : Events)
+		{
+			if (Event.Source == SelectedSource)
+			{
+				EventLines.Add(MakeShared<FString>(GetEventText(Event)));
+			}
+		}
+	}
+
+	if (StateList.IsValid())
+	{
+		StateList->RequestListRefresh();
+	}
+	if (EventList.IsValid())
+	{
+		EventList->RequestListRefresh();
+	}
+}
+
+TSharedRef<ITableRow> SGASStateTimeline::OnGenerateLineRow(TSharedPtr<FString> InLine, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<TSharedPtr<FString>>, OwnerTable)
+		[
+			SNew(STextBlock)
+			.Text(FText::FromString(InLine.IsValid() ? *InLine : FString()))
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
+
+#endif
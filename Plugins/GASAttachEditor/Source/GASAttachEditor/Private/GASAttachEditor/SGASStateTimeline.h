@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Utilities/GASCoreStateRecorder.h"
+
+#if GASCORE_STATE_RECORDER
+
+class UAbilitySystemComponent;
+
+// 状态录制时间轴：录制选中的ASC（GASCoreStateRecorder），拖动滑条回放任意一帧的状态和该帧的变化
+// State recorder timeline: records the selected ASC (GASCoreStateRecorder); the scrubber replays the state at the end
+// of any retained frame and the changes recorded in it
+class SGASStateTimeline : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGASStateTimeline)
+		{}
+
+		// 调试器当前选中的ASC
+		// ASC currently selected in the debugger
+		SLATE_ATTRIBUTE(TWeakObjectPtr<UAbilitySystemComponent>, AbilitySystem)
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+private:
+	// 录制开关
+	// Record toggle
+	ECheckBoxState GetRecordState() const;
+	void HandleRecordStateChanged(ECheckBoxState NewState);
+
+	FReply HandleClearClicked();
+
+	// 跟随最新帧
+	// Follow the newest frame
+	ECheckBoxState GetFollowLiveState() const;
+	void HandleFollowLiveStateChanged(ECheckBoxState NewState);
+
+	// 回放的录制源
+	// Replayed source
+	TSharedRef<SWidget> OnGetSourceMenu();
+	FText GetSourceText() const;
+
+	float GetSliderValue() const;
+	void HandleSliderValueChanged(float NewValue);
+
+	// 跳到上/下一个有变化的帧
+	// Jump to the previous / next frame with changes on the replayed source
+	FReply HandleStepClicked(int32 Direction);
+
+	// 选中帧并刷新列表
+	// Select a frame and rebuild the lists
+	void SetFrame(int32 NewFrame);
+
+	void RebuildLines();
+
+	TSharedRef<ITableRow> OnGenerateLineRow(TSharedPtr<FString> InLine, const TSharedRef<STableViewBase>& OwnerTable);
+
+private:
+	TAttribute<TWeakObjectPtr<UAbilitySystemComponent>> AbilitySystem;
+
+	// 录制源索引（GASCoreStateRecorder::GetSourceName）
+	// Source index (GASCoreStateRecorder::GetSourceName)
+	int32 SelectedSource = INDEX_NONE;
+
+	// 回放帧索引（0 = 最早保留的帧）
+	// Replayed frame index (0 = oldest retained frame)
+	int32 SelectedFrame = INDEX_NONE;
+
+	bool bFollowLive = true;
+
+	// 上次刷新时的录制版本与时间（跟随时限频刷新）
+	// Recorder revision and time of the last rebuild (following live is throttled)
+	uint64 BuiltRevision = MAX_uint64;
+	double LastRebuildTime = 0.0;
+
+	FText FrameText;
+
+	TArray<TSharedPtr<FString>> StateLines;
+
+	TArray<TSharedPtr<FString>> EventLines;
+
+	TSharedPtr<SListView<TSharedPtr<FString>>> StateList;
+
+	TSharedPtr<SListView<TSharedPtr<FString>>> EventList;
+};
+
+#endif
@@ -0,0 +1,75 @@
+#include "GASAttachEditorSettings.h"
+
+void UGASAttachEditorSettings::RequestSave()
+{
+	// 每次修改重新计时，只有静止下来才写
+	// Every change restarts the delay, only a quiet period writes
+	if (SaveTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(SaveTickerHandle);
+	}
+	SaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UGASAttachEditorSettings::HandleSaveTicker), FMath::Max(SaveDelaySeconds, 0.f));
+}
+
+void UGASAttachEditorSettings::FlushSave()
+{
+	if (!SaveTickerHandle.IsValid())
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(SaveTickerHandle);
+	SaveTickerHandle.Reset();
+	SaveConfig();
+}
+
+bool UGASAttachEditorSettings::HandleSaveTicker(float /*DeltaTime*/)
+{
+	SaveTickerHandle.Reset();
+	SaveConfig();
+	return false;
+}
+
+void UGASAttachEditorSettings::SaveFilterPreset(const FString& PresetName)
+{
+	if (PresetName.IsEmpty())
+	{
+		return;
+	}
+
+	FGASAttachEditorFilterPreset Preset = ActiveFilter;
+	Preset.Name = PresetName;
+
+	if (FGASAttachEditorFilterPreset* Existing = FilterPresets.FindByPredicate([&PresetName](const FGASAttachEditorFilterPreset& Item) { return Item.Name == PresetName; }))
+	{
+		*Existing = MoveTemp(Preset);
+	}
+	else
+	{
+		FilterPresets.Add(MoveTemp(Preset));
+	}
+	RequestSave();
+}
+
+bool UGASAttachEditorSettings::ApplyFilterPreset(const FString& PresetName)
+{
+	const FGASAttachEditorFilterPreset* Preset = FilterPresets.FindByPredicate([&PresetName](const FGASAttachEditorFilterPreset& Item) { return Item.Name == PresetName; });
+	if (!Preset)
+	{
+		return false;
+	}
+
+	ActiveFilter = *Preset;
+	ActiveFilter.Name.Reset();
+	RequestSave();
+	return true;
+}
+
+void UGASAttachEditorSettings::RemoveFilterPreset(const FString& PresetName)
+{
+	if (FilterPresets.RemoveAll([&PresetName](const FGASAttachEditorFilterPreset& Item) { return Item.Name == PresetName; }) > 0)
+	{
+		RequestSave();
+	}
+}
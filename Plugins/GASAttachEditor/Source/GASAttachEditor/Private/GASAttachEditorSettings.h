@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "GameplayTagContainer.h"
+#include "Containers/Ticker.h"
+#include "GASAttachEditorSettings.generated.h"
+
+class AActor;
+
+// 一组筛选条件（技能状态 + 分组模式的类和Tag），也用作命名预设
+// One set of filters (ability states + the group mode's class and tags), also used as a named preset
+USTRUCT()
+struct FGASAttachEditorFilterPreset
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Filter")
+	FString Name;
+
+	// 显示的技能状态（EScreenGAModeState 位掩码）
+	// Ability states shown (EScreenGAModeState bit mask)
+	UPROPERTY(EditAnywhere, Category = "Filter", meta = (Bitmask))
+	uint8 AbilityStates = 0x7;
+
+	UPROPERTY(EditAnywhere, Category = "Filter")
+	TSoftClassPtr<AActor> GroupClass;
+
+	UPROPERTY(EditAnywhere, Category = "Filter")
+	FGameplayTag GroupRequiredTag;
+
+	UPROPERTY(EditAnywhere, Category = "Filter")
+	FGameplayTag GroupExcludedTag;
+};
+
+// 调试器界面设置（项目设置 > Plugins > GAS Attach Editor，按项目按用户保存）
+// 改动先记在内存里，静止 SaveDelaySeconds 之后才写一次配置，交互排序、拖动列时不会反复序列化
+// Debugger UI settings (Project Settings > Plugins > GAS Attach Editor, saved per project and user)
+// Changes stay in memory and are written once after SaveDelaySeconds of quiet, so interactive sorting and column
+// toggling no longer serialize the config repeatedly
+UCLASS(config = EditorPerProjectUserSettings, meta = (DisplayName = "GAS Attach Editor"))
+class UGASAttachEditorSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	static UGASAttachEditorSettings* Get() { return GetMutableDefault<UGASAttachEditorSettings>(); }
+
+	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+
+	// 登记一次延迟保存（SaveDelaySeconds 内的多次修改合并为一次写入）
+	// Schedule a debounced save (changes within SaveDelaySeconds coalesce into one write)
+	void RequestSave();
+
+	// 立即写入挂起的保存（关闭面板 / 模块卸载时）
+	// Write a pending save now (panel closed / module shutdown)
+	void FlushSave();
+
+	// 用当前筛选条件新建或覆盖一个预设
+	// Create or overwrite a preset from the current filters
+	void SaveFilterPreset(const FString& PresetName);
+
+	// 把预设设为当前筛选条件（找不到返回 false）
+	// Make a preset the current filters (false when it does not exist)
+	bool ApplyFilterPreset(const FString& PresetName);
+
+	void RemoveFilterPreset(const FString& PresetName);
+
+	// 技能树隐藏的列
+	// Hidden ability tree columns
+	UPROPERTY(config, EditAnywhere, Category = "Columns")
+	TArray<FString> HiddenAbilityColumns;
+
+	// 效果树隐藏的列
+	// Hidden gameplay effect tree columns
+	UPROPERTY(config, EditAnywhere, Category = "Columns")
+	TArray<FString> HiddenGameplayEffectColumns;
+
+	// 技能名字列的排序（EColumnSortMode）
+	// Ability name column sort (EColumnSortMode)
+	UPROPERTY(config, EditAnywhere, Category = "Sorting", meta = (ClampMin = "0", ClampMax = "2"))
+	uint8 AbilitySortMode = 1;
+
+	// 当前筛选条件
+	// Current filters
+	UPROPERTY(config, EditAnywhere, Category = "Filters")
+	FGASAttachEditorFilterPreset ActiveFilter;
+
+	// 命名的筛选预设
+	// Named filter presets
+	UPROPERTY(config, EditAnywhere, Category = "Filters", meta = (TitleProperty = "Name"))
+	TArray<FGASAttachEditorFilterPreset> FilterPresets;
+
+	// 持续更新的刷新间隔（秒，0 = 每帧）
+	// Continuous update interval (seconds, 0 = every frame)
+	UPROPERTY(config, EditAnywhere, Category = "Refresh", meta = (ClampMin = "0", Units = "s"))
+	float ContinuousUpdateInterval = 0.1f;
+
+	// 分组模式遍历注册表的间隔（秒）
+	// Group mode aggregation interval (seconds)
+	UPROPERTY(config, EditAnywhere, Category = "Refresh", meta = (ClampMin = "0.05", Units = "s"))
+	float GroupRefreshInterval = 0.5f;
+
+	// 最后一次修改之后多久写入配置（秒）
+	// Quiet time after the last change before the config is written (seconds)
+	UPROPERTY(config, EditAnywhere, Category = "Refresh", meta = (ClampMin = "0", Units = "s"))
+	float SaveDelaySeconds = 1.f;
+
+private:
+	bool HandleSaveTicker(float DeltaTime);
+
+	FTSTicker::FDelegateHandle SaveTickerHandle;
+};
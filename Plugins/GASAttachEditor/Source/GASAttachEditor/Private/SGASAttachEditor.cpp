@@ -6,9 +6,9 @@
 #include "GameplayAbilitySpec.h"
 #include "../Public/GASAttachEditorStyle.h"
 #include "Widgets/Views/STreeView.h"
+#include "Widgets/Views/SListView.h"
 #include "GASAttachEditor/SGASCharacterTagsBase.h"
 #include "GASAttachEditor/SGASAttributesNodeBase.h"
-#include "Widgets/Layout/SWrapBox.h"
 #include "Widgets/SToolTip.h"
 #include "Widgets/Input/SComboButton.h"
 #include "Framework/Application/SlateApplication.h"
@@ -20,15 +20,21 @@
 #include "Widgets/Docking/SDockTab.h"
 #include "Widgets/Layout/SBorder.h"
 #include "GASAttachEditor/SGASGameplayEffectNodeBase.h"
-#include "Misc/ConfigCacheIni.h"
+#include "GASAttachEditor/SGASCostView.h"
+#include "GASAttachEditor/SGASGroupView.h"
+#include "GASAttachEditor/SGASRemoteInspector.h"
+#include "GASAttachEditor/SGASStateTimeline.h"
+#include "GASAttachEditor/GASViewportPicker.h"
+#include "GASAttachEditorSettings.h"
 #include "Widgets/SWidget.h"
 #include "Framework/Docking/TabManager.h"
 #include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SEditableTextBox.h"
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "Framework/Commands/UIAction.h"
 #include "HAL/ExceptionHandling.h"
 #include "Widgets/Input/SButton.h"
-#include "UObject/UObjectIterator.h"
+#include "Subsystems/GASCoreAbilitySystemRegistrySubsystem.h"
 #include "GameFramework/Pawn.h"
 
 #define LOCTEXT_NAMESPACE "SGASAttachEditor"
@@ -75,32 +81,89 @@ FASCDebugTargetInfo* GetASCDebugTargetInfo(UWorld* World)
 
 TArray<TWeakObjectPtr< UAbilitySystemComponent>> PlayerComp;
 
+// PlayerComp mirrors the ASC registry of the debugged world: filled once from the registry, then kept current by
+// its add/remove events (no TObjectIterator walk over the global object array).
+TWeakObjectPtr<UGASCoreAbilitySystemRegistrySubsystem> PlayerCompRegistry;
+FDelegateHandle PlayerCompRegisteredHandle;
+FDelegateHandle PlayerCompUnregisteredHandle;
+
+void UnbindPlayerCompRegistry()
+{
+	if (UGASCoreAbilitySystemRegistrySubsystem* Registry = PlayerCompRegistry.Get())
+	{
+		Registry->OnAbilitySystemRegistered.Remove(PlayerCompRegisteredHandle);
+		Registry->OnAbilitySystemUnregistered.Remove(PlayerCompUnregisteredHandle);
+	}
+	PlayerCompRegistry.Reset();
+	PlayerCompRegisteredHandle.Reset();
+	PlayerCompUnregisteredHandle.Reset();
+}
+
 void UpDataPlayerComp(UWorld* World)
 {
 	PlayerComp.Reset();
 
-	if (!World)
+	UGASCoreAbilitySystemRegistrySubsystem* Registry = UGASCoreAbilitySystemRegistrySubsystem::Get(World);
+	if (Registry != PlayerCompRegistry.Get())
+	{
+		UnbindPlayerCompRegistry();
+		if (Registry)
+		{
+			PlayerCompRegistry = Registry;
+			PlayerCompRegisteredHandle = Registry->OnAbilitySystemRegistered.AddLambda([](UAbilitySystemComponent* ASC)
+			{
+				PlayerComp.AddUnique(ASC);
+			});
+			PlayerCompUnregisteredHandle = Registry->OnAbilitySystemUnregistered.AddLambda([](UAbilitySystemComponent* ASC)
+			{
+				PlayerComp.Remove(ASC);
+			});
+		}
+	}
+
+	if (!Registry)
 	{
 		return;
 	}
 
-	for (TObjectIterator<UAbilitySystemComponent> It; It; ++It)
+	for (const TWeakObjectPtr<UAbilitySystemComponent>& ASC : Registry->GetAbilitySystems())
 	{
-		if (UAbilitySystemComponent* ASC = *It)
+		if (ASC.IsValid())
 		{
-			if (ASC->GetWorld() != World)
-			{
-				continue;
-			}
-			if (!MakeWeakObjectPtr(ASC).Get())
-			{
-				continue;
-			}
 			PlayerComp.Add(ASC);
 		}
 	}
 }
 
+// 标签列表比对：移除已消失的Tag，追加新增的Tag，未变化的条目（及其行控件）保持不变
+// Diffs a tag list against Tags: items of removed tags are dropped, new tags are appended, unchanged items (and their
+// row widgets) stay. Returns true when the list changed.
+bool SyncTagItems(TArray<TSharedPtr<FGASCharacterTagsBase>>& Items, const FGameplayTagContainer& Tags, UAbilitySystemComponent* ASC, FName WidgetName)
+{
+	const int32 NumRemoved = Items.RemoveAll([&Tags](const TSharedPtr<FGASCharacterTagsBase>& Item)
+	{
+		return !Tags.HasTagExact(Item->GetGameplayTag());
+	});
+
+	TSet<FGameplayTag> ListedTags;
+	ListedTags.Reserve(Items.Num());
+	for (const TSharedPtr<FGASCharacterTagsBase>& Item : Items)
+	{
+		ListedTags.Add(Item->GetGameplayTag());
+	}
+
+	bool bChanged = NumRemoved > 0;
+	for (const FGameplayTag& Tag : Tags)
+	{
+		if (!ListedTags.Contains(Tag))
+		{
+			Items.Add(FGASCharacterTags::Create(ASC, Tag, WidgetName));
+			bChanged = true;
+		}
+	}
+	return bChanged;
+}
+
 UAbilitySystemComponent* GetDebugTarget(FASCDebugTargetInfo* Info, const UAbilitySystemComponent* InSelectComponent, FName& SelectActorName)
 {
 	// Return target if we already have one
@@ -199,6 +262,7 @@ class SGASAttachEditorImpl : public SGASAttachEditor
 	typedef STreeView<TSharedRef<FGASAbilitieNodeBase>> SAbilitieTree;
 	typedef STreeView<TSharedRef<FGASAttributesNodeBase>> SAttributesTree;
 	typedef STreeView<TSharedRef<FGASGameplayEffectNodeBase>> SGameplayEffectTree;
+	typedef SListView<TSharedPtr<FGASCharacterTagsBase>> STagsList;
 
 public:
 	virtual void Construct(const FArguments& InArgs) override;
@@ -308,6 +372,18 @@ protected:
 	// Set radio box name
 	FText HandleGetPickingModeText() const;
 
+	// 视口拾取单选框
+	// Viewport picking check box
+	ECheckBoxState HandleGetViewportPickChecked() const;
+
+	void HandleViewportPickStateChanged(ECheckBoxState NewValue);
+
+	FText HandleGetViewportPickText() const;
+
+	virtual bool ConfirmViewportPick() override;
+
+	virtual bool IsOverPickViewport(const FVector2D& ScreenPosition) const override;
+
 protected:
 
 	/** Called when the user clicks the "Expand All" button; Expands the entire tag tree */
@@ -375,14 +451,26 @@ protected:
 
 private:
 
-	TSharedPtr<SWrapBox> FilteredOwnedTagsView;
+	TSharedPtr<STagsList> FilteredOwnedTagsView;
+
+	TSharedPtr<STagsList> FilteredBlockedTagsView;
 
-	TSharedPtr<SWrapBox> FilteredBlockedTagsView;
+	// 列表数据源（按Tag比对更新，不再每次重建）
+	// List sources, diffed per tag instead of rebuilt
+	TArray<TSharedPtr<FGASCharacterTagsBase>> OwnedTagItems;
+
+	TArray<TSharedPtr<FGASCharacterTagsBase>> BlockedTagItems;
+
+	// 列表条目所属的组件（切换组件时清空）
+	// Component the list items belong to (cleared when the selection changes)
+	TWeakObjectPtr<UAbilitySystemComponent> TagItemsComponent;
 
 	FGameplayTagContainer OldOwnerTags;
 
 	FGameplayTagContainer OldBlockedTags;
 
+	TSharedRef<ITableRow> OnGenerateTagRow(TSharedPtr<FGASCharacterTagsBase> InItem, const TSharedRef<STableViewBase>& OwnerTable);
+
 protected:
 
 	TSharedPtr<SWidget> CreateAbilityTagWidget();
@@ -393,7 +481,7 @@ protected:
 #if WITH_EDITOR
 	// <tag控件的监听
 	// Monitoring of tag control
-	FReply OnMouseButtonUpTags(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent, FName TagsName);
+	TSharedPtr<SWidget> OnTagsContextMenuOpening(FName TagsName);
 
 	// <Tag控件选择
 	// Tag control selection
@@ -414,6 +502,16 @@ protected:
 	// Create check box
 	TSharedPtr<SCheckBox> CreateScreenCheckBox(EScreenGAModeState InState);
 
+	// 按当前筛选刷新技能行的可见性
+	// Reapply the ability state filter to the ability rows
+	void RefreshScreenModeVisibility();
+
+	// 筛选预设菜单（应用 / 保存当前 / 删除）
+	// Filter preset menu (apply / save current / remove)
+	TSharedRef<SWidget> OnGetFilterPresetMenu();
+
+	void HandleFilterPresetSelected(FString PresetName);
+
 	// 设置筛选名称
 	// Set filter name
 	FText HandleGeScreenModeText(EScreenGAModeState InState) const;
@@ -461,12 +559,32 @@ private:
 
 	bool bPickingTick;
 
+	// 视口中用HighlightActor注册表拾取角色
+	// Picks actors in the viewport through the HighlightActor registry
+	FGASViewportPicker ViewportPicker;
+
+	// 持续更新的刷新间隔（秒，UGASAttachEditorSettings::ContinuousUpdateInterval，0 = 每帧）
+	// Continuous update interval (seconds, UGASAttachEditorSettings::ContinuousUpdateInterval, 0 = every frame)
+	float ContinuousUpdateInterval;
+
+	double LastContinuousUpdateTime;
+
+	// 当前的组模式视图（应用预设后刷新其筛选）
+	// Current group mode view (its filters are refreshed when a preset is applied)
+	TWeakPtr<SGASGroupView> GroupView;
+
 private:
 
 	TSharedPtr<SAttributesTree> AttributesReflectorTree;
 
 	TArray<TSharedRef<FGASAttributesNodeBase>> AttributesFilteredTreeRoot;
 
+	// 节点按属性保留（数值原地更新，只有属性增减时才刷新树）
+	// Nodes kept per attribute (values update in place, the tree refreshes only when attributes come or go)
+	TMap<FGameplayAttribute, TSharedPtr<FGASAttributesNode>> AttributeNodes;
+
+	TWeakObjectPtr<UAbilitySystemComponent> AttributeItemsComponent;
+
 #if WITH_EDITOR
 	TArray<SGameplayTagWidget::FEditableGameplayTagContainerDatum> EditableOwnerContainers;
 	FGameplayTagContainer OwnweTagContainer;
@@ -483,6 +601,12 @@ private:
 
 	TArray<TSharedRef<FGASGameplayEffectNodeBase>> GameplayEffectTreeRoot;
 
+	// 节点按激活句柄保留（显示值原地更新，只有效果增减时才刷新树）
+	// Nodes kept per active handle (values update in place, the tree refreshes only when effects come or go)
+	TMap<FActiveGameplayEffectHandle, TSharedPtr<FGASGameplayEffectNode>> GameplayEffectNodes;
+
+	TWeakObjectPtr<UAbilitySystemComponent> GameplayEffectItemsComponent;
+
 	TArray<FString> HiddenGameplayEffectTreeColumns;
 };
 
@@ -525,6 +649,8 @@ void SGASAttachEditorImpl::Construct(const FArguments& InArgs)
 {
 	bGASTreeExpand = false;
 	bPickingTick = false;
+	ContinuousUpdateInterval = 0.1f;
+	LastContinuousUpdateTime = 0.0;
 	SelectAbilitySystemComponentForActorName = FName();
 	SelectAbilitieCategories = Ability;
 
@@ -598,6 +724,21 @@ void SGASAttachEditorImpl::Construct(const FArguments& InArgs)
 					]
 				]
 				+ SHorizontalBox::Slot()
+				.Padding(2.0f)
+				.AutoWidth()
+				[
+					SNew(SCheckBox)
+					.Padding(FMargin(4, 0))
+					//.ToolTipText(LOCTEXT("ViewportPickTip", "把光标移到视口中的角色上查看属性，左键或 END 键选中"))
+					.ToolTipText(LOCTEXT("ViewportPickTip", "Hover an actor in the viewport to preview its attributes, left click or press 'END' to select it"))
+					.IsChecked(this, &SGASAttachEditorImpl::HandleGetViewportPickChecked)
+					.OnCheckStateChanged(this, &SGASAttachEditorImpl::HandleViewportPickStateChanged)
+					[
+						SNew(STextBlock)
+						.Text(this, &SGASAttachEditorImpl::HandleGetViewportPickText)
+					]
+				]
+				+ SHorizontalBox::Slot()
 				.Padding(2.f, 2.f)
 				.AutoWidth()
 				[
@@ -669,10 +810,16 @@ void SGASAttachEditorImpl::Construct(const FArguments& InArgs)
 
 void SGASAttachEditorImpl::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
-	if (bPickingTick)
+	if (bPickingTick && InCurrentTime - LastContinuousUpdateTime >= ContinuousUpdateInterval)
 	{
+		LastContinuousUpdateTime = InCurrentTime;
 		UpdateGameplayCueListItems();
 	}
+
+	if (ViewportPicker.IsActive())
+	{
+		ViewportPicker.Tick(InCurrentTime);
+	}
 }
 
 
@@ -680,6 +827,10 @@ SGASAttachEditorImpl::~SGASAttachEditorImpl()
 {
 	FSlateApplication::Get().UnregisterInputPreProcessor(InputPtr);
 	InputPtr = nullptr;
+
+	UGASAttachEditorSettings::Get()->FlushSave();
+
+	UnbindPlayerCompRegistry();
 }
 
 TSharedRef<SWidget> SGASAttachEditorImpl::OnGetShowWorldTypeMenu()
@@ -717,6 +868,14 @@ TSharedRef<SWidget> SGASAttachEditorImpl::OnGetShowWorldTypeMenu()
 		}
 	}
 
+#if GASCORE_SNAPSHOT_STREAM
+	// 不在本进程的服务器（专用服务器）：切到远程快照查看
+	// Servers outside this process (dedicated servers): switch to the remote snapshot view
+	MenuBuilder.AddMenuSeparator();
+	MenuBuilder.AddMenuEntry(LOCTEXT("RemoteServerWorld", "Remote Server..."), FText(), FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &SGASAttachEditorImpl::HandleShowDebugAbilitieCategories, EDebugAbilitieCategories::Remote)));
+#endif
+
 	return MenuBuilder.MakeWidget();
 }
 
@@ -817,6 +976,7 @@ void SGASAttachEditorImpl::OnColumnSortModeChanged(const EColumnSortPriority::Ty
 {
 	SortMode = InSortMode;
 	RequestSort();
+	SaveSettings();
 }
 
 void SGASAttachEditorImpl::RequestSort()
@@ -962,6 +1122,61 @@ FText SGASAttachEditorImpl::HandleGetPickingModeText() const
 	return bPickingTick ? LOCTEXT("bPickingTickYes", "Press 'END' to interrupt") : LOCTEXT("bPickingTickNo", "Continuous Update") ;
 }
 
+ECheckBoxState SGASAttachEditorImpl::HandleGetViewportPickChecked() const
+{
+	return ViewportPicker.IsActive() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SGASAttachEditorImpl::HandleViewportPickStateChanged(ECheckBoxState NewValue)
+{
+	if (ViewportPicker.IsActive())
+	{
+		ViewportPicker.Stop();
+	}
+	else
+	{
+		ViewportPicker.Start(GetWorld());
+	}
+}
+
+FText SGASAttachEditorImpl::HandleGetViewportPickText() const
+{
+	if (!ViewportPicker.IsActive())
+	{
+		//return LOCTEXT("ViewportPickNo", "视口拾取");
+		return LOCTEXT("ViewportPickNo", "Pick in Viewport");
+	}
+
+	const UAbilitySystemComponent* Hovered = ViewportPicker.GetHoveredAbilitySystem();
+	const AActor* Avatar = Hovered ? Hovered->GetAvatarActor_Direct() : nullptr;
+	//return Avatar ? FText::Format(LOCTEXT("ViewportPickHovered", "悬停：{0}"), FText::FromString(Avatar->GetName())) : LOCTEXT("ViewportPickYes", "把光标移到角色上");
+	return Avatar ? FText::Format(LOCTEXT("ViewportPickHovered", "Hovering: {0}"), FText::FromString(Avatar->GetName())) : LOCTEXT("ViewportPickYes", "Hover an actor");
+}
+
+bool SGASAttachEditorImpl::ConfirmViewportPick()
+{
+	if (!ViewportPicker.IsActive())
+	{
+		return false;
+	}
+
+	const TWeakObjectPtr<UAbilitySystemComponent> Hovered = ViewportPicker.GetHoveredAbilitySystem();
+	if (!Hovered.IsValid())
+	{
+		return false;
+	}
+
+	ViewportPicker.Stop();
+	UpDataPlayerComp(GetWorld());
+	HandleOverrideTypeChange(Hovered);
+	return true;
+}
+
+bool SGASAttachEditorImpl::IsOverPickViewport(const FVector2D& ScreenPosition) const
+{
+	return ViewportPicker.IsOverViewport(ScreenPosition);
+}
+
 FReply SGASAttachEditorImpl::OnExpandAllClicked()
 {
 	SetGASTreeItemExpansion(true);
@@ -995,14 +1210,24 @@ void SGASAttachEditorImpl::SetGASTreeItemExpansion(bool bExpand)
 
 void SGASAttachEditorImpl::SaveSettings()
 {
-	GConfig->SetArray(TEXT("GASAttachEditor"), TEXT("HiddenReflectorTreeColumns"), HiddenReflectorTreeColumns, *GEditorPerProjectIni);
-	GConfig->SetArray(TEXT("GASAttachEditor"), TEXT("HiddenGameplayEffectTreeColumns"), HiddenGameplayEffectTreeColumns, *GEditorPerProjectIni);
+	// 只改内存里的设置，写配置由设置对象延迟合并
+	// Only the in-memory settings change here, the settings object debounces the config write
+	UGASAttachEditorSettings* Settings = UGASAttachEditorSettings::Get();
+	Settings->HiddenAbilityColumns = HiddenReflectorTreeColumns;
+	Settings->HiddenGameplayEffectColumns = HiddenGameplayEffectTreeColumns;
+	Settings->AbilitySortMode = static_cast<uint8>(SortMode);
+	Settings->ActiveFilter.AbilityStates = ScreenModeState;
+	Settings->RequestSave();
 }
 
 void SGASAttachEditorImpl::LoadSettings()
 {
-	GConfig->GetArray(TEXT("GASAttachEditor"), TEXT("HiddenReflectorTreeColumns"), HiddenReflectorTreeColumns, *GEditorPerProjectIni);
-	GConfig->GetArray(TEXT("GASAttachEditor"), TEXT("HiddenGameplayEffectTreeColumns"), HiddenGameplayEffectTreeColumns, *GEditorPerProjectIni);
+	const UGASAttachEditorSettings* Settings = UGASAttachEditorSettings::Get();
+	HiddenReflectorTreeColumns = Settings->HiddenAbilityColumns;
+	HiddenGameplayEffectTreeColumns = Settings->HiddenGameplayEffectColumns;
+	ContinuousUpdateInterval = FMath::Max(Settings->ContinuousUpdateInterval, 0.f);
+	SortMode = static_cast<EColumnSortMode::Type>(FMath::Clamp<uint8>(Settings->AbilitySortMode, EColumnSortMode::None, EColumnSortMode::Descending));
+	ScreenModeState = Settings->ActiveFilter.AbilityStates;
 }
 
 void SGASAttachEditorImpl::UpdateGameplayCueListItems()
@@ -1018,52 +1243,45 @@ void SGASAttachEditorImpl::UpdateGameplayCueListItems()
 		// Tag group
 		if (SelectAbilitieCategories == EDebugAbilitieCategories::Tags && FilteredOwnedTagsView.IsValid())
 		{
+			// 切换了组件：旧条目指向旧组件，全部丢弃
+			// Selection changed: the old items point at the old component
+			if (TagItemsComponent.Get() != ASC)
+			{
+				TagItemsComponent = ASC;
+				OwnedTagItems.Reset();
+				BlockedTagItems.Reset();
+				OldOwnerTags.Reset();
+				OldBlockedTags.Reset();
+				FilteredOwnedTagsView->RequestListRefresh();
+				FilteredBlockedTagsView->RequestListRefresh();
+			}
+
 			FGameplayTagContainer OwnerTags;
 			SelectAbilitySystemComponent->GetOwnedGameplayTags(OwnerTags);
 			if (OldOwnerTags != OwnerTags)
 			{
 				OldOwnerTags = OwnerTags;
-				FilteredOwnedTagsView->ClearChildren();
-#if WITH_EDITOR
-				OwnweTagContainer.Reset();
-#endif
-				
-				for (FGameplayTag InTag : OwnerTags)
+				if (SyncTagItems(OwnedTagItems, OwnerTags, ASC, "ActivationOwnedTags"))
 				{
-					FilteredOwnedTagsView->AddSlot()
-						[
-							SNew(SCharacterTagsViewItem)
-							.TagsItem(FGASCharacterTags::Create(ASC, InTag, "ActivationOwnedTags"))
-						];
+					FilteredOwnedTagsView->RequestListRefresh();
+				}
 #if WITH_EDITOR
-					OwnweTagContainer.AddTag(InTag);
+				OwnweTagContainer = OwnerTags;
 #endif
-				}
-
 			}
-			
 
 			FGameplayTagContainer BlockTags;
 			ASC->GetBlockedAbilityTags(BlockTags);
-
 			if (BlockTags != OldBlockedTags)
 			{
-				FilteredBlockedTagsView->ClearChildren();
-#if WITH_EDITOR
-				BlockedTagContainer.Reset();
-#endif
-				for (FGameplayTag InTag : BlockTags)
+				OldBlockedTags = BlockTags;
+				if (SyncTagItems(BlockedTagItems, BlockTags, ASC, "ActivationBlockedTags"))
 				{
-					FilteredBlockedTagsView->AddSlot()
-						[
-							SNew(SCharacterTagsViewItem)
-							.TagsItem(FGASCharacterTags::Create(ASC, InTag, "ActivationBlockedTags"))
-						];
+					FilteredBlockedTagsView->RequestListRefresh();
+				}
 #if WITH_EDITOR
-					BlockedTagContainer.AddTag(InTag);
+				BlockedTagContainer = BlockTags;
 #endif
-				}
-
 			}
 		}
 
@@ -1097,7 +1315,19 @@ void SGASAttachEditorImpl::UpdateGameplayCueListItems()
 		// Attribute group
 		if (SelectAbilitieCategories == EDebugAbilitieCategories::Attributes &&  AttributesReflectorTree.IsValid())
 		{
-			AttributesFilteredTreeRoot.Reset();
+			if (AttributeItemsComponent.Get() != ASC)
+			{
+				AttributeItemsComponent = ASC;
+				AttributeNodes.Reset();
+			}
+
+			// 复用已有节点，只在属性列表变化时刷新树
+			// Reuse the existing nodes; the tree only refreshes when the attribute list changed
+			TMap<FGameplayAttribute, TSharedPtr<FGASAttributesNode>> PreviousNodes = MoveTemp(AttributeNodes);
+			AttributeNodes.Reset();
+
+			TArray<TSharedRef<FGASAttributesNodeBase>> NewRoot;
+			NewRoot.Reserve(AttributesFilteredTreeRoot.Num());
 			for (UAttributeSet* Set : ASC->GetSpawnedAttributes())
 			{
 				if (!Set)
@@ -1107,39 +1337,74 @@ void SGASAttachEditorImpl::UpdateGameplayCueListItems()
 
 				for (TFieldIterator<FStructProperty> It(Set->GetClass()); It; ++It)
 				{
-					if ((*It)->Struct == FGameplayAttributeData::StaticStruct())
+					if (FGameplayAttribute::IsGameplayAttributeDataProperty(*It))
 					{
 						FGameplayAttribute	Attribute(*It);
-						TSharedRef<FGASAttributesNode> NewItem = FGASAttributesNode::Create(ASC, Attribute);
-
-						AttributesFilteredTreeRoot.Add(NewItem);
+						TSharedPtr<FGASAttributesNode> Node = PreviousNodes.FindRef(Attribute);
+						if (Node.IsValid())
+						{
+							Node->Refresh();
+						}
+						else
+						{
+							Node = FGASAttributesNode::Create(ASC, Attribute);
+						}
+
+						AttributeNodes.Add(Attribute, Node);
+						NewRoot.Add(Node.ToSharedRef());
 					}
 				}
 			}
-			AttributesReflectorTree->RequestTreeRefresh();
 
+			if (NewRoot != AttributesFilteredTreeRoot)
+			{
+				AttributesFilteredTreeRoot = MoveTemp(NewRoot);
+				AttributesReflectorTree->RequestTreeRefresh();
+			}
 		}
 
 		// 游戏效果组
 		// GameplayEffect group
 		if (SelectAbilitieCategories == EDebugAbilitieCategories::GameplayEffects && GameplayEffectTree.IsValid())
 		{
-			GameplayEffectTreeRoot.Reset();
-
-			FProperty* GameplayEffectsPtr = FindFProperty<FProperty>(ASC->GetClass(), "ActiveGameplayEffects");
-
-			if (!GameplayEffectsPtr) return;
-			FActiveGameplayEffectsContainer* ActiveGameplayEffectsPtr = GameplayEffectsPtr->ContainerPtrToValuePtr<FActiveGameplayEffectsContainer>(ASC);
-			if (!ActiveGameplayEffectsPtr) return;
+			if (GameplayEffectItemsComponent.Get() != ASC)
+			{
+				GameplayEffectItemsComponent = ASC;
+				GameplayEffectNodes.Reset();
+			}
 
-			for (FActiveGameplayEffect& ActiveGE : ActiveGameplayEffectsPtr)
+			// 按句柄复用节点：持续时间、堆叠、修改器数值原地更新；只有效果增减（或修改器数量变化）时刷新树
+			// Nodes are reused per handle: durations, stacks and modifier values update in place; the tree only
+			// refreshes when effects come or go (or an effect's modifier count changes)
+			TMap<FActiveGameplayEffectHandle, TSharedPtr<FGASGameplayEffectNode>> PreviousNodes = MoveTemp(GameplayEffectNodes);
+			GameplayEffectNodes.Reset();
+
+			const UWorld* World = GetWorld();
+			bool bChildrenChanged = false;
+			TArray<TSharedRef<FGASGameplayEffectNodeBase>> NewRoot;
+			NewRoot.Reserve(GameplayEffectTreeRoot.Num());
+			for (const FActiveGameplayEffect& ActiveGE : &ASC->GetActiveGameplayEffects())
 			{
-				GameplayEffectTreeRoot.Add(FGASGameplayEffectNode::Create(GetWorld(), ActiveGE));
+				TSharedPtr<FGASGameplayEffectNode> Node = PreviousNodes.FindRef(ActiveGE.Handle);
+				if (Node.IsValid())
+				{
+					bChildrenChanged |= Node->Refresh();
+				}
+				else
+				{
+					Node = FGASGameplayEffectNode::Create(World, ASC, ActiveGE.Handle);
+					GameplayEffectTree->SetItemExpansion(Node.ToSharedRef(), bGASTreeExpand);
+				}
 
-				GameplayEffectTree->SetItemExpansion(GameplayEffectTreeRoot.Top(), bGASTreeExpand);
+				GameplayEffectNodes.Add(ActiveGE.Handle, Node);
+				NewRoot.Add(Node.ToSharedRef());
 			}
 
-			GameplayEffectTree->RequestTreeRefresh();
+			if (bChildrenChanged || NewRoot != GameplayEffectTreeRoot)
+			{
+				GameplayEffectTreeRoot = MoveTemp(NewRoot);
+				GameplayEffectTree->RequestTreeRefresh();
+			}
 		}
 	}
 }
@@ -1157,7 +1422,7 @@ TSharedRef<SWidget> SGASAttachEditorImpl::OnGetShowDebugAbilitieCategories()
 {
 	FMenuBuilder MenuBuilder(true, NULL);
 
-	TArray<EDebugAbilitieCategories> Categories({ EDebugAbilitieCategories::Ability,EDebugAbilitieCategories::Attributes,EDebugAbilitieCategories::GameplayEffects, EDebugAbilitieCategories::Tags });
+	TArray<EDebugAbilitieCategories> Categories({ EDebugAbilitieCategories::Ability,EDebugAbilitieCategories::Attributes,EDebugAbilitieCategories::GameplayEffects, EDebugAbilitieCategories::Tags, EDebugAbilitieCategories::Timeline, EDebugAbilitieCategories::Remote, EDebugAbilitieCategories::Cost, EDebugAbilitieCategories::Group });
 
 	for (EDebugAbilitieCategories& Type : Categories)
 	{
@@ -1199,6 +1464,18 @@ FORCEINLINE FName SGASAttachEditorImpl::GetAbilitieCategoriesName(EDebugAbilitie
 	case EDebugAbilitieCategories::GameplayEffects:
 		TypeName = "GameplayEffects";
 		break;
+	case EDebugAbilitieCategories::Timeline:
+		TypeName = "Timeline";
+		break;
+	case EDebugAbilitieCategories::Remote:
+		TypeName = "Remote";
+		break;
+	case EDebugAbilitieCategories::Cost:
+		TypeName = "Cost";
+		break;
+	case EDebugAbilitieCategories::Group:
+		TypeName = "Group";
+		break;
 	}
 
 	return TypeName;
@@ -1225,6 +1502,22 @@ FORCEINLINE FText SGASAttachEditorImpl::GetAbilitieCategoriesText(EDebugAbilitie
 		//TypeText = LOCTEXT("Categories_GameplayEffects", "效果");
 		TypeText = LOCTEXT("Categories_GameplayEffects", "GameplayEffects");
 		break;
+	case EDebugAbilitieCategories::Timeline:
+		//TypeText = LOCTEXT("Categories_Timeline", "时间轴");
+		TypeText = LOCTEXT("Categories_Timeline", "Timeline");
+		break;
+	case EDebugAbilitieCategories::Remote:
+		//TypeText = LOCTEXT("Categories_Remote", "远程服务器");
+		TypeText = LOCTEXT("Categories_Remote", "Remote Server");
+		break;
+	case EDebugAbilitieCategories::Cost:
+		//TypeText = LOCTEXT("Categories_Cost", "开销");
+		TypeText = LOCTEXT("Categories_Cost", "Cost");
+		break;
+	case EDebugAbilitieCategories::Group:
+		//TypeText = LOCTEXT("Categories_Group", "分组统计");
+		TypeText = LOCTEXT("Categories_Group", "Group");
+		break;
 	}
 
 	return TypeText;
@@ -1255,6 +1548,32 @@ void SGASAttachEditorImpl::CreateDebugAbilitieCategories(EDebugAbilitieCategorie
 	case EDebugAbilitieCategories::Tags:
 		CategoriesWidget = CreateAbilityTagWidget();
 		break;
+	case EDebugAbilitieCategories::Timeline:
+#if GASCORE_STATE_RECORDER
+		CategoriesWidget = SNew(SGASStateTimeline)
+			.AbilitySystem_Lambda([this] { return SelectAbilitySystemComponent; });
+#endif
+		break;
+	case EDebugAbilitieCategories::Remote:
+#if GASCORE_SNAPSHOT_STREAM
+		CategoriesWidget = SNew(SGASRemoteInspector);
+#endif
+		break;
+	case EDebugAbilitieCategories::Cost:
+#if GASCORE_EFFECT_PROFILER
+		CategoriesWidget = SNew(SGASCostView)
+			.World_Lambda([this] { return TWeakObjectPtr<UWorld>(GetWorld()); })
+			.OnAbilitySystemSelected(this, &SGASAttachEditorImpl::HandleOverrideTypeChange);
+#endif
+		break;
+	case EDebugAbilitieCategories::Group:
+	{
+		const TSharedRef<SGASGroupView> NewGroupView = SNew(SGASGroupView)
+			.World_Lambda([this] { return TWeakObjectPtr<UWorld>(GetWorld()); });
+		GroupView = NewGroupView;
+		CategoriesWidget = NewGroupView;
+		break;
+	}
 	}
 
 	if (!CategoriesWidget.IsValid())
@@ -1342,14 +1661,14 @@ TSharedPtr<SWidget> SGASAttachEditorImpl::CreateAbilityTagWidget()
 			[
 				SNew(SBorder)
 				.Padding(2.f)
+				[
+					SAssignNew(FilteredOwnedTagsView, STagsList)
+					.ListItemsSource(&OwnedTagItems)
+					.SelectionMode(ESelectionMode::None)
+					.OnGenerateRow(this, &SGASAttachEditorImpl::OnGenerateTagRow)
 #if WITH_EDITOR
-				.OnMouseButtonUp(this, &SGASAttachEditorImpl::OnMouseButtonUpTags, FName("OwnTags"))
+					.OnContextMenuOpening(this, &SGASAttachEditorImpl::OnTagsContextMenuOpening, FName("OwnTags"))
 #endif
-				[
-					SAssignNew(FilteredOwnedTagsView, SWrapBox)
-					.Orientation(EOrientation::Orient_Horizontal)
-					.UseAllottedSize(true)
-					.InnerSlotPadding(FVector2D(5.f))
 				]
 			]
 		]
@@ -1373,15 +1692,15 @@ TSharedPtr<SWidget> SGASAttachEditorImpl::CreateAbilityTagWidget()
 			.FillHeight(1.f)
 			[
 				SNew(SBorder)
-#if WITH_EDITOR
-				.OnMouseButtonUp(this, &SGASAttachEditorImpl::OnMouseButtonUpTags, FName("BlaTags"))
-#endif
 				.Padding(2.f)
 				[
-					SAssignNew(FilteredBlockedTagsView, SWrapBox)
-					.Orientation(EOrientation::Orient_Horizontal)
-					.UseAllottedSize(true)
-					.InnerSlotPadding(FVector2D(5.f))
+					SAssignNew(FilteredBlockedTagsView, STagsList)
+					.ListItemsSource(&BlockedTagItems)
+					.SelectionMode(ESelectionMode::None)
+					.OnGenerateRow(this, &SGASAttachEditorImpl::OnGenerateTagRow)
+#if WITH_EDITOR
+					.OnContextMenuOpening(this, &SGASAttachEditorImpl::OnTagsContextMenuOpening, FName("BlaTags"))
+#endif
 				]
 			]
 	];
@@ -1394,34 +1713,35 @@ void SGASAttachEditorImpl::OnApplicationPreInputKeyDownListener(const FKeyEvent&
 		SetPickingMode(false);
 	}
 }
+
+TSharedRef<ITableRow> SGASAttachEditorImpl::OnGenerateTagRow(TSharedPtr<FGASCharacterTagsBase> InItem, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<TSharedPtr<FGASCharacterTagsBase>>, OwnerTable)
+		.Padding(FMargin(2.f, 1.f))
+		[
+			SNew(SCharacterTagsViewItem)
+			.TagsItem(InItem)
+		];
+}
+
 #if WITH_EDITOR
-FReply SGASAttachEditorImpl::OnMouseButtonUpTags(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent, FName TagsName)
+TSharedPtr<SWidget> SGASAttachEditorImpl::OnTagsContextMenuOpening(FName TagsName)
 {
-	if (MouseEvent.GetEffectingButton() == EKeys::RightMouseButton)
+	// 右键菜单由列表弹出
+	// The list pushes the returned widget as its right-click menu
+	if (TagsName == "OwnTags")
 	{
-		TSharedPtr<SGameplayTagWidget> TagWidget = 
-			SNew(SGameplayTagWidget, TagsName == "OwnTags" ? EditableOwnerContainers : EditableBlockedContainers)
-			.GameplayTagUIMode(EGameplayTagUIMode::SelectionMode)
-			.ReadOnly(false)
-			.OnTagChanged(this, &SGASAttachEditorImpl::RefreshTagList, TagsName);
-
-		if (TagWidget.IsValid())
-		{
-			if (TagsName == "OwnTags")
-			{
-				OldOwnweTagContainer = OwnweTagContainer;
-			}
-			else
-			{
-				OldBlockedTagContainer = BlockedTagContainer;
-			}
-
-			FWidgetPath WidgetPath = MouseEvent.GetEventPath() != nullptr ? *MouseEvent.GetEventPath() : FWidgetPath();
-			FSlateApplication::Get().PushMenu(AsShared(), WidgetPath, TagWidget.ToSharedRef(), MouseEvent.GetScreenSpacePosition(), FPopupTransitionEffect(FPopupTransitionEffect::ContextMenu));
-		}
-
+		OldOwnweTagContainer = OwnweTagContainer;
 	}
-	return FReply::Handled();
+	else
+	{
+		OldBlockedTagContainer = BlockedTagContainer;
+	}
+
+	return SNew(SGameplayTagWidget, TagsName == "OwnTags" ? EditableOwnerContainers : EditableBlockedContainers)
+		.GameplayTagUIMode(EGameplayTagUIMode::SelectionMode)
+		.ReadOnly(false)
+		.OnTagChanged(this, &SGASAttachEditorImpl::RefreshTagList, TagsName);
 }
 
 
@@ -1496,12 +1816,77 @@ void SGASAttachEditorImpl::HandleScreenModeStateChanged(ECheckBoxState NewValue,
 		break;
 	}
 
+	RefreshScreenModeVisibility();
+	SaveSettings();
+}
+
+void SGASAttachEditorImpl::RefreshScreenModeVisibility()
+{
 	for (TSharedRef<FGASAbilitieNodeBase>& Item : AbilitieFilteredTreeRoot)
 	{
 		Item->SetItemVisility(Item->ScreenGAMode & ScreenModeState);
 	}
 }
 
+TSharedRef<SWidget> SGASAttachEditorImpl::OnGetFilterPresetMenu()
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+	UGASAttachEditorSettings* Settings = UGASAttachEditorSettings::Get();
+
+	//MenuBuilder.BeginSection("FilterPresets", LOCTEXT("FilterPresetsSection", "筛选预设"));
+	MenuBuilder.BeginSection("FilterPresets", LOCTEXT("FilterPresetsSection", "Filter Presets"));
+	for (const FGASAttachEditorFilterPreset& Preset : Settings->FilterPresets)
+	{
+		MenuBuilder.AddMenuEntry(FText::FromString(Preset.Name), FText(), FSlateIcon(),
+			FUIAction(FExecuteAction::CreateSP(this, &SGASAttachEditorImpl::HandleFilterPresetSelected, Preset.Name)));
+	}
+	MenuBuilder.EndSection();
+
+	//MenuBuilder.BeginSection("FilterPresetsEdit", LOCTEXT("FilterPresetsEditSection", "保存当前筛选（已有同名预设则覆盖，前缀 - 删除）"));
+	MenuBuilder.BeginSection("FilterPresetsEdit", LOCTEXT("FilterPresetsEditSection", "Save Current Filters (same name overwrites, '-' prefix removes)"));
+	MenuBuilder.AddWidget(
+		SNew(SEditableTextBox)
+		.MinDesiredWidth(160.f)
+		.HintText(LOCTEXT("FilterPresetName", "Preset name"))
+		.OnTextCommitted_Lambda([](const FText& InText, ETextCommit::Type CommitType)
+		{
+			const FString PresetName = InText.ToString().TrimStartAndEnd();
+			if (CommitType != ETextCommit::OnEnter || PresetName.IsEmpty())
+			{
+				return;
+			}
+
+			UGASAttachEditorSettings* Settings = UGASAttachEditorSettings::Get();
+			if (PresetName.StartsWith(TEXT("-")))
+			{
+				Settings->RemoveFilterPreset(PresetName.RightChop(1).TrimStart());
+			}
+			else
+			{
+				Settings->SaveFilterPreset(PresetName);
+			}
+			FSlateApplication::Get().DismissAllMenus();
+		}),
+		FText());
+	MenuBuilder.EndSection();
+
+	return MenuBuilder.MakeWidget();
+}
+
+void SGASAttachEditorImpl::HandleFilterPresetSelected(FString PresetName)
+{
+	if (UGASAttachEditorSettings::Get()->ApplyFilterPreset(PresetName))
+	{
+		ScreenModeState = UGASAttachEditorSettings::Get()->ActiveFilter.AbilityStates;
+		RefreshScreenModeVisibility();
+
+		if (const TSharedPtr<SGASGroupView> PinnedGroupView = GroupView.Pin())
+		{
+			PinnedGroupView->RefreshFiltersFromSettings();
+		}
+	}
+}
+
 ECheckBoxState SGASAttachEditorImpl::HandleGetScreenButtonChecked(EScreenGAModeState InState) const
 {
 	return ScreenModeState & InState ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
@@ -1606,6 +1991,20 @@ TSharedPtr<SWidget> SGASAttachEditorImpl::CreateAbilityToolWidget()
 				[
 					CreateScreenCheckBox(NoActive).ToSharedRef()
 				]
+
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				[
+					SNew(SComboButton)
+					.OnGetMenuContent(this, &SGASAttachEditorImpl::OnGetFilterPresetMenu)
+					.ContentPadding(2)
+					.ButtonContent()
+					[
+						SNew(STextBlock)
+						//.Text(LOCTEXT("FilterPresets", "预设"))
+						.Text(LOCTEXT("FilterPresets", "Presets"))
+					]
+				]
 			]
 
 		+ SVerticalBox::Slot()
@@ -1666,6 +2065,11 @@ TSharedPtr<SWidget> SGASAttachEditorImpl::CreateAbilityToolWidget()
 
 TSharedPtr<SWidget> SGASAttachEditorImpl::CreateAttributesToolWidget()
 {
+	// 新的树控件：节点重新创建
+	// New tree widget: start from fresh nodes
+	AttributesFilteredTreeRoot.Reset();
+	AttributeNodes.Reset();
+
 	return SNew(SBorder)
 			.Padding(0)
 			[
@@ -1697,6 +2101,11 @@ TSharedPtr<SWidget> SGASAttachEditorImpl::CreateAttributesToolWidget()
 
 TSharedPtr<SWidget> SGASAttachEditorImpl::CreateGameplayEffectToolWidget()
 {
+	// 新的树控件：节点重新创建（展开状态随之重置）
+	// New tree widget: start from fresh nodes (expansion is set per new node)
+	GameplayEffectTreeRoot.Reset();
+	GameplayEffectNodes.Reset();
+
 	TArray<FName> HiddenColumnsList;
 	HiddenColumnsList.Reserve(HiddenGameplayEffectTreeColumns.Num());
 	for (const FString& Item : HiddenGameplayEffectTreeColumns)
@@ -1834,10 +2243,24 @@ bool FAttachInputProcessor::HandleKeyDownEvent(FSlateApplication& SlateApp, cons
 {
 	if (InKeyEvent.GetKey() == EKeys::End && GASAttachEditorWidgetPtr)
 	{
+		GASAttachEditorWidgetPtr->ConfirmViewportPick();
 		GASAttachEditorWidgetPtr->SetPickingMode(false);
 	}
 
 	return false;
 }
 
+bool FAttachInputProcessor::HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	// 视口拾取中左键只用来选中，不再传给游戏
+	// While picking in the viewport a left click only selects and is not passed on to the game
+	if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton && GASAttachEditorWidgetPtr
+		&& GASAttachEditorWidgetPtr->IsOverPickViewport(MouseEvent.GetScreenSpacePosition()))
+	{
+		return GASAttachEditorWidgetPtr->ConfirmViewportPick();
+	}
+
+	return false;
+}
+
 #undef LOCTEXT_NAMESPACE
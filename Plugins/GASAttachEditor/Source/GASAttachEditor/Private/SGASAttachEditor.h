@@ -21,6 +21,18 @@ enum EDebugAbilitieCategories
 
 	// 技能
 	Ability,
+
+	// 状态录制时间轴
+	Timeline,
+
+	// 远程服务器快照
+	Remote,
+
+	// 每个ASC的开销
+	Cost,
+
+	// 多ASC分组统计
+	Group,
 };
 
 
@@ -40,6 +52,14 @@ public:
 	// Set the status change
 	virtual void SetPickingMode(bool bTick) = 0;
 
+	// 视口拾取中确认选中悬停的角色（返回是否选中了角色）
+	// Confirm the hovered actor while picking in the viewport (returns whether an actor was selected)
+	virtual bool ConfirmViewportPick() = 0;
+
+	// 屏幕坐标是否在视口拾取的游戏视口上
+	// Whether a screen position is over the game viewport being picked in
+	virtual bool IsOverPickViewport(const FVector2D& ScreenPosition) const = 0;
+
 	// 该Tab控件名字
 	// The tab control name
 	static FName GetTabName();
@@ -57,6 +77,7 @@ public:
 private:
 
 	virtual bool HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) override;
+	virtual bool HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
 	virtual const TCHAR* GetDebugName() const override { return TEXT("AttachInputProcessor"); }
 	virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override {}
 
@@ -7,13 +7,12 @@
 
 #include "Widgets/Layout/SWrapBox.h"
 #include "TagLookAsset/SGASLookAssetBase.h"
+#include "TagLookAsset/GASTagTriggerIndex.h"
 #include "Layout/Children.h"
-#include "AssetRegistry/AssetRegistryModule.h"
 #include "Abilities/GameplayAbility.h"
 #include "UObject/UObjectGlobals.h"
 
 #include "Framework/Docking/TabManager.h"
-#include "AssetRegistry/AssetData.h"
 #include "Widgets/Views/STreeView.h"
 #include "Templates/SharedPointer.h"
 #include "Widgets/Text/STextBlock.h"
@@ -26,6 +25,8 @@ class SGASTagLookAssetImpl : public SGASTagLookAsset
 public:
 	virtual void Construct(const FArguments& InArgs) override;
 
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
 protected:
 	// 右键添加或者删除Tag
 	// Right click to add or delete tag
@@ -44,10 +45,10 @@ protected:
 
 	void HandleAttributesTreeGetChildren( TSharedRef<FGASLookAssetBase> InReflectorNode, TArray<TSharedRef<FGASLookAssetBase>>& OutChildren );
 
+	// 从Tag索引查询筛选Tag的触发器
+	// Query the tag index for the filtered tags' triggers
 	void FillLookTagAsset();
 
-	void SetGraphRootIdentifiers(const TArray<FAssetIdentifier>& NewGraphRootIdentifiers);
-
 
 private:
 #if WITH_EDITOR
@@ -72,6 +73,10 @@ private:
 	// Tree control root
 	TArray<TSharedRef<FGASLookAssetBase>> LookGAAssetTreeRoot;
 
+	// 索引还在后台建立时的查询（完成后重新查询）
+	// A query was made while the index was still building (re-run once it is ready)
+	bool bQueryPending = false;
+
 };
 
 void SGASTagLookAssetImpl::Construct(const FArguments& InArgs)
@@ -96,6 +101,18 @@ void SGASTagLookAssetImpl::Construct(const FArguments& InArgs)
 					//.Text(LOCTEXT("AbilityTriggersEvent", "调用GA事件的Tags"))
 					.Text(LOCTEXT("AbilityTriggersEvent", "Ability Trigger Events"))
 				]
+#if WITH_EDITOR
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.HAlign(HAlign_Left)
+				.Padding(2.f)
+				[
+					SNew(STextBlock)
+					//.Text(LOCTEXT("TagIndexBuilding", "正在建立技能资源索引..."))
+					.Text(LOCTEXT("TagIndexBuilding", "Indexing ability assets..."))
+					.Visibility_Lambda([] { return FGASTagTriggerIndex::Get().IsReady() ? EVisibility::Collapsed : EVisibility::Visible; })
+				]
+#endif
 				+ SVerticalBox::Slot()
 				.FillHeight(1.f)
 				[
@@ -157,6 +174,16 @@ void SGASTagLookAssetImpl::Construct(const FArguments& InArgs)
 #endif
 }
 
+void SGASTagLookAssetImpl::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+#if WITH_EDITOR
+	if (bQueryPending && FGASTagTriggerIndex::Get().IsReady())
+	{
+		FillLookTagAsset();
+	}
+#endif
+}
+
 #if WITH_EDITOR
 FReply SGASTagLookAssetImpl::OnMouseButtonUpTags(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
@@ -257,93 +284,26 @@ void SGASTagLookAssetImpl::HandleAttributesTreeGetChildren(TSharedRef<FGASLookAs
 }
 
 void SGASTagLookAssetImpl::FillLookTagAsset()
-{
-	TArray<FGameplayTag> NewGameplayTagArr;
-
-#if WITH_EDITOR
-	TagContainer.GetGameplayTagArray(NewGameplayTagArr);
-#endif
-
-	TArray<FAssetIdentifier> AssetIdentifiers;
-
-	for (const FGameplayTag& Item : NewGameplayTagArr)
-	{
-		AssetIdentifiers.Add(FAssetIdentifier(FGameplayTag::StaticStruct(), Item.GetTagName()));
-	}
-
-	SetGraphRootIdentifiers(AssetIdentifiers);
-}
-
-
-void SGASTagLookAssetImpl::SetGraphRootIdentifiers(const TArray<FAssetIdentifier>& NewGraphRootIdentifiers)
 {
 	LookGAAssetTreeRoot.Reset();
 #if WITH_EDITOR
-	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	FGASTagTriggerIndex& Index = FGASTagTriggerIndex::Get();
+	bQueryPending = !Index.IsReady();
 
-	TArray<FAssetDependency> LinksToAsset;
-	for (const FAssetIdentifier& AssetId : NewGraphRootIdentifiers)
+	TArray<FGASTagTriggerIndex::FTriggerEntry> Entries;
+	Index.FindTriggers(TagContainer, Entries);
+	for (const FGASTagTriggerIndex::FTriggerEntry& Entry : Entries)
 	{
-		AssetRegistry.GetReferencers(AssetId, LinksToAsset, UE::AssetRegistry::EDependencyCategory::SearchableName, UE::AssetRegistry::EDependencyQuery::NoRequirements);
-	}
-	for (FAssetDependency& Asset : LinksToAsset)
-	{
-		FString PackStr = Asset.AssetId.PackageName.ToString();
-		int32 Index = PackStr.Find("/",ESearchCase::CaseSensitive,ESearchDir::FromEnd);
-
-		FString AssPath = FString::Printf(TEXT("Blueprint'%s.%s'"), *PackStr,*PackStr.Right(PackStr.Len() - Index - 1));
-
-		FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(*AssPath));
-
-		if (!AssetData.IsValid()) continue;
-
-		UObject* AssObj = AssetData.GetAsset();
-
-		UGameplayAbility* GAAssObj = Cast<UGameplayAbility>(AssObj);
-		if (!GAAssObj)
-		{
-			UBlueprint* GAAssBlue = Cast<UBlueprint>(AssObj);
-			if (!GAAssBlue) continue;
-
-			//TSubclassOf<UGameplayAbility> GAAssClass = TSubclassOf<UGameplayAbility>(GAAssBlue->GeneratedClass);
-
-			GAAssObj = Cast<UGameplayAbility>(GAAssBlue->GeneratedClass->GetDefaultObject());
-			/*FSoftClassPath ClassPath(GAAssBlue->GeneratedClass.Get()->GetPathName());
-			if (UClass* Class = ClassPath.TryLoadClass<UGameplayAbility>())
-			{
-				GAAssObj = NewObject<UGameplayAbility>(Class, NAME_None, RF_Transactional);
-			}*/
-
-			if (!GAAssObj)	continue;
-		}
-
-
-		FArrayProperty* ActiveTagsPtr = FindFProperty<FArrayProperty>(GAAssObj->GetClass(), "AbilityTriggers");
-		if (!ActiveTagsPtr) continue;
-		TArray<FAbilityTriggerData> ActivationTags = *ActiveTagsPtr->ContainerPtrToValuePtr<TArray<FAbilityTriggerData>>(GAAssObj);
-
-		bool bHasTag = false;
-		for (FAbilityTriggerData& Item : ActivationTags)
-		{
-			if (TagContainer.HasTag(Item.TriggerTag))
-			{
-				bHasTag = true;
-				LookGAAssetTreeRoot.Add(FGASLookAsset::Create(AssObj, Item));
-			}
-		}
-
-		if (bHasTag)
-		{
-		}
+		LookGAAssetTreeRoot.Add(FGASLookAsset::Create(Entry.Asset, Entry.Trigger));
 	}
 
 	LookGAAssetTreeRoot.Sort([](TSharedRef<FGASLookAssetBase> A,TSharedRef<FGASLookAssetBase> B)
 	{
 		if (A->GetTagName() != B->GetTagName())
 		{
-			return A->GetTagName().GetStringLength() == B->GetTagName().GetStringLength();
+			return A->GetTagName().LexicalLess(B->GetTagName());
 		}
-		return true;
+		return A->GetAbilitieAsset().LexicalLess(B->GetAbilitieAsset());
 	});
 
 #endif
@@ -0,0 +1,315 @@
+#include "TagLookAsset/GASTagTriggerIndex.h"
+
+#if WITH_EDITOR
+#include "Abilities/GameplayAbility.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "GameplayTagsManager.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+
+FGASTagTriggerIndex& FGASTagTriggerIndex::Get()
+{
+	static FGASTagTriggerIndex Index;
+	return Index;
+}
+
+void FGASTagTriggerIndex::Initialize()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	RenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FGASTagTriggerIndex::HandleAssetRenamed);
+	RemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FGASTagTriggerIndex::HandleAssetRemoved);
+	SavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FGASTagTriggerIndex::HandlePackageSaved);
+
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FGASTagTriggerIndex::StartBuild);
+	}
+	else
+	{
+		StartBuild();
+	}
+}
+
+void FGASTagTriggerIndex::Shutdown()
+{
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(RenamedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(RemovedHandle);
+	}
+	UPackage::PackageSavedWithContextEvent.Remove(SavedHandle);
+
+	PendingBuild.Wait();
+	PendingBuild = UE::Tasks::FTask();
+	PendingResult.Reset();
+	PendingUpdates.Reset();
+	AssetsByTag.Reset();
+	TriggersByAsset.Reset();
+	bReady = false;
+}
+
+bool FGASTagTriggerIndex::IsReady()
+{
+	CollectBuild();
+	return bReady;
+}
+
+void FGASTagTriggerIndex::StartBuild()
+{
+	check(IsInGameThread());
+	if (PendingResult.IsValid())
+	{
+		return;
+	}
+
+	// 注册表读接口是线程安全的，后台只碰注册表数据
+	// The registry's read API is thread safe, the task only touches registry data
+	IAssetRegistry* AssetRegistry = &FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	PendingResult = MakeShared<FBuildResult>();
+	PendingBuild = UE::Tasks::Launch(UE_SOURCE_LOCATION, [AssetRegistry, Result = PendingResult]() { Build(*AssetRegistry, *Result); });
+}
+
+void FGASTagTriggerIndex::Build(IAssetRegistry& AssetRegistry, FBuildResult& Result)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FGASTagTriggerIndex::Build);
+
+	TSet<FTopLevelAssetPath> AbilityClasses;
+	AssetRegistry.GetDerivedClassNames({ UGameplayAbility::StaticClass()->GetClassPathName() }, {}, AbilityClasses);
+
+	TArray<FAssetData> Blueprints;
+	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), Blueprints, true);
+
+	const FName TagPackageName = FGameplayTag::StaticStruct()->GetOutermost()->GetFName();
+	const FName TagStructName = FGameplayTag::StaticStruct()->GetFName();
+
+	TArray<FAssetIdentifier> Dependencies;
+	for (const FAssetData& Blueprint : Blueprints)
+	{
+		const FString GeneratedClassPath = Blueprint.GetTagValueRef<FString>(FBlueprintTags::GeneratedClassPath);
+		if (GeneratedClassPath.IsEmpty() || !AbilityClasses.Contains(FTopLevelAssetPath(FSoftObjectPath(GeneratedClassPath).GetAssetPath())))
+		{
+			continue;
+		}
+
+		Dependencies.Reset();
+		AssetRegistry.GetDependencies(FAssetIdentifier(Blueprint.PackageName), Dependencies, UE::AssetRegistry::EDependencyCategory::SearchableName);
+		for (const FAssetIdentifier& Dependency : Dependencies)
+		{
+			if (Dependency.PackageName == TagPackageName && Dependency.ObjectName == TagStructName && !Dependency.ValueName.IsNone())
+			{
+				Result.AssetsByTag.FindOrAdd(Dependency.ValueName).Add(Blueprint.GetSoftObjectPath());
+			}
+		}
+	}
+}
+
+void FGASTagTriggerIndex::CollectBuild()
+{
+	check(IsInGameThread());
+	if (!PendingResult.IsValid() || !PendingBuild.IsCompleted())
+	{
+		return;
+	}
+
+	AssetsByTag = MoveTemp(PendingResult->AssetsByTag);
+	PendingResult.Reset();
+	PendingBuild = UE::Tasks::FTask();
+	bReady = true;
+
+	for (const FSoftObjectPath& AssetPath : PendingUpdates)
+	{
+		if (UObject* Asset = AssetPath.ResolveObject())
+		{
+			UpdateAsset(AssetPath, Asset);
+		}
+		else
+		{
+			RemoveAsset(AssetPath);
+		}
+	}
+	PendingUpdates.Reset();
+}
+
+bool FGASTagTriggerIndex::ReadTriggers(UObject* Asset, TArray<FAbilityTriggerData>& OutTriggers)
+{
+	const UBlueprint* Blueprint = Cast<UBlueprint>(Asset);
+	const UGameplayAbility* Ability = Blueprint && Blueprint->GeneratedClass ? Cast<UGameplayAbility>(Blueprint->GeneratedClass->GetDefaultObject()) : Cast<UGameplayAbility>(Asset);
+	if (!Ability)
+	{
+		return false;
+	}
+
+	// AbilityTriggers 是受保护的成员，通过反射读取
+	// AbilityTriggers is protected, read it through reflection
+	const FArrayProperty* TriggersProperty = FindFProperty<FArrayProperty>(Ability->GetClass(), "AbilityTriggers");
+	if (!TriggersProperty)
+	{
+		return false;
+	}
+
+	OutTriggers = *TriggersProperty->ContainerPtrToValuePtr<TArray<FAbilityTriggerData>>(Ability);
+	return true;
+}
+
+const FGASTagTriggerIndex::FAssetTriggers* FGASTagTriggerIndex::ResolveTriggers(const FSoftObjectPath& AssetPath)
+{
+	if (const FAssetTriggers* Cached = TriggersByAsset.Find(AssetPath))
+	{
+		if (Cached->Asset.IsValid())
+		{
+			return Cached;
+		}
+	}
+
+	// 只有第一次查询到的候选资源才会加载
+	// Only a candidate's first query loads it
+	UObject* Asset = AssetPath.TryLoad();
+	FAssetTriggers Triggers;
+	if (!Asset || !ReadTriggers(Asset, Triggers.Triggers))
+	{
+		TriggersByAsset.Remove(AssetPath);
+		return nullptr;
+	}
+
+	Triggers.Asset = Asset;
+	return &TriggersByAsset.Add(AssetPath, MoveTemp(Triggers));
+}
+
+void FGASTagTriggerIndex::FindTriggers(const FGameplayTagContainer& Tags, TArray<FTriggerEntry>& OutEntries)
+{
+	OutEntries.Reset();
+	if (!IsReady() || Tags.IsEmpty())
+	{
+		return;
+	}
+
+	TSet<FSoftObjectPath> Candidates;
+	for (const TPair<FName, TSet<FSoftObjectPath>>& Pair : AssetsByTag)
+	{
+		const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(Pair.Key, false);
+		if (Tag.IsValid() && Tags.HasTag(Tag))
+		{
+			Candidates.Append(Pair.Value);
+		}
+	}
+
+	for (const FSoftObjectPath& AssetPath : Candidates)
+	{
+		const FAssetTriggers* Triggers = ResolveTriggers(AssetPath);
+		if (!Triggers)
+		{
+			continue;
+		}
+
+		for (const FAbilityTriggerData& Trigger : Triggers->Triggers)
+		{
+			if (Tags.HasTag(Trigger.TriggerTag))
+			{
+				OutEntries.Add({ Triggers->Asset.Get(), Trigger });
+			}
+		}
+	}
+}
+
+void FGASTagTriggerIndex::UpdateAsset(const FSoftObjectPath& AssetPath, UObject* Asset)
+{
+	TArray<FAbilityTriggerData> Triggers;
+	if (!ReadTriggers(Asset, Triggers))
+	{
+		RemoveAsset(AssetPath);
+		return;
+	}
+
+	// 保存后的候选Tag就是它的触发Tag
+	// After a save the candidate tags are exactly its trigger tags
+	for (TPair<FName, TSet<FSoftObjectPath>>& Pair : AssetsByTag)
+	{
+		Pair.Value.Remove(AssetPath);
+	}
+	for (const FAbilityTriggerData& Trigger : Triggers)
+	{
+		if (Trigger.TriggerTag.IsValid())
+		{
+			AssetsByTag.FindOrAdd(Trigger.TriggerTag.GetTagName()).Add(AssetPath);
+		}
+	}
+
+	FAssetTriggers& Cached = TriggersByAsset.FindOrAdd(AssetPath);
+	Cached.Asset = Asset;
+	Cached.Triggers = MoveTemp(Triggers);
+}
+
+void FGASTagTriggerIndex::RemoveAsset(const FSoftObjectPath& AssetPath)
+{
+	for (TPair<FName, TSet<FSoftObjectPath>>& Pair : AssetsByTag)
+	{
+		Pair.Value.Remove(AssetPath);
+	}
+	TriggersByAsset.Remove(AssetPath);
+}
+
+void FGASTagTriggerIndex::HandlePackageSaved(const FString& /*PackageFilename*/, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+	if (!Package || SaveContext.IsProceduralSave())
+	{
+		return;
+	}
+
+	ForEachObjectWithPackage(Package, [this](UObject* Object)
+	{
+		TArray<FAbilityTriggerData> Triggers;
+		if (Object->IsAsset() && ReadTriggers(Object, Triggers))
+		{
+			const FSoftObjectPath AssetPath(Object);
+			if (PendingResult.IsValid())
+			{
+				PendingUpdates.Add(AssetPath);
+			}
+			else if (bReady)
+			{
+				UpdateAsset(AssetPath, Object);
+			}
+		}
+		return true;
+	}, false);
+}
+
+void FGASTagTriggerIndex::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	const FSoftObjectPath OldPath(OldObjectPath);
+	const FSoftObjectPath NewPath = AssetData.GetSoftObjectPath();
+	if (PendingResult.IsValid())
+	{
+		PendingUpdates.Add(OldPath);
+		PendingUpdates.Add(NewPath);
+		return;
+	}
+
+	if (!bReady)
+	{
+		return;
+	}
+
+	RemoveAsset(OldPath);
+	if (UObject* Asset = NewPath.ResolveObject())
+	{
+		UpdateAsset(NewPath, Asset);
+	}
+}
+
+void FGASTagTriggerIndex::HandleAssetRemoved(const FAssetData& AssetData)
+{
+	const FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+	if (PendingResult.IsValid())
+	{
+		PendingUpdates.Add(AssetPath);
+	}
+	else if (bReady)
+	{
+		RemoveAsset(AssetPath);
+	}
+}
+#endif
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITOR
+#include "Abilities/GameplayAbilityTypes.h"
+#include "GameplayTagContainer.h"
+#include "Tasks/Task.h"
+#include "UObject/SoftObjectPath.h"
+
+struct FAssetData;
+class IAssetRegistry;
+class UPackage;
+class FObjectPostSaveContext;
+
+// Tag → 引用它的技能蓝图索引（Tag查询器用）
+// - 后台任务从资源注册表建立：只看技能蓝图，候选Tag来自包的 SearchableName 依赖，不加载任何资源
+// - 查询时只解析候选资源的 AbilityTriggers，结果按资源缓存，后续查询不再加载
+// - 资源保存 / 重命名 / 删除时增量更新
+// Tag → referencing ability blueprints index (for the tag look-up tool)
+// - Built by a background task from the asset registry: ability blueprints only, candidate tags come from each
+//   package's SearchableName dependencies, nothing is loaded
+// - Queries only resolve the candidates' AbilityTriggers and cache them per asset, later queries load nothing
+// - Updated incrementally when an asset is saved, renamed or removed
+class FGASTagTriggerIndex
+{
+public:
+	// 技能蓝图和它的一个触发器
+	// An ability blueprint and one of its triggers
+	struct FTriggerEntry
+	{
+		UObject* Asset = nullptr;
+
+		FAbilityTriggerData Trigger;
+	};
+
+	static FGASTagTriggerIndex& Get();
+
+	// 绑定注册表 / 保存事件，注册表加载完后开始后台建立索引
+	// Bind the registry / save events and start the background build once the registry has loaded
+	void Initialize();
+
+	void Shutdown();
+
+	// 后台建立完成（未完成时查询为空）
+	// The background build has finished (queries are empty until then)
+	bool IsReady();
+
+	// 触发Tag与 Tags 匹配（HasTag）的所有触发器
+	// Every trigger whose tag matches Tags (HasTag)
+	void FindTriggers(const FGameplayTagContainer& Tags, TArray<FTriggerEntry>& OutEntries);
+
+private:
+	struct FBuildResult
+	{
+		TMap<FName, TSet<FSoftObjectPath>> AssetsByTag;
+	};
+
+	struct FAssetTriggers
+	{
+		TWeakObjectPtr<UObject> Asset;
+
+		TArray<FAbilityTriggerData> Triggers;
+	};
+
+	void StartBuild();
+
+	static void Build(IAssetRegistry& AssetRegistry, FBuildResult& Result);
+
+	// 把完成的后台结果换进来，再重放建立期间的增量更新
+	// Swap in a finished build, then replay the incremental updates made while it ran
+	void CollectBuild();
+
+	// 已加载资源的触发器（读CDO的 AbilityTriggers）
+	// Triggers of a loaded asset (reads the CDO's AbilityTriggers)
+	static bool ReadTriggers(UObject* Asset, TArray<FAbilityTriggerData>& OutTriggers);
+
+	const FAssetTriggers* ResolveTriggers(const FSoftObjectPath& AssetPath);
+
+	// 用已加载资源的触发器重建它的索引项
+	// Re-index one asset from its loaded triggers
+	void UpdateAsset(const FSoftObjectPath& AssetPath, UObject* Asset);
+
+	void RemoveAsset(const FSoftObjectPath& AssetPath);
+
+	void HandlePackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext SaveContext);
+
+	void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	void HandleAssetRemoved(const FAssetData& AssetData);
+
+private:
+	TMap<FName, TSet<FSoftObjectPath>> AssetsByTag;
+
+	TMap<FSoftObjectPath, FAssetTriggers> TriggersByAsset;
+
+	UE::Tasks::FTask PendingBuild;
+
+	TSharedPtr<FBuildResult> PendingResult;
+
+	// 建立期间保存过的资源（完成后重放）
+	// Assets saved while the build ran (replayed when it finishes)
+	TSet<FSoftObjectPath> PendingUpdates;
+
+	bool bReady = false;
+
+	FDelegateHandle FilesLoadedHandle;
+	FDelegateHandle RenamedHandle;
+	FDelegateHandle RemovedHandle;
+	FDelegateHandle SavedHandle;
+};
+#endif
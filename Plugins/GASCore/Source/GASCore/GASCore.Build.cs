@@ -35,7 +35,9 @@ public class GASCore : ModuleRules
 				"PropertyEditor",
 				"KismetCompiler",
 				"BlueprintGraph",
-				"AIModule" // For AI integration
+				"AIModule", // For AI integration
+				"Sockets", // For the ASC snapshot stream
+				"Networking"
 			}
 		);
 		
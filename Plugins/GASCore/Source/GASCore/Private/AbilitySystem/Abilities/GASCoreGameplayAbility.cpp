@@ -3,46 +3,93 @@
 
 #include "AbilitySystem/Abilities/GASCoreGameplayAbility.h"
 
+#include "AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
 #include "Actors/GASCoreSpawnedActorByGameplayAbility.h"
 #include "Interfaces/GASCoreCombatInterface.h"
+#include "Utilities/GASCoreFrameBudget.h"
 
 void UGASCoreGameplayAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
                                               const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo,
                                               const FGameplayEventData* TriggerEventData)
 {
+	GASCORE_FRAME_BUDGET_SCOPE(AbilityActivation);
+	// Before Super: Blueprint activation may end the ability right away.
+	if (UGASCoreAbilitySystemComponent* CoreASC = ActorInfo ? Cast<UGASCoreAbilitySystemComponent>(ActorInfo->AbilitySystemComponent.Get()) : nullptr)
+	{
+		CoreASC->NotifyAbilityLatencyActivated(Handle, this, ActivationInfo);
+	}
+
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 }
 
-void UGASCoreGameplayAbility::SpawnActorFromGameplayAbility()
+void UGASCoreGameplayAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
+{
+	if (UGASCoreAbilitySystemComponent* CoreASC = ActorInfo ? Cast<UGASCoreAbilitySystemComponent>(ActorInfo->AbilitySystemComponent.Get()) : nullptr)
+	{
+		CoreASC->NotifyAbilityLatencyEnded(Handle, this);
+	}
+
+	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
+}
+
+void UGASCoreGameplayAbility::NotifyFirstGameplayCue()
+{
+	if (UGASCoreAbilitySystemComponent* CoreASC = Cast<UGASCoreAbilitySystemComponent>(GetAbilitySystemComponentFromActorInfo()))
+	{
+		CoreASC->NotifyAbilityLatencyCue(GetCurrentAbilitySpecHandle(), this);
+	}
+}
+
+bool UGASCoreGameplayAbility::GetSpawnActorTransform(FTransform& OutSpawnTransform, const bool bRequireAuthority) const
 {
 	const FGameplayAbilityActivationInfo GameplayAbilityActivationInfo = GetCurrentActivationInfo();
 	const bool bIsServer = HasAuthority(&GameplayAbilityActivationInfo);
-	if (!bIsServer) return;
+	if (!bIsServer && bRequireAuthority) return false;
 
-	if (!ensureAlwaysMsgf(SpawnActorClass != nullptr, TEXT("ProjectileActorClass is null on %s"), *GetName())) return;
+	if (!ensureAlwaysMsgf(SpawnActorClass != nullptr, TEXT("ProjectileActorClass is null on %s"), *GetName())) return false;
 
 	IGASCoreCombatInterface* CombatInterface = Cast<IGASCoreCombatInterface>(GetAvatarActorFromActorInfo());
-	if (CombatInterface)
+	if (!CombatInterface) return false;
+
+	// Along the avatar's facing, yaw only: top-down casts travel parallel to the ground.
+	const AActor* Avatar = GetAvatarActorFromActorInfo();
+	OutSpawnTransform = FTransform(FRotator(0.f, Avatar->GetActorRotation().Yaw, 0.f), CombatInterface->GetAbilitySpawnLocation());
+	return true;
+}
+
+FGameplayEffectSpecHandle UGASCoreGameplayAbility::MakeSpawnActorEffectSpec() const
+{
+	if (!SpawnActorEffectClass) return FGameplayEffectSpecHandle();
+	return MakeOutgoingGameplayEffectSpec(SpawnActorEffectClass, GetAbilityLevel());
+}
+
+void UGASCoreGameplayAbility::SpawnActorFromGameplayAbility()
+{
+	FTransform SpawnTransform;
+	if (GetSpawnActorTransform(SpawnTransform))
 	{
-		const FVector SpawnLocation = CombatInterface->GetAbilitySpawnLocation();
-
-		FTransform SpawnTransform;
-		SpawnTransform.SetLocation(SpawnLocation);
-		// TODO: Set the projectile rotation.
-
-		AActor* OwnerActor = GetOwningActorFromActorInfo();
-		APawn* InstigatorPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
-		
-		AGASCoreSpawnedActorByGameplayAbility* Projectile = GetWorld()->SpawnActorDeferred<AGASCoreSpawnedActorByGameplayAbility>(
-			SpawnActorClass,
-			SpawnTransform,
-			OwnerActor,
-			InstigatorPawn,
-			ESpawnActorCollisionHandlingMethod::AlwaysSpawn
-		);
-
-		// TODO: Give the projectile a gameplay effect spec for causing damage.
-		
-		Projectile->FinishSpawning(SpawnTransform);
+		SpawnActorWithPayload(SpawnTransform, MakeSpawnActorEffectSpec());
 	}
 }
+
+AGASCoreSpawnedActorByGameplayAbility* UGASCoreGameplayAbility::SpawnActorWithPayload(const FTransform& SpawnTransform,
+	const FGameplayEffectSpecHandle& EffectSpecHandle)
+{
+	AActor* OwnerActor = GetOwningActorFromActorInfo();
+	APawn* InstigatorPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
+	
+	AGASCoreSpawnedActorByGameplayAbility* Projectile = GetWorld()->SpawnActorDeferred<AGASCoreSpawnedActorByGameplayAbility>(
+		SpawnActorClass,
+		SpawnTransform,
+		OwnerActor,
+		InstigatorPawn,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+	);
+	if (!Projectile) return nullptr;
+
+	Projectile->EffectSpecHandle = EffectSpecHandle;
+	
+	Projectile->FinishSpawning(SpawnTransform);
+	return Projectile;
+}
@@ -3,8 +3,35 @@
 
 #include "AbilitySystem/Abilities/GASCoreProjectileAbility.h"
 
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
+#include "AbilitySystem/Effects/GASCoreEffectBatch.h"
 #include "Actors/GASCoreSpawnedActorByGameplayAbility.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/ProjectileMovementComponent.h"
 #include "Interfaces/GASCoreCombatInterface.h"
+#include "Subsystems/GASCoreLagCompensationSubsystem.h"
+#include "Subsystems/GASCoreProjectilePoolSubsystem.h"
+
+UGASCoreProjectileAbility::UGASCoreProjectileAbility()
+{
+	// Casts activate, send their target data and often end in one frame.
+	bBatchServerRPCs = true;
+}
+
+void UGASCoreProjectileAbility::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	Super::OnGiveAbility(ActorInfo, Spec);
+
+	if (PoolPrewarmCount > 0 && SpawnActorClass && ActorInfo && ActorInfo->IsNetAuthority())
+	{
+		if (UGASCoreProjectilePoolSubsystem* Pool = UGASCoreProjectilePoolSubsystem::Get(ActorInfo->OwnerActor.Get()))
+		{
+			Pool->PrewarmProjectiles(SpawnActorClass, PoolPrewarmCount);
+		}
+	}
+}
 
 void UGASCoreProjectileAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
                                                 const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo,
@@ -15,5 +42,182 @@ void UGASCoreProjectileAbility::ActivateAbility(const FGameplayAbilitySpecHandle
 
 void UGASCoreProjectileAbility::SpawnActorFromGameplayAbility()
 {
-	Super::SpawnActorFromGameplayAbility();
+	const FGameplayAbilityActivationInfo ActivationInfo = GetCurrentActivationInfo();
+	const bool bAuthority = HasAuthority(&ActivationInfo);
+	const bool bPredictLocally = bClientPredictedProjectiles && !bAuthority && IsLocallyControlled();
+	const bool bRemotelyPredicted = bClientPredictedProjectiles && bAuthority && !IsLocallyControlled();
+
+	FTransform SpawnTransform;
+	if (!GetSpawnActorTransform(SpawnTransform, /*bRequireAuthority=*/!bPredictLocally)) return;
+
+	TArray<FTransform, TInlineAllocator<16>> Transforms;
+	ComputeSpreadTransforms(SpawnTransform, Transforms);
+
+	// Predicting client: local-only projectiles that report their hits to the server.
+	if (bPredictLocally)
+	{
+		UGASCoreAbilitySystemComponent* ASC = Cast<UGASCoreAbilitySystemComponent>(GetAbilitySystemComponentFromActorInfo());
+		for (const FTransform& Transform : Transforms)
+		{
+			if (AGASCoreSpawnedActorByGameplayAbility* Projectile = SpawnActorWithPayload(Transform, FGameplayEffectSpecHandle()))
+			{
+				Projectile->InitLocalPrediction(ASC, GetCurrentAbilitySpecHandle());
+			}
+		}
+		return;
+	}
+
+	// Fired by a predicting client: replicated copies for everyone else, without payload (the reported hits apply it)
+	// and never pooled, so the instigator's connection (which shows its own copy) has no channel to a reused actor.
+	if (bRemotelyPredicted)
+	{
+		// What the client's reports are checked against: the class's flight at the transforms the server computed.
+		AGASCoreSpawnedActorByGameplayAbility* ProjectileCDO = SpawnActorClass->GetDefaultObject<AGASCoreSpawnedActorByGameplayAbility>();
+		const UProjectileMovementComponent* Movement = ProjectileCDO->GetProjectileMovementComponent();
+		const UGASCoreLagCompensationSubsystem* LagCompensation = UGASCoreLagCompensationSubsystem::Get(GetWorld());
+		FGASCoreProjectileShot Shot;
+		Shot.Speed = Movement ? FMath::Max(Movement->InitialSpeed, Movement->MaxSpeed) : 0.f;
+		Shot.CollisionRadius = ProjectileCDO->GetCollisionRadius();
+		Shot.bStraightFlight = !ProjectileCDO->bHoming && (!Movement || Movement->ProjectileGravityScale == 0.f);
+		Shot.ServerTime = LagCompensation ? LagCompensation->GetServerTime() : GetWorld()->GetTimeSeconds();
+
+		for (const FTransform& Transform : Transforms)
+		{
+			if (AGASCoreSpawnedActorByGameplayAbility* Projectile = SpawnActorWithPayload(Transform, FGameplayEffectSpecHandle()))
+			{
+				Projectile->SetPredictedByInstigator(true);
+			}
+			Shot.Origin = Transform.GetLocation();
+			Shot.Direction = Transform.GetRotation().Vector();
+			PredictedShots.Add(Shot);
+		}
+		return;
+	}
+
+	// One spec per volley: every projectile of the activation applies the same snapshot.
+	const FGameplayEffectSpecHandle EffectSpecHandle = MakeSpawnActorEffectSpec();
+
+	UGASCoreProjectilePoolSubsystem* Pool = UGASCoreProjectilePoolSubsystem::Get(GetAvatarActorFromActorInfo());
+	if (!Pool)
+	{
+		for (const FTransform& Transform : Transforms)
+		{
+			SpawnActorWithPayload(Transform, EffectSpecHandle);
+		}
+		return;
+	}
+
+	TArray<AGASCoreSpawnedActorByGameplayAbility*> Projectiles;
+	Pool->AcquireProjectiles(SpawnActorClass, Transforms, GetOwningActorFromActorInfo(),
+		Cast<APawn>(GetAvatarActorFromActorInfo()), Projectiles);
+	for (AGASCoreSpawnedActorByGameplayAbility* Projectile : Projectiles)
+	{
+		Projectile->EffectSpecHandle = EffectSpecHandle;
+	}
+}
+
+void UGASCoreProjectileAbility::HandleReportedHit(const FGASCoreProjectileHitReport& Report)
+{
+	const UWorld* World = GetWorld();
+	const UGASCoreLagCompensationSubsystem* LagCompensation = UGASCoreLagCompensationSubsystem::Get(World);
+	const AGASCoreSpawnedActorByGameplayAbility* ProjectileCDO = SpawnActorClass ? SpawnActorClass->GetDefaultObject<AGASCoreSpawnedActorByGameplayAbility>() : nullptr;
+	if (!bClientPredictedProjectiles || !LagCompensation || !ProjectileCDO) return;
+
+	// Shots expire once their projectile would be gone.
+	const float LifeSpan = ProjectileCDO->InitialLifeSpan > 0.f ? ProjectileCDO->InitialLifeSpan : 5.f;
+	const double OldestShot = LagCompensation->GetServerTime() - LifeSpan - 0.5;
+	PredictedShots.RemoveAll([OldestShot](const FGASCoreProjectileShot& Shot) { return Shot.ServerTime < OldestShot; });
+
+	// Ability targets are checked on their rewound capsule; other impacts only count as the centre of a splash.
+	AActor* Target = Report.Target;
+	const bool bAbilityTarget = IsValid(Target) && UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Target);
+	if (!bAbilityTarget && ProjectileCDO->ImpactRadius <= 0.f) return;
+
+	const int32 ShotIndex = PredictedShots.IndexOfByPredicate([&](const FGASCoreProjectileShot& Shot)
+	{
+		if (bAbilityTarget)
+		{
+			return !Shot.HitActors.Contains(Target) && LagCompensation->ValidateHit(Report, Shot);
+		}
+		return LagCompensation->ValidateShotPath(Report, Shot);
+	});
+	if (ShotIndex == INDEX_NONE) return;
+
+	// A piercing shot flies on through ability targets (each once); any other hit ended it.
+	if (ProjectileCDO->bPierceTargets && bAbilityTarget)
+	{
+		PredictedShots[ShotIndex].HitActors.Add(Target);
+	}
+	else
+	{
+		PredictedShots.RemoveAt(ShotIndex, 1, EAllowShrinking::No);
+	}
+
+	// Splash around the validated impact uses current locations (only the reported target is rewound).
+	const FGameplayEffectSpecHandle Spec = MakeSpawnActorEffectSpec();
+	TArray<AActor*, TInlineAllocator<16>> Targets;
+	if (ProjectileCDO->ImpactRadius > 0.f)
+	{
+		ProjectileCDO->GatherImpactRadiusTargets(World, Report.ImpactPoint, GetOwningActorFromActorInfo(),
+			GetAvatarActorFromActorInfo(), Targets);
+	}
+	else
+	{
+		Targets.Add(Target);
+	}
+	FGASCoreEffectBatch::ApplySpecToTargets(Spec, Targets);
+
+	if (ProjectileCDO->ImpactRadius > 0.f)
+	{
+		ProjectileCDO->ApplyImpactRadiusToNonActorTargets(World, Report.ImpactPoint, Spec);
+	}
+}
+
+void UGASCoreProjectileAbility::ComputeSpreadTransforms(const FTransform& SpawnTransform,
+	TArray<FTransform, TInlineAllocator<16>>& OutTransforms) const
+{
+	const int32 Count = SpreadMode == EGASCoreProjectileSpreadMode::Single ? 1 : FMath::Max(SpreadCount, 1);
+	OutTransforms.Reserve(Count);
+
+	const FVector Origin = SpawnTransform.GetLocation();
+	const FRotator BaseRotation = SpawnTransform.Rotator();
+
+	switch (SpreadMode)
+	{
+	case EGASCoreProjectileSpreadMode::Fan:
+	{
+		// Evenly spaced, edges included; a full circle would put the first and last on top of each other.
+		const float Width = FMath::Clamp(SpreadAngle, 0.f, 360.f);
+		const float Step = Count > 1 ? (Width >= 360.f ? Width / Count : Width / (Count - 1)) : 0.f;
+		const float FirstYaw = Count > 1 ? -Step * (Count - 1) * 0.5f : 0.f;
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const FRotator Rotation(BaseRotation.Pitch, BaseRotation.Yaw + FirstYaw + Step * Index, BaseRotation.Roll);
+			OutTransforms.Emplace(Rotation, Origin, SpawnTransform.GetScale3D());
+		}
+		break;
+	}
+	case EGASCoreProjectileSpreadMode::Rain:
+	{
+		const FVector Forward2D = FRotator(0.f, BaseRotation.Yaw, 0.f).Vector();
+		const FVector DiscCentre = Origin + Forward2D * RainDistance;
+		// Seeded by the activation's prediction key, so a predicting client and the server drop the same volley.
+		const FPredictionKey& PredictionKey = GetCurrentActivationInfo().GetActivationPredictionKey();
+		FRandomStream Stream(PredictionKey.IsValidKey() ? PredictionKey.Current : FMath::Rand());
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			// Uniform over the disc (sqrt keeps the centre from clustering).
+			const float Angle = Stream.FRandRange(0.f, UE_TWO_PI);
+			const float Radius = RainRadius * FMath::Sqrt(Stream.FRand());
+			const FVector Landing = DiscCentre + FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.f);
+			const FVector Start = Landing + FVector(0.f, 0.f, RainHeight);
+			OutTransforms.Emplace((Landing - Start).Rotation(), Start, SpawnTransform.GetScale3D());
+		}
+		break;
+	}
+	case EGASCoreProjectileSpreadMode::Single:
+	default:
+		OutTransforms.Add(SpawnTransform);
+		break;
+	}
 }
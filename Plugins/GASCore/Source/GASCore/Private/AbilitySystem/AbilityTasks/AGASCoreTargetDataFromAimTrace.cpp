@@ -6,14 +6,141 @@
 
 #include "AbilitySystem/AbilityTasks/GASCoreTargetDataFromAimTrace.h"
 
+#include "AbilitySystemComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Interfaces/GASCoreCursorHitInterface.h"
+
+TArray<TWeakObjectPtr<AActor>> FGASCoreTargetData_AimPoint::GetActors() const
+{
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	if (HitActor.IsValid())
+	{
+		Actors.Add(HitActor);
+	}
+	return Actors;
+}
+
+FString FGASCoreTargetData_AimPoint::ToString() const
+{
+	return FString::Printf(TEXT("FGASCoreTargetData_AimPoint (%s, %s)"), *ImpactPoint.ToString(), *GetNameSafe(HitActor.Get()));
+}
+
+bool FGASCoreTargetData_AimPoint::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+	ImpactPoint.NetSerialize(Ar, Map, bOutSuccess);
+
+	// One bit when nothing was hit; otherwise the actor's net GUID.
+	uint8 bHasActor = Ar.IsSaving() && HitActor.IsValid() ? 1 : 0;
+	Ar.SerializeBits(&bHasActor, 1);
+	if (bHasActor)
+	{
+		UObject* Actor = HitActor.Get();
+		bOutSuccess &= Map->SerializeObject(Ar, AActor::StaticClass(), Actor);
+		if (Ar.IsLoading())
+		{
+			HitActor = Cast<AActor>(Actor);
+		}
+	}
+	else if (Ar.IsLoading())
+	{
+		HitActor.Reset();
+	}
+	return true;
+}
+
 UGASCoreTargetDataFromAimTrace* UGASCoreTargetDataFromAimTrace::CreateTargetDataFromAimTrace(
-	UGameplayAbility* OwningAbility)
+	UGameplayAbility* OwningAbility, const TEnumAsByte<ECollisionChannel> TraceChannel)
 {
 	UGASCoreTargetDataFromAimTrace* MyObj = NewAbilityTask<UGASCoreTargetDataFromAimTrace>(OwningAbility);
+	MyObj->TraceChannel = TraceChannel;
 	return MyObj;
 }
 
 void UGASCoreTargetDataFromAimTrace::Activate()
 {
-	
+	const FGameplayAbilityActorInfo* ActorInfo = Ability ? Ability->GetCurrentActorInfo() : nullptr;
+	if (!ActorInfo || !AbilitySystemComponent.IsValid())
+	{
+		EndTask();
+		return;
+	}
+
+	if (ActorInfo->IsLocallyControlled())
+	{
+		SendAimTraceData();
+		return;
+	}
+
+	// Server: the data may have arrived before the task (it is kept per spec + activation key).
+	const FGameplayAbilitySpecHandle SpecHandle = GetAbilitySpecHandle();
+	const FPredictionKey ActivationPredictionKey = GetActivationPredictionKey();
+	TargetDataDelegateHandle = AbilitySystemComponent->AbilityTargetDataSetDelegate(SpecHandle, ActivationPredictionKey)
+		.AddUObject(this, &UGASCoreTargetDataFromAimTrace::OnTargetDataReplicatedCallback);
+	if (!AbilitySystemComponent->CallReplicatedTargetDataDelegatesIfSet(SpecHandle, ActivationPredictionKey))
+	{
+		SetWaitingOnRemotePlayerData();
+	}
+}
+
+void UGASCoreTargetDataFromAimTrace::OnDestroy(const bool bInOwnerFinished)
+{
+	if (TargetDataDelegateHandle.IsValid() && AbilitySystemComponent.IsValid())
+	{
+		AbilitySystemComponent->AbilityTargetDataSetDelegate(GetAbilitySpecHandle(), GetActivationPredictionKey())
+			.Remove(TargetDataDelegateHandle);
+	}
+
+	Super::OnDestroy(bInOwnerFinished);
+}
+
+void UGASCoreTargetDataFromAimTrace::SendAimTraceData()
+{
+	FScopedPredictionWindow ScopedPrediction(AbilitySystemComponent.Get());
+
+	// Reuse the frame's shared cursor trace when the controller provides one.
+	APlayerController* PlayerController = Ability->GetCurrentActorInfo()->PlayerController.Get();
+	FHitResult CursorHit;
+	if (IGASCoreCursorHitInterface* CursorHits = Cast<IGASCoreCursorHitInterface>(PlayerController))
+	{
+		CursorHits->GetAbilityCursorHit(TraceChannel, CursorHit);
+	}
+	else if (PlayerController)
+	{
+		PlayerController->GetHitResultUnderCursor(TraceChannel, false, CursorHit);
+	}
+
+	FGASCoreTargetData_AimPoint* Data = new FGASCoreTargetData_AimPoint();
+	Data->ImpactPoint = CursorHit.bBlockingHit ? CursorHit.ImpactPoint : CursorHit.TraceEnd;
+	Data->HitActor = CursorHit.GetActor();
+	const FGameplayAbilityTargetDataHandle DataHandle(Data);
+
+	AbilitySystemComponent->ServerSetReplicatedTargetData(GetAbilitySpecHandle(), GetActivationPredictionKey(), DataHandle,
+		FGameplayTag(), AbilitySystemComponent->ScopedPredictionKey);
+
+	BroadcastTargetData(DataHandle);
+}
+
+void UGASCoreTargetDataFromAimTrace::OnTargetDataReplicatedCallback(const FGameplayAbilityTargetDataHandle& DataHandle,
+	FGameplayTag ActivationTag)
+{
+	AbilitySystemComponent->ConsumeClientReplicatedTargetData(GetAbilitySpecHandle(), GetActivationPredictionKey());
+	BroadcastTargetData(DataHandle);
+}
+
+void UGASCoreTargetDataFromAimTrace::BroadcastTargetData(const FGameplayAbilityTargetDataHandle& DataHandle)
+{
+	if (!ShouldBroadcastAbilityTaskDelegates())
+	{
+		return;
+	}
+
+	ValidData.Broadcast(DataHandle);
+
+	if (const FGameplayAbilityTargetData* Data = DataHandle.Get(0))
+	{
+		const TArray<TWeakObjectPtr<AActor>> Actors = Data->GetActors();
+		const FHitResult Hit(Actors.IsEmpty() ? nullptr : Actors[0].Get(), nullptr, Data->GetEndPoint(), FVector::UpVector);
+		ValidHitResultData.Broadcast(Hit);
+	}
 }
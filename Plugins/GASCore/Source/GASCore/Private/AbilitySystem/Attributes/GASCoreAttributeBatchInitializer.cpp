@@ -0,0 +1,120 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/Attributes/GASCoreAttributeBatchInitializer.h"
+
+#include "AbilitySystem/Attributes/GASCoreAttributeMetadata.h"
+#include "AbilitySystem/Attributes/GASCoreAttributeSet.h"
+
+void FGASCoreAttributeBatchInitializer::Add(UGASCoreAttributeSet* Set, const UGASCoreAttributeArchetypeDataAsset* Archetype,
+	const int32 Level, const bool bEvaluateDerivedAttributes)
+{
+	if (IsValid(Set))
+	{
+		Entries.Add({ Set, Archetype, Level, bEvaluateDerivedAttributes });
+	}
+}
+
+void FGASCoreAttributeBatchInitializer::Execute(const FGASCoreFormulaCoefficients& Coefficients)
+{
+	// Move out first: writes below fire attribute callbacks that may queue more sets (next batch).
+	TArray<FEntry> Work = MoveTemp(Entries);
+	Entries.Reset();
+
+	// Group by class table; order within a class is kept.
+	TMap<const FGASCoreAttributeMetadata*, TArray<int32>> Groups;
+	for (int32 Index = 0; Index < Work.Num(); ++Index)
+	{
+		const UGASCoreAttributeSet* Set = Work[Index].Set.Get();
+		// Deferred initial replication: clients reproduce the server's initialization instead of receiving it.
+		const AActor* OwningActor = Set ? Set->GetOwningActor() : nullptr;
+		if (OwningActor && (OwningActor->HasAuthority() || Set->IsInitialReplicationDeferred()))
+		{
+			Groups.FindOrAdd(&Set->GetAttributeMetadata()).Add(Index);
+		}
+	}
+
+	TArray<UGASCoreAttributeSet*> Sets;
+	TArray<const FEntry*> GroupEntries;
+	for (const TPair<const FGASCoreAttributeMetadata*, TArray<int32>>& Group : Groups)
+	{
+		Sets.Reset();
+		GroupEntries.Reset();
+		for (const int32 Index : Group.Value)
+		{
+			Sets.Add(Work[Index].Set.Get());
+			GroupEntries.Add(&Work[Index]);
+		}
+		ExecuteGroup(Sets, GroupEntries, Coefficients);
+	}
+}
+
+void FGASCoreAttributeBatchInitializer::ExecuteGroup(const TConstArrayView<UGASCoreAttributeSet*> Sets,
+	const TConstArrayView<const FEntry*> GroupEntries, const FGASCoreFormulaCoefficients& Coefficients)
+{
+	const FGASCoreAttributeMetadata& Metadata = Sets[0]->GetAttributeMetadata();
+
+	if (!Metadata.HasFormulaBindings())
+	{
+		// No native formula bindings: per-set path (the derived graph recomputes at end of frame).
+		for (int32 Index = 0; Index < Sets.Num(); ++Index)
+		{
+			Sets[Index]->SetEvaluateDerivedAttributes(GroupEntries[Index]->bEvaluateDerivedAttributes);
+			Sets[Index]->InitializeFromArchetype(GroupEntries[Index]->Archetype.Get(), GroupEntries[Index]->Level);
+		}
+		return;
+	}
+
+	// 1) Archetype base values.
+	for (int32 Index = 0; Index < Sets.Num(); ++Index)
+	{
+		Sets[Index]->InitializeFromArchetype(GroupEntries[Index]->Archetype.Get(), GroupEntries[Index]->Level);
+	}
+
+	// 2) Gather primaries (SoA). Unbound inputs stay zero.
+	Batch.Reset(Sets.Num());
+	for (int32 Input = 0; Input < GASCoreFormulas::NumPrimaryInputs; ++Input)
+	{
+		const int32 Ordinal = Metadata.FormulaInputOrdinals[Input];
+		if (Ordinal == INDEX_NONE)
+		{
+			continue;
+		}
+		float* Values = Batch.Primaries[Input].GetData();
+		for (int32 Index = 0; Index < Sets.Num(); ++Index)
+		{
+			Values[Index] = Sets[Index]->GetAttributeDataAt(Ordinal).GetCurrentValue();
+		}
+	}
+
+	// 3) Every secondary for every actor.
+	GASCoreFormulas::EvaluateAllBatch(Batch, Coefficients);
+
+	// 4) Base values (Maxes first, FormulaOutputs order), then vitals filled to Max.
+	for (int32 Index = 0; Index < Sets.Num(); ++Index)
+	{
+		UGASCoreAttributeSet* Set = Sets[Index];
+
+		// Part of the initialization: no divergence, and deferred attributes stay deferred.
+		TGuardValue<bool> ApplyingGuard(Set->bApplyingArchetype, true);
+		for (const TPair<EGASCoreSecondaryFormula, int32>& Output : Metadata.FormulaOutputs)
+		{
+			const float NewBase = Metadata.Quantizers[Output.Value].Quantize(Batch.GetSecondary(Output.Key, Index));
+			if (NewBase != Set->GetAttributeDataAt(Output.Value).GetBaseValue() && Set->ShouldWriteInitialValue(Output.Value))
+			{
+				Set->SetCurrentNumeric(Metadata.Attributes[Output.Value], NewBase);
+			}
+
+			const int32 CurrentOrdinal = Metadata.CurrentOrdinals[Output.Value];
+			if (CurrentOrdinal != INDEX_NONE && Set->ShouldWriteInitialValue(CurrentOrdinal))
+			{
+				Set->SetCurrentNumeric(Metadata.Attributes[CurrentOrdinal], Set->GetAttributeDataAt(Output.Value).GetCurrentValue());
+			}
+		}
+
+		// Already evaluated: enable the graph without marking everything stale.
+		if (GroupEntries[Index]->bEvaluateDerivedAttributes)
+		{
+			Set->SetEvaluateDerivedAttributes(true, /*bRecompute=*/false);
+		}
+	}
+}
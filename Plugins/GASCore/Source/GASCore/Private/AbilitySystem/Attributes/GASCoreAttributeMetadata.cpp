@@ -0,0 +1,524 @@
+// © 2025 Heathrow (Derman). All rights reserved.
+// This project is the intellectual property of Heathrow (Derman) and is protected by copyright law.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+//
+// File: GASCoreAttributeMetadata.cpp (implementation)
+// Purpose:
+//   - Build and cache the per-class attribute tables declared in GASCoreAttributeMetadata.h.
+//
+// Implementation notes:
+//   - Tables are keyed by UClass and owned by a process-wide registry; each table is built exactly once.
+//   - Building may happen off the game thread (async loading constructs attribute sets), so the registry is locked.
+//     Instances cache the returned pointer, so the lock is only taken on a set's first lookup.
+
+#include "AbilitySystem/Attributes/GASCoreAttributeMetadata.h"
+
+#include "AbilitySystem/Attributes/GASCoreAttributeSet.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Tasks/Task.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UnrealType.h"
+#include "Utilities/GASCoreLogging.h"
+
+namespace GASCoreAttributeMetadata
+{
+	/** Process-wide class → table registry. Tables are heap-allocated so their addresses stay stable. */
+	struct FRegistry
+	{
+		FCriticalSection Lock;
+		TMap<TObjectKey<UClass>, TUniquePtr<FGASCoreAttributeMetadata>> Tables;
+	};
+
+	static FRegistry& GetRegistry()
+	{
+		static FRegistry Registry;
+		return Registry;
+	}
+}
+
+const FGASCoreAttributeMetadata& FGASCoreAttributeMetadata::Get(const UGASCoreAttributeSet* Set)
+{
+	check(Set);
+	UClass* Class = Set->GetClass();
+
+	GASCoreAttributeMetadata::FRegistry& Registry = GASCoreAttributeMetadata::GetRegistry();
+	FScopeLock ScopeLock(&Registry.Lock);
+
+	if (const TUniquePtr<FGASCoreAttributeMetadata>* Existing = Registry.Tables.Find(Class))
+	{
+		return **Existing;
+	}
+
+	TUniquePtr<FGASCoreAttributeMetadata> Metadata = MakeUnique<FGASCoreAttributeMetadata>();
+	const UGASCoreAttributeSet* CDO = Class->GetDefaultObject<UGASCoreAttributeSet>();
+
+	// Ordinals: every FGameplayAttributeData property, super class first.
+	for (TFieldIterator<FStructProperty> It(Class, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		FStructProperty* Property = *It;
+		if (FGameplayAttribute::IsGameplayAttributeDataProperty(Property))
+		{
+			Metadata->Properties.Add(Property);
+			Metadata->Attributes.Add(FGameplayAttribute(Property));
+			Metadata->Offsets.Add(Property->GetOffset_ForInternal());
+			Metadata->FixedPoint.Add(Property->Struct->IsChildOf(FGASCoreFixedPointAttributeData::StaticStruct()));
+		}
+	}
+
+	const int32 NumAttributes = Metadata->Properties.Num();
+	check(NumAttributes <= MAX_int16);
+
+	// Offset → ordinal lookup (one slot per alignment unit of the class layout).
+	Metadata->SlotToOrdinal.Init(INDEX_NONE, Class->GetPropertiesSize() / SlotBytes + 1);
+	for (int32 Ordinal = 0; Ordinal < NumAttributes; ++Ordinal)
+	{
+		const int32 Slot = Metadata->Properties[Ordinal]->GetOffset_ForInternal() / SlotBytes;
+		check(Metadata->SlotToOrdinal[Slot] == INDEX_NONE);
+		Metadata->SlotToOrdinal[Slot] = static_cast<int16>(Ordinal);
+	}
+
+#if !UE_BUILD_SHIPPING
+	// Offsets must address exactly what reflection would (guards against layout surprises, e.g. static arrays).
+	for (int32 Ordinal = 0; Ordinal < NumAttributes; ++Ordinal)
+	{
+		const FStructProperty* Property = Metadata->Properties[Ordinal];
+		const uint8* ReflectedPtr = Property->ContainerPtrToValuePtr<uint8>(CDO);
+		const uint8* OffsetPtr = reinterpret_cast<const uint8*>(CDO) + Metadata->Offsets[Ordinal];
+		checkf(ReflectedPtr == OffsetPtr && Property->ArrayDim == 1,
+			TEXT("%s: cached offset for attribute %s does not match reflection."), *Class->GetName(), *Property->GetName());
+	}
+#endif
+
+	Metadata->Configure(CDO);
+
+	return *Registry.Tables.Add(Class, MoveTemp(Metadata));
+}
+
+SIZE_T FGASCoreAttributeMetadata::GetAllocatedSize() const
+{
+	SIZE_T Bytes = Attributes.GetAllocatedSize() + Properties.GetAllocatedSize() + Offsets.GetAllocatedSize()
+		+ FixedPoint.GetAllocatedSize() + MaxOrdinals.GetAllocatedSize() + CurrentOrdinals.GetAllocatedSize()
+		+ Quantizers.GetAllocatedSize() + ClampRanges.GetAllocatedSize() + Derivations.GetAllocatedSize()
+		+ DependentDerivations.GetAllocatedSize() + FormulaOutputs.GetAllocatedSize() + Regenerations.GetAllocatedSize()
+		+ MetaTargetOrdinals.GetAllocatedSize() + SlotToOrdinal.GetAllocatedSize();
+	for (const TArray<int32>& Dependents : DependentDerivations)
+	{
+		Bytes += Dependents.GetAllocatedSize();
+	}
+	return Bytes;
+}
+
+void FGASCoreAttributeMetadata::ForEachTable(const TFunctionRef<void(const UClass& Class, const FGASCoreAttributeMetadata& Metadata)> Visitor)
+{
+	GASCoreAttributeMetadata::FRegistry& Registry = GASCoreAttributeMetadata::GetRegistry();
+	FScopeLock ScopeLock(&Registry.Lock);
+	for (const TPair<TObjectKey<UClass>, TUniquePtr<FGASCoreAttributeMetadata>>& Pair : Registry.Tables)
+	{
+		if (const UClass* Class = Pair.Key.ResolveObjectPtr())
+		{
+			Visitor(*Class, *Pair.Value);
+		}
+	}
+}
+
+void FGASCoreAttributeMetadata::PrewarmAsync()
+{
+	check(IsInGameThread());
+	TRACE_CPUPROFILER_EVENT_SCOPE(FGASCoreAttributeMetadata::PrewarmAsync);
+
+	// CDOs are resolved here: creating a default object off the game thread is not safe. Blueprint sets are left to
+	// first use (their classes may not be loaded yet).
+	TArray<UClass*> Classes;
+	GetDerivedClasses(UGASCoreAttributeSet::StaticClass(), Classes, true);
+
+	TArray<const UGASCoreAttributeSet*> DefaultObjects;
+	for (UClass* Class : Classes)
+	{
+		if (Class->HasAnyClassFlags(CLASS_Native) && !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			DefaultObjects.Add(Class->GetDefaultObject<UGASCoreAttributeSet>());
+		}
+	}
+
+	if (DefaultObjects.IsEmpty())
+	{
+		return;
+	}
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [DefaultObjects = MoveTemp(DefaultObjects)]()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGASCoreAttributeMetadata::PrewarmTables);
+		for (const UGASCoreAttributeSet* CDO : DefaultObjects)
+		{
+			Get(CDO);
+		}
+	});
+}
+
+void FGASCoreAttributeMetadata::Configure(const UGASCoreAttributeSet* CDO)
+{
+	const int32 NumAttributes = Num();
+	MaxOrdinals.Init(INDEX_NONE, NumAttributes);
+	CurrentOrdinals.Init(INDEX_NONE, NumAttributes);
+	Quantizers.Init(FGASCoreAttributeQuantizer::Make(CDO->DefaultRoundingDecimals, false), NumAttributes);
+	ClampRanges.Init(FVector2f(-MAX_flt, MAX_flt), NumAttributes);
+	Derivations.Reset();
+	DependentDerivations.Reset();
+	DependentDerivations.SetNum(NumAttributes);
+	for (int32& InputOrdinal : FormulaInputOrdinals)
+	{
+		InputOrdinal = INDEX_NONE;
+	}
+	FormulaOutputs.Reset();
+	Regenerations.Reset();
+	MetaTargetOrdinals.Init(INDEX_NONE, NumAttributes);
+
+	// Class-specific pairs/precision/bounds/derivations, declared once on the CDO.
+	FGASCoreAttributeMetadataBuilder Builder(*this);
+	CDO->ConfigureAttributeMetadata(Builder);
+	Builder.FinalizeDerivations();
+
+	// Designer quantization entries (editable on the CDO) override code defaults.
+	for (const FGASCoreAttributeQuantization& Entry : CDO->AttributeQuantization)
+	{
+		const int32 Ordinal = GetOrdinal(Entry.Attribute);
+		if (Ordinal != INDEX_NONE)
+		{
+			Quantizers[Ordinal] = FGASCoreAttributeQuantizer::Make(Entry.Decimals, Entry.bIntegerStorage);
+		}
+	}
+}
+
+#if WITH_EDITOR
+void FGASCoreAttributeMetadata::RefreshFromDefaults(const UGASCoreAttributeSet* CDO)
+{
+	check(CDO);
+	GASCoreAttributeMetadata::FRegistry& Registry = GASCoreAttributeMetadata::GetRegistry();
+	FScopeLock ScopeLock(&Registry.Lock);
+
+	// Rebuilt in place: instances keep pointing at the same table.
+	if (const TUniquePtr<FGASCoreAttributeMetadata>* Existing = Registry.Tables.Find(CDO->GetClass()))
+	{
+		(*Existing)->Configure(CDO);
+	}
+}
+#endif
+
+void FGASCoreAttributeMetadataBuilder::RegisterCurrentMaxPair(const FGameplayAttribute& Current, const FGameplayAttribute& Max)
+{
+	const int32 CurrentOrdinal = Metadata.GetOrdinal(Current);
+	const int32 MaxOrdinal = Metadata.GetOrdinal(Max);
+	if (CurrentOrdinal == INDEX_NONE || MaxOrdinal == INDEX_NONE)
+	{
+		return;
+	}
+
+	Metadata.MaxOrdinals[CurrentOrdinal] = MaxOrdinal;
+	Metadata.CurrentOrdinals[MaxOrdinal] = CurrentOrdinal;
+
+	// Current ∈ [0, Max] (the upper bound is the live Max value, applied at clamp time).
+	Metadata.ClampRanges[CurrentOrdinal].X = 0.f;
+}
+
+void FGASCoreAttributeMetadataBuilder::SetRoundingDecimals(const FGameplayAttribute& Attribute, const int32 Decimals)
+{
+	const int32 Ordinal = Metadata.GetOrdinal(Attribute);
+	if (Ordinal != INDEX_NONE)
+	{
+		Metadata.Quantizers[Ordinal] = FGASCoreAttributeQuantizer::Make(Decimals, Metadata.Quantizers[Ordinal].bIntegerStorage);
+	}
+}
+
+void FGASCoreAttributeMetadataBuilder::SetIntegerStorage(const FGameplayAttribute& Attribute, const bool bIntegerStorage)
+{
+	const int32 Ordinal = Metadata.GetOrdinal(Attribute);
+	if (Ordinal != INDEX_NONE)
+	{
+		Metadata.Quantizers[Ordinal] = FGASCoreAttributeQuantizer::Make(Metadata.Quantizers[Ordinal].Decimals, bIntegerStorage);
+	}
+}
+
+void FGASCoreAttributeMetadataBuilder::SetClampRange(const FGameplayAttribute& Attribute, const float MinValue, const float MaxValue)
+{
+	const int32 Ordinal = Metadata.GetOrdinal(Attribute);
+	if (Ordinal != INDEX_NONE)
+	{
+		Metadata.ClampRanges[Ordinal] = FVector2f(MinValue, FMath::Max(MinValue, MaxValue));
+	}
+}
+
+void FGASCoreAttributeMetadataBuilder::DeclareDerivedAttribute(const FGameplayAttribute& Derived,
+	const TConstArrayView<FGameplayAttribute> Sources, const FGASCoreDerivedAttributeFormula Formula)
+{
+	const int32 Ordinal = Metadata.GetOrdinal(Derived);
+	if (Ordinal == INDEX_NONE || !ensure(Formula))
+	{
+		return;
+	}
+
+	FPendingDerivation& Pending = PendingDerivations.AddDefaulted_GetRef();
+	Pending.Ordinal = Ordinal;
+	Pending.Formula = Formula;
+	for (const FGameplayAttribute& Source : Sources)
+	{
+		const int32 SourceOrdinal = Metadata.GetOrdinal(Source);
+		if (SourceOrdinal != INDEX_NONE && SourceOrdinal != Ordinal)
+		{
+			Pending.SourceOrdinals.AddUnique(SourceOrdinal);
+		}
+	}
+}
+
+void FGASCoreAttributeMetadataBuilder::BindFormulaInputs(const FGameplayAttribute& Strength, const FGameplayAttribute& Dexterity,
+	const FGameplayAttribute& Intelligence, const FGameplayAttribute& Endurance, const FGameplayAttribute& Vigor)
+{
+	Metadata.FormulaInputOrdinals[GASCoreFormulas::Strength]     = Metadata.GetOrdinal(Strength);
+	Metadata.FormulaInputOrdinals[GASCoreFormulas::Dexterity]    = Metadata.GetOrdinal(Dexterity);
+	Metadata.FormulaInputOrdinals[GASCoreFormulas::Intelligence] = Metadata.GetOrdinal(Intelligence);
+	Metadata.FormulaInputOrdinals[GASCoreFormulas::Endurance]    = Metadata.GetOrdinal(Endurance);
+	Metadata.FormulaInputOrdinals[GASCoreFormulas::Vigor]        = Metadata.GetOrdinal(Vigor);
+}
+
+void FGASCoreAttributeMetadataBuilder::BindFormulaOutput(const EGASCoreSecondaryFormula Formula, const FGameplayAttribute& Attribute)
+{
+	const int32 Ordinal = Metadata.GetOrdinal(Attribute);
+	if (Ordinal == INDEX_NONE || Formula >= EGASCoreSecondaryFormula::Count)
+	{
+		return;
+	}
+
+	// Maxes first so Currents written afterwards (vitals fill) see the new bound.
+	const TPair<EGASCoreSecondaryFormula, int32> Output(Formula, Ordinal);
+	if (Metadata.CurrentOrdinals[Ordinal] != INDEX_NONE)
+	{
+		Metadata.FormulaOutputs.Insert(Output, 0);
+	}
+	else
+	{
+		Metadata.FormulaOutputs.Add(Output);
+	}
+}
+
+void FGASCoreAttributeMetadataBuilder::RegisterRegeneration(const FGameplayAttribute& Current, const FGameplayAttribute& Rate)
+{
+	const int32 CurrentOrdinal = Metadata.GetOrdinal(Current);
+	const int32 RateOrdinal = Metadata.GetOrdinal(Rate);
+	if (CurrentOrdinal == INDEX_NONE || RateOrdinal == INDEX_NONE || CurrentOrdinal == RateOrdinal)
+	{
+		return;
+	}
+
+	// One rate per Current (re-registering replaces it).
+	for (FGASCoreRegeneration& Regeneration : Metadata.Regenerations)
+	{
+		if (Regeneration.CurrentOrdinal == CurrentOrdinal)
+		{
+			Regeneration.RateOrdinal = RateOrdinal;
+			return;
+		}
+	}
+	Metadata.Regenerations.Add({ CurrentOrdinal, RateOrdinal });
+}
+
+void FGASCoreAttributeMetadataBuilder::RegisterIncomingDamage(const FGameplayAttribute& Meta, const FGameplayAttribute& Target)
+{
+	const int32 MetaOrdinal = Metadata.GetOrdinal(Meta);
+	const int32 TargetOrdinal = Metadata.GetOrdinal(Target);
+	if (MetaOrdinal != INDEX_NONE && TargetOrdinal != INDEX_NONE && MetaOrdinal != TargetOrdinal)
+	{
+		Metadata.MetaTargetOrdinals[MetaOrdinal] = TargetOrdinal;
+	}
+}
+
+void FGASCoreAttributeMetadataBuilder::ApplySchema(const TConstArrayView<FGASCoreAttributeSchemaRow> Rows)
+{
+	TArray<int32, TInlineAllocator<32>> RowOrdinals;
+	RowOrdinals.Reserve(Rows.Num());
+	for (const FGASCoreAttributeSchemaRow& Row : Rows)
+	{
+		const int32 Ordinal = FindOrdinalByName(Row.Name);
+		RowOrdinals.Add(Ordinal);
+		if (Ordinal == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const FGameplayAttribute& Attribute = Metadata.Attributes[Ordinal];
+		const int32 MaxOrdinal = FindOrdinalByName(Row.MaxAttribute);
+		if (MaxOrdinal != INDEX_NONE)
+		{
+			RegisterCurrentMaxPair(Attribute, Metadata.Attributes[MaxOrdinal]);
+		}
+
+		const int32 RateOrdinal = FindOrdinalByName(Row.RegenAttribute);
+		if (RateOrdinal != INDEX_NONE)
+		{
+			RegisterRegeneration(Attribute, Metadata.Attributes[RateOrdinal]);
+		}
+
+		if (Row.Decimals == 0)
+		{
+			SetIntegerStorage(Attribute);
+		}
+		else if (Row.Decimals > 0)
+		{
+			SetRoundingDecimals(Attribute, Row.Decimals);
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	ValidateSchema(Rows, RowOrdinals);
+#endif
+}
+
+int32 FGASCoreAttributeMetadataBuilder::FindOrdinalByName(const TCHAR* Name) const
+{
+	if (!Name || !*Name)
+	{
+		return INDEX_NONE;
+	}
+
+	// Build time only, a few dozen attributes: a linear scan is fine.
+	const FName PropertyName(Name, FNAME_Find);
+	for (int32 Ordinal = 0; Ordinal < Metadata.Num(); ++Ordinal)
+	{
+		if (Metadata.Properties[Ordinal]->GetFName() == PropertyName)
+		{
+			return Ordinal;
+		}
+	}
+	return INDEX_NONE;
+}
+
+#if !UE_BUILD_SHIPPING
+void FGASCoreAttributeMetadataBuilder::ValidateSchema(const TConstArrayView<FGASCoreAttributeSchemaRow> Rows,
+	const TConstArrayView<int32> RowOrdinals) const
+{
+	const UClass* SchemaClass = nullptr;
+	int32 PreviousOffset = -1;
+	for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+	{
+		const FGASCoreAttributeSchemaRow& Row = Rows[RowIndex];
+		const int32 Ordinal = RowOrdinals[RowIndex];
+		if (!ensureMsgf(Ordinal != INDEX_NONE, TEXT("Attribute schema row %s has no matching attribute property."), Row.Name))
+		{
+			continue;
+		}
+
+		const FStructProperty* Property = Metadata.Properties[Ordinal];
+		SchemaClass = SchemaClass ? SchemaClass : Property->GetOwnerClass();
+
+		if ((*Row.MaxAttribute && FindOrdinalByName(Row.MaxAttribute) == INDEX_NONE)
+			|| (*Row.RegenAttribute && FindOrdinalByName(Row.RegenAttribute) == INDEX_NONE))
+		{
+			GASCORE_LOG_WARNING(TEXT("Attribute schema row %s names an unknown Max/Regen partner (%s / %s)."),
+				Row.Name, Row.MaxAttribute, Row.RegenAttribute);
+		}
+
+		const FName ExpectedRepNotify(*FString::Printf(TEXT("OnRep_%s"), Row.Name));
+		if (!Property->HasAnyPropertyFlags(CPF_Net) || Property->RepNotifyFunc != ExpectedRepNotify)
+		{
+			GASCORE_LOG_WARNING(TEXT("Attribute %s should be declared UPROPERTY(ReplicatedUsing=%s) to match its schema row."),
+				Row.Name, *ExpectedRepNotify.ToString());
+		}
+
+		// Schema order is the intended memory layout (hot rows first); declaration order decides the real one.
+		if (Metadata.Offsets[Ordinal] < PreviousOffset)
+		{
+			GASCORE_LOG_WARNING(TEXT("Attribute %s is declared before the previous schema row; declare attributes in schema order."),
+				Row.Name);
+		}
+		PreviousOffset = FMath::Max(PreviousOffset, Metadata.Offsets[Ordinal]);
+	}
+
+	// Every replicated attribute of the schema's class should come from the schema.
+	for (int32 Ordinal = 0; SchemaClass && Ordinal < Metadata.Num(); ++Ordinal)
+	{
+		const FStructProperty* Property = Metadata.Properties[Ordinal];
+		if (Property->GetOwnerClass() == SchemaClass && Property->HasAnyPropertyFlags(CPF_Net)
+			&& !RowOrdinals.Contains(Ordinal))
+		{
+			GASCORE_LOG_WARNING(TEXT("Replicated attribute %s.%s has no attribute schema row."),
+				*SchemaClass->GetName(), *Property->GetName());
+		}
+	}
+}
+#endif
+
+void FGASCoreAttributeMetadataBuilder::FinalizeDerivations()
+{
+	// Ordinal → pending index of the derivation writing it (last declaration wins).
+	TArray<int32> WriterOf;
+	WriterOf.Init(INDEX_NONE, Metadata.Num());
+	for (int32 Index = 0; Index < PendingDerivations.Num(); ++Index)
+	{
+		WriterOf[PendingDerivations[Index].Ordinal] = Index;
+	}
+
+	// Kahn's algorithm: a derivation is ready once every derived source it reads is placed.
+	TArray<int32> RemainingInputs;
+	RemainingInputs.Init(0, PendingDerivations.Num());
+	for (int32 Index = 0; Index < PendingDerivations.Num(); ++Index)
+	{
+		if (WriterOf[PendingDerivations[Index].Ordinal] != Index)
+		{
+			RemainingInputs[Index] = -1; // superseded declaration
+			continue;
+		}
+		for (const int32 SourceOrdinal : PendingDerivations[Index].SourceOrdinals)
+		{
+			RemainingInputs[Index] += WriterOf[SourceOrdinal] != INDEX_NONE ? 1 : 0;
+		}
+	}
+
+	TArray<int32> Ready;
+	for (int32 Index = 0; Index < PendingDerivations.Num(); ++Index)
+	{
+		if (RemainingInputs[Index] == 0)
+		{
+			Ready.Add(Index);
+		}
+	}
+
+	TArray<int32> DerivationIndexOf;
+	DerivationIndexOf.Init(INDEX_NONE, PendingDerivations.Num());
+	for (int32 Cursor = 0; Cursor < Ready.Num(); ++Cursor)
+	{
+		const int32 Index = Ready[Cursor];
+		DerivationIndexOf[Index] = Metadata.Derivations.Add({ PendingDerivations[Index].Ordinal, PendingDerivations[Index].Formula });
+
+		for (int32 Other = 0; Other < PendingDerivations.Num(); ++Other)
+		{
+			if (RemainingInputs[Other] > 0 && PendingDerivations[Other].SourceOrdinals.Contains(PendingDerivations[Index].Ordinal)
+				&& --RemainingInputs[Other] == 0)
+			{
+				Ready.Add(Other);
+			}
+		}
+	}
+
+	// Anything left waits on itself through a cycle.
+	for (int32 Index = 0; Index < PendingDerivations.Num(); ++Index)
+	{
+		ensureMsgf(RemainingInputs[Index] <= 0, TEXT("Derived attribute %s is part of a dependency cycle and was ignored."),
+			*Metadata.Attributes[PendingDerivations[Index].Ordinal].GetName());
+	}
+
+	// Source ordinal → derivations reading it (ascending = dependency order).
+	for (int32 Index = 0; Index < PendingDerivations.Num(); ++Index)
+	{
+		if (const int32 DerivationIndex = DerivationIndexOf[Index]; DerivationIndex != INDEX_NONE)
+		{
+			for (const int32 SourceOrdinal : PendingDerivations[Index].SourceOrdinals)
+			{
+				Metadata.DependentDerivations[SourceOrdinal].Add(DerivationIndex);
+			}
+		}
+	}
+	for (TArray<int32>& Dependents : Metadata.DependentDerivations)
+	{
+		Dependents.Sort();
+	}
+	PendingDerivations.Reset();
+}
@@ -0,0 +1,177 @@
+// © 2025 Heathrow (Derman). All rights reserved.
+// This project is the intellectual property of Heathrow (Derman) and is protected by copyright law.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+//
+// File: GASCoreAttributeQuantization.cpp (implementation)
+// Purpose:
+//   - Quantizer construction (power-of-ten table) and the compact attribute net serializer.
+//
+// Wire format (FGASCoreQuantizedAttributeData):
+//   [1 bit compact][1 bit Current == Base][Base][Current unless equal]
+//   compact → values are int16, otherwise float.
+//
+// Wire format (FGASCoreFixedPointAttributeData):
+//   [1 bit whole][1 bit Current == Base][Base][Current unless equal]
+//   each value is a zigzag varint of the scaled integer (divided by Scale when whole).
+
+#include "AbilitySystem/Attributes/GASCoreAttributeQuantization.h"
+
+namespace GASCoreAttributeQuantization
+{
+	static constexpr float PowersOfTen[FGASCoreAttributeQuantizer::MaxDecimals + 1] =
+	{
+		1.f, 10.f, 100.f, 1000.f, 10000.f, 100000.f, 1000000.f
+	};
+
+	/** Whole number that survives an int16 round trip. */
+	static bool IsCompactValue(const float Value)
+	{
+		return Value >= static_cast<float>(MIN_int16) && Value <= static_cast<float>(MAX_int16)
+			&& FMath::RoundToFloat(Value) == Value;
+	}
+
+	static void SerializeValue(FArchive& Ar, const bool bCompact, float& Value)
+	{
+		if (bCompact)
+		{
+			int16 Packed = static_cast<int16>(Value);
+			Ar << Packed;
+			Value = static_cast<float>(Packed);
+		}
+		else
+		{
+			Ar << Value;
+		}
+	}
+
+	static uint32 ZigZag(const int32 Value)
+	{
+		return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+	}
+
+	static int32 UnZigZag(const uint32 Value)
+	{
+		return static_cast<int32>(Value >> 1) ^ -static_cast<int32>(Value & 1);
+	}
+
+	static void SerializeFixed(FArchive& Ar, const bool bWhole, int32& Fixed)
+	{
+		constexpr int32 Scale = FGASCoreFixedPointAttributeData::Scale;
+		uint32 Packed = ZigZag(bWhole ? Fixed / Scale : Fixed);
+		Ar.SerializeIntPacked(Packed);
+		const int32 Value = UnZigZag(Packed);
+		Fixed = bWhole ? static_cast<int32>(FMath::Clamp<int64>(static_cast<int64>(Value) * Scale, MIN_int32, MAX_int32)) : Value;
+	}
+}
+
+float FGASCoreAttributeQuantizer::GetScale(const int32 InDecimals)
+{
+	return GASCoreAttributeQuantization::PowersOfTen[FMath::Clamp(InDecimals, 0, MaxDecimals)];
+}
+
+FGASCoreAttributeQuantizer FGASCoreAttributeQuantizer::Make(const int32 InDecimals, const bool bInIntegerStorage)
+{
+	FGASCoreAttributeQuantizer Quantizer;
+	Quantizer.bIntegerStorage = bInIntegerStorage;
+	Quantizer.Decimals = bInIntegerStorage ? 0 : FMath::Clamp(InDecimals, 0, MaxDecimals);
+	Quantizer.Scale = GetScale(Quantizer.Decimals);
+	Quantizer.InvScale = 1.f / Quantizer.Scale;
+	return Quantizer;
+}
+
+bool FGASCoreQuantizedAttributeData::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace GASCoreAttributeQuantization;
+
+	float Base = GetBaseValue();
+	float Current = GetCurrentValue();
+
+	uint8 bCompact = 0;
+	uint8 bSameValue = 0;
+	if (Ar.IsSaving())
+	{
+		bSameValue = Base == Current ? 1 : 0;
+		bCompact = IsCompactValue(Base) && (bSameValue || IsCompactValue(Current)) ? 1 : 0;
+	}
+	Ar.SerializeBits(&bCompact, 1);
+	Ar.SerializeBits(&bSameValue, 1);
+
+	SerializeValue(Ar, bCompact != 0, Base);
+	if (bSameValue)
+	{
+		Current = Base;
+	}
+	else
+	{
+		SerializeValue(Ar, bCompact != 0, Current);
+	}
+
+	if (Ar.IsLoading())
+	{
+		SetBaseValue(Base);
+		SetCurrentValue(Current);
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+void FGASCoreFixedPointAttributeData::SetCurrentValue(const float NewValue)
+{
+	CurrentFixed = ToFixed(NewValue);
+	FGameplayAttributeData::SetCurrentValue(ToFloat(CurrentFixed));
+}
+
+void FGASCoreFixedPointAttributeData::SetBaseValue(const float NewValue)
+{
+	BaseFixed = ToFixed(NewValue);
+	FGameplayAttributeData::SetBaseValue(ToFloat(BaseFixed));
+}
+
+bool FGASCoreFixedPointAttributeData::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace GASCoreAttributeQuantization;
+
+	int32 Base = BaseFixed;
+	int32 Current = CurrentFixed;
+
+	uint8 bWhole = 0;
+	uint8 bSameValue = 0;
+	if (Ar.IsSaving())
+	{
+		bSameValue = Base == Current ? 1 : 0;
+		bWhole = Base % Scale == 0 && (bSameValue || Current % Scale == 0) ? 1 : 0;
+	}
+	Ar.SerializeBits(&bWhole, 1);
+	Ar.SerializeBits(&bSameValue, 1);
+
+	SerializeFixed(Ar, bWhole != 0, Base);
+	if (bSameValue)
+	{
+		Current = Base;
+	}
+	else
+	{
+		SerializeFixed(Ar, bWhole != 0, Current);
+	}
+
+	if (Ar.IsLoading())
+	{
+		BaseFixed = Base;
+		CurrentFixed = Current;
+		FGameplayAttributeData::SetBaseValue(ToFloat(BaseFixed));
+		FGameplayAttributeData::SetCurrentValue(ToFloat(CurrentFixed));
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+void FGASCoreFixedPointAttributeData::PostSerialize(const FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		SetBaseValue(BaseValue);
+		SetCurrentValue(CurrentValue);
+	}
+}
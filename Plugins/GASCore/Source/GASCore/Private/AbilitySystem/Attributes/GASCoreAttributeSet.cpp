@@ -9,16 +9,30 @@
 //
 // Implementation notes:
 //   - Rounding occurs after clamping to ensure final persisted values respect both constraints.
-//   - PostGameplayEffectExecute re-clamps Current when its paired Max changed and writes the rounded value.
-//   - Helpers access FGameplayAttributeData via property reflection to read/write numeric values.
+//   - PostGameplayEffectExecute re-clamps Current when its paired Max changed and writes the rounded value
+//     (or flags it for the end-of-frame FlushMaxClamps pass when SetDeferMaxClamp is on).
+//   - Current↔Max pairs, decimals and bounds come from the per-class FGASCoreAttributeMetadata table
+//     (ordinal lookups, no per-instance maps).
+//   - Helpers read FGameplayAttributeData through the class table's cached byte offsets (no per-call reflection);
+//     writes go through the ASC.
+//   - PreAttributeChange/PostGameplayEffectExecute are timed by GASCoreEffectProfiler (non-shipping, when enabled);
+//     PreAttributeChange is charged to the effect currently being applied.
 
 #include "AbilitySystem/Attributes/GASCoreAttributeSet.h"
 
+#include "AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
+#include "AbilitySystem/Data/GASCoreAttributeArchetypeDataAsset.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayEffectExtension.h"
+#include "GASCoreStats.h"
+#include "Engine/World.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/Controller.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "Utilities/GASCoreEffectProfiler.h"
+#include "Utilities/GASCoreEndOfFrame.h"
+#include "Utilities/GASCoreFrameBudget.h"
 #include "UObject/Field.h"
 #include "UObject/UnrealType.h"
 
@@ -27,117 +41,439 @@ UGASCoreAttributeSet::UGASCoreAttributeSet()
 	// Base constructor intentionally empty.
 	// Derived classes will:
 	//  - Declare attributes (UPROPERTY FGameplayAttributeData ...).
-	//  - Register Current↔Max pairs via RegisterCurrentMaxPair().
-	//4  - Populate TagsToAttributes with their Tag→Accessor entries.
+	//  - Register Current↔Max pairs in ConfigureAttributeMetadata() (once per class).
+	//  - Populate TagsToAttributes with their Tag→Accessor entries.
 }
 
-void UGASCoreAttributeSet::RegisterCurrentMaxPair(const FGameplayAttribute& Current, const FGameplayAttribute& Max)
+const FGASCoreAttributeMetadata& UGASCoreAttributeSet::GetAttributeMetadata() const
 {
-	// Register both directions for fast lookup.
-	//  CurrentToMax:  Current -> Max
-	//  MaxToCurrent:  Max     -> Current
-	if (Current.IsValid() && Max.IsValid())
+	// One registry lookup per instance; afterwards it is a plain pointer read.
+	if (!AttributeMetadata)
 	{
-		CurrentToMax.Add(Current, Max);
-		MaxToCurrent.Add(Max, Current);
+		AttributeMetadata = &FGASCoreAttributeMetadata::Get(this);
 	}
+	return *AttributeMetadata;
 }
 
-bool UGASCoreAttributeSet::TryGetMaxForCurrent(const FGameplayAttribute& Current, FGameplayAttribute& OutMax) const
+int32 UGASCoreAttributeSet::GetRoundingDecimals(const FGameplayAttribute& Attribute) const
 {
-	// Quickly retrieve the Max associated with a Current attribute, if registered.
-	if (const FGameplayAttribute* Found = CurrentToMax.Find(Current))
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	const int32 Ordinal = Metadata.GetOrdinal(Attribute);
+	return Ordinal != INDEX_NONE ? Metadata.Quantizers[Ordinal].Decimals : DefaultRoundingDecimals;
+}
+
+#if WITH_EDITOR
+void UGASCoreAttributeSet::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Only the CDO feeds the class table.
+	if (HasAnyFlags(RF_ClassDefaultObject))
 	{
-		OutMax = *Found;
-		return true;
+		FGASCoreAttributeMetadata::RefreshFromDefaults(this);
 	}
-	return false;
 }
+#endif
 
-bool UGASCoreAttributeSet::TryGetCurrentForMax(const FGameplayAttribute& Max, FGameplayAttribute& OutCurrent) const
+float UGASCoreAttributeSet::ClampAndRound(const int32 Ordinal, float Value) const
 {
-	// Quickly retrieve the Current associated with a Max attribute, if registered.
-	if (const FGameplayAttribute* Found = MaxToCurrent.Find(Max))
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	const FVector2f& Range = Metadata.ClampRanges[Ordinal];
+	const int32 PairedMaxOrdinal = Metadata.MaxOrdinals[Ordinal];
+
+	// Fixed point (both sides): quantize once, then clamp as scaled integers, exact against the Max's stored value.
+	if (Metadata.FixedPoint[Ordinal] && (PairedMaxOrdinal == INDEX_NONE || Metadata.FixedPoint[PairedMaxOrdinal]))
 	{
-		OutCurrent = *Found;
-		return true;
+		using FFixed = FGASCoreFixedPointAttributeData;
+		int32 Upper = FFixed::ToFixed(Range.Y);
+		if (PairedMaxOrdinal != INDEX_NONE)
+		{
+			Upper = FMath::Min(Upper, static_cast<const FFixed&>(GetAttributeDataAt(PairedMaxOrdinal)).GetCurrentFixed());
+		}
+		const int32 Fixed = FFixed::ToFixed(Metadata.Quantizers[Ordinal].Quantize(Value));
+		return FFixed::ToFloat(FMath::Clamp(Fixed, FFixed::ToFixed(Range.X), FMath::Max(Upper, FFixed::ToFixed(Range.X))));
+	}
+
+	// Paired Currents are also bounded by their Max's live value.
+	float Upper = Range.Y;
+	if (PairedMaxOrdinal != INDEX_NONE)
+	{
+		Upper = FMath::Min(Upper, GetAttributeDataAt(PairedMaxOrdinal).GetCurrentValue());
+	}
+
+	// Clamp first, then quantize so the final value honors both constraints.
+	Value = FMath::Clamp(Value, Range.X, Upper);
+	return Metadata.Quantizers[Ordinal].Quantize(Value);
+}
+
+const FGameplayAttributeData* UGASCoreAttributeSet::FindAttributeDataConst(const FGameplayAttribute& Attr) const
+{
+	// O(1): ordinal from the property offset, then the cached byte offset (validated against reflection
+	// in non-shipping builds when the class table is built).
+	const int32 Ordinal = GetAttributeMetadata().GetOrdinal(Attr);
+	return Ordinal != INDEX_NONE ? &GetAttributeDataAt(Ordinal) : nullptr;
+}
+
+float UGASCoreAttributeSet::GetCurrentNumeric(const FGameplayAttribute& Attr) const
+{
+	// Safe read of CurrentValue for the given attribute belonging to this set.
+	if (const FGameplayAttributeData* Data = FindAttributeDataConst(Attr))
+	{
+		return Data->GetCurrentValue();
+	}
+	return 0.f;
+}
+
+float UGASCoreAttributeSet::GetBaseNumeric(const FGameplayAttribute& Attr) const
+{
+	// Safe read of BaseValue for the given attribute belonging to this set.
+	if (const FGameplayAttributeData* Data = FindAttributeDataConst(Attr))
+	{
+		return Data->GetBaseValue();
+	}
+	return 0.f;
+}
+
+void UGASCoreAttributeSet::InitializeFromArchetype(const UGASCoreAttributeArchetypeDataAsset* InArchetype, const int32 Level)
+{
+	if (!InArchetype || !ensureMsgf(InArchetype->AttributeSetClass == GetClass(),
+		TEXT("%s: archetype %s targets a different attribute set class."), *GetName(), *GetNameSafe(InArchetype)))
+	{
+		return;
+	}
+
+	Archetype = InArchetype;
+	DivergedAttributes.Reset();
+	ApplyArchetypeValues(Level, false);
+}
+
+void UGASCoreAttributeSet::SetArchetypeLevel(const int32 Level)
+{
+	ApplyArchetypeValues(Level, true);
+}
+
+bool UGASCoreAttributeSet::HasDivergedFromArchetype(const FGameplayAttribute& Attr) const
+{
+	const int32 Ordinal = GetAttributeMetadata().GetOrdinal(Attr);
+	return DivergedAttributes && Ordinal != INDEX_NONE && (*DivergedAttributes)[Ordinal];
+}
+
+SIZE_T UGASCoreAttributeSet::GetInstanceAllocatedSize() const
+{
+	SIZE_T Bytes = LiveAttributes.GetAllocatedSize() + ReplicatedAttributes.GetAllocatedSize()
+		+ DirtyDerivations.GetAllocatedSize() + PendingMaxClamps.GetAllocatedSize()
+		+ RegenerationBaselineTimes.GetAllocatedSize();
+	if (DivergedAttributes)
+	{
+		Bytes += sizeof(TBitArray<>) + DivergedAttributes->GetAllocatedSize();
 	}
-	return false;
+	return Bytes;
 }
 
-const FGameplayAttributeData* UGASCoreAttributeSet::FindAttributeDataConst(const FGameplayAttribute& Attr, const UAttributeSet* Set)
+void UGASCoreAttributeSet::ResetToClassDefaults()
 {
-	// All attributes on UAttributeSet are FGameplayAttributeData fields; use reflection to access storage.
-	// Safe for read-only access.
-	if (!Attr.IsValid()) return nullptr;
-	if (FProperty* Prop = Attr.GetUProperty())
+	// Raw defaults are not derivation inputs and not divergence: graph, clamps and archetype go first.
+	Archetype = nullptr;
+	ArchetypeLevel = 0;
+	DivergedAttributes.Reset();
+	bEvaluateDerivedAttributes = false;
+	DirtyDerivations.SetRange(0, DirtyDerivations.Num(), false);
+	PendingMaxClamps.SetRange(0, PendingMaxClamps.Num(), false);
+
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	const UGASCoreAttributeSet* Defaults = GetClass()->GetDefaultObject<UGASCoreAttributeSet>();
+
+	// Not a gameplay change: deferred attributes stay deferred (re-initialized right after, on clients too).
+	TGuardValue<bool> ApplyingGuard(bApplyingArchetype, true);
+
+	// Maxes first, so paired Currents clamp against the default Max rather than the previous life's.
+	for (const bool bMaxPass : { true, false })
 	{
-		if (FStructProperty* StructProp = CastField<FStructProperty>(Prop))
+		for (int32 Ordinal = 0; Ordinal < Metadata.Num(); ++Ordinal)
 		{
-			if (StructProp->Struct == TBaseStructure<FGameplayAttributeData>::Get())
+			const bool bIsMax = Metadata.CurrentOrdinals[Ordinal] != INDEX_NONE;
+			if (bIsMax == bMaxPass)
 			{
-				return StructProp->ContainerPtrToValuePtr<FGameplayAttributeData>(Set);
+				SetCurrentNumeric(Metadata.Attributes[Ordinal], Defaults->GetAttributeDataAt(Ordinal).GetBaseValue());
 			}
 		}
 	}
-	return nullptr;
 }
 
-FGameplayAttributeData* UGASCoreAttributeSet::FindAttributeData(const FGameplayAttribute& Attr, UAttributeSet* Set)
+void UGASCoreAttributeSet::ApplyArchetypeValues(const int32 Level, const bool bSkipDiverged)
 {
-	// Mutable access to the same attribute storage via reflection.
-	if (!Attr.IsValid()) return nullptr;
-	if (FProperty* Prop = Attr.GetUProperty())
+	const FGASCoreArchetypeLevelValues* Values = Archetype ? Archetype->GetLevelValues(Level) : nullptr;
+	if (!Values)
 	{
-		if (FStructProperty* StructProp = CastField<FStructProperty>(Prop))
+		return;
+	}
+	ArchetypeLevel = Level;
+
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	TGuardValue<bool> ApplyingGuard(bApplyingArchetype, true);
+
+	// Maxes first (ordinal order puts them wherever the class declared them), so paired Currents clamp
+	// against the new Max rather than the old one.
+	for (const bool bMaxPass : { true, false })
+	{
+		for (TConstSetBitIterator<> It(Values->Specified); It; ++It)
 		{
-			if (StructProp->Struct == TBaseStructure<FGameplayAttributeData>::Get())
+			const int32 Ordinal = It.GetIndex();
+			const bool bIsMax = Metadata.CurrentOrdinals[Ordinal] != INDEX_NONE;
+			if (bIsMax != bMaxPass || (bSkipDiverged && DivergedAttributes && (*DivergedAttributes)[Ordinal])
+				|| !ShouldWriteInitialValue(Ordinal))
 			{
-				return StructProp->ContainerPtrToValuePtr<FGameplayAttributeData>(Set);
+				continue;
 			}
+			SetCurrentNumeric(Metadata.Attributes[Ordinal], Values->BaseValues[Ordinal]);
 		}
 	}
-	return nullptr;
 }
 
-float UGASCoreAttributeSet::GetCurrentNumeric(const FGameplayAttribute& Attr) const
+void UGASCoreAttributeSet::SetEvaluateDerivedAttributes(const bool bEnable, const bool bRecompute)
 {
-	// Safe read of CurrentValue for the given attribute belonging to this set.
-	if (const FGameplayAttributeData* Data = FindAttributeDataConst(Attr, this))
+	bEvaluateDerivedAttributes = bEnable;
+	if (!bEnable)
 	{
-		return Data->GetCurrentValue();
+		return;
+	}
+
+	// Everything is stale when the graph takes over (unless the caller just wrote the derived values).
+	const int32 NumDerivations = GetAttributeMetadata().Derivations.Num();
+	DirtyDerivations.Init(bRecompute, NumDerivations);
+	if (bRecompute && NumDerivations > 0)
+	{
+		ScheduleDerivedFlush();
 	}
-	return 0.f;
 }
 
-float UGASCoreAttributeSet::GetBaseNumeric(const FGameplayAttribute& Attr) const
+void UGASCoreAttributeSet::ScheduleDerivedFlush()
 {
-	// Safe read of BaseValue for the given attribute belonging to this set.
-	if (const FGameplayAttributeData* Data = FindAttributeDataConst(Attr, this))
+	if (!bDerivedFlushScheduled)
 	{
-		return Data->GetBaseValue();
+		bDerivedFlushScheduled = true;
+		GASCoreEndOfFrame::Schedule(this, [](UObject* Object)
+		{
+			CastChecked<UGASCoreAttributeSet>(Object)->FlushDerivedAttributes();
+		});
+	}
+}
+
+void UGASCoreAttributeSet::MarkDependentsDirty(const int32 Ordinal)
+{
+	const TArray<int32>& Dependents = GetAttributeMetadata().DependentDerivations[Ordinal];
+	if (Dependents.IsEmpty())
+	{
+		return;
+	}
+
+	if (DirtyDerivations.Num() != GetAttributeMetadata().Derivations.Num())
+	{
+		DirtyDerivations.Init(false, GetAttributeMetadata().Derivations.Num());
+	}
+	for (const int32 DerivationIndex : Dependents)
+	{
+		DirtyDerivations[DerivationIndex] = true;
+	}
+
+	// Inside a flush, later derivations are still ahead of the cursor: no extra frame needed.
+	if (!bFlushingDerivedAttributes)
+	{
+		ScheduleDerivedFlush();
 	}
-	return 0.f;
+}
+
+void UGASCoreAttributeSet::FlushDerivedAttributes()
+{
+	bDerivedFlushScheduled = false;
+
+	const AActor* OwningActor = GetOwningActor();
+	if (!bEvaluateDerivedAttributes || DirtyDerivations.Find(true) == INDEX_NONE || !OwningActor || !OwningActor->HasAuthority())
+	{
+		return;
+	}
+
+	// Dependency order: a recomputed source re-dirties only derivations after it, so one pass settles the graph.
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	TGuardValue<bool> FlushGuard(bFlushingDerivedAttributes, true);
+	for (int32 Index = 0; Index < Metadata.Derivations.Num(); ++Index)
+	{
+		if (!DirtyDerivations[Index])
+		{
+			continue;
+		}
+		DirtyDerivations[Index] = false;
+
+		const FGASCoreDerivedAttribute& Derivation = Metadata.Derivations[Index];
+		const float NewBase = Metadata.Quantizers[Derivation.Ordinal].Quantize(Derivation.Formula(*this));
+		if (NewBase != GetAttributeDataAt(Derivation.Ordinal).GetBaseValue())
+		{
+			SetCurrentNumeric(Metadata.Attributes[Derivation.Ordinal], NewBase);
+		}
+	}
+}
+
+float UGASCoreAttributeSet::GetExtrapolatedValue(const FGameplayAttribute& Attr) const
+{
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	const int32 Ordinal = Metadata.GetOrdinal(Attr);
+	if (Ordinal == INDEX_NONE)
+	{
+		return 0.f;
+	}
+
+	const float Current = GetAttributeDataAt(Ordinal).GetCurrentValue();
+	const int32 RegenerationIndex = FindRegenerationIndex(Ordinal);
+	const UWorld* World = GetWorld();
+	if (RegenerationIndex == INDEX_NONE || !World || !RegenerationBaselineTimes.IsValidIndex(RegenerationIndex))
+	{
+		return Current;
+	}
+
+	const float Rate = GetAttributeDataAt(Metadata.Regenerations[RegenerationIndex].RateOrdinal).GetCurrentValue();
+	const float Elapsed = static_cast<float>(World->GetTimeSeconds() - RegenerationBaselineTimes[RegenerationIndex]);
+	const int32 MaxOrdinal = Metadata.MaxOrdinals[Ordinal];
+	const float Max = MaxOrdinal != INDEX_NONE ? GetAttributeDataAt(MaxOrdinal).GetCurrentValue() : MAX_flt;
+
+	// Never extrapolate past a bound the value already sits outside of (e.g., Max just dropped).
+	const float Extrapolated = Current + Rate * FMath::Max(Elapsed, 0.f);
+	return Rate >= 0.f ? FMath::Clamp(Extrapolated, Current, FMath::Max(Current, Max)) : FMath::Clamp(Extrapolated, FMath::Min(Current, 0.f), Current);
+}
+
+void UGASCoreAttributeSet::NotifyRegeneratingAttributeReplicated(const FGameplayAttribute& Attr) const
+{
+	ResetRegenerationBaseline(FindRegenerationIndex(GetAttributeMetadata().GetOrdinal(Attr)));
+}
+
+int32 UGASCoreAttributeSet::FindRegenerationIndex(const int32 Ordinal) const
+{
+	if (Ordinal == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	// A handful of vitals per class: a scan beats a per-ordinal table.
+	const TArray<FGASCoreRegeneration>& Regenerations = GetAttributeMetadata().Regenerations;
+	for (int32 Index = 0; Index < Regenerations.Num(); ++Index)
+	{
+		if (Regenerations[Index].CurrentOrdinal == Ordinal)
+		{
+			return Index;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void UGASCoreAttributeSet::ResetRegenerationBaseline(const int32 RegenerationIndex) const
+{
+	const UWorld* World = GetWorld();
+	if (RegenerationIndex == INDEX_NONE || !World)
+	{
+		return;
+	}
+
+	const int32 NumRegenerations = GetAttributeMetadata().Regenerations.Num();
+	if (RegenerationBaselineTimes.Num() != NumRegenerations)
+	{
+		RegenerationBaselineTimes.Init(World->GetTimeSeconds(), NumRegenerations);
+	}
+	RegenerationBaselineTimes[RegenerationIndex] = World->GetTimeSeconds();
+}
+
+ELifetimeCondition UGASCoreAttributeSet::GetInitialReplicationCondition(const FGameplayAttribute& Attr,
+	const ELifetimeCondition Condition) const
+{
+	if (!bDeferInitialReplication)
+	{
+		return Condition;
+	}
+	const int32 Ordinal = GetAttributeMetadata().GetOrdinal(Attr);
+	const bool bLive = LiveAttributes.IsValidIndex(Ordinal) && LiveAttributes[Ordinal];
+	return bLive ? Condition : COND_Never;
+}
+
+void UGASCoreAttributeSet::NotifyAttributeReplicated(const FGameplayAttribute& Attr) const
+{
+	if (!bDeferInitialReplication)
+	{
+		return;
+	}
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	if (const int32 Ordinal = Metadata.GetOrdinal(Attr); Ordinal != INDEX_NONE)
+	{
+		if (ReplicatedAttributes.Num() != Metadata.Num())
+		{
+			ReplicatedAttributes.Init(false, Metadata.Num());
+		}
+		ReplicatedAttributes[Ordinal] = true;
+	}
+}
+
+void UGASCoreAttributeSet::NoteAttributeChanged(const int32 Ordinal) const
+{
+	if (Ordinal == INDEX_NONE || (LiveAttributes.IsValidIndex(Ordinal) && LiveAttributes[Ordinal]))
+	{
+		return;
+	}
+	const AActor* OwningActor = GetOwningActor();
+	if (!OwningActor || !OwningActor->HasAuthority())
+	{
+		return;
+	}
+
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	if (LiveAttributes.Num() != Metadata.Num())
+	{
+		LiveAttributes.Init(false, Metadata.Num());
+	}
+	LiveAttributes[Ordinal] = true;
+	OnAttributeLeftInitialization(Metadata.Attributes[Ordinal]);
+}
+
+bool UGASCoreAttributeSet::ShouldWriteInitialValue(const int32 Ordinal) const
+{
+	if (!bDeferInitialReplication || !ReplicatedAttributes.IsValidIndex(Ordinal) || !ReplicatedAttributes[Ordinal])
+	{
+		return true;
+	}
+	const AActor* OwningActor = GetOwningActor();
+	return OwningActor && OwningActor->HasAuthority();
+}
+
+void UGASCoreAttributeSet::MarkAttributeDirty(const FGameplayAttribute& Attr) const
+{
+#if WITH_PUSH_MODEL
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	const int32 Ordinal = Metadata.GetOrdinal(Attr);
+	// Non-replicated attributes (meta attributes) have no rep index to mark.
+	if (Ordinal != INDEX_NONE && Metadata.Properties[Ordinal]->HasAnyPropertyFlags(CPF_Net))
+	{
+		MARK_PROPERTY_DIRTY(this, Metadata.Properties[Ordinal]);
+	}
+#endif
 }
 
 float UGASCoreAttributeSet::RoundToDecimals(float Value, int32 Decimals)
 {
-	// Half-away-from-zero rounding.
 	//  - Decimals <= 0 → integer rounding.
-	//  - Decimals > 0  → round to that many fractional digits.
+	//  - Decimals > 0  → round to that many fractional digits (scale from a table).
+	//  - Rounds in float, not through int32: unclamped attributes may exceed its range once scaled.
 	if (Decimals <= 0)
 	{
-		return static_cast<float>(FMath::RoundToInt(Value));
+		return FMath::RoundToFloat(Value);
 	}
-	const float Scale = FMath::Pow(10.f, static_cast<float>(Decimals));
-	return static_cast<float>(FMath::RoundToInt(Value * Scale)) / Scale;
+	const float Scale = FGASCoreAttributeQuantizer::GetScale(Decimals);
+	return FMath::RoundToFloat(Value * Scale) / Scale;
 }
 
 void UGASCoreAttributeSet::SetCurrentNumeric(const FGameplayAttribute& Attr, float NewValue)
 {
-	// Apply rounding policy before persisting the value via the owning ASC.
-	const int32 Decimals = GetRoundingDecimals(Attr);
-	const float Rounded = RoundToDecimals(NewValue, Decimals);
+	// Apply the attribute's quantization before persisting the value via the owning ASC.
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	const int32 Ordinal = Metadata.GetOrdinal(Attr);
+	const float Rounded = Ordinal != INDEX_NONE
+		? Metadata.Quantizers[Ordinal].Quantize(NewValue)
+		: RoundToDecimals(NewValue, DefaultRoundingDecimals);
 
 	if (UAbilitySystemComponent* ASC = GetOwningAbilitySystemComponent())
 	{
@@ -149,72 +485,199 @@ void UGASCoreAttributeSet::SetCurrentNumeric(const FGameplayAttribute& Attr, flo
 
 void UGASCoreAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
 {
+	GASCORE_TRACE_SCOPE(UGASCoreAttributeSet::PreAttributeChange);
+	GASCORE_FRAME_BUDGET_SCOPE(AttributeCallbacks);
+#if GASCORE_EFFECT_PROFILER
+	const UClass* ActiveEffectClass = nullptr;
+	const UObject* ActiveEffectSource = nullptr;
+	if (GASCoreEffectProfiler::IsEnabled())
+	{
+		GASCoreEffectProfiler::GetActiveEffect(ActiveEffectClass, ActiveEffectSource);
+	}
+	GASCORE_EFFECT_COST_SCOPE(EGASCoreEffectCostPhase::PreAttributeChange, ActiveEffectClass, ActiveEffectSource,
+		GetOwningAbilitySystemComponent());
+#endif
+
 	Super::PreAttributeChange(Attribute, NewValue);
 
-	// If this attribute is registered as a Current with a paired Max, clamp to [0, Max].
-	FGameplayAttribute MaxAttr;
-	if (TryGetMaxForCurrent(Attribute, MaxAttr))
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	const int32 Ordinal = Metadata.GetOrdinal(Attribute);
+	if (Ordinal == INDEX_NONE)
 	{
-		const float Max = GetCurrentNumeric(MaxAttr);
-		const float Old = GetCurrentNumeric(Attribute);
+		// Not one of ours (should not happen): rounding only.
+		NewValue = RoundToDecimals(NewValue, DefaultRoundingDecimals);
+		return;
+	}
 
-		// Clamp first, then round so the final value honors both constraints.
-		NewValue = FMath::Clamp(NewValue, 0.f, Max);
-		const int32 Decimals = GetRoundingDecimals(Attribute);
-		NewValue = RoundToDecimals(NewValue, Decimals);
+	// Clamp to static bounds (and [0, Max] for registered Currents), then round.
+	const int32 MaxOrdinal = Metadata.MaxOrdinals[Ordinal];
+	const float Old = MaxOrdinal != INDEX_NONE ? GetAttributeDataAt(Ordinal).GetCurrentValue() : 0.f;
+	NewValue = ClampAndRound(Ordinal, NewValue);
 
-		// Optional hook for analytics/UI cues.
-		if (!FMath::IsNearlyEqual(Old, NewValue))
-		{
-			OnCurrentClampedByMax(Attribute, MaxAttr, Old, NewValue);
-		}
-	}
-	else
+	// Optional hook for analytics/UI cues.
+	if (MaxOrdinal != INDEX_NONE && !FMath::IsNearlyEqual(Old, NewValue))
 	{
-		// Even if not paired, you may want rounding for consistency (e.g., Strength as an integer).
-		const int32 Decimals = GetRoundingDecimals(Attribute);
-		NewValue = RoundToDecimals(NewValue, Decimals);
+		OnCurrentClampedByMax(Attribute, Metadata.Attributes[MaxOrdinal], Old, NewValue);
 	}
 }
 
 void UGASCoreAttributeSet::PreAttributeBaseChange(const FGameplayAttribute& Attribute, float& NewValue) const
 {
+	GASCORE_TRACE_SCOPE(UGASCoreAttributeSet::PreAttributeBaseChange);
+	GASCORE_FRAME_BUDGET_SCOPE(AttributeCallbacks);
 	Super::PreAttributeBaseChange(Attribute, NewValue);
 	
-	// For BaseValue changes, clamp to [0, Max(Current)] if a pair exists.
-	FGameplayAttribute MaxAttr;
-	if (TryGetMaxForCurrent(Attribute, MaxAttr))
+	// For BaseValue changes, clamp to bounds / [0, Max(Current)] if a pair exists, and round
+	// so replicated Base matches your policy.
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	const int32 Ordinal = Metadata.GetOrdinal(Attribute);
+	NewValue = Ordinal != INDEX_NONE
+		? ClampAndRound(Ordinal, NewValue)
+		: RoundToDecimals(NewValue, DefaultRoundingDecimals);
+}
+
+void UGASCoreAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribute, const float OldValue, const float NewValue)
+{
+	GASCORE_TRACE_SCOPE(UGASCoreAttributeSet::PostAttributeChange);
+	GASCORE_FRAME_BUDGET_SCOPE(AttributeCallbacks);
+	Super::PostAttributeChange(Attribute, OldValue, NewValue);
+
+	// Idle sets never get here, so push-based properties are not compared at all.
+	if (OldValue != NewValue)
+	{
+		MarkAttributeDirty(Attribute);
+
+#if GASCORE_EFFECT_PROFILER
+		if (GASCoreEffectProfiler::IsEnabled())
+		{
+			GASCoreEffectProfiler::RecordAttributeChange(GetOwningAbilitySystemComponent());
+		}
+#endif
+
+		const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+		if (bDeferInitialReplication && !bApplyingArchetype)
+		{
+			NoteAttributeChanged(Metadata.GetOrdinal(Attribute));
+		}
+		if (bEvaluateDerivedAttributes || !Metadata.Regenerations.IsEmpty())
+		{
+			if (const int32 Ordinal = Metadata.GetOrdinal(Attribute); Ordinal != INDEX_NONE)
+			{
+				if (bEvaluateDerivedAttributes)
+				{
+					MarkDependentsDirty(Ordinal);
+				}
+
+				// Any write (damage, regen commit, replication through an aggregator) restarts the extrapolation.
+				ResetRegenerationBaseline(FindRegenerationIndex(Ordinal));
+			}
+		}
+	}
+}
+
+void UGASCoreAttributeSet::PostAttributeBaseChange(const FGameplayAttribute& Attribute, const float OldValue, const float NewValue) const
+{
+	GASCORE_TRACE_SCOPE(UGASCoreAttributeSet::PostAttributeBaseChange);
+	GASCORE_FRAME_BUDGET_SCOPE(AttributeCallbacks);
+	Super::PostAttributeBaseChange(Attribute, OldValue, NewValue);
+
+	if (OldValue != NewValue)
 	{
-		const float Max = GetCurrentNumeric(MaxAttr);
-		NewValue = FMath::Clamp(NewValue, 0.f, Max);
+		MarkAttributeDirty(Attribute);
+
+		if (bDeferInitialReplication && !bApplyingArchetype)
+		{
+			NoteAttributeChanged(GetAttributeMetadata().GetOrdinal(Attribute));
+		}
 	}
 
-	// Apply rounding to Base as well, so replicated Base matches your policy.
-	const int32 Decimals = GetRoundingDecimals(Attribute);
-	NewValue = RoundToDecimals(NewValue, Decimals);
+	// Copy-on-write divergence: the mask only exists once some base leaves its archetype value.
+	if (Archetype && !bApplyingArchetype)
+	{
+		const FGASCoreArchetypeLevelValues* Values = Archetype->GetLevelValues(ArchetypeLevel);
+		const int32 Ordinal = GetAttributeMetadata().GetOrdinal(Attribute);
+		if (Values && Ordinal != INDEX_NONE && Values->Specified[Ordinal] && NewValue != Values->BaseValues[Ordinal])
+		{
+			if (!DivergedAttributes)
+			{
+				DivergedAttributes = MakeUnique<TBitArray<>>(false, GetAttributeMetadata().Num());
+			}
+			(*DivergedAttributes)[Ordinal] = true;
+		}
+	}
 }
 
 void UGASCoreAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
 {
+	GASCORE_TRACE_SCOPE(UGASCoreAttributeSet::PostGameplayEffectExecute);
+	GASCORE_FRAME_BUDGET_SCOPE(AttributeCallbacks);
+#if GASCORE_EFFECT_PROFILER
+	const bool bProfile = GASCoreEffectProfiler::IsEnabled() && Data.EffectSpec.Def;
+	GASCORE_EFFECT_COST_SCOPE(EGASCoreEffectCostPhase::PostGameplayEffectExecute,
+		bProfile ? Data.EffectSpec.Def->GetClass() : nullptr,
+		bProfile ? GASCoreEffectProfiler::GetContextSource(Data.EffectSpec.GetContext()) : nullptr, &Data.Target);
+#endif
+
 	Super::PostGameplayEffectExecute(Data);
 
-	// If the attribute that just changed is a Max, ensure the paired Current is clamped and rounded.
-	FGameplayAttribute CurrentAttr;
-	if (TryGetCurrentForMax(Data.EvaluatedData.Attribute, CurrentAttr))
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	const int32 Ordinal = Metadata.GetOrdinal(Data.EvaluatedData.Attribute);
+	if (Ordinal == INDEX_NONE)
 	{
-		const float Max = GetCurrentNumeric(Data.EvaluatedData.Attribute);
-		const float OldCurrent = GetCurrentNumeric(CurrentAttr);
+		return;
+	}
 
-		// Clamp then round the Current value.
-		float NewCurrent = FMath::Clamp(OldCurrent, 0.f, Max);
-		const int32 Decimals = GetRoundingDecimals(CurrentAttr);
-		NewCurrent = RoundToDecimals(NewCurrent, Decimals);
+	// Meta damage attribute: consume it (back to 0) and drain its target.
+	const int32 MetaTargetOrdinal = Metadata.MetaTargetOrdinals[Ordinal];
+	if (MetaTargetOrdinal != INDEX_NONE)
+	{
+		const float Damage = GetAttributeDataAt(Ordinal).GetCurrentValue();
+		SetCurrentNumeric(Data.EvaluatedData.Attribute, 0.f);
+		if (Damage > 0.f)
+		{
+			const FGameplayAttribute& TargetAttr = Metadata.Attributes[MetaTargetOrdinal];
+			const float OldValue = GetAttributeDataAt(MetaTargetOrdinal).GetCurrentValue();
+			const float NewValue = ClampAndRound(MetaTargetOrdinal, OldValue - Damage);
+			SetCurrentNumeric(TargetAttr, NewValue);
+			OnIncomingDamageApplied(TargetAttr, Damage, OldValue, NewValue, Data);
 
-		// Only write if it actually changed to avoid unnecessary churn.
-		if (!FMath::IsNearlyEqual(OldCurrent, NewCurrent))
+			// Damage actually dealt, per instigator avatar, for the end-of-frame damage batch (threat).
+			if (UGASCoreAbilitySystemComponent* CoreASC = Cast<UGASCoreAbilitySystemComponent>(GetOwningAbilitySystemComponent()))
+			{
+				const FGameplayEffectContextHandle& Context = Data.EffectSpec.GetContext();
+				const UAbilitySystemComponent* SourceASC = Context.GetOriginalInstigatorAbilitySystemComponent();
+				AActor* Instigator = SourceASC && SourceASC->GetAvatarActor() ? SourceASC->GetAvatarActor() : Context.GetEffectCauser();
+				CoreASC->QueueDamageEvent(Instigator, OldValue - NewValue);
+			}
+		}
+		return;
+	}
+
+	// If the attribute that just changed is a Max, ensure the paired Current is clamped and rounded.
+	const int32 CurrentOrdinal = Metadata.CurrentOrdinals[Ordinal];
+	if (CurrentOrdinal != INDEX_NONE)
+	{
+		if (!bDeferMaxClamp)
 		{
-			SetCurrentNumeric(CurrentAttr, NewCurrent);
-			OnMaxAttributeChangedAndClamped(CurrentAttr, Data.EvaluatedData.Attribute, OldCurrent, NewCurrent);
+			ClampCurrentToMax(CurrentOrdinal);
+		}
+		else
+		{
+			// Deferred: flag it; repeated Max changes this frame collapse into one clamp.
+			if (PendingMaxClamps.Num() != Metadata.Num())
+			{
+				PendingMaxClamps.Init(false, Metadata.Num());
+			}
+			PendingMaxClamps[CurrentOrdinal] = true;
+
+			if (!bMaxClampFlushScheduled)
+			{
+				bMaxClampFlushScheduled = true;
+				GASCoreEndOfFrame::Schedule(this, [](UObject* Object)
+				{
+					CastChecked<UGASCoreAttributeSet>(Object)->FlushMaxClamps();
+				});
+			}
 		}
 	}
 
@@ -222,6 +685,41 @@ void UGASCoreAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCal
 	// FGASCoreEffectContext Ctx; PopulateCoreEffectContext(Data, Ctx);
 }
 
+void UGASCoreAttributeSet::SetDeferMaxClamp(const bool bEnable)
+{
+	bDeferMaxClamp = bEnable;
+	if (!bEnable)
+	{
+		FlushMaxClamps();
+	}
+}
+
+void UGASCoreAttributeSet::FlushMaxClamps()
+{
+	bMaxClampFlushScheduled = false;
+
+	for (TConstSetBitIterator<> It(PendingMaxClamps); It; ++It)
+	{
+		ClampCurrentToMax(It.GetIndex());
+	}
+	PendingMaxClamps.SetRange(0, PendingMaxClamps.Num(), false);
+}
+
+void UGASCoreAttributeSet::ClampCurrentToMax(const int32 CurrentOrdinal)
+{
+	const FGASCoreAttributeMetadata& Metadata = GetAttributeMetadata();
+	const FGameplayAttribute& CurrentAttr = Metadata.Attributes[CurrentOrdinal];
+	const float OldCurrent = GetAttributeDataAt(CurrentOrdinal).GetCurrentValue();
+	const float NewCurrent = ClampAndRound(CurrentOrdinal, OldCurrent);
+
+	// Only write if it actually changed to avoid unnecessary churn.
+	if (!FMath::IsNearlyEqual(OldCurrent, NewCurrent))
+	{
+		SetCurrentNumeric(CurrentAttr, NewCurrent);
+		OnMaxAttributeChangedAndClamped(CurrentAttr, Metadata.Attributes[Metadata.MaxOrdinals[CurrentOrdinal]], OldCurrent, NewCurrent);
+	}
+}
+
 void UGASCoreAttributeSet::PopulateCoreEffectContext(const FGameplayEffectModCallbackData& Data,
 	FGASCoreEffectContext& InEffectContext) const
 {
@@ -0,0 +1,144 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/Attributes/GASCoreAttributeTagRegistry.h"
+
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Tasks/Task.h"
+#include "Utilities/GASCoreLogging.h"
+
+namespace GASCoreAttributeTagRegistry
+{
+	namespace Private
+	{
+		struct FRegistry
+		{
+			/** Live bindings (static objects of every loaded module). */
+			TArray<const FGASCoreAttributeTagBinding*> Bindings;
+
+			TMap<FGameplayTag, FGameplayAttribute> AttributesByTag;
+			TMap<FGameplayAttribute, FGameplayTag> TagsByAttribute;
+
+			/** Maps reflect Bindings. */
+			bool bBuilt = false;
+
+			/** In-flight BuildAsync task (game thread owns the handle). */
+			UE::Tasks::FTask PendingBuild;
+		};
+
+		// Function-local static: bindings are constructed during static init of arbitrary modules.
+		static FRegistry& Get()
+		{
+			static FRegistry Registry;
+			return Registry;
+		}
+
+		/** Block until an in-flight BuildAsync finished (no-op when none is pending). */
+		static void WaitForPendingBuild()
+		{
+			FRegistry& Registry = Get();
+			if (Registry.PendingBuild.IsValid())
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(GASCoreAttributeTagRegistry::WaitForPendingBuild);
+				Registry.PendingBuild.Wait();
+				Registry.PendingBuild = UE::Tasks::FTask();
+			}
+		}
+
+		static void BuildMaps();
+
+		static void EnsureBuilt()
+		{
+			WaitForPendingBuild();
+			if (!Get().bBuilt)
+			{
+				BuildMaps();
+			}
+		}
+	}
+
+	void Build()
+	{
+		Private::WaitForPendingBuild();
+		Private::BuildMaps();
+	}
+
+	void BuildAsync()
+	{
+		check(IsInGameThread());
+		Private::WaitForPendingBuild();
+
+		// Bindings are only added/removed on the game thread (module load), which waits for this task first.
+		Private::Get().PendingBuild = UE::Tasks::Launch(UE_SOURCE_LOCATION, &Private::BuildMaps);
+	}
+
+	void Private::BuildMaps()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(GASCoreAttributeTagRegistry::BuildMaps);
+
+		Private::FRegistry& Registry = Private::Get();
+		Registry.AttributesByTag.Reset();
+		Registry.TagsByAttribute.Reset();
+		Registry.AttributesByTag.Reserve(Registry.Bindings.Num());
+		Registry.TagsByAttribute.Reserve(Registry.Bindings.Num());
+
+		for (const FGASCoreAttributeTagBinding* Binding : Registry.Bindings)
+		{
+			const FGameplayTag Tag = Binding->Tag.GetTag();
+			UClass* AttributeSetClass = Binding->GetAttributeSetClass();
+			FProperty* Property = AttributeSetClass ? FindFProperty<FProperty>(AttributeSetClass, Binding->PropertyName) : nullptr;
+			if (!Tag.IsValid() || !Property)
+			{
+				GASCORE_LOG_ERROR(TEXT("Attribute tag binding [%s] -> [%s.%s] does not resolve."),
+					*Tag.ToString(), *GetNameSafe(AttributeSetClass), Binding->PropertyName);
+				continue;
+			}
+
+			const FGameplayAttribute Attribute(Property);
+			Registry.AttributesByTag.Add(Tag, Attribute);
+			Registry.TagsByAttribute.Add(Attribute, Tag);
+		}
+		Registry.bBuilt = true;
+	}
+
+	FGameplayAttribute FindAttribute(const FGameplayTag& AttributeTag)
+	{
+		Private::EnsureBuilt();
+		const FGameplayAttribute* Attribute = Private::Get().AttributesByTag.Find(AttributeTag);
+		return Attribute ? *Attribute : FGameplayAttribute();
+	}
+
+	FGameplayTag FindTag(const FGameplayAttribute& Attribute)
+	{
+		Private::EnsureBuilt();
+		const FGameplayTag* Tag = Private::Get().TagsByAttribute.Find(Attribute);
+		return Tag ? *Tag : FGameplayTag();
+	}
+
+	const TMap<FGameplayTag, FGameplayAttribute>& GetAttributesByTag()
+	{
+		Private::EnsureBuilt();
+		return Private::Get().AttributesByTag;
+	}
+}
+
+FGASCoreAttributeTagBinding::FGASCoreAttributeTagBinding(const FNativeGameplayTag& InTag, const FGetAttributeSetClass InGetAttributeSetClass,
+	const TCHAR* InPropertyName)
+	: Tag(InTag)
+	, GetAttributeSetClass(InGetAttributeSetClass)
+	, PropertyName(InPropertyName)
+{
+	GASCoreAttributeTagRegistry::Private::WaitForPendingBuild();
+
+	GASCoreAttributeTagRegistry::Private::FRegistry& Registry = GASCoreAttributeTagRegistry::Private::Get();
+	Registry.Bindings.Add(this);
+	Registry.bBuilt = false;
+}
+
+FGASCoreAttributeTagBinding::~FGASCoreAttributeTagBinding()
+{
+	GASCoreAttributeTagRegistry::Private::WaitForPendingBuild();
+
+	GASCoreAttributeTagRegistry::Private::FRegistry& Registry = GASCoreAttributeTagRegistry::Private::Get();
+	Registry.Bindings.RemoveSingleSwap(this);
+	Registry.bBuilt = false;
+}
@@ -7,6 +7,8 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 
 
 UGASCoreAbilityInitComponent::UGASCoreAbilityInitComponent()
@@ -27,5 +29,94 @@ void UGASCoreAbilityInitComponent::AddCharacterAbilities()
 	{
 		CoreAbilitySystemComponent->AddCharacterAbilities(StartupAbilities);
 	}
+
+	// Soft abilities: once per component (re-possession calls this again); already-resident classes grant now.
+	if (SoftStartupAbilities.IsEmpty() || bSoftStartupAbilitiesGranted || IsLoadingStartupAbilities()) return;
+
+	TArray<FSoftObjectPath> PathsToLoad;
+	for (const TSoftClassPtr<UGameplayAbility>& AbilityClass : SoftStartupAbilities)
+	{
+		if (!AbilityClass.IsNull() && !AbilityClass.Get())
+		{
+			PathsToLoad.Add(AbilityClass.ToSoftObjectPath());
+		}
+	}
+
+	if (PathsToLoad.IsEmpty())
+	{
+		GrantSoftStartupAbilities();
+		return;
+	}
+
+	StartupAbilitiesHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(PathsToLoad),
+		FStreamableDelegate::CreateUObject(this, &UGASCoreAbilityInitComponent::HandleStartupAbilitiesLoaded),
+		FStreamableManager::AsyncLoadHighPriority);
+}
+
+bool UGASCoreAbilityInitComponent::TryActivateStartupAbility(const TSoftClassPtr<UGameplayAbility> AbilityClass)
+{
+	if (AbilityClass.IsNull()) return false;
+
+	if (IsLoadingStartupAbilities() && SoftStartupAbilities.Contains(AbilityClass))
+	{
+		QueuedActivations.AddUnique(AbilityClass);
+		return true;
+	}
+
+	UAbilitySystemComponent* AbilitySystemComponent = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(GetOwner());
+	const TSubclassOf<UGameplayAbility> LoadedClass = AbilityClass.Get();
+	return AbilitySystemComponent && LoadedClass && AbilitySystemComponent->TryActivateAbilityByClass(LoadedClass);
+}
+
+bool UGASCoreAbilityInitComponent::IsLoadingStartupAbilities() const
+{
+	return StartupAbilitiesHandle.IsValid() && StartupAbilitiesHandle->IsLoadingInProgress();
 }
 
+void UGASCoreAbilityInitComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (StartupAbilitiesHandle.IsValid())
+	{
+		StartupAbilitiesHandle->CancelHandle();
+		StartupAbilitiesHandle.Reset();
+	}
+	QueuedActivations.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UGASCoreAbilityInitComponent::HandleStartupAbilitiesLoaded()
+{
+	GrantSoftStartupAbilities();
+
+	// Moved out first: activation may queue again (it then runs at once, nothing is loading anymore).
+	UAbilitySystemComponent* AbilitySystemComponent = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(GetOwner());
+	const TArray<TSoftClassPtr<UGameplayAbility>> Activations = MoveTemp(QueuedActivations);
+	for (const TSoftClassPtr<UGameplayAbility>& AbilityClass : Activations)
+	{
+		if (AbilitySystemComponent && AbilityClass.Get())
+		{
+			AbilitySystemComponent->TryActivateAbilityByClass(AbilityClass.Get());
+		}
+	}
+}
+
+void UGASCoreAbilityInitComponent::GrantSoftStartupAbilities()
+{
+	UGASCoreAbilitySystemComponent* CoreAbilitySystemComponent =
+		Cast<UGASCoreAbilitySystemComponent>(UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(GetOwner()));
+	if (!CoreAbilitySystemComponent) return;
+
+	TArray<TSubclassOf<UGameplayAbility>> LoadedAbilities;
+	LoadedAbilities.Reserve(SoftStartupAbilities.Num());
+	for (const TSoftClassPtr<UGameplayAbility>& AbilityClass : SoftStartupAbilities)
+	{
+		if (UClass* LoadedClass = AbilityClass.Get())
+		{
+			LoadedAbilities.Add(LoadedClass);
+		}
+	}
+
+	bSoftStartupAbilitiesGranted = true;
+	CoreAbilitySystemComponent->AddCharacterAbilities(LoadedAbilities);
+}
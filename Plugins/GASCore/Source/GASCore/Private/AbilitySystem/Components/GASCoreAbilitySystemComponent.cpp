@@ -5,48 +5,670 @@
 //
 // Implementation notes:
 // - We bind using AddUObject (vs AddLambda) so GC/unbinding is managed by UE
-// - Call BindASCDelegates() once after InitAbilityActorInfo
-// - If you grant/remove abilities repeatedly or re-init actor info (e.g., on possession changes),
-//   ensure you don't bind multiple times (track a bool or remove binding if needed).
+// - Call BindASCDelegates() after InitAbilityActorInfo; bASCDelegatesBound makes repeated calls (possession
+//   changes, pooled avatars) no-ops.
+// - Attribute delta batching: ASCs with pending deltas are flushed through GASCoreEndOfFrame
+//   (one global FCoreDelegates::OnEndFrame binding, not one per component).
+// - MakeOutgoingSpec/ApplyGameplayEffectSpecToSelf overrides add GASCoreEffectProfiler scopes; the latter also
+//   wakes a dormant (lazily initialized) ASC before the effect lands. NotifyAbilityActivated counts activations.
+// - GASCoreFrameBudget scopes: effect application, input activation and the attribute delta flush.
+// - Tick: with GASCore.AbilityTick.Consolidate, SetComponentTickEnabled hands the component to
+//   UGASCoreAbilityTickSubsystem; the own tick function is never enabled.
+// - Executed cues with a High/Cosmetic routing rule bypass the engine multicast: Call_InvokeGameplayCueExecuted_*
+//   hands them to UGASCoreGameplayCueRoutingSubsystem, which sends each viewer its visible cues through
+//   ClientExecuteCueBurst on the viewer's own ASC.
+// - Activation latency: Call_InvokeGameplayCueExecuted_* also reports the first cue of the ability behind the cue's
+//   effect context (the instanced ability on the machine that activated it). Recording is compiled out in Shipping.
+// - InitAbilityActorInfo registers with UGASCoreAbilitySystemRegistrySubsystem (the debugger's per-world ASC list);
+//   OnUnregister leaves it and drops the ASC's GASCoreEffectProfiler cost entry.
+// - PreReplication / CallRemoteFunction feed GASCoreNetBandwidth while GASCore.NetBandwidth.Enable is set.
+// - Held/released input resolves specs through AbilitySpecsByInputTag; the HasTagExact re-check only guards
+//   against dynamic tags edited behind the index's back (outside RemapAbilityInputTag).
 
 #include "GASCore/Public/AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
 
 #include "AbilitySystem/Abilities/GASCoreGameplayAbility.h"
+#include "AbilitySystem/Abilities/GASCoreProjectileAbility.h"
+#include "AbilitySystem/Attributes/GASCoreAttributeSet.h"
+#include "Actors/GASCoreGameplayEffectActor.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "GameplayEffect.h"
+#include "GASCoreStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Subsystems/GASCoreAbilitySystemRegistrySubsystem.h"
+#include "Subsystems/GASCoreAbilityTickSubsystem.h"
+#include "Subsystems/GASCoreGameplayCueRoutingSubsystem.h"
+#include "Utilities/GASCoreAbilityLatency.h"
+#include "Utilities/GASCoreEffectProfiler.h"
+#include "Utilities/GASCoreEndOfFrame.h"
+#include "Utilities/GASCoreFrameBudget.h"
+#include "Utilities/GASCoreNetBandwidth.h"
+
+static TAutoConsoleVariable<bool> CVarGASCoreActivationFailureCache(
+	TEXT("GASCore.AbilityInput.FailureCache"),
+	true,
+	TEXT("Skip held-input TryActivateAbility while a cached cooldown/cost failure still holds."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreActivationFailureCacheMaxAge(
+	TEXT("GASCore.AbilityInput.FailureCacheMaxAge"),
+	0.5f,
+	TEXT("Seconds a cached cost failure is trusted without a change of its cost attributes (MMC-driven costs)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreAbilityInputBufferWindow(
+	TEXT("GASCore.AbilityInput.BufferWindow"),
+	0.25f,
+	TEXT("Seconds a blocked ability input is remembered and replayed once it could succeed (plus half the owner's ping). 0 = off."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarGASCoreAbilityRPCBatching(
+	TEXT("GASCore.AbilityInput.RPCBatching"),
+	true,
+	TEXT("Batch activate/target data/end server RPCs of input-activated abilities with bBatchServerRPCs."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<FString> CVarGASCoreEffectNotifyDefaultTagRoot(
+	TEXT("GASCore.EffectNotify.DefaultTagRoot"),
+	TEXT("UI.Message"),
+	TEXT("Asset tag root (children included) sent to the owning client on effect application when an ASC sets no EffectNotifyTagRoots."),
+	ECVF_Default);
+
+namespace GASCoreStartupInputTags
+{
+	/** Per ability class: StartupInputTag of its CDO (only UGASCoreGameplayAbility classes are granted). */
+	struct FEntry
+	{
+		bool bCoreAbility = false;
+		FGameplayTag InputTag;
+	};
+
+	/** Keyed by class identity: a recompiled Blueprint class is a new key. */
+	static TMap<TObjectKey<UClass>, FEntry> Cache;
+
+	static const FEntry& Find(const TSubclassOf<UGameplayAbility> AbilityClass)
+	{
+		if (const FEntry* Entry = Cache.Find(AbilityClass.Get()))
+		{
+			return *Entry;
+		}
+
+		FEntry Entry;
+		if (const UGASCoreGameplayAbility* CoreAbility = Cast<UGASCoreGameplayAbility>(AbilityClass->GetDefaultObject()))
+		{
+			Entry.bCoreAbility = true;
+			Entry.InputTag = CoreAbility->StartupInputTag;
+		}
+		return Cache.Add(AbilityClass.Get(), Entry);
+	}
+}
+
+namespace GASCoreDeferredEffectNotify
+{
+	/** Nesting depth of FGASCoreDeferredEffectNotifyScope (game thread). */
+	static int32 ScopeDepth = 0;
+
+	/** ASCs holding deferred notifications. */
+	static TArray<TWeakObjectPtr<UGASCoreAbilitySystemComponent>> PendingComponents;
+}
+
+FGASCoreDeferredEffectNotifyScope::FGASCoreDeferredEffectNotifyScope()
+{
+	check(IsInGameThread());
+	++GASCoreDeferredEffectNotify::ScopeDepth;
+}
+
+FGASCoreDeferredEffectNotifyScope::~FGASCoreDeferredEffectNotifyScope()
+{
+	if (--GASCoreDeferredEffectNotify::ScopeDepth > 0)
+	{
+		return;
+	}
+
+	// Moved out first: listeners may apply effects (and open scopes) again.
+	TArray<TWeakObjectPtr<UGASCoreAbilitySystemComponent>> Components = MoveTemp(GASCoreDeferredEffectNotify::PendingComponents);
+	for (const TWeakObjectPtr<UGASCoreAbilitySystemComponent>& Component : Components)
+	{
+		if (UGASCoreAbilitySystemComponent* ASC = Component.Get())
+		{
+			ASC->FlushDeferredEffectAssetTags();
+		}
+	}
+}
+
+bool FGASCoreDeferredEffectNotifyScope::IsActive()
+{
+	return GASCoreDeferredEffectNotify::ScopeDepth > 0;
+}
 
 void UGASCoreAbilitySystemComponent::BindASCDelegates()
 {
+	if (bASCDelegatesBound)
+	{
+		return;
+	}
+	bASCDelegatesBound = true;
+
 	// Register to receive a callback whenever a GameplayEffect is applied to self.
 	// Using AddUObject ties the delegate lifetime to this UObject (safe unbinding on destruction).
-	OnGameplayEffectAppliedDelegateToSelf.AddUObject(this, &UGASCoreAbilitySystemComponent::ClientHandleGameplayEffectAppliedToSelf);
+	OnGameplayEffectAppliedDelegateToSelf.AddUObject(this, &UGASCoreAbilitySystemComponent::HandleGameplayEffectAppliedToSelf);
+	OnAnyGameplayEffectRemovedDelegate().AddUObject(this, &UGASCoreAbilitySystemComponent::HandleActiveEffectRemoved);
+	AbilityEndedCallbacks.AddUObject(this, &UGASCoreAbilitySystemComponent::HandleAbilityEndedForInputBuffer);
+
+	BindAttributeDeltaBatching();
+}
+
+void UGASCoreAbilitySystemComponent::BindAttributeDeltaBatching()
+{
+	if (bAttributeDeltaBatchingBound)
+	{
+		return;
+	}
+	bAttributeDeltaBatchingBound = true;
+
+	for (const UAttributeSet* Set : GetSpawnedAttributes())
+	{
+		if (const UGASCoreAttributeSet* CoreSet = Cast<UGASCoreAttributeSet>(Set))
+		{
+			// Prebuilt attribute handles from the class table.
+			for (const FGameplayAttribute& Attribute : FGASCoreAttributeMetadata::Get(CoreSet).Attributes)
+			{
+				GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGASCoreAbilitySystemComponent::QueueAttributeDelta);
+			}
+		}
+		else if (Set)
+		{
+			for (TFieldIterator<FStructProperty> It(Set->GetClass()); It; ++It)
+			{
+				if (FGameplayAttribute::IsGameplayAttributeDataProperty(*It))
+				{
+					GetGameplayAttributeValueChangeDelegate(FGameplayAttribute(*It)).AddUObject(this, &UGASCoreAbilitySystemComponent::QueueAttributeDelta);
+				}
+			}
+		}
+	}
 }
 
-void UGASCoreAbilitySystemComponent::ClientHandleGameplayEffectAppliedToSelf_Implementation(
-	UAbilitySystemComponent* AbilitySystemComponent,
-	const FGameplayEffectSpec& GameplayEffectSpec,
-	FActiveGameplayEffectHandle ActiveGameplayEffectHandle)
+void UGASCoreAbilitySystemComponent::QueueAttributeDelta(const FOnAttributeChangeData& ChangeData)
 {
-	// Gather asset tags from the applied spec.
-	// Note: GetAllAssetTags aggregates inheritable owned tags, granted tags, and any tags added to the spec at runtime.
-	FGameplayTagContainer GameplayTagContainer;
-	GameplayEffectSpec.GetAllAssetTags(GameplayTagContainer);
+	// A cost attribute moved: the ability may be affordable now.
+	if (!ActivationFailures.IsEmpty())
+	{
+		ActivationFailures.RemoveAllSwap([&ChangeData](const FActivationFailure& Failure)
+		{
+			return Failure.CostAttributes.Contains(ChangeData.Attribute);
+		}, EAllowShrinking::No);
+	}
+
+	ScheduleAttributeDeltaFlush();
+
+	// Coalesce: keep the first OldValue of the frame, take the latest NewValue (few entries → linear scan).
+	for (FGASCoreAttributeDelta& Delta : PendingAttributeDeltas)
+	{
+		if (Delta.Attribute == ChangeData.Attribute)
+		{
+			Delta.NewValue = ChangeData.NewValue;
+			return;
+		}
+	}
+	PendingAttributeDeltas.Add({ ChangeData.Attribute, ChangeData.OldValue, ChangeData.NewValue });
+}
+
+void UGASCoreAbilitySystemComponent::QueueDamageEvent(AActor* Instigator, const float Damage)
+{
+	if (Damage <= 0.f)
+	{
+		return;
+	}
+	ScheduleAttributeDeltaFlush();
+
+	for (FGASCoreDamageEvent& Event : PendingDamageEvents)
+	{
+		if (Event.Instigator.Get() == Instigator)
+		{
+			Event.Damage += Damage;
+			return;
+		}
+	}
+	PendingDamageEvents.Add({ Instigator, Damage });
+}
+
+void UGASCoreAbilitySystemComponent::ScheduleAttributeDeltaFlush()
+{
+	if (!bAttributeDeltaFlushScheduled)
+	{
+		bAttributeDeltaFlushScheduled = true;
+		GASCoreEndOfFrame::Schedule(this, [](UObject* Object)
+		{
+			CastChecked<UGASCoreAbilitySystemComponent>(Object)->FlushAttributeDeltas();
+		});
+	}
+}
+
+void UGASCoreAbilitySystemComponent::FlushAttributeDeltas()
+{
+	GASCORE_TRACE_SCOPE(UGASCoreAbilitySystemComponent::FlushAttributeDeltas);
+	GASCORE_FRAME_BUDGET_SCOPE(AttributeCallbacks);
+	bAttributeDeltaFlushScheduled = false;
+	if (PendingAttributeDeltas.IsEmpty() && PendingDamageEvents.IsEmpty())
+	{
+		return;
+	}
+
+	// Swap so listeners may queue new deltas while iterating the batch.
+	Swap(BroadcastAttributeDeltas, PendingAttributeDeltas);
+	Swap(BroadcastDamageEvents, PendingDamageEvents);
+
+	// Changes that returned to their start value within the frame are not deltas.
+	BroadcastAttributeDeltas.RemoveAllSwap([](const FGASCoreAttributeDelta& Delta)
+	{
+		return Delta.OldValue == Delta.NewValue;
+	}, EAllowShrinking::No);
 
+	if (!BroadcastAttributeDeltas.IsEmpty())
+	{
+		OnAttributeDeltaBatch.Broadcast(BroadcastAttributeDeltas);
+	}
+	BroadcastAttributeDeltas.Reset();
+
+	if (!BroadcastDamageEvents.IsEmpty())
+	{
+		OnDamageEventBatch.Broadcast(BroadcastDamageEvents);
+	}
+	BroadcastDamageEvents.Reset();
+}
+
+SIZE_T UGASCoreAbilitySystemComponent::GetCoreAllocatedSize() const
+{
+	SIZE_T Bytes = AbilitySpecsByInputTag.GetAllocatedSize() + AbilityCostPreviews.GetAllocatedSize()
+		+ AbilityLatencyTimes.GetAllocatedSize() + ActivationFailures.GetAllocatedSize()
+		+ PendingAttributeDeltas.GetAllocatedSize() + BroadcastAttributeDeltas.GetAllocatedSize()
+		+ PendingDamageEvents.GetAllocatedSize() + BroadcastDamageEvents.GetAllocatedSize()
+		+ DeferredEffectAssetTags.GetGameplayTagArray().GetAllocatedSize();
+	for (const TPair<FGameplayTag, TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>>>& Pair : AbilitySpecsByInputTag)
+	{
+		Bytes += Pair.Value.GetAllocatedSize();
+	}
+	for (const TPair<FGameplayAbilitySpecHandle, FAbilityCostPreview>& Pair : AbilityCostPreviews)
+	{
+		Bytes += Pair.Value.Costs.GetAllocatedSize();
+	}
+	for (const FActivationFailure& Failure : ActivationFailures)
+	{
+		Bytes += Failure.CostAttributes.GetAllocatedSize();
+	}
+	return Bytes;
+}
+
+void UGASCoreAbilitySystemComponent::ResetForReuse(const bool bKeepAbilities)
+{
+	if (!IsOwnerActorAuthoritative())
+	{
+		return;
+	}
+
+	CancelAllAbilities();
+	if (!bKeepAbilities)
+	{
+		ClearAllAbilities();
+	}
+
+	// Cooldowns, buffs and DoTs alike; their granted tags and modifiers go with them.
+	for (const FActiveGameplayEffectHandle& Handle : ActiveGameplayEffects.GetAllActiveEffectHandles())
+	{
+		RemoveActiveGameplayEffect(Handle);
+	}
+
+	// Whatever is still owned now is loose (explicit counts; parents follow their children).
+	FGameplayTagContainer RemainingTags;
+	GetOwnedGameplayTags(RemainingTags);
+	for (const FGameplayTag& Tag : RemainingTags)
+	{
+		const int32 Count = GameplayTagCountContainer.GetExplicitTagCount(Tag);
+		if (Count > 0)
+		{
+			RemoveLooseGameplayTag(Tag, Count);
+		}
+	}
+
+	ActivationFailures.Reset();
+	AbilityCostPreviews.Reset();
+	AbilityLatencyTimes.Reset();
+	BufferedInputTag = FGameplayTag();
+}
+
+void UGASCoreAbilitySystemComponent::InitAbilityActorInfo(AActor* InOwnerActor, AActor* InAvatarActor)
+{
+	Super::InitAbilityActorInfo(InOwnerActor, InAvatarActor);
+
+	if (UGASCoreAbilitySystemRegistrySubsystem* Registry = UGASCoreAbilitySystemRegistrySubsystem::Get(this))
+	{
+		Registry->Register(this);
+	}
+}
+
+void UGASCoreAbilitySystemComponent::OnUnregister()
+{
+	// Nothing must outlive the component; the weak entry in the pending list simply stops resolving.
+	PendingAttributeDeltas.Reset();
+	PendingDamageEvents.Reset();
+
+	if (UGASCoreAbilitySystemRegistrySubsystem* Registry = UGASCoreAbilitySystemRegistrySubsystem::Get(this))
+	{
+		Registry->Unregister(this);
+	}
+
+	if (UGASCoreAbilityTickSubsystem* TickSubsystem = UGASCoreAbilityTickSubsystem::Get(this))
+	{
+		TickSubsystem->Unregister(this);
+	}
+
+#if GASCORE_EFFECT_PROFILER
+	GASCoreEffectProfiler::RemoveAbilitySystem(this);
+#endif
+
+	Super::OnUnregister();
+}
+
+void UGASCoreAbilitySystemComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+#if GASCORE_NET_BANDWIDTH
+	if (GASCoreNetBandwidth::IsEnabled())
+	{
+		GASCoreNetBandwidth::RecordReplication(*this);
+	}
+#endif
+}
+
+bool UGASCoreAbilitySystemComponent::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+#if GASCORE_NET_BANDWIDTH
+	if (Function && GASCoreNetBandwidth::IsEnabled())
+	{
+		GASCoreNetBandwidth::RecordRemoteFunction(*this, *Function, Parameters);
+	}
+#endif
+	return Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+}
+
+void UGASCoreAbilitySystemComponent::SetComponentTickEnabled(const bool bEnabled)
+{
+	UGASCoreAbilityTickSubsystem* TickSubsystem = !IsTemplate() && UGASCoreAbilityTickSubsystem::IsConsolidationEnabled()
+		? UGASCoreAbilityTickSubsystem::Get(this) : nullptr;
+	if (!TickSubsystem)
+	{
+		Super::SetComponentTickEnabled(bEnabled);
+		return;
+	}
+
+	// Switched on at runtime: make sure the own tick function does not run alongside the shared pass.
+	if (IsComponentTickEnabled())
+	{
+		Super::SetComponentTickEnabled(false);
+	}
+
+	// Registered for as long as the component is active, work or not: UpdateShouldTick only toggles activation, so an
+	// active component that gains a ticking task later gets no new call (the pass skips it while idle).
+	if (bEnabled)
+	{
+		TickSubsystem->Register(this);
+	}
+	else
+	{
+		TickSubsystem->Unregister(this);
+	}
+}
+
+FGameplayEffectSpecHandle UGASCoreAbilitySystemComponent::MakeOutgoingSpec(const TSubclassOf<UGameplayEffect> GameplayEffectClass,
+	const float Level, FGameplayEffectContextHandle Context) const
+{
+	GASCORE_TRACE_SCOPE(UGASCoreAbilitySystemComponent::MakeOutgoingSpec);
+#if GASCORE_EFFECT_PROFILER
+	GASCORE_EFFECT_COST_SCOPE(EGASCoreEffectCostPhase::SpecCreation, GameplayEffectClass.Get(),
+		GASCoreEffectProfiler::IsEnabled() ? GASCoreEffectProfiler::GetContextSource(Context) : nullptr, this);
+#endif
+	return Super::MakeOutgoingSpec(GameplayEffectClass, Level, Context);
+}
+
+FActiveGameplayEffectHandle UGASCoreAbilitySystemComponent::ApplyGameplayEffectSpecToSelf(const FGameplayEffectSpec& GameplayEffect,
+	FPredictionKey PredictionKey)
+{
+	GASCORE_TRACE_SCOPE(UGASCoreAbilitySystemComponent::ApplyGameplayEffectSpecToSelf);
+	GASCORE_FRAME_BUDGET_SCOPE(EffectApplication);
+	// Dormant owner: actor info, delegates and grants first, so the effect sees a fully initialized ASC.
+	if (OnDemandInitialization.IsBound())
+	{
+		RunOnDemandInitialization();
+	}
+
+#if GASCORE_EFFECT_PROFILER
+	// Instant specs run modifiers/executions now; Duration/Infinite ones add aggregator mods and re-evaluate.
+	const bool bProfile = GASCoreEffectProfiler::IsEnabled() && GameplayEffect.Def;
+	GASCORE_EFFECT_APPLICATION_SCOPE(
+		bProfile && GameplayEffect.Def->DurationPolicy != EGameplayEffectDurationType::Instant
+			? EGASCoreEffectCostPhase::Aggregation : EGASCoreEffectCostPhase::Execution,
+		bProfile ? GameplayEffect.Def->GetClass() : nullptr,
+		bProfile ? GASCoreEffectProfiler::GetContextSource(GameplayEffect.GetContext()) : nullptr, this);
+#endif
+	return Super::ApplyGameplayEffectSpecToSelf(GameplayEffect, PredictionKey);
+}
+
+void UGASCoreAbilitySystemComponent::NotifyAbilityActivated(const FGameplayAbilitySpecHandle Handle, UGameplayAbility* Ability)
+{
+#if GASCORE_EFFECT_PROFILER
+	if (GASCoreEffectProfiler::IsEnabled())
+	{
+		GASCoreEffectProfiler::RecordAbilityActivation(this);
+	}
+#endif
+	Super::NotifyAbilityActivated(Handle, Ability);
+}
+
+void UGASCoreAbilitySystemComponent::RunOnDemandInitialization()
+{
+	// Consumed before running: the initialization may itself apply effects to self.
+	const FSimpleDelegate Initialization = MoveTemp(OnDemandInitialization);
+	OnDemandInitialization.Unbind();
+	Initialization.ExecuteIfBound();
+}
+
+void UGASCoreAbilitySystemComponent::HandleGameplayEffectAppliedToSelf(UAbilitySystemComponent* AbilitySystemComponent,
+	const FGameplayEffectSpec& GameplayEffectSpec, FActiveGameplayEffectHandle ActiveGameplayEffectHandle)
+{
+	GASCORE_TRACE_SCOPE(UGASCoreAbilitySystemComponent::HandleGameplayEffectAppliedToSelf);
+	// Evaluated here (server) so the client only hears about effects it displays, and only their tags.
+	// Note: GetAllAssetTags aggregates the GE's asset tags and any tags added to the spec at runtime.
+	FGameplayTagContainer AssetTags;
+	GameplayEffectSpec.GetAllAssetTags(AssetTags);
+
+	FGameplayTagContainer NotifyTags;
+	if (!EffectNotifyTagRoots.IsEmpty())
+	{
+		NotifyTags = AssetTags.Filter(EffectNotifyTagRoots);
+	}
+	else
+	{
+		// Resolved per call: the CVar may change at runtime and unknown names resolve to an empty tag (no messages).
+		const FGameplayTag DefaultRoot = FGameplayTag::RequestGameplayTag(FName(*CVarGASCoreEffectNotifyDefaultTagRoot.GetValueOnGameThread()), false);
+		NotifyTags = DefaultRoot.IsValid() ? AssetTags.Filter(FGameplayTagContainer(DefaultRoot)) : FGameplayTagContainer();
+	}
+	if (NotifyTags.IsEmpty())
+	{
+		return;
+	}
+
+	// Coalesce: one RPC per frame (or per FGASCoreDeferredEffectNotifyScope) with the union of the tags.
+	if (!bHasDeferredEffectAssetTags)
+	{
+		bHasDeferredEffectAssetTags = true;
+		if (FGASCoreDeferredEffectNotifyScope::IsActive())
+		{
+			GASCoreDeferredEffectNotify::PendingComponents.Add(this);
+		}
+		else
+		{
+			GASCoreEndOfFrame::Schedule(this, [](UObject* Object)
+			{
+				CastChecked<UGASCoreAbilitySystemComponent>(Object)->FlushDeferredEffectAssetTags();
+			});
+		}
+	}
+	DeferredEffectAssetTags.AppendTags(NotifyTags);
+}
+
+void UGASCoreAbilitySystemComponent::FlushDeferredEffectAssetTags()
+{
+	if (!bHasDeferredEffectAssetTags)
+	{
+		return;
+	}
+
+	bHasDeferredEffectAssetTags = false;
+	const FGameplayTagContainer AssetTags = MoveTemp(DeferredEffectAssetTags);
+	DeferredEffectAssetTags.Reset();
+	ClientHandleDeferredEffectAssetTags(AssetTags);
+}
+
+void UGASCoreAbilitySystemComponent::ServerPredictedPickup_Implementation(AGASCoreGameplayEffectActor* Pickup, FPredictionKey PredictionKey)
+{
+	// Applications inside the window carry the client's key; the window acknowledges the key either way.
+	FScopedPredictionWindow ScopedPrediction(this, PredictionKey);
+	if (!IsValid(Pickup) || !Pickup->ConfirmPredictedPickup(this, PredictionKey))
+	{
+		ClientPredictedPickupRejected(Pickup);
+	}
+}
+
+void UGASCoreAbilitySystemComponent::ServerReportProjectileHit_Implementation(const FGameplayAbilitySpecHandle AbilityHandle,
+	const FGASCoreProjectileHitReport& Report)
+{
+	const FGameplayAbilitySpec* Spec = FindAbilitySpecFromHandle(AbilityHandle);
+	UGASCoreProjectileAbility* Ability = Spec ? Cast<UGASCoreProjectileAbility>(Spec->GetPrimaryInstance()) : nullptr;
+	if (Ability)
+	{
+		Ability->HandleReportedHit(Report);
+	}
+}
+
+void UGASCoreAbilitySystemComponent::ClientPredictedPickupRejected_Implementation(AGASCoreGameplayEffectActor* Pickup)
+{
+	if (IsValid(Pickup))
+	{
+		Pickup->RollbackPredictedPickup();
+	}
+}
+
+void UGASCoreAbilitySystemComponent::ClientHandleDeferredEffectAssetTags_Implementation(const FGameplayTagContainer& AssetTags)
+{
 	// Forward to consumers (e.g., HUD Widget Controller) for UI reactions.
-	OnEffectAssetTags.Broadcast(GameplayTagContainer);
+	OnEffectAssetTags.Broadcast(AssetTags);
+}
+
+void UGASCoreAbilitySystemComponent::ClientExecuteCueBurst_Implementation(const TArray<FGASCoreBatchedCue>& Cues)
+{
+	AGASCoreGameplayCueBurstActor::ExecuteCues(GetOwner(), Cues);
+}
+
+const UNetConnection* UGASCoreAbilitySystemComponent::GetCuePredictingConnection(const FPredictionKey& PredictionKey) const
+{
+	// Same rule as the engine multicast: the client that generated the key played the cue itself.
+	const AActor* Owner = GetOwner();
+	return Owner && PredictionKey.IsValidKey() && !PredictionKey.IsServerInitiatedKey() ? Owner->GetNetConnection() : nullptr;
+}
+
+void UGASCoreAbilitySystemComponent::Call_InvokeGameplayCueExecuted_FromSpec(const FGameplayEffectSpecForRPC Spec,
+	FPredictionKey PredictionKey)
+{
+	NotifyAbilityLatencyCueFromContext(Spec.GetContext());
 
-	// Optional: You could also surface GrantedTags or Cue tags if needed:
-	// GameplayEffectSpec.CapturedSourceTags.GetSpecTags();
-	// or GameplayEffectSpec.Def->InheritableGameplayEffectTags.CombinedTags;
+	UGASCoreGameplayCueRoutingSubsystem* Routing = UGASCoreGameplayCueRoutingSubsystem::Get(this);
+	if (!Routing || !Routing->CanRoute() || !Spec.Def || Spec.Def->GameplayCues.IsEmpty())
+	{
+		Super::Call_InvokeGameplayCueExecuted_FromSpec(Spec, PredictionKey);
+		return;
+	}
+
+	// All or nothing: one Always cue keeps the whole spec on the multicast (it carries the full context).
+	for (const FGameplayEffectCue& EffectCue : Spec.Def->GameplayCues)
+	{
+		for (const FGameplayTag& CueTag : EffectCue.GameplayCueTags)
+		{
+			if (Routing->GetPriority(CueTag) == EGASCoreCueRoutingPriority::Always)
+			{
+				Super::Call_InvokeGameplayCueExecuted_FromSpec(Spec, PredictionKey);
+				return;
+			}
+		}
+	}
+
+	FGASCoreBatchedCue Cue;
+	Cue.Target = GetAvatarActor();
+	Cue.Location = Cue.Target ? Cue.Target->GetActorLocation() : FVector::ZeroVector;
+	if (const FHitResult* HitResult = Spec.GetContext().GetHitResult())
+	{
+		Cue.Location = HitResult->ImpactPoint;
+		Cue.Normal = HitResult->ImpactNormal;
+	}
+
+	const UNetConnection* PredictingConnection = GetCuePredictingConnection(PredictionKey);
+	for (const FGameplayEffectCue& EffectCue : Spec.Def->GameplayCues)
+	{
+		const FGameplayEffectModifiedAttribute* Modified = EffectCue.MagnitudeAttribute.IsValid()
+			? Spec.GetModifiedAttribute(EffectCue.MagnitudeAttribute) : nullptr;
+		Cue.Magnitude = Modified ? Modified->TotalMagnitude : Spec.GetLevel();
+		for (const FGameplayTag& CueTag : EffectCue.GameplayCueTags)
+		{
+			Cue.CueTag = CueTag;
+			Routing->QueueCue(Cue, PredictingConnection);
+		}
+	}
+}
+
+void UGASCoreAbilitySystemComponent::Call_InvokeGameplayCueExecuted_WithParams(const FGameplayTag GameplayCueTag,
+	FPredictionKey PredictionKey, FGameplayCueParameters GameplayCueParameters)
+{
+	NotifyAbilityLatencyCueFromContext(GameplayCueParameters.EffectContext);
+
+	UGASCoreGameplayCueRoutingSubsystem* Routing = UGASCoreGameplayCueRoutingSubsystem::Get(this);
+	if (!Routing || !Routing->ShouldRoute(GameplayCueTag))
+	{
+		Super::Call_InvokeGameplayCueExecuted_WithParams(GameplayCueTag, PredictionKey, GameplayCueParameters);
+		return;
+	}
+
+	FGASCoreBatchedCue Cue;
+	Cue.CueTag = GameplayCueTag;
+	Cue.Target = GetAvatarActor();
+	Cue.Location = !GameplayCueParameters.Location.IsZero() || !Cue.Target
+		? FVector(GameplayCueParameters.Location) : Cue.Target->GetActorLocation();
+	Cue.Normal = GameplayCueParameters.Normal.GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector);
+	Cue.Magnitude = GameplayCueParameters.RawMagnitude;
+	Routing->QueueCue(Cue, GetCuePredictingConnection(PredictionKey));
 }
 
 void UGASCoreAbilitySystemComponent::AddCharacterAbilities(
 	const TArray<TSubclassOf<UGameplayAbility>>& InStartupAbilities)
 {
+	if (InStartupAbilities.IsEmpty()) return;
+
+	// One GiveAbility per class: each marks its own item dirty (the fast array assigns replication ids that way),
+	// and all of them leave in the same net update. Reserving once only saves regrowing the spec array. No ability
+	// list lock here: under a lock GiveAbility queues to AbilityPendingAdds and re-grants one by one on release.
+	ActivatableAbilities.Items.Reserve(ActivatableAbilities.Items.Num() + InStartupAbilities.Num());
+
 	for (const TSubclassOf<UGameplayAbility> AbilityClass : InStartupAbilities)
 	{
-		FGameplayAbilitySpec AbilitySpec = FGameplayAbilitySpec(AbilityClass, 1);
-		if (const UGASCoreGameplayAbility* CoreGameplayAbility = Cast<UGASCoreGameplayAbility>(AbilitySpec.Ability))
+		if (!AbilityClass) continue;
+
+		const GASCoreStartupInputTags::FEntry& StartupInput = GASCoreStartupInputTags::Find(AbilityClass);
+		if (StartupInput.bCoreAbility)
 		{
-			AbilitySpec.GetDynamicSpecSourceTags().AddTag(CoreGameplayAbility->StartupInputTag);
+			FGameplayAbilitySpec AbilitySpec(AbilityClass, 1);
+			AbilitySpec.GetDynamicSpecSourceTags().AddTag(StartupInput.InputTag);
 			GiveAbility(AbilitySpec);
 		}
 	}
@@ -54,32 +676,491 @@ void UGASCoreAbilitySystemComponent::AddCharacterAbilities(
 
 void UGASCoreAbilitySystemComponent::AbilityInputTagHeld(const FGameplayTag& InputTag)
 {
-	if (!InputTag.IsValid()) return;
+	GASCORE_TRACE_SCOPE(UGASCoreAbilitySystemComponent::AbilityInputTagHeld);
+	ProcessHeldInputTag(InputTag);
+}
+
+void UGASCoreAbilitySystemComponent::AbilityInputTagsHeld(const TArrayView<const FGameplayTag> InputTags)
+{
+	GASCORE_TRACE_SCOPE(UGASCoreAbilitySystemComponent::AbilityInputTagsHeld);
+	for (int32 Index = 0; Index < InputTags.Num(); ++Index)
+	{
+		const FGameplayTag& InputTag = InputTags[Index];
+		if (!MakeArrayView(InputTags.GetData(), Index).Contains(InputTag))
+		{
+			ProcessHeldInputTag(InputTag);
+		}
+	}
+}
+
+void UGASCoreAbilitySystemComponent::ProcessHeldInputTag(const FGameplayTag& InputTag)
+{
+	const TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>>* IndexedHandles = AbilitySpecsByInputTag.Find(InputTag);
+	if (!InputTag.IsValid() || !IndexedHandles) return;
 
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+	// Copied: activation may grant/remove abilities and re-index.
+	const TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>> Handles(*IndexedHandles);
+	bool bActivated = false;
+	bool bBlocked = false;
+	for (const FGameplayAbilitySpecHandle& Handle : Handles)
 	{
-		FGameplayTagContainer& DynamicSpecSourceTags = AbilitySpec.GetDynamicSpecSourceTags();
-		if (DynamicSpecSourceTags.HasTagExact(InputTag))
+		FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(Handle);
+		if (!AbilitySpec || !AbilitySpec->GetDynamicSpecSourceTags().HasTagExact(InputTag)) continue;
+
+		AbilitySpecInputPressed(*AbilitySpec);
+		if (AbilitySpec->IsActive()) continue;
+
+		if (IsActivationFailureCached(Handle))
+		{
+			bBlocked = true;
+		}
+		else if (TryActivateAbilityFromInput(*AbilitySpec))
 		{
-			AbilitySpecInputPressed(AbilitySpec);
-			if (!AbilitySpec.IsActive())
+			bActivated = true;
+		}
+		else
+		{
+			bBlocked = true;
+
+			// Re-found: a failed activation may still have changed the ability list.
+			if (const FGameplayAbilitySpec* FailedSpec = FindAbilitySpecFromHandle(Handle))
 			{
-				TryActivateAbility(AbilitySpec.Handle);
+				CacheActivationFailure(*FailedSpec);
 			}
 		}
 	}
+
+	// Activated: nothing left to replay. Blocked: remember the press (the latest one wins).
+	if (bActivated)
+	{
+		BufferedInputTag = FGameplayTag();
+	}
+	else if (bBlocked)
+	{
+		BufferAbilityInput(InputTag);
+	}
 }
 
 void UGASCoreAbilitySystemComponent::AbilityInputTagReleased(const FGameplayTag& InputTag)
 {
-	if (!InputTag.IsValid()) return;
+	GASCORE_TRACE_SCOPE(UGASCoreAbilitySystemComponent::AbilityInputTagReleased);
+	const TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>>* IndexedHandles = AbilitySpecsByInputTag.Find(InputTag);
+	if (!InputTag.IsValid() || !IndexedHandles) return;
+
+	const TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>> Handles(*IndexedHandles);
+	for (const FGameplayAbilitySpecHandle& Handle : Handles)
+	{
+		FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(Handle);
+		if (AbilitySpec && AbilitySpec->GetDynamicSpecSourceTags().HasTagExact(InputTag))
+		{
+			AbilitySpecInputReleased(*AbilitySpec);
+		}
+	}
+}
+
+bool UGASCoreAbilitySystemComponent::ShouldDoServerAbilityRPCBatch() const
+{
+	return CVarGASCoreAbilityRPCBatching.GetValueOnGameThread();
+}
+
+bool UGASCoreAbilitySystemComponent::TryActivateAbilityFromInput(const FGameplayAbilitySpec& AbilitySpec, const double PressTime)
+{
+	GASCORE_TRACE_SCOPE(UGASCoreAbilitySystemComponent::TryActivateAbilityFromInput);
+	GASCORE_FRAME_BUDGET_SCOPE(AbilityActivation);
+	// Copied: the spec may move while the ability activates.
+	const FGameplayAbilitySpecHandle Handle = AbilitySpec.Handle;
+	const UGASCoreGameplayAbility* CoreAbility = Cast<UGASCoreGameplayAbility>(AbilitySpec.Ability);
+
+#if GASCORE_ABILITY_LATENCY
+	const bool bMeasureLatency = GASCoreAbilityLatency::IsEnabled();
+	if (bMeasureLatency)
+	{
+		AbilityLatencyTimes.Add(Handle, { PressTime > 0.0 ? PressTime : FPlatformTime::Seconds() });
+	}
+#endif
+
+	// The authority activates locally (no server RPCs to batch).
+	bool bActivated;
+	if (CoreAbility && CoreAbility->bBatchServerRPCs && !IsOwnerActorAuthoritative())
+	{
+		FScopedServerAbilityRPCBatcher AbilityRPCBatcher(this, Handle);
+		bActivated = TryActivateAbility(Handle);
+	}
+	else
+	{
+		bActivated = TryActivateAbility(Handle);
+	}
+
+#if GASCORE_ABILITY_LATENCY
+	if (bMeasureLatency && !bActivated)
+	{
+		AbilityLatencyTimes.Remove(Handle);
+	}
+#endif
+	return bActivated;
+}
+
+bool UGASCoreAbilitySystemComponent::CanAffordAbilityCost(const FGameplayAbilitySpecHandle Handle)
+{
+	const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(Handle);
+	if (!AbilitySpec) return false;
+
+	for (const TPair<FGameplayAttribute, float>& Cost : FindOrBuildAbilityCostPreview(*AbilitySpec).Costs)
+	{
+		bool bFound = false;
+		const float CurrentValue = GetGameplayAttributeValue(Cost.Key, bFound);
+		if (bFound && CurrentValue < Cost.Value)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool UGASCoreAbilitySystemComponent::CanAffordAbilityCostByInputTag(const FGameplayTag InputTag)
+{
+	const TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>>* Handles = AbilitySpecsByInputTag.Find(InputTag);
+	if (!Handles) return false;
+
+	for (const FGameplayAbilitySpecHandle& Handle : *Handles)
+	{
+		if (CanAffordAbilityCost(Handle))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+const UGASCoreAbilitySystemComponent::FAbilityCostPreview& UGASCoreAbilitySystemComponent::FindOrBuildAbilityCostPreview(
+	const FGameplayAbilitySpec& AbilitySpec)
+{
+	FAbilityCostPreview& Preview = AbilityCostPreviews.FindOrAdd(AbilitySpec.Handle);
+	if (Preview.Level == AbilitySpec.Level)
+	{
+		return Preview;
+	}
+
+	Preview.Level = AbilitySpec.Level;
+	Preview.Costs.Reset();
 
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+	const UGameplayEffect* CostEffect = AbilitySpec.Ability ? AbilitySpec.Ability->GetCostGameplayEffect() : nullptr;
+	if (!CostEffect)
 	{
-		FGameplayTagContainer& DynamicSpecSourceTags = AbilitySpec.GetDynamicSpecSourceTags();
-		if (DynamicSpecSourceTags.HasTagExact(InputTag))
+		return Preview;
+	}
+
+	// One spec per level: captures this ASC's source attributes for attribute-based and MMC magnitudes.
+	const FGameplayEffectSpecHandle CostSpecHandle = MakeOutgoingSpec(CostEffect->GetClass(), AbilitySpec.Level, MakeEffectContext());
+	if (!CostSpecHandle.IsValid())
+	{
+		return Preview;
+	}
+
+	for (const FGameplayModifierInfo& Modifier : CostEffect->Modifiers)
+	{
+		if (Modifier.ModifierOp != EGameplayModOp::Additive
+			|| Modifier.ModifierMagnitude.GetMagnitudeCalculationType() == EGameplayEffectMagnitudeCalculation::SetByCaller)
+		{
+			continue;
+		}
+
+		float Magnitude = 0.f;
+		if (Modifier.ModifierMagnitude.AttemptCalculateMagnitude(*CostSpecHandle.Data, Magnitude, /*WarnIfSetByCallerFail=*/false) && Magnitude < 0.f)
 		{
-			AbilitySpecInputReleased(AbilitySpec);
+			Preview.Costs.Emplace(Modifier.Attribute, -Magnitude);
 		}
 	}
+	return Preview;
+}
+
+void UGASCoreAbilitySystemComponent::NotifyAbilityLatencyActivated(const FGameplayAbilitySpecHandle Handle,
+	const UGameplayAbility* Ability, const FGameplayAbilityActivationInfo& ActivationInfo)
+{
+#if GASCORE_ABILITY_LATENCY
+	FAbilityLatencyTimes* Times = AbilityLatencyTimes.Find(Handle);
+	if (!Times || Times->bActivated || !Ability) return;
+
+	Times->bActivated = true;
+	const UClass* AbilityClass = Ability->GetClass();
+	GASCoreAbilityLatency::Record(AbilityClass, GASCoreAbilityLatency::EPhase::LocalActivate, (FPlatformTime::Seconds() - Times->PressTime) * 1000.0);
+
+	// Confirmation = the server caught up with the activation's prediction key (rejections are counted instead).
+	FPredictionKey PredictionKey = ActivationInfo.GetActivationPredictionKey();
+	if (ActivationInfo.ActivationMode == EGameplayAbilityActivationMode::Predicting && PredictionKey.IsValidKey())
+	{
+		const TWeakObjectPtr<const UClass> WeakAbilityClass(AbilityClass);
+		const double PressTime = Times->PressTime;
+		const TSharedRef<bool> bRejected = MakeShared<bool>(false);
+
+		PredictionKey.NewRejectedDelegate().BindLambda([WeakAbilityClass, bRejected]()
+		{
+			*bRejected = true;
+			GASCoreAbilityLatency::RecordRejected(WeakAbilityClass.Get());
+		});
+		PredictionKey.NewCaughtUpDelegate().BindLambda([WeakAbilityClass, PressTime, bRejected]()
+		{
+			if (!*bRejected)
+			{
+				GASCoreAbilityLatency::Record(WeakAbilityClass.Get(), GASCoreAbilityLatency::EPhase::ServerConfirm,
+					(FPlatformTime::Seconds() - PressTime) * 1000.0);
+			}
+		});
+	}
+#endif
+}
+
+void UGASCoreAbilitySystemComponent::NotifyAbilityLatencyCue(const FGameplayAbilitySpecHandle Handle, const UGameplayAbility* Ability)
+{
+#if GASCORE_ABILITY_LATENCY
+	FAbilityLatencyTimes* Times = AbilityLatencyTimes.Find(Handle);
+	if (!Times || Times->bCueRecorded || !Ability) return;
+
+	Times->bCueRecorded = true;
+	GASCoreAbilityLatency::Record(Ability->GetClass(), GASCoreAbilityLatency::EPhase::FirstCue, (FPlatformTime::Seconds() - Times->PressTime) * 1000.0);
+#endif
+}
+
+void UGASCoreAbilitySystemComponent::NotifyAbilityLatencyCueFromContext(const FGameplayEffectContextHandle& EffectContext)
+{
+#if GASCORE_ABILITY_LATENCY
+	// Only instanced abilities are in the context; the ability's own ASC holds its measurement (cues may play on a target).
+	if (GASCoreAbilityLatency::IsEnabled())
+	{
+		if (UGASCoreGameplayAbility* Ability = Cast<UGASCoreGameplayAbility>(EffectContext.GetAbilityInstance_NotReplicated()))
+		{
+			Ability->NotifyFirstGameplayCue();
+		}
+	}
+#endif
+}
+
+void UGASCoreAbilitySystemComponent::NotifyAbilityLatencyEnded(const FGameplayAbilitySpecHandle Handle, const UGameplayAbility* Ability)
+{
+#if GASCORE_ABILITY_LATENCY
+	FAbilityLatencyTimes Times;
+	if (!AbilityLatencyTimes.RemoveAndCopyValue(Handle, Times) || !Times.bActivated || !Ability) return;
+
+	GASCoreAbilityLatency::Record(Ability->GetClass(), GASCoreAbilityLatency::EPhase::End, (FPlatformTime::Seconds() - Times.PressTime) * 1000.0);
+#endif
+}
+
+bool UGASCoreAbilitySystemComponent::RemapAbilityInputTag(const FGameplayAbilitySpecHandle Handle, const FGameplayTag& OldInputTag,
+	const FGameplayTag& NewInputTag)
+{
+	FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(Handle);
+	if (!AbilitySpec)
+	{
+		return false;
+	}
+
+	UnindexAbilitySpecInputTags(*AbilitySpec);
+	FGameplayTagContainer& DynamicSpecSourceTags = AbilitySpec->GetDynamicSpecSourceTags();
+	DynamicSpecSourceTags.RemoveTag(OldInputTag);
+	if (NewInputTag.IsValid())
+	{
+		DynamicSpecSourceTags.AddTag(NewInputTag);
+	}
+	IndexAbilitySpecInputTags(*AbilitySpec);
+
+	MarkAbilitySpecDirty(*AbilitySpec);
+	return true;
+}
+
+void UGASCoreAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnGiveAbility(AbilitySpec);
+	IndexAbilitySpecInputTags(AbilitySpec);
+}
+
+void UGASCoreAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	UnindexAbilitySpecInputTags(AbilitySpec);
+	AbilityLatencyTimes.Remove(AbilitySpec.Handle);
+	AbilityCostPreviews.Remove(AbilitySpec.Handle);
+	Super::OnRemoveAbility(AbilitySpec);
+}
+
+void UGASCoreAbilitySystemComponent::OnRep_ActivateAbilities()
+{
+	Super::OnRep_ActivateAbilities();
+
+	// Server-side remaps arrive as in-place spec changes (no give/remove callback).
+	RebuildAbilityInputTagIndex();
+}
+
+void UGASCoreAbilitySystemComponent::IndexAbilitySpecInputTags(const FGameplayAbilitySpec& AbilitySpec)
+{
+	for (const FGameplayTag& Tag : AbilitySpec.GetDynamicSpecSourceTags())
+	{
+		AbilitySpecsByInputTag.FindOrAdd(Tag).AddUnique(AbilitySpec.Handle);
+	}
+}
+
+void UGASCoreAbilitySystemComponent::UnindexAbilitySpecInputTags(const FGameplayAbilitySpec& AbilitySpec)
+{
+	for (const FGameplayTag& Tag : AbilitySpec.GetDynamicSpecSourceTags())
+	{
+		if (TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>>* Handles = AbilitySpecsByInputTag.Find(Tag))
+		{
+			Handles->RemoveSingleSwap(AbilitySpec.Handle, EAllowShrinking::No);
+			if (Handles->IsEmpty())
+			{
+				AbilitySpecsByInputTag.Remove(Tag);
+			}
+		}
+	}
+}
+
+void UGASCoreAbilitySystemComponent::RebuildAbilityInputTagIndex()
+{
+	AbilitySpecsByInputTag.Reset();
+	for (const FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+	{
+		IndexAbilitySpecInputTags(AbilitySpec);
+	}
+}
+
+void UGASCoreAbilitySystemComponent::BufferAbilityInput(const FGameplayTag& InputTag)
+{
+	const UWorld* World = GetWorld();
+	if (!World || CVarGASCoreAbilityInputBufferWindow.GetValueOnGameThread() <= 0.f)
+	{
+		return;
+	}
+
+	BufferedInputTag = InputTag;
+	BufferedInputTime = World->GetTimeSeconds();
+	BufferedInputPressTime = FPlatformTime::Seconds();
+}
+
+float UGASCoreAbilitySystemComponent::GetInputBufferWindow() const
+{
+	// Latency-aware: the blocking state ends on the server half a round trip before the client hears of it.
+	float Window = CVarGASCoreAbilityInputBufferWindow.GetValueOnGameThread();
+	const APlayerController* PlayerController = AbilityActorInfo.IsValid() ? AbilityActorInfo->PlayerController.Get() : nullptr;
+	if (const APlayerState* PlayerState = PlayerController ? PlayerController->PlayerState.Get() : nullptr)
+	{
+		Window += PlayerState->GetPingInMilliseconds() * 0.0005f;
+	}
+	return Window;
+}
+
+void UGASCoreAbilitySystemComponent::ScheduleBufferedInputReplay()
+{
+	// Deferred to end of frame: removal/end callbacks are a bad place to activate abilities.
+	if (!BufferedInputTag.IsValid() || bInputReplayScheduled)
+	{
+		return;
+	}
+
+	bInputReplayScheduled = true;
+	GASCoreEndOfFrame::Schedule(this, [](UObject* Object)
+	{
+		CastChecked<UGASCoreAbilitySystemComponent>(Object)->ReplayBufferedInput();
+	});
+}
+
+void UGASCoreAbilitySystemComponent::ReplayBufferedInput()
+{
+	GASCORE_TRACE_SCOPE(UGASCoreAbilitySystemComponent::ReplayBufferedInput);
+	bInputReplayScheduled = false;
+
+	const UWorld* World = GetWorld();
+	const TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>>* IndexedHandles = AbilitySpecsByInputTag.Find(BufferedInputTag);
+	if (!World || !IndexedHandles || World->GetTimeSeconds() - BufferedInputTime > GetInputBufferWindow())
+	{
+		BufferedInputTag = FGameplayTag();
+		return;
+	}
+
+	// Still blocked: keep the press for the next unblock event within the window (failures are not re-cached).
+	const TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>> Handles(*IndexedHandles);
+	for (const FGameplayAbilitySpecHandle& Handle : Handles)
+	{
+		const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(Handle);
+		if (AbilitySpec && !AbilitySpec->IsActive() && !IsActivationFailureCached(Handle)
+			&& TryActivateAbilityFromInput(*AbilitySpec, BufferedInputPressTime))
+		{
+			BufferedInputTag = FGameplayTag();
+			return;
+		}
+	}
+}
+
+void UGASCoreAbilitySystemComponent::HandleAbilityEndedForInputBuffer(UGameplayAbility* Ability)
+{
+	// The ended ability's owned/blocking tags are gone now.
+	ScheduleBufferedInputReplay();
+}
+
+bool UGASCoreAbilitySystemComponent::IsActivationFailureCached(const FGameplayAbilitySpecHandle Handle)
+{
+	const int32 Index = ActivationFailures.IndexOfByPredicate([Handle](const FActivationFailure& Failure)
+	{
+		return Failure.Handle == Handle;
+	});
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const UWorld* World = GetWorld();
+	if (CVarGASCoreActivationFailureCache.GetValueOnGameThread() && World && World->GetTimeSeconds() < ActivationFailures[Index].RetryTime)
+	{
+		return true;
+	}
+	ActivationFailures.RemoveAtSwap(Index, EAllowShrinking::No);
+	return false;
+}
+
+void UGASCoreAbilitySystemComponent::CacheActivationFailure(const FGameplayAbilitySpec& AbilitySpec)
+{
+	const UWorld* World = GetWorld();
+	const FGameplayAbilityActorInfo* ActorInfo = AbilityActorInfo.Get();
+	const UGameplayAbility* Ability = AbilitySpec.GetPrimaryInstance() ? AbilitySpec.GetPrimaryInstance() : AbilitySpec.Ability.Get();
+	if (!CVarGASCoreActivationFailureCache.GetValueOnGameThread() || !World || !ActorInfo || !Ability)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	ActivationFailures.RemoveAllSwap([Now](const FActivationFailure& Failure) { return Failure.RetryTime <= Now; }, EAllowShrinking::No);
+
+	FActivationFailure Failure;
+	Failure.Handle = AbilitySpec.Handle;
+
+	// Cooldown: cannot succeed before it expires (early removal clears the cache, see HandleActiveEffectRemoved).
+	const float CooldownRemaining = Ability->GetCooldownTimeRemaining(ActorInfo);
+	if (CooldownRemaining > 0.f)
+	{
+		Failure.RetryTime = Now + CooldownRemaining;
+	}
+	// Cost: retry once a cost attribute changes, or after the max age (magnitudes may depend on other attributes).
+	else if (!Ability->CheckCost(AbilitySpec.Handle, ActorInfo))
+	{
+		if (const UGameplayEffect* CostEffect = Ability->GetCostGameplayEffect())
+		{
+			for (const FGameplayModifierInfo& Modifier : CostEffect->Modifiers)
+			{
+				Failure.CostAttributes.AddUnique(Modifier.Attribute);
+			}
+		}
+		Failure.RetryTime = Now + CVarGASCoreActivationFailureCacheMaxAge.GetValueOnGameThread();
+	}
+	else
+	{
+		return;
+	}
+
+	ActivationFailures.Add(MoveTemp(Failure));
+}
+
+void UGASCoreAbilitySystemComponent::HandleActiveEffectRemoved(const FActiveGameplayEffect& RemovedEffect)
+{
+	GASCORE_TRACE_SCOPE(UGASCoreAbilitySystemComponent::HandleActiveEffectRemoved);
+	ActivationFailures.Reset();
+
+	// A cooldown or a blocking effect may have ended.
+	ScheduleBufferedInputReplay();
 }
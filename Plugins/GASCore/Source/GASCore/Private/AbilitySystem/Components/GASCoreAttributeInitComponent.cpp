@@ -6,6 +6,17 @@
 
 #include "AbilitySystemComponent.h"
 #include "GameplayEffect.h"
+#include "AbilitySystem/Effects/GASCoreEffectSpecTemplate.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "UObject/ObjectKey.h"
+
+namespace GASCoreAttributeInit
+{
+	// One load per component archetype; the handle keeps the init GEs (and their curve tables) resident so later
+	// spawns of the same character class apply synchronously. Game thread only.
+	static TMap<FObjectKey, TSharedPtr<FStreamableHandle>> SharedHandles;
+}
 
 UGASCoreAttributeInitComponent::UGASCoreAttributeInitComponent()
 {
@@ -13,13 +24,104 @@ UGASCoreAttributeInitComponent::UGASCoreAttributeInitComponent()
 	PrimaryComponentTick.bCanEverTick = false;
 }
 
+bool UGASCoreAttributeInitComponent::HasDefaultAttributes() const
+{
+	return DefaultPrimaryAttributes || !SoftPrimaryAttributes.IsNull();
+}
+
+bool UGASCoreAttributeInitComponent::AreDefaultAttributeEffectsLoaded() const
+{
+	TArray<FSoftObjectPath> Paths;
+	GetPendingSoftEffectPaths(Paths);
+	return Paths.IsEmpty();
+}
+
 void UGASCoreAttributeInitComponent::InitializeDefaultAttributes(UAbilitySystemComponent* TargetAbilitySystemComponent) const
+{
+	check(IsValid(TargetAbilitySystemComponent));
+
+	TArray<FSoftObjectPath> PendingPaths;
+	GetPendingSoftEffectPaths(PendingPaths);
+	if (PendingPaths.IsEmpty())
+	{
+		ApplyDefaultAttributeEffects(TargetAbilitySystemComponent);
+		return;
+	}
+
+	// First spawn of this archetype keeps its handle (residency); spawns during that load request the same paths,
+	// which the streamable manager merges into the in-flight load.
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+	TSharedPtr<FStreamableHandle>& SharedHandle = GASCoreAttributeInit::SharedHandles.FindOrAdd(FObjectKey(GetArchetype()));
+
+	if (bWaitForSoftAttributeEffects)
+	{
+		TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(PendingPaths, FStreamableDelegate(),
+			FStreamableManager::AsyncLoadHighPriority);
+		if (Handle.IsValid())
+		{
+			Handle->WaitUntilComplete();
+		}
+		SharedHandle = SharedHandle.IsValid() ? SharedHandle : Handle;
+		ApplyDefaultAttributeEffects(TargetAbilitySystemComponent);
+		return;
+	}
+
+	TWeakObjectPtr<const UGASCoreAttributeInitComponent> WeakThis(this);
+	TWeakObjectPtr<UAbilitySystemComponent> WeakASC(TargetAbilitySystemComponent);
+	TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(MoveTemp(PendingPaths),
+		FStreamableDelegate::CreateLambda([WeakThis, WeakASC]()
+		{
+			// Owner or ASC may be gone by the time the load lands (despawned during the load).
+			if (WeakThis.IsValid() && WeakASC.IsValid())
+			{
+				WeakThis->ApplyDefaultAttributeEffects(WeakASC.Get());
+			}
+		}),
+		FStreamableManager::AsyncLoadHighPriority);
+	SharedHandle = SharedHandle.IsValid() ? SharedHandle : Handle;
+}
+
+TSubclassOf<UGameplayEffect> UGASCoreAttributeInitComponent::ResolveEffectClass(const TSubclassOf<UGameplayEffect> HardClass,
+	const TSoftClassPtr<UGameplayEffect>& SoftClass)
+{
+	return HardClass ? HardClass : TSubclassOf<UGameplayEffect>(SoftClass.Get());
+}
+
+void UGASCoreAttributeInitComponent::ApplyDefaultAttributeEffects(UAbilitySystemComponent* TargetAbilitySystemComponent) const
 {
 	// Apply initial attributes in dependency order:
 	// 1) Primary (base stats) -> 2) Secondary (derived, often MMC-based) -> 3) Vital (set current = max).
-	ApplyEffectToSelf(DefaultPrimaryAttributes, 1.f, TargetAbilitySystemComponent);
-	ApplyEffectToSelf(DefaultSecondaryAttributes, 1.f, TargetAbilitySystemComponent);
-	ApplyEffectToSelf(DefaultVitalAttributes, 1.f, TargetAbilitySystemComponent);
+	ApplyEffectToSelf(ResolveEffectClass(DefaultPrimaryAttributes, SoftPrimaryAttributes), 1.f, TargetAbilitySystemComponent);
+	ApplyEffectToSelf(ResolveEffectClass(DefaultSecondaryAttributes, SoftSecondaryAttributes), 1.f, TargetAbilitySystemComponent);
+	ApplyEffectToSelf(ResolveEffectClass(DefaultVitalAttributes, SoftVitalAttributes), 1.f, TargetAbilitySystemComponent);
+}
+
+void UGASCoreAttributeInitComponent::GetDefaultAttributeEffectClasses(TArray<TSubclassOf<UGameplayEffect>>& OutClasses) const
+{
+	for (const TSubclassOf<UGameplayEffect> Class : { ResolveEffectClass(DefaultPrimaryAttributes, SoftPrimaryAttributes),
+		ResolveEffectClass(DefaultSecondaryAttributes, SoftSecondaryAttributes), ResolveEffectClass(DefaultVitalAttributes, SoftVitalAttributes) })
+	{
+		if (Class)
+		{
+			OutClasses.AddUnique(Class);
+		}
+	}
+}
+
+void UGASCoreAttributeInitComponent::GetPendingSoftEffectPaths(TArray<FSoftObjectPath>& OutPaths) const
+{
+	const TPair<TSubclassOf<UGameplayEffect>, const TSoftClassPtr<UGameplayEffect>*> Effects[] = {
+		{ DefaultPrimaryAttributes, &SoftPrimaryAttributes },
+		{ DefaultSecondaryAttributes, &SoftSecondaryAttributes },
+		{ DefaultVitalAttributes, &SoftVitalAttributes } };
+
+	for (const TPair<TSubclassOf<UGameplayEffect>, const TSoftClassPtr<UGameplayEffect>*>& Effect : Effects)
+	{
+		if (!Effect.Key && !Effect.Value->IsNull() && !Effect.Value->Get())
+		{
+			OutPaths.Add(Effect.Value->ToSoftObjectPath());
+		}
+	}
 }
 
 void UGASCoreAttributeInitComponent::ApplyEffectToSelf(
@@ -41,19 +143,10 @@ void UGASCoreAttributeInitComponent::ApplyEffectToSelf(
 	// Here, we use the owning Actor of this component. Change if attribution should differ.
 	EffectContextHandle.AddSourceObject(GetOwner());
 
-	// Create an outgoing spec for the initialization GE at the given Level.
+	// Build the spec for the initialization GE at the given Level and apply it to self.
 	// Level can drive scalable floats or SetByCaller magnitudes inside the GE.
-	const FGameplayEffectSpecHandle EffectSpec =
-		TargetAbilitySystemComponent->MakeOutgoingSpec(GameplayEffectClass, Level, EffectContextHandle);
-
-	// Bail out safely if the spec could not be created (e.g., class not set).
-	if (!EffectSpec.IsValid() || !EffectSpec.Data.IsValid())
-	{
-		return;
-	}
-
-	// Apply the spec "to target" where the target is the same ASC (self-application).
+	// Static init GEs clone a shared (class, level) prototype on the stack (FGASCoreEffectSpecTemplate).
 	// Networking:
 	// - Prefer calling on the server so attribute replication updates clients authoritatively.
-	TargetAbilitySystemComponent->ApplyGameplayEffectSpecToTarget(*EffectSpec.Data.Get(), TargetAbilitySystemComponent);
+	FGASCoreEffectSpecTemplate(GameplayEffectClass, Level).ApplyToSelf(TargetAbilitySystemComponent, EffectContextHandle);
 }
\ No newline at end of file
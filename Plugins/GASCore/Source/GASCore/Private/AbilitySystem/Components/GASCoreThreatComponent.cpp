@@ -0,0 +1,201 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/Components/GASCoreThreatComponent.h"
+
+#include "AbilitySystemGlobals.h"
+#include "AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "GASCoreStats.h"
+#include "Subsystems/GASCoreCombatantRegistrySubsystem.h"
+#include "Subsystems/GASCoreThreatSubsystem.h"
+
+UGASCoreThreatComponent::UGASCoreThreatComponent()
+{
+	// Evaluated by UGASCoreThreatSubsystem (throttled, event driven), never ticked.
+	PrimaryComponentTick.bCanEverTick = false;
+	bAutoActivate = true;
+}
+
+void UGASCoreThreatComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	AActor* Owner = GetOwner();
+	if (!Owner || !Owner->HasAuthority())
+	{
+		return;
+	}
+
+	// Owner ASC's damage batch: one callback per frame with the damage per instigator.
+	if (UGASCoreAbilitySystemComponent* CoreASC = Cast<UGASCoreAbilitySystemComponent>(
+		UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Owner)))
+	{
+		DamageEventsHandle = CoreASC->OnDamageEventBatch.AddUObject(this, &ThisClass::HandleDamageEvents);
+		BoundAbilitySystem = CoreASC;
+	}
+
+	if (UGASCoreThreatSubsystem* Subsystem = UGASCoreThreatSubsystem::Get(this))
+	{
+		Subsystem->RegisterComponent(this);
+	}
+	LastEvaluationTime = GetWorld()->GetTimeSeconds();
+}
+
+void UGASCoreThreatComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGASCoreAbilitySystemComponent* CoreASC = BoundAbilitySystem.Get())
+	{
+		CoreASC->OnDamageEventBatch.Remove(DamageEventsHandle);
+	}
+	BoundAbilitySystem.Reset();
+
+	if (UGASCoreThreatSubsystem* Subsystem = UGASCoreThreatSubsystem::Get(this))
+	{
+		Subsystem->UnregisterComponent(this);
+	}
+	Entries.Reset();
+	Target.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UGASCoreThreatComponent::Deactivate()
+{
+	Super::Deactivate();
+	ClearThreat();
+}
+
+float UGASCoreThreatComponent::GetThreat(const AActor* Actor) const
+{
+	const FThreatEntry* Entry = Entries.FindByPredicate([Actor](const FThreatEntry& Candidate) { return Candidate.Actor.Get() == Actor; });
+	return Entry ? Entry->Threat : 0.f;
+}
+
+void UGASCoreThreatComponent::AddThreat(AActor* Actor, const float Threat)
+{
+	if (!IsActive() || !GetOwner() || !GetOwner()->HasAuthority())
+	{
+		return;
+	}
+	AddThreatInternal(Actor, Threat);
+	RequestEvaluation();
+}
+
+void UGASCoreThreatComponent::ClearThreat()
+{
+	Entries.Reset();
+	SetTarget(nullptr);
+}
+
+void UGASCoreThreatComponent::HandleDamageEvents(const TArrayView<const FGASCoreDamageEvent> Events)
+{
+	if (!IsActive())
+	{
+		return;
+	}
+
+	for (const FGASCoreDamageEvent& Event : Events)
+	{
+		AddThreatInternal(Event.Instigator.Get(), Event.Damage * ThreatPerDamage);
+	}
+	RequestEvaluation();
+}
+
+void UGASCoreThreatComponent::AddThreatInternal(AActor* Actor, const float Threat)
+{
+	if (!IsValid(Actor) || Actor == GetOwner() || Threat == 0.f)
+	{
+		return;
+	}
+
+	for (FThreatEntry& Entry : Entries)
+	{
+		if (Entry.Actor.Get() == Actor)
+		{
+			Entry.Threat = FMath::Max(Entry.Threat + Threat, 0.f);
+			return;
+		}
+	}
+	if (Threat > 0.f)
+	{
+		Entries.Add({ Actor, Threat });
+	}
+}
+
+void UGASCoreThreatComponent::RequestEvaluation()
+{
+	if (UGASCoreThreatSubsystem* Subsystem = UGASCoreThreatSubsystem::Get(this))
+	{
+		Subsystem->RequestEvaluation(this);
+	}
+}
+
+void UGASCoreThreatComponent::EvaluateThreat(const float Elapsed, UGASCoreCombatantRegistrySubsystem* CombatantRegistry)
+{
+	GASCORE_TRACE_SCOPE(UGASCoreThreatComponent::EvaluateThreat);
+
+	const AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return;
+	}
+	LastEvaluationTime = GetWorld()->GetTimeSeconds();
+	const FVector Location = Owner->GetActorLocation();
+
+	// Proximity: one hash query for the nearest candidate, never a scan of every player.
+	if (AggroTargetClass && CombatantRegistry && ProximityAggroRadius > 0.f && ProximityThreatPerSecond > 0.f)
+	{
+		const UClass* TargetClass = AggroTargetClass;
+		if (AActor* Nearest = CombatantRegistry->FindNearestCombatant(Location, ProximityAggroRadius,
+			[TargetClass](const AActor& Combatant) { return Combatant.IsA(TargetClass); }))
+		{
+			AddThreatInternal(Nearest, ProximityThreatPerSecond * Elapsed);
+		}
+	}
+
+	const float Decay = FMath::Clamp(1.f - ThreatDecayPerSecond * Elapsed, 0.f, 1.f);
+	const double LoseDistSq = LoseTargetDistance > 0.f ? FMath::Square(static_cast<double>(LoseTargetDistance)) : TNumericLimits<double>::Max();
+
+	const FThreatEntry* Best = nullptr;
+	const FThreatEntry* Current = nullptr;
+	for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		FThreatEntry& Entry = Entries[Index];
+		Entry.Threat *= Decay;
+
+		const AActor* Actor = Entry.Actor.Get();
+		if (!IsValid(Actor) || Actor->IsHidden() || Entry.Threat < UE_KINDA_SMALL_NUMBER
+			|| FVector::DistSquared(Actor->GetActorLocation(), Location) > LoseDistSq)
+		{
+			Entries.RemoveAtSwap(Index, EAllowShrinking::No);
+		}
+	}
+	for (const FThreatEntry& Entry : Entries)
+	{
+		if (!Best || Entry.Threat > Best->Threat)
+		{
+			Best = &Entry;
+		}
+		if (Entry.Actor == Target)
+		{
+			Current = &Entry;
+		}
+	}
+
+	// Hysteresis: keep the current target unless someone clearly out-threatens it.
+	if (Current && Best && Best != Current && Best->Threat < Current->Threat * TargetSwitchRatio)
+	{
+		Best = Current;
+	}
+	SetTarget(Best ? Best->Actor.Get() : nullptr);
+}
+
+void UGASCoreThreatComponent::SetTarget(AActor* NewTarget)
+{
+	AActor* OldTarget = Target.Get();
+	if (OldTarget != NewTarget)
+	{
+		Target = NewTarget;
+		OnThreatTargetChanged.Broadcast(OldTarget, NewTarget);
+	}
+}
@@ -0,0 +1,50 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/Data/GASCoreAttributeArchetypeDataAsset.h"
+
+#include "AbilitySystem/Attributes/GASCoreAttributeSet.h"
+
+const FGASCoreArchetypeLevelValues* UGASCoreAttributeArchetypeDataAsset::GetLevelValues(const int32 Level) const
+{
+	check(IsInGameThread());
+
+	if (const TUniquePtr<FGASCoreArchetypeLevelValues>* Cached = LevelCache.Find(Level))
+	{
+		return Cached->Get();
+	}
+
+	const UClass* SetClass = AttributeSetClass.Get();
+	if (!SetClass)
+	{
+		return nullptr;
+	}
+
+	// Resolve rows to ordinals of the set class once; every instance indexes the result directly.
+	const FGASCoreAttributeMetadata& Metadata = FGASCoreAttributeMetadata::Get(SetClass->GetDefaultObject<UGASCoreAttributeSet>());
+
+	TUniquePtr<FGASCoreArchetypeLevelValues> Values = MakeUnique<FGASCoreArchetypeLevelValues>();
+	Values->BaseValues.Init(0.f, Metadata.Num());
+	Values->Specified.Init(false, Metadata.Num());
+
+	for (const FGASCoreArchetypeAttributeValue& Row : Attributes)
+	{
+		const int32 Ordinal = Metadata.GetOrdinal(Row.Attribute);
+		if (Ordinal != INDEX_NONE)
+		{
+			Values->BaseValues[Ordinal] = Row.BaseValue.GetValueAtLevel(static_cast<float>(Level));
+			Values->Specified[Ordinal] = true;
+		}
+	}
+
+	return LevelCache.Add(Level, MoveTemp(Values)).Get();
+}
+
+#if WITH_EDITOR
+void UGASCoreAttributeArchetypeDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Authoring changes invalidate resolved levels (only editor sessions hold sets across edits).
+	LevelCache.Reset();
+}
+#endif
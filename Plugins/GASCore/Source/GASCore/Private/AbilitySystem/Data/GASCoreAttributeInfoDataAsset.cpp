@@ -1,31 +1,200 @@
 // © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
 
-// Implementation for UGASCoreAttributeInfoDataAsset::FindAttributeInfoByTag
+// Implementation for UGASCoreAttributeInfoDataAsset lookups
 
 #include "AbilitySystem/Data/GASCoreAttributeInfoDataAsset.h"
 
+#include "Algo/BinarySearch.h"
+#include "UObject/ObjectSaveContext.h"
+#include "Utilities/GASCoreLogging.h"
+
 FGASCoreAttributeInformation UGASCoreAttributeInfoDataAsset::FindAttributeInfoByTag(
 	const FGameplayTag& AttributeTag,
 	bool bLogNotFound) const
 {
-	// Linear search across authored rows; acceptable for small lists typically used for UI display.
-	for (const FGASCoreAttributeInformation& AttributeInfoRow : AttributeInformation)
+	if (const FGASCoreAttributeInformation* AttributeInfoRow = FindAttributeInfoRowByTag(AttributeTag, bLogNotFound))
+	{
+		return *AttributeInfoRow; // Return by value (BP-friendly)
+	}
+
+	// Not found: return a default-constructed row (AttributeValue remains 0.f).
+	return FGASCoreAttributeInformation();
+}
+
+const FGASCoreAttributeInformation* UGASCoreAttributeInfoDataAsset::FindAttributeInfoRowByTag(
+	const FGameplayTag& AttributeTag,
+	bool bLogNotFound) const
+{
+	// Exact match is intended: UI rows are defined at a specific tag granularity.
+	if (UseBakedRows())
 	{
-		// Exact match is intended: UI rows are defined at a specific tag granularity.
-		if (AttributeInfoRow.AttributeTag.MatchesTagExact(AttributeTag))
+		if (const FGASCoreAttributeInformation* BakedRow = FindBakedRow(AttributeTag))
 		{
-			return AttributeInfoRow; // Return by value (BP-friendly)
+			return BakedRow;
+		}
+	}
+	else
+	{
+		if (!bRowIndexBuilt)
+		{
+			RebuildRowIndex();
+		}
+		if (const int32* RowIndex = RowIndexByTag.Find(AttributeTag))
+		{
+			return &AttributeInformation[*RowIndex];
 		}
 	}
 
 	// Optionally report missing tags to help diagnose misconfigured assets.
 	if (bLogNotFound)
 	{
-		UE_LOG(LogTemp, Error,
-			TEXT("Can't find Attribute Info for AttributeTag [%s] on AttributeInfo [%s]."),
+		GASCORE_LOG_ERROR(TEXT("Can't find Attribute Info for AttributeTag [%s] on AttributeInfo [%s]."),
 			*AttributeTag.ToString(), *GetNameSafe(this));
 	}
+	return nullptr;
+}
 
-	// Not found: return a default-constructed row (AttributeValue remains 0.f).
-	return FGASCoreAttributeInformation();
-}
\ No newline at end of file
+const FGASCoreAttributeInformation* UGASCoreAttributeInfoDataAsset::FindBakedRow(const FGameplayTag& AttributeTag) const
+{
+	const int32 RowIndex = Algo::LowerBoundBy(BakedRows, AttributeTag, &FGASCoreAttributeInformation::AttributeTag, &BakedRowTagLess);
+	return BakedRows.IsValidIndex(RowIndex) && BakedRows[RowIndex].AttributeTag == AttributeTag ? &BakedRows[RowIndex] : nullptr;
+}
+
+float UGASCoreAttributeInfoDataAsset::GetRowNumericValue(const int32 RowIndex, const UAttributeSet* Set) const
+{
+	const TArray<FGASCoreAttributeInformation>& Rows = GetAttributeInformation();
+	if (!Set || !Rows.IsValidIndex(RowIndex))
+	{
+		return 0.f;
+	}
+
+	if (UseBakedRows() && BakedAttributeOffsets.IsValidIndex(RowIndex) && BakedAttributeOffsets[RowIndex] != INDEX_NONE)
+	{
+		checkSlow(Set->IsA(Rows[RowIndex].AttributeGetter.GetAttributeSetClass()));
+		return reinterpret_cast<const FGameplayAttributeData*>(reinterpret_cast<const uint8*>(Set) + BakedAttributeOffsets[RowIndex])->GetCurrentValue();
+	}
+	return Rows[RowIndex].AttributeGetter.GetNumericValue(Set);
+}
+
+void UGASCoreAttributeInfoDataAsset::PostLoad()
+{
+	Super::PostLoad();
+
+#if !UE_BUILD_SHIPPING
+	// Offsets were taken on the cooking machine; guard against a layout change on the target (falls back to the
+	// property path rather than reading the wrong bytes).
+	if (UseBakedRows())
+	{
+		// The binary search needs sorted, unique tags; a bake that is not falls back to the authored rows.
+		for (int32 RowIndex = 1; RowIndex < BakedRows.Num(); ++RowIndex)
+		{
+			if (!BakedRowTagLess(BakedRows[RowIndex - 1].AttributeTag, BakedRows[RowIndex].AttributeTag))
+			{
+				GASCORE_LOG_ERROR(TEXT("Baked attribute info rows of [%s] are not sorted and unique (row %d); using the authored rows instead."),
+					*GetNameSafe(this), RowIndex);
+				bHasBakedRows = false;
+				break;
+			}
+		}
+	}
+	if (UseBakedRows())
+	{
+		for (int32 RowIndex = 0; RowIndex < BakedAttributeOffsets.Num(); ++RowIndex)
+		{
+			const FProperty* Property = BakedRows.IsValidIndex(RowIndex) ? BakedRows[RowIndex].AttributeGetter.GetUProperty() : nullptr;
+			if (BakedAttributeOffsets[RowIndex] != INDEX_NONE && (!Property || Property->GetOffset_ForInternal() != BakedAttributeOffsets[RowIndex]))
+			{
+				GASCORE_LOG_ERROR(TEXT("Baked attribute offset mismatch in [%s] row %d; using the attribute property instead."), *GetNameSafe(this), RowIndex);
+				BakedAttributeOffsets[RowIndex] = INDEX_NONE;
+			}
+		}
+	}
+#endif
+
+	RebuildRowIndex();
+}
+
+#if WITH_EDITOR
+void UGASCoreAttributeInfoDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	RebuildRowIndex();
+}
+
+void UGASCoreAttributeInfoDataAsset::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	BakedRows.Reset();
+	BakedAttributeOffsets.Reset();
+	bHasBakedRows = false;
+
+	// Uncooked saves keep only the authored rows.
+	if (!SaveContext.IsCooking())
+	{
+		return;
+	}
+
+	// Valid rows, sorted by tag; the stable sort keeps duplicates in authored order so the first one survives.
+	TArray<int32> RowOrder;
+	RowOrder.Reserve(AttributeInformation.Num());
+	for (int32 RowIndex = 0; RowIndex < AttributeInformation.Num(); ++RowIndex)
+	{
+		const FGASCoreAttributeInformation& Row = AttributeInformation[RowIndex];
+		if (!Row.AttributeTag.IsValid() || !Row.AttributeGetter.IsValid())
+		{
+			GASCORE_LOG_WARNING(TEXT("Cook: dropping attribute info row '%s' in [%s] (missing tag or attribute)."),
+				*Row.AttributeName.ToString(), *GetNameSafe(this));
+			continue;
+		}
+		RowOrder.Add(RowIndex);
+	}
+	RowOrder.StableSort([this](const int32 A, const int32 B)
+	{
+		return BakedRowTagLess(AttributeInformation[A].AttributeTag, AttributeInformation[B].AttributeTag);
+	});
+
+	BakedRows.Reserve(RowOrder.Num());
+	BakedAttributeOffsets.Reserve(RowOrder.Num());
+	for (const int32 RowIndex : RowOrder)
+	{
+		const FGASCoreAttributeInformation& Row = AttributeInformation[RowIndex];
+		if (!BakedRows.IsEmpty() && BakedRows.Last().AttributeTag == Row.AttributeTag)
+		{
+			GASCORE_LOG_WARNING(TEXT("Cook: dropping attribute info row '%s' in [%s] (tag %s is already used by an earlier row)."),
+				*Row.AttributeName.ToString(), *GetNameSafe(this), *Row.AttributeTag.ToString());
+			continue;
+		}
+
+		FGASCoreAttributeInformation& BakedRow = BakedRows.Add_GetRef(Row);
+		BakedRow.AttributeValue = 0.f;
+
+		FProperty* Property = Row.AttributeGetter.GetUProperty();
+		BakedAttributeOffsets.Add(FGameplayAttribute::IsGameplayAttributeDataProperty(Property) ? Property->GetOffset_ForInternal() : INDEX_NONE);
+	}
+	bHasBakedRows = true;
+}
+#endif
+
+void UGASCoreAttributeInfoDataAsset::RebuildRowIndex() const
+{
+	RowIndexByTag.Reset();
+	bRowIndexBuilt = true;
+	if (UseBakedRows())
+	{
+		return;
+	}
+
+	const TArray<FGASCoreAttributeInformation>& Rows = AttributeInformation;
+	RowIndexByTag.Reserve(Rows.Num());
+
+	for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+	{
+		const FGameplayTag& AttributeTag = Rows[RowIndex].AttributeTag;
+		if (AttributeTag.IsValid() && !RowIndexByTag.Contains(AttributeTag))
+		{
+			RowIndexByTag.Add(AttributeTag, RowIndex);
+		}
+	}
+}
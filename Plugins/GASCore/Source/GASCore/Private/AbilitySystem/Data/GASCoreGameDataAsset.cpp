@@ -0,0 +1,39 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/Data/GASCoreGameDataAsset.h"
+
+#include "Abilities/GameplayAbility.h"
+#include "AbilitySystem/Data/GASCoreAttributeInfoDataAsset.h"
+#include "Engine/CurveTable.h"
+#include "Engine/DataTable.h"
+#include "GameFramework/PlayerController.h"
+#include "GameplayEffect.h"
+
+const FPrimaryAssetType UGASCoreGameDataAsset::PrimaryAssetType(TEXT("GASCoreGameData"));
+const FName UGASCoreGameDataAsset::CombatBundle(TEXT("Combat"));
+const FName UGASCoreGameDataAsset::UIBundle(TEXT("UI"));
+const FName UGASCoreGameDataAsset::InputBundle(TEXT("Input"));
+
+void UGASCoreGameDataAsset::GetAllAssetPaths(TArray<FSoftObjectPath>& OutPaths) const
+{
+	OutPaths.Reserve(OutPaths.Num() + GameplayEffects.Num() + Abilities.Num() + CurveTables.Num() + AttributeInfos.Num() + MessageTables.Num()
+		+ PlayerControllerClasses.Num());
+
+	auto AddPaths = [&OutPaths](const auto& SoftPointers)
+	{
+		for (const auto& SoftPointer : SoftPointers)
+		{
+			if (!SoftPointer.IsNull())
+			{
+				OutPaths.Add(SoftPointer.ToSoftObjectPath());
+			}
+		}
+	};
+
+	AddPaths(GameplayEffects);
+	AddPaths(Abilities);
+	AddPaths(CurveTables);
+	AddPaths(AttributeInfos);
+	AddPaths(MessageTables);
+	AddPaths(PlayerControllerClasses);
+}
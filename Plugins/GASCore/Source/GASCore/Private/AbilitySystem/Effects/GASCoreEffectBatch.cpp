@@ -0,0 +1,121 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/Effects/GASCoreEffectBatch.h"
+
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "GASCoreStats.h"
+#include "AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
+#include "AbilitySystem/Effects/GASCoreEffectSpecCache.h"
+#include "AbilitySystem/Effects/GASCoreEffectSpecTemplate.h"
+
+int32 FGASCoreEffectBatch::ApplyEffectToTargets(AActor* Source, const TSubclassOf<UGameplayEffect> EffectClass, const float Level,
+	const TArrayView<AActor* const> Targets, TArray<FActiveGameplayEffectHandle>* OutHandles)
+{
+	GASCORE_TRACE_SCOPE(FGASCoreEffectBatch::ApplyEffectToTargets);
+
+	if (!EffectClass || Targets.IsEmpty())
+	{
+		return 0;
+	}
+
+	TArray<UAbilitySystemComponent*, TInlineAllocator<64>> TargetASCs;
+	GatherTargetASCs(Targets, TargetASCs);
+	if (TargetASCs.IsEmpty())
+	{
+		return 0;
+	}
+
+	// One context + spec for the batch, owned by the source when it has an ASC.
+	UAbilitySystemComponent* SourceASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Source);
+	UAbilitySystemComponent* SpecOwner = SourceASC ? SourceASC : TargetASCs[0];
+
+	// Targets already holding the full stack of an inert capped effect would discard it: drop them first
+	// (no spec at all when every target is capped).
+	const FGASCoreEffectSpecTemplate EffectTemplate(EffectClass, Level);
+	TargetASCs.RemoveAll([&EffectTemplate, SpecOwner](const UAbilitySystemComponent* TargetASC)
+	{
+		return EffectTemplate.WouldBeDiscarded(TargetASC, SpecOwner);
+	});
+	if (TargetASCs.IsEmpty())
+	{
+		return 0;
+	}
+	FGameplayEffectContextHandle Context = SpecOwner->MakeEffectContext();
+	Context.AddSourceObject(Source);
+	if (Source && Context.Get())
+	{
+		Context.Get()->SetEffectCauser(Source);
+	}
+
+	const FGameplayEffectSpecHandle SpecHandle = FGASCoreEffectSpecCache::MakeOutgoingSpec(SpecOwner, EffectClass, Level, Context);
+	const FGameplayEffectSpec* Spec = SpecHandle.Data.Get();
+	if (!Spec)
+	{
+		return 0;
+	}
+
+	return ApplySpec(*Spec, SourceASC, TargetASCs, OutHandles);
+}
+
+int32 FGASCoreEffectBatch::ApplySpecToTargets(const FGameplayEffectSpecHandle& SpecHandle, const TArrayView<AActor* const> Targets,
+	TArray<FActiveGameplayEffectHandle>* OutHandles)
+{
+	GASCORE_TRACE_SCOPE(FGASCoreEffectBatch::ApplySpecToTargets);
+
+	const FGameplayEffectSpec* Spec = SpecHandle.Data.Get();
+	if (!Spec || Targets.IsEmpty())
+	{
+		return 0;
+	}
+
+	TArray<UAbilitySystemComponent*, TInlineAllocator<64>> TargetASCs;
+	GatherTargetASCs(Targets, TargetASCs);
+	if (TargetASCs.IsEmpty())
+	{
+		return 0;
+	}
+
+	return ApplySpec(*Spec, Spec->GetContext().GetInstigatorAbilitySystemComponent(), TargetASCs, OutHandles);
+}
+
+void FGASCoreEffectBatch::GatherTargetASCs(const TArrayView<AActor* const> Targets,
+	TArray<UAbilitySystemComponent*, TInlineAllocator<64>>& OutTargetASCs)
+{
+	TSet<UAbilitySystemComponent*, DefaultKeyFuncs<UAbilitySystemComponent*>, TInlineSetAllocator<64>> SeenASCs;
+	for (AActor* Target : Targets)
+	{
+		UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Target);
+		bool bAlreadySeen = false;
+		if (TargetASC && (SeenASCs.Add(TargetASC, &bAlreadySeen), !bAlreadySeen))
+		{
+			OutTargetASCs.Add(TargetASC);
+		}
+	}
+}
+
+int32 FGASCoreEffectBatch::ApplySpec(const FGameplayEffectSpec& Spec, UAbilitySystemComponent* SourceASC,
+	const TArrayView<UAbilitySystemComponent* const> TargetASCs, TArray<FActiveGameplayEffectHandle>* OutHandles)
+{
+	if (OutHandles)
+	{
+		OutHandles->Reserve(OutHandles->Num() + TargetASCs.Num());
+	}
+
+	FGASCoreDeferredEffectNotifyScope DeferNotifications;
+	int32 NumApplied = 0;
+	for (UAbilitySystemComponent* TargetASC : TargetASCs)
+	{
+		const FActiveGameplayEffectHandle Handle = SourceASC
+			? SourceASC->ApplyGameplayEffectSpecToTarget(Spec, TargetASC)
+			: TargetASC->ApplyGameplayEffectSpecToSelf(Spec);
+
+		NumApplied += Handle.WasSuccessfullyApplied() ? 1 : 0;
+		if (OutHandles)
+		{
+			OutHandles->Add(Handle);
+		}
+	}
+	return NumApplied;
+}
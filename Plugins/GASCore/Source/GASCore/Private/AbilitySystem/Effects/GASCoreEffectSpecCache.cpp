@@ -0,0 +1,150 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/Effects/GASCoreEffectSpecCache.h"
+
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "Engine/CurveTable.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+#include "Utilities/GASCoreEffectProfiler.h"
+
+static TAutoConsoleVariable<bool> CVarGASCoreEffectSpecCacheEnable(
+	TEXT("GASCore.EffectSpecCache.Enable"),
+	true,
+	TEXT("Copy cached (GE class, level) spec prototypes for static GameplayEffects instead of initializing new specs."),
+	ECVF_Default);
+
+namespace GASCoreEffectSpecCache
+{
+	struct FKey
+	{
+		FObjectKey EffectClass;
+		int32 Level = 0;
+
+		bool operator==(const FKey& Other) const { return EffectClass == Other.EffectClass && Level == Other.Level; }
+		friend uint32 GetTypeHash(const FKey& Key) { return HashCombineFast(GetTypeHash(Key.EffectClass), ::GetTypeHash(Key.Level)); }
+	};
+
+	struct FState
+	{
+		/** Null value = class is not cacheable (remembered so the check runs once per key). */
+		TMap<FKey, TUniquePtr<const FGameplayEffectSpec>> Prototypes;
+
+		/** UCurveTable global cache id the prototypes were built against. */
+		int32 CurveID = INDEX_NONE;
+
+#if WITH_EDITOR
+		FDelegateHandle ObjectPropertyChangedHandle;
+#endif
+	};
+
+	static FState& GetState()
+	{
+		static FState State;
+		return State;
+	}
+
+#if WITH_EDITOR
+	static void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+	{
+		if (Object && (Object->IsA<UGameplayEffect>() || Object->IsA<UCurveTable>()))
+		{
+			FGASCoreEffectSpecCache::Reset();
+		}
+	}
+#endif
+}
+
+bool FGASCoreEffectSpecCache::IsCacheable(const UGameplayEffect& Effect)
+{
+	auto IsStaticMagnitude = [](const FGameplayEffectModifierMagnitude& Magnitude)
+	{
+		const EGameplayEffectMagnitudeCalculation Type = Magnitude.GetMagnitudeCalculationType();
+		return Type == EGameplayEffectMagnitudeCalculation::ScalableFloat || Type == EGameplayEffectMagnitudeCalculation::SetByCaller;
+	};
+
+	if (!Effect.Executions.IsEmpty() || !IsStaticMagnitude(Effect.DurationMagnitude))
+	{
+		return false;
+	}
+	for (const FGameplayModifierInfo& Modifier : Effect.Modifiers)
+	{
+		if (!IsStaticMagnitude(Modifier.ModifierMagnitude))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+const FGameplayEffectSpec* FGASCoreEffectSpecCache::FindOrAddPrototype(UAbilitySystemComponent* ASC, const TSubclassOf<UGameplayEffect> EffectClass,
+	const float Level, const FGameplayEffectContextHandle& Context)
+{
+	const int32 IntegralLevel = FMath::RoundToInt(Level);
+	if (!ASC || !EffectClass || !CVarGASCoreEffectSpecCacheEnable.GetValueOnGameThread() || !IsInGameThread()
+		|| Level != static_cast<float>(IntegralLevel))
+	{
+		return nullptr;
+	}
+
+	GASCoreEffectSpecCache::FState& State = GASCoreEffectSpecCache::GetState();
+	if (State.CurveID != UCurveTable::GetGlobalCachedCurveID())
+	{
+		State.Prototypes.Reset();
+		State.CurveID = UCurveTable::GetGlobalCachedCurveID();
+	}
+
+#if WITH_EDITOR
+	if (!State.ObjectPropertyChangedHandle.IsValid())
+	{
+		State.ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&GASCoreEffectSpecCache::HandleObjectPropertyChanged);
+	}
+#endif
+
+	const GASCoreEffectSpecCache::FKey Key{ FObjectKey(EffectClass.Get()), IntegralLevel };
+	if (const TUniquePtr<const FGameplayEffectSpec>* Prototype = State.Prototypes.Find(Key))
+	{
+		return Prototype->Get();
+	}
+
+	// Miss: the regular path (keeps ASC overrides), then remember the pristine spec for this key.
+	const FGameplayEffectSpecHandle SpecHandle = ASC->MakeOutgoingSpec(EffectClass, Level, Context);
+	const FGameplayEffectSpec* Spec = SpecHandle.Data.Get();
+	const bool bCacheable = Spec && Spec->Def && IsCacheable(*Spec->Def);
+	return State.Prototypes.Add(Key, bCacheable ? MakeUnique<const FGameplayEffectSpec>(*Spec) : nullptr).Get();
+}
+
+FGameplayEffectSpecHandle FGASCoreEffectSpecCache::MakeOutgoingSpec(UAbilitySystemComponent* ASC, const TSubclassOf<UGameplayEffect> EffectClass,
+	const float Level, FGameplayEffectContextHandle Context)
+{
+	if (!ASC || !EffectClass)
+	{
+		return FGameplayEffectSpecHandle(nullptr);
+	}
+
+	if (!Context.IsValid())
+	{
+		Context = ASC->MakeEffectContext();
+	}
+
+	const FGameplayEffectSpec* Prototype = FindOrAddPrototype(ASC, EffectClass, Level, Context);
+	if (!Prototype)
+	{
+		return ASC->MakeOutgoingSpec(EffectClass, Level, Context);
+	}
+
+	GASCORE_EFFECT_COST_SCOPE(EGASCoreEffectCostPhase::SpecCreation, EffectClass.Get(),
+		GASCoreEffectProfiler::IsEnabled() ? GASCoreEffectProfiler::GetContextSource(Context) : nullptr, ASC);
+
+	// Copy, then rebind to this caller (recaptures the source actor tags from the new instigator).
+	FGameplayEffectSpec* NewSpec = new FGameplayEffectSpec(*Prototype);
+	NewSpec->SetContext(Context);
+	return FGameplayEffectSpecHandle(NewSpec);
+}
+
+void FGASCoreEffectSpecCache::Reset()
+{
+	GASCoreEffectSpecCache::GetState().Prototypes.Reset();
+}
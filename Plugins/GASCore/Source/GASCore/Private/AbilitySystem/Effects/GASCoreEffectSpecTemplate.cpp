@@ -0,0 +1,76 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/Effects/GASCoreEffectSpecTemplate.h"
+
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "GASCoreStats.h"
+#include "AbilitySystem/Effects/GASCoreEffectSpecCache.h"
+#include "Utilities/GASCoreEffectProfiler.h"
+
+void FGASCoreEffectSpecTemplate::Initialize(const TSubclassOf<UGameplayEffect> InEffectClass, const float InLevel)
+{
+	EffectClass = InEffectClass;
+	Level = InLevel;
+	Effect = InEffectClass ? InEffectClass->GetDefaultObject<UGameplayEffect>() : nullptr;
+	DurationPolicy = Effect ? Effect->DurationPolicy : EGameplayEffectDurationType::Instant;
+	bStatic = Effect && FGASCoreEffectSpecCache::IsCacheable(*Effect);
+	bPeriodic = Effect && Effect->Period.GetValue() > 0.f;
+
+	// GAS discards an application at the limit only in effect (nothing refreshed, nothing overflowed).
+	InertStackLimit = 0;
+	bStacksBySource = false;
+	if (Effect && DurationPolicy != EGameplayEffectDurationType::Instant && Effect->GetStackingType() != EGameplayEffectStackingType::None
+		&& Effect->StackLimitCount > 0
+		&& Effect->StackDurationRefreshPolicy == EGameplayEffectStackingDurationPolicy::NeverRefresh
+		&& Effect->StackPeriodResetPolicy == EGameplayEffectStackingPeriodPolicy::NeverReset
+		&& Effect->OverflowEffects.IsEmpty() && !(Effect->bDenyOverflowApplication && Effect->bClearStackOnOverflow))
+	{
+		InertStackLimit = Effect->StackLimitCount;
+		bStacksBySource = Effect->GetStackingType() == EGameplayEffectStackingType::AggregateBySource;
+	}
+}
+
+bool FGASCoreEffectSpecTemplate::WouldBeDiscarded(const UAbilitySystemComponent* TargetASC, const UAbilitySystemComponent* InstigatorASC) const
+{
+	if (InertStackLimit <= 0 || !TargetASC)
+	{
+		return false;
+	}
+
+	// Inhibited instances still hold their stacks, so count them too.
+	UAbilitySystemComponent* InstigatorFilter = bStacksBySource ? const_cast<UAbilitySystemComponent*>(InstigatorASC) : nullptr;
+	return TargetASC->GetGameplayEffectCount(EffectClass, InstigatorFilter, false) >= InertStackLimit;
+}
+
+FActiveGameplayEffectHandle FGASCoreEffectSpecTemplate::ApplyToSelf(UAbilitySystemComponent* TargetASC, FGameplayEffectContextHandle Context,
+	const FPredictionKey PredictionKey) const
+{
+	GASCORE_TRACE_SCOPE(FGASCoreEffectSpecTemplate::ApplyToSelf);
+	if (!TargetASC || !Effect)
+	{
+		return FActiveGameplayEffectHandle();
+	}
+
+	if (!Context.IsValid())
+	{
+		Context = TargetASC->MakeEffectContext();
+	}
+
+	// Static: clone the shared prototype on the stack and patch the context (recaptures source tags).
+	if (const FGameplayEffectSpec* Prototype = bStatic ? FGASCoreEffectSpecCache::FindOrAddPrototype(TargetASC, EffectClass, Level, Context) : nullptr)
+	{
+		const FGameplayEffectSpec Spec = [&]
+		{
+			GASCORE_EFFECT_COST_SCOPE(EGASCoreEffectCostPhase::SpecCreation, EffectClass.Get(),
+				GASCoreEffectProfiler::IsEnabled() ? GASCoreEffectProfiler::GetContextSource(Context) : nullptr, TargetASC);
+			FGameplayEffectSpec Clone(*Prototype);
+			Clone.SetContext(Context);
+			return Clone;
+		}();
+		return TargetASC->ApplyGameplayEffectSpecToSelf(Spec, PredictionKey);
+	}
+
+	const FGameplayEffectSpecHandle SpecHandle = TargetASC->MakeOutgoingSpec(EffectClass, Level, Context);
+	return SpecHandle.IsValid() ? TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get(), PredictionKey) : FActiveGameplayEffectHandle();
+}
@@ -0,0 +1,52 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/ExecCalcs/GASCoreExecCalcBase.h"
+
+#include "GameplayEffect.h"
+
+void UGASCoreExecCalcBase::PostInitProperties()
+{
+	Super::PostInitProperties();
+	RefreshAttributeCaptureDefinitions();
+}
+
+void UGASCoreExecCalcBase::PostLoad()
+{
+	Super::PostLoad();
+	RefreshAttributeCaptureDefinitions();
+}
+
+#if WITH_EDITOR
+void UGASCoreExecCalcBase::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	RefreshAttributeCaptureDefinitions();
+}
+#endif
+
+void UGASCoreExecCalcBase::RefreshAttributeCaptureDefinitions()
+{
+	RelevantAttributesToCapture.Reset();
+	BuildAttributeCaptureDefinitions(RelevantAttributesToCapture);
+}
+
+FAggregatorEvaluateParameters UGASCoreExecCalcBase::MakeEvaluationParameters(const FGameplayEffectCustomExecutionParameters& ExecutionParams)
+{
+	const FGameplayEffectSpec& Spec = ExecutionParams.GetOwningSpec();
+
+	FAggregatorEvaluateParameters EvaluationParameters;
+	EvaluationParameters.SourceTags = Spec.CapturedSourceTags.GetAggregatedTags();
+	EvaluationParameters.TargetTags = Spec.CapturedTargetTags.GetAggregatedTags();
+	return EvaluationParameters;
+}
+
+float UGASCoreExecCalcBase::GetCapturedMagnitude(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
+	const FGameplayEffectAttributeCaptureDefinition& CaptureDef, const FAggregatorEvaluateParameters& EvaluationParameters)
+{
+	float Magnitude = 0.f;
+	if (CaptureDef.AttributeToCapture.IsValid())
+	{
+		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(CaptureDef, EvaluationParameters, Magnitude);
+	}
+	return Magnitude;
+}
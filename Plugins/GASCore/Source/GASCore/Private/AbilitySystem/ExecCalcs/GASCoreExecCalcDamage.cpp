@@ -0,0 +1,52 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/ExecCalcs/GASCoreExecCalcDamage.h"
+
+#include "GameplayEffect.h"
+#include "AbilitySystem/Data/GASCoreFormulaCoefficientsDataAsset.h"
+
+void UGASCoreExecCalcDamage::Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
+	FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
+{
+	if (!IncomingDamageAttribute.IsValid())
+	{
+		return;
+	}
+
+	const FGameplayEffectSpec& Spec = ExecutionParams.GetOwningSpec();
+	const FAggregatorEvaluateParameters EvaluationParameters = MakeEvaluationParameters(ExecutionParams);
+
+	GASCoreFormulas::FDamageInputs Inputs;
+	Inputs.BaseDamage = DamageSetByCallerTag.IsValid() ? Spec.GetSetByCallerMagnitude(DamageSetByCallerTag, false, 0.f) : 0.f;
+	if (Inputs.BaseDamage <= 0.f)
+	{
+		return;
+	}
+
+	Inputs.SourceArmorPenetration = GetCapturedMagnitude(ExecutionParams, SourceArmorPenetration, EvaluationParameters);
+	Inputs.SourceCriticalHitChance = GetCapturedMagnitude(ExecutionParams, SourceCriticalHitChance, EvaluationParameters);
+	Inputs.SourceCriticalHitDamage = GetCapturedMagnitude(ExecutionParams, SourceCriticalHitDamage, EvaluationParameters);
+	Inputs.TargetArmor = GetCapturedMagnitude(ExecutionParams, TargetArmor, EvaluationParameters);
+	Inputs.TargetBlockChance = GetCapturedMagnitude(ExecutionParams, TargetBlockChance, EvaluationParameters);
+	Inputs.TargetCriticalHitResistance = GetCapturedMagnitude(ExecutionParams, TargetCriticalHitResistance, EvaluationParameters);
+
+	const GASCoreFormulas::FDamageResult Result = GASCoreFormulas::ResolveDamage(Inputs,
+		FMath::FRandRange(0.f, 100.f), FMath::FRandRange(0.f, 100.f), UGASCoreFormulaCoefficientsDataAsset::Resolve(Coefficients));
+
+	if (Result.Damage > 0.f)
+	{
+		OutExecutionOutput.AddOutputModifier(FGameplayModifierEvaluatedData(IncomingDamageAttribute, EGameplayModOp::Additive, Result.Damage));
+	}
+}
+
+void UGASCoreExecCalcDamage::BuildAttributeCaptureDefinitions(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures) const
+{
+	for (const FGameplayEffectAttributeCaptureDefinition* CaptureDef : { &SourceArmorPenetration, &SourceCriticalHitChance,
+		&SourceCriticalHitDamage, &TargetArmor, &TargetBlockChance, &TargetCriticalHitResistance })
+	{
+		if (CaptureDef->AttributeToCapture.IsValid())
+		{
+			OutCaptures.Add(*CaptureDef);
+		}
+	}
+}
@@ -0,0 +1,28 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/ExecCalcs/GASCoreExecCalcSecondaryAttributes.h"
+
+#include "AbilitySystem/Data/GASCoreFormulaCoefficientsDataAsset.h"
+
+void UGASCoreExecCalcSecondaryAttributes::Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
+	FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
+{
+	const FGASCorePrimaryAttributeValues Primaries = PrimaryCaptures.Evaluate(ExecutionParams);
+
+	float Values[static_cast<int32>(EGASCoreSecondaryFormula::Count)];
+	GASCoreFormulas::EvaluateAll(Primaries, UGASCoreFormulaCoefficientsDataAsset::Resolve(Coefficients), Values);
+
+	for (const TPair<EGASCoreSecondaryFormula, FGameplayAttribute>& Target : TargetAttributes)
+	{
+		const int32 Index = static_cast<int32>(Target.Key);
+		if (Target.Value.IsValid() && Index < UE_ARRAY_COUNT(Values))
+		{
+			OutExecutionOutput.AddOutputModifier(FGameplayModifierEvaluatedData(Target.Value, EGameplayModOp::Override, Values[Index]));
+		}
+	}
+}
+
+void UGASCoreExecCalcSecondaryAttributes::BuildAttributeCaptureDefinitions(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures) const
+{
+	PrimaryCaptures.AppendCaptures(OutCaptures);
+}
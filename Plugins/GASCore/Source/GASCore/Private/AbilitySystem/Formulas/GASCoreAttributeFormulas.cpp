@@ -0,0 +1,180 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/Formulas/GASCoreAttributeFormulas.h"
+
+#include "Math/VectorRegister.h"
+
+const FGASCoreFormulaCoefficients& FGASCoreFormulaCoefficients::GetDefault()
+{
+	static const FGASCoreFormulaCoefficients Default;
+	return Default;
+}
+
+void FGASCoreFormulaBatch::Reset(const int32 InNum)
+{
+	NumActors = FMath::Max(InNum, 0);
+	const int32 Padded = Align(NumActors, Lanes);
+	for (FBuffer& Buffer : Primaries)
+	{
+		Buffer.SetNumUninitialized(Padded, EAllowShrinking::No);
+		FMemory::Memzero(Buffer.GetData(), Padded * sizeof(float));
+	}
+	for (FBuffer& Buffer : Secondaries)
+	{
+		Buffer.SetNumUninitialized(Padded, EAllowShrinking::No);
+	}
+}
+
+namespace GASCoreFormulas
+{
+	enum EPrimaryBit : uint8
+	{
+		StrengthBit     = 1 << Strength,
+		DexterityBit    = 1 << Dexterity,
+		IntelligenceBit = 1 << Intelligence,
+		EnduranceBit    = 1 << Endurance,
+		VigorBit        = 1 << Vigor,
+	};
+
+	FDamageResult ResolveDamage(const FDamageInputs& In, const float BlockRoll, const float CritRoll, const FCoefficients& C)
+	{
+		FDamageResult Result;
+		float Damage = FMath::Max(In.BaseDamage, 0.f);
+
+		Result.bBlocked = BlockRoll < In.TargetBlockChance;
+		if (Result.bBlocked)
+		{
+			Damage *= C.BlockDamageMultiplier;
+		}
+		else
+		{
+			Result.bCriticalHit = CritRoll < EffectiveCriticalHitChance(In.SourceCriticalHitChance, In.TargetCriticalHitResistance, C);
+			if (Result.bCriticalHit)
+			{
+				Damage *= CriticalHitMultiplier(In.SourceCriticalHitDamage);
+			}
+		}
+
+		Damage *= ArmorDamageMultiplier(EffectiveArmor(In.TargetArmor, In.SourceArmorPenetration), C);
+		Result.Damage = FMath::Max(Damage, 0.f);
+		return Result;
+	}
+
+	float Evaluate(const EGASCoreSecondaryFormula Formula, const FPrimaries& P, const FCoefficients& C)
+	{
+		switch (Formula)
+		{
+		case EGASCoreSecondaryFormula::Armor:                 return Armor(P.Endurance, C);
+		case EGASCoreSecondaryFormula::ArmorPenetration:      return ArmorPenetration(P.Strength, C);
+		case EGASCoreSecondaryFormula::BlockChance:           return BlockChance(Armor(P.Endurance, C), C);
+		case EGASCoreSecondaryFormula::CriticalHitChance:     return CriticalHitChance(P.Dexterity, ArmorPenetration(P.Strength, C), C);
+		case EGASCoreSecondaryFormula::CriticalHitDamage:     return CriticalHitDamage(P.Dexterity, ArmorPenetration(P.Strength, C), C);
+		case EGASCoreSecondaryFormula::CriticalHitResistance: return CriticalHitResistance(Armor(P.Endurance, C), C);
+		case EGASCoreSecondaryFormula::Evasion:               return Evasion(P.Dexterity, P.Endurance, C);
+		case EGASCoreSecondaryFormula::MaxHealth:             return MaxHealth(P.Vigor, C);
+		case EGASCoreSecondaryFormula::HealthRegeneration:    return HealthRegeneration(P.Vigor, C);
+		case EGASCoreSecondaryFormula::MaxMana:               return MaxMana(P.Intelligence, C);
+		case EGASCoreSecondaryFormula::ManaRegeneration:      return ManaRegeneration(P.Intelligence, C);
+		case EGASCoreSecondaryFormula::MaxStamina:            return MaxStamina(P.Vigor, C);
+		case EGASCoreSecondaryFormula::StaminaRegeneration:   return StaminaRegeneration(P.Vigor, C);
+		default:                                              return 0.f;
+		}
+	}
+
+	void EvaluateAll(const FPrimaries& P, const FCoefficients& C, float (&OutValues)[NumSecondaryFormulas])
+	{
+		// Shared intermediates computed once (the GE path re-aggregates them per modifier).
+		const float ArmorValue = Armor(P.Endurance, C);
+		const float ArmorPenetrationValue = ArmorPenetration(P.Strength, C);
+
+		auto Out = [&OutValues](EGASCoreSecondaryFormula Formula) -> float& { return OutValues[static_cast<int32>(Formula)]; };
+		Out(EGASCoreSecondaryFormula::Armor)                 = ArmorValue;
+		Out(EGASCoreSecondaryFormula::ArmorPenetration)      = ArmorPenetrationValue;
+		Out(EGASCoreSecondaryFormula::BlockChance)           = BlockChance(ArmorValue, C);
+		Out(EGASCoreSecondaryFormula::CriticalHitChance)     = CriticalHitChance(P.Dexterity, ArmorPenetrationValue, C);
+		Out(EGASCoreSecondaryFormula::CriticalHitDamage)     = CriticalHitDamage(P.Dexterity, ArmorPenetrationValue, C);
+		Out(EGASCoreSecondaryFormula::CriticalHitResistance) = CriticalHitResistance(ArmorValue, C);
+		Out(EGASCoreSecondaryFormula::Evasion)               = Evasion(P.Dexterity, P.Endurance, C);
+		Out(EGASCoreSecondaryFormula::MaxHealth)             = MaxHealth(P.Vigor, C);
+		Out(EGASCoreSecondaryFormula::HealthRegeneration)    = HealthRegeneration(P.Vigor, C);
+		Out(EGASCoreSecondaryFormula::MaxMana)               = MaxMana(P.Intelligence, C);
+		Out(EGASCoreSecondaryFormula::ManaRegeneration)      = ManaRegeneration(P.Intelligence, C);
+		Out(EGASCoreSecondaryFormula::MaxStamina)            = MaxStamina(P.Vigor, C);
+		Out(EGASCoreSecondaryFormula::StaminaRegeneration)   = StaminaRegeneration(P.Vigor, C);
+	}
+
+	uint8 GetPrimaryInputMask(const EGASCoreSecondaryFormula Formula)
+	{
+		switch (Formula)
+		{
+		case EGASCoreSecondaryFormula::Armor:
+		case EGASCoreSecondaryFormula::BlockChance:
+		case EGASCoreSecondaryFormula::CriticalHitResistance: return EnduranceBit;
+		case EGASCoreSecondaryFormula::ArmorPenetration:      return StrengthBit;
+		case EGASCoreSecondaryFormula::CriticalHitChance:
+		case EGASCoreSecondaryFormula::CriticalHitDamage:     return DexterityBit | StrengthBit;
+		case EGASCoreSecondaryFormula::Evasion:               return DexterityBit | EnduranceBit;
+		case EGASCoreSecondaryFormula::MaxHealth:
+		case EGASCoreSecondaryFormula::HealthRegeneration:
+		case EGASCoreSecondaryFormula::MaxStamina:
+		case EGASCoreSecondaryFormula::StaminaRegeneration:   return VigorBit;
+		case EGASCoreSecondaryFormula::MaxMana:
+		case EGASCoreSecondaryFormula::ManaRegeneration:      return IntelligenceBit;
+		default:                                              return 0;
+		}
+	}
+
+	void EvaluateAllBatch(FGASCoreFormulaBatch& Batch, const FCoefficients& C)
+	{
+		// Same math as EvaluateAll, one register of FGASCoreFormulaBatch::Lanes actors at a time.
+		// a * (x + b) is computed as a*x + a*b (one fused multiply-add with a splatted constant).
+		const VectorRegister4Float Zero = VectorZeroFloat();
+		auto Splat = [](const float Value) { return VectorSetFloat1(Value); };
+
+		const VectorRegister4Float ArmorScale = Splat(C.ArmorScale),                       ArmorBias = Splat(C.ArmorScale * C.ArmorOffset);
+		const VectorRegister4Float PenScale = Splat(C.ArmorPenetrationScale),              PenBias = Splat(C.ArmorPenetrationScale * C.ArmorPenetrationOffset);
+		const VectorRegister4Float BlockPerArmor = Splat(C.BlockChancePerArmor),           BlockMax = Splat(C.BlockChanceMax);
+		const VectorRegister4Float CritChanceScale = Splat(C.CritChanceScale),             CritChanceBias = Splat(C.CritChanceScale * C.CritChanceOffset);
+		const VectorRegister4Float CritChancePerPen = Splat(C.CritChancePerArmorPenetration), CritChanceMax = Splat(C.CritChanceMax);
+		const VectorRegister4Float CritDamagePerDex = Splat(C.CritDamagePerDexterity),     CritDamagePerPen = Splat(C.CritDamagePerArmorPenetration), CritDamageBase = Splat(C.CritDamageBase);
+		const VectorRegister4Float CritResPerArmor = Splat(C.CritResistancePerArmor);
+		const VectorRegister4Float EvasionScale = Splat(C.EvasionScale),                   EvasionBase = Splat(C.EvasionBase);
+		const VectorRegister4Float MaxHealthPerVigor = Splat(C.MaxHealthPerVigor),         MaxHealthBase = Splat(C.MaxHealthBase);
+		const VectorRegister4Float HealthRegenScale = Splat(C.HealthRegenScale),           HealthRegenBias = Splat(C.HealthRegenScale * C.HealthRegenOffset);
+		const VectorRegister4Float MaxManaPerInt = Splat(C.MaxManaPerIntelligence),        MaxManaBase = Splat(C.MaxManaBase);
+		const VectorRegister4Float ManaRegenPerInt = Splat(C.ManaRegenPerIntelligence),    ManaRegenBase = Splat(C.ManaRegenBase);
+		const VectorRegister4Float MaxStaminaPerVigor = Splat(C.MaxStaminaPerVigor),       MaxStaminaBase = Splat(C.MaxStaminaBase);
+		const VectorRegister4Float StaminaRegenScale = Splat(C.StaminaRegenScale),         StaminaRegenBias = Splat(C.StaminaRegenScale * C.StaminaRegenOffset);
+
+		auto Out = [&Batch](EGASCoreSecondaryFormula Formula, const int32 Index) { return &Batch.Secondaries[static_cast<int32>(Formula)][Index]; };
+
+		for (int32 Index = 0; Index < Batch.NumPadded(); Index += FGASCoreFormulaBatch::Lanes)
+		{
+			const VectorRegister4Float Str = VectorLoadAligned(&Batch.Primaries[Strength][Index]);
+			const VectorRegister4Float Dex = VectorLoadAligned(&Batch.Primaries[Dexterity][Index]);
+			const VectorRegister4Float Int = VectorLoadAligned(&Batch.Primaries[Intelligence][Index]);
+			const VectorRegister4Float End = VectorLoadAligned(&Batch.Primaries[Endurance][Index]);
+			const VectorRegister4Float Vig = VectorLoadAligned(&Batch.Primaries[Vigor][Index]);
+
+			const VectorRegister4Float ArmorValue = VectorMultiplyAdd(End, ArmorScale, ArmorBias);
+			const VectorRegister4Float PenValue = VectorMultiplyAdd(Str, PenScale, PenBias);
+
+			VectorStoreAligned(ArmorValue, Out(EGASCoreSecondaryFormula::Armor, Index));
+			VectorStoreAligned(PenValue, Out(EGASCoreSecondaryFormula::ArmorPenetration, Index));
+			VectorStoreAligned(VectorMin(VectorMax(VectorMultiply(ArmorValue, BlockPerArmor), Zero), BlockMax),
+				Out(EGASCoreSecondaryFormula::BlockChance, Index));
+			VectorStoreAligned(VectorMin(VectorMax(VectorMultiplyAdd(PenValue, CritChancePerPen, VectorMultiplyAdd(Dex, CritChanceScale, CritChanceBias)), Zero), CritChanceMax),
+				Out(EGASCoreSecondaryFormula::CriticalHitChance, Index));
+			VectorStoreAligned(VectorMultiplyAdd(PenValue, CritDamagePerPen, VectorMultiplyAdd(Dex, CritDamagePerDex, CritDamageBase)),
+				Out(EGASCoreSecondaryFormula::CriticalHitDamage, Index));
+			VectorStoreAligned(VectorMultiply(ArmorValue, CritResPerArmor), Out(EGASCoreSecondaryFormula::CriticalHitResistance, Index));
+			VectorStoreAligned(VectorMultiplyAdd(VectorAdd(Dex, End), EvasionScale, EvasionBase), Out(EGASCoreSecondaryFormula::Evasion, Index));
+			VectorStoreAligned(VectorMultiplyAdd(Vig, MaxHealthPerVigor, MaxHealthBase), Out(EGASCoreSecondaryFormula::MaxHealth, Index));
+			VectorStoreAligned(VectorMultiplyAdd(Vig, HealthRegenScale, HealthRegenBias), Out(EGASCoreSecondaryFormula::HealthRegeneration, Index));
+			VectorStoreAligned(VectorMultiplyAdd(Int, MaxManaPerInt, MaxManaBase), Out(EGASCoreSecondaryFormula::MaxMana, Index));
+			VectorStoreAligned(VectorMultiplyAdd(Int, ManaRegenPerInt, ManaRegenBase), Out(EGASCoreSecondaryFormula::ManaRegeneration, Index));
+			VectorStoreAligned(VectorMultiplyAdd(Vig, MaxStaminaPerVigor, MaxStaminaBase), Out(EGASCoreSecondaryFormula::MaxStamina, Index));
+			VectorStoreAligned(VectorMultiplyAdd(Vig, StaminaRegenScale, StaminaRegenBias), Out(EGASCoreSecondaryFormula::StaminaRegeneration, Index));
+		}
+	}
+}
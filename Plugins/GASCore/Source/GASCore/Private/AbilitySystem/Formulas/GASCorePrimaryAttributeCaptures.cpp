@@ -0,0 +1,69 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/Formulas/GASCorePrimaryAttributeCaptures.h"
+
+#include "GameplayEffect.h"
+#include "GameplayEffectExecutionCalculation.h"
+
+namespace
+{
+	// Bit order matches GASCoreFormulas::GetPrimaryInputMask (Str, Dex, Int, End, Vig).
+	template <typename FunctorType>
+	void ForEachCapture(const FGASCorePrimaryAttributeCaptures& Captures, FGASCorePrimaryAttributeValues& Values, const uint8 InputMask, FunctorType&& Functor)
+	{
+		const FGameplayEffectAttributeCaptureDefinition* Defs[] = { &Captures.Strength, &Captures.Dexterity, &Captures.Intelligence, &Captures.Endurance, &Captures.Vigor };
+		float* Outs[] = { &Values.Strength, &Values.Dexterity, &Values.Intelligence, &Values.Endurance, &Values.Vigor };
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(Defs); ++Index)
+		{
+			if ((InputMask & (1 << Index)) && Defs[Index]->AttributeToCapture.IsValid())
+			{
+				Functor(*Defs[Index], *Outs[Index]);
+			}
+		}
+	}
+}
+
+void FGASCorePrimaryAttributeCaptures::AppendCaptures(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures, const uint8 InputMask) const
+{
+	FGASCorePrimaryAttributeValues Unused;
+	ForEachCapture(*this, Unused, InputMask, [&OutCaptures](const FGameplayEffectAttributeCaptureDefinition& Def, float&)
+	{
+		OutCaptures.AddUnique(Def);
+	});
+}
+
+FGASCorePrimaryAttributeValues FGASCorePrimaryAttributeCaptures::Evaluate(const FGameplayEffectSpec& Spec, const uint8 InputMask) const
+{
+	// Tag-aware evaluation, same as UGASCoreMMCSingleBackedAttribute.
+	FAggregatorEvaluateParameters EvaluationParameters;
+	EvaluationParameters.SourceTags = Spec.CapturedSourceTags.GetAggregatedTags();
+	EvaluationParameters.TargetTags = Spec.CapturedTargetTags.GetAggregatedTags();
+
+	FGASCorePrimaryAttributeValues Values;
+	ForEachCapture(*this, Values, InputMask, [&Spec, &EvaluationParameters](const FGameplayEffectAttributeCaptureDefinition& Def, float& Out)
+	{
+		if (const FGameplayEffectAttributeCaptureSpec* Cap = Spec.CapturedRelevantAttributes.FindCaptureSpecByDefinition(Def, /*bIncludeModifiers=*/true))
+		{
+			Cap->AttemptCalculateAttributeMagnitude(EvaluationParameters, Out);
+		}
+		Out = FMath::Max(Out, 0.f);
+	});
+	return Values;
+}
+
+FGASCorePrimaryAttributeValues FGASCorePrimaryAttributeCaptures::Evaluate(const FGameplayEffectCustomExecutionParameters& ExecutionParams, const uint8 InputMask) const
+{
+	const FGameplayEffectSpec& Spec = ExecutionParams.GetOwningSpec();
+
+	FAggregatorEvaluateParameters EvaluationParameters;
+	EvaluationParameters.SourceTags = Spec.CapturedSourceTags.GetAggregatedTags();
+	EvaluationParameters.TargetTags = Spec.CapturedTargetTags.GetAggregatedTags();
+
+	FGASCorePrimaryAttributeValues Values;
+	ForEachCapture(*this, Values, InputMask, [&ExecutionParams, &EvaluationParameters](const FGameplayEffectAttributeCaptureDefinition& Def, float& Out)
+	{
+		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(Def, EvaluationParameters, Out);
+		Out = FMath::Max(Out, 0.f);
+	});
+	return Values;
+}
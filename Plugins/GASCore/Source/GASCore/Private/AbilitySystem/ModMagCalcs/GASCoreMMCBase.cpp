@@ -0,0 +1,99 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/ModMagCalcs/GASCoreMMCBase.h"
+
+#include "GameplayEffect.h"
+#include "Interfaces/GASCoreCombatInterface.h"
+
+void UGASCoreMMCBase::PostInitProperties()
+{
+	Super::PostInitProperties();
+	RefreshAttributeCaptureDefinitions();
+}
+
+void UGASCoreMMCBase::PostLoad()
+{
+	Super::PostLoad();
+	RefreshAttributeCaptureDefinitions();
+}
+
+#if WITH_EDITOR
+void UGASCoreMMCBase::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	RefreshAttributeCaptureDefinitions();
+}
+#endif
+
+FOnExternalGameplayModifierDependencyChange* UGASCoreMMCBase::GetExternalModifierDependencyMulticast(const FGameplayEffectSpec& Spec,
+	UWorld* World) const
+{
+	if (LevelSource == EGASCoreMMCLevelSource::CombatInterface)
+	{
+		if (IGASCoreCombatInterface* CombatInterface = Cast<IGASCoreCombatInterface>(Spec.GetContext().GetSourceObject()))
+		{
+			return CombatInterface->GetActorLevelChangedDelegate();
+		}
+	}
+	return Super::GetExternalModifierDependencyMulticast(Spec, World);
+}
+
+void UGASCoreMMCBase::RefreshAttributeCaptureDefinitions()
+{
+	RelevantAttributesToCapture.Reset();
+	BuildAttributeCaptureDefinitions(RelevantAttributesToCapture);
+	if (LevelSource == EGASCoreMMCLevelSource::CapturedAttribute && LevelAttributeDef.AttributeToCapture.IsValid())
+	{
+		RelevantAttributesToCapture.AddUnique(LevelAttributeDef);
+	}
+}
+
+float UGASCoreMMCBase::GetCapturedMagnitude(const FGameplayEffectSpec& Spec, const FGameplayEffectAttributeCaptureDefinition& CaptureDef,
+	const FAggregatorEvaluateParameters& EvaluationParameters)
+{
+	float Magnitude = 0.f;
+	if (CaptureDef.AttributeToCapture.IsValid())
+	{
+		if (const FGameplayEffectAttributeCaptureSpec* Cap =
+				Spec.CapturedRelevantAttributes.FindCaptureSpecByDefinition(CaptureDef, /*bIncludeModifiers=*/true))
+		{
+			// AttemptCalculateAttributeMagnitude applies the aggregator pipeline and respects the provided tags.
+			Cap->AttemptCalculateAttributeMagnitude(EvaluationParameters, Magnitude);
+		}
+	}
+	return Magnitude;
+}
+
+float UGASCoreMMCBase::GetSourceLevel(const FGameplayEffectSpec& Spec, const FAggregatorEvaluateParameters& EvaluationParameters) const
+{
+	switch (LevelSource)
+	{
+	case EGASCoreMMCLevelSource::SpecLevel:
+		return Spec.GetLevel();
+	case EGASCoreMMCLevelSource::SetByCaller:
+		return Spec.GetSetByCallerMagnitude(LevelSetByCallerTag, /*WarnIfNotFound=*/false, /*DefaultIfNotFound=*/1.f);
+	case EGASCoreMMCLevelSource::CapturedAttribute:
+		return GetCapturedMagnitude(Spec, LevelAttributeDef, EvaluationParameters);
+	default:
+		{
+			// Legacy: best practice is that the spec's applier set Context.AddSourceObject(SomeActorImplementingICombatInterface).
+			IGASCoreCombatInterface* CombatInterface = Cast<IGASCoreCombatInterface>(Spec.GetContext().GetSourceObject());
+			return CombatInterface ? static_cast<float>(CombatInterface->GetActorLevel()) : 1.f;
+		}
+	}
+}
+
+float UGASCoreMMCBase::ApplyRoundingPolicy(const float Value, const EGASCoreMMCRoundingPolicy Policy)
+{
+	switch (Policy)
+	{
+	case EGASCoreMMCRoundingPolicy::RoundHalfToEven:
+		return FMath::RoundHalfToEven(Value);
+	case EGASCoreMMCRoundingPolicy::Floor:
+		return FMath::FloorToFloat(Value);
+	case EGASCoreMMCRoundingPolicy::Ceil:
+		return FMath::CeilToFloat(Value);
+	default:
+		return Value; // EGASCoreMMCRoundingPolicy::None
+	}
+}
@@ -0,0 +1,17 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/ModMagCalcs/GASCoreMMCSecondaryFormula.h"
+
+#include "AbilitySystem/Data/GASCoreFormulaCoefficientsDataAsset.h"
+
+float UGASCoreMMCSecondaryFormula::CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const
+{
+	const uint8 InputMask = GASCoreFormulas::GetPrimaryInputMask(Formula);
+	const FGASCorePrimaryAttributeValues Primaries = PrimaryCaptures.Evaluate(Spec, InputMask);
+	return GASCoreFormulas::Evaluate(Formula, Primaries, UGASCoreFormulaCoefficientsDataAsset::Resolve(Coefficients));
+}
+
+void UGASCoreMMCSecondaryFormula::BuildAttributeCaptureDefinitions(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures) const
+{
+	PrimaryCaptures.AppendCaptures(OutCaptures, GASCoreFormulas::GetPrimaryInputMask(Formula));
+}
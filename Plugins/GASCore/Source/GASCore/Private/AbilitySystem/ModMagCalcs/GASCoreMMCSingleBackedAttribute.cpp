@@ -7,7 +7,6 @@
 #include "GASCore/Public/AbilitySystem/ModMagCalcs/GASCoreMMCSingleBackedAttribute.h"
 
 #include "GASCore/Public/AbilitySystem/Attributes/GASCoreAttributeSet.h"
-#include "GASCore/Public/Interfaces/GASCoreCombatInterface.h"
 
 UGASCoreMMCSingleBackedAttribute::UGASCoreMMCSingleBackedAttribute()
 {
@@ -26,8 +25,8 @@ float UGASCoreMMCSingleBackedAttribute::CalculateBaseMagnitude_Implementation(co
 		- Execution is on the game thread; please keep it allocation-free and fast.
 		- Recompute triggers:
 			* Captured attributes with bSnapshot=false auto-recompute on attribute change.
-			* Non-attribute inputs (e.g., Level via interface) do NOT auto-recompute. Reapply the infinite GE on level change,
-			  or model Level as an attribute if you want live updates.
+			* Non-attribute inputs (e.g., Level via interface or spec) do NOT auto-recompute. Reapply the infinite GE on level
+			  change, or use LevelSource = CapturedAttribute (non-snapshot) if you want live updates.
 	*/
 
 	// Tag-aware evaluation params so conditionally gated modifiers (by tags) are respected during capture evaluation.
@@ -39,25 +38,14 @@ float UGASCoreMMCSingleBackedAttribute::CalculateBaseMagnitude_Implementation(co
 	EvaluationParameters.TargetTags = TargetTags;
 
 	// 1) Captured attribute value (post-aggregation). Zero if not configured or not found.
-	float AttributeValue = 0.f;
-	if (CapturedAttributeDef.AttributeToCapture.IsValid())
-	{
-		if (const FGameplayEffectAttributeCaptureSpec* Cap =
-				Spec.CapturedRelevantAttributes.FindCaptureSpecByDefinition(CapturedAttributeDef, /*bIncludeModifiers=*/true))
-		{
-			// AttemptCalculateAttributeMagnitude applies the aggregator pipeline and respects the provided tags.
-			Cap->AttemptCalculateAttributeMagnitude(EvaluationParameters, AttributeValue);
-		}
-	}
+	float AttributeValue = GetCapturedMagnitude(Spec, CapturedAttributeDef, EvaluationParameters);
 	// Defensive clamp: keeps negative values from inverting results if that is undesirable for your use case.
 	// If you want debuffs to reduce the result via negative attributes, remove this clamp.
 	AttributeValue = FMath::Max(AttributeValue, 0.f);
 
-	// 2) External (non-attribute) dependency: Level from SourceObject via ICombatInterface.
-	//    Best practice: when creating the GE spec, the applier sets Context.AddSourceObject(SomeActorImplementingICombatInterface).
-	//    If absent, we default to 1 here. Alternatively (and more robustly), you can fall back to Spec.GetLevel().
-	IGASCoreCombatInterface* CombatInterface = Cast<IGASCoreCombatInterface>(Spec.GetContext().GetSourceObject());
-	const int32 PlayerLevel = CombatInterface ? CombatInterface->GetActorLevel() : 1;
+	// 2) Level per LevelSource (legacy default: SourceObject via ICombatInterface on every evaluation).
+	//    SpecLevel / SetByCaller / CapturedAttribute avoid the interface cast and only change on an actual level change.
+	const float PlayerLevel = LevelMultiplier != 0.f ? GetSourceLevel(Spec, EvaluationParameters) : 0.f;
 
 	// 3) Compute the base value. Designers can further scale this in the GE modifier if desired.
 	const float FinalValue = BaseMagnitude
@@ -65,33 +53,16 @@ float UGASCoreMMCSingleBackedAttribute::CalculateBaseMagnitude_Implementation(co
 		+ LevelMultiplier     * PlayerLevel;
 
 	// 4) Apply rounding policy (display-oriented). Engine stores floats; rounding avoids ".5" artifacts in Max displays.
-	return FinalizeOutput(FinalValue);
+	return ApplyRoundingPolicy(FinalValue, RoundingPolicy);
 }
 
-const TArray<FGameplayEffectAttributeCaptureDefinition>& UGASCoreMMCSingleBackedAttribute::GetAttributeCaptureDefinitions() const
+void UGASCoreMMCSingleBackedAttribute::BuildAttributeCaptureDefinitions(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures) const
 {
 	// Ensure the engine captures whatever attribute is configured on the CDO.
-	// Returning this list here (instead of pushing into RelevantAttributesToCapture) guarantees that the
-	// capture set is available when the GameplayEffectSpec is constructed.
-	CachedCaptures.Reset();
+	// Registered in RelevantAttributesToCapture (once per load/edit) so the capture set is available when the
+	// GameplayEffectSpec is constructed.
 	if (CapturedAttributeDef.AttributeToCapture.IsValid())
 	{
-		CachedCaptures.Add(CapturedAttributeDef);
+		OutCaptures.Add(CapturedAttributeDef);
 	}
-	return CachedCaptures;
 }
-
-float UGASCoreMMCSingleBackedAttribute::FinalizeOutput(float Value) const
-{
-	switch (RoundingPolicy)
-	{
-	case EGASCoreMMCRoundingPolicy::RoundHalfToEven:
-		return FMath::RoundHalfToEven(Value);
-	case EGASCoreMMCRoundingPolicy::Floor:
-		return FMath::FloorToFloat(Value);
-	case EGASCoreMMCRoundingPolicy::Ceil:
-		return FMath::CeilToFloat(Value);
-	default:
-		return Value; // EMMCRoundingPolicy::None
-	}
-}
\ No newline at end of file
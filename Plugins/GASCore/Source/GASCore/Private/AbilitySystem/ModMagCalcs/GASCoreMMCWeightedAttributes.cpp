@@ -0,0 +1,42 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/ModMagCalcs/GASCoreMMCWeightedAttributes.h"
+
+#include "GameplayEffect.h"
+
+float UGASCoreMMCWeightedAttributes::CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const
+{
+	// Tag-aware evaluation params so conditionally gated modifiers (by tags) are respected during capture evaluation.
+	FAggregatorEvaluateParameters EvaluationParameters;
+	EvaluationParameters.SourceTags = Spec.CapturedSourceTags.GetAggregatedTags();
+	EvaluationParameters.TargetTags = Spec.CapturedTargetTags.GetAggregatedTags();
+
+	float Value = BaseMagnitude;
+	for (const FGASCoreMMCWeightedTerm& Term : Terms)
+	{
+		float AttributeValue = GetCapturedMagnitude(Spec, Term.CapturedAttributeDef, EvaluationParameters);
+		if (bClampNegativeAttributes)
+		{
+			AttributeValue = FMath::Max(AttributeValue, 0.f);
+		}
+		Value += Term.Coefficient * AttributeValue;
+	}
+
+	if (LevelMultiplier != 0.f)
+	{
+		Value += LevelMultiplier * GetSourceLevel(Spec, EvaluationParameters);
+	}
+
+	return ApplyRoundingPolicy(Value, RoundingPolicy);
+}
+
+void UGASCoreMMCWeightedAttributes::BuildAttributeCaptureDefinitions(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures) const
+{
+	for (const FGASCoreMMCWeightedTerm& Term : Terms)
+	{
+		if (Term.CapturedAttributeDef.AttributeToCapture.IsValid())
+		{
+			OutCaptures.AddUnique(Term.CapturedAttributeDef);
+		}
+	}
+}
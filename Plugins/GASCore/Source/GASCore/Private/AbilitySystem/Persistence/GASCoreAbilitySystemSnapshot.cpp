@@ -0,0 +1,541 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "AbilitySystem/Persistence/GASCoreAbilitySystemSnapshot.h"
+
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "GASCoreStats.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "AbilitySystem/Attributes/GASCoreAttributeMetadata.h"
+#include "AbilitySystem/Attributes/GASCoreAttributeSet.h"
+#include "AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
+#include "AbilitySystem/Effects/GASCoreEffectSpecCache.h"
+#include "Utilities/GASCoreLogging.h"
+
+namespace GASCoreAbilitySystemSnapshot
+{
+	static constexpr uint32 Magic = 0x53534347; // "GCSS"
+	static constexpr uint16 Version = 1;
+
+	/** Upper bound for any table or row count read from a blob (a corrupt count must not allocate gigabytes). */
+	static constexpr uint32 MaxCount = 1 << 16;
+
+	/** Class path → class, kept across loads (checkpoint reloads resolve every class once per process). */
+	static TMap<FTopLevelAssetPath, TWeakObjectPtr<UClass>> ResolvedClasses;
+
+	/** Packed index: INDEX_NONE-based values are stored +1 (one byte for small tables). */
+	static void SerializeIndex(FArchive& Ar, int32& Value)
+	{
+		uint32 Packed = static_cast<uint32>(Value + 1);
+		Ar.SerializeIntPacked(Packed);
+		Value = static_cast<int32>(Packed) - 1;
+	}
+
+	/** Serialize Array as a packed count, then SerializeElement per element. */
+	template <typename ArrayType, typename ElementFunc>
+	static void SerializeArray(FArchive& Ar, ArrayType& Array, ElementFunc&& SerializeElement)
+	{
+		uint32 Num = static_cast<uint32>(Array.Num());
+		Ar.SerializeIntPacked(Num);
+		if (Ar.IsLoading())
+		{
+			if (Num > MaxCount)
+			{
+				Ar.SetError();
+				return;
+			}
+			Array.SetNum(Num);
+		}
+
+		for (auto& Element : Array)
+		{
+			SerializeElement(Element);
+			if (Ar.IsError())
+			{
+				return;
+			}
+		}
+	}
+}
+
+FGASCoreAbilitySystemSnapshot FGASCoreAbilitySystemSnapshot::Capture(const UAbilitySystemComponent& AbilitySystem,
+	const FGameplayTagContainer& PersistentEffectTags, const TConstArrayView<TSubclassOf<UGameplayEffect>> PersistentEffectClasses)
+{
+	GASCORE_TRACE_SCOPE(FGASCoreAbilitySystemSnapshot::Capture);
+
+	FGASCoreAbilitySystemSnapshot Snapshot;
+
+	// Attribute base values, per class layout (names once per class), straight from the metadata offsets.
+	TMap<const UClass*, int32> LayoutIndices;
+	for (const UAttributeSet* Set : AbilitySystem.GetSpawnedAttributes())
+	{
+		const UGASCoreAttributeSet* CoreSet = Cast<UGASCoreAttributeSet>(Set);
+		if (!CoreSet)
+		{
+			continue;
+		}
+
+		const FGASCoreAttributeMetadata& Metadata = CoreSet->GetAttributeMetadata();
+		int32* LayoutIndex = LayoutIndices.Find(CoreSet->GetClass());
+		if (!LayoutIndex)
+		{
+			FAttributeLayout& Layout = Snapshot.Layouts.AddDefaulted_GetRef();
+			Layout.ClassIndex = Snapshot.AddClass(CoreSet->GetClass());
+			for (int32 Ordinal = 0; Ordinal < Metadata.Num(); ++Ordinal)
+			{
+				if (Metadata.MetaTargetOrdinals[Ordinal] == INDEX_NONE)
+				{
+					Layout.NameIndices.Add(Snapshot.AddName(Metadata.Properties[Ordinal]->GetFName()));
+				}
+			}
+			LayoutIndex = &LayoutIndices.Add(CoreSet->GetClass(), Snapshot.Layouts.Num() - 1);
+		}
+
+		FAttributeSetValues& Values = Snapshot.AttributeSets.AddDefaulted_GetRef();
+		Values.LayoutIndex = *LayoutIndex;
+		Values.BaseValues.Reserve(Metadata.Num());
+		for (int32 Ordinal = 0; Ordinal < Metadata.Num(); ++Ordinal)
+		{
+			if (Metadata.MetaTargetOrdinals[Ordinal] == INDEX_NONE)
+			{
+				Values.BaseValues.Add(CoreSet->GetAttributeDataAt(Ordinal).GetBaseValue());
+			}
+		}
+	}
+
+	for (const FGameplayAbilitySpec& Spec : AbilitySystem.GetActivatableAbilities())
+	{
+		if (!Spec.Ability || Spec.PendingRemove)
+		{
+			continue;
+		}
+
+		FAbility& Ability = Snapshot.Abilities.AddDefaulted_GetRef();
+		Ability.ClassIndex = Snapshot.AddClass(Spec.Ability->GetClass());
+		Ability.Level = Spec.Level;
+		for (const FGameplayTag& Tag : Spec.GetDynamicSpecSourceTags())
+		{
+			Ability.TagNameIndices.Add(Snapshot.AddName(Tag.GetTagName()));
+		}
+	}
+
+	if (!PersistentEffectTags.IsEmpty() || !PersistentEffectClasses.IsEmpty())
+	{
+		const FActiveGameplayEffectsContainer& ActiveEffects = AbilitySystem.GetActiveGameplayEffects();
+		const float WorldTime = ActiveEffects.GetWorldTime();
+		FGameplayTagContainer AssetTags;
+		for (const FActiveGameplayEffect& Active : &ActiveEffects)
+		{
+			if (Active.IsPendingRemove || !Active.Spec.Def)
+			{
+				continue;
+			}
+
+			if (!PersistentEffectClasses.Contains(Active.Spec.Def->GetClass()))
+			{
+				AssetTags.Reset();
+				Active.Spec.GetAllAssetTags(AssetTags);
+				if (!AssetTags.HasAny(PersistentEffectTags))
+				{
+					continue;
+				}
+			}
+
+			// About to expire: nothing left to restore.
+			const bool bHasDuration = Active.GetDuration() > 0.f;
+			const float TimeRemaining = bHasDuration ? Active.GetTimeRemaining(WorldTime) : -1.f;
+			if (bHasDuration && TimeRemaining <= 0.f)
+			{
+				continue;
+			}
+
+			FEffect& Effect = Snapshot.Effects.AddDefaulted_GetRef();
+			Effect.ClassIndex = Snapshot.AddClass(Active.Spec.Def->GetClass());
+			Effect.Level = Active.Spec.GetLevel();
+			Effect.StackCount = Active.Spec.GetStackCount();
+			Effect.TimeRemaining = TimeRemaining;
+			for (const TPair<FGameplayTag, float>& Pair : Active.Spec.SetByCallerTagMagnitudes)
+			{
+				Effect.SetByCallerTags.Emplace(Snapshot.AddName(Pair.Key.GetTagName()), Pair.Value);
+			}
+			for (const TPair<FName, float>& Pair : Active.Spec.SetByCallerNameMagnitudes)
+			{
+				Effect.SetByCallerNames.Emplace(Snapshot.AddName(Pair.Key), Pair.Value);
+			}
+		}
+	}
+
+	// Capture-time lookups are not part of the snapshot.
+	Snapshot.ClassIndices.Empty();
+	Snapshot.NameIndices.Empty();
+	return Snapshot;
+}
+
+bool FGASCoreAbilitySystemSnapshot::Apply(UAbilitySystemComponent& AbilitySystem) const
+{
+	GASCORE_TRACE_SCOPE(FGASCoreAbilitySystemSnapshot::Apply);
+
+	if (!AbilitySystem.IsOwnerActorAuthoritative())
+	{
+		GASCORE_LOG_WARNING(TEXT("Ability system snapshot not applied to %s: the owner is not authoritative."), *GetNameSafe(AbilitySystem.GetOwner()));
+		return false;
+	}
+
+	// Bases first: effects re-applied below then modify the restored values, as when they were saved. Clamped
+	// Currents wait for the effects that rebuild their Maxes (a derived Max may still be 0 before that).
+	ApplyAttributes(AbilitySystem, /*bCurrents=*/false);
+	ApplyAbilities(AbilitySystem);
+	ApplyEffects(AbilitySystem);
+	ApplyAttributes(AbilitySystem, /*bCurrents=*/true);
+	return true;
+}
+
+void FGASCoreAbilitySystemSnapshot::ApplyAttributes(UAbilitySystemComponent& AbilitySystem, const bool bCurrents) const
+{
+	TArray<const UAttributeSet*, TInlineAllocator<4>> Restored;
+	TArray<int32> Ordinals;
+	for (const FAttributeSetValues& Values : AttributeSets)
+	{
+		const FAttributeLayout& Layout = Layouts[Values.LayoutIndex];
+		const UClass* Class = ResolveClass(Layout.ClassIndex);
+		if (!Class)
+		{
+			continue;
+		}
+
+		// The first spawned set of that class not restored yet (several sets of one class restore in order).
+		UGASCoreAttributeSet* Set = nullptr;
+		for (UAttributeSet* Spawned : AbilitySystem.GetSpawnedAttributes())
+		{
+			if (Spawned && Spawned->GetClass() == Class && !Restored.Contains(Spawned))
+			{
+				Set = Cast<UGASCoreAttributeSet>(Spawned);
+				break;
+			}
+		}
+		if (!Set)
+		{
+			continue;
+		}
+		Restored.Add(Set);
+
+		// Saved slot → ordinal in this build, by attribute name.
+		const FGASCoreAttributeMetadata& Metadata = Set->GetAttributeMetadata();
+		Ordinals.Reset();
+		for (const int32 NameIndex : Layout.NameIndices)
+		{
+			const FName Name = Names[NameIndex];
+			Ordinals.Add(Metadata.Properties.IndexOfByPredicate([Name](const FStructProperty* Property) { return Property->GetFName() == Name; }));
+		}
+
+		for (int32 Slot = 0; Slot < Ordinals.Num(); ++Slot)
+		{
+			const int32 Ordinal = Ordinals[Slot];
+			if (Ordinal == INDEX_NONE || Metadata.MetaTargetOrdinals[Ordinal] != INDEX_NONE
+				|| (Metadata.MaxOrdinals[Ordinal] != INDEX_NONE) != bCurrents)
+			{
+				continue;
+			}
+
+			const float BaseValue = Values.BaseValues[Slot];
+			if (Set->GetAttributeDataAt(Ordinal).GetBaseValue() != BaseValue)
+			{
+				Set->SetCurrentNumeric(Metadata.Attributes[Ordinal], BaseValue);
+			}
+		}
+	}
+}
+
+void FGASCoreAbilitySystemSnapshot::ApplyAbilities(UAbilitySystemComponent& AbilitySystem) const
+{
+	UGASCoreAbilitySystemComponent* CoreAbilitySystem = Cast<UGASCoreAbilitySystemComponent>(&AbilitySystem);
+
+	// Grant directly (no ability list lock): under a lock GiveAbility only queues the spec, so a later
+	// FindAbilitySpecFromClass for the same class would miss it. Spec pointers are not kept across iterations.
+	for (const FAbility& Saved : Abilities)
+	{
+		const TSubclassOf<UGameplayAbility> Class = ResolveClass(Saved.ClassIndex);
+		if (!Class)
+		{
+			continue;
+		}
+
+		const FGameplayTagContainer Tags = ResolveTags(Saved.TagNameIndices);
+		FGameplayAbilitySpec* Spec = AbilitySystem.FindAbilitySpecFromClass(Class);
+		if (!Spec)
+		{
+			FGameplayAbilitySpec NewSpec(Class, Saved.Level);
+			NewSpec.GetDynamicSpecSourceTags().AppendTags(Tags);
+			AbilitySystem.GiveAbility(NewSpec);
+			continue;
+		}
+
+		if (Spec->Level != Saved.Level)
+		{
+			Spec->Level = Saved.Level;
+			AbilitySystem.MarkAbilitySpecDirty(*Spec);
+		}
+
+		const FGameplayTagContainer OldTags = Spec->GetDynamicSpecSourceTags();
+		if (OldTags == Tags)
+		{
+			continue;
+		}
+
+		if (CoreAbilitySystem)
+		{
+			// Through the remap so the input tag index follows.
+			const FGameplayAbilitySpecHandle Handle = Spec->Handle;
+			for (const FGameplayTag& OldTag : OldTags)
+			{
+				if (!Tags.HasTagExact(OldTag))
+				{
+					CoreAbilitySystem->RemapAbilityInputTag(Handle, OldTag, FGameplayTag());
+				}
+			}
+			for (const FGameplayTag& Tag : Tags)
+			{
+				if (!OldTags.HasTagExact(Tag))
+				{
+					CoreAbilitySystem->RemapAbilityInputTag(Handle, FGameplayTag(), Tag);
+				}
+			}
+		}
+		else
+		{
+			Spec->GetDynamicSpecSourceTags() = Tags;
+			AbilitySystem.MarkAbilitySpecDirty(*Spec);
+		}
+	}
+}
+
+void FGASCoreAbilitySystemSnapshot::ApplyEffects(UAbilitySystemComponent& AbilitySystem) const
+{
+	for (const FEffect& Saved : Effects)
+	{
+		const TSubclassOf<UGameplayEffect> Class = ResolveClass(Saved.ClassIndex);
+		if (!Class || AbilitySystem.GetGameplayEffectCount(Class, nullptr) > 0)
+		{
+			continue;
+		}
+
+		const FGameplayEffectSpecHandle SpecHandle = FGASCoreEffectSpecCache::MakeOutgoingSpec(&AbilitySystem, Class, Saved.Level,
+			AbilitySystem.MakeEffectContext());
+		FGameplayEffectSpec* Spec = SpecHandle.Data.Get();
+		if (!Spec)
+		{
+			continue;
+		}
+
+		for (const TPair<int32, float>& Pair : Saved.SetByCallerTags)
+		{
+			const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(Names[Pair.Key], /*ErrorIfNotFound=*/false);
+			if (Tag.IsValid())
+			{
+				Spec->SetSetByCallerMagnitude(Tag, Pair.Value);
+			}
+		}
+		for (const TPair<int32, float>& Pair : Saved.SetByCallerNames)
+		{
+			Spec->SetSetByCallerMagnitude(Names[Pair.Key], Pair.Value);
+		}
+
+		Spec->SetStackCount(Saved.StackCount);
+		if (Saved.TimeRemaining > 0.f)
+		{
+			Spec->SetDuration(Saved.TimeRemaining, /*bLockDuration=*/true);
+		}
+		AbilitySystem.ApplyGameplayEffectSpecToSelf(*Spec);
+	}
+}
+
+void FGASCoreAbilitySystemSnapshot::Save(TArray<uint8>& OutBytes) const
+{
+	OutBytes.Reset();
+	FMemoryWriter Writer(OutBytes);
+	const_cast<FGASCoreAbilitySystemSnapshot*>(this)->Serialize(Writer);
+}
+
+bool FGASCoreAbilitySystemSnapshot::Load(const TConstArrayView<uint8> Bytes)
+{
+	GASCORE_TRACE_SCOPE(FGASCoreAbilitySystemSnapshot::Load);
+
+	Reset();
+	FMemoryReaderView Reader(Bytes);
+	Serialize(Reader);
+	if (Reader.IsError() || !HasValidIndices())
+	{
+		GASCORE_LOG_WARNING(TEXT("Ability system snapshot rejected (%d bytes): bad header, truncated or corrupt."), Bytes.Num());
+		Reset();
+		return false;
+	}
+	return true;
+}
+
+void FGASCoreAbilitySystemSnapshot::Reset()
+{
+	Classes.Reset();
+	Names.Reset();
+	Layouts.Reset();
+	AttributeSets.Reset();
+	Abilities.Reset();
+	Effects.Reset();
+	ClassIndices.Reset();
+	NameIndices.Reset();
+}
+
+void FGASCoreAbilitySystemSnapshot::Serialize(FArchive& Ar)
+{
+	using namespace GASCoreAbilitySystemSnapshot;
+
+	uint32 FileMagic = Magic;
+	uint16 FileVersion = Version;
+	Ar << FileMagic << FileVersion;
+	if (Ar.IsLoading() && (FileMagic != Magic || FileVersion != Version))
+	{
+		Ar.SetError();
+		return;
+	}
+
+	// Tables as strings: paths and names stay valid across builds (FName indices do not).
+	SerializeArray(Ar, Classes, [&Ar](FTopLevelAssetPath& Path)
+	{
+		FString String = Path.ToString();
+		Ar << String;
+		if (Ar.IsLoading() && !Path.TrySetPath(String))
+		{
+			Ar.SetError();
+		}
+	});
+	SerializeArray(Ar, Names, [&Ar](FName& Name)
+	{
+		FString String = Name.ToString();
+		Ar << String;
+		Name = FName(*String);
+	});
+
+	SerializeArray(Ar, Layouts, [&Ar](FAttributeLayout& Layout)
+	{
+		SerializeIndex(Ar, Layout.ClassIndex);
+		SerializeArray(Ar, Layout.NameIndices, [&Ar](int32& NameIndex) { SerializeIndex(Ar, NameIndex); });
+	});
+	SerializeArray(Ar, AttributeSets, [&Ar](FAttributeSetValues& Values)
+	{
+		SerializeIndex(Ar, Values.LayoutIndex);
+		SerializeArray(Ar, Values.BaseValues, [&Ar](float& Value) { Ar << Value; });
+	});
+
+	SerializeArray(Ar, Abilities, [&Ar](FAbility& Ability)
+	{
+		SerializeIndex(Ar, Ability.ClassIndex);
+		SerializeIndex(Ar, Ability.Level);
+		SerializeArray(Ar, Ability.TagNameIndices, [&Ar](int32& NameIndex) { SerializeIndex(Ar, NameIndex); });
+	});
+
+	SerializeArray(Ar, Effects, [&Ar](FEffect& Effect)
+	{
+		SerializeIndex(Ar, Effect.ClassIndex);
+		Ar << Effect.Level;
+		SerializeIndex(Ar, Effect.StackCount);
+		Ar << Effect.TimeRemaining;
+		const auto SerializeMagnitude = [&Ar](TPair<int32, float>& Pair)
+		{
+			SerializeIndex(Ar, Pair.Key);
+			Ar << Pair.Value;
+		};
+		SerializeArray(Ar, Effect.SetByCallerTags, SerializeMagnitude);
+		SerializeArray(Ar, Effect.SetByCallerNames, SerializeMagnitude);
+	});
+}
+
+bool FGASCoreAbilitySystemSnapshot::HasValidIndices() const
+{
+	const auto ValidNames = [this](const TConstArrayView<int32> Indices)
+	{
+		return !Indices.ContainsByPredicate([this](const int32 Index) { return !Names.IsValidIndex(Index); });
+	};
+	const auto ValidMagnitudes = [this](const TConstArrayView<TPair<int32, float>> Magnitudes)
+	{
+		return !Magnitudes.ContainsByPredicate([this](const TPair<int32, float>& Pair) { return !Names.IsValidIndex(Pair.Key); });
+	};
+
+	for (const FAttributeLayout& Layout : Layouts)
+	{
+		if (!Classes.IsValidIndex(Layout.ClassIndex) || !ValidNames(Layout.NameIndices))
+		{
+			return false;
+		}
+	}
+	for (const FAttributeSetValues& Values : AttributeSets)
+	{
+		if (!Layouts.IsValidIndex(Values.LayoutIndex) || Values.BaseValues.Num() != Layouts[Values.LayoutIndex].NameIndices.Num())
+		{
+			return false;
+		}
+	}
+	for (const FAbility& Ability : Abilities)
+	{
+		if (!Classes.IsValidIndex(Ability.ClassIndex) || !ValidNames(Ability.TagNameIndices))
+		{
+			return false;
+		}
+	}
+	for (const FEffect& Effect : Effects)
+	{
+		if (!Classes.IsValidIndex(Effect.ClassIndex) || !ValidMagnitudes(Effect.SetByCallerTags) || !ValidMagnitudes(Effect.SetByCallerNames))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int32 FGASCoreAbilitySystemSnapshot::AddClass(const UClass* Class)
+{
+	if (const int32* Index = ClassIndices.Find(Class))
+	{
+		return *Index;
+	}
+	return ClassIndices.Add(Class, Classes.Add(Class->GetClassPathName()));
+}
+
+int32 FGASCoreAbilitySystemSnapshot::AddName(const FName Name)
+{
+	if (const int32* Index = NameIndices.Find(Name))
+	{
+		return *Index;
+	}
+	return NameIndices.Add(Name, Names.Add(Name));
+}
+
+UClass* FGASCoreAbilitySystemSnapshot::ResolveClass(const int32 ClassIndex) const
+{
+	const FTopLevelAssetPath& Path = Classes[ClassIndex];
+	TWeakObjectPtr<UClass>& Resolved = GASCoreAbilitySystemSnapshot::ResolvedClasses.FindOrAdd(Path);
+	if (!Resolved.IsValid())
+	{
+		// Blueprint classes of a save made in another session may not be loaded yet.
+		UClass* Class = FindObject<UClass>(Path);
+		Resolved = Class ? Class : LoadObject<UClass>(nullptr, *Path.ToString(), nullptr, LOAD_NoWarn);
+		if (!Resolved.IsValid())
+		{
+			GASCORE_LOG_WARNING(TEXT("Ability system snapshot: class %s no longer exists; its entries are skipped."), *Path.ToString());
+		}
+	}
+	return Resolved.Get();
+}
+
+FGameplayTagContainer FGASCoreAbilitySystemSnapshot::ResolveTags(const TConstArrayView<int32> TagNameIndices) const
+{
+	FGameplayTagContainer Tags;
+	for (const int32 NameIndex : TagNameIndices)
+	{
+		const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(Names[NameIndex], /*ErrorIfNotFound=*/false);
+		if (Tag.IsValid())
+		{
+			Tags.AddTag(Tag);
+		}
+	}
+	return Tags;
+}
@@ -0,0 +1,56 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Actors/GASCoreGameplayCueBurstActor.h"
+
+#include "AbilitySystemGlobals.h"
+#include "GameplayCueManager.h"
+#include "GASCoreStats.h"
+
+FGASCoreOnCueBurstExecuted AGASCoreGameplayCueBurstActor::OnCueBurstExecuted;
+
+AGASCoreGameplayCueBurstActor::AGASCoreGameplayCueBurstActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	SetReplicates(true);
+	SetReplicatingMovement(false);
+	SetNetUpdateFrequency(1.f);
+	bNetLoadOnClient = false;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+void AGASCoreGameplayCueBurstActor::MulticastExecuteCueBurst_Implementation(const TArray<FGASCoreBatchedCue>& Cues)
+{
+	if (GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+	ExecuteCues(this, Cues);
+}
+
+void AGASCoreGameplayCueBurstActor::ExecuteCues(AActor* Executor, const TConstArrayView<FGASCoreBatchedCue> Cues)
+{
+	GASCORE_TRACE_SCOPE(AGASCoreGameplayCueBurstActor::ExecuteCues);
+
+	UGameplayCueManager* CueManager = UAbilitySystemGlobals::Get().GetGameplayCueManager();
+	if (!CueManager || !Executor)
+	{
+		return;
+	}
+
+	for (const FGASCoreBatchedCue& Cue : Cues)
+	{
+		if (!Cue.CueTag.IsValid())
+		{
+			continue;
+		}
+
+		FGameplayCueParameters Parameters;
+		Parameters.Location = Cue.Location;
+		Parameters.Normal = Cue.Normal;
+		Parameters.RawMagnitude = Cue.Magnitude;
+		CueManager->HandleGameplayCue(Cue.Target ? Cue.Target.Get() : Executor, Cue.CueTag, EGameplayCueEvent::Executed, Parameters);
+	}
+
+	OnCueBurstExecuted.Broadcast(Executor->GetWorld(), Cues);
+}
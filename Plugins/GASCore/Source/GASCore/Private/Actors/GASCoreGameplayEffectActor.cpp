@@ -9,6 +9,10 @@
 //   we record the returned handle per target ASC (tracked via TWeakObjectPtr), enabling precise, GC-safe removal.
 // - Removal traverses tracked handles for the target ASC, matches by effect class, and removes stacks
 //   based on the stacks value recorded at application time (per-handle, not per-config at removal).
+// - TrackedHandlesByASC mirrors ActiveGameplayEffects per target, so an EndOverlap costs O(effects on that target)
+//   instead of a scan of every tracked handle. Effects that end on their own (expiry, removal by someone else) are
+//   untracked from the target ASC's OnAnyGameplayEffectRemovedDelegate; dead ASCs broadcast nothing and are
+//   purged by SweepTrackedEffects.
 //
 // Multiplayer authority:
 // - In networked games, prefer guarding OnOverlap/EndOverlap with HasAuthority() or perform server RPCs.
@@ -17,12 +21,77 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
+#include "AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
+#include "AbilitySystem/Effects/GASCoreEffectBatch.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Pawn.h"
 #include "GameplayEffect.h"
 #include "GameplayEffectTypes.h"
+#include "GASCoreStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Subsystems/GASCoreEffectActorPoolSubsystem.h"
+#include "Subsystems/GASCoreEffectActorRegistrySubsystem.h"
+#include "Subsystems/GASCorePickupSpawnerSubsystem.h"
+#include "Utilities/GASCoreLogging.h"
+
+static TAutoConsoleVariable<float> CVarGASCoreEffectActorSweepInterval(
+	TEXT("GASCore.EffectActor.TrackingSweepInterval"),
+	5.f,
+	TEXT("Seconds between purges of tracked effects whose target ASC was destroyed (ended effects leave at once)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGASCoreEffectActorMaxTrackedEffects(
+	TEXT("GASCore.EffectActor.MaxTrackedEffects"),
+	1024,
+	TEXT("Tracked effects per effect actor above which it sweeps immediately and warns (once) if still over. 0 = no cap."),
+	ECVF_Default);
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice GASCoreEffectActorDumpTrackingCommand(
+	TEXT("GASCore.EffectActor.DumpTracking"),
+	TEXT("Print the tracked effect and target counts of every effect actor in the world."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>&, UWorld* World, FOutputDevice& Ar)
+	{
+		int32 NumActors = 0;
+		int32 NumEffects = 0;
+		for (TActorIterator<AGASCoreGameplayEffectActor> It(World); It; ++It)
+		{
+			++NumActors;
+			NumEffects += It->GetNumTrackedEffects();
+			if (It->GetNumTrackedEffects() > 0)
+			{
+				Ar.Logf(TEXT("%-48s %6d effects %6d targets"), *It->GetName(), It->GetNumTrackedEffects(), It->GetNumTrackedTargets());
+			}
+		}
+		Ar.Logf(TEXT("%d effect actors, %d tracked effects."), NumActors, NumEffects);
+	}));
+#endif
+
+static TAutoConsoleVariable<float> CVarGASCorePredictedPickupMaxDistance(
+	TEXT("GASCore.PredictedPickup.MaxDistance"),
+	300.f,
+	TEXT("Server tolerance (cm, actor locations) for a client-predicted pickup that the server does not see overlapping yet."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCorePredictedPickupServerGrace(
+	TEXT("GASCore.PredictedPickup.ServerGrace"),
+	0.3f,
+	TEXT("Seconds the server waits after its own overlap of a remote player for the client's predicted pickup request ")
+	TEXT("before applying the pickup authoritatively (clients that do not predict). 0 applies at once."),
+	ECVF_Default);
 
 AGASCoreGameplayEffectActor::AGASCoreGameplayEffectActor()
 {
 	SetReplicates(true);
+
+	// Pickups rarely change: dormant from the start (no per-tick replication consider), woken only by
+	// FlushNetDormancy on state changes (pool activation/deactivation), and a low update rate when flushed.
+	NetDormancy = DORM_Initial;
+	SetNetUpdateFrequency(2.f);
+	SetMinNetUpdateFrequency(1.f);
 	// Provide a neutral root so designers can add collision/visuals in BP as needed.
 	DefaultSceneRoot = CreateDefaultSubobject<USceneComponent>(TEXT("DefaultRootComponent"));
 	SetRootComponent(DefaultSceneRoot);
@@ -31,13 +100,560 @@ AGASCoreGameplayEffectActor::AGASCoreGameplayEffectActor()
 void AGASCoreGameplayEffectActor::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
+	if (NetCullDistance > 0.f)
+	{
+		SetNetCullDistanceSquared(FMath::Square(NetCullDistance));
+	}
+
+	InitializeEffectTemplates();
+	StartZone();
+
+	if (UGASCoreEffectActorRegistrySubsystem* Registry = UGASCoreEffectActorRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterEffectActor(this);
+	}
+}
+
+void AGASCoreGameplayEffectActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ResetTracking();
+
+	if (UGASCoreEffectActorRegistrySubsystem* Registry = UGASCoreEffectActorRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterEffectActor(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AGASCoreGameplayEffectActor::OnRep_ReplicatedMovement()
+{
+	Super::OnRep_ReplicatedMovement();
+
+	// Clients: a pooled pickup reused elsewhere moved; re-file it.
+	if (UGASCoreEffectActorRegistrySubsystem* Registry = UGASCoreEffectActorRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterEffectActor(this);
+	}
+}
+
+FGameplayTagContainer AGASCoreGameplayEffectActor::GetEffectAssetTags() const
+{
+	FGameplayTagContainer Tags;
+	for (const FGASCoreEffectSpecTemplate& EffectTemplate : EffectTemplates)
+	{
+		if (const UGameplayEffect* Effect = EffectTemplate.GetEffect())
+		{
+			Tags.AppendTags(Effect->GetAssetTags());
+		}
+	}
+	return Tags;
+}
+
+#if WITH_EDITOR
+void AGASCoreGameplayEffectActor::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Policies/classes edited (also during PIE): re-bucket.
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(AGASCoreGameplayEffectActor, GameplayEffects))
+	{
+		InitializeEffectTemplates();
+	}
+}
+#endif
+
+void AGASCoreGameplayEffectActor::InitializeEffectTemplates()
+{
+	// Resolve every row's invariant spec data once (rows edited at runtime are re-resolved on use).
+	EffectTemplates.SetNum(GameplayEffects.Num());
+	ApplyOnOverlapRows.Reset();
+	ApplyOnEndOverlapRows.Reset();
+	RemoveOnOverlapRows.Reset();
+	RemoveOnEndOverlapRows.Reset();
+
+	for (int32 Index = 0; Index < GameplayEffects.Num(); ++Index)
+	{
+		const FGASCoreEffectConfig& EffectConfig = GameplayEffects[Index];
+		EffectTemplates[Index].Initialize(EffectConfig.EffectClass, EffectConfig.ActorLevel);
+		if (!EffectConfig.EffectClass)
+		{
+			continue;
+		}
+
+		switch (EffectConfig.ApplicationPolicy)
+		{
+		case EGASCoreEffectApplicationPolicy::ApplyOnOverlap:  ApplyOnOverlapRows.Add(Index); break;
+		case EGASCoreEffectApplicationPolicy::ApplyEndOverlap: ApplyOnEndOverlapRows.Add(Index); break;
+		default: break;
+		}
+		switch (EffectConfig.RemovalPolicy)
+		{
+		case EGASCoreEffectRemovalPolicy::RemoveOnOverlap:    RemoveOnOverlapRows.Add(Index); break;
+		case EGASCoreEffectRemovalPolicy::RemoveOnEndOverlap: RemoveOnEndOverlapRows.Add(Index); break;
+		default: break;
+		}
+	}
+}
+
+const TArray<int32>& AGASCoreGameplayEffectActor::GetApplicationRows(const EGASCoreEffectApplicationPolicy ApplicationPolicy)
+{
+	static const TArray<int32> NoRows;
+	if (EffectTemplates.Num() != GameplayEffects.Num())
+	{
+		InitializeEffectTemplates();
+	}
+	switch (ApplicationPolicy)
+	{
+	case EGASCoreEffectApplicationPolicy::ApplyOnOverlap:  return ApplyOnOverlapRows;
+	case EGASCoreEffectApplicationPolicy::ApplyEndOverlap: return ApplyOnEndOverlapRows;
+	default:                                               return NoRows;
+	}
+}
+
+const TArray<int32>& AGASCoreGameplayEffectActor::GetRemovalRows(const EGASCoreEffectRemovalPolicy RemovalPolicy)
+{
+	static const TArray<int32> NoRows;
+	if (EffectTemplates.Num() != GameplayEffects.Num())
+	{
+		InitializeEffectTemplates();
+	}
+	switch (RemovalPolicy)
+	{
+	case EGASCoreEffectRemovalPolicy::RemoveOnOverlap:    return RemoveOnOverlapRows;
+	case EGASCoreEffectRemovalPolicy::RemoveOnEndOverlap: return RemoveOnEndOverlapRows;
+	default:                                              return NoRows;
+	}
+}
+
+const FGASCoreEffectSpecTemplate& AGASCoreGameplayEffectActor::GetEffectTemplate(const int32 Index)
+{
+	if (!EffectTemplates.IsValidIndex(Index))
+	{
+		EffectTemplates.SetNum(GameplayEffects.Num());
+	}
+
+	FGASCoreEffectSpecTemplate& EffectTemplate = EffectTemplates[Index];
+	const FGASCoreEffectConfig& EffectConfig = GameplayEffects[Index];
+	if (!EffectTemplate.Matches(EffectConfig.EffectClass, EffectConfig.ActorLevel))
+	{
+		EffectTemplate.Initialize(EffectConfig.EffectClass, EffectConfig.ActorLevel);
+	}
+	return EffectTemplate;
+}
+
+void AGASCoreGameplayEffectActor::ActivateFromPool(const FTransform& Transform, const TArray<FGASCoreEffectConfig>* InGameplayEffects,
+	const float InActorLevel)
+{
+	bPoolOwned = true;
+	bInPool = false;
+
+	// Rows: the caller's, or the class defaults (a reused actor may carry a previous caller's rows).
+	GameplayEffects = InGameplayEffects ? *InGameplayEffects : GetClass()->GetDefaultObject<AGASCoreGameplayEffectActor>()->GameplayEffects;
+	if (InActorLevel > 0.f)
+	{
+		for (FGASCoreEffectConfig& EffectConfig : GameplayEffects)
+		{
+			EffectConfig.ActorLevel = InActorLevel;
+		}
+	}
+	InitializeEffectTemplates();
+
+	// Flush (stays dormant) before changing replicated state so clients receive the move + unhide once.
+	// Movement replication carries the new location of a reused actor (otherwise only sent on spawn).
+	FlushNetDormancy();
+	SetReplicatingMovement(true);
+	SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	StartZone();
+
+	if (UGASCoreEffectActorRegistrySubsystem* Registry = UGASCoreEffectActorRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterEffectActor(this);
+	}
+}
+
+void AGASCoreGameplayEffectActor::DeactivateToPool()
+{
+	bInPool = true;
+
+	// Applied effects stay on their targets (as when the actor was destroyed); only our tracking goes.
+	ResetTracking();
+	OverlapRefCounts.Reset();
+	ServedPickupASCs.Reset();
+	AcceptedPickupKeys.Reset();
+	StopZone();
+
+	if (UGASCoreEffectActorRegistrySubsystem* Registry = UGASCoreEffectActorRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterEffectActor(this);
+	}
+
+	FlushNetDormancy();
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+}
+
+void AGASCoreGameplayEffectActor::Consume()
+{
+	// Several consuming rows in one overlap consume once.
+	if (bInPool || IsActorBeingDestroyed())
+	{
+		return;
+	}
+
+	// Respawn a copy here later (pooled instance, same rows) through the shared scheduler.
+	if (RespawnDelay > 0.f && HasAuthority())
+	{
+		if (UGASCorePickupSpawnerSubsystem* Spawner = UGASCorePickupSpawnerSubsystem::Get(this))
+		{
+			Spawner->ScheduleRespawn(GetClass(), GetActorTransform(), RespawnDelay, &GameplayEffects);
+		}
+	}
+
+	if (bPoolOwned)
+	{
+		if (UGASCoreEffectActorPoolSubsystem* Pool = UGASCoreEffectActorPoolSubsystem::Get(this))
+		{
+			Pool->ReleaseEffectActor(this);
+			return;
+		}
+	}
+	Destroy();
+}
+
+void AGASCoreGameplayEffectActor::SetZoneTickInterval(const float InZoneTickInterval)
+{
+	ZoneTickInterval = FMath::Max(InZoneTickInterval, 0.05f);
+	if (GetWorldTimerManager().IsTimerActive(ZoneTimer))
+	{
+		GetWorldTimerManager().SetTimer(ZoneTimer, this, &AGASCoreGameplayEffectActor::TickZone, ZoneTickInterval, true);
+	}
+}
+
+void AGASCoreGameplayEffectActor::StartZone()
+{
+	if (!bZoneMode || !HasAuthority() || bInPool)
+	{
+		return;
+	}
+
+	// Random first delay: zones placed together do not all poll on the same frame.
+	GetWorldTimerManager().SetTimer(ZoneTimer, this, &AGASCoreGameplayEffectActor::TickZone, ZoneTickInterval, true,
+		FMath::FRandRange(0.f, ZoneTickInterval));
+}
+
+void AGASCoreGameplayEffectActor::StopZone()
+{
+	GetWorldTimerManager().ClearTimer(ZoneTimer);
+	ZoneOccupants.Reset();
+}
+
+void AGASCoreGameplayEffectActor::TickZone()
+{
+	GASCORE_TRACE_SCOPE(AGASCoreGameplayEffectActor::TickZone);
+
+	// The zone shape: first primitive that takes part in queries (what OnOverlap would be bound to).
+	UPrimitiveComponent* ZoneCollision = nullptr;
+	ForEachComponent<UPrimitiveComponent>(false, [&ZoneCollision](UPrimitiveComponent* Primitive)
+	{
+		if (!ZoneCollision && Primitive->IsQueryCollisionEnabled())
+		{
+			ZoneCollision = Primitive;
+		}
+	});
+	if (!ZoneCollision)
+	{
+		return;
+	}
+
+	// 1) One overlap query with the component's own shape and responses.
+	TArray<FOverlapResult> Overlaps;
+	FComponentQueryParams QueryParams(SCENE_QUERY_STAT(GASCoreEffectZone), this);
+	ZoneCollision->ComponentOverlapMulti(Overlaps, GetWorld(), ZoneCollision->GetComponentLocation(), ZoneCollision->GetComponentQuat(),
+		ZoneCollision->GetCollisionObjectType(), QueryParams);
+
+	TSet<TWeakObjectPtr<AActor>> Occupants;
+	Occupants.Reserve(Overlaps.Num());
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		AActor* Actor = Overlap.GetActor();
+		if (Actor && Actor != this && UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Actor))
+		{
+			Occupants.Add(Actor);
+		}
+	}
+
+	// 2) Diff against the previous poll. Destroyed leavers are skipped (their effects went with their ASC).
+	TArray<AActor*, TInlineAllocator<16>> Entered;
+	TArray<AActor*, TInlineAllocator<16>> Left;
+	for (const TWeakObjectPtr<AActor>& Occupant : Occupants)
+	{
+		if (!ZoneOccupants.Contains(Occupant))
+		{
+			Entered.Add(Occupant.Get());
+		}
+	}
+	for (const TWeakObjectPtr<AActor>& Occupant : ZoneOccupants)
+	{
+		AActor* Actor = Occupant.Get();
+		if (Actor && !Occupants.Contains(Occupant))
+		{
+			Left.Add(Actor);
+		}
+	}
+	ZoneOccupants = MoveTemp(Occupants);
+
+	// 3) Bulk apply/remove, in the same order OnOverlap/EndOverlap use.
+	if (!Entered.IsEmpty())
+	{
+		ApplyZoneEffects(Entered, EGASCoreEffectApplicationPolicy::ApplyOnOverlap);
+		for (AActor* Actor : Entered)
+		{
+			RemoveAllGameplayEffects(Actor, EGASCoreEffectRemovalPolicy::RemoveOnOverlap);
+		}
+	}
+	if (!Left.IsEmpty() && !bInPool)
+	{
+		ApplyZoneEffects(Left, EGASCoreEffectApplicationPolicy::ApplyEndOverlap);
+		for (AActor* Actor : Left)
+		{
+			RemoveAllGameplayEffects(Actor, EGASCoreEffectRemovalPolicy::RemoveOnEndOverlap);
+		}
+	}
+}
+
+void AGASCoreGameplayEffectActor::ApplyZoneEffects(const TArrayView<AActor* const> Targets, const EGASCoreEffectApplicationPolicy ApplicationPolicy)
+{
+	GASCORE_TRACE_SCOPE(AGASCoreGameplayEffectActor::ApplyZoneEffects);
+	bool bConsume = false;
+	TArray<FActiveGameplayEffectHandle> Handles;
+	const TArray<int32, TInlineAllocator<8>> Rows(GetApplicationRows(ApplicationPolicy));
+	for (const int32 Index : Rows)
+	{
+		const FGASCoreEffectConfig& EffectConfig = GameplayEffects[Index];
+
+		Handles.Reset();
+		const int32 NumApplied = FGASCoreEffectBatch::ApplyEffectToTargets(this, EffectConfig.EffectClass, EffectConfig.ActorLevel, Targets, &Handles);
+		bConsume |= NumApplied > 0 && EffectConfig.bDestroyOnEffectApplication;
+
+		// Track removable non-instant handles exactly like single applications (the handle knows its ASC).
+		if (EffectConfig.RemovalPolicy != EGASCoreEffectRemovalPolicy::DoNotRemove && GetEffectTemplate(Index).IsNonInstant())
+		{
+			for (const FActiveGameplayEffectHandle& Handle : Handles)
+			{
+				if (!Handle.IsValid())
+				{
+					continue;
+				}
+
+				FGASCoreTrackedEffect Track;
+				Track.ASC = Handle.GetOwningAbilitySystemComponent();
+				Track.EffectClass = EffectConfig.EffectClass;
+				Track.bDestroyOnRemoval = EffectConfig.bDestroyOnEffectRemoval;
+				Track.StacksToRemove = (EffectConfig.StacksToRemove <= 0) ? -1 : EffectConfig.StacksToRemove;
+				if (Track.ASC.IsValid())
+				{
+					TrackEffect(Handle, Track);
+				}
+			}
+		}
+	}
+
+	// Consumable zones go away once after the whole bulk application (not per target).
+	if (bConsume)
+	{
+		Consume();
+	}
+}
+
+bool AGASCoreGameplayEffectActor::HandlePredictedPickupOverlap(AActor* TargetActor)
+{
+	const APawn* Pawn = Cast<APawn>(TargetActor);
+
+	// Clients: only our own pawn picks up (predicted); overlaps of other pawns are the server's business.
+	if (!HasAuthority())
+	{
+		UGASCoreAbilitySystemComponent* ASC = Cast<UGASCoreAbilitySystemComponent>(UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor));
+		if (Pawn && Pawn->IsLocallyControlled() && ASC)
+		{
+			PredictPickup(ASC);
+		}
+		return true;
+	}
+
+	// Server: the host, AI and other actors pick up directly; remote players get a grace period for their request.
+	if (!Pawn || !Pawn->IsPlayerControlled() || Pawn->IsLocallyControlled())
+	{
+		return false;
+	}
+
+	const float Grace = CVarGASCorePredictedPickupServerGrace.GetValueOnGameThread();
+	if (Grace <= 0.f)
+	{
+		HandleServerPickupGraceExpired(TargetActor);
+		return true;
+	}
+	FTimerHandle GraceTimer;
+	GetWorldTimerManager().SetTimer(GraceTimer, FTimerDelegate::CreateUObject(this,
+		&AGASCoreGameplayEffectActor::HandleServerPickupGraceExpired, TWeakObjectPtr<AActor>(TargetActor)), Grace, false);
+	return true;
+}
+
+void AGASCoreGameplayEffectActor::HandleServerPickupGraceExpired(const TWeakObjectPtr<AActor> TargetActor)
+{
+	// Left again (or served by its request meanwhile): nothing to do.
+	AActor* Target = TargetActor.Get();
+	if (!Target || bInPool || IsActorBeingDestroyed() || !IsOverlappingActor(Target) || !ClaimPickupFor(Target, 0))
+	{
+		return;
+	}
+
+	ApplyAllGameplayEffects(Target, EGASCoreEffectApplicationPolicy::ApplyOnOverlap);
+	RemoveAllGameplayEffects(Target, EGASCoreEffectRemovalPolicy::RemoveOnOverlap);
+}
+
+UAbilitySystemComponent* AGASCoreGameplayEffectActor::ClaimPickupFor(AActor* TargetActor, const FPredictionKey::KeyType PredictionKey)
+{
+	UAbilitySystemComponent* ASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor);
+	if (!ASC || ServedPickupASCs.Contains(ASC))
+	{
+		return nullptr;
+	}
+	ServedPickupASCs.Add(ASC, PredictionKey);
+	return ASC;
+}
+
+void AGASCoreGameplayEffectActor::PredictPickup(UGASCoreAbilitySystemComponent* ASC)
+{
+	if (bPredictedPickupPending || IsHidden())
+	{
+		return;
+	}
+
+	FScopedPredictionWindow PredictionWindow(ASC, true);
+	const FPredictionKey PredictionKey = ASC->ScopedPredictionKey;
+	if (!PredictionKey.IsLocalClientKey())
+	{
+		return;
+	}
+
+	// Predict the Instant rows only (what the player feels at once); duration rows arrive from the server.
+	bool bConsumable = false;
+	const TArray<int32, TInlineAllocator<8>> Rows(GetApplicationRows(EGASCoreEffectApplicationPolicy::ApplyOnOverlap));
+	for (const int32 Index : Rows)
+	{
+		const FGASCoreEffectSpecTemplate& EffectTemplate = GetEffectTemplate(Index);
+		bConsumable |= GameplayEffects[Index].bDestroyOnEffectApplication;
+		if (!EffectTemplate.IsNonInstant())
+		{
+			EffectTemplate.ApplyToSelf(ASC, MakePickupEffectContext(ASC), PredictionKey);
+		}
+	}
+
+	// Local hide only; the server's confirmed hide replicates with the dormancy flush.
+	if (bConsumable)
+	{
+		SetActorHiddenInGame(true);
+		bHiddenByPrediction = true;
+	}
+
+	bPredictedPickupPending = true;
+	PredictionKey.NewCaughtUpDelegate().BindUObject(this, &AGASCoreGameplayEffectActor::HandlePredictedPickupCaughtUp);
+	ASC->ServerPredictedPickup(this, PredictionKey);
+}
+
+void AGASCoreGameplayEffectActor::HandlePredictedPickupCaughtUp()
+{
+	bPredictedPickupPending = false;
+}
+
+bool AGASCoreGameplayEffectActor::ConfirmPredictedPickup(UGASCoreAbilitySystemComponent* ASC, const FPredictionKey& PredictionKey)
+{
+	AActor* Avatar = ASC ? ASC->GetAvatarActor() : nullptr;
+	if (!bPredictedPickup || bInPool || bZoneMode || !HasAuthority() || IsActorBeingDestroyed() || !Avatar
+		|| !PredictionKey.IsValidKey())
+	{
+		return false;
+	}
+
+	// A key confirms one pickup; a replayed or repeated request is refused.
+	const FPredictionKey::KeyType* AcceptedKey = AcceptedPickupKeys.Find(ASC);
+	if (AcceptedKey && *AcceptedKey == PredictionKey.Current)
+	{
+		return false;
+	}
+
+	// Served by the server's own overlap after the grace period: acknowledge once (the key drops the predicted copy).
+	if (FPredictionKey::KeyType* ServedKey = ServedPickupASCs.Find(ASC))
+	{
+		if (*ServedKey != 0)
+		{
+			return false;
+		}
+		*ServedKey = PredictionKey.Current;
+		AcceptedPickupKeys.Add(ASC, PredictionKey.Current);
+		return true;
+	}
+
+	// The server sees the avatar slightly behind the client: accept an overlap or a small distance.
+	const float MaxDistance = CVarGASCorePredictedPickupMaxDistance.GetValueOnGameThread();
+	if (!IsOverlappingActor(Avatar) && FVector::DistSquared(Avatar->GetActorLocation(), GetActorLocation()) > FMath::Square(MaxDistance))
+	{
+		return false;
+	}
+
+	// Recorded before applying: callbacks of the applied effects cannot get a second application through.
+	ClaimPickupFor(Avatar, PredictionKey.Current);
+	AcceptedPickupKeys.Add(ASC, PredictionKey.Current);
+
+	// Same as a server overlap; Instant rows pick up the client's key from the ASC's scoped prediction window.
+	ApplyAllGameplayEffects(Avatar, EGASCoreEffectApplicationPolicy::ApplyOnOverlap);
+	RemoveAllGameplayEffects(Avatar, EGASCoreEffectRemovalPolicy::RemoveOnOverlap);
+	return true;
+}
+
+void AGASCoreGameplayEffectActor::RollbackPredictedPickup()
+{
+	// Predicted effects are removed by GAS when the key catches up; only the local hide is ours to undo.
+	if (bHiddenByPrediction)
+	{
+		bHiddenByPrediction = false;
+		SetActorHiddenInGame(false);
+	}
+}
+
+FGameplayEffectContextHandle AGASCoreGameplayEffectActor::MakePickupEffectContext(UAbilitySystemComponent* TargetASC) const
+{
+	FGameplayEffectContextHandle EffectContextHandle = TargetASC->MakeEffectContext();
+	EffectContextHandle.AddSourceObject(this);
+	if (EffectContextHandle.Get())
+	{
+		EffectContextHandle.Get()->SetEffectCauser(const_cast<AGASCoreGameplayEffectActor*>(this));
+	}
+	return EffectContextHandle;
 }
 
 void AGASCoreGameplayEffectActor::OnOverlap(AActor* TargetActor)
 {
-	// Early-out for safety: we need a target actor to proceed.
-	if (!TargetActor) return;
+	GASCORE_TRACE_SCOPE(AGASCoreGameplayEffectActor::OnOverlap);
+	// Early-out for safety: we need a target actor to proceed (zones drive themselves, see TickZone).
+	if (!TargetActor || bInPool || bZoneMode) return;
+
+	// One application per target across components: only the first component overlap gets through.
+	// A count above the components really overlapping TargetActor missed its end-overlaps; start over.
+	int32& RefCount = OverlapRefCounts.FindOrAdd(TargetActor);
+	if (RefCount >= CountOverlappingComponents(TargetActor))
+	{
+		RefCount = 0;
+	}
+	if (RefCount++ > 0) return;
+
+	// Predicted pickups route player overlaps through the prediction path.
+	if (bPredictedPickup && HandlePredictedPickupOverlap(TargetActor)) return;
 
 	// OVERLAP LIFECYCLE MAPPING:
 	// On overlap entry, we apply effects configured for ApplyOnOverlap and remove effects configured for RemoveOnOverlap.
@@ -58,8 +674,22 @@ void AGASCoreGameplayEffectActor::OnOverlap(AActor* TargetActor)
 
 void AGASCoreGameplayEffectActor::EndOverlap(AActor* TargetActor)
 {
+	GASCORE_TRACE_SCOPE(AGASCoreGameplayEffectActor::EndOverlap);
 	// Early-out for safety.
-	if (!TargetActor) return;
+	if (!TargetActor || bInPool || bZoneMode) return;
+
+	// Only the last component end-overlap gets through (the engine removed this overlap before the event).
+	if (int32* RefCount = OverlapRefCounts.Find(TargetActor))
+	{
+		if (--(*RefCount) > 0 && IsOverlappingActor(TargetActor)) return;
+		OverlapRefCounts.Remove(TargetActor);
+	}
+
+	// The stay ends: the next one may be served again.
+	if (bPredictedPickup && HasAuthority())
+	{
+		ServedPickupASCs.Remove(UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor));
+	}
 
 	// OVERLAP LIFECYCLE MAPPING:
 	// On overlap exit, we apply effects configured for ApplyEndOverlap and remove effects configured for RemoveOnEndOverlap.
@@ -72,35 +702,63 @@ void AGASCoreGameplayEffectActor::EndOverlap(AActor* TargetActor)
 	RemoveAllGameplayEffects(TargetActor, EGASCoreEffectRemovalPolicy::RemoveOnEndOverlap);
 }
 
+SIZE_T AGASCoreGameplayEffectActor::GetTrackingAllocatedSize() const
+{
+	SIZE_T Bytes = ActiveGameplayEffects.GetAllocatedSize() + TrackedHandlesByASC.GetAllocatedSize()
+		+ EffectRemovedDelegates.GetAllocatedSize() + EffectTemplates.GetAllocatedSize()
+		+ ApplyOnOverlapRows.GetAllocatedSize() + ApplyOnEndOverlapRows.GetAllocatedSize()
+		+ RemoveOnOverlapRows.GetAllocatedSize() + RemoveOnEndOverlapRows.GetAllocatedSize()
+		+ OverlapRefCounts.GetAllocatedSize() + ZoneOccupants.GetAllocatedSize()
+		+ ServedPickupASCs.GetAllocatedSize() + AcceptedPickupKeys.GetAllocatedSize();
+	for (const TPair<TWeakObjectPtr<UAbilitySystemComponent>, TArray<FActiveGameplayEffectHandle>>& Pair : TrackedHandlesByASC)
+	{
+		Bytes += Pair.Value.GetAllocatedSize();
+	}
+	return Bytes;
+}
+
+int32 AGASCoreGameplayEffectActor::CountOverlappingComponents(const AActor* TargetActor) const
+{
+	int32 Count = 0;
+	ForEachComponent<UPrimitiveComponent>(false, [TargetActor, &Count](const UPrimitiveComponent* Primitive)
+	{
+		Count += Primitive->IsOverlappingActor(TargetActor) ? 1 : 0;
+	});
+	return Count;
+}
+
 void AGASCoreGameplayEffectActor::ApplyAllGameplayEffects(AActor* TargetActor, EGASCoreEffectApplicationPolicy ApplicationPolicy)
 {
-	// Iterate all rows and apply only those matching this timing.
+	// Walk only the rows bucketed for this timing (copied: a consumed actor can be reactivated by a callback).
 	// Note: If multiple rows set bDestroyOnEffectApplication, calling Destroy() inside ApplyGameplayEffectToTarget
 	// will end processing early. If you need "apply all then destroy", aggregate a flag and Destroy() once after this loop.
-	for (const FGASCoreEffectConfig& EffectConfig : GameplayEffects)
+	const TArray<int32, TInlineAllocator<8>> Rows(GetApplicationRows(ApplicationPolicy));
+	for (const int32 Index : Rows)
 	{
-		if (EffectConfig.EffectClass && EffectConfig.ApplicationPolicy == ApplicationPolicy)
-		{
-			ApplyGameplayEffectToTarget(TargetActor, EffectConfig);
-		}
+		// Consumed into the pool by an earlier row: it is inactive now.
+		if (bInPool) break;
+
+		ApplyGameplayEffectToTarget(TargetActor, GameplayEffects[Index], GetEffectTemplate(Index));
 	}
 }
 
 void AGASCoreGameplayEffectActor::RemoveAllGameplayEffects(AActor* TargetActor, EGASCoreEffectRemovalPolicy RemovalPolicy)
 {
-	// Iterate all rows and remove only those matching this timing.
+	// Walk only the rows bucketed for this timing.
 	// Removal is per-handle and GC-safe (tracked ASC is weak).
-	for (const FGASCoreEffectConfig& EffectConfig : GameplayEffects)
+	const TArray<int32, TInlineAllocator<8>> Rows(GetRemovalRows(RemovalPolicy));
+	for (const int32 Index : Rows)
 	{
-		if (EffectConfig.EffectClass && EffectConfig.RemovalPolicy == RemovalPolicy)
-		{
-			RemoveGameplayEffectFromTarget(TargetActor, EffectConfig);
-		}
+		if (bInPool) break;
+
+		RemoveGameplayEffectFromTarget(TargetActor, GameplayEffects[Index]);
 	}
 }
 
-void AGASCoreGameplayEffectActor::ApplyGameplayEffectToTarget(AActor* TargetActor, const FGASCoreEffectConfig& EffectConfig)
+void AGASCoreGameplayEffectActor::ApplyGameplayEffectToTarget(AActor* TargetActor, const FGASCoreEffectConfig& EffectConfig,
+	const FGASCoreEffectSpecTemplate& EffectTemplate)
 {
+	GASCORE_TRACE_SCOPE(AGASCoreGameplayEffectActor::ApplyGameplayEffectToTarget);
 	// 1) Resolve the target ASC (supports IAbilitySystemInterface or direct component search).
 	UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor);
 	if (!TargetASC) return;
@@ -108,39 +766,38 @@ void AGASCoreGameplayEffectActor::ApplyGameplayEffectToTarget(AActor* TargetActo
 	// 2) Sanity-check the effect class (should be set in config).
 	checkf(EffectConfig.EffectClass, TEXT("EffectClass is unset on %s"), *GetName());
 
-	// 3) Build an effect context originating from this actor, using the target ASC as the creator.
-	//    WHY WE BUILD CONTEXT:
-	//    - AddSourceObject(this): Allows consumers (AttributeSet callbacks, gameplay cues) to trace back to this effect actor
-	//    - SetEffectCauser(this): Marks this actor as the causer for damage attribution, gameplay logs, and analytics
-	//    - Context travels with the effect and is accessible in PostGameplayEffectExecute and other callbacks
-	FGameplayEffectContextHandle EffectContextHandle = TargetASC->MakeEffectContext();
-	EffectContextHandle.AddSourceObject(this);
-	if (EffectContextHandle.Get())
+	// 3) Stack-aware early-out: the target already holds the full stack of an effect whose re-application
+	//    refreshes nothing, so GAS would discard the spec (overlap-spam pickups/auras). Skip context + spec.
+	//    Consumables still go away, as they did when GAS discarded the spec.
+	if (EffectTemplate.WouldBeDiscarded(TargetASC, TargetASC))
 	{
-		EffectContextHandle.Get()->SetEffectCauser(this);
-	}
-
-	// 4) Build a spec for this effect at the configured level, with the context provided.
-	//    The spec contains all necessary data to apply the effect: magnitudes, duration, tags, etc.
-	const FGameplayEffectSpecHandle GameplayEffectSpecHandle =
-		TargetASC->MakeOutgoingSpec(EffectConfig.EffectClass, EffectConfig.ActorLevel, EffectContextHandle);
-	if (!GameplayEffectSpecHandle.IsValid() || !GameplayEffectSpecHandle.Data.IsValid())
-	{
-		// Spec creation can fail if class is invalid or gameplay tags/requirements block it.
+		if (EffectConfig.bDestroyOnEffectApplication)
+		{
+			Consume();
+		}
 		return;
 	}
 
+	// 4) Build an effect context originating from this actor, using the target ASC as the creator.
+	//    WHY WE BUILD CONTEXT:
+	//    - AddSourceObject(this): Allows consumers (AttributeSet callbacks, gameplay cues) to trace back to this effect actor
+	//    - SetEffectCauser(this): Marks this actor as the causer for damage attribution, gameplay logs, and analytics
+	//    - Context travels with the effect and is accessible in PostGameplayEffectExecute and other callbacks
+	const FGameplayEffectContextHandle EffectContextHandle = MakePickupEffectContext(TargetASC);
 
-	// 5) Apply to the target ASC (apply-to-self on that ASC).
+	// 5) Build the spec from the row's template and apply it to the target ASC (apply-to-self on that ASC).
+	//    The template resolved the CDO/duration policy once; static effects clone a shared (class, level)
+	//    prototype on the stack and only patch the context (FGASCoreEffectSpecTemplate).
 	//    Handle validity:
 	//    - Instant: usually invalid (effect executes immediately and ends)
 	//    - Duration/Infinite: valid, can be removed/stacked/queried
-	const FActiveGameplayEffectHandle ActiveEffectHandle =
-		TargetASC->ApplyGameplayEffectSpecToSelf(*GameplayEffectSpecHandle.Data.Get());
+	//    Inside a predicted pickup's window, Instant rows carry the client's key (GAS reconciles its prediction).
+	const FPredictionKey PredictionKey = EffectTemplate.IsNonInstant() ? FPredictionKey() : TargetASC->ScopedPredictionKey;
+	const FActiveGameplayEffectHandle ActiveEffectHandle = EffectTemplate.ApplyToSelf(TargetASC, EffectContextHandle, PredictionKey);
 
 	// 6) Track non-instant effects if a removal policy is configured.
 	// Periodic effects are either HasDuration or Infinite; both count as non-instant.
-	if (ActiveEffectHandle.IsValid() && EffectConfig.RemovalPolicy != EGASCoreEffectRemovalPolicy::DoNotRemove && IsNonInstant(EffectConfig.EffectClass))
+	if (ActiveEffectHandle.IsValid() && EffectConfig.RemovalPolicy != EGASCoreEffectRemovalPolicy::DoNotRemove && EffectTemplate.IsNonInstant())
 	{
 		FGASCoreTrackedEffect Track;
 		Track.ASC = TargetASC;
@@ -151,8 +808,8 @@ void AGASCoreGameplayEffectActor::ApplyGameplayEffectToTarget(AActor* TargetActo
 		Track.StacksToRemove = (EffectConfig.StacksToRemove <= 0) ? -1 : EffectConfig.StacksToRemove;
 
 		// If re-application merges into the same active effect per stacking rules,
-		// GAS may return the same handle; TMap::Add will update the value for that key.
-		ActiveGameplayEffects.Add(ActiveEffectHandle, Track);
+		// GAS may return the same handle; the entry is updated, not duplicated.
+		TrackEffect(ActiveEffectHandle, Track);
 	}
 
 	// 7) Optional: destroy the actor immediately after a successful application (consumables).
@@ -161,38 +818,31 @@ void AGASCoreGameplayEffectActor::ApplyGameplayEffectToTarget(AActor* TargetActo
 	// remove Destroy() here and instead aggregate a flag in ApplyAllGameplayEffects.
 	if (EffectConfig.bDestroyOnEffectApplication)
 	{
-		Destroy();
+		Consume();
 	}
 }
 
 void AGASCoreGameplayEffectActor::RemoveGameplayEffectFromTarget(AActor* TargetActor, const FGASCoreEffectConfig& EffectConfig)
 {
+	GASCORE_TRACE_SCOPE(AGASCoreGameplayEffectActor::RemoveGameplayEffectFromTarget);
 	// 1) Resolve the target ASC.
 	UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor);
 	if (!TargetASC) return;
 
-	// 2) Collect matching handles:
-	//    - Tracked handle’s ASC is valid AND equals this TargetASC
+	// 2) Collect matching handles from this target's index entry:
 	//    - Tracked handle’s GE class matches the Config’s EffectClass
 	// We do not inspect current active spec Defs here; we use our own tracking to ensure we remove
 	// only things this actor applied.
-	TArray<FActiveGameplayEffectHandle> HandlesForThisASC;
-	HandlesForThisASC.Reserve(ActiveGameplayEffects.Num());
-	
-	for (TPair<FActiveGameplayEffectHandle, FGASCoreTrackedEffect>& TrackedPair : ActiveGameplayEffects)
-	{
-		const FGASCoreTrackedEffect& TrackedEffect = TrackedPair.Value;
-		
-		// Skip if the weak ASC is no longer valid (its owner was GC’d or destroyed)
-		if (!TrackedEffect.ASC.IsValid())
-		{
-			continue;
-		}
+	TArray<FActiveGameplayEffectHandle>* TrackedHandles = TrackedHandlesByASC.Find(TargetASC);
+	if (!TrackedHandles) return;
 
-		// Compare against the current TargetASC (raw pointer) using the weak's Get()
-		if (TrackedEffect.ASC.Get() == TargetASC && TrackedEffect.EffectClass == EffectConfig.EffectClass)
+	TArray<FActiveGameplayEffectHandle, TInlineAllocator<4>> HandlesForThisASC;
+	for (const FActiveGameplayEffectHandle& Handle : *TrackedHandles)
+	{
+		const FGASCoreTrackedEffect* TrackedEffect = ActiveGameplayEffects.Find(Handle);
+		if (TrackedEffect && TrackedEffect->EffectClass == EffectConfig.EffectClass)
 		{
-			HandlesForThisASC.Add(TrackedPair.Key);
+			HandlesForThisASC.Add(Handle);
 		}
 	}
 
@@ -202,43 +852,161 @@ void AGASCoreGameplayEffectActor::RemoveGameplayEffectFromTarget(AActor* TargetA
 
 	for (const FActiveGameplayEffectHandle& EffectHandle : HandlesForThisASC)
 	{
-		const FGASCoreTrackedEffect* TrackedEffect = ActiveGameplayEffects.Find(EffectHandle);
-		if (!TrackedEffect) continue;
-
-		// Defensive: ASC could have become invalid between collection and removal
-		if (!TrackedEffect->ASC.IsValid()) continue;
+		// Copy: removal callbacks may re-enter this actor and change the map.
+		const FGASCoreTrackedEffect* Found = ActiveGameplayEffects.Find(EffectHandle);
+		if (!Found) continue;
+		const FGASCoreTrackedEffect TrackedEffect = *Found;
 
 		// Attempt removal; returns number of stacks removed (0 if nothing happened).
 		// -1 means “remove all stacks” for the matched handle.
-		const int32 RemovedCount = TargetASC->RemoveActiveGameplayEffect(EffectHandle, TrackedEffect->StacksToRemove);
+		const int32 RemovedCount = TargetASC->RemoveActiveGameplayEffect(EffectHandle, TrackedEffect.StacksToRemove);
 		bRemovedAnyStacks |= (RemovedCount != 0);
 
 		// If this particular handle asked for actor destruction on removal, remember it.
-		if (RemovedCount != 0 && TrackedEffect->bDestroyOnRemoval)
+		if (RemovedCount != 0 && TrackedEffect.bDestroyOnRemoval)
 		{
 			bDestroyAfterRemoval = true;
 		}
 	}
 
-	// 4) Cleanup: erase entries that no longer exist on the ASC OR whose weak ASC is invalid.
+	// 4) Cleanup: fully removed handles were untracked by HandleTrackedEffectRemoved during removal; this catches
+	//    the rest (partial stack removal keeps the handle and its entry).
 	for (const FActiveGameplayEffectHandle& Handle : HandlesForThisASC)
 	{
-		const FGASCoreTrackedEffect* TrackedEffect = ActiveGameplayEffects.Find(Handle);
-
-		// If ASC invalid, or the handle no longer exists on the ASC, purge it
-		const bool bASCInvalid = !TrackedEffect || !TrackedEffect->ASC.IsValid();
-		const bool bHandleGone = !bASCInvalid && !TargetASC->GetActiveGameplayEffect(Handle);
-		
-		if (bASCInvalid || bHandleGone)
+		if (!TargetASC->GetActiveGameplayEffect(Handle))
 		{
-			ActiveGameplayEffects.Remove(Handle);
+			UntrackEffect(Handle);
 		}
 	}
 
 	// 5) Optional: destroy the actor if any handle requested destruction on removal.
 	if (bRemovedAnyStacks && bDestroyAfterRemoval)
 	{
-		Destroy();
+		Consume();
+	}
+}
+
+void AGASCoreGameplayEffectActor::TrackEffect(const FActiveGameplayEffectHandle& Handle, const FGASCoreTrackedEffect& Track)
+{
+	if (!ActiveGameplayEffects.Contains(Handle))
+	{
+		// First handle on this target: follow its removals so ended effects leave the maps at once.
+		TArray<FActiveGameplayEffectHandle>& Handles = TrackedHandlesByASC.FindOrAdd(Track.ASC);
+		if (Handles.IsEmpty())
+		{
+			INC_DWORD_STAT(STAT_GASCore_TrackedTargets);
+			if (UAbilitySystemComponent* ASC = Track.ASC.Get())
+			{
+				EffectRemovedDelegates.Add(Track.ASC,
+					ASC->OnAnyGameplayEffectRemovedDelegate().AddUObject(this, &AGASCoreGameplayEffectActor::HandleTrackedEffectRemoved));
+			}
+		}
+		Handles.Add(Handle);
+		INC_DWORD_STAT(STAT_GASCore_TrackedEffects);
+	}
+	ActiveGameplayEffects.Add(Handle, Track);
+
+	// Memory cap: only live effects are tracked, so an actor over the cap really holds that many; purge dead
+	// targets early and tell someone.
+	const int32 MaxTracked = CVarGASCoreEffectActorMaxTrackedEffects.GetValueOnGameThread();
+	if (MaxTracked > 0 && ActiveGameplayEffects.Num() > MaxTracked)
+	{
+		SweepTrackedEffects();
+		if (ActiveGameplayEffects.Num() > MaxTracked && !bTrackingCapWarned)
+		{
+			bTrackingCapWarned = true;
+			GASCORE_LOG_WARNING(TEXT("%s tracks %d effects (GASCore.EffectActor.MaxTrackedEffects = %d)."),
+				*GetName(), ActiveGameplayEffects.Num(), MaxTracked);
+		}
+	}
+
+	const float SweepInterval = CVarGASCoreEffectActorSweepInterval.GetValueOnGameThread();
+	if (SweepInterval > 0.f && !GetWorldTimerManager().IsTimerActive(TrackingSweepTimer))
+	{
+		GetWorldTimerManager().SetTimer(TrackingSweepTimer, this, &AGASCoreGameplayEffectActor::SweepTrackedEffects, SweepInterval, true);
+	}
+}
+
+void AGASCoreGameplayEffectActor::UntrackEffect(const FActiveGameplayEffectHandle& Handle)
+{
+	FGASCoreTrackedEffect Removed;
+	if (!ActiveGameplayEffects.RemoveAndCopyValue(Handle, Removed))
+	{
+		return;
+	}
+	DEC_DWORD_STAT(STAT_GASCore_TrackedEffects);
+
+	// Weak keys still hash/compare after their ASC died, so a dead target's entry is found too.
+	TArray<FActiveGameplayEffectHandle>* Handles = TrackedHandlesByASC.Find(Removed.ASC);
+	if (!Handles)
+	{
+		return;
+	}
+	Handles->RemoveSingleSwap(Handle, EAllowShrinking::No);
+	if (Handles->IsEmpty())
+	{
+		TrackedHandlesByASC.Remove(Removed.ASC);
+		DEC_DWORD_STAT(STAT_GASCore_TrackedTargets);
+
+		FDelegateHandle DelegateHandle;
+		if (EffectRemovedDelegates.RemoveAndCopyValue(Removed.ASC, DelegateHandle))
+		{
+			if (UAbilitySystemComponent* ASC = Removed.ASC.Get())
+			{
+				ASC->OnAnyGameplayEffectRemovedDelegate().Remove(DelegateHandle);
+			}
+		}
+	}
+}
+
+void AGASCoreGameplayEffectActor::ResetTracking()
+{
+	for (const TPair<TWeakObjectPtr<UAbilitySystemComponent>, FDelegateHandle>& Pair : EffectRemovedDelegates)
+	{
+		if (UAbilitySystemComponent* ASC = Pair.Key.Get())
+		{
+			ASC->OnAnyGameplayEffectRemovedDelegate().Remove(Pair.Value);
+		}
+	}
+	DEC_DWORD_STAT_BY(STAT_GASCore_TrackedEffects, ActiveGameplayEffects.Num());
+	DEC_DWORD_STAT_BY(STAT_GASCore_TrackedTargets, TrackedHandlesByASC.Num());
+
+	EffectRemovedDelegates.Reset();
+	ActiveGameplayEffects.Reset();
+	TrackedHandlesByASC.Reset();
+	bTrackingCapWarned = false;
+	GetWorldTimerManager().ClearTimer(TrackingSweepTimer);
+}
+
+void AGASCoreGameplayEffectActor::HandleTrackedEffectRemoved(const FActiveGameplayEffect& RemovedEffect)
+{
+	// Fires for every effect leaving a tracked ASC; the map lookup rejects the ones we did not apply.
+	UntrackEffect(RemovedEffect.Handle);
+}
+
+void AGASCoreGameplayEffectActor::SweepTrackedEffects()
+{
+	// Ended effects were untracked as they left; what remains stale here belongs to destroyed targets.
+	TArray<FActiveGameplayEffectHandle, TInlineAllocator<16>> StaleHandles;
+	for (const TPair<TWeakObjectPtr<UAbilitySystemComponent>, TArray<FActiveGameplayEffectHandle>>& Pair : TrackedHandlesByASC)
+	{
+		const UAbilitySystemComponent* ASC = Pair.Key.Get();
+		for (const FActiveGameplayEffectHandle& Handle : Pair.Value)
+		{
+			if (!ASC || !ASC->GetActiveGameplayEffect(Handle))
+			{
+				StaleHandles.Add(Handle);
+			}
+		}
+	}
+	for (const FActiveGameplayEffectHandle& Handle : StaleHandles)
+	{
+		UntrackEffect(Handle);
+	}
+
+	if (TrackedHandlesByASC.IsEmpty())
+	{
+		GetWorldTimerManager().ClearTimer(TrackingSweepTimer);
 	}
 }
 
@@ -3,11 +3,32 @@
 #include "GASCore/Public/GASCore.h"
 
 #include "GASCore/Public/Utilities/GASCoreLogging.h"
+#include "GASCoreStats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DEFINE_STAT(STAT_GASCore_TrackedEffects);
+DEFINE_STAT(STAT_GASCore_TrackedTargets);
+DEFINE_STAT(STAT_GASCore_AbilityLatencyActivate);
+DEFINE_STAT(STAT_GASCore_AbilityLatencyConfirm);
+DEFINE_STAT(STAT_GASCore_AbilityLatencyCue);
+DEFINE_STAT(STAT_GASCore_AbilityLatencyEnd);
+DEFINE_STAT(STAT_GASCore_AbilityPredictionRejected);
+DEFINE_STAT(STAT_GASCore_ProjectileSimTick);
+DEFINE_STAT(STAT_GASCore_SimulatedProjectiles);
+DEFINE_STAT(STAT_GASCore_CueBursts);
+DEFINE_STAT(STAT_GASCore_RoutedCueRPCs);
+DEFINE_STAT(STAT_GASCore_CulledCues);
+
+UE_TRACE_CHANNEL_DEFINE(GASCoreChannel);
+
+CSV_DEFINE_CATEGORY(GASCoreAbilityLatency, true);
+CSV_DEFINE_CATEGORY(GASCoreNetBandwidth, true);
 
 #define LOCTEXT_NAMESPACE "FGASCoreModule"
 
 void FGASCoreModule::StartupModule()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FGASCoreModule::StartupModule);
 	// This code will execute after your module is loaded into memory
 	GASCORE_LOG_LOG(TEXT("GASCore module has started!"));
     
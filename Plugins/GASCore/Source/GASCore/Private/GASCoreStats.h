@@ -0,0 +1,52 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+/**
+ * GASCore stats ("stat GASCore" in any non-shipping build).
+ *
+ * - Accumulators (not reset per frame): live totals across every effect actor in the process.
+ *   Per-actor counts: GASCore.EffectActor.DumpTracking.
+ * - Ability latency: latest sample per phase (ms from input press) plus rejected predictions.
+ *   Per-class percentiles: GASCore.AbilityLatency.Dump. The same values go to the GASCoreAbilityLatency CSV category.
+ * - Projectile simulation: tick cost and live projectile count (counter, reset per frame).
+ * - Cue batching: burst multicasts sent this frame (one per relevancy cell, split above MaxPerBurst).
+ * - Cue routing: per-connection routed cue RPCs sent and cues culled for a viewer this frame.
+ * - Net bandwidth (GASCore.NetBandwidth.Enable): attribute / ASC field / ASC RPC payload bits charged this frame,
+ *   summed over connections, in the GASCoreNetBandwidth CSV category. Per-connection rows: GASCore.NetBandwidth.Dump.
+ * - Insights: the GASCore trace channel carries CPU scopes on the hot entry points (effect application, attribute
+ *   callbacks, input tag dispatch, effect actor overlaps). Off by default; run with -trace=cpu,GASCore or toggle it
+ *   at runtime with "Trace.Enable GASCore" / "Trace.Disable GASCore" (Development and Test builds).
+ * - Frame budget: per-frame ms of the same hot paths for dashboards (Utilities/GASCoreFrameBudget.h).
+ */
+
+DECLARE_STATS_GROUP(TEXT("GASCore"), STATGROUP_GASCore, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Effect Actor Tracked Effects"), STAT_GASCore_TrackedEffects, STATGROUP_GASCore, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Effect Actor Tracked Targets"), STAT_GASCore_TrackedTargets, STATGROUP_GASCore, );
+
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Ability Latency Activate (ms)"), STAT_GASCore_AbilityLatencyActivate, STATGROUP_GASCore, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Ability Latency Server Confirm (ms)"), STAT_GASCore_AbilityLatencyConfirm, STATGROUP_GASCore, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Ability Latency First Cue (ms)"), STAT_GASCore_AbilityLatencyCue, STATGROUP_GASCore, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Ability Latency End (ms)"), STAT_GASCore_AbilityLatencyEnd, STATGROUP_GASCore, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Ability Predictions Rejected"), STAT_GASCore_AbilityPredictionRejected, STATGROUP_GASCore, );
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projectile Simulation Tick"), STAT_GASCore_ProjectileSimTick, STATGROUP_GASCore, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Simulated Projectiles"), STAT_GASCore_SimulatedProjectiles, STATGROUP_GASCore, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cue Burst Multicasts"), STAT_GASCore_CueBursts, STATGROUP_GASCore, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Routed Cue RPCs"), STAT_GASCore_RoutedCueRPCs, STATGROUP_GASCore, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Culled Cues"), STAT_GASCore_CulledCues, STATGROUP_GASCore, );
+
+UE_TRACE_CHANNEL_EXTERN(GASCoreChannel);
+
+/** Insights CPU scope on the GASCore channel (a channel check and nothing else while the channel is off). */
+#define GASCORE_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, GASCoreChannel)
+
+CSV_DECLARE_CATEGORY_EXTERN(GASCoreAbilityLatency);
+CSV_DECLARE_CATEGORY_EXTERN(GASCoreNetBandwidth);
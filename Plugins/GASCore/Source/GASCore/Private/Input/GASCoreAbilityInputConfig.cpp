@@ -5,36 +5,80 @@
 
 #include "Input/GASCoreAbilityInputConfig.h"
 #include "InputAction.h"
+#include "Utilities/GASCoreLogging.h"
 
 const UInputAction* UGASCoreAbilityInputConfig::FindAbilityInputActionByTag(const FGameplayTag& InputTag, bool bLogNotFound) const
 {
-	// Validate the input tag.
-	if (!InputTag.IsValid())
+	if (!bInputActionLookupBuilt)
 	{
-		UE_LOG(LogTemp, Error, TEXT("InputTag parameter is invalid in InputConfig [%s]"), *GetNameSafe(this));
-		return nullptr;
+		RebuildInputActionLookup();
 	}
-	// Check if the array of ability input actions is empty.
-	if (AbilityInputActions.IsEmpty())
+
+	if (const UInputAction* const* InputAction = InputActionsByTag.Find(InputTag))
 	{
-		UE_LOG(LogTemp, Error, TEXT("AbilityInputActions array is empty in InputConfig [%s]"), *GetNameSafe(this));
-		return nullptr;
+		return *InputAction;
 	}
-	
-	// Search for a matching input action by tag.
-	for (const FGASCoreAbilityInputAction& AbilityInputAction : AbilityInputActions)
+
+	// Only on request: UI refreshes probe every slot, including unbound ones.
+	if (bLogNotFound)
 	{
-		// Use MatchesTag to allow for parent/child tag relationships.
-		if (AbilityInputAction.InputTag.MatchesTag(InputTag))
+		GASCORE_LOG_ERROR(TEXT("Cannot find Ability Input Action for InputTag [%s] in InputConfig [%s]"), *InputTag.ToString(), *GetNameSafe(this));
+	}
+	return nullptr;
+}
+
+const UInputAction* UGASCoreAbilityInputConfig::FindAbilityInputActionByTagHierarchical(const FGameplayTag& InputTag, bool bLogNotFound) const
+{
+	if (const UInputAction* InputAction = FindAbilityInputActionByTag(InputTag))
+	{
+		return InputAction;
+	}
+
+	if (InputTag.IsValid())
+	{
+		for (const FGASCoreAbilityInputAction& AbilityInputAction : AbilityInputActions)
 		{
-			return AbilityInputAction.InputAction;
+			if (AbilityInputAction.InputAction && AbilityInputAction.InputTag.MatchesTag(InputTag))
+			{
+				return AbilityInputAction.InputAction;
+			}
 		}
 	}
 
-	// If not found, optionally log an error.
 	if (bLogNotFound)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Cannot find Ability Input Action for InputTag [%s] in InputConfig [%s]"), *InputTag.ToString(), *GetNameSafe(this));
+		GASCORE_LOG_ERROR(TEXT("Cannot find Ability Input Action matching InputTag [%s] in InputConfig [%s]"), *InputTag.ToString(), *GetNameSafe(this));
 	}
 	return nullptr;
-}
\ No newline at end of file
+}
+
+void UGASCoreAbilityInputConfig::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildInputActionLookup();
+}
+
+#if WITH_EDITOR
+void UGASCoreAbilityInputConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	RebuildInputActionLookup();
+}
+#endif
+
+void UGASCoreAbilityInputConfig::RebuildInputActionLookup() const
+{
+	InputActionsByTag.Reset();
+	InputActionsByTag.Reserve(AbilityInputActions.Num());
+
+	for (const FGASCoreAbilityInputAction& AbilityInputAction : AbilityInputActions)
+	{
+		if (AbilityInputAction.InputAction && AbilityInputAction.InputTag.IsValid() && !InputActionsByTag.Contains(AbilityInputAction.InputTag))
+		{
+			InputActionsByTag.Add(AbilityInputAction.InputTag, AbilityInputAction.InputAction);
+		}
+	}
+	bInputActionLookupBuilt = true;
+}
@@ -3,6 +3,8 @@
 
 #include "Input/GASCoreEnhancedInputComponent.h"
 
+#include "Utilities/GASCoreEndOfFrame.h"
+
 
 // Sets default values for this component's properties
 UGASCoreEnhancedInputComponent::UGASCoreEnhancedInputComponent()
@@ -10,3 +12,54 @@ UGASCoreEnhancedInputComponent::UGASCoreEnhancedInputComponent()
 	PrimaryComponentTick.bCanEverTick = false;
 }
 
+void UGASCoreEnhancedInputComponent::CollectHeldInputTag(const FGameplayTag InputTag)
+{
+	PendingHeldInputTags.AddUnique(InputTag);
+
+	// Fallback for owners that never flush explicitly.
+	if (!bHeldInputFlushScheduled)
+	{
+		bHeldInputFlushScheduled = true;
+		GASCoreEndOfFrame::Schedule(this, [](UObject* Object)
+		{
+			UGASCoreEnhancedInputComponent* InputComponent = CastChecked<UGASCoreEnhancedInputComponent>(Object);
+			InputComponent->bHeldInputFlushScheduled = false;
+			InputComponent->FlushHeldAbilityInput();
+		});
+	}
+}
+
+bool UGASCoreEnhancedInputComponent::BeginAbilityInputBinding(const UGASCoreAbilityInputConfig* InputConfig)
+{
+	if (HasAbilityInputBindings(InputConfig))
+	{
+		return false;
+	}
+
+	ClearAbilityInputBindings();
+	BoundAbilityInputConfig = InputConfig;
+	AbilityBindingHandles.Reserve(InputConfig->AbilityInputActions.Num() * 3);
+	return true;
+}
+
+void UGASCoreEnhancedInputComponent::ClearAbilityInputBindings()
+{
+	for (const uint32 Handle : AbilityBindingHandles)
+	{
+		RemoveBindingByHandle(Handle);
+	}
+	AbilityBindingHandles.Reset();
+	HeldInputTagsDelegate.Unbind();
+	PendingHeldInputTags.Reset();
+	BoundAbilityInputConfig = nullptr;
+}
+
+void UGASCoreEnhancedInputComponent::FlushHeldAbilityInput()
+{
+	if (PendingHeldInputTags.IsEmpty()) return;
+
+	// Moved out first: the callback may rebind input or trigger another flush.
+	const TArray<FGameplayTag, TInlineAllocator<8>> HeldInputTags = MoveTemp(PendingHeldInputTags);
+	PendingHeldInputTags.Reset();
+	HeldInputTagsDelegate.ExecuteIfBound(HeldInputTags);
+}
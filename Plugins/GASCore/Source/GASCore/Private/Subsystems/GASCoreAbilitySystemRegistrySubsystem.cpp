@@ -0,0 +1,51 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreAbilitySystemRegistrySubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+
+UGASCoreAbilitySystemRegistrySubsystem* UGASCoreAbilitySystemRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreAbilitySystemRegistrySubsystem>() : nullptr;
+}
+
+void UGASCoreAbilitySystemRegistrySubsystem::Register(UAbilitySystemComponent* AbilitySystem)
+{
+	if (!IsValid(AbilitySystem) || AbilitySystems.Contains(AbilitySystem))
+	{
+		return;
+	}
+
+	AbilitySystems.Add(AbilitySystem);
+	OnAbilitySystemRegistered.Broadcast(AbilitySystem);
+}
+
+void UGASCoreAbilitySystemRegistrySubsystem::Unregister(UAbilitySystemComponent* AbilitySystem)
+{
+	const int32 Index = AbilitySystems.IndexOfByKey(AbilitySystem);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	AbilitySystems.RemoveAtSwap(Index, EAllowShrinking::No);
+	OnAbilitySystemUnregistered.Broadcast(AbilitySystem);
+}
+
+void UGASCoreAbilitySystemRegistrySubsystem::Deinitialize()
+{
+	while (AbilitySystems.Num() > 0)
+	{
+		UAbilitySystemComponent* AbilitySystem = AbilitySystems.Pop(EAllowShrinking::No).Get();
+		if (AbilitySystem)
+		{
+			OnAbilitySystemUnregistered.Broadcast(AbilitySystem);
+		}
+	}
+	OnAbilitySystemRegistered.Clear();
+	OnAbilitySystemUnregistered.Clear();
+
+	Super::Deinitialize();
+}
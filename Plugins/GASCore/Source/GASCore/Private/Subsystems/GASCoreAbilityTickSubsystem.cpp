@@ -0,0 +1,119 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreAbilityTickSubsystem.h"
+
+#include "AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
+#include "Algo/Sort.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarGASCoreAbilityTickConsolidate(
+	TEXT("GASCore.AbilityTick.Consolidate"),
+	true,
+	TEXT("Tick GASCore ability system components from one shared pass (UGASCoreAbilityTickSubsystem) instead of ")
+	TEXT("their own tick functions. Read whenever a component's tick state changes."),
+	ECVF_Default);
+
+UGASCoreAbilityTickSubsystem* UGASCoreAbilityTickSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreAbilityTickSubsystem>() : nullptr;
+}
+
+bool UGASCoreAbilityTickSubsystem::IsConsolidationEnabled()
+{
+	return CVarGASCoreAbilityTickConsolidate.GetValueOnGameThread();
+}
+
+void UGASCoreAbilityTickSubsystem::Register(UGASCoreAbilitySystemComponent* Component)
+{
+	if (!Component || ComponentIndices.Contains(Component))
+	{
+		return;
+	}
+
+	ComponentIndices.Add(Component, Components.Add(Component));
+	bOrderDirty = true;
+}
+
+void UGASCoreAbilityTickSubsystem::Unregister(UGASCoreAbilitySystemComponent* Component)
+{
+	int32 Index = INDEX_NONE;
+	if (!ComponentIndices.RemoveAndCopyValue(Component, Index))
+	{
+		return;
+	}
+
+	// Null the slot rather than shifting: indices stay valid during the pass and RebuildOrder compacts.
+	Components[Index] = nullptr;
+	bOrderDirty = true;
+}
+
+void UGASCoreAbilityTickSubsystem::RebuildOrder()
+{
+	Components.RemoveAllSwap([](const TObjectPtr<UGASCoreAbilitySystemComponent>& Component) { return Component == nullptr; });
+	Algo::Sort(Components, [](const TObjectPtr<UGASCoreAbilitySystemComponent>& A, const TObjectPtr<UGASCoreAbilitySystemComponent>& B)
+	{
+		return A.Get() < B.Get();
+	});
+
+	ComponentIndices.Reset();
+	for (int32 Index = 0; Index < Components.Num(); ++Index)
+	{
+		ComponentIndices.Add(Components[Index].Get(), Index);
+	}
+	bOrderDirty = false;
+}
+
+void UGASCoreAbilityTickSubsystem::Tick(const float DeltaTime)
+{
+	if (bOrderDirty)
+	{
+		RebuildOrder();
+	}
+
+	// Index loop: components registered by a tick callback are appended and still tick this pass.
+	for (int32 Index = 0; Index < Components.Num(); ++Index)
+	{
+		UGASCoreAbilitySystemComponent* Component = Components[Index];
+		if (!Component)
+		{
+			continue;
+		}
+		if (!IsValid(Component) || !Component->IsRegistered() || !Component->IsActive())
+		{
+			Unregister(Component);
+			continue;
+		}
+
+		// Active but idle (no ticking task, montage replication or attribute set tick): stays registered for later work.
+		if (!Component->NeedsTick())
+		{
+			continue;
+		}
+
+		const AActor* Owner = Component->GetOwner();
+		const float ComponentDeltaTime = Owner ? DeltaTime * Owner->CustomTimeDilation : DeltaTime;
+		Component->TickComponent(ComponentDeltaTime, LEVELTICK_All, nullptr);
+	}
+
+	if (bOrderDirty)
+	{
+		RebuildOrder();
+	}
+}
+
+void UGASCoreAbilityTickSubsystem::Deinitialize()
+{
+	Components.Reset();
+	ComponentIndices.Reset();
+	bOrderDirty = false;
+
+	Super::Deinitialize();
+}
+
+TStatId UGASCoreAbilityTickSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGASCoreAbilityTickSubsystem, STATGROUP_Tickables);
+}
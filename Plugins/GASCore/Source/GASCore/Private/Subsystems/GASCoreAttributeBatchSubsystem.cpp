@@ -0,0 +1,56 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreAttributeBatchSubsystem.h"
+
+#include "AbilitySystem/Attributes/GASCoreAttributeSet.h"
+#include "Engine/World.h"
+
+UGASCoreAttributeBatchSubsystem* UGASCoreAttributeBatchSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreAttributeBatchSubsystem>() : nullptr;
+}
+
+void UGASCoreAttributeBatchSubsystem::RequestInitialization(UGASCoreAttributeSet* Set, const UGASCoreAttributeArchetypeDataAsset* Archetype,
+	const int32 Level, const bool bEvaluateDerivedAttributes)
+{
+	if (!IsValid(Set))
+	{
+		return;
+	}
+
+	if (UGASCoreAttributeBatchSubsystem* Subsystem = Get(Set))
+	{
+		Subsystem->Pending.Add(Set, Archetype, Level, bEvaluateDerivedAttributes);
+	}
+	else
+	{
+		// Batch of one.
+		FGASCoreAttributeBatchInitializer Initializer;
+		Initializer.Add(Set, Archetype, Level, bEvaluateDerivedAttributes);
+		Initializer.Execute();
+	}
+}
+
+void UGASCoreAttributeBatchSubsystem::FlushPendingInitializations()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGASCoreAttributeBatchSubsystem::FlushPendingInitializations);
+	Pending.Execute();
+}
+
+void UGASCoreAttributeBatchSubsystem::Deinitialize()
+{
+	Pending.Reset();
+	Super::Deinitialize();
+}
+
+void UGASCoreAttributeBatchSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	FlushPendingInitializations();
+}
+
+TStatId UGASCoreAttributeBatchSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGASCoreAttributeBatchSubsystem, STATGROUP_Tickables);
+}
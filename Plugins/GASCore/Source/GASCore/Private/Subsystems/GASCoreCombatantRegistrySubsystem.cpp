@@ -0,0 +1,189 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreCombatantRegistrySubsystem.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GenericTeamAgentInterface.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarGASCoreCombatantHashCellSize(
+	TEXT("GASCore.CombatantHash.CellSize"),
+	1500.f,
+	TEXT("Cell size (cm) of the per-frame combatant spatial hash; queries up to this radius visit at most 3x3 cells."),
+	ECVF_Default);
+
+UGASCoreCombatantRegistrySubsystem* UGASCoreCombatantRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreCombatantRegistrySubsystem>() : nullptr;
+}
+
+void UGASCoreCombatantRegistrySubsystem::RegisterCombatant(AActor* Combatant)
+{
+	if (IsValid(Combatant))
+	{
+		Combatants.AddUnique(Combatant);
+	}
+}
+
+void UGASCoreCombatantRegistrySubsystem::UnregisterCombatant(const AActor* Combatant)
+{
+	const int32 Index = Combatants.IndexOfByPredicate([Combatant](const TWeakObjectPtr<AActor>& Entry) { return Entry.Get() == Combatant; });
+	if (Index != INDEX_NONE)
+	{
+		Combatants.RemoveAtSwap(Index, EAllowShrinking::No);
+	}
+
+	// Never hand out an unregistered (possibly dying) actor from this frame's hash.
+	const int32 HashedIndex = HashedActors.IndexOfByKey(Combatant);
+	if (HashedIndex != INDEX_NONE)
+	{
+		HashedActors[HashedIndex] = nullptr;
+	}
+}
+
+FIntPoint UGASCoreCombatantRegistrySubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / HashCellSize), FMath::FloorToInt32(Location.Y / HashCellSize));
+}
+
+void UGASCoreCombatantRegistrySubsystem::EnsureHashBuilt()
+{
+	if (HashFrame == GFrameCounter)
+	{
+		return;
+	}
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGASCoreCombatantRegistrySubsystem::EnsureHashBuilt);
+
+	HashFrame = GFrameCounter;
+	HashCellSize = FMath::Max(CVarGASCoreCombatantHashCellSize.GetValueOnGameThread(), 100.f);
+
+	HashedActors.Reset();
+	HashedLocations.Reset();
+	for (TPair<FIntPoint, TArray<int32, TInlineAllocator<4>>>& Pair : Cells)
+	{
+		Pair.Value.Reset();
+	}
+
+	for (int32 Index = Combatants.Num() - 1; Index >= 0; --Index)
+	{
+		AActor* Combatant = Combatants[Index].Get();
+		if (!IsValid(Combatant))
+		{
+			Combatants.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+
+		const FVector Location = Combatant->GetActorLocation();
+		const int32 HashedIndex = HashedActors.Add(Combatant);
+		HashedLocations.Add(FVector2D(Location));
+		Cells.FindOrAdd(GetCell(Location)).Add(HashedIndex);
+	}
+
+	// Keep the cell map from growing forever as combatants roam: drop cells that stayed empty this frame.
+	if (Cells.Num() > HashedActors.Num() * 4 + 64)
+	{
+		for (auto It = Cells.CreateIterator(); It; ++It)
+		{
+			if (It.Value().IsEmpty())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+AActor* UGASCoreCombatantRegistrySubsystem::FindNearestCombatant(const FVector& Origin, const float Radius,
+	const AActor* IgnoreA, const AActor* IgnoreB)
+{
+	if (Radius <= 0.f || Combatants.IsEmpty())
+	{
+		return nullptr;
+	}
+	EnsureHashBuilt();
+
+	return FindNearestInHash(Origin, Radius, [IgnoreA, IgnoreB](const AActor& Candidate)
+	{
+		return &Candidate != IgnoreA && &Candidate != IgnoreB;
+	});
+}
+
+AActor* UGASCoreCombatantRegistrySubsystem::FindNearestCombatant(const FVector& Origin, const float Radius,
+	const TFunctionRef<bool(const AActor& Combatant)> Filter)
+{
+	if (Radius <= 0.f || Combatants.IsEmpty())
+	{
+		return nullptr;
+	}
+	EnsureHashBuilt();
+
+	return FindNearestInHash(Origin, Radius, Filter);
+}
+
+bool UGASCoreCombatantRegistrySubsystem::IsHostile(const AActor* Source, const AActor& Combatant)
+{
+	if (!Source || &Combatant == Source)
+	{
+		return false;
+	}
+
+	if (FGenericTeamId::GetTeamIdentifier(Source) != FGenericTeamId::NoTeam
+		&& FGenericTeamId::GetTeamIdentifier(&Combatant) != FGenericTeamId::NoTeam)
+	{
+		return FGenericTeamId::GetAttitude(Source, &Combatant) == ETeamAttitude::Hostile;
+	}
+
+	const APawn* SourcePawn = Cast<APawn>(Source);
+	const APawn* CombatantPawn = Cast<APawn>(&Combatant);
+	return SourcePawn && CombatantPawn && SourcePawn->IsPlayerControlled() != CombatantPawn->IsPlayerControlled();
+}
+
+AActor* UGASCoreCombatantRegistrySubsystem::FindNearestInHash(const FVector& Origin, const float Radius,
+	const TFunctionRef<bool(const AActor& Combatant)> Filter) const
+{
+	const FVector2D Origin2D(Origin);
+	const FIntPoint MinCell = GetCell(Origin - FVector(Radius, Radius, 0.f));
+	const FIntPoint MaxCell = GetCell(Origin + FVector(Radius, Radius, 0.f));
+
+	AActor* Best = nullptr;
+	double BestDistSq = FMath::Square(static_cast<double>(Radius));
+	for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			const TArray<int32, TInlineAllocator<4>>* Cell = Cells.Find(FIntPoint(X, Y));
+			if (!Cell)
+			{
+				continue;
+			}
+
+			for (const int32 Index : *Cell)
+			{
+				AActor* Candidate = HashedActors[Index];
+				if (!Candidate)
+				{
+					continue;
+				}
+
+				const double DistSq = FVector2D::DistSquared(HashedLocations[Index], Origin2D);
+				if (DistSq <= BestDistSq && Filter(*Candidate))
+				{
+					BestDistSq = DistSq;
+					Best = Candidate;
+				}
+			}
+		}
+	}
+	return Best;
+}
+
+void UGASCoreCombatantRegistrySubsystem::Deinitialize()
+{
+	Combatants.Reset();
+	HashedActors.Reset();
+	HashedLocations.Reset();
+	Cells.Reset();
+
+	Super::Deinitialize();
+}
@@ -0,0 +1,85 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreEffectActorPoolSubsystem.h"
+
+#include "Actors/GASCoreGameplayEffectActor.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarGASCoreEffectActorPoolMaxPerClass(
+	TEXT("GASCore.EffectActorPool.MaxPerClass"),
+	32,
+	TEXT("Inactive AGASCoreGameplayEffectActors kept per class for reuse; consumed actors beyond this are destroyed."),
+	ECVF_Default);
+
+UGASCoreEffectActorPoolSubsystem* UGASCoreEffectActorPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreEffectActorPoolSubsystem>() : nullptr;
+}
+
+AGASCoreGameplayEffectActor* UGASCoreEffectActorPoolSubsystem::SpawnEffectActor(const TSubclassOf<AGASCoreGameplayEffectActor> ActorClass,
+	const FTransform& Transform, const TArray<FGASCoreEffectConfig>* InGameplayEffects, const float InActorLevel)
+{
+	UWorld* World = GetWorld();
+	if (!ActorClass || !World || World->GetNetMode() == NM_Client)
+	{
+		return nullptr;
+	}
+
+	// Reuse: pooled actors may have been destroyed externally (streaming, level cleanup) in the meantime.
+	AGASCoreGameplayEffectActor* Actor = nullptr;
+	if (FGASCoreEffectActorPool* Pool = Pools.Find(ActorClass.Get()))
+	{
+		while (!Actor && !Pool->Actors.IsEmpty())
+		{
+			AGASCoreGameplayEffectActor* Candidate = Pool->Actors.Pop(EAllowShrinking::No);
+			Actor = IsValid(Candidate) ? Candidate : nullptr;
+		}
+	}
+
+	if (!Actor)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		Actor = World->SpawnActor<AGASCoreGameplayEffectActor>(ActorClass, Transform, SpawnParameters);
+		if (!Actor)
+		{
+			return nullptr;
+		}
+	}
+
+	Actor->ActivateFromPool(Transform, InGameplayEffects, InActorLevel);
+	return Actor;
+}
+
+void UGASCoreEffectActorPoolSubsystem::ReleaseEffectActor(AGASCoreGameplayEffectActor* Actor)
+{
+	if (!IsValid(Actor) || Actor->IsInPool() || !Actor->HasAuthority())
+	{
+		return;
+	}
+
+	FGASCoreEffectActorPool& Pool = Pools.FindOrAdd(Actor->GetClass());
+	if (Pool.Actors.Num() >= CVarGASCoreEffectActorPoolMaxPerClass.GetValueOnGameThread())
+	{
+		Actor->Destroy();
+		return;
+	}
+
+	Actor->DeactivateToPool();
+	Pool.Actors.Add(Actor);
+}
+
+int32 UGASCoreEffectActorPoolSubsystem::GetNumPooled(const TSubclassOf<AGASCoreGameplayEffectActor> ActorClass) const
+{
+	const FGASCoreEffectActorPool* Pool = Pools.Find(ActorClass.Get());
+	return Pool ? Pool->Actors.Num() : 0;
+}
+
+void UGASCoreEffectActorPoolSubsystem::Deinitialize()
+{
+	Pools.Reset();
+
+	Super::Deinitialize();
+}
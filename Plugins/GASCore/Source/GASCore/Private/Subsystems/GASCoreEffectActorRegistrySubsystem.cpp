@@ -0,0 +1,230 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreEffectActorRegistrySubsystem.h"
+
+#include "Actors/GASCoreGameplayEffectActor.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarGASCoreEffectActorRegistryCellSize(
+	TEXT("GASCore.EffectActorRegistry.CellSize"),
+	2000.f,
+	TEXT("Grid cell size (cm) of the effect actor registry. Roughly the typical query radius."),
+	ECVF_Default);
+
+UGASCoreEffectActorRegistrySubsystem* UGASCoreEffectActorRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreEffectActorRegistrySubsystem>() : nullptr;
+}
+
+FIntPoint UGASCoreEffectActorRegistrySubsystem::GetCell(const FVector2D& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UGASCoreEffectActorRegistrySubsystem::RegisterEffectActor(AGASCoreGameplayEffectActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	const float DesiredCellSize = FMath::Max(CVarGASCoreEffectActorRegistryCellSize.GetValueOnGameThread(), 100.f);
+	if (CellSize != DesiredCellSize)
+	{
+		CellSize = DesiredCellSize;
+		RebuildGrids();
+	}
+
+	UnregisterEffectActor(Actor);
+
+	// Every asset tag of the rows plus their parents.
+	const FGameplayTagContainer Tags = Actor->GetEffectAssetTags().GetGameplayTagParents();
+	if (Tags.IsEmpty())
+	{
+		return;
+	}
+
+	const FVector2D Location(Actor->GetActorLocation());
+	FRecord& Record = Records.Add(FObjectKey(Actor));
+	Record.Cell = GetCell(Location);
+	Tags.GetGameplayTagArray(Record.Tags);
+
+	for (const FGameplayTag& Tag : Record.Tags)
+	{
+		FTagGrid& Grid = Grids.FindOrAdd(Tag);
+		Grid.Cells.FindOrAdd(Record.Cell).Add({ Actor, Location });
+		Grid.MinCell = FIntPoint(FMath::Min(Grid.MinCell.X, Record.Cell.X), FMath::Min(Grid.MinCell.Y, Record.Cell.Y));
+		Grid.MaxCell = FIntPoint(FMath::Max(Grid.MaxCell.X, Record.Cell.X), FMath::Max(Grid.MaxCell.Y, Record.Cell.Y));
+	}
+}
+
+void UGASCoreEffectActorRegistrySubsystem::UnregisterEffectActor(const AGASCoreGameplayEffectActor* Actor)
+{
+	FRecord Record;
+	if (!Records.RemoveAndCopyValue(FObjectKey(Actor), Record))
+	{
+		return;
+	}
+
+	// Bounds are left as they are (conservative): an emptied border only costs a few extra ring visits.
+	for (const FGameplayTag& Tag : Record.Tags)
+	{
+		FTagGrid* Grid = Grids.Find(Tag);
+		TArray<FGridEntry>* Entries = Grid ? Grid->Cells.Find(Record.Cell) : nullptr;
+		if (!Entries)
+		{
+			continue;
+		}
+
+		Entries->RemoveAllSwap([Actor](const FGridEntry& Entry) { return Entry.Actor.Get() == Actor || Entry.Actor.IsStale(); },
+			EAllowShrinking::No);
+		if (Entries->IsEmpty())
+		{
+			Grid->Cells.Remove(Record.Cell);
+		}
+	}
+}
+
+void UGASCoreEffectActorRegistrySubsystem::GatherCell(const FTagGrid& Grid, const FIntPoint& Cell, const FVector2D& Origin,
+	const float RadiusSquared, TArray<TPair<float, AGASCoreGameplayEffectActor*>>& OutCandidates)
+{
+	const TArray<FGridEntry>* Entries = Grid.Cells.Find(Cell);
+	if (!Entries)
+	{
+		return;
+	}
+
+	for (const FGridEntry& Entry : *Entries)
+	{
+		AGASCoreGameplayEffectActor* Actor = Entry.Actor.Get();
+		const float DistanceSquared = FVector2D::DistSquared(Entry.Location, Origin);
+		if (Actor && !Actor->IsHidden() && (RadiusSquared <= 0.f || DistanceSquared <= RadiusSquared))
+		{
+			OutCandidates.Emplace(DistanceSquared, Actor);
+		}
+	}
+}
+
+void UGASCoreEffectActorRegistrySubsystem::FindEffectActorsInRadius(const FGameplayTag Tag, const FVector Origin, const float Radius,
+	TArray<AGASCoreGameplayEffectActor*>& OutActors) const
+{
+	OutActors.Reset();
+	const FTagGrid* Grid = Grids.Find(Tag);
+	if (!Grid || Radius <= 0.f)
+	{
+		return;
+	}
+
+	const FVector2D Origin2D(Origin);
+	const FIntPoint MinCell = GetCell(Origin2D - FVector2D(Radius));
+	const FIntPoint MaxCell = GetCell(Origin2D + FVector2D(Radius));
+
+	TArray<TPair<float, AGASCoreGameplayEffectActor*>> Candidates;
+	for (int32 Y = FMath::Max(MinCell.Y, Grid->MinCell.Y); Y <= FMath::Min(MaxCell.Y, Grid->MaxCell.Y); ++Y)
+	{
+		for (int32 X = FMath::Max(MinCell.X, Grid->MinCell.X); X <= FMath::Min(MaxCell.X, Grid->MaxCell.X); ++X)
+		{
+			GatherCell(*Grid, FIntPoint(X, Y), Origin2D, FMath::Square(Radius), Candidates);
+		}
+	}
+
+	OutActors.Reserve(Candidates.Num());
+	for (const TPair<float, AGASCoreGameplayEffectActor*>& Candidate : Candidates)
+	{
+		OutActors.Add(Candidate.Value);
+	}
+}
+
+void UGASCoreEffectActorRegistrySubsystem::FindNearestEffectActors(const FGameplayTag Tag, const FVector Origin, const int32 Count,
+	TArray<AGASCoreGameplayEffectActor*>& OutActors, const float MaxRadius) const
+{
+	OutActors.Reset();
+	const FTagGrid* Grid = Grids.Find(Tag);
+	if (!Grid || Count <= 0)
+	{
+		return;
+	}
+
+	const FVector2D Origin2D(Origin);
+	const FIntPoint Center = GetCell(Origin2D);
+	const float RadiusSquared = MaxRadius > 0.f ? FMath::Square(MaxRadius) : 0.f;
+
+	// Rings needed to cover the occupied area (and MaxRadius when set).
+	int32 MaxRing = FMath::Max(
+		FMath::Max(FMath::Abs(Grid->MinCell.X - Center.X), FMath::Abs(Grid->MaxCell.X - Center.X)),
+		FMath::Max(FMath::Abs(Grid->MinCell.Y - Center.Y), FMath::Abs(Grid->MaxCell.Y - Center.Y)));
+	if (MaxRadius > 0.f)
+	{
+		MaxRing = FMath::Min(MaxRing, FMath::CeilToInt32(MaxRadius / CellSize));
+	}
+
+	TArray<TPair<float, AGASCoreGameplayEffectActor*>> Candidates;
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		// Anything in ring R is at least (R - 1) * CellSize away: stop once that cannot beat the N-th candidate.
+		if (Candidates.Num() >= Count)
+		{
+			Candidates.Sort([](const TPair<float, AGASCoreGameplayEffectActor*>& A, const TPair<float, AGASCoreGameplayEffectActor*>& B) { return A.Key < B.Key; });
+			const float RingDistance = (Ring - 1) * CellSize;
+			if (RingDistance > 0.f && FMath::Square(RingDistance) > Candidates[Count - 1].Key)
+			{
+				break;
+			}
+		}
+
+		for (int32 Y = Center.Y - Ring; Y <= Center.Y + Ring; ++Y)
+		{
+			// Full rows on the ring's top/bottom, only the two end cells in between.
+			const bool bEdgeRow = Y == Center.Y - Ring || Y == Center.Y + Ring;
+			const int32 Step = bEdgeRow || Ring == 0 ? 1 : 2 * Ring;
+			for (int32 X = Center.X - Ring; X <= Center.X + Ring; X += Step)
+			{
+				GatherCell(*Grid, FIntPoint(X, Y), Origin2D, RadiusSquared, Candidates);
+			}
+		}
+	}
+
+	Candidates.Sort([](const TPair<float, AGASCoreGameplayEffectActor*>& A, const TPair<float, AGASCoreGameplayEffectActor*>& B) { return A.Key < B.Key; });
+	const int32 NumResults = FMath::Min(Count, Candidates.Num());
+	OutActors.Reserve(NumResults);
+	for (int32 Index = 0; Index < NumResults; ++Index)
+	{
+		OutActors.Add(Candidates[Index].Value);
+	}
+}
+
+void UGASCoreEffectActorRegistrySubsystem::RebuildGrids()
+{
+	// Rare (cell size changed): gather the live actors and file them again.
+	TArray<AGASCoreGameplayEffectActor*> Actors;
+	for (const TPair<FGameplayTag, FTagGrid>& Pair : Grids)
+	{
+		for (const TPair<FIntPoint, TArray<FGridEntry>>& Cell : Pair.Value.Cells)
+		{
+			for (const FGridEntry& Entry : Cell.Value)
+			{
+				if (AGASCoreGameplayEffectActor* Actor = Entry.Actor.Get())
+				{
+					Actors.AddUnique(Actor);
+				}
+			}
+		}
+	}
+
+	Grids.Reset();
+	Records.Reset();
+	for (AGASCoreGameplayEffectActor* Actor : Actors)
+	{
+		RegisterEffectActor(Actor);
+	}
+}
+
+void UGASCoreEffectActorRegistrySubsystem::Deinitialize()
+{
+	Grids.Reset();
+	Records.Reset();
+
+	Super::Deinitialize();
+}
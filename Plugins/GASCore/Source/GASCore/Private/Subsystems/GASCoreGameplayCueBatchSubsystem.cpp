@@ -0,0 +1,153 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreGameplayCueBatchSubsystem.h"
+
+#include "Engine/World.h"
+#include "GASCoreStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Subsystems/GASCoreGameplayCueRoutingSubsystem.h"
+#include "Utilities/GASCoreEndOfFrame.h"
+
+static TAutoConsoleVariable<float> CVarGASCoreCueBatchCellSize(
+	TEXT("GASCore.CueBatch.CellSize"),
+	2000.f,
+	TEXT("Edge length (cm) of the relevancy cells impact cues are batched by; one multicast per cell per frame."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGASCoreCueBatchMaxPerBurst(
+	TEXT("GASCore.CueBatch.MaxPerBurst"),
+	32,
+	TEXT("Maximum cues carried by one burst multicast; larger bursts are split."),
+	ECVF_Default);
+
+UGASCoreGameplayCueBatchSubsystem* UGASCoreGameplayCueBatchSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreGameplayCueBatchSubsystem>() : nullptr;
+}
+
+void UGASCoreGameplayCueBatchSubsystem::QueueCue(const FGameplayTag& CueTag, const FVector& Location, const FVector& Normal,
+	const float Magnitude)
+{
+	const UWorld* World = GetWorld();
+	if (!CueTag.IsValid() || !World || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	FGASCoreBatchedCue& Cue = QueuedCues.AddDefaulted_GetRef();
+	Cue.CueTag = CueTag;
+	Cue.Location = Location;
+	Cue.Normal = Normal.GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector);
+	Cue.Magnitude = Magnitude;
+
+	if (!bFlushScheduled)
+	{
+		bFlushScheduled = true;
+		GASCoreEndOfFrame::Schedule(this, [](UObject* Object)
+		{
+			CastChecked<UGASCoreGameplayCueBatchSubsystem>(Object)->FlushQueuedCues();
+		});
+	}
+}
+
+void UGASCoreGameplayCueBatchSubsystem::FlushQueuedCues()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGASCoreGameplayCueBatchSubsystem::FlushQueuedCues);
+
+	bFlushScheduled = false;
+	if (QueuedCues.IsEmpty())
+	{
+		return;
+	}
+
+	// Routable cues go per connection (culled by view); the rest grouped by cell (stable: cues keep their queue order).
+	UGASCoreGameplayCueRoutingSubsystem* Routing = UGASCoreGameplayCueRoutingSubsystem::Get(this);
+	const bool bRoute = Routing && Routing->CanRoute();
+
+	const double CellSize = FMath::Max(CVarGASCoreCueBatchCellSize.GetValueOnGameThread(), 100.f);
+	TMap<FIntVector, TArray<FGASCoreBatchedCue>, TInlineSetAllocator<8>> CuesByCell;
+	for (const FGASCoreBatchedCue& Cue : QueuedCues)
+	{
+		if (bRoute && Routing->GetPriority(Cue.CueTag) != EGASCoreCueRoutingPriority::Always)
+		{
+			Routing->QueueCue(Cue);
+			continue;
+		}
+
+		const FIntVector Cell(
+			FMath::FloorToInt32(Cue.Location.X / CellSize),
+			FMath::FloorToInt32(Cue.Location.Y / CellSize),
+			FMath::FloorToInt32(Cue.Location.Z / CellSize));
+		CuesByCell.FindOrAdd(Cell).Add(Cue);
+	}
+	QueuedCues.Reset();
+
+	if (bRoute)
+	{
+		Routing->FlushRoutedCues();
+	}
+
+	const int32 MaxPerBurst = FMath::Max(CVarGASCoreCueBatchMaxPerBurst.GetValueOnGameThread(), 1);
+	for (TPair<FIntVector, TArray<FGASCoreBatchedCue>>& Pair : CuesByCell)
+	{
+		AGASCoreGameplayCueBurstActor* Proxy = FindOrSpawnCellProxy(Pair.Key);
+		if (!Proxy)
+		{
+			continue;
+		}
+
+		TArray<FGASCoreBatchedCue>& CellCues = Pair.Value;
+		if (CellCues.Num() <= MaxPerBurst)
+		{
+			Proxy->MulticastExecuteCueBurst(CellCues);
+			INC_DWORD_STAT(STAT_GASCore_CueBursts);
+			continue;
+		}
+
+		TArray<FGASCoreBatchedCue> Chunk;
+		Chunk.Reserve(MaxPerBurst);
+		for (int32 Start = 0; Start < CellCues.Num(); Start += MaxPerBurst)
+		{
+			Chunk.Reset();
+			Chunk.Append(CellCues.GetData() + Start, FMath::Min(MaxPerBurst, CellCues.Num() - Start));
+			Proxy->MulticastExecuteCueBurst(Chunk);
+			INC_DWORD_STAT(STAT_GASCore_CueBursts);
+		}
+	}
+}
+
+AGASCoreGameplayCueBurstActor* UGASCoreGameplayCueBatchSubsystem::FindOrSpawnCellProxy(const FIntVector& Cell)
+{
+	if (const TObjectPtr<AGASCoreGameplayCueBurstActor>* Existing = CellProxies.Find(Cell))
+	{
+		if (IsValid(*Existing))
+		{
+			return *Existing;
+		}
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	const double CellSize = FMath::Max(CVarGASCoreCueBatchCellSize.GetValueOnGameThread(), 100.f);
+	const FVector CellCentre = (FVector(Cell) + FVector(0.5)) * CellSize;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	AGASCoreGameplayCueBurstActor* Proxy = World->SpawnActor<AGASCoreGameplayCueBurstActor>(CellCentre, FRotator::ZeroRotator, SpawnParams);
+	CellProxies.Add(Cell, Proxy);
+	return Proxy;
+}
+
+void UGASCoreGameplayCueBatchSubsystem::Deinitialize()
+{
+	QueuedCues.Reset();
+	CellProxies.Reset();
+
+	Super::Deinitialize();
+}
@@ -0,0 +1,280 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreGameplayCueRoutingSubsystem.h"
+
+#include "AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "GASCoreStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Utilities/GASCoreEndOfFrame.h"
+
+static TAutoConsoleVariable<bool> CVarGASCoreCueRoutingEnable(
+	TEXT("GASCore.CueRouting.Enable"),
+	true,
+	TEXT("Cull High/Cosmetic Executed cues per receiving connection instead of multicasting them (UGASCoreGameplayCueRoutingSubsystem)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreCueRoutingNearDistance(
+	TEXT("GASCore.CueRouting.NearDistance"),
+	800.f,
+	TEXT("Cues within this distance (cm) of a viewer's view target always reach it, whatever their priority."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreCueRoutingHighDistance(
+	TEXT("GASCore.CueRouting.HighDistance"),
+	6000.f,
+	TEXT("Maximum distance (cm) from a viewer's view target at which High priority cues reach it."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreCueRoutingCosmeticDistance(
+	TEXT("GASCore.CueRouting.CosmeticDistance"),
+	3000.f,
+	TEXT("Maximum distance (cm) from a viewer's view target at which Cosmetic cues reach it."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreCueRoutingViewConeAngle(
+	TEXT("GASCore.CueRouting.ViewConeAngle"),
+	70.f,
+	TEXT("Half angle (degrees) of the camera cone Cosmetic cues must be inside (>= 180 disables the cone test)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGASCoreCueRoutingMaxPerBurst(
+	TEXT("GASCore.CueRouting.MaxPerBurst"),
+	32,
+	TEXT("Maximum cues carried by one routed client RPC; larger bursts are split."),
+	ECVF_Default);
+
+UGASCoreGameplayCueRoutingSubsystem* UGASCoreGameplayCueRoutingSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreGameplayCueRoutingSubsystem>() : nullptr;
+}
+
+EGASCoreCueRoutingPriority UGASCoreGameplayCueRoutingSubsystem::GetPriority(const FGameplayTag& CueTag) const
+{
+	if (const EGASCoreCueRoutingPriority* Cached = PriorityCache.Find(CueTag))
+	{
+		return *Cached;
+	}
+
+	// Most specific matching rule (deepest tag) wins; unlisted tags are never culled.
+	EGASCoreCueRoutingPriority Priority = EGASCoreCueRoutingPriority::Always;
+	int32 BestDepth = INDEX_NONE;
+	for (const FGASCoreCueRoutingRule& Rule : Rules)
+	{
+		if (!Rule.CueTag.IsValid() || !CueTag.MatchesTag(Rule.CueTag))
+		{
+			continue;
+		}
+		const int32 Depth = Rule.CueTag.GetGameplayTagParents().Num();
+		if (Depth > BestDepth)
+		{
+			BestDepth = Depth;
+			Priority = Rule.Priority;
+		}
+	}
+	return PriorityCache.Add(CueTag, Priority);
+}
+
+bool UGASCoreGameplayCueRoutingSubsystem::CanRoute() const
+{
+	if (CanRouteFrame == GFrameCounter)
+	{
+		return bCanRoute;
+	}
+	CanRouteFrame = GFrameCounter;
+
+	const UWorld* World = GetWorld();
+	const ENetMode NetMode = World ? World->GetNetMode() : NM_Standalone;
+	if (!CVarGASCoreCueRoutingEnable.GetValueOnGameThread() || (NetMode != NM_DedicatedServer && NetMode != NM_ListenServer))
+	{
+		bCanRoute = false;
+		return false;
+	}
+
+	bCanRoute = true;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (PlayerController && !PlayerController->IsLocalController() && !FindReceiver(*PlayerController))
+		{
+			bCanRoute = false;
+			break;
+		}
+	}
+	return bCanRoute;
+}
+
+void UGASCoreGameplayCueRoutingSubsystem::QueueCue(const FGASCoreBatchedCue& Cue, const UNetConnection* SkipConnection)
+{
+	if (!Cue.CueTag.IsValid())
+	{
+		return;
+	}
+
+	FRoutedCue& Routed = QueuedCues.AddDefaulted_GetRef();
+	Routed.Cue = Cue;
+	Routed.Cue.Target = nullptr;
+	Routed.TargetActor = Cue.Target;
+	Routed.Priority = GetPriority(Cue.CueTag);
+	Routed.SkipConnection = SkipConnection;
+
+	if (!bFlushScheduled)
+	{
+		bFlushScheduled = true;
+		GASCoreEndOfFrame::Schedule(this, [](UObject* Object)
+		{
+			CastChecked<UGASCoreGameplayCueRoutingSubsystem>(Object)->FlushRoutedCues();
+		});
+	}
+}
+
+UGASCoreAbilitySystemComponent* UGASCoreGameplayCueRoutingSubsystem::FindReceiver(const APlayerController& PlayerController)
+{
+	if (UGASCoreAbilitySystemComponent* Receiver = Cast<UGASCoreAbilitySystemComponent>(
+		UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(PlayerController.PlayerState)))
+	{
+		return Receiver;
+	}
+	return Cast<UGASCoreAbilitySystemComponent>(UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(PlayerController.GetPawn()));
+}
+
+bool UGASCoreGameplayCueRoutingSubsystem::GatherViewers(TArray<FViewer, TInlineAllocator<16>>& OutViewers) const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PlayerController = It->Get();
+		if (!PlayerController)
+		{
+			continue;
+		}
+
+		FViewer& Viewer = OutViewers.AddDefaulted_GetRef();
+		Viewer.PlayerController = PlayerController;
+		if (!PlayerController->IsLocalController())
+		{
+			Viewer.Receiver = FindReceiver(*PlayerController);
+			Viewer.Connection = PlayerController->GetNetConnection();
+			if (!Viewer.Receiver)
+			{
+				return false;
+			}
+		}
+
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(Viewer.ViewLocation, ViewRotation);
+		Viewer.ViewDirection = ViewRotation.Vector();
+
+		const AActor* ViewTarget = PlayerController->GetViewTarget();
+		Viewer.Focus = ViewTarget ? ViewTarget->GetActorLocation() : Viewer.ViewLocation;
+	}
+	return true;
+}
+
+void UGASCoreGameplayCueRoutingSubsystem::FlushRoutedCues()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGASCoreGameplayCueRoutingSubsystem::FlushRoutedCues);
+
+	bFlushScheduled = false;
+	if (QueuedCues.IsEmpty())
+	{
+		return;
+	}
+
+	// Resolve targets once; a destroyed target leaves a location-only cue.
+	for (FRoutedCue& Routed : QueuedCues)
+	{
+		Routed.Cue.Target = Routed.TargetActor.Get();
+	}
+
+	TArray<FViewer, TInlineAllocator<16>> Viewers;
+	if (!GatherViewers(Viewers))
+	{
+		// A remote player without a receiver joined mid-frame: dropping cosmetic cues for one frame is acceptable.
+		QueuedCues.Reset();
+		return;
+	}
+
+	const double NearDistanceSq = FMath::Square(CVarGASCoreCueRoutingNearDistance.GetValueOnGameThread());
+	const double HighDistanceSq = FMath::Square(CVarGASCoreCueRoutingHighDistance.GetValueOnGameThread());
+	const double CosmeticDistanceSq = FMath::Square(CVarGASCoreCueRoutingCosmeticDistance.GetValueOnGameThread());
+	const float ConeAngle = CVarGASCoreCueRoutingViewConeAngle.GetValueOnGameThread();
+	const bool bTestCone = ConeAngle < 180.f;
+	const double MinConeDot = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(ConeAngle, 0.f, 180.f)));
+	const int32 MaxPerBurst = FMath::Max(CVarGASCoreCueRoutingMaxPerBurst.GetValueOnGameThread(), 1);
+
+	TArray<FGASCoreBatchedCue> ViewerCues;
+	ViewerCues.Reserve(QueuedCues.Num());
+	for (const FViewer& Viewer : Viewers)
+	{
+		ViewerCues.Reset();
+		for (const FRoutedCue& Routed : QueuedCues)
+		{
+			if (Viewer.Connection && Routed.SkipConnection.Get() == Viewer.Connection)
+			{
+				continue;
+			}
+
+			const FVector& Location = Routed.Cue.Location;
+			const double DistanceSq = FVector::DistSquared(Viewer.Focus, Location);
+			bool bVisible = DistanceSq <= NearDistanceSq;
+			if (!bVisible && Routed.Priority == EGASCoreCueRoutingPriority::High)
+			{
+				bVisible = DistanceSq <= HighDistanceSq;
+			}
+			else if (!bVisible && DistanceSq <= CosmeticDistanceSq)
+			{
+				bVisible = !bTestCone
+					|| ((Location - Viewer.ViewLocation).GetSafeNormal() | Viewer.ViewDirection) >= MinConeDot;
+			}
+
+			if (bVisible)
+			{
+				ViewerCues.Add(Routed.Cue);
+			}
+			else
+			{
+				INC_DWORD_STAT(STAT_GASCore_CulledCues);
+			}
+		}
+
+		if (ViewerCues.IsEmpty())
+		{
+			continue;
+		}
+		if (!Viewer.Receiver)
+		{
+			AGASCoreGameplayCueBurstActor::ExecuteCues(Viewer.PlayerController, ViewerCues);
+			continue;
+		}
+
+		for (int32 Start = 0; Start < ViewerCues.Num(); Start += MaxPerBurst)
+		{
+			const int32 Count = FMath::Min(MaxPerBurst, ViewerCues.Num() - Start);
+			Viewer.Receiver->ClientExecuteCueBurst(Start == 0 && Count == ViewerCues.Num()
+				? ViewerCues
+				: TArray<FGASCoreBatchedCue>(ViewerCues.GetData() + Start, Count));
+			INC_DWORD_STAT(STAT_GASCore_RoutedCueRPCs);
+		}
+	}
+
+	QueuedCues.Reset();
+}
+
+void UGASCoreGameplayCueRoutingSubsystem::Deinitialize()
+{
+	QueuedCues.Reset();
+	PriorityCache.Reset();
+
+	Super::Deinitialize();
+}
@@ -0,0 +1,281 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreLagCompensationSubsystem.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/GameStateBase.h"
+#include "HAL/IConsoleManager.h"
+#include "Subsystems/GASCoreCombatantRegistrySubsystem.h"
+
+static TAutoConsoleVariable<int32> CVarGASCoreLagCompensationHistoryFrames(
+	TEXT("GASCore.LagCompensation.HistoryFrames"),
+	32,
+	TEXT("Server frames of combatant locations kept for rewinding (read when the world starts; cover MaxRewindMs at the server tick rate)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreLagCompensationMaxRewindMs(
+	TEXT("GASCore.LagCompensation.MaxRewindMs"),
+	400.f,
+	TEXT("Oldest hit report accepted, in ms before the current server time."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreLagCompensationTolerance(
+	TEXT("GASCore.LagCompensation.Tolerance"),
+	30.f,
+	TEXT("Distance (cm) a reported impact may lie outside the rewound capsule (projectile radius, quantization, interpolation)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreLagCompensationOriginTolerance(
+	TEXT("GASCore.LagCompensation.OriginTolerance"),
+	150.f,
+	TEXT("Distance (cm) a reported projectile origin may lie from the server's spawn (the client's pawn runs ahead)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreLagCompensationMaxAngle(
+	TEXT("GASCore.LagCompensation.MaxAngle"),
+	10.f,
+	TEXT("Angle (degrees) a reported projectile direction may differ from the server's spawn rotation."),
+	ECVF_Default);
+
+UGASCoreLagCompensationSubsystem* UGASCoreLagCompensationSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreLagCompensationSubsystem>() : nullptr;
+}
+
+void UGASCoreLagCompensationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	HistoryFrames = FMath::Clamp(CVarGASCoreLagCompensationHistoryFrames.GetValueOnGameThread(), 2, 256);
+	FrameTimes.SetNumZeroed(HistoryFrames);
+}
+
+void UGASCoreLagCompensationSubsystem::Deinitialize()
+{
+	RowActors.Reset();
+	RowKeys.Reset();
+	RowRadii.Reset();
+	RowHalfHeights.Reset();
+	RowSince.Reset();
+	RowLocations.Reset();
+	RowByActor.Reset();
+
+	Super::Deinitialize();
+}
+
+void UGASCoreLagCompensationSubsystem::Tick(float DeltaTime)
+{
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client || World->GetNetMode() == NM_Standalone)
+	{
+		return;
+	}
+
+	const AGameStateBase* GameState = World->GetGameState();
+	RecordFrame(GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds());
+}
+
+void UGASCoreLagCompensationSubsystem::RecordFrame(const double Now)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGASCoreLagCompensationSubsystem::RecordFrame);
+
+	const UGASCoreCombatantRegistrySubsystem* Registry = UGASCoreCombatantRegistrySubsystem::Get(this);
+	if (!Registry)
+	{
+		return;
+	}
+
+	NewestSlot = (NewestSlot + 1) % HistoryFrames;
+	NumFrames = FMath::Min(NumFrames + 1, HistoryFrames);
+	FrameTimes[NewestSlot] = Now;
+
+	// Rows of combatants that are gone (or were unregistered).
+	for (int32 Row = RowActors.Num() - 1; Row >= 0; --Row)
+	{
+		if (!RowActors[Row].IsValid())
+		{
+			RemoveRow(Row);
+		}
+	}
+
+	for (const TWeakObjectPtr<AActor>& Entry : Registry->GetCombatants())
+	{
+		const AActor* Combatant = Entry.Get();
+		if (!Combatant)
+		{
+			continue;
+		}
+
+		int32 Row = INDEX_NONE;
+		if (const int32* Existing = RowByActor.Find(Combatant))
+		{
+			Row = *Existing;
+		}
+		else
+		{
+			Row = RowActors.Add(Entry);
+			RowKeys.Add(Combatant);
+			RowRadii.AddZeroed();
+			RowHalfHeights.AddZeroed();
+			RowSince.Add(Now);
+			RowLocations.AddZeroed(HistoryFrames);
+			RowByActor.Add(Combatant, Row);
+		}
+
+		// Cylinder every frame: crouching / scaled capsules change it.
+		Combatant->GetSimpleCollisionCylinder(RowRadii[Row], RowHalfHeights[Row]);
+		RowLocations[Row * HistoryFrames + NewestSlot] = Combatant->GetActorLocation();
+	}
+}
+
+void UGASCoreLagCompensationSubsystem::RemoveRow(const int32 Row)
+{
+	const int32 LastRow = RowActors.Num() - 1;
+	RowByActor.Remove(RowKeys[Row]);
+	if (Row != LastRow)
+	{
+		FMemory::Memcpy(&RowLocations[Row * HistoryFrames], &RowLocations[LastRow * HistoryFrames], sizeof(FVector) * HistoryFrames);
+		RowByActor.Add(RowKeys[LastRow], Row);
+	}
+
+	RowActors.RemoveAtSwap(Row, EAllowShrinking::No);
+	RowKeys.RemoveAtSwap(Row, EAllowShrinking::No);
+	RowRadii.RemoveAtSwap(Row, EAllowShrinking::No);
+	RowHalfHeights.RemoveAtSwap(Row, EAllowShrinking::No);
+	RowSince.RemoveAtSwap(Row, EAllowShrinking::No);
+	RowLocations.RemoveAt(LastRow * HistoryFrames, HistoryFrames, EAllowShrinking::No);
+}
+
+bool UGASCoreLagCompensationSubsystem::GetRewoundLocation(const AActor* Target, const double ServerTime, FVector& OutLocation,
+	float& OutRadius, float& OutHalfHeight) const
+{
+	const int32* RowPtr = Target ? RowByActor.Find(Target) : nullptr;
+	if (!RowPtr || NumFrames == 0)
+	{
+		return false;
+	}
+
+	const int32 Row = *RowPtr;
+	if (ServerTime < RowSince[Row])
+	{
+		return false;
+	}
+
+	OutRadius = RowRadii[Row];
+	OutHalfHeight = RowHalfHeights[Row];
+	const FVector* Locations = &RowLocations[Row * HistoryFrames];
+
+	// Newest first: reports are usually a few frames old.
+	const int32 Newest = SlotForAge(0);
+	if (ServerTime >= FrameTimes[Newest])
+	{
+		OutLocation = Locations[Newest];
+		return true;
+	}
+
+	for (int32 Age = 1; Age < NumFrames; ++Age)
+	{
+		const int32 Older = SlotForAge(Age);
+		if (FrameTimes[Older] <= ServerTime)
+		{
+			const int32 Newer = SlotForAge(Age - 1);
+			const double Span = FrameTimes[Newer] - FrameTimes[Older];
+			const float Alpha = Span > UE_SMALL_NUMBER ? static_cast<float>((ServerTime - FrameTimes[Older]) / Span) : 1.f;
+			OutLocation = FMath::Lerp(Locations[Older], Locations[Newer], Alpha);
+			return true;
+		}
+	}
+	return false;
+}
+
+double UGASCoreLagCompensationSubsystem::GetServerTime() const
+{
+	const UWorld* World = GetWorld();
+	const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+	return GameState ? GameState->GetServerWorldTimeSeconds() : (World ? World->GetTimeSeconds() : 0.0);
+}
+
+bool UGASCoreLagCompensationSubsystem::ValidateShotPath(const FGASCoreProjectileHitReport& Report, const FGASCoreProjectileShot& Shot) const
+{
+	const double Now = GetServerTime();
+	const double MaxRewind = CVarGASCoreLagCompensationMaxRewindMs.GetValueOnGameThread() / 1000.0;
+	if (Report.ServerTime < Now - MaxRewind || Report.ServerTime > Now + 0.1)
+	{
+		return false;
+	}
+
+	// Launched where and towards where the server spawned the shot.
+	const FVector Origin = Report.Origin;
+
+	// The client's direction is only quantized, not normalized: reject zero / scaled vectors (beyond quantization
+	// error) so they cannot stretch the angle and distance-from-line checks, then use it at unit length.
+	const FVector ReportedDirection = Report.Direction;
+	if (!FMath::IsNearlyEqual(ReportedDirection.SizeSquared(), 1.0, 0.01))
+	{
+		return false;
+	}
+	const FVector Direction = ReportedDirection.GetSafeNormal();
+	const float OriginTolerance = CVarGASCoreLagCompensationOriginTolerance.GetValueOnGameThread();
+	const float MinCos = FMath::Cos(FMath::DegreesToRadians(CVarGASCoreLagCompensationMaxAngle.GetValueOnGameThread()));
+	if (FVector::DistSquared(Origin, Shot.Origin) > FMath::Square(OriginTolerance) || (Direction | Shot.Direction) < MinCos)
+	{
+		return false;
+	}
+
+	// Straight flights: the impact lies ahead on the flight line, within the projectile's radius.
+	const FVector ToImpact = FVector(Report.ImpactPoint) - Origin;
+	const float Slack = Shot.CollisionRadius + CVarGASCoreLagCompensationTolerance.GetValueOnGameThread();
+	if (Shot.bStraightFlight)
+	{
+		const double Along = ToImpact | Direction;
+		if (Along < -Slack || (ToImpact - Direction * Along).SizeSquared() > FMath::Square(Slack))
+		{
+			return false;
+		}
+	}
+
+	// Travel time: the client fired no earlier than the rewind window before the server saw the shot.
+	const double EarliestFire = Shot.ServerTime - MaxRewind;
+	if (Report.ServerTime < EarliestFire)
+	{
+		return false;
+	}
+	return Shot.Speed <= 0.f || ToImpact.Size() - Slack <= Shot.Speed * (Report.ServerTime - EarliestFire);
+}
+
+bool UGASCoreLagCompensationSubsystem::ValidateHit(const FGASCoreProjectileHitReport& Report, const FGASCoreProjectileShot& Shot) const
+{
+	if (!IsValid(Report.Target) || !ValidateShotPath(Report, Shot))
+	{
+		return false;
+	}
+
+	// Listen server host / standalone: nothing to rewind, test the target as it is now.
+	FVector Location;
+	float Radius = 0.f;
+	float HalfHeight = 0.f;
+	if (!GetRewoundLocation(Report.Target, Report.ServerTime, Location, Radius, HalfHeight))
+	{
+		if (NumFrames > 0)
+		{
+			return false;
+		}
+		Location = Report.Target->GetActorLocation();
+		Report.Target->GetSimpleCollisionCylinder(Radius, HalfHeight);
+	}
+
+	// Point vs. vertical capsule: distance to the core segment.
+	const float Tolerance = CVarGASCoreLagCompensationTolerance.GetValueOnGameThread();
+	const float SegmentHalf = FMath::Max(HalfHeight - Radius, 0.f);
+	const FVector SegmentA = Location - FVector(0.f, 0.f, SegmentHalf);
+	const FVector SegmentB = Location + FVector(0.f, 0.f, SegmentHalf);
+	const FVector Closest = FMath::ClosestPointOnSegment(FVector(Report.ImpactPoint), SegmentA, SegmentB);
+	return FVector::DistSquared(Closest, Report.ImpactPoint) <= FMath::Square(Radius + Tolerance);
+}
+
+TStatId UGASCoreLagCompensationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGASCoreLagCompensationSubsystem, STATGROUP_Tickables);
+}
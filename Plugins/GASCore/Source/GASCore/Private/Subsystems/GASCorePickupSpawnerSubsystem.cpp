@@ -0,0 +1,87 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCorePickupSpawnerSubsystem.h"
+
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Subsystems/GASCoreEffectActorPoolSubsystem.h"
+
+static TAutoConsoleVariable<int32> CVarGASCorePickupSpawnerMaxSpawnsPerFrame(
+	TEXT("GASCore.PickupSpawner.MaxSpawnsPerFrame"),
+	16,
+	TEXT("Due pickup respawns activated per frame; the rest wait for the next frame (spreads mass respawns)."),
+	ECVF_Default);
+
+UGASCorePickupSpawnerSubsystem* UGASCorePickupSpawnerSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCorePickupSpawnerSubsystem>() : nullptr;
+}
+
+int32 UGASCorePickupSpawnerSubsystem::ScheduleRespawn(const TSubclassOf<AGASCoreGameplayEffectActor> ActorClass, const FTransform& Transform,
+	const float Delay, const TArray<FGASCoreEffectConfig>* InGameplayEffects, const float InActorLevel)
+{
+	const UWorld* World = GetWorld();
+	if (!ActorClass || !World || World->GetNetMode() == NM_Client)
+	{
+		return INDEX_NONE;
+	}
+
+	FRespawn Respawn;
+	Respawn.Time = World->GetTimeSeconds() + FMath::Max(Delay, 0.f);
+	Respawn.Id = NextRespawnId++;
+	Respawn.ActorClass = ActorClass;
+	Respawn.Transform = Transform;
+	if (InGameplayEffects)
+	{
+		Respawn.GameplayEffects = *InGameplayEffects;
+	}
+	Respawn.ActorLevel = InActorLevel;
+
+	const int32 RespawnId = Respawn.Id;
+	Respawns.HeapPush(MoveTemp(Respawn), &UGASCorePickupSpawnerSubsystem::IsEarlier);
+	return RespawnId;
+}
+
+void UGASCorePickupSpawnerSubsystem::CancelRespawn(const int32 RespawnId)
+{
+	if (RespawnId != INDEX_NONE && Respawns.ContainsByPredicate([RespawnId](const FRespawn& Respawn) { return Respawn.Id == RespawnId; }))
+	{
+		CancelledIds.Add(RespawnId);
+	}
+}
+
+void UGASCorePickupSpawnerSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UGASCoreEffectActorPoolSubsystem* Pool = UGASCoreEffectActorPoolSubsystem::Get(this);
+	const double Now = GetWorld()->GetTimeSeconds();
+	int32 SpawnBudget = FMath::Max(CVarGASCorePickupSpawnerMaxSpawnsPerFrame.GetValueOnGameThread(), 1);
+
+	while (!Respawns.IsEmpty() && Respawns.HeapTop().Time <= Now && SpawnBudget > 0)
+	{
+		FRespawn Respawn;
+		Respawns.HeapPop(Respawn, &UGASCorePickupSpawnerSubsystem::IsEarlier, EAllowShrinking::No);
+		if (CancelledIds.Remove(Respawn.Id) > 0 || !Pool)
+		{
+			continue;
+		}
+
+		Pool->SpawnEffectActor(Respawn.ActorClass, Respawn.Transform, Respawn.GameplayEffects.GetPtrOrNull(), Respawn.ActorLevel);
+		--SpawnBudget;
+	}
+}
+
+void UGASCorePickupSpawnerSubsystem::Deinitialize()
+{
+	Respawns.Reset();
+	CancelledIds.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UGASCorePickupSpawnerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGASCorePickupSpawnerSubsystem, STATGROUP_Tickables);
+}
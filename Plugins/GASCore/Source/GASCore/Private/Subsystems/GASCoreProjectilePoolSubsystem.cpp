@@ -0,0 +1,156 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreProjectilePoolSubsystem.h"
+
+#include "Actors/GASCoreSpawnedActorByGameplayAbility.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarGASCoreProjectilePoolMaxPerClass(
+	TEXT("GASCore.ProjectilePool.MaxPerClass"),
+	64,
+	TEXT("Inactive ability projectiles kept per class for reuse; released projectiles beyond this are destroyed."),
+	ECVF_Default);
+
+UGASCoreProjectilePoolSubsystem* UGASCoreProjectilePoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreProjectilePoolSubsystem>() : nullptr;
+}
+
+AGASCoreSpawnedActorByGameplayAbility* UGASCoreProjectilePoolSubsystem::AcquireProjectile(
+	const TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> ProjectileClass, const FTransform& Transform, AActor* Owner, APawn* Instigator)
+{
+	const UWorld* World = GetWorld();
+	if (!ProjectileClass || !World || World->GetNetMode() == NM_Client)
+	{
+		return nullptr;
+	}
+
+	// Reuse: pooled actors may have been destroyed externally (streaming, level cleanup) in the meantime.
+	AGASCoreSpawnedActorByGameplayAbility* Projectile = nullptr;
+	if (FGASCoreProjectilePool* Pool = Pools.Find(ProjectileClass.Get()))
+	{
+		while (!Projectile && !Pool->Actors.IsEmpty())
+		{
+			AGASCoreSpawnedActorByGameplayAbility* Candidate = Pool->Actors.Pop(EAllowShrinking::No);
+			Projectile = IsValid(Candidate) ? Candidate : nullptr;
+		}
+	}
+
+	if (!Projectile)
+	{
+		Projectile = SpawnProjectile(ProjectileClass, Transform);
+		if (!Projectile)
+		{
+			return nullptr;
+		}
+	}
+
+	Projectile->ActivateFromPool(Transform, Owner, Instigator);
+	return Projectile;
+}
+
+int32 UGASCoreProjectilePoolSubsystem::AcquireProjectiles(const TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> ProjectileClass,
+	const TArrayView<const FTransform> Transforms, AActor* Owner, APawn* Instigator,
+	TArray<AGASCoreSpawnedActorByGameplayAbility*>& OutProjectiles)
+{
+	const UWorld* World = GetWorld();
+	if (!ProjectileClass || !World || World->GetNetMode() == NM_Client || Transforms.IsEmpty())
+	{
+		return 0;
+	}
+
+	OutProjectiles.Reserve(OutProjectiles.Num() + Transforms.Num());
+	FGASCoreProjectilePool* Pool = Pools.Find(ProjectileClass.Get());
+
+	int32 NumAcquired = 0;
+	for (const FTransform& Transform : Transforms)
+	{
+		AGASCoreSpawnedActorByGameplayAbility* Projectile = nullptr;
+		while (Pool && !Projectile && !Pool->Actors.IsEmpty())
+		{
+			AGASCoreSpawnedActorByGameplayAbility* Candidate = Pool->Actors.Pop(EAllowShrinking::No);
+			Projectile = IsValid(Candidate) ? Candidate : nullptr;
+		}
+
+		// Spawning runs BeginPlay, which may touch the pools (map reallocation): find the pool again afterwards.
+		if (!Projectile)
+		{
+			Projectile = SpawnProjectile(ProjectileClass, Transform);
+			Pool = Pools.Find(ProjectileClass.Get());
+			if (!Projectile)
+			{
+				continue;
+			}
+		}
+
+		Projectile->ActivateFromPool(Transform, Owner, Instigator);
+		OutProjectiles.Add(Projectile);
+		++NumAcquired;
+	}
+	return NumAcquired;
+}
+
+void UGASCoreProjectilePoolSubsystem::ReleaseProjectile(AGASCoreSpawnedActorByGameplayAbility* Projectile)
+{
+	if (!IsValid(Projectile) || Projectile->IsInPool() || !Projectile->HasAuthority())
+	{
+		return;
+	}
+
+	FGASCoreProjectilePool& Pool = Pools.FindOrAdd(Projectile->GetClass());
+	if (Pool.Actors.Num() >= CVarGASCoreProjectilePoolMaxPerClass.GetValueOnGameThread())
+	{
+		Projectile->Destroy();
+		return;
+	}
+
+	Projectile->DeactivateToPool();
+	Pool.Actors.Add(Projectile);
+}
+
+void UGASCoreProjectilePoolSubsystem::PrewarmProjectiles(const TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> ProjectileClass,
+	const int32 Count)
+{
+	const UWorld* World = GetWorld();
+	if (!ProjectileClass || !World || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	FGASCoreProjectilePool& Pool = Pools.FindOrAdd(ProjectileClass.Get());
+	const int32 Target = FMath::Min(Count, CVarGASCoreProjectilePoolMaxPerClass.GetValueOnGameThread());
+	Pool.Actors.Reserve(Target);
+	while (Pool.Actors.Num() < Target)
+	{
+		AGASCoreSpawnedActorByGameplayAbility* Projectile = SpawnProjectile(ProjectileClass, FTransform::Identity);
+		if (!Projectile)
+		{
+			return;
+		}
+		Projectile->DeactivateToPool();
+		Pool.Actors.Add(Projectile);
+	}
+}
+
+int32 UGASCoreProjectilePoolSubsystem::GetNumPooled(const TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> ProjectileClass) const
+{
+	const FGASCoreProjectilePool* Pool = Pools.Find(ProjectileClass.Get());
+	return Pool ? Pool->Actors.Num() : 0;
+}
+
+void UGASCoreProjectilePoolSubsystem::Deinitialize()
+{
+	Pools.Reset();
+
+	Super::Deinitialize();
+}
+
+AGASCoreSpawnedActorByGameplayAbility* UGASCoreProjectilePoolSubsystem::SpawnProjectile(
+	const TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> ProjectileClass, const FTransform& Transform) const
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	return GetWorld()->SpawnActor<AGASCoreSpawnedActorByGameplayAbility>(ProjectileClass, Transform, SpawnParameters);
+}
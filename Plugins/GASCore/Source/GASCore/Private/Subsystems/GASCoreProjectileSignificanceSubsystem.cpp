@@ -0,0 +1,143 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreProjectileSignificanceSubsystem.h"
+
+#include "Actors/GASCoreSpawnedActorByGameplayAbility.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarGASCoreProjectileSignificanceUpdateInterval(
+	TEXT("GASCore.ProjectileSignificance.UpdateInterval"),
+	0.1f,
+	TEXT("Seconds between projectile significance evaluations (0 = every frame)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreProjectileSignificanceNearDistance(
+	TEXT("GASCore.ProjectileSignificance.NearDistance"),
+	2500.f,
+	TEXT("Projectiles within this distance (cm) of any player view point are always significant."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreProjectileSignificanceFarDistance(
+	TEXT("GASCore.ProjectileSignificance.FarDistance"),
+	8000.f,
+	TEXT("Projectiles inside a player's view cone stay significant up to this distance (cm)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreProjectileSignificanceFOVMargin(
+	TEXT("GASCore.ProjectileSignificance.FOVMarginDegrees"),
+	15.f,
+	TEXT("Degrees added to the half FOV so projectiles just off screen (and about to enter it) keep full fidelity."),
+	ECVF_Default);
+
+UGASCoreProjectileSignificanceSubsystem* UGASCoreProjectileSignificanceSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreProjectileSignificanceSubsystem>() : nullptr;
+}
+
+void UGASCoreProjectileSignificanceSubsystem::RegisterProjectile(AGASCoreSpawnedActorByGameplayAbility* Projectile)
+{
+	if (IsValid(Projectile))
+	{
+		Projectiles.AddUnique(Projectile);
+	}
+}
+
+void UGASCoreProjectileSignificanceSubsystem::UnregisterProjectile(AGASCoreSpawnedActorByGameplayAbility* Projectile)
+{
+	Projectiles.RemoveSwap(Projectile, EAllowShrinking::No);
+}
+
+void UGASCoreProjectileSignificanceSubsystem::Tick(const float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGASCoreProjectileSignificanceSubsystem::Tick);
+
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate < CVarGASCoreProjectileSignificanceUpdateInterval.GetValueOnGameThread())
+	{
+		return;
+	}
+	TimeSinceUpdate = 0.f;
+
+	TArray<FViewPoint, TInlineAllocator<4>> Views;
+	GatherViewPoints(Views);
+
+	const float NearDistSq = FMath::Square(CVarGASCoreProjectileSignificanceNearDistance.GetValueOnGameThread());
+	const float FarDistSq = FMath::Square(CVarGASCoreProjectileSignificanceFarDistance.GetValueOnGameThread());
+
+	for (int32 Index = Projectiles.Num() - 1; Index >= 0; --Index)
+	{
+		AGASCoreSpawnedActorByGameplayAbility* Projectile = Projectiles[Index].Get();
+		if (!Projectile)
+		{
+			Projectiles.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+
+		// No view at all (server without players, loading): keep full fidelity rather than guess.
+		bool bSignificant = Views.IsEmpty();
+		const FVector Location = Projectile->GetActorLocation();
+		for (const FViewPoint& View : Views)
+		{
+			const FVector ToProjectile = Location - View.Location;
+			const float DistSq = ToProjectile.SizeSquared();
+			if (DistSq <= NearDistSq
+				|| (DistSq <= FarDistSq && FVector::DotProduct(ToProjectile, View.Forward) >= View.CosHalfFOV * FMath::Sqrt(DistSq)))
+			{
+				bSignificant = true;
+				break;
+			}
+		}
+
+		if (bSignificant != Projectile->IsSignificant())
+		{
+			Projectile->SetSignificant(bSignificant);
+		}
+	}
+}
+
+void UGASCoreProjectileSignificanceSubsystem::GatherViewPoints(TArray<FViewPoint, TInlineAllocator<4>>& OutViews) const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const float MarginDegrees = CVarGASCoreProjectileSignificanceFOVMargin.GetValueOnGameThread();
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!PC || (!PC->PlayerCameraManager && !PC->GetPawn()))
+		{
+			continue;
+		}
+
+		FVector Location;
+		FRotator Rotation;
+		PC->GetPlayerViewPoint(Location, Rotation);
+
+		const float FOV = PC->PlayerCameraManager ? PC->PlayerCameraManager->GetFOVAngle() : 90.f;
+		const float HalfAngle = FMath::Clamp(FOV * 0.5f + MarginDegrees, 0.f, 180.f);
+
+		FViewPoint& View = OutViews.AddDefaulted_GetRef();
+		View.Location = Location;
+		View.Forward = Rotation.Vector();
+		View.CosHalfFOV = FMath::Cos(FMath::DegreesToRadians(HalfAngle));
+	}
+}
+
+void UGASCoreProjectileSignificanceSubsystem::Deinitialize()
+{
+	Projectiles.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UGASCoreProjectileSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGASCoreProjectileSignificanceSubsystem, STATGROUP_Tickables);
+}
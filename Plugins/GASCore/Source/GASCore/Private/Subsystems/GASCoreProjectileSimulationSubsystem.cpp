@@ -0,0 +1,238 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreProjectileSimulationSubsystem.h"
+
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "Actors/GASCoreSpawnedActorByGameplayAbility.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "GASCoreStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Subsystems/GASCoreProjectilePoolSubsystem.h"
+#include "Utilities/GASCoreFrameBudget.h"
+
+// Below this many projectiles the ParallelFor dispatch costs more than the integration it spreads out.
+static TAutoConsoleVariable<int32> CVarGASCoreProjectileSimParallelThreshold(
+	TEXT("GASCore.ProjectileSim.ParallelThreshold"),
+	256,
+	TEXT("Minimum number of simulated projectiles before integration runs through ParallelFor (<= 0 disables)."),
+	ECVF_Default);
+
+UGASCoreProjectileSimulationSubsystem* UGASCoreProjectileSimulationSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreProjectileSimulationSubsystem>() : nullptr;
+}
+
+FGASCoreSimProjectileHandle UGASCoreProjectileSimulationSubsystem::Launch(const FGASCoreSimProjectileParams& Params)
+{
+	FGASCoreSimProjectileHandle Handle;
+	if (Params.Velocity.IsNearlyZero() || Params.LifeSpan <= 0.f)
+	{
+		return Handle;
+	}
+
+	Handle.Id = NextHandleId++;
+
+	const int32 Index = HandleIds.Add(Handle.Id);
+	Positions.Add(Params.Origin);
+	Velocities.Add(Params.Velocity);
+	Radii.Add(FMath::Max(Params.Radius, 0.f));
+	RemainingLife.Add(Params.LifeSpan);
+	TraceChannels.Add(Params.TraceChannel);
+	Owners.Add(Params.Owner);
+	EffectSpecs.Add(Params.EffectSpec);
+
+	PreviousPositions.Add(Params.Origin);
+	StepResults.Add(EStepResult::Continue);
+
+	IdToIndex.Add(Handle.Id, Index);
+	return Handle;
+}
+
+void UGASCoreProjectileSimulationSubsystem::Stop(FGASCoreSimProjectileHandle& Handle)
+{
+	const int32 Index = FindIndex(Handle);
+	if (Index != INDEX_NONE)
+	{
+		RemoveAt(Index);
+	}
+	Handle.Reset();
+}
+
+AGASCoreSpawnedActorByGameplayAbility* UGASCoreProjectileSimulationSubsystem::PromoteToActor(FGASCoreSimProjectileHandle& Handle,
+	const TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> ProjectileClass)
+{
+	const int32 Index = FindIndex(Handle);
+	UGASCoreProjectilePoolSubsystem* Pool = UGASCoreProjectilePoolSubsystem::Get(this);
+	if (Index == INDEX_NONE || !Pool)
+	{
+		return nullptr;
+	}
+
+	const FVector Velocity = Velocities[Index];
+	const FTransform Transform(Velocity.Rotation(), Positions[Index]);
+	AActor* Owner = Owners[Index].Get();
+
+	AGASCoreSpawnedActorByGameplayAbility* Projectile = Pool->AcquireProjectile(ProjectileClass, Transform, Owner, Cast<APawn>(Owner));
+	if (!Projectile)
+	{
+		return nullptr;
+	}
+
+	// Keep the simulated speed (the actor launches at its class InitialSpeed otherwise).
+	if (UProjectileMovementComponent* ProjectileMovement = Projectile->GetProjectileMovementComponent())
+	{
+		ProjectileMovement->Velocity = Velocity;
+		ProjectileMovement->UpdateComponentVelocity();
+	}
+
+	RemoveAt(Index);
+	Handle.Reset();
+	return Projectile;
+}
+
+bool UGASCoreProjectileSimulationSubsystem::GetProjectileLocation(const FGASCoreSimProjectileHandle& Handle, FVector& OutLocation) const
+{
+	const int32 Index = FindIndex(Handle);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+	OutLocation = Positions[Index];
+	return true;
+}
+
+void UGASCoreProjectileSimulationSubsystem::Deinitialize()
+{
+	// World teardown: drop everything silently (no impacts, no effects).
+	while (HandleIds.Num() > 0)
+	{
+		RemoveAt(HandleIds.Num() - 1);
+	}
+
+	Super::Deinitialize();
+}
+
+TStatId UGASCoreProjectileSimulationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGASCoreProjectileSimulationSubsystem, STATGROUP_Tickables);
+}
+
+void UGASCoreProjectileSimulationSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_GASCore_ProjectileSimTick);
+	GASCORE_FRAME_BUDGET_SCOPE(ProjectileUpdate);
+
+	const int32 NumProjectiles = Positions.Num();
+	SET_DWORD_STAT(STAT_GASCore_SimulatedProjectiles, NumProjectiles);
+	UWorld* World = GetWorld();
+	if (NumProjectiles == 0 || !World)
+	{
+		return;
+	}
+
+	// 1) Integrate: independent per projectile, so it parallelizes trivially once there are enough of them.
+	const int32 ParallelThreshold = CVarGASCoreProjectileSimParallelThreshold.GetValueOnGameThread();
+	const bool bSingleThreaded = ParallelThreshold <= 0 || NumProjectiles < ParallelThreshold;
+	ParallelFor(NumProjectiles, [this, DeltaTime](const int32 Index)
+	{
+		PreviousPositions[Index] = Positions[Index];
+		Positions[Index] += Velocities[Index] * DeltaTime;
+		RemainingLife[Index] -= DeltaTime;
+		StepResults[Index] = RemainingLife[Index] <= 0.f ? EStepResult::Expired : EStepResult::Continue;
+	}, bSingleThreaded);
+
+	// 2) Sweep (game thread): one pass over the dense arrays, simple collision only.
+	TArray<TPair<int32, FHitResult>, TInlineAllocator<8>> Impacts; // (handle id, hit)
+	TArray<int32, TInlineAllocator<8>> Expired;
+	for (int32 Index = 0; Index < NumProjectiles; ++Index)
+	{
+		if (StepResults[Index] == EStepResult::Expired)
+		{
+			Expired.Add(HandleIds[Index]);
+			continue;
+		}
+
+		const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(GASCoreProjectileSim), /*bTraceComplex=*/false, Owners[Index].Get());
+		FHitResult Hit;
+		if (World->SweepSingleByChannel(Hit, PreviousPositions[Index], Positions[Index], FQuat::Identity, TraceChannels[Index],
+			FCollisionShape::MakeSphere(Radii[Index]), QueryParams))
+		{
+			StepResults[Index] = EStepResult::Hit;
+			Impacts.Emplace(HandleIds[Index], MoveTemp(Hit));
+		}
+	}
+
+	// 3) Remove first, then resolve: impact callbacks may launch or stop projectiles.
+	for (const int32 HandleId : Expired)
+	{
+		RemoveAt(IdToIndex.FindChecked(HandleId));
+	}
+
+	const bool bApplyEffects = World->GetNetMode() != NM_Client;
+	TArray<TPair<FGameplayEffectSpecHandle, int32>, TInlineAllocator<8>> ImpactSpecs; // (spec, impact index)
+	for (int32 ImpactIndex = 0; ImpactIndex < Impacts.Num(); ++ImpactIndex)
+	{
+		const int32 Index = IdToIndex.FindChecked(Impacts[ImpactIndex].Key);
+		ImpactSpecs.Emplace(MoveTemp(EffectSpecs[Index]), ImpactIndex);
+		RemoveAt(Index);
+	}
+
+	for (const TPair<FGameplayEffectSpecHandle, int32>& ImpactSpec : ImpactSpecs)
+	{
+		FGASCoreSimProjectileHandle Handle;
+		Handle.Id = Impacts[ImpactSpec.Value].Key;
+		const FHitResult& Hit = Impacts[ImpactSpec.Value].Value;
+
+		if (bApplyEffects && ImpactSpec.Key.IsValid())
+		{
+			if (UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Hit.GetActor()))
+			{
+				TargetASC->ApplyGameplayEffectSpecToSelf(*ImpactSpec.Key.Data);
+			}
+		}
+		OnImpact.Broadcast(Handle, Hit);
+	}
+
+	// 4) Visuals read the surviving positions.
+	if (OnProjectilesMoved.IsBound() && HandleIds.Num() > 0)
+	{
+		OnProjectilesMoved.Broadcast(HandleIds, Positions);
+	}
+}
+
+int32 UGASCoreProjectileSimulationSubsystem::FindIndex(const FGASCoreSimProjectileHandle& Handle) const
+{
+	const int32* Index = Handle.IsValid() ? IdToIndex.Find(Handle.Id) : nullptr;
+	return Index ? *Index : INDEX_NONE;
+}
+
+void UGASCoreProjectileSimulationSubsystem::RemoveAt(const int32 Index)
+{
+	const int32 LastIndex = HandleIds.Num() - 1;
+	IdToIndex.Remove(HandleIds[Index]);
+
+	// The last slot moves into Index; repoint its handle before the swap.
+	if (Index != LastIndex)
+	{
+		IdToIndex[HandleIds[LastIndex]] = Index;
+	}
+
+	HandleIds.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Positions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Radii.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	RemainingLife.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TraceChannels.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Owners.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	EffectSpecs.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	PreviousPositions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StepResults.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
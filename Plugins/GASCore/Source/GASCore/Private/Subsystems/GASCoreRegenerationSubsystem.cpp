@@ -0,0 +1,149 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreRegenerationSubsystem.h"
+
+#include "AbilitySystem/Attributes/GASCoreAttributeSet.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarGASCoreRegenInterval(
+	TEXT("GASCore.Regen.Interval"),
+	0.25f,
+	TEXT("Seconds between native regeneration passes (UGASCoreRegenerationSubsystem). <= 0 integrates every frame."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreRegenCommitThreshold(
+	TEXT("GASCore.Regen.CommitThreshold"),
+	1.0f,
+	TEXT("Accumulated regeneration (attribute units) before a vital is written and replicated. ")
+	TEXT("Reaching 0 or Max always commits; whole-number vitals effectively commit per whole unit regardless."),
+	ECVF_Default);
+
+UGASCoreRegenerationSubsystem* UGASCoreRegenerationSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreRegenerationSubsystem>() : nullptr;
+}
+
+void UGASCoreRegenerationSubsystem::RegisterAttributeSet(UGASCoreAttributeSet* Set)
+{
+	const AActor* OwningActor = IsValid(Set) ? Set->GetOwningActor() : nullptr;
+	if (!OwningActor || !OwningActor->HasAuthority())
+	{
+		return;
+	}
+
+	const int32 NumRegenerations = Set->GetAttributeMetadata().Regenerations.Num();
+	UGASCoreRegenerationSubsystem* Subsystem = Get(Set);
+	if (!Subsystem || NumRegenerations == 0 || Subsystem->Sets.Contains(Set))
+	{
+		return;
+	}
+
+	Subsystem->Sets.Add(Set);
+	Subsystem->PendingOffsets.Add(Subsystem->Pending.AddZeroed(NumRegenerations));
+}
+
+void UGASCoreRegenerationSubsystem::UnregisterAttributeSet(const UGASCoreAttributeSet* Set)
+{
+	if (UGASCoreRegenerationSubsystem* Subsystem = Get(Set))
+	{
+		const int32 Index = Subsystem->Sets.IndexOfByKey(Set);
+		if (Index != INDEX_NONE)
+		{
+			Subsystem->RemoveAt(Index);
+		}
+	}
+}
+
+void UGASCoreRegenerationSubsystem::IntegrateRegeneration(const float Elapsed)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGASCoreRegenerationSubsystem::IntegrateRegeneration);
+
+	const float CommitThreshold = FMath::Max(CVarGASCoreRegenCommitThreshold.GetValueOnGameThread(), 0.f);
+
+	for (int32 SetIndex = Sets.Num() - 1; SetIndex >= 0; --SetIndex)
+	{
+		UGASCoreAttributeSet* Set = Sets[SetIndex].Get();
+		if (!Set)
+		{
+			RemoveAt(SetIndex);
+			continue;
+		}
+
+		const FGASCoreAttributeMetadata& Metadata = Set->GetAttributeMetadata();
+		float* SetPending = Pending.GetData() + PendingOffsets[SetIndex];
+		for (int32 Index = 0; Index < Metadata.Regenerations.Num(); ++Index)
+		{
+			const FGASCoreRegeneration& Regeneration = Metadata.Regenerations[Index];
+			const float Rate = Set->GetAttributeDataAt(Regeneration.RateOrdinal).GetCurrentValue();
+			const float Current = Set->GetAttributeDataAt(Regeneration.CurrentOrdinal).GetCurrentValue();
+
+			// Bound the rate moves toward: Max (and the static upper clamp) when regenerating, the lower clamp otherwise.
+			const FVector2f& ClampRange = Metadata.ClampRanges[Regeneration.CurrentOrdinal];
+			const int32 MaxOrdinal = Metadata.MaxOrdinals[Regeneration.CurrentOrdinal];
+			const float Bound = Rate > 0.f
+				? (MaxOrdinal != INDEX_NONE ? FMath::Min(ClampRange.Y, Set->GetAttributeDataAt(MaxOrdinal).GetCurrentValue()) : ClampRange.Y)
+				: ClampRange.X;
+
+			// Idle (no rate, or already at that bound): nothing accumulates while idle.
+			if (Rate == 0.f || (Rate > 0.f ? Current >= Bound : Current <= Bound))
+			{
+				SetPending[Index] = 0.f;
+				continue;
+			}
+
+			SetPending[Index] += Rate * Elapsed;
+			const float NewValue = Set->ClampAndRound(Regeneration.CurrentOrdinal, Current + SetPending[Index]);
+			const bool bReachedBound = Rate > 0.f ? NewValue >= Bound : NewValue <= Bound;
+			if ((FMath::Abs(SetPending[Index]) < CommitThreshold && !bReachedBound) || NewValue == Current)
+			{
+				continue;
+			}
+
+			// Keep the part rounding did not consume (whole-number vitals carry their fraction).
+			SetPending[Index] = bReachedBound ? 0.f : SetPending[Index] - (NewValue - Current);
+			Set->SetCurrentNumeric(Metadata.Attributes[Regeneration.CurrentOrdinal], NewValue);
+		}
+	}
+}
+
+void UGASCoreRegenerationSubsystem::RemoveAt(const int32 Index)
+{
+	const int32 Offset = PendingOffsets[Index];
+	const int32 Count = (Index + 1 < PendingOffsets.Num() ? PendingOffsets[Index + 1] : Pending.Num()) - Offset;
+
+	Pending.RemoveAt(Offset, Count, EAllowShrinking::No);
+	for (int32 Later = Index + 1; Later < PendingOffsets.Num(); ++Later)
+	{
+		PendingOffsets[Later] -= Count;
+	}
+	PendingOffsets.RemoveAt(Index, EAllowShrinking::No);
+	Sets.RemoveAt(Index, EAllowShrinking::No);
+}
+
+void UGASCoreRegenerationSubsystem::Deinitialize()
+{
+	Sets.Reset();
+	PendingOffsets.Reset();
+	Pending.Reset();
+	Super::Deinitialize();
+}
+
+void UGASCoreRegenerationSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TimeSinceIntegration += DeltaTime;
+	if (TimeSinceIntegration >= CVarGASCoreRegenInterval.GetValueOnGameThread())
+	{
+		IntegrateRegeneration(TimeSinceIntegration);
+		TimeSinceIntegration = 0.f;
+	}
+}
+
+TStatId UGASCoreRegenerationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGASCoreRegenerationSubsystem, STATGROUP_Tickables);
+}
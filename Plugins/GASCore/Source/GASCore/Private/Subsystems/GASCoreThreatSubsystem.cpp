@@ -0,0 +1,109 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreThreatSubsystem.h"
+
+#include "AbilitySystem/Components/GASCoreThreatComponent.h"
+#include "Engine/World.h"
+#include "GASCoreStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Subsystems/GASCoreCombatantRegistrySubsystem.h"
+
+static TAutoConsoleVariable<float> CVarGASCoreThreatUpdateInterval(
+	TEXT("GASCore.Threat.UpdateInterval"),
+	0.5f,
+	TEXT("Seconds between throttled threat evaluations of each enemy (decay, proximity aggro, target selection). ")
+	TEXT("Damage still re-evaluates the damaged enemy that frame. <= 0 evaluates every enemy every frame."),
+	ECVF_Default);
+
+UGASCoreThreatSubsystem* UGASCoreThreatSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreThreatSubsystem>() : nullptr;
+}
+
+void UGASCoreThreatSubsystem::RegisterComponent(UGASCoreThreatComponent* Component)
+{
+	if (IsValid(Component))
+	{
+		Components.AddUnique(Component);
+	}
+}
+
+void UGASCoreThreatSubsystem::UnregisterComponent(UGASCoreThreatComponent* Component)
+{
+	Components.RemoveSwap(Component, EAllowShrinking::No);
+	Requested.RemoveSwap(Component, EAllowShrinking::No);
+}
+
+void UGASCoreThreatSubsystem::RequestEvaluation(UGASCoreThreatComponent* Component)
+{
+	Requested.AddUnique(Component);
+}
+
+void UGASCoreThreatSubsystem::Evaluate(UGASCoreThreatComponent& Component, const double Now,
+	UGASCoreCombatantRegistrySubsystem* CombatantRegistry) const
+{
+	if (Component.IsActive())
+	{
+		Component.EvaluateThreat(static_cast<float>(Now - Component.GetLastEvaluationTime()), CombatantRegistry);
+	}
+}
+
+void UGASCoreThreatSubsystem::Tick(const float DeltaTime)
+{
+	GASCORE_TRACE_SCOPE(UGASCoreThreatSubsystem::Tick);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	UGASCoreCombatantRegistrySubsystem* CombatantRegistry = UGASCoreCombatantRegistrySubsystem::Get(this);
+
+	// Event driven first: the damaged enemies react this frame.
+	for (const TWeakObjectPtr<UGASCoreThreatComponent>& WeakComponent : Requested)
+	{
+		if (UGASCoreThreatComponent* Component = WeakComponent.Get())
+		{
+			Evaluate(*Component, Now, CombatantRegistry);
+		}
+	}
+	Requested.Reset();
+
+	// Throttled round-robin for decay and proximity aggro.
+	const float Interval = CVarGASCoreThreatUpdateInterval.GetValueOnGameThread();
+	PendingBudget += Interval > 0.f ? Components.Num() * DeltaTime / Interval : Components.Num();
+	int32 Budget = FMath::Min(FMath::FloorToInt32(PendingBudget), Components.Num());
+	PendingBudget = FMath::Min(PendingBudget - Budget, 1.f);
+
+	while (Budget-- > 0 && Components.Num() > 0)
+	{
+		if (Cursor >= Components.Num())
+		{
+			Cursor = 0;
+		}
+
+		UGASCoreThreatComponent* Component = Components[Cursor].Get();
+		if (!Component)
+		{
+			Components.RemoveAtSwap(Cursor, EAllowShrinking::No);
+			continue;
+		}
+
+		// Just evaluated for an event: no need to again this frame.
+		if (Component->GetLastEvaluationTime() < Now)
+		{
+			Evaluate(*Component, Now, CombatantRegistry);
+		}
+		++Cursor;
+	}
+}
+
+void UGASCoreThreatSubsystem::Deinitialize()
+{
+	Components.Reset();
+	Requested.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UGASCoreThreatSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGASCoreThreatSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,180 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+// Automation tests for GASCoreFormulas (Session Frontend / "Automation RunTests GASCore.Formulas").
+
+#include "AbilitySystem/Formulas/GASCoreAttributeFormulas.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GASCoreFormulasTest
+{
+	static FGASCorePrimaryAttributeValues MakePrimaries(const float Strength, const float Dexterity, const float Intelligence,
+		const float Endurance, const float Vigor)
+	{
+		FGASCorePrimaryAttributeValues P;
+		P.Strength = Strength;
+		P.Dexterity = Dexterity;
+		P.Intelligence = Intelligence;
+		P.Endurance = Endurance;
+		P.Vigor = Vigor;
+		return P;
+	}
+
+	static FString GetFormulaName(const EGASCoreSecondaryFormula Formula)
+	{
+		return StaticEnum<EGASCoreSecondaryFormula>()->GetNameStringByValue(static_cast<int64>(Formula));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASCoreFormulasGDDValuesTest, "GASCore.Formulas.GDDValues",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGASCoreFormulasGDDValuesTest::RunTest(const FString& Parameters)
+{
+	using namespace GASCoreFormulasTest;
+
+	// Hand-computed from docs/gdd/attribute_formulas.cpp with the default coefficients.
+	const FGASCoreFormulaCoefficients& C = FGASCoreFormulaCoefficients::GetDefault();
+	const FGASCorePrimaryAttributeValues P = MakePrimaries(/*Str*/10.f, /*Dex*/12.f, /*Int*/14.f, /*End*/8.f, /*Vig*/9.f);
+
+	const TPair<EGASCoreSecondaryFormula, float> Expected[] = {
+		{ EGASCoreSecondaryFormula::Armor,                 16.25f },
+		{ EGASCoreSecondaryFormula::ArmorPenetration,      5.85f },
+		{ EGASCoreSecondaryFormula::BlockChance,           3.25f },
+		{ EGASCoreSecondaryFormula::CriticalHitChance,     6.185f },
+		{ EGASCoreSecondaryFormula::CriticalHitDamage,     64.97f },
+		{ EGASCoreSecondaryFormula::CriticalHitResistance, 8.125f },
+		{ EGASCoreSecondaryFormula::Evasion,               8.f },
+		{ EGASCoreSecondaryFormula::MaxHealth,             140.f },
+		{ EGASCoreSecondaryFormula::HealthRegeneration,    5.f },
+		{ EGASCoreSecondaryFormula::MaxMana,               95.f },
+		{ EGASCoreSecondaryFormula::ManaRegeneration,      17.f },
+		{ EGASCoreSecondaryFormula::MaxStamina,            140.f },
+		{ EGASCoreSecondaryFormula::StaminaRegeneration,   5.f },
+	};
+	static_assert(UE_ARRAY_COUNT(Expected) == GASCoreFormulas::NumSecondaryFormulas, "Every formula needs an expected value");
+
+	for (const TPair<EGASCoreSecondaryFormula, float>& Pair : Expected)
+	{
+		TestNearlyEqual(GetFormulaName(Pair.Key), GASCoreFormulas::Evaluate(Pair.Key, P, C), Pair.Value, 1.e-3f);
+	}
+
+	// Clamps: block and crit chance cap out for very high stats.
+	const FGASCorePrimaryAttributeValues High = MakePrimaries(1000.f, 1000.f, 0.f, 1000.f, 0.f);
+	TestEqual(TEXT("BlockChance caps at BlockChanceMax"),
+		GASCoreFormulas::Evaluate(EGASCoreSecondaryFormula::BlockChance, High, C), C.BlockChanceMax);
+	TestEqual(TEXT("CriticalHitChance caps at CritChanceMax"),
+		GASCoreFormulas::Evaluate(EGASCoreSecondaryFormula::CriticalHitChance, High, C), C.CritChanceMax);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASCoreFormulasEvaluateAllTest, "GASCore.Formulas.EvaluateAllMatchesEvaluate",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGASCoreFormulasEvaluateAllTest::RunTest(const FString& Parameters)
+{
+	using namespace GASCoreFormulasTest;
+
+	const FGASCoreFormulaCoefficients& C = FGASCoreFormulaCoefficients::GetDefault();
+	const FGASCorePrimaryAttributeValues P = MakePrimaries(7.f, 21.f, 3.f, 15.f, 11.f);
+
+	float Values[GASCoreFormulas::NumSecondaryFormulas];
+	GASCoreFormulas::EvaluateAll(P, C, Values);
+
+	for (int32 Index = 0; Index < GASCoreFormulas::NumSecondaryFormulas; ++Index)
+	{
+		const EGASCoreSecondaryFormula Formula = static_cast<EGASCoreSecondaryFormula>(Index);
+		TestNearlyEqual(GetFormulaName(Formula), Values[Index], GASCoreFormulas::Evaluate(Formula, P, C), 1.e-4f);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASCoreFormulasBatchTest, "GASCore.Formulas.BatchMatchesScalar",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGASCoreFormulasBatchTest::RunTest(const FString& Parameters)
+{
+	using namespace GASCoreFormulasTest;
+
+	const FGASCoreFormulaCoefficients& C = FGASCoreFormulaCoefficients::GetDefault();
+
+	// Not a multiple of Lanes, so the padded tail is exercised too.
+	const FGASCorePrimaryAttributeValues Actors[] = {
+		MakePrimaries(10.f, 12.f, 14.f, 8.f, 9.f),
+		MakePrimaries(0.f, 0.f, 0.f, 0.f, 0.f),
+		MakePrimaries(1000.f, 1000.f, 1000.f, 1000.f, 1000.f),
+		MakePrimaries(3.f, 25.f, 17.f, 6.f, 31.f),
+		MakePrimaries(50.f, 1.f, 2.f, 40.f, 5.f),
+	};
+	const int32 NumActors = UE_ARRAY_COUNT(Actors);
+
+	FGASCoreFormulaBatch Batch;
+	Batch.Reset(NumActors);
+	TestEqual(TEXT("Batch.Num"), Batch.Num(), NumActors);
+	TestEqual(TEXT("Batch is padded to Lanes"), Batch.NumPadded() % FGASCoreFormulaBatch::Lanes, 0);
+
+	for (int32 Actor = 0; Actor < NumActors; ++Actor)
+	{
+		Batch.Primaries[GASCoreFormulas::Strength][Actor] = Actors[Actor].Strength;
+		Batch.Primaries[GASCoreFormulas::Dexterity][Actor] = Actors[Actor].Dexterity;
+		Batch.Primaries[GASCoreFormulas::Intelligence][Actor] = Actors[Actor].Intelligence;
+		Batch.Primaries[GASCoreFormulas::Endurance][Actor] = Actors[Actor].Endurance;
+		Batch.Primaries[GASCoreFormulas::Vigor][Actor] = Actors[Actor].Vigor;
+	}
+	GASCoreFormulas::EvaluateAllBatch(Batch, C);
+
+	for (int32 Actor = 0; Actor < NumActors; ++Actor)
+	{
+		float Expected[GASCoreFormulas::NumSecondaryFormulas];
+		GASCoreFormulas::EvaluateAll(Actors[Actor], C, Expected);
+
+		for (int32 Index = 0; Index < GASCoreFormulas::NumSecondaryFormulas; ++Index)
+		{
+			const EGASCoreSecondaryFormula Formula = static_cast<EGASCoreSecondaryFormula>(Index);
+			TestNearlyEqual(FString::Printf(TEXT("Actor %d %s"), Actor, *GetFormulaName(Formula)),
+				Batch.GetSecondary(Formula, Actor), Expected[Index], 1.e-3f);
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASCoreFormulasResolveDamageTest, "GASCore.Formulas.ResolveDamage",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGASCoreFormulasResolveDamageTest::RunTest(const FString& Parameters)
+{
+	const FGASCoreFormulaCoefficients& C = FGASCoreFormulaCoefficients::GetDefault();
+
+	GASCoreFormulas::FDamageInputs In;
+	In.BaseDamage = 100.f;
+	In.SourceArmorPenetration = 50.f;
+	In.SourceCriticalHitChance = 40.f;
+	In.SourceCriticalHitDamage = 150.f;
+	In.TargetArmor = 200.f;
+	In.TargetBlockChance = 20.f;
+	In.TargetCriticalHitResistance = 40.f;
+
+	// Effective armor 200 * 0.5 = 100 -> armor multiplier 100 / (100 + 100) = 0.5.
+	// Effective crit chance 40 - 40 * 0.25 = 30.
+	const GASCoreFormulas::FDamageResult Blocked = GASCoreFormulas::ResolveDamage(In, /*BlockRoll*/10.f, /*CritRoll*/0.f, C);
+	TestTrue(TEXT("Block roll under BlockChance blocks"), Blocked.bBlocked);
+	TestFalse(TEXT("Blocked hits never crit"), Blocked.bCriticalHit);
+	TestNearlyEqual(TEXT("Blocked damage"), Blocked.Damage, 100.f * C.BlockDamageMultiplier * 0.5f, 1.e-3f);
+
+	const GASCoreFormulas::FDamageResult Critical = GASCoreFormulas::ResolveDamage(In, /*BlockRoll*/50.f, /*CritRoll*/29.f, C);
+	TestFalse(TEXT("Block roll over BlockChance does not block"), Critical.bBlocked);
+	TestTrue(TEXT("Crit roll under effective chance crits"), Critical.bCriticalHit);
+	TestNearlyEqual(TEXT("Critical damage"), Critical.Damage, 100.f * 2.5f * 0.5f, 1.e-3f);
+
+	const GASCoreFormulas::FDamageResult Normal = GASCoreFormulas::ResolveDamage(In, /*BlockRoll*/50.f, /*CritRoll*/31.f, C);
+	TestFalse(TEXT("Crit roll over effective chance does not crit"), Normal.bCriticalHit);
+	TestNearlyEqual(TEXT("Normal damage"), Normal.Damage, 50.f, 1.e-3f);
+
+	In.BaseDamage = -10.f;
+	TestEqual(TEXT("Negative base damage clamps to zero"), GASCoreFormulas::ResolveDamage(In, 50.f, 50.f, C).Damage, 0.f);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,157 @@
+// Copyright DermanDanisman, Inc. All Rights Reserved.
+
+#include "GASCore/Public/Utilities/GASCoreAbilityLatency.h"
+
+#if GASCORE_ABILITY_LATENCY
+
+#include "GASCoreStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "UObject/ObjectKey.h"
+
+static TAutoConsoleVariable<bool> CVarGASCoreAbilityLatencyEnable(
+	TEXT("GASCore.AbilityLatency.Enable"),
+	true,
+	TEXT("Record input press -> activate / server confirm / first cue / end latencies per ability class."),
+	ECVF_Default);
+
+namespace GASCoreAbilityLatency
+{
+	namespace Private
+	{
+		static constexpr int32 NumSamples = 64;
+		static constexpr int32 NumPhases = static_cast<int32>(EPhase::Num);
+
+		/** Ring buffer of the latest samples of one phase. */
+		struct FRing
+		{
+			float Samples[NumSamples] = {};
+			int32 Count = 0;
+			int32 Next = 0;
+
+			void Add(const float Value)
+			{
+				Samples[Next] = Value;
+				Next = (Next + 1) % NumSamples;
+				Count = FMath::Min(Count + 1, NumSamples);
+			}
+		};
+
+		struct FClassHistory
+		{
+			FString ClassName;
+			FRing Phases[NumPhases];
+			int32 Rejected = 0;
+		};
+
+		static TMap<TObjectKey<UClass>, FClassHistory> Histories;
+
+		static FClassHistory& FindOrAddHistory(const UClass* AbilityClass)
+		{
+			FClassHistory& History = Histories.FindOrAdd(TObjectKey<UClass>(AbilityClass));
+			if (History.ClassName.IsEmpty())
+			{
+				History.ClassName = GetNameSafe(AbilityClass);
+			}
+			return History;
+		}
+
+		static const TCHAR* PhaseName(const EPhase Phase)
+		{
+			switch (Phase)
+			{
+			case EPhase::LocalActivate: return TEXT("Activate");
+			case EPhase::ServerConfirm: return TEXT("Confirm");
+			case EPhase::FirstCue:      return TEXT("Cue");
+			case EPhase::End:           return TEXT("End");
+			default:                    return TEXT("?");
+			}
+		}
+
+		/** Latest sample -> stat + CSV (per phase; the per-class breakdown is the dump). */
+		static void Publish(const EPhase Phase, const float Milliseconds)
+		{
+			switch (Phase)
+			{
+			case EPhase::LocalActivate:
+				SET_FLOAT_STAT(STAT_GASCore_AbilityLatencyActivate, Milliseconds);
+				CSV_CUSTOM_STAT(GASCoreAbilityLatency, ActivateMs, Milliseconds, ECsvCustomStatOp::Max);
+				break;
+			case EPhase::ServerConfirm:
+				SET_FLOAT_STAT(STAT_GASCore_AbilityLatencyConfirm, Milliseconds);
+				CSV_CUSTOM_STAT(GASCoreAbilityLatency, ConfirmMs, Milliseconds, ECsvCustomStatOp::Max);
+				break;
+			case EPhase::FirstCue:
+				SET_FLOAT_STAT(STAT_GASCore_AbilityLatencyCue, Milliseconds);
+				CSV_CUSTOM_STAT(GASCoreAbilityLatency, CueMs, Milliseconds, ECsvCustomStatOp::Max);
+				break;
+			case EPhase::End:
+				SET_FLOAT_STAT(STAT_GASCore_AbilityLatencyEnd, Milliseconds);
+				CSV_CUSTOM_STAT(GASCoreAbilityLatency, EndMs, Milliseconds, ECsvCustomStatOp::Max);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	bool IsEnabled()
+	{
+		return CVarGASCoreAbilityLatencyEnable.GetValueOnGameThread();
+	}
+
+	void Record(const UClass* AbilityClass, const EPhase Phase, const double Milliseconds)
+	{
+		check(IsInGameThread());
+		if (!AbilityClass || Phase >= EPhase::Num || !IsEnabled()) return;
+
+		const float Value = static_cast<float>(Milliseconds);
+		Private::FindOrAddHistory(AbilityClass).Phases[static_cast<int32>(Phase)].Add(Value);
+		Private::Publish(Phase, Value);
+	}
+
+	void RecordRejected(const UClass* AbilityClass)
+	{
+		check(IsInGameThread());
+		if (!AbilityClass || !IsEnabled()) return;
+
+		++Private::FindOrAddHistory(AbilityClass).Rejected;
+		INC_DWORD_STAT(STAT_GASCore_AbilityPredictionRejected);
+		CSV_CUSTOM_STAT(GASCoreAbilityLatency, Rejected, 1, ECsvCustomStatOp::Accumulate);
+	}
+}
+
+static FAutoConsoleCommandWithOutputDevice GASCoreAbilityLatencyDumpCommand(
+	TEXT("GASCore.AbilityLatency.Dump"),
+	TEXT("Print p50/p95/max latency (ms from input press) per ability class and phase over the latest samples."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+	{
+		using namespace GASCoreAbilityLatency;
+
+		for (const TPair<TObjectKey<UClass>, Private::FClassHistory>& Pair : Private::Histories)
+		{
+			const Private::FClassHistory& History = Pair.Value;
+			Ar.Logf(TEXT("%s (%d rejected predictions)"), *History.ClassName, History.Rejected);
+
+			for (int32 PhaseIndex = 0; PhaseIndex < Private::NumPhases; ++PhaseIndex)
+			{
+				const Private::FRing& Ring = History.Phases[PhaseIndex];
+				if (Ring.Count == 0) continue;
+
+				TArray<float, TInlineAllocator<Private::NumSamples>> Sorted(Ring.Samples, Ring.Count);
+				Sorted.Sort();
+				Ar.Logf(TEXT("  %-8s n=%2d  p50 %7.1f  p95 %7.1f  max %7.1f"),
+					Private::PhaseName(static_cast<EPhase>(PhaseIndex)), Ring.Count,
+					Sorted[(Ring.Count - 1) / 2], Sorted[(Ring.Count - 1) * 95 / 100], Sorted.Last());
+			}
+		}
+	}));
+
+static FAutoConsoleCommand GASCoreAbilityLatencyResetCommand(
+	TEXT("GASCore.AbilityLatency.Reset"),
+	TEXT("Clear the recorded ability activation latencies."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		GASCoreAbilityLatency::Private::Histories.Reset();
+	}));
+#endif
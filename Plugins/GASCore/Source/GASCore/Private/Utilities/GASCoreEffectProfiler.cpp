@@ -0,0 +1,250 @@
+// Copyright DermanDanisman, Inc. All Rights Reserved.
+
+#include "Utilities/GASCoreEffectProfiler.h"
+
+#if GASCORE_EFFECT_PROFILER
+
+#include "GameplayEffectTypes.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "UObject/ObjectKey.h"
+
+namespace GASCoreEffectProfiler
+{
+	bool bEnabled = false;
+
+	static FAutoConsoleVariableRef CVarEffectProfilerEnable(
+		TEXT("GASCore.EffectProfiler.Enable"),
+		bEnabled,
+		TEXT("Record per-GameplayEffect-class costs (spec creation, application, attribute callbacks). ")
+		TEXT("See GASCore.EffectProfiler.Dump / GASCore.EffectProfiler.Reset."),
+		ECVF_Default);
+
+	struct FKey
+	{
+		FObjectKey EffectClass;
+		FObjectKey SourceClass;
+
+		bool operator==(const FKey& Other) const { return EffectClass == Other.EffectClass && SourceClass == Other.SourceClass; }
+		friend uint32 GetTypeHash(const FKey& Key) { return HashCombineFast(GetTypeHash(Key.EffectClass), GetTypeHash(Key.SourceClass)); }
+	};
+
+	struct FBucket
+	{
+		// Names captured on first sample (classes may be gone by dump time).
+		FString EffectName;
+		FString SourceName;
+		uint64 Counts[static_cast<int32>(EGASCoreEffectCostPhase::Num)] = {};
+		double Microseconds[static_cast<int32>(EGASCoreEffectCostPhase::Num)] = {};
+
+		double TotalMicroseconds() const
+		{
+			double Total = 0.0;
+			for (const double Value : Microseconds)
+			{
+				Total += Value;
+			}
+			return Total;
+		}
+	};
+
+	static TMap<FKey, FBucket> Buckets;
+
+	struct FActiveEffect
+	{
+		const UClass* EffectClass = nullptr;
+		const UObject* Source = nullptr;
+	};
+	static TArray<FActiveEffect, TInlineAllocator<4>> ActiveEffects;
+
+	/** Per-ASC totals, and the targets of the open scopes (innermost last). */
+	static TMap<FObjectKey, FGASCoreAbilitySystemCost> AbilitySystemCosts;
+	static TArray<const UAbilitySystemComponent*, TInlineAllocator<4>> ActiveTargets;
+
+	static const TCHAR* PhaseNames[] = { TEXT("Spec"), TEXT("Execute"), TEXT("Aggregate"), TEXT("PreAttrChange"), TEXT("PostGEExecute") };
+	static_assert(UE_ARRAY_COUNT(PhaseNames) == static_cast<int32>(EGASCoreEffectCostPhase::Num), "Phase names out of sync");
+
+	const UObject* GetContextSource(const FGameplayEffectContextHandle& Context)
+	{
+		if (!Context.IsValid())
+		{
+			return nullptr;
+		}
+		if (const UObject* Causer = Context.GetEffectCauser())
+		{
+			return Causer;
+		}
+		if (const UObject* Instigator = Context.GetInstigator())
+		{
+			return Instigator;
+		}
+		return Context.GetSourceObject();
+	}
+
+	void Record(const EGASCoreEffectCostPhase Phase, const UClass* EffectClass, const UObject* Source, const double Microseconds)
+	{
+		if (!bEnabled || !IsInGameThread())
+		{
+			return;
+		}
+
+		const UClass* SourceClass = Source ? Source->GetClass() : nullptr;
+		FBucket& Bucket = Buckets.FindOrAdd(FKey{ FObjectKey(EffectClass), FObjectKey(SourceClass) });
+		if (Bucket.EffectName.IsEmpty())
+		{
+			Bucket.EffectName = EffectClass ? EffectClass->GetName() : TEXT("(none)");
+			Bucket.SourceName = SourceClass ? SourceClass->GetName() : TEXT("(none)");
+		}
+
+		const int32 PhaseIndex = static_cast<int32>(Phase);
+		++Bucket.Counts[PhaseIndex];
+		Bucket.Microseconds[PhaseIndex] += Microseconds;
+	}
+
+	void PushActiveEffect(const UClass* EffectClass, const UObject* Source)
+	{
+		if (IsInGameThread())
+		{
+			ActiveEffects.Add({ EffectClass, Source });
+		}
+	}
+
+	void PopActiveEffect()
+	{
+		if (IsInGameThread() && !ActiveEffects.IsEmpty())
+		{
+			ActiveEffects.Pop(EAllowShrinking::No);
+		}
+	}
+
+	void GetActiveEffect(const UClass*& OutEffectClass, const UObject*& OutSource)
+	{
+		const FActiveEffect Active = (IsInGameThread() && !ActiveEffects.IsEmpty()) ? ActiveEffects.Last() : FActiveEffect();
+		OutEffectClass = Active.EffectClass;
+		OutSource = Active.Source;
+	}
+
+	bool PushTarget(const UAbilitySystemComponent* Target)
+	{
+		if (!IsInGameThread())
+		{
+			return false;
+		}
+		const bool bCharge = Target && !ActiveTargets.Contains(Target);
+		ActiveTargets.Add(Target);
+		return bCharge;
+	}
+
+	void PopTarget(const UAbilitySystemComponent* Target, const bool bCharge, const double Microseconds)
+	{
+		if (!IsInGameThread() || ActiveTargets.IsEmpty())
+		{
+			return;
+		}
+		ActiveTargets.Pop(EAllowShrinking::No);
+		if (bCharge && bEnabled)
+		{
+			AbilitySystemCosts.FindOrAdd(FObjectKey(Target)).Microseconds += Microseconds;
+		}
+	}
+
+	void RecordAttributeChange(const UAbilitySystemComponent* Target)
+	{
+		if (bEnabled && Target && IsInGameThread())
+		{
+			++AbilitySystemCosts.FindOrAdd(FObjectKey(Target)).AttributeChanges;
+		}
+	}
+
+	void RecordAbilityActivation(const UAbilitySystemComponent* Target)
+	{
+		if (bEnabled && Target && IsInGameThread())
+		{
+			++AbilitySystemCosts.FindOrAdd(FObjectKey(Target)).AbilityActivations;
+		}
+	}
+
+	FGASCoreAbilitySystemCost GetAbilitySystemCost(const UAbilitySystemComponent* AbilitySystem)
+	{
+		const FGASCoreAbilitySystemCost* Cost = AbilitySystemCosts.Find(FObjectKey(AbilitySystem));
+		return Cost ? *Cost : FGASCoreAbilitySystemCost();
+	}
+
+	void RemoveAbilitySystem(const UAbilitySystemComponent* AbilitySystem)
+	{
+		if (IsInGameThread())
+		{
+			AbilitySystemCosts.Remove(FObjectKey(AbilitySystem));
+		}
+	}
+
+	void Reset()
+	{
+		Buckets.Reset();
+		AbilitySystemCosts.Reset();
+	}
+
+	void Dump(FOutputDevice& Ar, const int32 TopN, const bool bPerSource)
+	{
+		// Rows: one per bucket, or folded per GE class.
+		TArray<FBucket> Rows;
+		if (bPerSource)
+		{
+			Buckets.GenerateValueArray(Rows);
+		}
+		else
+		{
+			TMap<FString, FBucket> ByEffect;
+			for (const TPair<FKey, FBucket>& Pair : Buckets)
+			{
+				FBucket& Row = ByEffect.FindOrAdd(Pair.Value.EffectName);
+				Row.EffectName = Pair.Value.EffectName;
+				Row.SourceName = TEXT("*");
+				for (int32 Phase = 0; Phase < static_cast<int32>(EGASCoreEffectCostPhase::Num); ++Phase)
+				{
+					Row.Counts[Phase] += Pair.Value.Counts[Phase];
+					Row.Microseconds[Phase] += Pair.Value.Microseconds[Phase];
+				}
+			}
+			ByEffect.GenerateValueArray(Rows);
+		}
+
+		Rows.Sort([](const FBucket& A, const FBucket& B) { return A.TotalMicroseconds() > B.TotalMicroseconds(); });
+
+		FString Header = FString::Printf(TEXT("%-40s %-24s %12s"), TEXT("GameplayEffect"), TEXT("Source"), TEXT("Total us"));
+		for (const TCHAR* PhaseName : PhaseNames)
+		{
+			Header += FString::Printf(TEXT(" %22s"), *FString::Printf(TEXT("%s n/us"), PhaseName));
+		}
+		Ar.Logf(TEXT("GASCore effect profile (%d rows, top %d):"), Rows.Num(), TopN);
+		Ar.Logf(TEXT("%s"), *Header);
+
+		for (int32 Index = 0; Index < FMath::Min(TopN, Rows.Num()); ++Index)
+		{
+			const FBucket& Row = Rows[Index];
+			FString Line = FString::Printf(TEXT("%-40s %-24s %12.1f"), *Row.EffectName, *Row.SourceName, Row.TotalMicroseconds());
+			for (int32 Phase = 0; Phase < static_cast<int32>(EGASCoreEffectCostPhase::Num); ++Phase)
+			{
+				Line += FString::Printf(TEXT(" %22s"), *FString::Printf(TEXT("%llu/%.1f"), Row.Counts[Phase], Row.Microseconds[Phase]));
+			}
+			Ar.Logf(TEXT("%s"), *Line);
+		}
+	}
+
+	static FAutoConsoleCommandWithArgsAndOutputDevice DumpCommand(
+		TEXT("GASCore.EffectProfiler.Dump"),
+		TEXT("Print the top-N GameplayEffect classes by recorded cost. Args: [TopN=20] [sources]"),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, FOutputDevice& Ar)
+		{
+			const int32 TopN = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 20;
+			const bool bPerSource = Args.Num() > 1 && Args[1].Equals(TEXT("sources"), ESearchCase::IgnoreCase);
+			Dump(Ar, TopN, bPerSource);
+		}));
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("GASCore.EffectProfiler.Reset"),
+		TEXT("Clear the recorded GameplayEffect costs."),
+		FConsoleCommandDelegate::CreateStatic(&Reset));
+}
+
+#endif
@@ -0,0 +1,45 @@
+// Copyright DermanDanisman, Inc. All Rights Reserved.
+
+#include "GASCore/Public/Utilities/GASCoreEndOfFrame.h"
+
+#include "Misc/CoreDelegates.h"
+
+namespace GASCoreEndOfFrame
+{
+	namespace Private
+	{
+		struct FEntry
+		{
+			TWeakObjectPtr<UObject> Object;
+			FFlushFunction Flush = nullptr;
+		};
+
+		static TArray<FEntry> Pending;
+		static FDelegateHandle EndFrameHandle;
+
+		static void FlushAll()
+		{
+			// Callbacks may schedule again (they land in next frame's list).
+			TArray<FEntry> Entries = MoveTemp(Pending);
+			for (const FEntry& Entry : Entries)
+			{
+				if (UObject* Object = Entry.Object.Get())
+				{
+					Entry.Flush(Object);
+				}
+			}
+		}
+	}
+
+	void Schedule(UObject* Object, const FFlushFunction Flush)
+	{
+		check(IsInGameThread());
+		check(Object && Flush);
+
+		if (!Private::EndFrameHandle.IsValid())
+		{
+			Private::EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&Private::FlushAll);
+		}
+		Private::Pending.Add({ Object, Flush });
+	}
+}
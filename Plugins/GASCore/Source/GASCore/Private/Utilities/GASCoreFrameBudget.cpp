@@ -0,0 +1,63 @@
+// Copyright DermanDanisman, Inc. All Rights Reserved.
+
+#include "Utilities/GASCoreFrameBudget.h"
+
+#if GASCORE_FRAME_BUDGET
+
+#include "HAL/IConsoleManager.h"
+
+namespace GASCoreFrameBudget
+{
+	bool bEnabled = false;
+
+	static FAutoConsoleVariableRef CVarFrameBudgetEnable(
+		TEXT("GASCore.FrameBudget.Enable"),
+		bEnabled,
+		TEXT("Time the GASCore hot paths per frame (GE application, attribute callbacks, ability activation, ")
+		TEXT("projectile update, UI broadcasts) for frame budget dashboards (TD.Budget.Start)."),
+		ECVF_Default);
+
+	static constexpr int32 NumAreas = static_cast<int32>(EGASCoreFrameBudgetArea::Num);
+
+	static const TCHAR* AreaNames[] = { TEXT("GE Application"), TEXT("Attribute Callbacks"), TEXT("Ability Activation"),
+		TEXT("Projectile Update"), TEXT("UI Broadcasts") };
+	static_assert(UE_ARRAY_COUNT(AreaNames) == NumAreas, "Area names out of sync");
+
+	/** Area has a timed (outermost) scope open, and cycles accumulated since the last ConsumeFrame. */
+	static bool bOpen[NumAreas] = {};
+	static uint64 Cycles[NumAreas] = {};
+
+	const TCHAR* GetAreaName(const EGASCoreFrameBudgetArea Area)
+	{
+		return Area < EGASCoreFrameBudgetArea::Num ? AreaNames[static_cast<int32>(Area)] : TEXT("(invalid)");
+	}
+
+	bool Enter(const EGASCoreFrameBudgetArea Area)
+	{
+		bool& bAreaOpen = bOpen[static_cast<int32>(Area)];
+		if (bAreaOpen || !IsInGameThread())
+		{
+			return false;
+		}
+		bAreaOpen = true;
+		return true;
+	}
+
+	void Exit(const EGASCoreFrameBudgetArea Area, const uint64 ElapsedCycles)
+	{
+		const int32 Index = static_cast<int32>(Area);
+		bOpen[Index] = false;
+		Cycles[Index] += ElapsedCycles;
+	}
+
+	void ConsumeFrame(double (&OutMicroseconds)[NumAreas])
+	{
+		for (int32 Index = 0; Index < NumAreas; ++Index)
+		{
+			OutMicroseconds[Index] = FPlatformTime::ToMilliseconds64(Cycles[Index]) * 1000.0;
+			Cycles[Index] = 0;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,199 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Utilities/GASCoreMemoryReport.h"
+
+#if GASCORE_MEM_REPORT
+
+#include "AbilitySystemComponent.h"
+#include "EngineUtils.h"
+#include "GameplayEffect.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "AbilitySystem/Attributes/GASCoreAttributeMetadata.h"
+#include "AbilitySystem/Attributes/GASCoreAttributeSet.h"
+#include "AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
+#include "Actors/GASCoreGameplayEffectActor.h"
+#include "Subsystems/GASCoreAbilitySystemRegistrySubsystem.h"
+
+namespace GASCoreMemoryReport
+{
+	static TMap<FName, TFunction<SIZE_T(const UWorld&)>> Contributors;
+
+	/** Bytes of one ASC (or a sum of them) per category. */
+	struct FAbilitySystemBytes
+	{
+		SIZE_T ActiveEffects = 0;
+		SIZE_T Abilities = 0;
+		SIZE_T AttributeSets = 0;
+		SIZE_T Tags = 0;
+		SIZE_T Core = 0;
+		int32 Count = 0;
+
+		SIZE_T Total() const { return ActiveEffects + Abilities + AttributeSets + Tags + Core; }
+
+		void operator+=(const FAbilitySystemBytes& Other)
+		{
+			ActiveEffects += Other.ActiveEffects;
+			Abilities += Other.Abilities;
+			AttributeSets += Other.AttributeSets;
+			Tags += Other.Tags;
+			Core += Other.Core;
+			Count += Other.Count;
+		}
+	};
+
+	/** Object memory as memreport counts it (max: allocated, not just used). */
+	static SIZE_T CountObject(UObject* Object)
+	{
+		return Object ? static_cast<SIZE_T>(FArchiveCountMem(Object).GetMax()) : 0;
+	}
+
+	static FAbilitySystemBytes Measure(const UAbilitySystemComponent& AbilitySystem)
+	{
+		FAbilitySystemBytes Bytes;
+		Bytes.Count = 1;
+
+		for (const FActiveGameplayEffect& Effect : &AbilitySystem.GetActiveGameplayEffects())
+		{
+			const FGameplayEffectSpec& Spec = Effect.Spec;
+			Bytes.ActiveEffects += sizeof(FActiveGameplayEffect) + Spec.Modifiers.GetAllocatedSize()
+				+ Spec.ModifiedAttributes.GetAllocatedSize() + Spec.SetByCallerNameMagnitudes.GetAllocatedSize()
+				+ Spec.SetByCallerTagMagnitudes.GetAllocatedSize();
+		}
+
+		const TArray<FGameplayAbilitySpec>& Specs = AbilitySystem.GetActivatableAbilities();
+		Bytes.Abilities = Specs.GetAllocatedSize();
+		for (const FGameplayAbilitySpec& Spec : Specs)
+		{
+			for (UGameplayAbility* Instance : Spec.GetAbilityInstances())
+			{
+				Bytes.Abilities += CountObject(Instance);
+			}
+		}
+
+		for (UAttributeSet* Set : AbilitySystem.GetSpawnedAttributes())
+		{
+			Bytes.AttributeSets += CountObject(Set);
+			if (const UGASCoreAttributeSet* CoreSet = Cast<UGASCoreAttributeSet>(Set))
+			{
+				Bytes.AttributeSets += CoreSet->GetInstanceAllocatedSize();
+			}
+		}
+
+		// FGameplayTagCountContainer is private: one count-map element per owned tag and parent, plus the explicit map.
+		const FGameplayTagContainer& OwnedTags = AbilitySystem.GetOwnedGameplayTags();
+		const SIZE_T TagElementSize = sizeof(TSetElement<TPair<FGameplayTag, int32>>);
+		Bytes.Tags = (OwnedTags.Num() * 2 + OwnedTags.GetGameplayTagParents().Num()) * TagElementSize;
+
+		if (const UGASCoreAbilitySystemComponent* CoreAbilitySystem = Cast<UGASCoreAbilitySystemComponent>(&AbilitySystem))
+		{
+			Bytes.Core = CoreAbilitySystem->GetCoreAllocatedSize();
+		}
+		return Bytes;
+	}
+
+	static void LogRow(FOutputDevice& Ar, const FString& Name, const FAbilitySystemBytes& Bytes)
+	{
+		Ar.Logf(TEXT("%-48s %5d %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f"), *Name, Bytes.Count,
+			Bytes.ActiveEffects / 1024.0, Bytes.Abilities / 1024.0, Bytes.AttributeSets / 1024.0,
+			Bytes.Tags / 1024.0, Bytes.Core / 1024.0, Bytes.Total() / 1024.0);
+	}
+
+	void RegisterContributor(const FName Name, TFunction<SIZE_T(const UWorld& World)> Measure)
+	{
+		check(IsInGameThread());
+		Contributors.Add(Name, MoveTemp(Measure));
+	}
+
+	void UnregisterContributor(const FName Name)
+	{
+		check(IsInGameThread());
+		Contributors.Remove(Name);
+	}
+
+	void Dump(const UWorld& World, FOutputDevice& Ar, const bool bPerAbilitySystem)
+	{
+		check(IsInGameThread());
+
+		Ar.Logf(TEXT("GASCore memory report for %s (KB):"), *World.GetName());
+		Ar.Logf(TEXT("%-48s %5s %10s %10s %10s %10s %10s %10s"), TEXT("Ability systems"), TEXT("Num"),
+			TEXT("Effects"), TEXT("Abilities"), TEXT("Attributes"), TEXT("Tags"), TEXT("GASCore"), TEXT("Total"));
+
+		TMap<const UClass*, FAbilitySystemBytes> ByOwnerClass;
+		FAbilitySystemBytes AllAbilitySystems;
+		if (const UGASCoreAbilitySystemRegistrySubsystem* Registry = UGASCoreAbilitySystemRegistrySubsystem::Get(&World))
+		{
+			for (const TWeakObjectPtr<UAbilitySystemComponent>& WeakAbilitySystem : Registry->GetAbilitySystems())
+			{
+				const UAbilitySystemComponent* AbilitySystem = WeakAbilitySystem.Get();
+				if (!AbilitySystem)
+				{
+					continue;
+				}
+
+				const FAbilitySystemBytes Bytes = Measure(*AbilitySystem);
+				const AActor* Owner = AbilitySystem->GetOwner();
+				ByOwnerClass.FindOrAdd(Owner ? Owner->GetClass() : nullptr) += Bytes;
+				AllAbilitySystems += Bytes;
+				if (bPerAbilitySystem)
+				{
+					LogRow(Ar, FString::Printf(TEXT("  %s"), *GetNameSafe(Owner)), Bytes);
+				}
+			}
+		}
+
+		ByOwnerClass.ValueSort([](const FAbilitySystemBytes& A, const FAbilitySystemBytes& B) { return A.Total() > B.Total(); });
+		for (const TPair<const UClass*, FAbilitySystemBytes>& Pair : ByOwnerClass)
+		{
+			LogRow(Ar, GetNameSafe(Pair.Key), Pair.Value);
+		}
+		LogRow(Ar, TEXT("All"), AllAbilitySystems);
+
+		SIZE_T MetadataBytes = 0;
+		int32 NumTables = 0;
+		FGASCoreAttributeMetadata::ForEachTable([&MetadataBytes, &NumTables](const UClass&, const FGASCoreAttributeMetadata& Metadata)
+		{
+			MetadataBytes += sizeof(FGASCoreAttributeMetadata) + Metadata.GetAllocatedSize();
+			++NumTables;
+		});
+
+		SIZE_T EffectActorBytes = 0;
+		int32 NumEffectActors = 0;
+		for (TActorIterator<AGASCoreGameplayEffectActor> It(&World); It; ++It)
+		{
+			EffectActorBytes += It->GetTrackingAllocatedSize();
+			++NumEffectActors;
+		}
+
+		Ar.Logf(TEXT("Shared:"));
+		Ar.Logf(TEXT("  %-46s %5d %10.1f"), TEXT("Attribute metadata tables"), NumTables, MetadataBytes / 1024.0);
+		Ar.Logf(TEXT("  %-46s %5d %10.1f"), TEXT("Effect actor tracking"), NumEffectActors, EffectActorBytes / 1024.0);
+
+		SIZE_T TotalBytes = AllAbilitySystems.Total() + MetadataBytes + EffectActorBytes;
+		if (!Contributors.IsEmpty())
+		{
+			Ar.Logf(TEXT("Contributors:"));
+			for (const TPair<FName, TFunction<SIZE_T(const UWorld&)>>& Pair : Contributors)
+			{
+				const SIZE_T Bytes = Pair.Value(World);
+				TotalBytes += Bytes;
+				Ar.Logf(TEXT("  %-52s %10.1f"), *Pair.Key.ToString(), Bytes / 1024.0);
+			}
+		}
+		Ar.Logf(TEXT("Total: %.1f KB"), TotalBytes / 1024.0);
+	}
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice MemReportCommand(
+		TEXT("GASCore.MemReport"),
+		TEXT("Print GAS heap usage by owner class (ASC effects, abilities, attribute sets, tags), shared tables and registered contributors. -asc lists every ASC."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			if (World)
+			{
+				Dump(*World, Ar, Args.Contains(TEXT("-asc")));
+			}
+		}));
+}
+
+#endif
@@ -0,0 +1,136 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Utilities/GASCoreNativeTagBits.h"
+
+#include "Misc/ScopeRWLock.h"
+#include "Utilities/GASCoreLogging.h"
+
+namespace GASCoreNativeTagBits
+{
+	namespace Private
+	{
+		struct FRegistry
+		{
+			/** Registered tags; the index is the bit. */
+			TArray<FGameplayTag, TInlineAllocator<MaxTags>> Tags;
+
+			/** Resolved bits of every tag queried or registered so far. */
+			TMap<FGameplayTag, FGASCoreTagBits> Bits;
+
+			/** Guards Tags and Bits. */
+			FRWLock Lock;
+		};
+
+		static FRegistry& Get()
+		{
+			static FRegistry Registry;
+			return Registry;
+		}
+
+		/** Bits of Tag computed from the registered set (no cache). */
+		static FGASCoreTagBits Resolve(const FRegistry& Registry, const FGameplayTag& Tag)
+		{
+			FGASCoreTagBits Result;
+			for (int32 Index = 0; Index < Registry.Tags.Num(); ++Index)
+			{
+				const uint64 Bit = uint64(1) << Index;
+				if (Registry.Tags[Index] == Tag)
+				{
+					Result.Exact = Bit;
+				}
+				if (Tag.MatchesTag(Registry.Tags[Index]))
+				{
+					Result.Hierarchy |= Bit;
+				}
+			}
+			return Result;
+		}
+	}
+
+	uint64 Register(const FGameplayTag& Tag)
+	{
+		if (!Tag.IsValid())
+		{
+			return 0;
+		}
+
+		Private::FRegistry& Registry = Private::Get();
+		FWriteScopeLock WriteLock(Registry.Lock);
+		const int32 Existing = Registry.Tags.IndexOfByKey(Tag);
+		if (Existing != INDEX_NONE)
+		{
+			return uint64(1) << Existing;
+		}
+		if (Registry.Tags.Num() >= MaxTags)
+		{
+			GASCORE_LOG_ERROR(TEXT("GASCoreNativeTagBits: cannot register %s, all %d bits are in use."), *Tag.ToString(), MaxTags);
+			return 0;
+		}
+
+		const uint64 Bit = uint64(1) << Registry.Tags.Num();
+		Registry.Tags.Add(Tag);
+
+		// Cached descendants (and the tag itself) gain the new bit.
+		for (TPair<FGameplayTag, FGASCoreTagBits>& Pair : Registry.Bits)
+		{
+			if (Pair.Key.MatchesTag(Tag))
+			{
+				Pair.Value.Hierarchy |= Bit;
+			}
+		}
+		Registry.Bits.Add(Tag, Private::Resolve(Registry, Tag));
+		return Bit;
+	}
+
+	FGASCoreTagBits Get(const FGameplayTag& Tag)
+	{
+		if (!Tag.IsValid())
+		{
+			return FGASCoreTagBits();
+		}
+
+		Private::FRegistry& Registry = Private::Get();
+		{
+			FReadScopeLock ReadLock(Registry.Lock);
+			if (const FGASCoreTagBits* Cached = Registry.Bits.Find(Tag))
+			{
+				return *Cached;
+			}
+		}
+
+		// First query of Tag: another thread may have resolved it between the two locks.
+		FWriteScopeLock WriteLock(Registry.Lock);
+		if (const FGASCoreTagBits* Cached = Registry.Bits.Find(Tag))
+		{
+			return *Cached;
+		}
+		return Registry.Bits.Add(Tag, Private::Resolve(Registry, Tag));
+	}
+
+	uint64 MakeMask(const FGameplayTagContainer& Tags)
+	{
+		uint64 Mask = 0;
+		for (const FGameplayTag& Tag : Tags)
+		{
+			Mask |= Get(Tag).Exact;
+		}
+		return Mask;
+	}
+
+	uint64 MakeHierarchyMask(const FGameplayTagContainer& Tags)
+	{
+		uint64 Mask = 0;
+		for (const FGameplayTag& Tag : Tags)
+		{
+			Mask |= Get(Tag).Hierarchy;
+		}
+		return Mask;
+	}
+
+	int32 Num()
+	{
+		Private::FRegistry& Registry = Private::Get();
+		FReadScopeLock ReadLock(Registry.Lock);
+		return Registry.Tags.Num();
+	}
+}
@@ -0,0 +1,700 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Utilities/GASCoreNetBandwidth.h"
+
+#if GASCORE_NET_BANDWIDTH
+
+#include "AbilitySystem/Attributes/GASCoreAttributeSet.h"
+#include "AbilitySystemComponent.h"
+#include "Engine/ActorChannel.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "GASCoreStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/Paths.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "Net/UnrealNetwork.h"
+#include "Templates/UniquePtr.h"
+#include "Utilities/GASCoreLogging.h"
+
+namespace GASCoreNetBandwidth
+{
+	static bool bEnabled = false;
+
+	/** Bits charged per object reference (typical packed NetGUID). */
+	static constexpr uint32 ObjectReferenceBits = 32;
+
+	/** Bits charged per removed fast array item (its replication id). */
+	static constexpr uint32 RemovedItemBits = 32;
+
+	enum class ECategory : uint8
+	{
+		Attribute,
+		Field,
+		RPC,
+		MAX
+	};
+
+	static const TCHAR* GetCategoryName(const ECategory Category)
+	{
+		switch (Category)
+		{
+		case ECategory::Attribute: return TEXT("Attribute");
+		case ECategory::Field:     return TEXT("Field");
+		case ECategory::RPC:       return TEXT("RPC");
+		default:                   return TEXT("?");
+		}
+	}
+
+	// ---------------------------------------------------------------------------------------------------------------
+	// Measuring
+	// ---------------------------------------------------------------------------------------------------------------
+
+	/** Net bit writer that never touches the package map for object references (fixed NetGUID estimate instead). */
+	class FSizeWriter final : public FNetBitWriter
+	{
+	public:
+		explicit FSizeWriter(UPackageMap* InPackageMap)
+			: FNetBitWriter(InPackageMap, 0)
+		{
+			SetAllowResize(true);
+		}
+
+		using FNetBitWriter::operator<<;
+
+		virtual FArchive& operator<<(UObject*& Value) override { return WriteObjectReference(); }
+		virtual FArchive& operator<<(FObjectPtr& Value) override { return WriteObjectReference(); }
+		virtual FArchive& operator<<(FWeakObjectPtr& Value) override { return WriteObjectReference(); }
+		virtual FArchive& operator<<(FSoftObjectPtr& Value) override { return WriteObjectReference(); }
+		virtual FArchive& operator<<(FSoftObjectPath& Value) override { return WriteObjectReference(); }
+
+	private:
+		FArchive& WriteObjectReference()
+		{
+			uint32 Guid = 0;
+			SerializeBits(&Guid, ObjectReferenceBits);
+			return *this;
+		}
+	};
+
+	/**
+	 * Net-serialize one value of Property. Structs without a native NetSerialize replicate field by field (the
+	 * deprecated NetSerializeItem path would assert), arrays as a count plus their elements.
+	 */
+	static void SerializeValue(FArchive& Ar, UPackageMap* PackageMap, const FProperty* Property, void* Value)
+	{
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			if (!(StructProperty->Struct->StructFlags & STRUCT_NetSerializeNative))
+			{
+				for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+				{
+					if (It->HasAnyPropertyFlags(CPF_RepSkip))
+					{
+						continue;
+					}
+					for (int32 Index = 0; Index < It->ArrayDim; ++Index)
+					{
+						SerializeValue(Ar, PackageMap, *It, It->ContainerPtrToValuePtr<void>(Value, Index));
+					}
+				}
+				return;
+			}
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper Helper(ArrayProperty, Value);
+			uint16 Num = static_cast<uint16>(Helper.Num());
+			Ar << Num;
+			for (int32 Index = 0; Index < Helper.Num(); ++Index)
+			{
+				SerializeValue(Ar, PackageMap, ArrayProperty->Inner, Helper.GetRawPtr(Index));
+			}
+			return;
+		}
+
+		Property->NetSerializeItem(Ar, PackageMap, Value);
+	}
+
+	static int64 MeasureValue(UPackageMap* PackageMap, const FProperty* Property, void* Value)
+	{
+		FSizeWriter Writer(PackageMap);
+		SerializeValue(Writer, PackageMap, Property, Value);
+		return Writer.GetNumBits();
+	}
+
+	// ---------------------------------------------------------------------------------------------------------------
+	// Tracked properties (per class) and snapshots (per object)
+	// ---------------------------------------------------------------------------------------------------------------
+
+	struct FTrackedProperty
+	{
+		const FProperty* Property = nullptr;
+
+		/** Element of a static array property. */
+		int32 ArrayIndex = 0;
+
+		/** Lifetime condition (COND_Dynamic is resolved per update). */
+		ELifetimeCondition Condition = COND_None;
+
+		/** FFastArraySerializer items array (null = compared as a whole value). */
+		const FArrayProperty* FastArrayItems = nullptr;
+
+		/** "Class.Property" for attribute sets, "Property" for the ASC. */
+		FName Name;
+	};
+
+	struct FPropertySnapshot
+	{
+		const FProperty* Property = nullptr;
+
+		/** Copy of the value at the previous update (plain properties). */
+		void* Value = nullptr;
+
+		/** Fast arrays: replication key of the array and of every item (by replication id) at the previous update. */
+		int32 ArrayReplicationKey = INDEX_NONE;
+		TMap<int32, int32> ItemKeys;
+
+		FPropertySnapshot() = default;
+		FPropertySnapshot(const FPropertySnapshot&) = delete;
+		FPropertySnapshot& operator=(const FPropertySnapshot&) = delete;
+
+		~FPropertySnapshot()
+		{
+			if (Value)
+			{
+				Property->DestroyValue(Value);
+				FMemory::Free(Value);
+			}
+		}
+	};
+
+	struct FObjectSnapshot
+	{
+		/** One entry per tracked property of the class, same order. */
+		TArray<TUniquePtr<FPropertySnapshot>> Properties;
+	};
+
+	static TMap<const UClass*, TArray<FTrackedProperty>> TrackedPropertiesByClass;
+	/** Baselines by object (stale keys only cost memory until the next Reset; pooled owners keep theirs). */
+	static TMap<TObjectKey<UObject>, FObjectSnapshot> Snapshots;
+
+	static const TArray<FTrackedProperty>& GetTrackedProperties(const UObject& Object)
+	{
+		UClass* Class = Object.GetClass();
+		if (const TArray<FTrackedProperty>* Existing = TrackedPropertiesByClass.Find(Class))
+		{
+			return *Existing;
+		}
+
+		TArray<FTrackedProperty>& Tracked = TrackedPropertiesByClass.Add(Class);
+		Class->SetUpRuntimeReplicationData();
+
+		TArray<FLifetimeProperty> LifetimeProps;
+		Class->GetDefaultObject()->GetLifetimeReplicatedProps(LifetimeProps);
+
+		const bool bAttributeSet = Class->IsChildOf<UAttributeSet>();
+		for (const FLifetimeProperty& LifetimeProp : LifetimeProps)
+		{
+			if (!Class->ClassReps.IsValidIndex(LifetimeProp.RepIndex) || LifetimeProp.Condition == COND_Never)
+			{
+				continue;
+			}
+
+			const FRepRecord& Record = Class->ClassReps[LifetimeProp.RepIndex];
+			FTrackedProperty& Entry = Tracked.AddDefaulted_GetRef();
+			Entry.Property = Record.Property;
+			Entry.ArrayIndex = Record.Index;
+			Entry.Condition = LifetimeProp.Condition;
+
+			const FString PropertyName = Record.Property->ArrayDim > 1
+				? FString::Printf(TEXT("%s[%d]"), *Record.Property->GetName(), Record.Index)
+				: Record.Property->GetName();
+			Entry.Name = bAttributeSet
+				? FName(*FString::Printf(TEXT("%s%s.%s"), Class->GetPrefixCPP(), *Class->GetName(), *PropertyName))
+				: FName(*PropertyName);
+
+			const FStructProperty* StructProperty = CastField<FStructProperty>(Record.Property);
+			if (StructProperty && StructProperty->Struct->IsChildOf(FFastArraySerializer::StaticStruct()))
+			{
+				for (TFieldIterator<FArrayProperty> It(StructProperty->Struct); It; ++It)
+				{
+					const FStructProperty* Inner = CastField<FStructProperty>(It->Inner);
+					if (Inner && Inner->Struct->IsChildOf(FFastArraySerializerItem::StaticStruct()))
+					{
+						Entry.FastArrayItems = *It;
+						break;
+					}
+				}
+			}
+		}
+		return Tracked;
+	}
+
+	/** Condition of Entry on Object right now (dynamic attribute conditions come from the set). */
+	static ELifetimeCondition ResolveCondition(const UObject& Object, const FTrackedProperty& Entry)
+	{
+		if (Entry.Condition != COND_Dynamic)
+		{
+			return Entry.Condition;
+		}
+		if (const UGASCoreAttributeSet* CoreSet = Cast<UGASCoreAttributeSet>(&Object))
+		{
+			return CoreSet->GetAttributeReplicationCondition(FGameplayAttribute(const_cast<FProperty*>(Entry.Property)));
+		}
+		return COND_None;
+	}
+
+	/** Does a change replicate to the owning / a non-owning connection under Condition (deltas only: no initial-only). */
+	static bool IsSentTo(const ELifetimeCondition Condition, const bool bOwner)
+	{
+		switch (Condition)
+		{
+		case COND_Never:
+		case COND_InitialOnly:
+			return false;
+		case COND_OwnerOnly:
+		case COND_AutonomousOnly:
+		case COND_InitialOrOwner:
+		case COND_ReplayOrOwner:
+			return bOwner;
+		case COND_SkipOwner:
+		case COND_SimulatedOnly:
+		case COND_SimulatedOnlyNoReplay:
+		case COND_SimulatedOrPhysics:
+		case COND_SimulatedOrPhysicsNoReplay:
+			return !bOwner;
+		default:
+			return true;
+		}
+	}
+
+	// ---------------------------------------------------------------------------------------------------------------
+	// Session totals
+	// ---------------------------------------------------------------------------------------------------------------
+
+	struct FItemStats
+	{
+		int64 Sends = 0;
+		int64 Bits = 0;
+	};
+
+	struct FConnectionStats
+	{
+		TMap<FName, FItemStats> Items[static_cast<uint8>(ECategory::MAX)];
+		int64 CategoryBits[static_cast<uint8>(ECategory::MAX)] = {};
+
+		int64 GetTotalBits() const
+		{
+			int64 Total = 0;
+			for (const int64 Bits : CategoryBits)
+			{
+				Total += Bits;
+			}
+			return Total;
+		}
+	};
+
+	static TMap<FString, FConnectionStats> Connections;
+	static TMap<TObjectKey<UAbilitySystemComponent>, int64> AbilitySystemBits;
+	static double SessionStartTime = 0.0;
+
+	/** One receiving connection of the current record. */
+	struct FReceiver
+	{
+		UNetConnection* Connection = nullptr;
+		bool bOwner = false;
+	};
+
+	static FString GetConnectionLabel(UNetConnection& Connection)
+	{
+		const FString Address = Connection.LowLevelGetRemoteAddress(true);
+		const APlayerState* PlayerState = Connection.PlayerController ? Connection.PlayerController->PlayerState : nullptr;
+		return PlayerState ? FString::Printf(TEXT("%s (%s)"), *PlayerState->GetPlayerName(), *Address) : Address;
+	}
+
+	static void Charge(UNetConnection& Connection, const ECategory Category, const FName Name, const int64 Bits)
+	{
+		FConnectionStats& Stats = Connections.FindOrAdd(GetConnectionLabel(Connection));
+		FItemStats& Item = Stats.Items[static_cast<uint8>(Category)].FindOrAdd(Name);
+		++Item.Sends;
+		Item.Bits += Bits;
+		Stats.CategoryBits[static_cast<uint8>(Category)] += Bits;
+
+		switch (Category)
+		{
+		case ECategory::Attribute:
+			CSV_CUSTOM_STAT(GASCoreNetBandwidth, AttributeBits, static_cast<int32>(Bits), ECsvCustomStatOp::Accumulate);
+			break;
+		case ECategory::Field:
+			CSV_CUSTOM_STAT(GASCoreNetBandwidth, FieldBits, static_cast<int32>(Bits), ECsvCustomStatOp::Accumulate);
+			break;
+		default:
+			CSV_CUSTOM_STAT(GASCoreNetBandwidth, RPCBits, static_cast<int32>(Bits), ECsvCustomStatOp::Accumulate);
+			break;
+		}
+	}
+
+	/** Server connections with an open channel to Owner (whether each is the owning one). */
+	static void GatherChannelReceivers(AActor& Owner, TArray<FReceiver, TInlineAllocator<16>>& OutReceivers)
+	{
+		const UNetDriver* Driver = Owner.GetNetDriver();
+		if (!Driver)
+		{
+			return;
+		}
+
+		const UNetConnection* OwnerConnection = Owner.GetNetConnection();
+		for (UNetConnection* Connection : Driver->ClientConnections)
+		{
+			if (Connection && Connection->FindActorChannelRef(&Owner))
+			{
+				OutReceivers.Add({ Connection, Connection == OwnerConnection });
+			}
+		}
+	}
+
+	/** Bits of the changes of Entry since Snapshot (0 = unchanged); updates Snapshot. */
+	static int64 MeasureChange(UObject& Object, const FTrackedProperty& Entry, FPropertySnapshot& Snapshot, UPackageMap* PackageMap)
+	{
+		void* Value = Entry.Property->ContainerPtrToValuePtr<void>(&Object, Entry.ArrayIndex);
+
+		if (Entry.FastArrayItems)
+		{
+			const FFastArraySerializer& FastArray = *static_cast<const FFastArraySerializer*>(Value);
+			if (FastArray.ArrayReplicationKey == Snapshot.ArrayReplicationKey)
+			{
+				return 0;
+			}
+			Snapshot.ArrayReplicationKey = FastArray.ArrayReplicationKey;
+
+			int64 Bits = 0;
+			TMap<int32, int32> ItemKeys;
+			FScriptArrayHelper Helper(Entry.FastArrayItems, Entry.FastArrayItems->ContainerPtrToValuePtr<void>(Value));
+			ItemKeys.Reserve(Helper.Num());
+			for (int32 Index = 0; Index < Helper.Num(); ++Index)
+			{
+				const FFastArraySerializerItem& Item = *reinterpret_cast<const FFastArraySerializerItem*>(Helper.GetRawPtr(Index));
+				ItemKeys.Add(Item.ReplicationID, Item.ReplicationKey);
+
+				const int32* PreviousKey = Snapshot.ItemKeys.Find(Item.ReplicationID);
+				if (!PreviousKey || *PreviousKey != Item.ReplicationKey)
+				{
+					Bits += MeasureValue(PackageMap, Entry.FastArrayItems->Inner, Helper.GetRawPtr(Index));
+				}
+			}
+			for (const TPair<int32, int32>& Previous : Snapshot.ItemKeys)
+			{
+				if (!ItemKeys.Contains(Previous.Key))
+				{
+					Bits += RemovedItemBits;
+				}
+			}
+			Snapshot.ItemKeys = MoveTemp(ItemKeys);
+			return Bits;
+		}
+
+		if (Entry.Property->Identical(Snapshot.Value, Value))
+		{
+			return 0;
+		}
+		Entry.Property->CopySingleValue(Snapshot.Value, Value);
+		return MeasureValue(PackageMap, Entry.Property, Value);
+	}
+
+	/** Baseline of Entry for a newly seen object (its initial replication is not charged). */
+	static TUniquePtr<FPropertySnapshot> MakeSnapshot(UObject& Object, const FTrackedProperty& Entry)
+	{
+		TUniquePtr<FPropertySnapshot> Snapshot = MakeUnique<FPropertySnapshot>();
+		Snapshot->Property = Entry.Property;
+
+		void* Value = Entry.Property->ContainerPtrToValuePtr<void>(&Object, Entry.ArrayIndex);
+		if (Entry.FastArrayItems)
+		{
+			Snapshot->ArrayReplicationKey = static_cast<const FFastArraySerializer*>(Value)->ArrayReplicationKey;
+			FScriptArrayHelper Helper(Entry.FastArrayItems, Entry.FastArrayItems->ContainerPtrToValuePtr<void>(Value));
+			for (int32 Index = 0; Index < Helper.Num(); ++Index)
+			{
+				const FFastArraySerializerItem& Item = *reinterpret_cast<const FFastArraySerializerItem*>(Helper.GetRawPtr(Index));
+				Snapshot->ItemKeys.Add(Item.ReplicationID, Item.ReplicationKey);
+			}
+			return Snapshot;
+		}
+
+		Snapshot->Value = FMemory::Malloc(Entry.Property->GetSize(), Entry.Property->GetMinAlignment());
+		Entry.Property->InitializeValue(Snapshot->Value);
+		Entry.Property->CopySingleValue(Snapshot->Value, Value);
+		return Snapshot;
+	}
+
+	/** Returns the bits charged over all receivers. */
+	static int64 RecordObject(UObject& Object, const ECategory Category, TConstArrayView<FReceiver> Receivers)
+	{
+		const TArray<FTrackedProperty>& Tracked = GetTrackedProperties(Object);
+
+		FObjectSnapshot* Snapshot = Snapshots.Find(&Object);
+		if (!Snapshot)
+		{
+			FObjectSnapshot& NewSnapshot = Snapshots.Add(&Object);
+			NewSnapshot.Properties.Reserve(Tracked.Num());
+			for (const FTrackedProperty& Entry : Tracked)
+			{
+				NewSnapshot.Properties.Add(MakeSnapshot(Object, Entry));
+			}
+			return 0;
+		}
+
+		UPackageMap* PackageMap = Receivers[0].Connection->PackageMap;
+		int64 ChargedBits = 0;
+		for (int32 Index = 0; Index < Tracked.Num(); ++Index)
+		{
+			const FTrackedProperty& Entry = Tracked[Index];
+			const int64 Bits = MeasureChange(Object, Entry, *Snapshot->Properties[Index], PackageMap);
+			if (Bits == 0)
+			{
+				continue;
+			}
+
+			const ELifetimeCondition Condition = ResolveCondition(Object, Entry);
+			for (const FReceiver& Receiver : Receivers)
+			{
+				if (IsSentTo(Condition, Receiver.bOwner))
+				{
+					Charge(*Receiver.Connection, Category, Entry.Name, Bits);
+					ChargedBits += Bits;
+				}
+			}
+		}
+		return ChargedBits;
+	}
+
+	bool IsEnabled()
+	{
+		return bEnabled;
+	}
+
+	void RecordReplication(const UAbilitySystemComponent& AbilitySystem)
+	{
+		AActor* Owner = AbilitySystem.GetOwner();
+		if (!Owner || !Owner->HasAuthority())
+		{
+			return;
+		}
+
+		TArray<FReceiver, TInlineAllocator<16>> Receivers;
+		GatherChannelReceivers(*Owner, Receivers);
+		if (Receivers.IsEmpty())
+		{
+			return;
+		}
+
+		int64 ChargedBits = RecordObject(const_cast<UAbilitySystemComponent&>(AbilitySystem), ECategory::Field, Receivers);
+		for (UAttributeSet* Set : AbilitySystem.GetSpawnedAttributes())
+		{
+			if (Set)
+			{
+				ChargedBits += RecordObject(*Set, ECategory::Attribute, Receivers);
+			}
+		}
+		if (ChargedBits > 0)
+		{
+			AbilitySystemBits.FindOrAdd(&AbilitySystem) += ChargedBits;
+		}
+	}
+
+	void RecordRemoteFunction(const UAbilitySystemComponent& AbilitySystem, UFunction& Function, void* Parameters)
+	{
+		AActor* Owner = AbilitySystem.GetOwner();
+		if (!Owner)
+		{
+			return;
+		}
+
+		TArray<FReceiver, TInlineAllocator<16>> Receivers;
+		if (Function.HasAnyFunctionFlags(FUNC_NetMulticast))
+		{
+			if (Owner->GetNetMode() != NM_Client)
+			{
+				GatherChannelReceivers(*Owner, Receivers);
+			}
+		}
+		else if (UNetConnection* Connection = Owner->GetNetConnection())
+		{
+			Receivers.Add({ Connection, true });
+		}
+		if (Receivers.IsEmpty())
+		{
+			return;
+		}
+
+		FSizeWriter Writer(Receivers[0].Connection->PackageMap);
+		for (TFieldIterator<FProperty> It(&Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+		{
+			if (It->HasAnyPropertyFlags(CPF_ReturnParm))
+			{
+				continue;
+			}
+			for (int32 Index = 0; Index < It->ArrayDim; ++Index)
+			{
+				SerializeValue(Writer, Receivers[0].Connection->PackageMap, *It, It->ContainerPtrToValuePtr<void>(Parameters, Index));
+			}
+		}
+
+		for (const FReceiver& Receiver : Receivers)
+		{
+			Charge(*Receiver.Connection, ECategory::RPC, Function.GetFName(), Writer.GetNumBits());
+		}
+		AbilitySystemBits.FindOrAdd(&AbilitySystem) += static_cast<int64>(Writer.GetNumBits()) * Receivers.Num();
+	}
+
+	int64 GetAbilitySystemBits(const UAbilitySystemComponent& AbilitySystem)
+	{
+		const int64* Bits = AbilitySystemBits.Find(&AbilitySystem);
+		return Bits ? *Bits : 0;
+	}
+
+	void Reset()
+	{
+		Connections.Reset();
+		AbilitySystemBits.Reset();
+		Snapshots.Reset();
+		SessionStartTime = FPlatformTime::Seconds();
+	}
+
+	/** One (connection, item) row. */
+	struct FRow
+	{
+		const FString* Connection = nullptr;
+		ECategory Category = ECategory::Attribute;
+		FName Name;
+		FItemStats Stats;
+	};
+
+	static TArray<FRow> GetSortedRows(const FString& Connection, const FConnectionStats& Stats)
+	{
+		TArray<FRow> Rows;
+		for (uint8 Category = 0; Category < static_cast<uint8>(ECategory::MAX); ++Category)
+		{
+			for (const TPair<FName, FItemStats>& Item : Stats.Items[Category])
+			{
+				Rows.Add({ &Connection, static_cast<ECategory>(Category), Item.Key, Item.Value });
+			}
+		}
+		Rows.Sort([](const FRow& A, const FRow& B) { return A.Stats.Bits > B.Stats.Bits; });
+		return Rows;
+	}
+
+	static double GetSessionSeconds()
+	{
+		return FMath::Max(FPlatformTime::Seconds() - SessionStartTime, 1.0);
+	}
+
+	void Dump(FOutputDevice& Ar, const int32 TopN)
+	{
+		const double Seconds = GetSessionSeconds();
+
+		TArray<const TPair<FString, FConnectionStats>*> SortedConnections;
+		for (const TPair<FString, FConnectionStats>& Pair : Connections)
+		{
+			SortedConnections.Add(&Pair);
+		}
+		SortedConnections.Sort([](const TPair<FString, FConnectionStats>& A, const TPair<FString, FConnectionStats>& B)
+		{
+			return A.Value.GetTotalBits() > B.Value.GetTotalBits();
+		});
+
+		Ar.Logf(TEXT("GASCore net bandwidth (%d connections, %.0f s, payload bits, top %d per connection):"),
+			SortedConnections.Num(), Seconds, TopN);
+		for (const TPair<FString, FConnectionStats>* Pair : SortedConnections)
+		{
+			const FConnectionStats& Stats = Pair->Value;
+			Ar.Logf(TEXT("%s: %.2f kbit/s (attributes %.2f, fields %.2f, RPCs %.2f)"), *Pair->Key,
+				Stats.GetTotalBits() / Seconds / 1000.0,
+				Stats.CategoryBits[static_cast<uint8>(ECategory::Attribute)] / Seconds / 1000.0,
+				Stats.CategoryBits[static_cast<uint8>(ECategory::Field)] / Seconds / 1000.0,
+				Stats.CategoryBits[static_cast<uint8>(ECategory::RPC)] / Seconds / 1000.0);
+			Ar.Logf(TEXT("  %-10s %-60s %10s %12s %10s"), TEXT("Kind"), TEXT("Item"), TEXT("Sends"), TEXT("Bits"), TEXT("Bits/s"));
+
+			const TArray<FRow> Rows = GetSortedRows(Pair->Key, Stats);
+			for (int32 Index = 0; Index < FMath::Min(TopN, Rows.Num()); ++Index)
+			{
+				const FRow& Row = Rows[Index];
+				Ar.Logf(TEXT("  %-10s %-60s %10lld %12lld %10.1f"), GetCategoryName(Row.Category), *Row.Name.ToString(),
+					Row.Stats.Sends, Row.Stats.Bits, Row.Stats.Bits / Seconds);
+			}
+		}
+	}
+
+	FString WriteCsv()
+	{
+		const double Seconds = GetSessionSeconds();
+
+		FString Csv = TEXT("Connection,Kind,Item,Sends,Bits,BitsPerSecond\n");
+		for (const TPair<FString, FConnectionStats>& Pair : Connections)
+		{
+			for (const FRow& Row : GetSortedRows(Pair.Key, Pair.Value))
+			{
+				Csv += FString::Printf(TEXT("\"%s\",%s,%s,%lld,%lld,%.2f\n"), **Row.Connection, GetCategoryName(Row.Category),
+					*Row.Name.ToString(), Row.Stats.Sends, Row.Stats.Bits, Row.Stats.Bits / Seconds);
+			}
+		}
+
+		const FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Profiling"),
+			FString::Printf(TEXT("GASCoreNetBandwidth-%s.csv"), *FDateTime::Now().ToString()));
+		if (!FFileHelper::SaveStringToFile(Csv, *Path))
+		{
+			GASCORE_LOG_ERROR(TEXT("Failed to write net bandwidth report to [%s]."), *Path);
+			return FString();
+		}
+		return Path;
+	}
+
+	static void OnEnabledChanged(IConsoleVariable* /*Variable*/)
+	{
+		Reset();
+		if (!bEnabled)
+		{
+			TrackedPropertiesByClass.Reset();
+		}
+	}
+
+	static FAutoConsoleVariableRef CVarNetBandwidthEnable(
+		TEXT("GASCore.NetBandwidth.Enable"),
+		bEnabled,
+		TEXT("Account replicated attribute, ASC field and ASC RPC bits per connection. ")
+		TEXT("See GASCore.NetBandwidth.Dump / .Write / .Reset."),
+		FConsoleVariableDelegate::CreateStatic(&OnEnabledChanged),
+		ECVF_Default);
+
+	static FAutoConsoleCommandWithArgsAndOutputDevice DumpCommand(
+		TEXT("GASCore.NetBandwidth.Dump"),
+		TEXT("Print GAS bandwidth per connection and its most expensive attributes, fields and RPCs. Args: [TopN=20]"),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, FOutputDevice& Ar)
+		{
+			Dump(Ar, Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 20);
+		}));
+
+	static FAutoConsoleCommandWithOutputDevice WriteCommand(
+		TEXT("GASCore.NetBandwidth.Write"),
+		TEXT("Write the GAS bandwidth session (one row per connection and item) as CSV to Saved/Profiling."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+		{
+			const FString Path = WriteCsv();
+			if (!Path.IsEmpty())
+			{
+				Ar.Logf(TEXT("Wrote %s"), *Path);
+			}
+		}));
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("GASCore.NetBandwidth.Reset"),
+		TEXT("Restart the GAS bandwidth session."),
+		FConsoleCommandDelegate::CreateStatic(&Reset));
+}
+
+#endif
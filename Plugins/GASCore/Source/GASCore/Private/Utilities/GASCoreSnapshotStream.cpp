@@ -0,0 +1,875 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Utilities/GASCoreSnapshotStream.h"
+
+#if GASCORE_SNAPSHOT_STREAM
+
+#include "AbilitySystemComponent.h"
+#include "Common/TcpSocketBuilder.h"
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameplayEffect.h"
+#include "HAL/IConsoleManager.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Subsystems/GASCoreAbilitySystemRegistrySubsystem.h"
+#include "Utilities/GASCoreLogging.h"
+
+#include <atomic>
+
+namespace GASCoreSnapshotStream
+{
+	enum class EMessage : uint8
+	{
+		/** Server -> client: int32 count, { uint32 id, FString name }. */
+		Directory = 1,
+
+		/** Server -> client: one ASC's delta (see WriteSnapshot). */
+		Snapshot = 2,
+
+		/** Client -> server: int32 count, { uint32 id }. */
+		Select = 10,
+	};
+
+	/** Larger messages are treated as a broken stream. */
+	static constexpr uint32 MaxMessageSize = 4 << 20;
+
+	/** A client that lets this much pile up is dropped. */
+	static constexpr int32 MaxPendingSendBytes = 8 << 20;
+
+	/** Most ASCs one client can select (larger selections are malformed). */
+	static constexpr int32 MaxSelectedIds = 1024;
+
+	/** Seconds a client waits for the TCP handshake. */
+	static constexpr double ConnectTimeout = 5.0;
+
+	// ---------------------------------------------------------------------------------------------------------------
+	// Framing (shared by server and client)
+	// ---------------------------------------------------------------------------------------------------------------
+
+	static void QueueMessage(TArray<uint8>& SendBuffer, TArray<uint8>& Payload)
+	{
+		uint32 Size = Payload.Num();
+		FMemoryWriter Writer(SendBuffer, false, true);
+		Writer << Size;
+		SendBuffer.Append(Payload);
+	}
+
+	/** Send what the socket takes. False when the connection failed. */
+	static bool FlushSendBuffer(FSocket& Socket, TArray<uint8>& SendBuffer)
+	{
+		while (SendBuffer.Num() > 0)
+		{
+			int32 BytesSent = 0;
+			if (!Socket.Send(SendBuffer.GetData(), SendBuffer.Num(), BytesSent))
+			{
+				return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() == SE_EWOULDBLOCK;
+			}
+			if (BytesSent <= 0)
+			{
+				return true;
+			}
+			SendBuffer.RemoveAt(0, BytesSent, EAllowShrinking::No);
+		}
+		return true;
+	}
+
+	/** Append everything the socket has. False when the peer closed the connection or it failed. */
+	static bool ReceiveAvailable(FSocket& Socket, TArray<uint8>& ReceiveBuffer)
+	{
+		uint8 Chunk[4096];
+		while (true)
+		{
+			int32 BytesRead = 0;
+			if (!Socket.Recv(Chunk, sizeof(Chunk), BytesRead))
+			{
+				return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() == SE_EWOULDBLOCK;
+			}
+			if (BytesRead == 0)
+			{
+				return false;
+			}
+			ReceiveBuffer.Append(Chunk, BytesRead);
+		}
+	}
+
+	/** Pop one complete payload off ReceiveBuffer. False when none is complete; bOutMalformed on an oversized frame. */
+	static bool PopMessage(TArray<uint8>& ReceiveBuffer, TArray<uint8>& OutPayload, bool& bOutMalformed)
+	{
+		bOutMalformed = false;
+		if (ReceiveBuffer.Num() < static_cast<int32>(sizeof(uint32)))
+		{
+			return false;
+		}
+
+		uint32 Size = 0;
+		FMemoryReader Reader(ReceiveBuffer);
+		Reader << Size;
+		if (Size > MaxMessageSize)
+		{
+			bOutMalformed = true;
+			return false;
+		}
+		if (ReceiveBuffer.Num() < static_cast<int32>(sizeof(uint32) + Size))
+		{
+			return false;
+		}
+
+		OutPayload.Reset();
+		OutPayload.Append(ReceiveBuffer.GetData() + sizeof(uint32), Size);
+		ReceiveBuffer.RemoveAt(0, sizeof(uint32) + Size, EAllowShrinking::No);
+		return true;
+	}
+
+	static void DestroySocket(FSocket*& Socket)
+	{
+		if (Socket)
+		{
+			Socket->Close();
+			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+			Socket = nullptr;
+		}
+	}
+
+	// ---------------------------------------------------------------------------------------------------------------
+	// Server
+	// ---------------------------------------------------------------------------------------------------------------
+
+	static int32 Port = 0;
+
+	static FString BindAddress = TEXT("127.0.0.1");
+
+	static FAutoConsoleVariableRef CVarBindAddress(
+		TEXT("GASCore.SnapshotStream.BindAddress"),
+		BindAddress,
+		TEXT("IPv4 address the ASC snapshot stream listens on (default loopback only; 0.0.0.0 for every interface). ")
+		TEXT("Applied when the port is (re)set."),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarRate(
+		TEXT("GASCore.SnapshotStream.Rate"),
+		4.f,
+		TEXT("Snapshots per second sent to each snapshot stream client."),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<int32> CVarMaxClients(
+		TEXT("GASCore.SnapshotStream.MaxClients"),
+		4,
+		TEXT("Snapshot stream clients accepted at once."),
+		ECVF_Default);
+
+	/** What one client has of one selected ASC (the next snapshot is the difference). */
+	struct FSentState
+	{
+		bool bSent = false;
+		int32 NumAttributeSets = INDEX_NONE;
+		TArray<FGameplayAttribute> Attributes;
+		TArray<float> Values;
+		TMap<FGameplayTag, int32> Tags;
+
+		/** Handle id -> (stack count, end time). */
+		TMap<int32, TPair<int32, float>> Effects;
+	};
+
+	struct FClient
+	{
+		FSocket* Socket = nullptr;
+		TArray<uint8> ReceiveBuffer;
+		TArray<uint8> SendBuffer;
+		TMap<uint32, FSentState> Selected;
+
+		/** Hash of the directory the client has (0 = none yet). */
+		uint32 DirectoryHash = 0;
+	};
+
+	static FSocket* ListenSocket = nullptr;
+	static TArray<TUniquePtr<FClient>> Clients;
+	static FTSTicker::FDelegateHandle TickerHandle;
+	static double NextSendTime = 0.0;
+	static int32 ListeningPort = 0;
+	static FString ListeningAddress;
+
+	static void StopServer()
+	{
+		for (TUniquePtr<FClient>& Client : Clients)
+		{
+			DestroySocket(Client->Socket);
+		}
+		Clients.Reset();
+		DestroySocket(ListenSocket);
+		ListeningPort = 0;
+	}
+
+	static bool EnsureListening()
+	{
+		if (ListenSocket && ListeningPort == Port && ListeningAddress == BindAddress)
+		{
+			return true;
+		}
+		StopServer();
+
+		FIPv4Address Address;
+		if (!FIPv4Address::Parse(BindAddress, Address))
+		{
+			GASCORE_LOG_ERROR(TEXT("GASCoreSnapshotStream: GASCore.SnapshotStream.BindAddress '%s' is not an IPv4 address."), *BindAddress);
+			Port = 0;
+			return false;
+		}
+
+		ListenSocket = FTcpSocketBuilder(TEXT("GASCoreSnapshotStream"))
+			.AsNonBlocking()
+			.AsReusable()
+			.BoundToAddress(Address)
+			.BoundToPort(Port)
+			.Listening(8)
+			.Build();
+		if (!ListenSocket)
+		{
+			GASCORE_LOG_ERROR(TEXT("GASCoreSnapshotStream: cannot listen on %s:%d; set GASCore.SnapshotStream.Port again to retry."), *BindAddress, Port);
+			Port = 0;
+			return false;
+		}
+
+		ListeningPort = Port;
+		ListeningAddress = BindAddress;
+		GASCORE_LOG_LOG(TEXT("GASCoreSnapshotStream: listening on %s:%d."), *BindAddress, Port);
+		return true;
+	}
+
+	static void AcceptClients()
+	{
+		bool bPending = false;
+		while (ListenSocket->HasPendingConnection(bPending) && bPending)
+		{
+			FSocket* Socket = ListenSocket->Accept(TEXT("GASCoreSnapshotStreamClient"));
+			if (!Socket)
+			{
+				break;
+			}
+			if (Clients.Num() >= FMath::Max(CVarMaxClients.GetValueOnGameThread(), 1))
+			{
+				GASCORE_LOG_WARNING(TEXT("GASCoreSnapshotStream: refused a client, GASCore.SnapshotStream.MaxClients reached."));
+				DestroySocket(Socket);
+				continue;
+			}
+
+			Socket->SetNonBlocking(true);
+			TUniquePtr<FClient>& Client = Clients.Add_GetRef(MakeUnique<FClient>());
+			Client->Socket = Socket;
+		}
+	}
+
+	/** Every ASC of the authoritative game worlds, by object id. */
+	static void GatherComponents(TMap<uint32, UAbilitySystemComponent*>& OutComponents)
+	{
+		if (!GEngine)
+		{
+			return;
+		}
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			const UWorld* World = Context.World();
+			if (!World || !World->IsGameWorld() || World->GetNetMode() == NM_Client)
+			{
+				continue;
+			}
+			if (const UGASCoreAbilitySystemRegistrySubsystem* Registry = UGASCoreAbilitySystemRegistrySubsystem::Get(World))
+			{
+				for (const TWeakObjectPtr<UAbilitySystemComponent>& Entry : Registry->GetAbilitySystems())
+				{
+					if (UAbilitySystemComponent* AbilitySystem = Entry.Get())
+					{
+						OutComponents.Add(AbilitySystem->GetUniqueID(), AbilitySystem);
+					}
+				}
+			}
+		}
+	}
+
+	static FString GetComponentName(const UAbilitySystemComponent& AbilitySystem)
+	{
+		const AActor* Actor = AbilitySystem.GetAvatarActor_Direct() ? AbilitySystem.GetAvatarActor_Direct() : AbilitySystem.GetOwner();
+		return GetNameSafe(Actor);
+	}
+
+	static void WriteDirectory(TArray<uint8>& OutPayload, const TMap<uint32, UAbilitySystemComponent*>& Components)
+	{
+		FMemoryWriter Writer(OutPayload);
+		uint8 Type = static_cast<uint8>(EMessage::Directory);
+		int32 Num = Components.Num();
+		Writer << Type << Num;
+		for (const TPair<uint32, UAbilitySystemComponent*>& Pair : Components)
+		{
+			uint32 Id = Pair.Key;
+			FString Name = GetComponentName(*Pair.Value);
+			Writer << Id << Name;
+		}
+	}
+
+	/**
+	 * Snapshot payload:
+	 *   uint8 type, uint32 id, double server time, bool reset, bool full attributes,
+	 *   full: int32 n { FString name, float value } | delta: int32 n { int32 index, float value },
+	 *   int32 n { FString tag, int32 count }, int32 n { FString removed tag },
+	 *   int32 n { int32 handle, FString name, int32 stacks, float end time }, int32 n { int32 removed handle }.
+	 * False (nothing written) when the client is up to date.
+	 */
+	static bool WriteSnapshot(TArray<uint8>& OutPayload, uint32 Id, UAbilitySystemComponent& AbilitySystem, FSentState& Sent)
+	{
+		bool bReset = !Sent.bSent;
+		bool bFullAttributes = bReset || Sent.NumAttributeSets != AbilitySystem.GetSpawnedAttributes().Num();
+
+		// Attributes
+		TArray<TPair<int32, float>> ChangedAttributes;
+		if (bFullAttributes)
+		{
+			Sent.NumAttributeSets = AbilitySystem.GetSpawnedAttributes().Num();
+			Sent.Attributes.Reset();
+			AbilitySystem.GetAllAttributes(Sent.Attributes);
+			Sent.Values.SetNum(Sent.Attributes.Num());
+			for (int32 Index = 0; Index < Sent.Attributes.Num(); ++Index)
+			{
+				Sent.Values[Index] = AbilitySystem.GetNumericAttribute(Sent.Attributes[Index]);
+			}
+		}
+		else
+		{
+			for (int32 Index = 0; Index < Sent.Attributes.Num(); ++Index)
+			{
+				const float Value = AbilitySystem.GetNumericAttribute(Sent.Attributes[Index]);
+				if (Value != Sent.Values[Index])
+				{
+					Sent.Values[Index] = Value;
+					ChangedAttributes.Emplace(Index, Value);
+				}
+			}
+		}
+
+		// Tags
+		FGameplayTagContainer OwnedTags;
+		AbilitySystem.GetOwnedGameplayTags(OwnedTags);
+		TArray<TPair<FString, int32>> ChangedTags;
+		TArray<FString> RemovedTags;
+		for (const FGameplayTag& Tag : OwnedTags)
+		{
+			const int32 Count = AbilitySystem.GetTagCount(Tag);
+			const int32* SentCount = Sent.Tags.Find(Tag);
+			if (!SentCount || *SentCount != Count)
+			{
+				Sent.Tags.Add(Tag, Count);
+				ChangedTags.Emplace(Tag.ToString(), Count);
+			}
+		}
+		for (auto It = Sent.Tags.CreateIterator(); It; ++It)
+		{
+			if (!OwnedTags.HasTagExact(It->Key))
+			{
+				RemovedTags.Add(It->Key.ToString());
+				It.RemoveCurrent();
+			}
+		}
+
+		// Effects
+		struct FEffectRow
+		{
+			int32 Handle;
+			FString Name;
+			int32 StackCount;
+			float EndTime;
+		};
+		TArray<FEffectRow> ChangedEffects;
+		TSet<int32> LiveEffects;
+		for (const FActiveGameplayEffect& Effect : &AbilitySystem.GetActiveGameplayEffects())
+		{
+			if (Effect.IsPendingRemove)
+			{
+				continue;
+			}
+			const int32 Handle = GetTypeHash(Effect.Handle);
+			const TPair<int32, float> State(Effect.Spec.GetStackCount(), Effect.GetEndTime());
+			LiveEffects.Add(Handle);
+
+			const TPair<int32, float>* SentEffect = Sent.Effects.Find(Handle);
+			if (!SentEffect || *SentEffect != State)
+			{
+				Sent.Effects.Add(Handle, State);
+				ChangedEffects.Add({ Handle, GetNameSafe(Effect.Spec.Def ? Effect.Spec.Def->GetClass() : nullptr), State.Key, State.Value });
+			}
+		}
+		TArray<int32> RemovedEffects;
+		for (auto It = Sent.Effects.CreateIterator(); It; ++It)
+		{
+			if (!LiveEffects.Contains(It->Key))
+			{
+				RemovedEffects.Add(It->Key);
+				It.RemoveCurrent();
+			}
+		}
+
+		if (!bFullAttributes && ChangedAttributes.IsEmpty() && ChangedTags.IsEmpty() && RemovedTags.IsEmpty()
+			&& ChangedEffects.IsEmpty() && RemovedEffects.IsEmpty())
+		{
+			return false;
+		}
+		Sent.bSent = true;
+
+		FMemoryWriter Writer(OutPayload);
+		uint8 Type = static_cast<uint8>(EMessage::Snapshot);
+		const UWorld* World = AbilitySystem.GetWorld();
+		double ServerTime = World ? World->GetTimeSeconds() : 0.0;
+		Writer << Type << Id << ServerTime << bReset << bFullAttributes;
+
+		if (bFullAttributes)
+		{
+			int32 Num = Sent.Attributes.Num();
+			Writer << Num;
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				FString Name = Sent.Attributes[Index].GetName();
+				Writer << Name << Sent.Values[Index];
+			}
+		}
+		else
+		{
+			int32 Num = ChangedAttributes.Num();
+			Writer << Num;
+			for (TPair<int32, float>& Change : ChangedAttributes)
+			{
+				Writer << Change.Key << Change.Value;
+			}
+		}
+
+		int32 NumChangedTags = ChangedTags.Num();
+		Writer << NumChangedTags;
+		for (TPair<FString, int32>& Change : ChangedTags)
+		{
+			Writer << Change.Key << Change.Value;
+		}
+		Writer << RemovedTags;
+
+		int32 NumChangedEffects = ChangedEffects.Num();
+		Writer << NumChangedEffects;
+		for (FEffectRow& Row : ChangedEffects)
+		{
+			Writer << Row.Handle << Row.Name << Row.StackCount << Row.EndTime;
+		}
+		Writer << RemovedEffects;
+		return true;
+	}
+
+	static void HandleClientMessage(FClient& Client, const TArray<uint8>& Payload)
+	{
+		FMemoryReader Reader(Payload);
+		Reader.ArMaxSerializeSize = Payload.Num();
+		uint8 Type = 0;
+		Reader << Type;
+		if (Type != static_cast<uint8>(EMessage::Select))
+		{
+			return;
+		}
+
+		// Same layout as TArray<uint32>, with the count checked before anything is allocated.
+		int32 NumIds = 0;
+		Reader << NumIds;
+		if (Reader.IsError() || NumIds < 0 || NumIds > MaxSelectedIds || NumIds * static_cast<int64>(sizeof(uint32)) > Reader.TotalSize() - Reader.Tell())
+		{
+			return;
+		}
+		TArray<uint32> Ids;
+		Ids.SetNumUninitialized(NumIds);
+		for (uint32& Id : Ids)
+		{
+			Reader << Id;
+		}
+		if (Reader.IsError())
+		{
+			return;
+		}
+
+		// Still selected ids keep their sent state (deltas continue), new ones start with a full snapshot.
+		TMap<uint32, FSentState> Selected;
+		for (const uint32 Id : Ids)
+		{
+			FSentState* Existing = Client.Selected.Find(Id);
+			Selected.Add(Id, Existing ? MoveTemp(*Existing) : FSentState());
+		}
+		Client.Selected = MoveTemp(Selected);
+	}
+
+	static void SendSnapshots()
+	{
+		TMap<uint32, UAbilitySystemComponent*> Components;
+		GatherComponents(Components);
+
+		uint32 DirectoryHash = 1;
+		for (const TPair<uint32, UAbilitySystemComponent*>& Pair : Components)
+		{
+			DirectoryHash = HashCombineFast(DirectoryHash, Pair.Key);
+		}
+
+		TArray<uint8> Payload;
+		for (TUniquePtr<FClient>& Client : Clients)
+		{
+			if (Client->DirectoryHash != DirectoryHash)
+			{
+				Client->DirectoryHash = DirectoryHash;
+				Payload.Reset();
+				WriteDirectory(Payload, Components);
+				QueueMessage(Client->SendBuffer, Payload);
+			}
+
+			for (TPair<uint32, FSentState>& Pair : Client->Selected)
+			{
+				UAbilitySystemComponent* const* AbilitySystem = Components.Find(Pair.Key);
+				if (!AbilitySystem)
+				{
+					continue;
+				}
+				Payload.Reset();
+				if (WriteSnapshot(Payload, Pair.Key, **AbilitySystem, Pair.Value))
+				{
+					QueueMessage(Client->SendBuffer, Payload);
+				}
+			}
+		}
+	}
+
+	static bool Tick(float /*DeltaTime*/)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(GASCoreSnapshotStream::Tick);
+
+		if (Port <= 0)
+		{
+			StopServer();
+			TickerHandle.Reset();
+			return false;
+		}
+		if (!EnsureListening())
+		{
+			TickerHandle.Reset();
+			return false;
+		}
+
+		AcceptClients();
+
+		TArray<uint8> Payload;
+		for (int32 Index = Clients.Num() - 1; Index >= 0; --Index)
+		{
+			FClient& Client = *Clients[Index];
+			bool bConnected = ReceiveAvailable(*Client.Socket, Client.ReceiveBuffer);
+			bool bMalformed = false;
+			while (bConnected && PopMessage(Client.ReceiveBuffer, Payload, bMalformed))
+			{
+				HandleClientMessage(Client, Payload);
+			}
+			if (!bConnected || bMalformed)
+			{
+				DestroySocket(Client.Socket);
+				Clients.RemoveAtSwap(Index);
+			}
+		}
+
+		const double Now = FPlatformTime::Seconds();
+		if (Now >= NextSendTime && Clients.Num() > 0)
+		{
+			NextSendTime = Now + 1.0 / FMath::Max(CVarRate.GetValueOnGameThread(), 0.1f);
+			SendSnapshots();
+		}
+
+		for (int32 Index = Clients.Num() - 1; Index >= 0; --Index)
+		{
+			FClient& Client = *Clients[Index];
+			if (!FlushSendBuffer(*Client.Socket, Client.SendBuffer) || Client.SendBuffer.Num() > MaxPendingSendBytes)
+			{
+				GASCORE_LOG_WARNING(TEXT("GASCoreSnapshotStream: dropped a client (connection lost or not keeping up)."));
+				DestroySocket(Client.Socket);
+				Clients.RemoveAtSwap(Index);
+			}
+		}
+		return true;
+	}
+
+	static void OnPortChanged(IConsoleVariable* /*Variable*/)
+	{
+		if (Port > 0 && !TickerHandle.IsValid())
+		{
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&Tick));
+		}
+	}
+
+	static FAutoConsoleVariableRef CVarPort(
+		TEXT("GASCore.SnapshotStream.Port"),
+		Port,
+		TEXT("TCP port the ASC snapshot stream listens on for GAS debugger clients (0 = off)."),
+		FConsoleVariableDelegate::CreateStatic(&OnPortChanged),
+		ECVF_Default);
+}
+
+// -------------------------------------------------------------------------------------------------------------------
+// Client
+// -------------------------------------------------------------------------------------------------------------------
+
+struct FGASCoreSnapshotStreamClient::FPendingResolve
+{
+	FString Host;
+	FAddressInfoResult Result{ nullptr, nullptr };
+	std::atomic<bool> bDone{ false };
+};
+
+FGASCoreSnapshotStreamClient::~FGASCoreSnapshotStreamClient()
+{
+	Disconnect();
+}
+
+bool FGASCoreSnapshotStreamClient::Connect(const FString& Host, const int32 Port, FString& OutError)
+{
+	Disconnect();
+	LastError.Reset();
+	ConnectPort = Port;
+
+	// Numeric addresses connect right away; names resolve on a worker (the slot outlives a Disconnect meanwhile).
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (const TSharedPtr<FInternetAddr> Address = SocketSubsystem->GetAddressFromString(Host))
+	{
+		if (!StartConnect(Address.ToSharedRef()))
+		{
+			OutError = LastError;
+			return false;
+		}
+		return true;
+	}
+
+	PendingResolve = MakeShared<FPendingResolve, ESPMode::ThreadSafe>();
+	PendingResolve->Host = Host;
+	SocketSubsystem->GetAddressInfoAsync([Pending = PendingResolve](FAddressInfoResult Result)
+	{
+		Pending->Result = MoveTemp(Result);
+		Pending->bDone = true;
+	}, *Host, nullptr, EAddressInfoFlags::Default, NAME_None, ESocketType::SOCKTYPE_Streaming);
+	++Revision;
+	return true;
+}
+
+bool FGASCoreSnapshotStreamClient::StartConnect(const TSharedRef<FInternetAddr>& Address)
+{
+	Address->SetPort(ConnectPort);
+
+	// Non-blocking before connecting: the handshake completes in TickConnect.
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("GASCoreSnapshotStreamClient"), Address->GetProtocolType());
+	if (!Socket || !Socket->SetNonBlocking(true)
+		|| (!Socket->Connect(*Address) && SocketSubsystem->GetLastErrorCode() != SE_EWOULDBLOCK
+			&& SocketSubsystem->GetLastErrorCode() != SE_EINPROGRESS))
+	{
+		Fail(FString::Printf(TEXT("Cannot connect to %s."), *Address->ToString(true)));
+		return false;
+	}
+
+	bConnecting = true;
+	ConnectDeadline = FPlatformTime::Seconds() + GASCoreSnapshotStream::ConnectTimeout;
+	++Revision;
+	return true;
+}
+
+bool FGASCoreSnapshotStreamClient::TickConnect()
+{
+	if (PendingResolve.IsValid())
+	{
+		if (!PendingResolve->bDone)
+		{
+			return true;
+		}
+		const TSharedPtr<FPendingResolve, ESPMode::ThreadSafe> Resolved = MoveTemp(PendingResolve);
+		if (Resolved->Result.ReturnCode != SE_NO_ERROR || Resolved->Result.Results.IsEmpty())
+		{
+			Fail(FString::Printf(TEXT("Cannot resolve %s."), *Resolved->Host));
+			return false;
+		}
+		return StartConnect(Resolved->Result.Results[0].Address);
+	}
+
+	if (bConnecting)
+	{
+		const ESocketConnectionState State = Socket->GetConnectionState();
+		if (State == SCS_Connected)
+		{
+			bConnecting = false;
+			++Revision;
+		}
+		else if (State == SCS_ConnectionError || FPlatformTime::Seconds() > ConnectDeadline)
+		{
+			Fail(TEXT("Cannot connect (refused or timed out)."));
+			return false;
+		}
+	}
+	return true;
+}
+
+void FGASCoreSnapshotStreamClient::Fail(const FString& Error)
+{
+	Disconnect();
+	LastError = Error;
+}
+
+void FGASCoreSnapshotStreamClient::Disconnect()
+{
+	GASCoreSnapshotStream::DestroySocket(Socket);
+	PendingResolve.Reset();
+	bConnecting = false;
+	ReceiveBuffer.Reset();
+	SendBuffer.Reset();
+	Components.Reset();
+	Snapshots.Reset();
+	++Revision;
+}
+
+void FGASCoreSnapshotStreamClient::Tick()
+{
+	if (!TickConnect() || !IsConnected())
+	{
+		return;
+	}
+
+	bool bConnected = GASCoreSnapshotStream::ReceiveAvailable(*Socket, ReceiveBuffer)
+		&& GASCoreSnapshotStream::FlushSendBuffer(*Socket, SendBuffer);
+
+	TArray<uint8> Payload;
+	bool bMalformed = false;
+	while (bConnected && GASCoreSnapshotStream::PopMessage(ReceiveBuffer, Payload, bMalformed))
+	{
+		bConnected = HandleMessage(Payload);
+	}
+
+	if (!bConnected || bMalformed)
+	{
+		Fail(bMalformed ? TEXT("Malformed message from the server.") : TEXT("Connection lost."));
+	}
+}
+
+void FGASCoreSnapshotStreamClient::Select(const TArray<uint32>& Ids)
+{
+	// Queued while connecting: the first flush sends it.
+	if (!IsConnected() && !IsConnecting())
+	{
+		return;
+	}
+
+	TArray<uint8> Payload;
+	FMemoryWriter Writer(Payload);
+	uint8 Type = static_cast<uint8>(GASCoreSnapshotStream::EMessage::Select);
+	TArray<uint32> SelectedIds = Ids;
+	Writer << Type << SelectedIds;
+	GASCoreSnapshotStream::QueueMessage(SendBuffer, Payload);
+
+	// Deselected ASCs stop updating; drop their mirror.
+	for (auto It = Snapshots.CreateIterator(); It; ++It)
+	{
+		if (!Ids.Contains(It->Key))
+		{
+			It.RemoveCurrent();
+		}
+	}
+	++Revision;
+}
+
+bool FGASCoreSnapshotStreamClient::HandleMessage(const TArray<uint8>& Payload)
+{
+	FMemoryReader Reader(Payload);
+	Reader.ArMaxSerializeSize = Payload.Num();
+	uint8 Type = 0;
+	Reader << Type;
+
+	if (Type == static_cast<uint8>(GASCoreSnapshotStream::EMessage::Directory))
+	{
+		int32 Num = 0;
+		Reader << Num;
+		Components.Reset();
+		for (int32 Index = 0; Index < Num && !Reader.IsError(); ++Index)
+		{
+			FGASCoreRemoteComponent& Component = Components.AddDefaulted_GetRef();
+			Reader << Component.Id << Component.Name;
+		}
+		Components.Sort([](const FGASCoreRemoteComponent& A, const FGASCoreRemoteComponent& B) { return A.Name < B.Name; });
+	}
+	else if (Type == static_cast<uint8>(GASCoreSnapshotStream::EMessage::Snapshot))
+	{
+		uint32 Id = 0;
+		double ServerTime = 0.0;
+		bool bReset = false;
+		bool bFullAttributes = false;
+		Reader << Id << ServerTime << bReset << bFullAttributes;
+
+		FGASCoreRemoteSnapshot& Snapshot = Snapshots.FindOrAdd(Id);
+		if (bReset)
+		{
+			Snapshot = FGASCoreRemoteSnapshot();
+		}
+		Snapshot.ServerTime = ServerTime;
+
+		int32 NumAttributes = 0;
+		Reader << NumAttributes;
+		if (bFullAttributes)
+		{
+			Snapshot.Attributes.Reset();
+		}
+		for (int32 Index = 0; Index < NumAttributes && !Reader.IsError(); ++Index)
+		{
+			if (bFullAttributes)
+			{
+				TPair<FString, float>& Attribute = Snapshot.Attributes.AddDefaulted_GetRef();
+				Reader << Attribute.Key << Attribute.Value;
+			}
+			else
+			{
+				int32 AttributeIndex = 0;
+				float Value = 0.f;
+				Reader << AttributeIndex << Value;
+				if (Snapshot.Attributes.IsValidIndex(AttributeIndex))
+				{
+					Snapshot.Attributes[AttributeIndex].Value = Value;
+				}
+			}
+		}
+
+		int32 NumChangedTags = 0;
+		Reader << NumChangedTags;
+		for (int32 Index = 0; Index < NumChangedTags && !Reader.IsError(); ++Index)
+		{
+			FString Tag;
+			int32 Count = 0;
+			Reader << Tag << Count;
+			Snapshot.Tags.Add(MoveTemp(Tag), Count);
+		}
+		TArray<FString> RemovedTags;
+		Reader << RemovedTags;
+		for (const FString& Tag : RemovedTags)
+		{
+			Snapshot.Tags.Remove(Tag);
+		}
+
+		int32 NumChangedEffects = 0;
+		Reader << NumChangedEffects;
+		for (int32 Index = 0; Index < NumChangedEffects && !Reader.IsError(); ++Index)
+		{
+			int32 Handle = 0;
+			FGASCoreRemoteSnapshot::FEffect Effect;
+			Reader << Handle << Effect.Name << Effect.StackCount << Effect.EndTime;
+			Snapshot.Effects.Add(Handle, MoveTemp(Effect));
+		}
+		TArray<int32> RemovedEffects;
+		Reader << RemovedEffects;
+		for (const int32 Handle : RemovedEffects)
+		{
+			Snapshot.Effects.Remove(Handle);
+		}
+	}
+
+	++Revision;
+	return !Reader.IsError();
+}
+
+#endif
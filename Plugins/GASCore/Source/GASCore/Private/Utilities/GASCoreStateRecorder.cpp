@@ -0,0 +1,598 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Utilities/GASCoreStateRecorder.h"
+
+#if GASCORE_STATE_RECORDER
+
+#include "Abilities/GameplayAbility.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GameplayEffect.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/OutputDevice.h"
+#include "Utilities/GASCoreLogging.h"
+
+static TAutoConsoleVariable<int32> CVarGASCoreStateRecorderCapacity(
+	TEXT("GASCore.StateRecorder.Capacity"),
+	65536,
+	TEXT("Events kept in the GAS state recorder ring (12 bytes each). Applies from the next session."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGASCoreStateRecorderMaxFrames(
+	TEXT("GASCore.StateRecorder.MaxFrames"),
+	18000,
+	TEXT("Frames kept in the GAS state recorder ring (32 bytes each, 18000 = 5 minutes at 60 fps). Applies from the next session."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGASCoreStateRecorderMaxEventsPerFrame(
+	TEXT("GASCore.StateRecorder.MaxEventsPerFrame"),
+	128,
+	TEXT("Events per frame up to which the GAS state recorder records polled attribute changes; further changes wait for ")
+	TEXT("a later frame (tag, effect and ability events are always recorded)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGASCoreStateRecorderMaxSources(
+	TEXT("GASCore.StateRecorder.MaxSources"),
+	8,
+	TEXT("ASCs the GAS state recorder watches per session (at most 255)."),
+	ECVF_Default);
+
+void FGASCoreRecordedState::Apply(const FGASCoreRecordedEvent& Event)
+{
+	switch (Event.Type)
+	{
+	case EGASCoreRecordedEventType::Attribute:
+		Attributes.Add(Event.Key, Event.Value);
+		break;
+	case EGASCoreRecordedEventType::Tag:
+		if (Event.Value > 0.f)
+		{
+			Tags.Add(Event.Key, FMath::RoundToInt32(Event.Value));
+		}
+		else
+		{
+			Tags.Remove(Event.Key);
+		}
+		break;
+	case EGASCoreRecordedEventType::EffectAdded:
+		Effects.Add(Event.Key, FMath::RoundToInt32(Event.Value));
+		break;
+	case EGASCoreRecordedEventType::EffectRemoved:
+		Effects.Remove(Event.Key);
+		break;
+	case EGASCoreRecordedEventType::AbilityActivated:
+		++Abilities.FindOrAdd(Event.Key);
+		break;
+	case EGASCoreRecordedEventType::AbilityEnded:
+		if (int32* Count = Abilities.Find(Event.Key))
+		{
+			if (--*Count <= 0)
+			{
+				Abilities.Remove(Event.Key);
+			}
+		}
+		break;
+	}
+}
+
+namespace GASCoreStateRecorder
+{
+	struct FSource
+	{
+		FString Name;
+		TWeakObjectPtr<UAbilitySystemComponent> Component;
+		bool bWatching = false;
+
+		/** Polled attributes with their name keys and last recorded values (parallel arrays). */
+		TArray<FGameplayAttribute> Attributes;
+		TArray<int32> AttributeKeys;
+		TArray<float> AttributeValues;
+
+		/** Spawned attribute set count the attribute list was built from (sets can be added later). */
+		int32 NumAttributeSets = INDEX_NONE;
+
+		FDelegateHandle TagHandle;
+		FDelegateHandle EffectAddedHandle;
+		FDelegateHandle EffectRemovedHandle;
+		FDelegateHandle AbilityActivatedHandle;
+		FDelegateHandle AbilityEndedHandle;
+	};
+
+	struct FSession
+	{
+		TArray<FSource> Sources;
+
+		/** State of each source before the oldest retained event (evicted events are folded in). */
+		TArray<FGASCoreRecordedState> BaseStates;
+
+		/** Event ring; sequence number N lives at N % Num. Empty until the first Watch. */
+		TArray<FGASCoreRecordedEvent> Events;
+		uint64 NextEvent = 0;
+
+		/** Frame ring, same scheme. */
+		TArray<FGASCoreRecordedFrame> Frames;
+		uint64 NextFrame = 0;
+
+		/** Frame being recorded (closed at end of frame). */
+		uint64 OpenFirstEvent = 0;
+		uint32 OpenNumEvents = 0;
+		uint32 OpenNumDropped = 0;
+
+		/** Watch snapshots bypass the per-frame attribute budget. */
+		bool bUnbudgeted = false;
+
+		TArray<FName> Names;
+		TMap<FName, int32> NameIndices;
+
+		/** Active effect handle id -> effect name index (pruned when the removal is evicted). */
+		TMap<int32, int32> EffectNames;
+
+		double StartTime = 0.0;
+		uint64 Revision = 0;
+		FDelegateHandle EndFrameHandle;
+	};
+
+	static FSession Session;
+
+	static int32 GetNameIndex(const FName Name)
+	{
+		if (const int32* Index = Session.NameIndices.Find(Name))
+		{
+			return *Index;
+		}
+		const int32 Index = Session.Names.Add(Name);
+		Session.NameIndices.Add(Name, Index);
+		return Index;
+	}
+
+	static uint64 GetOldestEvent()
+	{
+		const uint64 Capacity = Session.Events.Num();
+		return Session.NextEvent > Capacity ? Session.NextEvent - Capacity : 0;
+	}
+
+	/**
+	 * Append an event to the open frame. False when there is no session, or for a budgeted (polled attribute) event
+	 * once the frame is full. Discrete events are never dropped: replay cannot recover a missed tag or effect change.
+	 */
+	static bool Record(const uint8 Source, const EGASCoreRecordedEventType Type, const int32 Key, const float Value,
+		const bool bBudgeted = false)
+	{
+		if (Session.Events.Num() == 0)
+		{
+			return false;
+		}
+		if (bBudgeted && !Session.bUnbudgeted && Session.OpenNumEvents >= static_cast<uint32>(FMath::Max(CVarGASCoreStateRecorderMaxEventsPerFrame.GetValueOnGameThread(), 1)))
+		{
+			++Session.OpenNumDropped;
+			return false;
+		}
+
+		FGASCoreRecordedEvent& Slot = Session.Events[Session.NextEvent % Session.Events.Num()];
+		if (Session.NextEvent >= static_cast<uint64>(Session.Events.Num()))
+		{
+			Session.BaseStates[Slot.Source].Apply(Slot);
+			if (Slot.Type == EGASCoreRecordedEventType::EffectRemoved)
+			{
+				Session.EffectNames.Remove(Slot.Key);
+			}
+		}
+
+		Slot.Source = Source;
+		Slot.Type = Type;
+		Slot.Key = Key;
+		Slot.Value = Value;
+		++Session.NextEvent;
+		++Session.OpenNumEvents;
+		return true;
+	}
+
+	/** Record the attributes of Source that changed since the last recorded value (all of them the first time). */
+	static void PollAttributes(const uint8 SourceIndex, UAbilitySystemComponent& AbilitySystem)
+	{
+		FSource& Source = Session.Sources[SourceIndex];
+
+		if (Source.NumAttributeSets != AbilitySystem.GetSpawnedAttributes().Num())
+		{
+			Source.NumAttributeSets = AbilitySystem.GetSpawnedAttributes().Num();
+
+			TArray<FGameplayAttribute> Attributes;
+			AbilitySystem.GetAllAttributes(Attributes);
+			for (const FGameplayAttribute& Attribute : Attributes)
+			{
+				if (!Source.Attributes.Contains(Attribute))
+				{
+					// NaN never equals the live value: new attributes are recorded below.
+					Source.Attributes.Add(Attribute);
+					Source.AttributeKeys.Add(GetNameIndex(FName(Attribute.GetName())));
+					Source.AttributeValues.Add(NAN);
+				}
+			}
+		}
+
+		for (int32 Index = 0; Index < Source.Attributes.Num(); ++Index)
+		{
+			const float Value = AbilitySystem.GetNumericAttribute(Source.Attributes[Index]);
+			if (Value != Source.AttributeValues[Index]
+				&& Record(SourceIndex, EGASCoreRecordedEventType::Attribute, Source.AttributeKeys[Index], Value, /*bBudgeted=*/true))
+			{
+				// A deferred change keeps the old value and is retried next frame.
+				Source.AttributeValues[Index] = Value;
+			}
+		}
+	}
+
+	static void UnbindSource(FSource& Source)
+	{
+		if (UAbilitySystemComponent* AbilitySystem = Source.Component.Get())
+		{
+			AbilitySystem->RegisterGenericGameplayTagEvent().Remove(Source.TagHandle);
+			AbilitySystem->OnActiveGameplayEffectAddedDelegateToSelf.Remove(Source.EffectAddedHandle);
+			AbilitySystem->OnAnyGameplayEffectRemovedDelegate().Remove(Source.EffectRemovedHandle);
+			AbilitySystem->AbilityActivatedCallbacks.Remove(Source.AbilityActivatedHandle);
+			AbilitySystem->OnAbilityEnded.Remove(Source.AbilityEndedHandle);
+		}
+		Source.bWatching = false;
+	}
+
+	static void OnEndFrame()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(GASCoreStateRecorder::OnEndFrame);
+
+		bool bAnyWatching = false;
+		for (int32 Index = 0; Index < Session.Sources.Num(); ++Index)
+		{
+			FSource& Source = Session.Sources[Index];
+			if (!Source.bWatching)
+			{
+				continue;
+			}
+
+			UAbilitySystemComponent* AbilitySystem = Source.Component.Get();
+			if (!IsValid(AbilitySystem))
+			{
+				Source.bWatching = false;
+				continue;
+			}
+
+			PollAttributes(static_cast<uint8>(Index), *AbilitySystem);
+			bAnyWatching = true;
+		}
+
+		FGASCoreRecordedFrame& Frame = Session.Frames[Session.NextFrame % Session.Frames.Num()];
+		Frame.EngineFrame = GFrameCounter;
+		Frame.Time = FPlatformTime::Seconds() - Session.StartTime;
+		Frame.FirstEvent = Session.OpenFirstEvent;
+		Frame.NumEvents = Session.OpenNumEvents;
+		Frame.NumDropped = Session.OpenNumDropped;
+		++Session.NextFrame;
+		++Session.Revision;
+
+		Session.OpenFirstEvent = Session.NextEvent;
+		Session.OpenNumEvents = 0;
+		Session.OpenNumDropped = 0;
+
+		// The session stays replayable; recording resumes with the next Watch.
+		if (!bAnyWatching)
+		{
+			FCoreDelegates::OnEndFrame.Remove(Session.EndFrameHandle);
+			Session.EndFrameHandle.Reset();
+		}
+	}
+
+	static FString MakeSourceName(const UAbilitySystemComponent& AbilitySystem)
+	{
+		const AActor* Actor = AbilitySystem.GetAvatarActor_Direct() ? AbilitySystem.GetAvatarActor_Direct() : AbilitySystem.GetOwner();
+		const UWorld* World = AbilitySystem.GetWorld();
+
+		FString NetMode = TEXT("Standalone");
+		if (World && World->GetNetMode() == NM_Client)
+		{
+			const FWorldContext* Context = GEngine ? GEngine->GetWorldContextFromWorld(World) : nullptr;
+			NetMode = Context ? FString::Printf(TEXT("Client %d"), Context->PIEInstance) : TEXT("Client");
+		}
+		else if (World && World->GetNetMode() != NM_Standalone)
+		{
+			NetMode = TEXT("Server");
+		}
+		return FString::Printf(TEXT("%s [%s]"), *GetNameSafe(Actor), *NetMode);
+	}
+
+	bool Watch(UAbilitySystemComponent* AbilitySystem)
+	{
+		check(IsInGameThread());
+		if (!IsValid(AbilitySystem) || IsWatching(AbilitySystem))
+		{
+			return IsValid(AbilitySystem);
+		}
+
+		const int32 MaxSources = FMath::Clamp(CVarGASCoreStateRecorderMaxSources.GetValueOnGameThread(), 1, int32(MAX_uint8) + 1);
+		if (Session.Sources.Num() >= MaxSources)
+		{
+			GASCORE_LOG_WARNING(TEXT("GASCoreStateRecorder: cannot watch %s, the session already has %d sources (GASCore.StateRecorder.MaxSources)."),
+				*MakeSourceName(*AbilitySystem), MaxSources);
+			return false;
+		}
+
+		if (Session.Events.Num() == 0)
+		{
+			Session.Events.SetNum(FMath::Clamp(CVarGASCoreStateRecorderCapacity.GetValueOnGameThread(), 1024, 1 << 22));
+			Session.Frames.SetNum(FMath::Clamp(CVarGASCoreStateRecorderMaxFrames.GetValueOnGameThread(), 60, 1 << 20));
+			Session.StartTime = FPlatformTime::Seconds();
+		}
+		if (!Session.EndFrameHandle.IsValid())
+		{
+			Session.EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&OnEndFrame);
+		}
+
+		// A re-watched component gets a fresh source: its old one stops where watching stopped.
+		const uint8 SourceIndex = static_cast<uint8>(Session.Sources.Num());
+		FSource& Source = Session.Sources.AddDefaulted_GetRef();
+		Session.BaseStates.AddDefaulted();
+		Source.Name = MakeSourceName(*AbilitySystem);
+		Source.Component = AbilitySystem;
+		Source.bWatching = true;
+
+		Source.TagHandle = AbilitySystem->RegisterGenericGameplayTagEvent().AddLambda([SourceIndex](const FGameplayTag Tag, const int32 NewCount)
+		{
+			Record(SourceIndex, EGASCoreRecordedEventType::Tag, GetNameIndex(Tag.GetTagName()), NewCount);
+		});
+		Source.EffectAddedHandle = AbilitySystem->OnActiveGameplayEffectAddedDelegateToSelf.AddLambda(
+			[SourceIndex](UAbilitySystemComponent*, const FGameplayEffectSpec& Spec, const FActiveGameplayEffectHandle Handle)
+		{
+			const int32 HandleId = GetTypeHash(Handle);
+			Session.EffectNames.Add(HandleId, GetNameIndex(Spec.Def ? Spec.Def->GetClass()->GetFName() : NAME_None));
+			Record(SourceIndex, EGASCoreRecordedEventType::EffectAdded, HandleId, Spec.GetStackCount());
+		});
+		Source.EffectRemovedHandle = AbilitySystem->OnAnyGameplayEffectRemovedDelegate().AddLambda([SourceIndex](const FActiveGameplayEffect& Effect)
+		{
+			Record(SourceIndex, EGASCoreRecordedEventType::EffectRemoved, GetTypeHash(Effect.Handle), 0.f);
+		});
+		Source.AbilityActivatedHandle = AbilitySystem->AbilityActivatedCallbacks.AddLambda([SourceIndex](UGameplayAbility* Ability)
+		{
+			if (Ability)
+			{
+				Record(SourceIndex, EGASCoreRecordedEventType::AbilityActivated, GetNameIndex(Ability->GetClass()->GetFName()), 0.f);
+			}
+		});
+		Source.AbilityEndedHandle = AbilitySystem->OnAbilityEnded.AddLambda([SourceIndex](const FAbilityEndedData& Data)
+		{
+			if (Data.AbilityThatEnded)
+			{
+				Record(SourceIndex, EGASCoreRecordedEventType::AbilityEnded, GetNameIndex(Data.AbilityThatEnded->GetClass()->GetFName()), 0.f);
+			}
+		});
+
+		// Base snapshot: everything the ASC already has, outside the per-frame budget.
+		TGuardValue<bool> Unbudgeted(Session.bUnbudgeted, true);
+
+		FGameplayTagContainer OwnedTags;
+		AbilitySystem->GetOwnedGameplayTags(OwnedTags);
+		for (const FGameplayTag& Tag : OwnedTags)
+		{
+			Record(SourceIndex, EGASCoreRecordedEventType::Tag, GetNameIndex(Tag.GetTagName()), AbilitySystem->GetTagCount(Tag));
+		}
+
+		for (const FActiveGameplayEffect& Effect : &AbilitySystem->GetActiveGameplayEffects())
+		{
+			if (Effect.IsPendingRemove)
+			{
+				continue;
+			}
+			const int32 HandleId = GetTypeHash(Effect.Handle);
+			Session.EffectNames.Add(HandleId, GetNameIndex(Effect.Spec.Def ? Effect.Spec.Def->GetClass()->GetFName() : NAME_None));
+			Record(SourceIndex, EGASCoreRecordedEventType::EffectAdded, HandleId, Effect.Spec.GetStackCount());
+		}
+
+		for (const FGameplayAbilitySpec& Spec : AbilitySystem->GetActivatableAbilities())
+		{
+			if (Spec.Ability)
+			{
+				for (uint8 Count = 0; Count < Spec.ActiveCount; ++Count)
+				{
+					Record(SourceIndex, EGASCoreRecordedEventType::AbilityActivated, GetNameIndex(Spec.Ability->GetClass()->GetFName()), 0.f);
+				}
+			}
+		}
+
+		PollAttributes(SourceIndex, *AbilitySystem);
+		return true;
+	}
+
+	void Unwatch(UAbilitySystemComponent* AbilitySystem)
+	{
+		for (FSource& Source : Session.Sources)
+		{
+			if (Source.bWatching && Source.Component.Get() == AbilitySystem)
+			{
+				UnbindSource(Source);
+			}
+		}
+	}
+
+	bool IsWatching(const UAbilitySystemComponent* AbilitySystem)
+	{
+		return AbilitySystem && Session.Sources.ContainsByPredicate([AbilitySystem](const FSource& Source)
+		{
+			return Source.bWatching && Source.Component.Get() == AbilitySystem;
+		});
+	}
+
+	void Reset()
+	{
+		for (FSource& Source : Session.Sources)
+		{
+			if (Source.bWatching)
+			{
+				UnbindSource(Source);
+			}
+		}
+		FCoreDelegates::OnEndFrame.Remove(Session.EndFrameHandle);
+
+		const uint64 Revision = Session.Revision + 1;
+		Session = FSession();
+		Session.Revision = Revision;
+	}
+
+	uint64 GetRevision()
+	{
+		return Session.Revision;
+	}
+
+	int32 GetNumSources()
+	{
+		return Session.Sources.Num();
+	}
+
+	FString GetSourceName(const int32 Source)
+	{
+		return Session.Sources.IsValidIndex(Source) ? Session.Sources[Source].Name : FString();
+	}
+
+	UAbilitySystemComponent* GetSourceComponent(const int32 Source)
+	{
+		return Session.Sources.IsValidIndex(Source) ? Session.Sources[Source].Component.Get() : nullptr;
+	}
+
+	/** Sequence number of the oldest retained frame whose end is still covered by retained events. */
+	static uint64 GetFirstFrame()
+	{
+		const uint64 OldestEvent = GetOldestEvent();
+		uint64 Low = Session.NextFrame - FMath::Min<uint64>(Session.NextFrame, Session.Frames.Num());
+		uint64 High = Session.NextFrame;
+
+		// Frame ends are monotonic: binary search the first frame ending at or after the oldest retained event.
+		while (Low < High)
+		{
+			const uint64 Mid = Low + (High - Low) / 2;
+			const FGASCoreRecordedFrame& Frame = Session.Frames[Mid % Session.Frames.Num()];
+			if (Frame.FirstEvent + Frame.NumEvents >= OldestEvent)
+			{
+				High = Mid;
+			}
+			else
+			{
+				Low = Mid + 1;
+			}
+		}
+		return Low;
+	}
+
+	int32 GetNumFrames()
+	{
+		return Session.Frames.Num() > 0 ? static_cast<int32>(Session.NextFrame - GetFirstFrame()) : 0;
+	}
+
+	const FGASCoreRecordedFrame& GetFrame(const int32 Index)
+	{
+		check(Index >= 0 && Index < GetNumFrames());
+		return Session.Frames[(GetFirstFrame() + Index) % Session.Frames.Num()];
+	}
+
+	void GetFrameEvents(const int32 Index, TArray<FGASCoreRecordedEvent>& OutEvents)
+	{
+		OutEvents.Reset();
+		if (Index < 0 || Index >= GetNumFrames())
+		{
+			return;
+		}
+
+		const FGASCoreRecordedFrame& Frame = GetFrame(Index);
+		for (uint64 Sequence = FMath::Max(Frame.FirstEvent, GetOldestEvent()); Sequence < Frame.FirstEvent + Frame.NumEvents; ++Sequence)
+		{
+			OutEvents.Add(Session.Events[Sequence % Session.Events.Num()]);
+		}
+	}
+
+	void BuildState(const int32 Index, TArray<FGASCoreRecordedState>& OutStates)
+	{
+		OutStates = Session.BaseStates;
+		if (Index < 0 || Index >= GetNumFrames())
+		{
+			return;
+		}
+
+		const FGASCoreRecordedFrame& Frame = GetFrame(Index);
+		for (uint64 Sequence = GetOldestEvent(); Sequence < Frame.FirstEvent + Frame.NumEvents; ++Sequence)
+		{
+			const FGASCoreRecordedEvent& Event = Session.Events[Sequence % Session.Events.Num()];
+			OutStates[Event.Source].Apply(Event);
+		}
+	}
+
+	FName GetName(const int32 Key)
+	{
+		return Session.Names.IsValidIndex(Key) ? Session.Names[Key] : NAME_None;
+	}
+
+	FName GetEffectName(const int32 HandleId)
+	{
+		const int32* NameIndex = Session.EffectNames.Find(HandleId);
+		return NameIndex ? GetName(*NameIndex) : NAME_None;
+	}
+
+	void Dump(FOutputDevice& Ar)
+	{
+		const int32 NumFrames = GetNumFrames();
+		uint64 NumDropped = 0;
+		for (int32 Index = 0; Index < NumFrames; ++Index)
+		{
+			NumDropped += GetFrame(Index).NumDropped;
+		}
+
+		Ar.Logf(TEXT("GASCore state recorder: %d sources, %d frames (%.1f s), %llu of %llu events retained, %llu attribute changes deferred, %.1f KB."),
+			Session.Sources.Num(), NumFrames, NumFrames > 0 ? GetFrame(NumFrames - 1).Time - GetFrame(0).Time : 0.0,
+			Session.NextEvent - GetOldestEvent(), Session.NextEvent, NumDropped,
+			(Session.Events.GetAllocatedSize() + Session.Frames.GetAllocatedSize()) / 1024.0);
+		for (const FSource& Source : Session.Sources)
+		{
+			Ar.Logf(TEXT("  %s%s"), *Source.Name, Source.bWatching ? TEXT(" (watching)") : TEXT(""));
+		}
+	}
+
+	static FAutoConsoleCommandWithOutputDevice WatchPlayersCommand(
+		TEXT("GASCore.StateRecorder.WatchPlayers"),
+		TEXT("Record the ASCs of every player-controlled pawn in every game world (for playtests without the GAS debugger)."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+		{
+			if (!GEngine)
+			{
+				return;
+			}
+			for (const FWorldContext& Context : GEngine->GetWorldContexts())
+			{
+				const UWorld* World = Context.World();
+				if (!World || !World->IsGameWorld())
+				{
+					continue;
+				}
+				for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+				{
+					const APlayerController* PlayerController = It->Get();
+					UAbilitySystemComponent* AbilitySystem = PlayerController
+						? UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(PlayerController->GetPawn()) : nullptr;
+					if (AbilitySystem && Watch(AbilitySystem))
+					{
+						Ar.Logf(TEXT("Watching %s."), *MakeSourceName(*AbilitySystem));
+					}
+				}
+			}
+		}));
+
+	static FAutoConsoleCommandWithOutputDevice DumpCommand(
+		TEXT("GASCore.StateRecorder.Dump"),
+		TEXT("Print the GAS state recorder session: sources, retained window, events and memory."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&Dump));
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("GASCore.StateRecorder.Reset"),
+		TEXT("Drop the GAS state recorder session and stop watching every ASC."),
+		FConsoleCommandDelegate::CreateStatic(&Reset));
+}
+
+#endif
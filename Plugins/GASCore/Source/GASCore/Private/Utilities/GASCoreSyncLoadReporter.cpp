@@ -0,0 +1,108 @@
+// Copyright DermanDanisman, Inc. All Rights Reserved.
+
+#include "Utilities/GASCoreSyncLoadReporter.h"
+
+#if GASCORE_SYNC_LOAD_REPORTER
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "UObject/UObjectGlobals.h"
+#include "Utilities/GASCoreLogging.h"
+
+namespace GASCoreSyncLoadReporter
+{
+	static bool bReportAll = false;
+	static FAutoConsoleVariableRef CVarSyncLoadReportAll(
+		TEXT("GASCore.SyncLoadReport.All"),
+		bReportAll,
+		TEXT("Report every synchronous package load during gameplay, not only watched GAS assets."),
+		ECVF_Default);
+
+	static TSet<FName> WatchedPackages;
+	static TMap<FName, int32> HitchCounts;
+	static FDelegateHandle SyncLoadHandle;
+
+	/** True while any game or PIE world is playing (loading screens and map travel are expected to load). */
+	static bool IsInGameplay()
+	{
+		if (!GEngine)
+		{
+			return false;
+		}
+
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			const UWorld* World = Context.World();
+			if (World && World->IsGameWorld() && World->HasBegunPlay() && !World->IsInSeamlessTravel())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static void OnSyncLoadPackage(const FString& PackageName)
+	{
+		if (!IsInGameThread() || !IsInGameplay())
+		{
+			return;
+		}
+
+		const FName PackageFName(*PackageName);
+		const bool bWatched = WatchedPackages.Contains(PackageFName);
+		if (!bWatched && !bReportAll)
+		{
+			return;
+		}
+
+		++HitchCounts.FindOrAdd(PackageFName);
+		GASCORE_LOG_WARNING(TEXT("Synchronous load during gameplay: %s%s"), *PackageName,
+			bWatched ? TEXT(" (preloaded GAS asset was not resident; keep its bundle loaded)") : TEXT(""));
+	}
+
+	void AddWatchedAssets(const TConstArrayView<FSoftObjectPath> Paths)
+	{
+		for (const FSoftObjectPath& Path : Paths)
+		{
+			if (!Path.IsNull())
+			{
+				WatchedPackages.Add(Path.GetLongPackageFName());
+			}
+		}
+
+		if (!SyncLoadHandle.IsValid())
+		{
+			SyncLoadHandle = FCoreUObjectDelegates::OnSyncLoadPackage.AddStatic(&OnSyncLoadPackage);
+		}
+	}
+
+	void Reset()
+	{
+		HitchCounts.Reset();
+	}
+
+	void Dump(FOutputDevice& Ar)
+	{
+		HitchCounts.ValueSort(TGreater<int32>());
+
+		Ar.Logf(TEXT("GASCore synchronous loads during gameplay (%d packages, %d watched):"), HitchCounts.Num(), WatchedPackages.Num());
+		for (const TPair<FName, int32>& Pair : HitchCounts)
+		{
+			Ar.Logf(TEXT("%6d  %s%s"), Pair.Value, *Pair.Key.ToString(), WatchedPackages.Contains(Pair.Key) ? TEXT("  [GAS]") : TEXT(""));
+		}
+	}
+
+	static FAutoConsoleCommandWithOutputDevice DumpCommand(
+		TEXT("GASCore.SyncLoadReport.Dump"),
+		TEXT("Print synchronous package loads recorded during gameplay."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&Dump));
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("GASCore.SyncLoadReport.Reset"),
+		TEXT("Clear the recorded synchronous loads."),
+		FConsoleCommandDelegate::CreateStatic(&Reset));
+}
+
+#endif
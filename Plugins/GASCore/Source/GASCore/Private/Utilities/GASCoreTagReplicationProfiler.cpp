@@ -0,0 +1,206 @@
+// Copyright DermanDanisman, Inc. All Rights Reserved.
+
+#include "Utilities/GASCoreTagReplicationProfiler.h"
+
+#if GASCORE_TAG_REPLICATION_PROFILER
+
+#include "Containers/Ticker.h"
+#include "GameplayTagsManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/Paths.h"
+#include "Utilities/GASCoreLogging.h"
+
+namespace GASCoreTagReplicationProfiler
+{
+	static bool bEnabled = false;
+
+	static float Coverage = 0.95f;
+	static FAutoConsoleVariableRef CVarTagRepProfilerCoverage(
+		TEXT("GASCore.TagRepProfiler.Coverage"),
+		Coverage,
+		TEXT("Fraction (0..1] of all recorded tag replications the recommended CommonlyReplicatedTags list must cover."),
+		ECVF_Default);
+
+	struct FTagStats
+	{
+		/** Replications this session. */
+		int64 Count = 0;
+
+		/** Highest replications seen within one sample second. */
+		int64 PeakPerSecond = 0;
+	};
+
+	/** Engine counter value per tag at session start / last sample. */
+	static TMap<FGameplayTag, int32> Baseline;
+	static TMap<FGameplayTag, int32> LastSample;
+
+	static TMap<FGameplayTag, FTagStats> Stats;
+	static double SessionStartTime = 0.0;
+	static FTSTicker::FDelegateHandle SampleTickerHandle;
+
+	static void Sample()
+	{
+		const TMap<FGameplayTag, int32>& Counters = UGameplayTagsManager::Get().ReplicationCountMap;
+		for (const TPair<FGameplayTag, int32>& Pair : Counters)
+		{
+			const int32 Previous = LastSample.FindRef(Pair.Key);
+			const int32 SessionBase = Baseline.FindRef(Pair.Key);
+			const int64 Delta = Pair.Value - Previous;
+			if (Delta <= 0)
+			{
+				continue;
+			}
+
+			FTagStats& TagStats = Stats.FindOrAdd(Pair.Key);
+			TagStats.Count = Pair.Value - SessionBase;
+			TagStats.PeakPerSecond = FMath::Max(TagStats.PeakPerSecond, Delta);
+		}
+		LastSample = Counters;
+	}
+
+	/** Session stats sorted by count, descending. */
+	static TArray<TPair<FGameplayTag, FTagStats>> GetSortedStats()
+	{
+		Sample();
+
+		TArray<TPair<FGameplayTag, FTagStats>> Rows = Stats.Array();
+		Rows.Sort([](const TPair<FGameplayTag, FTagStats>& A, const TPair<FGameplayTag, FTagStats>& B) { return A.Value.Count > B.Value.Count; });
+		return Rows;
+	}
+
+	/** Number of leading Rows needed to reach Coverage of all replications. */
+	static int32 GetRecommendedTagCount(const TArray<TPair<FGameplayTag, FTagStats>>& Rows)
+	{
+		int64 Total = 0;
+		for (const TPair<FGameplayTag, FTagStats>& Row : Rows)
+		{
+			Total += Row.Value.Count;
+		}
+
+		const double Target = Total * FMath::Clamp(static_cast<double>(Coverage), 0.0, 1.0);
+		int64 Running = 0;
+		int32 NumTags = 0;
+		while (NumTags < Rows.Num() && Running < Target)
+		{
+			Running += Rows[NumTags++].Value.Count;
+		}
+		return NumTags;
+	}
+
+	/** Bits so the first segment holds every commonly replicated tag (fast replication gives them the lowest indices). */
+	static int32 GetRecommendedFirstBitSegment(const int32 NumCommonTags)
+	{
+		return FMath::Max(1, static_cast<int32>(FMath::CeilLogTwo(static_cast<uint32>(NumCommonTags + 1))));
+	}
+
+	static FString BuildConfigBlock(const TArray<TPair<FGameplayTag, FTagStats>>& Rows, const int32 NumCommonTags)
+	{
+		FString Block = TEXT("[/Script/GameplayTags.GameplayTagsSettings]\n");
+		Block += TEXT("FastReplication=True\n");
+		Block += FString::Printf(TEXT("NetIndexFirstBitSegment=%d\n"), GetRecommendedFirstBitSegment(NumCommonTags));
+		for (int32 Index = 0; Index < NumCommonTags; ++Index)
+		{
+			Block += FString::Printf(TEXT("+CommonlyReplicatedTags=%s\n"), *Rows[Index].Key.ToString());
+		}
+		return Block;
+	}
+
+	bool IsEnabled()
+	{
+		return bEnabled;
+	}
+
+	void Reset()
+	{
+		const TMap<FGameplayTag, int32>& Counters = UGameplayTagsManager::Get().ReplicationCountMap;
+		Baseline = Counters;
+		LastSample = Counters;
+		Stats.Reset();
+		SessionStartTime = FPlatformTime::Seconds();
+	}
+
+	void Dump(FOutputDevice& Ar, const int32 TopN)
+	{
+		const TArray<TPair<FGameplayTag, FTagStats>> Rows = GetSortedStats();
+		const double Seconds = FMath::Max(FPlatformTime::Seconds() - SessionStartTime, 1.0);
+
+		Ar.Logf(TEXT("GASCore tag replication profile (%d tags, %.0f s, top %d):"), Rows.Num(), Seconds, TopN);
+		Ar.Logf(TEXT("%-60s %12s %10s %10s"), TEXT("Tag"), TEXT("Count"), TEXT("Avg/s"), TEXT("Peak/s"));
+		for (int32 Index = 0; Index < FMath::Min(TopN, Rows.Num()); ++Index)
+		{
+			const TPair<FGameplayTag, FTagStats>& Row = Rows[Index];
+			Ar.Logf(TEXT("%-60s %12lld %10.2f %10lld"), *Row.Key.ToString(), Row.Value.Count, Row.Value.Count / Seconds, Row.Value.PeakPerSecond);
+		}
+
+		const int32 NumCommonTags = GetRecommendedTagCount(Rows);
+		Ar.Logf(TEXT("Recommended settings (%d tags cover %.0f%% of replications):\n%s"),
+			NumCommonTags, Coverage * 100.f, *BuildConfigBlock(Rows, NumCommonTags));
+	}
+
+	FString WriteRecommendedConfig()
+	{
+		const TArray<TPair<FGameplayTag, FTagStats>> Rows = GetSortedStats();
+		const FString Block = BuildConfigBlock(Rows, GetRecommendedTagCount(Rows));
+
+		const FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Profiling"), TEXT("GASCoreCommonlyReplicatedTags.ini"));
+		if (!FFileHelper::SaveStringToFile(Block, *Path))
+		{
+			GASCORE_LOG_ERROR(TEXT("Failed to write tag replication recommendations to [%s]."), *Path);
+			return FString();
+		}
+		return Path;
+	}
+
+	static void OnEnabledChanged(IConsoleVariable* /*Variable*/)
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(SampleTickerHandle);
+		SampleTickerHandle.Reset();
+
+		if (bEnabled)
+		{
+			Reset();
+			SampleTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+			{
+				Sample();
+				return true;
+			}), 1.f);
+		}
+	}
+
+	static FAutoConsoleVariableRef CVarTagRepProfilerEnable(
+		TEXT("GASCore.TagRepProfiler.Enable"),
+		bEnabled,
+		TEXT("Record per-tag gameplay tag replication rates for a soak session. ")
+		TEXT("See GASCore.TagRepProfiler.Dump / .Write / .Reset."),
+		FConsoleVariableDelegate::CreateStatic(&OnEnabledChanged),
+		ECVF_Default);
+
+	static FAutoConsoleCommandWithArgsAndOutputDevice DumpCommand(
+		TEXT("GASCore.TagRepProfiler.Dump"),
+		TEXT("Print the most replicated gameplay tags and the recommended fast replication settings. Args: [TopN=30]"),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, FOutputDevice& Ar)
+		{
+			Dump(Ar, Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 30);
+		}));
+
+	static FAutoConsoleCommandWithOutputDevice WriteCommand(
+		TEXT("GASCore.TagRepProfiler.Write"),
+		TEXT("Write the recommended GameplayTagsSettings block (CommonlyReplicatedTags) to Saved/Profiling."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+		{
+			const FString Path = WriteRecommendedConfig();
+			if (!Path.IsEmpty())
+			{
+				Ar.Logf(TEXT("Wrote %s"), *Path);
+			}
+		}));
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("GASCore.TagRepProfiler.Reset"),
+		TEXT("Restart the tag replication session."),
+		FConsoleCommandDelegate::CreateStatic(&Reset));
+}
+
+#endif
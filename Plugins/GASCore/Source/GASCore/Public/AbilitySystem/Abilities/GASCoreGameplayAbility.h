@@ -7,6 +7,7 @@
 #include "GASCoreGameplayAbility.generated.h"
 
 class AGASCoreSpawnedActorByGameplayAbility;
+class UGameplayEffect;
 /**
  * 
  */
@@ -20,6 +21,23 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category="GASCore|Gameplay Ability|Tag")
 	FGameplayTag StartupInputTag;
 
+	/**
+	 * Input-driven activation on a predicting client sends activation, target data and end (whatever happens in the
+	 * activating frame) as one ServerAbilityRPCBatch instead of separate server RPCs. Suits abilities that fire at
+	 * once (projectile casts); harmless otherwise (the batch simply carries less).
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="GASCore|Gameplay Ability|Networking")
+	bool bBatchServerRPCs = false;
+
+	/**
+	 * Activation latency: the ability's first gameplay cue (its first visible/audible feedback) played.
+	 * Executed cues whose effect context carries this instance report it automatically (GASCore ASC cue dispatch);
+	 * call it for feedback that is not such a cue (added cues, spawned actors).
+	 * Only the first call per activation counts; a no-op unless the activation came from input and is being measured.
+	 */
+	UFUNCTION(BlueprintCallable, Category="GASCore|Gameplay Ability|Latency")
+	void NotifyFirstGameplayCue();
+
 	UFUNCTION(BlueprintPure, Category = "GASCore|Projectile Ability")
 	TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> GetSpawnActorClass() { return SpawnActorClass; }
 
@@ -30,9 +48,34 @@ protected:
 		const FGameplayAbilityActivationInfo ActivationInfo,
 		const FGameplayEventData* TriggerEventData) override;
 
+	virtual void EndAbility(const FGameplayAbilitySpecHandle Handle,
+		const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo,
+		bool bReplicateEndAbility, bool bWasCancelled) override;
+
 	UFUNCTION(BlueprintCallable, Category="GASCore|Gameplay Ability")
 	virtual void SpawnActorFromGameplayAbility();
 
+	/**
+	 * Spawn transform for SpawnActorClass: the combat interface's spawn location, facing the avatar's yaw
+	 * (false without a class or a combat interface avatar, and on clients unless bRequireAuthority is false, e.g. for
+	 * locally predicted projectiles).
+	 */
+	bool GetSpawnActorTransform(FTransform& OutSpawnTransform, bool bRequireAuthority = true) const;
+
+	/**
+	 * Spec for SpawnActorEffectClass at the ability level, built once per spawned actor. Source attributes are
+	 * captured here, so every impact of that actor applies the caster's stats at spawn time. Invalid without a class.
+	 */
+	FGameplayEffectSpecHandle MakeSpawnActorEffectSpec() const;
+
+	/** Server: deferred-spawn SpawnActorClass at SpawnTransform carrying EffectSpecHandle as its payload. */
+	AGASCoreSpawnedActorByGameplayAbility* SpawnActorWithPayload(const FTransform& SpawnTransform, const FGameplayEffectSpecHandle& EffectSpecHandle);
+
 	UPROPERTY(EditAnywhere, Category = "GASCore|Projectile Ability|Spawn Actor")
 	TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> SpawnActorClass;
+
+	/** Effect baked into every spawned actor's payload (applied to what it hits). */
+	UPROPERTY(EditAnywhere, Category = "GASCore|Projectile Ability|Spawn Actor")
+	TSubclassOf<UGameplayEffect> SpawnActorEffectClass;
 };
@@ -4,17 +4,85 @@
 
 #include "CoreMinimal.h"
 #include "GASCoreGameplayAbility.h"
+#include "Subsystems/GASCoreLagCompensationSubsystem.h"
 #include "GASCoreProjectileAbility.generated.h"
 
 class AGASCoreSpawnedActorByGameplayAbility;
+
+/** How one activation lays out several projectiles. */
+UENUM(BlueprintType)
+enum class EGASCoreProjectileSpreadMode : uint8
+{
+	/** One projectile along the spawn rotation. */
+	Single,
+	/** SpreadCount projectiles evenly across SpreadAngle (yaw) around the spawn rotation. */
+	Fan,
+	/** SpreadCount projectiles falling from RainHeight onto random points of a disc RainDistance ahead. */
+	Rain
+};
+
 /**
- * 
+ * Ability that fires SpawnActorClass projectiles through UGASCoreProjectilePoolSubsystem (acquired, not spawned).
+ * PoolPrewarmCount projectiles are pooled when the ability is granted on the server.
+ *
+ * Spread modes (Fan / Rain) resolve the spawn transform once, compute every volley transform in one pass, acquire the
+ * whole volley from the pool in bulk and share one baked effect spec across its projectiles.
+ *
+ * Client-predicted projectiles (bClientPredictedProjectiles):
+ * - The predicting client fires local-only projectiles at once; their hits go to the server through
+ *   UGASCoreAbilitySystemComponent::ServerReportProjectileHit.
+ * - The server still spawns replicated copies for everyone else (payload-less, hidden from the instigator) and records
+ *   each shot (origin, direction, speed, time). A reported hit is applied only against an unexpired shot whose launch
+ *   matches and that could have reached the impact in time, with the lag compensation rewind placing the impact on
+ *   the target's capsule at the reported time.
+ * - A hit ends its shot, except piercing shots (every ability target once). With ImpactRadius the payload applies
+ *   around the validated impact, and reports of non-ability impacts only need a valid shot path.
  */
 UCLASS()
 class GASCORE_API UGASCoreProjectileAbility : public UGASCoreGameplayAbility
 {
 	GENERATED_BODY()
 
+public:
+
+	UGASCoreProjectileAbility();
+
+	/** SpawnActorClass projectiles pooled ahead of time when granted (server); sized for the ability's fire rate. */
+	UPROPERTY(EditDefaultsOnly, Category = "GASCore|Projectile Ability|Spawn Actor", meta = (ClampMin = "0"))
+	int32 PoolPrewarmCount = 0;
+
+	UPROPERTY(EditDefaultsOnly, Category = "GASCore|Projectile Ability|Spread")
+	EGASCoreProjectileSpreadMode SpreadMode = EGASCoreProjectileSpreadMode::Single;
+
+	/** Projectiles per activation (spread modes). */
+	UPROPERTY(EditDefaultsOnly, Category = "GASCore|Projectile Ability|Spread", meta = (ClampMin = "1", EditCondition = "SpreadMode != EGASCoreProjectileSpreadMode::Single"))
+	int32 SpreadCount = 5;
+
+	/** Total fan width in degrees. */
+	UPROPERTY(EditDefaultsOnly, Category = "GASCore|Projectile Ability|Spread", meta = (ClampMin = "0.0", ClampMax = "360.0", Units = "deg", EditCondition = "SpreadMode == EGASCoreProjectileSpreadMode::Fan"))
+	float SpreadAngle = 45.f;
+
+	/** Distance ahead of the spawn location of the rain disc centre. */
+	UPROPERTY(EditDefaultsOnly, Category = "GASCore|Projectile Ability|Spread", meta = (Units = "cm", EditCondition = "SpreadMode == EGASCoreProjectileSpreadMode::Rain"))
+	float RainDistance = 600.f;
+
+	/** Radius of the disc the rain lands on. */
+	UPROPERTY(EditDefaultsOnly, Category = "GASCore|Projectile Ability|Spread", meta = (ClampMin = "0.0", Units = "cm", EditCondition = "SpreadMode == EGASCoreProjectileSpreadMode::Rain"))
+	float RainRadius = 300.f;
+
+	/** Height above the disc the rain starts from. */
+	UPROPERTY(EditDefaultsOnly, Category = "GASCore|Projectile Ability|Spread", meta = (ClampMin = "0.0", Units = "cm", EditCondition = "SpreadMode == EGASCoreProjectileSpreadMode::Rain"))
+	float RainHeight = 800.f;
+
+	/** Fire locally on the owning client and validate its reported hits on the server (see class comment). */
+	UPROPERTY(EditDefaultsOnly, Category = "GASCore|Projectile Ability|Networking")
+	bool bClientPredictedProjectiles = false;
+
+	virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+
+	/** Server: a predicting client reports a hit; validated (recorded shot + rewind) before the effect is applied. */
+	void HandleReportedHit(const FGASCoreProjectileHitReport& Report);
+
 protected:
 
 	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle,
@@ -24,5 +92,11 @@ protected:
 	
 	virtual void SpawnActorFromGameplayAbility() override;
 
+	/** Volley transforms for SpreadMode around SpawnTransform (one pass; SpreadCount entries). */
+	void ComputeSpreadTransforms(const FTransform& SpawnTransform, TArray<FTransform, TInlineAllocator<16>>& OutTransforms) const;
+
+private:
+	/** Server: shots fired by the predicting client that no reported hit has ended yet. */
+	TArray<FGASCoreProjectileShot> PredictedShots;
 
 };
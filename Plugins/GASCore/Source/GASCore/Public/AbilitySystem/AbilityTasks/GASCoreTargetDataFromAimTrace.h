@@ -3,13 +3,60 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Abilities/GameplayAbilityTargetTypes.h"
 #include "Abilities/Tasks/AbilityTask.h"
+#include "Engine/NetSerialization.h"
 #include "GASCoreTargetDataFromAimTrace.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAimTraceTargetDataSignature, const FHitResult&, HitResultData);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAimTraceTargetDataHandleSignature, const FGameplayAbilityTargetDataHandle&, DataHandle);
 
 /**
- * 
+ * Compact aim target data: a quantized impact point and the hit actor (sent as its net GUID), instead of the
+ * several hundred bits of a full FHitResult.
+ */
+USTRUCT()
+struct GASCORE_API FGASCoreTargetData_AimPoint : public FGameplayAbilityTargetData
+{
+	GENERATED_BODY()
+
+	/** Cursor impact point (trace end when nothing was hit). */
+	UPROPERTY()
+	FVector_NetQuantize ImpactPoint = FVector::ZeroVector;
+
+	/** Hit actor, if any (must be replicated/stably named to resolve on the server). */
+	UPROPERTY()
+	TWeakObjectPtr<AActor> HitActor;
+
+	// ===== FGameplayAbilityTargetData =====
+
+	virtual bool HasEndPoint() const override { return true; }
+	virtual FVector GetEndPoint() const override { return ImpactPoint; }
+	virtual TArray<TWeakObjectPtr<AActor>> GetActors() const override;
+	virtual UScriptStruct* GetScriptStruct() const override { return StaticStruct(); }
+	virtual FString ToString() const override;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FGASCoreTargetData_AimPoint> : public TStructOpsTypeTraitsBase2<FGASCoreTargetData_AimPoint>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * UGASCoreTargetDataFromAimTrace
+ *
+ * Client-predicted cursor target data:
+ * - Locally controlled: takes this frame's cursor hit (IGASCoreCursorHitInterface on the controller, else
+ *   GetHitResultUnderCursor), sends it to the server as FGASCoreTargetData_AimPoint inside a prediction window,
+ *   and broadcasts at once.
+ * - Server (remote player): waits on AbilityTargetDataSetDelegate (or picks up data that already arrived),
+ *   consumes it and broadcasts.
  */
 UCLASS()
 class GASCORE_API UGASCoreTargetDataFromAimTrace : public UAbilityTask
@@ -19,12 +66,33 @@ class GASCORE_API UGASCoreTargetDataFromAimTrace : public UAbilityTask
 public:
 
 	UFUNCTION(BlueprintCallable, Category = "GASCore|Ability Task|Target Data From Aim Trace", meta = (DisplayName = "TargetDataFromAimTrace", HidePin = "OwningAbility", DefaultToSelf = "OwningAbility", BlueprintInternalUseOnly = "true"))
-	static UGASCoreTargetDataFromAimTrace* CreateTargetDataFromAimTrace(UGameplayAbility* OwningAbility);
+	static UGASCoreTargetDataFromAimTrace* CreateTargetDataFromAimTrace(UGameplayAbility* OwningAbility,
+		TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility);
 
+	/** Aim result as a hit (impact point, location and actor only; the wire carries no more). */
 	UPROPERTY(BlueprintAssignable)
 	FAimTraceTargetDataSignature ValidHitResultData;
 
+	/** Aim result as target data (for ApplyGameplayEffectToTarget / target data helpers). */
+	UPROPERTY(BlueprintAssignable)
+	FAimTraceTargetDataHandleSignature ValidData;
+
 private:
 
 	virtual void Activate() override;
+	virtual void OnDestroy(bool bInOwnerFinished) override;
+
+	/** Local client: trace, send to the server, broadcast. */
+	void SendAimTraceData();
+
+	/** Server: the client's data arrived. */
+	void OnTargetDataReplicatedCallback(const FGameplayAbilityTargetDataHandle& DataHandle, FGameplayTag ActivationTag);
+
+	/** Fire both delegates (if the ability still wants them). */
+	void BroadcastTargetData(const FGameplayAbilityTargetDataHandle& DataHandle);
+
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+
+	/** Server: our AbilityTargetDataSetDelegate binding. */
+	FDelegateHandle TargetDataDelegateHandle;
 };
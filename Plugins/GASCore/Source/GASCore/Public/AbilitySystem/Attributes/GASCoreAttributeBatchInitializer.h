@@ -0,0 +1,58 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystem/Formulas/GASCoreAttributeFormulas.h"
+
+class UGASCoreAttributeSet;
+class UGASCoreAttributeArchetypeDataAsset;
+
+/**
+ * FGASCoreAttributeBatchInitializer
+ *
+ * Initializes many attribute sets at once (wave spawns) without GameplayEffect specs:
+ * 1) Archetype base values per set (primaries and any other listed attribute).
+ * 2) Primaries gathered into structure-of-arrays buffers (class formula inputs, see BindFormulaInputs).
+ * 3) GASCoreFormulas::EvaluateAllBatch: every secondary, FGASCoreFormulaBatch::Lanes actors per SIMD step.
+ * 4) Results written as base values (Maxes first), then paired Currents filled to their Max
+ *    (what the Primary/Secondary/Vital init GEs of UGASCoreAttributeInitComponent did per actor).
+ *
+ * Notes:
+ * - Server only; sets owned by non-authoritative actors are skipped (clients get the replicated result), except
+ *   sets with deferred initial replication, which clients initialize the same way (see SetDeferInitialReplication).
+ * - Classes without formula bindings fall back to the per-set path (archetype + derived graph recompute).
+ * - Sets that ask for the derived graph get it enabled afterwards, already up to date (no end-of-frame recompute).
+ */
+class GASCORE_API FGASCoreAttributeBatchInitializer
+{
+public:
+	/** Queue Set for initialization from Archetype at Level (Archetype may be null: formulas only). */
+	void Add(UGASCoreAttributeSet* Set, const UGASCoreAttributeArchetypeDataAsset* Archetype, int32 Level, bool bEvaluateDerivedAttributes);
+
+	int32 Num() const { return Entries.Num(); }
+
+	/** Initialize every queued set and clear the queue. */
+	void Execute(const FGASCoreFormulaCoefficients& Coefficients = FGASCoreFormulaCoefficients::GetDefault());
+
+	/** Drop queued sets without initializing them. */
+	void Reset() { Entries.Reset(); }
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<UGASCoreAttributeSet> Set;
+		TWeakObjectPtr<const UGASCoreAttributeArchetypeDataAsset> Archetype;
+		int32 Level = 1;
+		bool bEvaluateDerivedAttributes = false;
+	};
+
+	/** Run steps 1-4 for sets sharing one class table. */
+	void ExecuteGroup(TConstArrayView<UGASCoreAttributeSet*> Sets, TConstArrayView<const FEntry*> GroupEntries,
+		const FGASCoreFormulaCoefficients& Coefficients);
+
+	TArray<FEntry> Entries;
+
+	/** SoA scratch, reused across waves. */
+	FGASCoreFormulaBatch Batch;
+};
@@ -0,0 +1,234 @@
+// © 2025 Heathrow (Derman). All rights reserved.
+// This project is the intellectual property of Heathrow (Derman) and is protected by copyright law.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+//
+// File: GASCoreAttributeMetadata.h (header)
+// Purpose:
+//   - Per-UClass attribute metadata for UGASCoreAttributeSet: Current↔Max partners, quantization, clamp bounds.
+//   - Built once per attribute set class (not per instance) and shared by every instance of that class.
+//
+// Why:
+//   - Per-instance TMap<FGameplayAttribute, FGameplayAttribute> pairings were duplicated on every enemy/player set
+//     and hashed on the hottest GAS callbacks (PreAttributeChange, PreAttributeBaseChange, PostGameplayEffectExecute).
+//
+// Layout:
+//   - Every FGameplayAttributeData property of the class gets an ordinal (reflection order, super class first).
+//   - All per-attribute data lives in flat arrays indexed by that ordinal.
+//   - GetOrdinal maps an FGameplayAttribute to its ordinal in O(1) via the property's byte offset
+//     (FGameplayAttributeData fields never share an alignment slot), no hashing.
+//   - Offsets[Ordinal] is the byte offset of the FGameplayAttributeData inside the set, so value reads are
+//     pointer arithmetic instead of GetUProperty/CastField/struct checks. Non-shipping builds validate every
+//     offset against reflection when the table is built.
+//   - Quantizers[Ordinal] holds precomputed scale/inverse scale: ConfigureAttributeMetadata first, then the CDO's
+//     AttributeQuantization entries (designer overrides win).
+//   - Derivations: derived attributes (e.g., Armor ← Endurance, BlockChance ← Armor) with native formulas, stored
+//     in dependency order. DependentDerivations[Ordinal] lists the derivations that read that attribute, so a
+//     change dirties only those (see UGASCoreAttributeSet::FlushDerivedAttributes).
+//   - FormulaInputOrdinals / FormulaOutputs: which attributes feed and receive the native GDD formulas
+//     (GASCoreFormulas), used by the SoA wave-spawn path (FGASCoreAttributeBatchInitializer).
+//   - Regenerations: Current ← per-second rate pairs integrated natively by UGASCoreRegenerationSubsystem.
+//   - MetaTargetOrdinals[Ordinal]: meta damage attribute → vital it drains (UGASCoreExecCalcDamage output).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "AbilitySystem/Attributes/GASCoreAttributeQuantization.h"
+#include "AbilitySystem/Attributes/GASCoreAttributeSchema.h"
+#include "AbilitySystem/Formulas/GASCoreAttributeFormulas.h"
+
+class UGASCoreAttributeSet;
+
+/** Native formula of a derived attribute; reads current values from the set. */
+using FGASCoreDerivedAttributeFormula = float(*)(const UGASCoreAttributeSet& Set);
+
+/** One derived attribute of a class. */
+struct FGASCoreDerivedAttribute
+{
+	/** Ordinal of the attribute the formula writes. */
+	int32 Ordinal = INDEX_NONE;
+
+	FGASCoreDerivedAttributeFormula Formula = nullptr;
+};
+
+/** One regenerating attribute of a class (bounded by its paired Max, if any). */
+struct FGASCoreRegeneration
+{
+	/** Ordinal of the regenerating Current (e.g., Health). */
+	int32 CurrentOrdinal = INDEX_NONE;
+
+	/** Ordinal of its per-second rate (e.g., HealthRegeneration; negative rates degenerate). */
+	int32 RateOrdinal = INDEX_NONE;
+};
+
+/**
+ * Immutable (after build) per-class attribute table. Obtain via FGASCoreAttributeMetadata::Get.
+ */
+struct GASCORE_API FGASCoreAttributeMetadata
+{
+	/** Attribute handle per ordinal (prebuilt so callbacks never construct FGameplayAttribute from a property). */
+	TArray<FGameplayAttribute> Attributes;
+
+	/** Backing struct property per ordinal. */
+	TArray<FStructProperty*> Properties;
+
+	/** Byte offset of each attribute's FGameplayAttributeData inside an instance of the class. */
+	TArray<int32> Offsets;
+
+	/** Attributes stored as FGASCoreFixedPointAttributeData (clamped with integer comparisons). */
+	TBitArray<> FixedPoint;
+
+	/** Current → Max partner ordinal (INDEX_NONE when the attribute is not a clamped Current). */
+	TArray<int32> MaxOrdinals;
+
+	/** Max → Current partner ordinal (INDEX_NONE when the attribute is not a Max). */
+	TArray<int32> CurrentOrdinals;
+
+	/** Rounding policy (decimals, precomputed scale, integer storage) applied to writes to this attribute. */
+	TArray<FGASCoreAttributeQuantizer> Quantizers;
+
+	/** Static clamp bounds. Paired Currents additionally clamp to their Max's CurrentValue. */
+	TArray<FVector2f> ClampRanges;
+
+	/** Derived attributes in dependency order (sources before the derivations reading them). */
+	TArray<FGASCoreDerivedAttribute> Derivations;
+
+	/** Per ordinal: indices into Derivations of the formulas that read that attribute directly. */
+	TArray<TArray<int32>> DependentDerivations;
+
+	/** Ordinal of each formula primary input (GASCoreFormulas::EPrimaryInput order; INDEX_NONE = unbound, reads 0). */
+	int32 FormulaInputOrdinals[GASCoreFormulas::NumPrimaryInputs];
+
+	/** Formula results written to this class's attributes (formula, ordinal). */
+	TArray<TPair<EGASCoreSecondaryFormula, int32>> FormulaOutputs;
+
+	/** Natively regenerated attributes. */
+	TArray<FGASCoreRegeneration> Regenerations;
+
+	/** Meta attribute → attribute it is subtracted from (INDEX_NONE = not a meta attribute). */
+	TArray<int32> MetaTargetOrdinals;
+
+	/** True when the class bound its attributes to the native formulas. */
+	bool HasFormulaBindings() const { return !FormulaOutputs.IsEmpty(); }
+
+	/** Number of attributes in the class. */
+	int32 Num() const { return Properties.Num(); }
+
+	/** Heap bytes of the table (shared by every instance of the class). */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Visit every table built so far (under the registry lock; do not build tables from Visitor). */
+	static void ForEachTable(TFunctionRef<void(const UClass& Class, const FGASCoreAttributeMetadata& Metadata)> Visitor);
+
+	/** O(1) ordinal of Attribute in this class, INDEX_NONE if it does not belong to it. */
+	FORCEINLINE int32 GetOrdinal(const FGameplayAttribute& Attribute) const
+	{
+		const FProperty* Property = Attribute.GetUProperty();
+		if (!Property)
+		{
+			return INDEX_NONE;
+		}
+		const int32 Slot = Property->GetOffset_ForInternal() / SlotBytes;
+		const int32 Ordinal = SlotToOrdinal.IsValidIndex(Slot) ? SlotToOrdinal[Slot] : INDEX_NONE;
+		return (Ordinal != INDEX_NONE && Properties[Ordinal] == Property) ? Ordinal : INDEX_NONE;
+	}
+
+	/** Table for Set's class; built on first request (from the class CDO), then shared. */
+	static const FGASCoreAttributeMetadata& Get(const UGASCoreAttributeSet* Set);
+
+	/**
+	 * Build the tables of every loaded native attribute set class on a worker task (game thread only; startup).
+	 * A Get racing the task waits on the registry lock for the table being built, so first use never sees a
+	 * partial table.
+	 */
+	static void PrewarmAsync();
+
+#if WITH_EDITOR
+	/** Re-run ConfigureAttributeMetadata + CDO quantization for an already built table (CDO edited in the editor). */
+	static void RefreshFromDefaults(const UGASCoreAttributeSet* CDO);
+#endif
+
+private:
+	friend class FGASCoreAttributeMetadataBuilder;
+
+	/** Reset pairs/quantization/bounds and apply the CDO's configuration. */
+	void Configure(const UGASCoreAttributeSet* CDO);
+
+	/** Byte offset granularity of the offset → ordinal table. */
+	static constexpr int32 SlotBytes = alignof(FGameplayAttributeData);
+
+	/** Property offset / SlotBytes → ordinal (INDEX_NONE for non-attribute slots). */
+	TArray<int16> SlotToOrdinal;
+};
+
+/**
+ * Passed to UGASCoreAttributeSet::ConfigureAttributeMetadata while a class table is being built.
+ * Unknown attributes (not on the class being built) are ignored.
+ */
+class GASCORE_API FGASCoreAttributeMetadataBuilder
+{
+public:
+	explicit FGASCoreAttributeMetadataBuilder(FGASCoreAttributeMetadata& InMetadata) : Metadata(InMetadata) {}
+
+	/** Clamp Current to [0, Max] (both directions are recorded; Max changes re-clamp Current). */
+	void RegisterCurrentMaxPair(const FGameplayAttribute& Current, const FGameplayAttribute& Max);
+
+	/** Decimals kept for Attribute (overrides DefaultRoundingDecimals). */
+	void SetRoundingDecimals(const FGameplayAttribute& Attribute, int32 Decimals);
+
+	/** Whole-number storage for Attribute (decimals 0, compact replication with FGASCoreQuantizedAttributeData). */
+	void SetIntegerStorage(const FGameplayAttribute& Attribute, bool bIntegerStorage = true);
+
+	/** Static clamp range for Attribute (paired Currents still take min(MaxClamp, Max value)). */
+	void SetClampRange(const FGameplayAttribute& Attribute, float MinValue, float MaxValue);
+
+	/**
+	 * Derived attribute: Formula computes Derived from the current values of Sources.
+	 * Sources may be derived themselves (evaluation follows dependency order; cycles are rejected).
+	 */
+	void DeclareDerivedAttribute(const FGameplayAttribute& Derived, TConstArrayView<FGameplayAttribute> Sources,
+		FGASCoreDerivedAttributeFormula Formula);
+
+	/** Attributes read as the native formula inputs (GASCoreFormulas). */
+	void BindFormulaInputs(const FGameplayAttribute& Strength, const FGameplayAttribute& Dexterity, const FGameplayAttribute& Intelligence,
+		const FGameplayAttribute& Endurance, const FGameplayAttribute& Vigor);
+
+	/** Attribute receiving the result of Formula in batched evaluation. */
+	void BindFormulaOutput(EGASCoreSecondaryFormula Formula, const FGameplayAttribute& Attribute);
+
+	/** Current regenerates by Rate per second (UGASCoreRegenerationSubsystem), clamped to [0, Max]. */
+	void RegisterRegeneration(const FGameplayAttribute& Current, const FGameplayAttribute& Rate);
+
+	/** Meta attribute (not replicated) whose executed value is consumed and subtracted from Target (e.g., IncomingDamage → Health). */
+	void RegisterIncomingDamage(const FGameplayAttribute& Meta, const FGameplayAttribute& Target);
+
+	/**
+	 * Apply a set's attribute schema (GASCoreAttributeSchema.h): Current↔Max pairs, regeneration and decimals per row.
+	 * Non-shipping builds also check the literal declarations against it (see ValidateSchema).
+	 */
+	void ApplySchema(TConstArrayView<FGASCoreAttributeSchemaRow> Rows);
+
+private:
+	friend struct FGASCoreAttributeMetadata;
+
+	/** Sort declared derivations by dependency and build DependentDerivations. */
+	void FinalizeDerivations();
+
+	/** Ordinal of the attribute property named Name (INDEX_NONE for "" or unknown names). */
+	int32 FindOrdinalByName(const TCHAR* Name) const;
+
+#if !UE_BUILD_SHIPPING
+	/** Unknown rows, RepNotify ≠ OnRep_Name, declaration order ≠ schema order, replicated attributes missing a row. */
+	void ValidateSchema(TConstArrayView<FGASCoreAttributeSchemaRow> Rows, TConstArrayView<int32> RowOrdinals) const;
+#endif
+
+	struct FPendingDerivation
+	{
+		int32 Ordinal = INDEX_NONE;
+		TArray<int32> SourceOrdinals;
+		FGASCoreDerivedAttributeFormula Formula = nullptr;
+	};
+
+	FGASCoreAttributeMetadata& Metadata;
+	TArray<FPendingDerivation> PendingDerivations;
+};
@@ -0,0 +1,163 @@
+// © 2025 Heathrow (Derman). All rights reserved.
+// This project is the intellectual property of Heathrow (Derman) and is protected by copyright law.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+//
+// File: GASCoreAttributeQuantization.h (header)
+// Purpose:
+//   - Per-attribute quantization policy (decimals / integer storage) editable on an attribute set CDO.
+//   - Precomputed runtime quantizer (scale + inverse scale) stored in the per-class metadata table.
+//   - FGASCoreQuantizedAttributeData: FGameplayAttributeData with a compact net serializer for whole-number values.
+//   - FGASCoreFixedPointAttributeData: fixed-point storage (scaled int32) with a variable-length net serializer.
+//
+// Why:
+//   - Rounding called FMath::Pow(10, Decimals) on every attribute write; the scale is now computed once per class.
+//   - Vitals (Health/Mana/Stamina and their Max) are whole numbers by policy, so they can replicate as 16-bit
+//     integers instead of two 32-bit floats.
+//
+// Replication:
+//   - FGASCoreQuantizedAttributeData::NetSerialize picks the encoding per value: whole numbers inside the
+//     int16 range go out as 16-bit integers, anything else falls back to full floats (always lossless).
+//     The quantization table is what guarantees the compact path for integer-storage attributes.
+//   - Base and Current are usually equal outside of active Duration effects; that case sends a single value.
+//   - FGASCoreFixedPointAttributeData::NetSerialize sends the scaled integers as zigzag varints (whole numbers
+//     divided by the scale first), so small vitals take one or two bytes and the wire value is exact.
+//
+// Fixed point:
+//   - The scaled integers are authoritative; the float Base/Current mirror them exactly (every write goes
+//     through SetBaseValue/SetCurrentValue, which round once). Same inputs → same bits on every machine.
+//   - UGASCoreAttributeSet clamps fixed-point Currents against fixed-point Maxes with integer comparisons.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "GASCoreAttributeQuantization.generated.h"
+
+/**
+ * Designer-facing quantization entry (UGASCoreAttributeSet::AttributeQuantization).
+ * Entries override ConfigureAttributeMetadata for the same attribute.
+ */
+USTRUCT(BlueprintType)
+struct GASCORE_API FGASCoreAttributeQuantization
+{
+	GENERATED_BODY()
+
+	/** Attribute of the owning set this entry applies to (others are ignored). */
+	UPROPERTY(EditAnywhere, Category="GAS|Attributes")
+	FGameplayAttribute Attribute;
+
+	/** Decimals kept on every write (ignored with bIntegerStorage). */
+	UPROPERTY(EditAnywhere, Category="GAS|Attributes", meta=(ClampMin="0", ClampMax="6", EditCondition="!bIntegerStorage"))
+	int32 Decimals = 0;
+
+	/** Whole-number semantics: every write rounds to an integer, which also enables compact replication. */
+	UPROPERTY(EditAnywhere, Category="GAS|Attributes")
+	bool bIntegerStorage = false;
+};
+
+/**
+ * Runtime quantizer for one attribute (precomputed, lives in FGASCoreAttributeMetadata).
+ */
+struct GASCORE_API FGASCoreAttributeQuantizer
+{
+	/** Largest supported decimals (10^6 still fits float precision for typical attribute magnitudes). */
+	static constexpr int32 MaxDecimals = 6;
+
+	int32 Decimals = 0;
+	float Scale = 1.f;
+	float InvScale = 1.f;
+	bool bIntegerStorage = false;
+
+	/** Quantizer keeping Decimals fractional digits (clamped to [0, MaxDecimals]; integer storage forces 0). */
+	static FGASCoreAttributeQuantizer Make(int32 InDecimals, bool bInIntegerStorage);
+
+	/** 10^Decimals for Decimals in [0, MaxDecimals] (table lookup, no Pow). */
+	static float GetScale(int32 InDecimals);
+
+	/** Round Value to this quantizer's precision (in float: attributes are unclamped and may exceed int32 once scaled). */
+	FORCEINLINE float Quantize(const float Value) const
+	{
+		return FMath::RoundToFloat(Value * Scale) * InvScale;
+	}
+};
+
+/**
+ * FGameplayAttributeData with a compact net serializer (see file header).
+ * Drop-in replacement for attribute properties; RepNotify parameters must use this type.
+ */
+USTRUCT(BlueprintType)
+struct GASCORE_API FGASCoreQuantizedAttributeData : public FGameplayAttributeData
+{
+	GENERATED_BODY()
+
+	FGASCoreQuantizedAttributeData() = default;
+	FGASCoreQuantizedAttributeData(const float DefaultValue) : FGameplayAttributeData(DefaultValue) {}
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+/**
+ * FGameplayAttributeData stored as fixed point: round(Value * Scale) in int32 (see file header).
+ * Drop-in replacement for attribute properties; RepNotify parameters must use this type.
+ */
+USTRUCT(BlueprintType)
+struct GASCORE_API FGASCoreFixedPointAttributeData : public FGameplayAttributeData
+{
+	GENERATED_BODY()
+
+	/** Fixed-point scale (two decimals; ±21 million range). */
+	static constexpr int32 Scale = 100;
+
+	FGASCoreFixedPointAttributeData() = default;
+	FGASCoreFixedPointAttributeData(const float DefaultValue)
+	{
+		FGASCoreFixedPointAttributeData::SetBaseValue(DefaultValue);
+		FGASCoreFixedPointAttributeData::SetCurrentValue(DefaultValue);
+	}
+
+	virtual void SetCurrentValue(float NewValue) override;
+	virtual void SetBaseValue(float NewValue) override;
+
+	int32 GetCurrentFixed() const { return CurrentFixed; }
+	int32 GetBaseFixed() const { return BaseFixed; }
+
+	/** Value → scaled integer (round to nearest, saturating). */
+	static FORCEINLINE int32 ToFixed(const float Value)
+	{
+		return static_cast<int32>(FMath::Clamp<int64>(FMath::RoundToInt64(static_cast<double>(Value) * Scale), MIN_int32, MAX_int32));
+	}
+
+	/** Scaled integer → value. */
+	static FORCEINLINE float ToFloat(const int32 Fixed)
+	{
+		return static_cast<float>(static_cast<double>(Fixed) / Scale);
+	}
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	/** Rebuild the integers from the serialized float mirror (assets, save games, editor defaults). */
+	void PostSerialize(const FArchive& Ar);
+
+private:
+	int32 BaseFixed = 0;
+	int32 CurrentFixed = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits<FGASCoreFixedPointAttributeData> : public TStructOpsTypeTraitsBase2<FGASCoreFixedPointAttributeData>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithPostSerialize = true,
+	};
+};
+
+template<>
+struct TStructOpsTypeTraits<FGASCoreQuantizedAttributeData> : public TStructOpsTypeTraitsBase2<FGASCoreQuantizedAttributeData>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
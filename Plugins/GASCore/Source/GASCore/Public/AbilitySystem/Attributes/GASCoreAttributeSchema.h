@@ -0,0 +1,106 @@
+// © 2025 Heathrow (Derman). All rights reserved.
+// This project is the intellectual property of Heathrow (Derman) and is protected by copyright law.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+//
+// File: GASCoreAttributeSchema.h (header)
+// Purpose:
+//   - One attribute schema per set drives everything about an attribute that UHT does not need to see:
+//     accessors, RepNotify bodies, DOREPLIFETIME registration, per-tier dynamic conditions, metadata
+//     (Current↔Max clamp partner, regeneration rate, decimals) and the native attribute tag.
+//
+// Why:
+//   - Adding an attribute used to touch six places (UPROPERTY, accessors, OnRep, DOREPLIFETIME, native tag,
+//     metadata registration), and each of them had its own order. Declaration order also decides memory layout.
+//
+// Schema format (X-macro, see TDAttributeSchema.h):
+//   #define MY_ATTRIBUTE_SCHEMA(X, Class) \
+//       X(Class, Name, DataType, Tier, MaxAttribute, RegenAttribute, Decimals, TagName, Tag, Comment) \
+//       ...
+//   - Name:           the FGameplayAttributeData (or FGASCoreFixedPointAttributeData) property.
+//   - DataType:       the property's type (also the RepNotify parameter type).
+//   - Tier:           replication tier expression, passed to Class::GetTierReplicationCondition.
+//   - MaxAttribute:   Max partner this attribute is clamped to, or empty.
+//   - RegenAttribute: per-second regeneration rate attribute, or empty.
+//   - Decimals:       -1 = DefaultRoundingDecimals, 0 = integer storage, N = rounded to N decimals.
+//   - TagName/Tag/Comment: native gameplay tag bound to the attribute (GASCORE_DEFINE_ATTRIBUTE_TAG).
+//
+// UHT limits:
+//   - UHT does not expand macros, so the UPROPERTY(ReplicatedUsing=OnRep_Name) and UFUNCTION() OnRep_Name
+//     declarations stay literal in the class. FGASCoreAttributeMetadataBuilder::ApplySchema checks them against
+//     the schema when the class table is built (missing rows, wrong RepNotify, declaration order ≠ schema order).
+//   - Declare the properties in schema order: the schema order is the memory layout (hot vitals first).
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** One schema row as seen at runtime (names are resolved against the class reflection data). */
+struct FGASCoreAttributeSchemaRow
+{
+	/** Attribute property name. */
+	const TCHAR* Name = nullptr;
+
+	/** Max partner property name ("" = not a clamped Current). */
+	const TCHAR* MaxAttribute = TEXT("");
+
+	/** Regeneration rate property name ("" = does not regenerate). */
+	const TCHAR* RegenAttribute = TEXT("");
+
+	/** -1 = default rounding, 0 = integer storage, N = N decimals. */
+	int32 Decimals = INDEX_NONE;
+};
+
+// ---------------------------------------------------------------------------------------------------------------
+// Emitters: pass one of these as X to the set's schema macro.
+// ---------------------------------------------------------------------------------------------------------------
+
+/** Class body: ATTRIBUTE_ACCESSORS for every row. */
+#define GASCORE_ATTRIBUTE_SCHEMA_ACCESSORS(Class, Name, DataType, Tier, MaxAttribute, RegenAttribute, Decimals, TagName, Tag, Comment) \
+	ATTRIBUTE_ACCESSORS(Class, Name)
+
+/** .cpp: OnRep_Name definitions (regenerating attributes also reset their regeneration baseline). */
+#define GASCORE_ATTRIBUTE_SCHEMA_REPNOTIFY(Class, Name, DataType, Tier, MaxAttribute, RegenAttribute, Decimals, TagName, Tag, Comment) \
+	void Class::OnRep_##Name(const DataType& Old##Name) const \
+	{ \
+		NotifyAttributeReplicated(Get##Name##Attribute()); \
+		GAMEPLAYATTRIBUTE_REPNOTIFY(Class, Name, Old##Name); \
+		if constexpr (sizeof(#RegenAttribute) > 1) \
+		{ \
+			NotifyRegeneratingAttributeReplicated(Get##Name##Attribute()); \
+		} \
+	}
+
+/** GetLifetimeReplicatedProps: registers every row with the FDoRepLifetimeParams local named Params. */
+#define GASCORE_ATTRIBUTE_SCHEMA_LIFETIME(Class, Name, DataType, Tier, MaxAttribute, RegenAttribute, Decimals, TagName, Tag, Comment) \
+	DOREPLIFETIME_WITH_PARAMS_FAST(Class, Name, Params);
+
+/** GetReplicatedCustomConditionState: seeds every row's COND_Dynamic condition from its tier (COND_Never while deferred). */
+#define GASCORE_ATTRIBUTE_SCHEMA_CONDITION(Class, Name, DataType, Tier, MaxAttribute, RegenAttribute, Decimals, TagName, Tag, Comment) \
+	DOREPDYNAMICCONDITION_INITCONDITION_FAST(Class, Name, GetInitialReplicationCondition(Get##Name##Attribute(), GetTierReplicationCondition(Tier)));
+
+/** OnAttributeLeftInitialization(Attribute): switches the matching row from COND_Never to its tier condition. */
+#define GASCORE_ATTRIBUTE_SCHEMA_LIVE_CONDITION(Class, Name, DataType, Tier, MaxAttribute, RegenAttribute, Decimals, TagName, Tag, Comment) \
+	if (Attribute == Get##Name##Attribute()) \
+	{ \
+		DOREPDYNAMICCONDITION_SETCONDITION_FAST(Class, Name, GetTierReplicationCondition(Tier)); \
+		return; \
+	}
+
+/** GetAttributeReplicationCondition(Attribute): the matching row's current condition (COND_Never while still deferred). */
+#define GASCORE_ATTRIBUTE_SCHEMA_CURRENT_CONDITION(Class, Name, DataType, Tier, MaxAttribute, RegenAttribute, Decimals, TagName, Tag, Comment) \
+	if (Attribute == Get##Name##Attribute()) \
+	{ \
+		return GetInitialReplicationCondition(Attribute, GetTierReplicationCondition(Tier)); \
+	}
+
+/** Static FGASCoreAttributeSchemaRow table initializer (feed the table to FGASCoreAttributeMetadataBuilder::ApplySchema). */
+#define GASCORE_ATTRIBUTE_SCHEMA_ROW(Class, Name, DataType, Tier, MaxAttribute, RegenAttribute, Decimals, TagName, Tag, Comment) \
+	FGASCoreAttributeSchemaRow{ GET_MEMBER_NAME_STRING_CHECKED(Class, Name), TEXT(#MaxAttribute), TEXT(#RegenAttribute), Decimals },
+
+/** Header (inside the tag namespace): UE_DECLARE_GAMEPLAY_TAG_EXTERN for every row. */
+#define GASCORE_ATTRIBUTE_SCHEMA_DECLARE_TAG(Class, Name, DataType, Tier, MaxAttribute, RegenAttribute, Decimals, TagName, Tag, Comment) \
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(TagName);
+
+/** .cpp (inside the tag namespace): native tag definition bound to the attribute (needs GASCoreAttributeTagRegistry.h). */
+#define GASCORE_ATTRIBUTE_SCHEMA_DEFINE_TAG(Class, Name, DataType, Tier, MaxAttribute, RegenAttribute, Decimals, TagName, Tag, Comment) \
+	GASCORE_DEFINE_ATTRIBUTE_TAG(TagName, Tag, Comment, Class, Name);
@@ -16,8 +16,10 @@
 // Usage (recommended pattern):
 //   1) Derive your game AttributeSet from UGASCoreAttributeSet.
 //   2) Declare your attributes (UPROPERTY FGameplayAttributeData …).
-//   3) In your derived class constructor, call RegisterCurrentMaxPair for each Current↔Max pair (e.g., Health↔MaxHealth).
-//   4) Optionally override GetRoundingDecimals to use different precision per attribute (e.g., 0 for vitals, 2 for regen).
+//   3) Override ConfigureAttributeMetadata and call Builder.RegisterCurrentMaxPair for each Current↔Max pair
+//      (e.g., Health↔MaxHealth). It runs once per class, not per instance (see GASCoreAttributeMetadata.h).
+//   4) Optionally set per-attribute precision/bounds there too (Builder.SetRoundingDecimals / SetIntegerStorage /
+//      SetClampRange), or per asset through AttributeQuantization on the set's defaults.
 //   5) Let the base handle PreAttributeChange, PreAttributeBaseChange, and PostGameplayEffectExecute clamping and rounding.
 //
 // Notes on clamping callbacks:
@@ -28,7 +30,7 @@
 //
 // Rounding policy:
 //   - By default, all attribute writes (Current and Base) are rounded to DefaultRoundingDecimals (default 0 → integers).
-//   - Override GetRoundingDecimals to customize per attribute.
+//   - Per-attribute decimals / integer storage come from the class metadata table (precomputed scale, no Pow per write).
 //
 // Effect context helper:
 //   - FGASCoreEffectContext is a lightweight, GC-safe container of source/target references available in GE callbacks.
@@ -36,12 +38,54 @@
 //
 // Replication:
 //   - This base does not declare any attributes; derived sets should handle DOREPLIFETIME + RepNotify as needed.
+//   - Integer-storage attributes declared as FGASCoreQuantizedAttributeData replicate as 16-bit integers;
+//     FGASCoreFixedPointAttributeData stores scaled int32s, clamps against its Max as integers and replicates varints
+//     (see GASCoreAttributeQuantization.h).
+//   - Push model: the base marks an attribute's property dirty whenever its Base or Current value changes
+//     (PostAttributeChange / PostAttributeBaseChange), so derived sets can register attributes with
+//     bIsPushBased = true. Raw InitX() initters bypass GAS callbacks; call MarkAttributeDirty after using them.
+//
+// Archetype initialization (mass enemies):
+//   - InitializeFromArchetype writes base values from a shared per-archetype, per-level table instead of
+//     applying init GameplayEffects (no specs, active effects or aggregators per instance).
+//   - Copy-on-write: instances only allocate a divergence mask once a base value actually leaves the archetype;
+//     SetArchetypeLevel then re-levels the untouched attributes and leaves diverged ones alone.
+//   - Deferred initial replication (SetDeferInitialReplication): archetype initialization is deterministic, so
+//     clients run it too from the owner's replicated archetype and level. Attributes do not replicate until they
+//     first change outside initialization on the server; a spawn sends the archetype and level, not every value.
+//
+// Derived attributes (opt-in per instance, SetEvaluateDerivedAttributes):
+//   - Builder.DeclareDerivedAttribute declares Derived ← Sources with a native formula, once per class.
+//   - A Current change on a source dirties only the derivations reading it; dirty derivations are recomputed
+//     at end of frame (or on FlushDerivedAttributes) in dependency order and written as base values (server).
+//   - Replaces infinite MMC GameplayEffects for those attributes; do not drive the same attribute with both.
+//
+// Batched initialization (wave spawns):
+//   - Classes that bind the native formulas (Builder.BindFormulaInputs / BindFormulaOutput) can be initialized many
+//     at a time by FGASCoreAttributeBatchInitializer (queued per frame by UGASCoreAttributeBatchSubsystem).
+//
+// Native regeneration (Builder.RegisterRegeneration):
+//   - Server: UGASCoreRegenerationSubsystem integrates every registered set at a low fixed rate and only writes
+//     (and so replicates) a vital once the accumulated amount crosses a threshold or the vital hits a bound.
+//   - Clients: GetExtrapolatedValue continues the vital from its last replicated value with the replicated rate;
+//     the set's RepNotify calls NotifyRegeneratingAttributeReplicated to restart the extrapolation (correction).
+//   - Replaces periodic regeneration GameplayEffects for those attributes; do not drive them with both.
+//
+// Deferred Max clamping (opt-in per instance, SetDeferMaxClamp):
+//   - PostGameplayEffectExecute on a Max only flags its Current; one clamp pass per flagged Current runs at end of
+//     frame (or on FlushMaxClamps), so several Max-changing executions in a frame (gear swaps) write and broadcast
+//     the Current once. Until then the Current may briefly exceed its new Max.
+//
+// Incoming damage (meta attribute):
+//   - Builder.RegisterIncomingDamage(Meta, Health): PostGameplayEffectExecute reads the executed meta value
+//     (written by UGASCoreExecCalcDamage), resets it to 0 and subtracts it from the target (clamped as usual).
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "AttributeSet.h"
 #include "GameplayEffectTypes.h"
+#include "AbilitySystem/Attributes/GASCoreAttributeMetadata.h"
 #include "GASCoreAttributeSet.generated.h"
 
 // Forward declarations (keep header lean)
@@ -49,6 +93,7 @@ class UAbilitySystemComponent;
 class AActor;
 class AController;
 class ACharacter;
+class UGASCoreAttributeArchetypeDataAsset;
 struct FGameplayEffectModCallbackData;
 
 // Same ATTRIBUTE_ACCESSORS macro you already use
@@ -118,7 +163,7 @@ struct FGASCoreEffectContext
  * UGASCoreAttributeSet
  *
  * Abstract base AttributeSet that provides:
- * - Registration of Current↔Max attribute pairs (e.g., Health↔MaxHealth).
+ * - Registration of Current↔Max attribute pairs (e.g., Health↔MaxHealth) in a per-class metadata table.
  * - Automatic clamping so Current ∈ [0, Max] in PreAttributeChange and PreAttributeBaseChange.
  * - Final authoritative clamping in PostGameplayEffectExecute when Max changes.
  * - A rounding policy applied consistently to both Current and Base values.
@@ -137,15 +182,116 @@ class GASCORE_API UGASCoreAttributeSet : public UAttributeSet
 public:
 	UGASCoreAttributeSet();
 
+	// ----------------------
+	// Archetype initialization
+	// ----------------------
+
+	/**
+	 * Server: write the archetype's base values at Level (through the ASC, so modifiers aggregate normally).
+	 * Attributes the archetype does not list keep their current values.
+	 */
+	void InitializeFromArchetype(const UGASCoreAttributeArchetypeDataAsset* InArchetype, int32 Level);
+
+	/** Server: re-level every attribute that has not diverged from the archetype. */
+	void SetArchetypeLevel(int32 Level);
+
+	/** True once Attr's base value was changed away from the archetype value (e.g., by an Instant GE). */
+	bool HasDivergedFromArchetype(const FGameplayAttribute& Attr) const;
+
+	/**
+	 * Server: return every attribute to its class default (CDO) value for reuse of a pooled owner. Clears the
+	 * archetype link, divergence, the derived graph and pending Max clamps. Remove active effects first
+	 * (UGASCoreAbilitySystemComponent::ResetForReuse) so no modifier sits on top of the defaults.
+	 */
+	void ResetToClassDefaults();
+
+	/** Heap bytes of this instance's own state (divergence, deferred replication, derived / clamp dirt, regen baselines). */
+	SIZE_T GetInstanceAllocatedSize() const;
+
+	/**
+	 * Deferred initial replication (server and clients, before the set starts replicating): attributes start with
+	 * COND_Never (GetInitialReplicationCondition) and clients initialize them locally (batch initializer), until the
+	 * server changes them outside initialization; OnAttributeLeftInitialization then switches them to their condition.
+	 */
+	void SetDeferInitialReplication(bool bDefer) { bDeferInitialReplication = bDefer; }
+
+	bool IsInitialReplicationDeferred() const { return bDeferInitialReplication; }
+
+	/** Condition Attr starts replicating with: COND_Never while deferred and still at its initialized value. */
+	ELifetimeCondition GetInitialReplicationCondition(const FGameplayAttribute& Attr, ELifetimeCondition Condition) const;
+
+	/** Clients, deferred initial replication: a value arrived for Attr, so local initialization leaves it alone. */
+	void NotifyAttributeReplicated(const FGameplayAttribute& Attr) const;
+
+	/**
+	 * Condition Attribute replicates with right now, for COND_Dynamic attributes (GASCoreNetBandwidth). Sets with
+	 * per-attribute conditions override it with GASCORE_ATTRIBUTE_SCHEMA_CURRENT_CONDITION.
+	 */
+	virtual ELifetimeCondition GetAttributeReplicationCondition(const FGameplayAttribute& Attribute) const
+	{
+		return GetInitialReplicationCondition(Attribute, COND_None);
+	}
+
+	// ----------------------
+	// Derived attributes
+	// ----------------------
+
+	/**
+	 * Enable the class's derived attribute graph for this instance.
+	 * bRecompute: mark every derivation stale (false when the values were just written, e.g., by a batch initializer).
+	 */
+	void SetEvaluateDerivedAttributes(bool bEnable, bool bRecompute = true);
+
+	/** Server: recompute dirty derived attributes now (otherwise done at end of frame). */
+	void FlushDerivedAttributes();
+
+	// ----------------------
+	// Deferred Max clamping
+	// ----------------------
+
+	/** Defer the Current re-clamp after Max-changing executions to one pass per frame. Disabling flushes pending clamps. */
+	void SetDeferMaxClamp(bool bEnable);
+
+	/** Re-clamp every Current whose Max changed since the last pass (otherwise done at end of frame). */
+	void FlushMaxClamps();
+
+	// ----------------------
+	// Native regeneration
+	// ----------------------
+
+	/**
+	 * Display value of a regenerating attribute: last written/replicated value continued by its rate, clamped
+	 * to [0, Max] and not rounded (smooth bars). Non-regenerating attributes return their CurrentValue.
+	 */
+	float GetExtrapolatedValue(const FGameplayAttribute& Attr) const;
+
+	/** Clients: call from the RepNotify of a regenerating attribute (restarts its extrapolation). */
+	void NotifyRegeneratingAttributeReplicated(const FGameplayAttribute& Attr) const;
+
 protected:
+	friend struct FGASCoreAttributeMetadata;
+	friend class FGASCoreAttributeBatchInitializer;
+	friend class UGASCoreRegenerationSubsystem;
+	friend class FGASCoreMicrobenchmarks; // GASCoreBenchmarks module (times the protected / private hot paths)
+	friend struct FGASCoreAbilitySystemSnapshot; // Reads base values by ordinal, restores them through SetCurrentNumeric
+
 	/**
-	 * Register a Current ↔ Max attribute pair for automatic clamping.
-	 * Call from the derived-class constructor after attributes are defined.
+	 * Declare this class's attribute metadata (Current ↔ Max pairs, precision, bounds).
+	 * Called once per class on its CDO, the first time any instance needs the table. Call Super first.
 	 *
 	 * Example:
-	 *   RegisterCurrentMaxPair(GetHealthAttribute(), GetMaxHealthAttribute());
+	 *   Builder.RegisterCurrentMaxPair(GetHealthAttribute(), GetMaxHealthAttribute());
+	 */
+	virtual void ConfigureAttributeMetadata(FGASCoreAttributeMetadataBuilder& Builder) const {}
+
+	/** Shared per-class table (built on first use, cached on the instance). */
+	const FGASCoreAttributeMetadata& GetAttributeMetadata() const;
+
+	/**
+	 * Server, deferred initial replication: Attribute changed outside initialization for the first time. Enable its
+	 * replication here (GASCORE_ATTRIBUTE_SCHEMA_LIVE_CONDITION); the change itself is already marked dirty.
 	 */
-	void RegisterCurrentMaxPair(const FGameplayAttribute& Current, const FGameplayAttribute& Max);
+	virtual void OnAttributeLeftInitialization(const FGameplayAttribute& Attribute) const {}
 
 	// ----------------------
 	// UAttributeSet overrides
@@ -169,10 +315,17 @@ protected:
 	 * PostGameplayEffectExecute
 	 * - Fires after an Instant/Periodic GameplayEffect executes (server-authoritative).
 	 * - If a Max attribute changed, we re-clamp its paired Current and apply rounding.
+	 * - If a registered meta damage attribute executed, we consume it and subtract it from its target.
 	 * - Safe place to call SetX() to modify attributes directly.
 	 */
 	virtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;
 
+	/** Marks the changed attribute dirty for push-model replication. */
+	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
+
+	/** Marks the changed attribute dirty for push-model replication (BaseValue replicates too). */
+	virtual void PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const override;
+
 	// ----------------------
 	// Optional hooks
 	// ----------------------
@@ -183,6 +336,10 @@ protected:
 	/** Called when a Max changed and the corresponding Current had to be clamped in PostGameplayEffectExecute. */
 	virtual void OnMaxAttributeChangedAndClamped(const FGameplayAttribute& CurrentAttr, const FGameplayAttribute& MaxAttr, float OldCurrent, float NewCurrent) {}
 
+	/** Called after a meta damage attribute was consumed (TargetAttr already written; Data is the executing GE). */
+	virtual void OnIncomingDamageApplied(const FGameplayAttribute& TargetAttr, float Damage, float OldValue, float NewValue,
+		const FGameplayEffectModCallbackData& Data) {}
+
 	// ----------------------
 	// Rounding policy
 	// ----------------------
@@ -190,37 +347,57 @@ protected:
 	/**
 	 * Default number of decimals for rounding attribute values.
 	 * - 0 = integers (typical for Health/Mana/Stamina).
-	 * - Override GetRoundingDecimals to return different precision per attribute.
+	 * - Per-attribute precision: ConfigureAttributeMetadata or AttributeQuantization.
 	 */
-	UPROPERTY(EditDefaultsOnly, Category="GAS|Attributes")
+	UPROPERTY(EditDefaultsOnly, Category="GAS|Attributes", meta=(ClampMin="0", ClampMax="6"))
 	int32 DefaultRoundingDecimals = 0;
 
 	/**
-	 * Return the number of decimals to keep for a specific attribute.
-	 * Override to provide per-attribute precision (e.g., 2 for regeneration).
+	 * Per-attribute quantization overrides (decimals / integer storage), applied on top of
+	 * ConfigureAttributeMetadata when the class table is built.
 	 */
-	virtual int32 GetRoundingDecimals(const FGameplayAttribute& Attribute) const { return DefaultRoundingDecimals; }
+	UPROPERTY(EditDefaultsOnly, Category="GAS|Attributes", meta=(TitleProperty="Attribute"))
+	TArray<FGASCoreAttributeQuantization> AttributeQuantization;
+
+	/** Number of decimals kept for a specific attribute (class metadata; DefaultRoundingDecimals if foreign). */
+	int32 GetRoundingDecimals(const FGameplayAttribute& Attribute) const;
 
 	/**
-	 * Round a value to N decimals (half away from zero).
-	 * Applied after clamping and on direct writes (SetCurrentNumeric).
+	 * Round a value to N decimals (clamped to [0, 6]; power-of-ten table, no Pow).
+	 * Attribute writes use the precomputed per-attribute quantizer instead.
 	 */
 	static float RoundToDecimals(float Value, int32 Decimals);
 
+#if WITH_EDITOR
+	/** Keeps the shared class table in sync when AttributeQuantization/DefaultRoundingDecimals are edited. */
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 	// ----------------------
 	// Utilities
 	// ----------------------
 
-	/** Read the CurrentValue of an attribute belonging to this set. */
+	/** Flag an attribute of this set for push-model replication (no-op without push model / for foreign attributes). */
+	void MarkAttributeDirty(const FGameplayAttribute& Attr) const;
+
+	/** Read the CurrentValue of an attribute belonging to this set (0 for foreign attributes). */
 	float GetCurrentNumeric(const FGameplayAttribute& Attr) const;
 
-	/** Read the BaseValue of an attribute belonging to this set. */
+	/** Read the BaseValue of an attribute belonging to this set (0 for foreign attributes). */
 	float GetBaseNumeric(const FGameplayAttribute& Attr) const;
 
+	/** Attribute storage by metadata ordinal: cached byte offset, no reflection. */
+	FORCEINLINE const FGameplayAttributeData& GetAttributeDataAt(const int32 Ordinal) const
+	{
+		return *reinterpret_cast<const FGameplayAttributeData*>(
+			reinterpret_cast<const uint8*>(this) + GetAttributeMetadata().Offsets[Ordinal]);
+	}
+
 	/**
 	 * Set the Current/Base value (via ASC) for an attribute belonging to this set.
 	 * - Applies rounding before writing.
-	 * - Uses SetNumericAttributeBase to assign the base (authoritative) value.
+	 * - Uses SetNumericAttributeBase to assign the base (authoritative) value; writes must go through the ASC
+	 *   so aggregators, callbacks and replication stay consistent, so there is no raw-offset write path.
 	 */
 	void SetCurrentNumeric(const FGameplayAttribute& Attr, float NewValue);
 
@@ -233,19 +410,82 @@ protected:
 
 private:
 	
-	// Fast lookup maps for Current <-> Max pairs; populated by RegisterCurrentMaxPair.
-	TMap<FGameplayAttribute, FGameplayAttribute> CurrentToMax;
-	TMap<FGameplayAttribute, FGameplayAttribute> MaxToCurrent;
+	/** Cached pointer into the per-class metadata registry (no per-instance maps). */
+	mutable const FGASCoreAttributeMetadata* AttributeMetadata = nullptr;
+
+	/** Archetype the base values came from (null when initialized by GameplayEffects). */
+	UPROPERTY()
+	TObjectPtr<const UGASCoreAttributeArchetypeDataAsset> Archetype;
+
+	/** Level the archetype values were taken at. */
+	int32 ArchetypeLevel = 0;
+
+	/** Ordinals whose base left the archetype value; allocated on first divergence only. */
+	mutable TUniquePtr<TBitArray<>> DivergedAttributes;
+
+	/** Set while archetype values are being written (those writes are not divergence). */
+	bool bApplyingArchetype = false;
+
+	/** Write archetype values at Level for every specified ordinal (optionally skipping diverged ones). */
+	void ApplyArchetypeValues(int32 Level, bool bSkipDiverged);
+
+	/** Initial values are replicated instead of sent as archetype + level (SetDeferInitialReplication). */
+	bool bDeferInitialReplication = false;
+
+	/** Server, deferred: ordinals that changed outside initialization (replicating with their real condition). */
+	mutable TBitArray<> LiveAttributes;
+
+	/** Clients, deferred: ordinals that received a replicated value (not overwritten by local initialization). */
+	mutable TBitArray<> ReplicatedAttributes;
+
+	/** Server, deferred: first change of Ordinal outside initialization → OnAttributeLeftInitialization. */
+	void NoteAttributeChanged(int32 Ordinal) const;
+
+	/** Initialization may write Ordinal (always on the server; clients skip values that already replicated). */
+	bool ShouldWriteInitialValue(int32 Ordinal) const;
+
+	/** Whether this instance evaluates the class's derivations. */
+	bool bEvaluateDerivedAttributes = false;
+
+	/** Set while FlushDerivedAttributes runs (new dirt is picked up by the same pass). */
+	bool bFlushingDerivedAttributes = false;
+
+	/** End-of-frame flush already requested. */
+	bool bDerivedFlushScheduled = false;
+
+	/** Dirty flag per metadata derivation index. */
+	TBitArray<> DirtyDerivations;
+
+	/** Whether Max-change clamps are deferred (SetDeferMaxClamp). */
+	bool bDeferMaxClamp = false;
+
+	/** End-of-frame clamp pass already requested. */
+	bool bMaxClampFlushScheduled = false;
+
+	/** Current ordinals whose paired Max changed since the last clamp pass; sized on first use. */
+	TBitArray<> PendingMaxClamps;
+
+	/** Clamp the Current at CurrentOrdinal against its Max and notify when it moved. */
+	void ClampCurrentToMax(int32 CurrentOrdinal);
+
+	/** World time each regeneration (metadata index) was last written or replicated; sized on first use. */
+	mutable TArray<double, TInlineAllocator<4>> RegenerationBaselineTimes;
+
+	/** Metadata regeneration index of the Current at Ordinal, INDEX_NONE if it does not regenerate. */
+	int32 FindRegenerationIndex(int32 Ordinal) const;
+
+	/** Restart the extrapolation of regeneration RegenerationIndex from now. */
+	void ResetRegenerationBaseline(int32 RegenerationIndex) const;
 
-	/** Find the Max attribute paired with a Current attribute. */
-	bool TryGetMaxForCurrent(const FGameplayAttribute& Current, FGameplayAttribute& OutMax) const;
+	/** Dirty the derivations reading Ordinal (and schedule a flush). */
+	void MarkDependentsDirty(int32 Ordinal);
 
-	/** Find the Current attribute paired with a Max attribute. */
-	bool TryGetCurrentForMax(const FGameplayAttribute& Max, FGameplayAttribute& OutCurrent) const;
+	/** Request FlushDerivedAttributes at end of frame (once). */
+	void ScheduleDerivedFlush();
 
-	/** Locate the underlying FGameplayAttributeData (const). */
-	static const FGameplayAttributeData* FindAttributeDataConst(const FGameplayAttribute& Attr, const UAttributeSet* Set);
+	/** Clamp (static bounds + paired Max) and quantize a value for the attribute at Ordinal. */
+	float ClampAndRound(int32 Ordinal, float Value) const;
 
-	/** Locate the underlying FGameplayAttributeData (mutable). */
-	static FGameplayAttributeData* FindAttributeData(const FGameplayAttribute& Attr, UAttributeSet* Set);
+	/** Locate the underlying FGameplayAttributeData via the cached offset table (null for foreign attributes). */
+	const FGameplayAttributeData* FindAttributeDataConst(const FGameplayAttribute& Attr) const;
 };
\ No newline at end of file
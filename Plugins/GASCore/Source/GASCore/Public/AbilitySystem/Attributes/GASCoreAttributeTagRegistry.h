@@ -0,0 +1,59 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"           // FGameplayAttribute
+#include "GameplayTagContainer.h"
+#include "NativeGameplayTags.h"     // FNativeGameplayTag, UE_DEFINE_GAMEPLAY_TAG_COMMENT
+
+// Native attribute tags and the tag -> attribute registry.
+// - GASCORE_DEFINE_ATTRIBUTE_TAG defines a static native tag (registered by the GameplayTags module when the
+//   owning module loads, no manual AddNativeGameplayTag pass) and links it to an attribute property. The property
+//   name is checked at compile time; the FGameplayAttribute is resolved once, when the registry is built.
+// - The registry (TMap<FGameplayTag, FGameplayAttribute> plus the reverse map) is built on first lookup, by an
+//   explicit Build(), or by BuildAsync() on a worker task during engine init (lookups wait for that task), and
+//   rebuilt automatically if a module adds or removes bindings (hot reload).
+// - Lookups are game thread only.
+
+/** Static link from a native tag to an attribute property; use GASCORE_DEFINE_ATTRIBUTE_TAG instead of declaring these directly. */
+struct GASCORE_API FGASCoreAttributeTagBinding
+{
+	using FGetAttributeSetClass = UClass* (*)();
+
+	FGASCoreAttributeTagBinding(const FNativeGameplayTag& InTag, FGetAttributeSetClass InGetAttributeSetClass, const TCHAR* InPropertyName);
+	~FGASCoreAttributeTagBinding();
+
+	UE_NONCOPYABLE(FGASCoreAttributeTagBinding);
+
+	const FNativeGameplayTag& Tag;
+	FGetAttributeSetClass GetAttributeSetClass;
+	const TCHAR* PropertyName;
+};
+
+/**
+ * Define a native gameplay tag bound to AttributeSetClass::PropertyName. Use at namespace scope in a .cpp; pair with
+ * UE_DECLARE_GAMEPLAY_TAG_EXTERN(TagName) in the header.
+ */
+#define GASCORE_DEFINE_ATTRIBUTE_TAG(TagName, Tag, Comment, AttributeSetClass, PropertyName) \
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(TagName, Tag, Comment); \
+	static const FGASCoreAttributeTagBinding PREPROCESSOR_JOIN(GASCoreAttributeTagBinding_, TagName)( \
+		TagName, &AttributeSetClass::StaticClass, GET_MEMBER_NAME_STRING_CHECKED(AttributeSetClass, PropertyName))
+
+namespace GASCoreAttributeTagRegistry
+{
+	/** Resolve every binding now (call once startup modules are loaded, e.g., from the asset manager). */
+	GASCORE_API void Build();
+
+	/** Resolve every binding on a worker task; the first lookup (or Build) waits for it if it is still running. */
+	GASCORE_API void BuildAsync();
+
+	/** O(1) attribute for an exact attribute tag; invalid attribute if the tag is not bound. */
+	GASCORE_API FGameplayAttribute FindAttribute(const FGameplayTag& AttributeTag);
+
+	/** O(1) tag bound to Attribute; empty tag if none. */
+	GASCORE_API FGameplayTag FindTag(const FGameplayAttribute& Attribute);
+
+	/** The full tag -> attribute map (for debug listings and save systems). */
+	GASCORE_API const TMap<FGameplayTag, FGameplayAttribute>& GetAttributesByTag();
+}
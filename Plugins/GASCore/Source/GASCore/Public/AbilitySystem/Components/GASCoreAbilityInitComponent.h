@@ -10,12 +10,18 @@
 #include "GASCoreAbilityInitComponent.generated.h"
 
 class UGameplayAbility;
+struct FStreamableHandle;
 
 /**
  * UGASCoreAbilityInitComponent
  *
  * Actor component that handles initialization and granting of gameplay abilities
  * to characters at startup.
+ *
+ * Soft startup abilities:
+ * - SoftStartupAbilities are not loaded with the character: AddCharacterAbilities streams them (and their GE,
+ *   montage and VFX dependencies) through the asset manager's streamable manager and grants them on completion.
+ * - TryActivateStartupAbility activates a startup ability now, or once its load completes (queued activation).
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class GASCORE_API UGASCoreAbilityInitComponent : public UActorComponent
@@ -26,13 +32,44 @@ public:
 
 	UGASCoreAbilityInitComponent();
 
-	/** Grants all abilities in StartupAbilities to the owning actor's AbilitySystemComponent. */
+	/** Grants StartupAbilities now and SoftStartupAbilities once they are loaded (authority only). */
 	virtual void AddCharacterAbilities();
 
+	/**
+	 * Activate a granted startup ability; if it is still loading, activate it right after it is granted.
+	 * @return true if activated now or queued.
+	 */
+	UFUNCTION(BlueprintCallable, Category="GASCore|Ability Init Component")
+	bool TryActivateStartupAbility(TSoftClassPtr<UGameplayAbility> AbilityClass);
+
+	/** True while SoftStartupAbilities are being streamed in. */
+	bool IsLoadingStartupAbilities() const;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 protected:
 
 	/** Array of ability classes to grant to the owner at startup. */
 	UPROPERTY(EditAnywhere, Category="GASCore|Ability Init Component|Abilities")
 	TArray<TSubclassOf<UGameplayAbility>> StartupAbilities;
-	
+
+	/** Startup abilities loaded asynchronously when granted (rarely used abilities stay out of memory until then). */
+	UPROPERTY(EditAnywhere, Category="GASCore|Ability Init Component|Abilities")
+	TArray<TSoftClassPtr<UGameplayAbility>> SoftStartupAbilities;
+
+private:
+
+	/** Load finished: grant the soft abilities and run queued activations. */
+	void HandleStartupAbilitiesLoaded();
+
+	/** Grant every loaded SoftStartupAbilities entry. */
+	void GrantSoftStartupAbilities();
+
+	/** In-flight load of SoftStartupAbilities (also keeps the loaded classes resident). */
+	TSharedPtr<FStreamableHandle> StartupAbilitiesHandle;
+
+	/** Activations requested while loading (run after the grant). */
+	TArray<TSoftClassPtr<UGameplayAbility>> QueuedActivations;
+
+	bool bSoftStartupAbilitiesGranted = false;
 };
@@ -11,9 +11,58 @@
 //   without coupling UI logic to effect classes/assets.
 //
 // Usage:
-// - After initializing ASC actor info (InitAbilityActorInfo), call BindASCDelegates() once to register the hook
+// - After initializing ASC actor info (InitAbilityActorInfo), call BindASCDelegates() to register the hook
+//   (idempotent: repeated possession/pool reuse binds once)
 // - Bind to OnEffectAssetTags to receive FGameplayTagContainer whenever a GE is applied to self
 //
+// Effect notification bandwidth:
+// - The server filters each applied spec's asset tags down to EffectNotifyTagRoots (default: the
+//   GASCore.EffectNotify.DefaultTagRoot CVar, "UI.Message") and sends nothing for effects without such a tag
+//   (periodic regen, plain damage). Matching tags of the frame are unioned and sent once at end of frame as one
+//   tags-only client RPC, so OnEffectAssetTags receives only the notification tags.
+//
+// Attribute delta batching:
+// - BindASCDelegates also listens to every attribute of the ASC's sets and coalesces Current value changes
+//   for the frame (first OldValue, last NewValue per attribute). OnAttributeDeltaBatch fires once at end of
+//   frame with all of them, so listeners that redraw/recompute per change pay once per frame instead.
+// - The per-attribute GetGameplayAttributeValueChangeDelegate delegates are unchanged for immediate callers.
+// - Server: damage consumed from meta damage attributes is queued per instigator (QueueDamageEvent, from
+//   UGASCoreAttributeSet) and OnDamageEventBatch fires in the same flush (threat, damage meters).
+//
+// Deferred effect notifications (batched applications, FGASCoreEffectBatch):
+// - While an FGASCoreDeferredEffectNotifyScope is alive, the notification tags are sent when the outermost scope
+//   ends instead of at end of frame.
+//
+// Input tag index:
+// - Every dynamic spec source tag (input tags, e.g. StartupInputTag) maps to the specs carrying it, maintained in
+//   OnGiveAbility/OnRemoveAbility and RemapAbilityInputTag (rebuilt on client ability replication). Held/released
+//   input, which fires every frame while a key is down, only visits the specs bound to that tag.
+//
+// Ability input buffer (GASCore.AbilityInput.BufferWindow):
+// - A held input whose abilities are all blocked (cooldown, cost, blocking tags) is remembered with its time; the
+//   most recent press wins, a successful activation clears it.
+// - When something that could unblock it happens (an active effect is removed, e.g. a cooldown; an ability ends),
+//   the press is replayed once at end of frame if it is younger than the window plus half the owner's ping.
+//
+// Server ability RPC batching (UGASCoreGameplayAbility::bBatchServerRPCs, GASCore.AbilityInput.RPCBatching):
+// - Held-input activation of a batchable ability on a predicting client runs inside an FScopedServerAbilityRPCBatcher,
+//   so activate / target data / end of that frame reach the server as one RPC.
+//
+// Held-input activation failure cache (GASCore.AbilityInput.FailureCache):
+// - When a held input fails to activate its ability because of a cooldown or an unaffordable cost, the reason is
+//   remembered per spec and TryActivateAbility is skipped until it could have changed: cooldown expiry (or any
+//   effect removal), or a change of one of the cost GE's attributes (at most FailureCacheMaxAge seconds).
+// - Other failures (blocking tags, requirements) are never cached.
+//
+// Predicted pickups (AGASCoreGameplayEffectActor::bPredictedPickup):
+// - The owning client predicts the pickup under a local prediction key and calls ServerPredictedPickup; the server
+//   applies it under the same key (GAS reconciles the predicted effects) or answers ClientPredictedPickupRejected.
+//   Each key and each stay in the pickup is served once; repeats are rejected.
+//
+// Effect cost profiling (GASCoreEffectProfiler.h):
+// - MakeOutgoingSpec and ApplyGameplayEffectSpecToSelf are timed per GE class and source when
+//   GASCore.EffectProfiler.Enable is set; otherwise they forward straight to the engine.
+//
 // Replication notes:
 // - The delegate fires on the instance where the application occurs. In a typical MP setup, UI belongs to
 //   the owning client; ensure you fire on or route to the owning client as appropriate if needed.
@@ -22,11 +71,52 @@
 
 #include "CoreMinimal.h"
 #include "AbilitySystemComponent.h"
+#include "Actors/GASCoreGameplayCueBurstActor.h"
+#include "Subsystems/GASCoreLagCompensationSubsystem.h"
 #include "GASCoreAbilitySystemComponent.generated.h"
 
+class AGASCoreGameplayEffectActor;
+
 /** Multicast delegate that carries GameplayEffect asset tags gathered from the applied spec. */
 DECLARE_MULTICAST_DELEGATE_OneParam(FEffectAssetTagsSignature, const FGameplayTagContainer& /*AssetTags*/);
 
+/** One coalesced attribute change of the frame. */
+struct FGASCoreAttributeDelta
+{
+	FGameplayAttribute Attribute;
+	float OldValue = 0.f;
+	float NewValue = 0.f;
+};
+
+/** End-of-frame batch of attribute deltas (the view is only valid during the broadcast). */
+DECLARE_MULTICAST_DELEGATE_OneParam(FAttributeDeltaBatchSignature, TArrayView<const FGASCoreAttributeDelta> /*Deltas*/);
+
+/** Damage taken during the frame from one instigator (summed). */
+struct FGASCoreDamageEvent
+{
+	/** Avatar of the instigating ASC (the effect causer when there is none); may be null. */
+	TWeakObjectPtr<AActor> Instigator;
+	float Damage = 0.f;
+};
+
+/** End-of-frame batch of damage events (server; the view is only valid during the broadcast). */
+DECLARE_MULTICAST_DELEGATE_OneParam(FDamageEventBatchSignature, TArrayView<const FGASCoreDamageEvent> /*Events*/);
+
+/**
+ * While alive (game thread), effect-applied notifications of every UGASCoreAbilitySystemComponent are held and
+ * sent when the outermost scope ends. Scopes nest.
+ */
+struct GASCORE_API FGASCoreDeferredEffectNotifyScope
+{
+	FGASCoreDeferredEffectNotifyScope();
+	~FGASCoreDeferredEffectNotifyScope();
+
+	UE_NONCOPYABLE(FGASCoreDeferredEffectNotifyScope);
+
+	/** True while any scope is alive. */
+	static bool IsActive();
+};
+
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class GASCORE_API UGASCoreAbilitySystemComponent : public UAbilitySystemComponent
 {
@@ -36,42 +126,326 @@ public:
 
 	/**
 	 * Registers this ASC to receive callbacks when GameplayEffects are applied to self.
-	 * Call this once after InitAbilityActorInfo(Owner, Avatar), when the ASC is fully initialized.
+	 * Call this after InitAbilityActorInfo(Owner, Avatar), when the ASC is fully initialized.
 	 *
 	 * Implementation detail:
 	 * - Binds HandleGameplayEffectAppliedToSelf to OnGameplayEffectAppliedDelegateToSelf via AddUObject
 	 * - AddUObject ensures safe unbinding if this component is GC'd
+	 * - Idempotent: later calls (re-possession, pooled avatars) return without binding again. Overrides should
+	 *   return early when AreASCDelegatesBound() is true before calling Super.
 	 */
 	virtual void BindASCDelegates();
 
+	/** True once BindASCDelegates has run. */
+	bool AreASCDelegatesBound() const { return bASCDelegatesBound; }
+
 	/**
-	 * Grants all startup abilities to this character.
+	 * Lazy initialization: owners that postpone InitAbilityActorInfo / BindASCDelegates (dormant enemies) bind their
+	 * activation here. The first effect applied to self runs it before the effect; it is consumed when run.
+	 */
+	FSimpleDelegate OnDemandInitialization;
+
+	/** Run and clear OnDemandInitialization (no-op when unbound). */
+	void RunOnDemandInitialization();
+
+	/**
+	 * Server: clear gameplay state so a pooled avatar can be reused without constructing a new ASC.
+	 * - Cancels active abilities, removes every active effect (cooldowns included) and zeroes loose tags.
+	 * - bKeepAbilities: keep the granted specs (same archetype); otherwise every ability is cleared.
+	 * - Drops cached activation failures, cost previews, latency samples and the input buffer.
+	 * Delegate bindings and attribute sets stay; reset attribute values separately (UGASCoreAttributeSet).
+	 */
+	virtual void ResetForReuse(bool bKeepAbilities);
+
+	/** Heap bytes of the GASCore-owned containers (input tag index, cost previews, latency, failures, deltas). */
+	SIZE_T GetCoreAllocatedSize() const;
+
+	/**
+	 * Grants all startup abilities to this character (one GiveAbility per class into reserved spec storage; the
+	 * StartupInputTag of each class is read from its CDO once per class and cached).
 	 * @param InStartupAbilities Array of GameplayAbility classes to grant.
 	 */
 	virtual void AddCharacterAbilities(const TArray<TSubclassOf<UGameplayAbility>>& InStartupAbilities);
 
 	virtual void AbilityInputTagHeld(const FGameplayTag& InputTag);
 
+	/** Held input for every tag held this frame in one pass (aggregated input binding); duplicates are skipped. */
+	virtual void AbilityInputTagsHeld(TArrayView<const FGameplayTag> InputTags);
+
 	virtual void AbilityInputTagReleased(const FGameplayTag& InputTag);
 
+	/**
+	 * Rebind an ability to another input (slot rebinding): replaces OldInputTag with NewInputTag in the spec's
+	 * dynamic source tags (either may be invalid to only add/remove) and replicates the spec.
+	 * @return false if Handle is not granted.
+	 */
+	bool RemapAbilityInputTag(FGameplayAbilitySpecHandle Handle, const FGameplayTag& OldInputTag, const FGameplayTag& NewInputTag);
+
 	/**
 	 * Fires whenever a GameplayEffect is applied to this ASC (self), providing the asset tag container
 	 * extracted from the effect spec. Consumers can filter by tag families (e.g., "UI.Message").
 	 */
 	FEffectAssetTagsSignature OnEffectAssetTags;
 
-protected:
+	/**
+	 * Asset tag roots worth notifying the owning client about (children included). Empty = the
+	 * GASCore.EffectNotify.DefaultTagRoot CVar. Effects without a matching asset tag send no RPC.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "GASCore|Effect Notifications")
+	FGameplayTagContainer EffectNotifyTagRoots;
+
+	/** Fires once at end of frame with every attribute whose CurrentValue changed during the frame. */
+	FAttributeDeltaBatchSignature OnAttributeDeltaBatch;
+
+	/** Server: fires in the same flush with the damage taken this frame, per instigator. */
+	FDamageEventBatchSignature OnDamageEventBatch;
+
+	/** Server: add Damage dealt by Instigator to this frame's damage events (called by UGASCoreAttributeSet). */
+	void QueueDamageEvent(AActor* Instigator, float Damage);
+
+	/** Client → server: confirm a pickup predicted under PredictionKey (see AGASCoreGameplayEffectActor::bPredictedPickup). */
+	UFUNCTION(Server, Reliable)
+	void ServerPredictedPickup(AGASCoreGameplayEffectActor* Pickup, FPredictionKey PredictionKey);
+
+	/** Server → client: the predicted pickup was refused; restore it locally (predicted effects end with the key). */
+	UFUNCTION(Client, Reliable)
+	void ClientPredictedPickupRejected(AGASCoreGameplayEffectActor* Pickup);
 
 	/**
-	 * Internal handler for GameplayEffect application to self.
-	 * - Gathers all asset tags from the incoming GameplayEffectSpec
-	 * - Broadcasts them via OnEffectAssetTags
-	 *
-	 * @param AbilitySystemComponent The ASC receiving the effect (i.e., this)
-	 * @param GameplayEffectSpec     The spec for the effect being applied
-	 * @param ActiveGameplayEffectHandle Handle to the active GE instance (if any)
+	 * Client → server: a locally predicted projectile of the ability AbilityHandle hit Report.Target. The server
+	 * validates it by rewinding (UGASCoreLagCompensationSubsystem) and applies the ability's effect if accepted.
+	 */
+	UFUNCTION(Server, Reliable)
+	void ServerReportProjectileHit(FGameplayAbilitySpecHandle AbilityHandle, const FGASCoreProjectileHitReport& Report);
+
+	/** Broadcast pending deltas now (called at end of frame; callable early, e.g. before a UI snapshot). */
+	void FlushAttributeDeltas();
+
+	// ===== Cue routing (UGASCoreGameplayCueRoutingSubsystem) =====
+
+	/** Server → owning client: the routed cues this player can see this frame (executed locally, not replicated further). */
+	UFUNCTION(Client, Unreliable)
+	void ClientExecuteCueBurst(const TArray<FGASCoreBatchedCue>& Cues);
+
+	/** Executed cues whose tags all have a routing rule go per connection instead of the engine multicast. */
+	virtual void Call_InvokeGameplayCueExecuted_FromSpec(const FGameplayEffectSpecForRPC Spec, FPredictionKey PredictionKey) override;
+	virtual void Call_InvokeGameplayCueExecuted_WithParams(const FGameplayTag GameplayCueTag, FPredictionKey PredictionKey,
+		FGameplayCueParameters GameplayCueParameters) override;
+
+	/** Also joins the world's UGASCoreAbilitySystemRegistrySubsystem (left again in OnUnregister). */
+	virtual void InitAbilityActorInfo(AActor* InOwnerActor, AActor* InAvatarActor) override;
+
+	virtual void OnUnregister() override;
+
+	// ===== Consolidated tick (UGASCoreAbilityTickSubsystem) =====
+
+	/**
+	 * With GASCore.AbilityTick.Consolidate the component's own tick function stays off: enabling registers with
+	 * UGASCoreAbilityTickSubsystem, disabling unregisters, so an active component stays registered (the shared pass
+	 * skips it while NeedsTick is false). Activation follows UpdateShouldTick and bAutoActivate.
 	 */
+	virtual void SetComponentTickEnabled(bool bEnabled) override;
+
+	/** Ticking ability tasks, montage replication or an attribute set still need TickComponent (GetShouldTick). */
+	bool NeedsTick() const { return GetShouldTick(); }
+
+	// ===== Net bandwidth accounting (GASCoreNetBandwidth, non-shipping) =====
+
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack) override;
+
+	// ===== UAbilitySystemComponent (profiled) =====
+
+	virtual FGameplayEffectSpecHandle MakeOutgoingSpec(TSubclassOf<UGameplayEffect> GameplayEffectClass, float Level,
+		FGameplayEffectContextHandle Context) const override;
+
+	virtual FActiveGameplayEffectHandle ApplyGameplayEffectSpecToSelf(const FGameplayEffectSpec& GameplayEffect,
+		FPredictionKey PredictionKey = FPredictionKey()) override;
+
+	virtual void NotifyAbilityActivated(const FGameplayAbilitySpecHandle Handle, UGameplayAbility* Ability) override;
+
+	virtual bool ShouldDoServerAbilityRPCBatch() const override;
+
+	// ===== Cost preview =====
+	// HUD affordability without CanActivateAbility (tags, cooldown, full CheckCost) per slot per frame: the cost GE's
+	// Additive modifier magnitudes are evaluated once per (spec, level) and compared with the locally visible attribute
+	// values, which already include predicted changes on the owning client.
+
+	/**
+	 * True if the current attribute values cover the ability's cost GE. Magnitudes that cannot be evaluated locally
+	 * (SetByCaller) are ignored; abilities overriding CheckCost are previewed by their cost GE only.
+	 */
+	bool CanAffordAbilityCost(FGameplayAbilitySpecHandle Handle);
+
+	/** CanAffordAbilityCost for the abilities bound to InputTag: true if any of them is affordable. */
+	UFUNCTION(BlueprintCallable, Category="GASCore|Ability Cost")
+	bool CanAffordAbilityCostByInputTag(FGameplayTag InputTag);
+
+	/** Drop the cached cost magnitudes (attribute-based costs follow their source attributes only on rebuild). */
+	void InvalidateAbilityCostPreviews() { AbilityCostPreviews.Reset(); }
+
+	// ===== Activation latency (see GASCoreAbilityLatency) =====
+	// Input-driven activations are timed from the press; UGASCoreGameplayAbility reports the later phases.
+	// Abilities activated any other way (events, AI, server) have no press and are ignored.
+
+	/** ActivateAbility ran; predicting clients also start waiting for the server to confirm the prediction key. */
+	void NotifyAbilityLatencyActivated(FGameplayAbilitySpecHandle Handle, const UGameplayAbility* Ability,
+		const FGameplayAbilityActivationInfo& ActivationInfo);
+
+	/** The ability played a gameplay cue (only the first one per activation is recorded). */
+	void NotifyAbilityLatencyCue(FGameplayAbilitySpecHandle Handle, const UGameplayAbility* Ability);
+
+	/** Executed cue dispatch: NotifyFirstGameplayCue on the ability instance that made EffectContext, if any. */
+	static void NotifyAbilityLatencyCueFromContext(const FGameplayEffectContextHandle& EffectContext);
+
+	/** EndAbility ran; closes the activation's measurement. */
+	void NotifyAbilityLatencyEnded(FGameplayAbilitySpecHandle Handle, const UGameplayAbility* Ability);
+
+protected:
+
+	// ===== UAbilitySystemComponent (input tag index) =====
+
+	virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRep_ActivateAbilities() override;
+
+	/** Coalesced effect notifications: the union of the notification tags of the frame (or batch), broadcast once. */
 	UFUNCTION(Client, Reliable)
-	virtual void ClientHandleGameplayEffectAppliedToSelf(UAbilitySystemComponent* AbilitySystemComponent,
+	void ClientHandleDeferredEffectAssetTags(const FGameplayTagContainer& AssetTags);
+
+private:
+	friend struct FGASCoreDeferredEffectNotifyScope;
+
+	/** Dynamic spec source tag -> granted specs carrying it (see "Input tag index"). */
+	TMap<FGameplayTag, TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>>> AbilitySpecsByInputTag;
+
+	/** Add / remove AbilitySpec under each of its dynamic source tags. */
+	void IndexAbilitySpecInputTags(const FGameplayAbilitySpec& AbilitySpec);
+	void UnindexAbilitySpecInputTags(const FGameplayAbilitySpec& AbilitySpec);
+
+	/** Re-index every activatable ability (client replication may change dynamic tags in place). */
+	void RebuildAbilityInputTagIndex();
+
+	/** Why a held-input activation failed, and when it is worth trying again. */
+	struct FActivationFailure
+	{
+		FGameplayAbilitySpecHandle Handle;
+
+		/** World time after which activation is retried. */
+		double RetryTime = 0.0;
+
+		/** Cost failures: attributes of the cost GE; a change to any of them allows a retry now. */
+		TArray<FGameplayAttribute, TInlineAllocator<2>> CostAttributes;
+	};
+
+	/**
+	 * Input-driven TryActivateAbility, inside a server RPC batch for batchable abilities on predicting clients.
+	 * PressTime (FPlatformTime::Seconds, 0 = now) starts the activation latency measurement.
+	 */
+	bool TryActivateAbilityFromInput(const FGameplayAbilitySpec& AbilitySpec, double PressTime = 0.0);
+
+	/** Timestamps of one input-driven activation in flight (FPlatformTime::Seconds). */
+	struct FAbilityLatencyTimes
+	{
+		double PressTime = 0.0;
+		bool bActivated = false;
+		bool bCueRecorded = false;
+	};
+
+	/** Cost of a spec at Level: attribute -> amount the cost GE takes away. */
+	struct FAbilityCostPreview
+	{
+		int32 Level = INDEX_NONE;
+		TArray<TPair<FGameplayAttribute, float>, TInlineAllocator<2>> Costs;
+	};
+
+	/** Cost magnitudes by spec (re-evaluated when the spec's level changes). */
+	TMap<FGameplayAbilitySpecHandle, FAbilityCostPreview> AbilityCostPreviews;
+
+	/** Cached preview of AbilitySpec at its current level, evaluated from the cost GE on a miss. */
+	const FAbilityCostPreview& FindOrBuildAbilityCostPreview(const FGameplayAbilitySpec& AbilitySpec);
+
+	/** Activations being measured, by spec (one activation per spec at a time). */
+	TMap<FGameplayAbilitySpecHandle, FAbilityLatencyTimes> AbilityLatencyTimes;
+
+	/** True while a cached failure for Handle is still expected to hold (expired entries are dropped). */
+	bool IsActivationFailureCached(FGameplayAbilitySpecHandle Handle);
+
+	/** After a failed TryActivateAbility: cache the failure if it was caused by cooldown or cost. */
+	void CacheActivationFailure(const FGameplayAbilitySpec& AbilitySpec);
+
+	/** Active effect removed (cooldowns can end early): forget every cached failure, replay a buffered input. */
+	void HandleActiveEffectRemoved(const FActiveGameplayEffect& RemovedEffect);
+
+	/** Remember a blocked input press for replay. */
+	void BufferAbilityInput(const FGameplayTag& InputTag);
+
+	/** Press + activate the abilities bound to InputTag; updates the input buffer from the outcome. */
+	void ProcessHeldInputTag(const FGameplayTag& InputTag);
+
+	/** Buffer window in seconds, widened by half the owning player's ping. */
+	float GetInputBufferWindow() const;
+
+	/** Replay the buffered input at end of frame (once per frame). */
+	void ScheduleBufferedInputReplay();
+
+	/** Activate the buffered input's abilities if still within the window; clears the buffer on success/expiry. */
+	void ReplayBufferedInput();
+
+	/** AbilityEndedCallbacks listener: an ending ability releases its blocking tags. */
+	void HandleAbilityEndedForInputBuffer(UGameplayAbility* Ability);
+
+	/** Most recent blocked ability input (invalid = none) and when it was pressed. */
+	FGameplayTag BufferedInputTag;
+	double BufferedInputTime = 0.0;
+
+	/** Buffered press in FPlatformTime::Seconds (latency is measured from the original press, not the replay). */
+	double BufferedInputPressTime = 0.0;
+
+	bool bInputReplayScheduled = false;
+
+	/** Cached failures of held inputs (few entries → linear scans). */
+	TArray<FActivationFailure> ActivationFailures;
+
+	/** OnGameplayEffectAppliedDelegateToSelf listener: filter the asset tags and merge them into the pending notification. */
+	void HandleGameplayEffectAppliedToSelf(UAbilitySystemComponent* AbilitySystemComponent,
 		const FGameplayEffectSpec& GameplayEffectSpec, FActiveGameplayEffectHandle ActiveGameplayEffectHandle);
+
+	/** Send the pending notification (end of frame, or end of the outermost scope). */
+	void FlushDeferredEffectAssetTags();
+
+	/** Notification tags (asset tags under the notify roots) not yet sent. */
+	FGameplayTagContainer DeferredEffectAssetTags;
+
+	bool bHasDeferredEffectAssetTags = false;
+
+	/** Connection that predicted a cue under PredictionKey (it already played it), or null. */
+	const UNetConnection* GetCuePredictingConnection(const FPredictionKey& PredictionKey) const;
+
+	/** Bind the coalescing listener to every attribute of the spawned sets (once). */
+	void BindAttributeDeltaBatching();
+
+	/** Per-attribute change listener: merges into PendingAttributeDeltas and schedules the flush. */
+	void QueueAttributeDelta(const FOnAttributeChangeData& ChangeData);
+
+	/** Deltas collected this frame (one entry per attribute). */
+	TArray<FGASCoreAttributeDelta> PendingAttributeDeltas;
+
+	/** Array handed to listeners while broadcasting (keeps capacity between frames). */
+	TArray<FGASCoreAttributeDelta> BroadcastAttributeDeltas;
+
+	/** Damage events collected this frame (one entry per instigator) and the broadcast copy. */
+	TArray<FGASCoreDamageEvent> PendingDamageEvents;
+	TArray<FGASCoreDamageEvent> BroadcastDamageEvents;
+
+	/** The end-of-frame flush is scheduled (deltas or damage events pending). */
+	bool bAttributeDeltaFlushScheduled = false;
+
+	/** Schedule FlushAttributeDeltas at end of frame (once). */
+	void ScheduleAttributeDeltaFlush();
+
+	bool bAttributeDeltaBatchingBound = false;
+
+	/** BindASCDelegates already ran (see AreASCDelegatesBound). */
+	bool bASCDelegatesBound = false;
 };
\ No newline at end of file
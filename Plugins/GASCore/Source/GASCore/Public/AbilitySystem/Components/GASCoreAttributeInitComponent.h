@@ -24,6 +24,13 @@
 //     * One Override modifier per primary attribute (e.g., STR/DEX/INT/END/VIG)
 //     * Magnitudes set to your initial values
 //
+// Soft init effects:
+// - SoftPrimaryAttributes/SoftSecondaryAttributes/SoftVitalAttributes replace the hard references when those are
+//   empty, so init GEs and their curve tables no longer load with every character class.
+// - They are streamed once per component archetype through the asset manager's streamable manager and stay
+//   resident (shared handle); spawns after that apply synchronously, spawns during the load apply on completion
+//   (or block on it with bWaitForSoftAttributeEffects).
+//
 // Implementation detail:
 // - We create an outgoing spec on the provided ASC and apply it "to target" where the target is
 //   the same ASC (equivalent to ApplyToSelf, but using the ApplyGameplayEffectSpecToTarget API).
@@ -84,6 +91,29 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GASCore|Attribute Init Component|Init")
 	TSubclassOf<UGameplayEffect> DefaultVitalAttributes;
 
+	// Soft DefaultPrimaryAttributes: used when the hard reference is empty (streamed instead of loaded with the class).
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GASCore|Attribute Init Component|Init|Soft")
+	TSoftClassPtr<UGameplayEffect> SoftPrimaryAttributes;
+
+	// Soft DefaultSecondaryAttributes (used when the hard reference is empty).
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GASCore|Attribute Init Component|Init|Soft")
+	TSoftClassPtr<UGameplayEffect> SoftSecondaryAttributes;
+
+	// Soft DefaultVitalAttributes (used when the hard reference is empty).
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GASCore|Attribute Init Component|Init|Soft")
+	TSoftClassPtr<UGameplayEffect> SoftVitalAttributes;
+
+	// Soft effects still loading: block until they are in (true) or apply them when the load completes (false).
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GASCore|Attribute Init Component|Init|Soft")
+	bool bWaitForSoftAttributeEffects = false;
+
+	/** True when a primary init effect is configured (hard or soft). */
+	UFUNCTION(BlueprintPure, Category="GASCore|Attribute Init Component|Init")
+	bool HasDefaultAttributes() const;
+
+	/** True when every configured init effect class is resident (InitializeDefaultAttributes applies synchronously). */
+	bool AreDefaultAttributeEffectsLoaded() const;
+
 
 	/**
 	 * Initialize primary, secondary, and vital attributes by applying configured GEs
@@ -104,6 +134,9 @@ public:
 	 * Safety:
 	 * - Uses check() to catch misuse during development (null ASC or missing GE).
 	 *   Consider replacing with guards/ensure in shipping builds to avoid crashing.
+	 *
+	 * Soft effects:
+	 * - Applied now when resident, otherwise once the shared load completes (see bWaitForSoftAttributeEffects).
 	 */
 	UFUNCTION(BlueprintCallable, Category="GASCore|Attribute Init Component|Init")
 	virtual void InitializeDefaultAttributes(UAbilitySystemComponent* TargetAbilitySystemComponent) const;
@@ -113,4 +146,17 @@ public:
 	 * - Level parameter enables scalable values or SetByCaller scaling in the GE.
 	 */
 	virtual void ApplyEffectToSelf(TSubclassOf<UGameplayEffect> GameplayEffectClass, float Level, UAbilitySystemComponent* TargetAbilitySystemComponent) const;
+
+	/** Resident init effect classes (primary, secondary, vital; soft ones not loaded yet are left out). */
+	void GetDefaultAttributeEffectClasses(TArray<TSubclassOf<UGameplayEffect>>& OutClasses) const;
+
+private:
+	/** Hard class if set, else the soft class when resident (null while it is not loaded). */
+	static TSubclassOf<UGameplayEffect> ResolveEffectClass(TSubclassOf<UGameplayEffect> HardClass, const TSoftClassPtr<UGameplayEffect>& SoftClass);
+
+	/** Apply primary → secondary → vital with the resolved classes. */
+	void ApplyDefaultAttributeEffects(UAbilitySystemComponent* TargetAbilitySystemComponent) const;
+
+	/** Soft paths this component still needs (hard references win). */
+	void GetPendingSoftEffectPaths(TArray<FSoftObjectPath>& OutPaths) const;
 };
\ No newline at end of file
@@ -0,0 +1,128 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GASCoreThreatComponent.generated.h"
+
+class UGASCoreAbilitySystemComponent;
+class UGASCoreCombatantRegistrySubsystem;
+struct FGASCoreDamageEvent;
+
+/** Threat target changed (server). NewTarget may be null (threat dropped). */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FGASCoreThreatTargetChangedSignature, AActor* /*OldTarget*/, AActor* /*NewTarget*/);
+
+/**
+ * UGASCoreThreatComponent
+ *
+ * Server-side threat table and target selection for AI combatants (enemies).
+ *
+ * Threat sources:
+ * - Damage: the owner ASC's end-of-frame damage batch (UGASCoreAbilitySystemComponent::OnDamageEventBatch) adds
+ *   ThreatPerDamage per point to each instigator and asks for an evaluation that frame.
+ * - Proximity: at each evaluation, the nearest combatant of AggroTargetClass within ProximityAggroRadius (through
+ *   the combatant registry's spatial hash) gains ProximityThreatPerSecond * elapsed.
+ * - AddThreat for anything else (taunts, healing aggro).
+ *
+ * Evaluation (UGASCoreThreatSubsystem): on damage events and otherwise every GASCore.Threat.UpdateInterval seconds,
+ * spread over frames. Threat decays by ThreatDecayPerSecond (fraction), entries beyond LoseTargetDistance or
+ * without threat drop out, and the target switches only when another entry exceeds it by TargetSwitchRatio.
+ * Deactivate() (e.g. pooled) clears the table; inactive components are not evaluated.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class GASCORE_API UGASCoreThreatComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UGASCoreThreatComponent();
+
+	/** Current target (highest threat, with hysteresis), or null. */
+	UFUNCTION(BlueprintPure, Category = "GASCore|Threat")
+	AActor* GetThreatTarget() const { return Target.Get(); }
+
+	/** Threat Actor holds on this component (0 when not in the table). */
+	UFUNCTION(BlueprintPure, Category = "GASCore|Threat")
+	float GetThreat(const AActor* Actor) const;
+
+	/** Server: add (or with a negative value remove) threat; re-evaluates this frame. */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|Threat")
+	void AddThreat(AActor* Actor, float Threat);
+
+	/** Server: drop every entry and the target. */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|Threat")
+	void ClearThreat();
+
+	/** Server: fires when the target changes. */
+	FGASCoreThreatTargetChangedSignature OnThreatTargetChanged;
+
+	/** Decay, proximity aggro and target selection for Elapsed seconds (driven by UGASCoreThreatSubsystem). */
+	void EvaluateThreat(float Elapsed, UGASCoreCombatantRegistrySubsystem* CombatantRegistry);
+
+	/** Combatant class that triggers proximity aggro (owners set it in their constructor, e.g. the player character). */
+	void SetAggroTargetClass(TSubclassOf<AActor> InAggroTargetClass) { AggroTargetClass = InAggroTargetClass; }
+
+	/** World time of the last EvaluateThreat. */
+	double GetLastEvaluationTime() const { return LastEvaluationTime; }
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Deactivate() override;
+
+protected:
+	/** Threat per point of damage dealt to the owner. */
+	UPROPERTY(EditAnywhere, Category = "GASCore|Threat", meta = (ClampMin = "0.0"))
+	float ThreatPerDamage = 1.f;
+
+	/** Combatants of this class within ProximityAggroRadius generate threat (null = proximity aggro off). */
+	UPROPERTY(EditAnywhere, Category = "GASCore|Threat|Proximity")
+	TSubclassOf<AActor> AggroTargetClass;
+
+	/** Proximity aggro radius (cm, 2D). */
+	UPROPERTY(EditAnywhere, Category = "GASCore|Threat|Proximity", meta = (ClampMin = "0.0"))
+	float ProximityAggroRadius = 1000.f;
+
+	/** Threat per second the nearest AggroTargetClass combatant in range gains. */
+	UPROPERTY(EditAnywhere, Category = "GASCore|Threat|Proximity", meta = (ClampMin = "0.0"))
+	float ProximityThreatPerSecond = 5.f;
+
+	/** Fraction of its threat an entry loses per second. */
+	UPROPERTY(EditAnywhere, Category = "GASCore|Threat", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float ThreatDecayPerSecond = 0.05f;
+
+	/** Entries farther than this (cm) are dropped (0 = never by distance). */
+	UPROPERTY(EditAnywhere, Category = "GASCore|Threat", meta = (ClampMin = "0.0"))
+	float LoseTargetDistance = 4000.f;
+
+	/** Another entry must hold this many times the target's threat to take over (no ping-pong between equals). */
+	UPROPERTY(EditAnywhere, Category = "GASCore|Threat", meta = (ClampMin = "1.0"))
+	float TargetSwitchRatio = 1.1f;
+
+private:
+	struct FThreatEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		float Threat = 0.f;
+	};
+
+	void HandleDamageEvents(TArrayView<const FGASCoreDamageEvent> Events);
+
+	/** Add to Actor's entry (created on demand). */
+	void AddThreatInternal(AActor* Actor, float Threat);
+
+	void SetTarget(AActor* NewTarget);
+
+	/** Ask the subsystem for an evaluation this frame. */
+	void RequestEvaluation();
+
+	/** Few entries per enemy: linear scans. */
+	TArray<FThreatEntry, TInlineAllocator<4>> Entries;
+
+	TWeakObjectPtr<AActor> Target;
+
+	TWeakObjectPtr<UGASCoreAbilitySystemComponent> BoundAbilitySystem;
+	FDelegateHandle DamageEventsHandle;
+
+	double LastEvaluationTime = 0.0;
+};
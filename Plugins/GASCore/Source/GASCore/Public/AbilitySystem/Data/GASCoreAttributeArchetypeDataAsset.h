@@ -0,0 +1,87 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+// ===== Engine Includes =====
+#include "CoreMinimal.h"
+#include "AttributeSet.h"           // For FGameplayAttribute used in each row
+#include "ScalableFloat.h"          // Per-level values (curve table rows or constants)
+#include "Engine/DataAsset.h"
+
+#include "GASCoreAttributeArchetypeDataAsset.generated.h"
+
+class UGASCoreAttributeSet;
+
+// ===== Row type authored in the Data Asset =====
+
+/**
+ * FGASCoreArchetypeAttributeValue
+ *
+ * Base value of one attribute for an archetype, scaled by level.
+ */
+USTRUCT(BlueprintType)
+struct FGASCoreArchetypeAttributeValue
+{
+	GENERATED_BODY()
+
+	/** Attribute of AttributeSetClass to initialize. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Attribute Archetype")
+	FGameplayAttribute Attribute;
+
+	/** Base value at a given level (constant, or a curve table row evaluated at the level). */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Attribute Archetype")
+	FScalableFloat BaseValue;
+};
+
+/**
+ * Resolved values of an archetype at one level, indexed by the set class's metadata ordinal.
+ * Shared by every instance of the archetype at that level; never modified after it is built.
+ */
+struct GASCORE_API FGASCoreArchetypeLevelValues
+{
+	/** Base value per ordinal (only meaningful where Specified is set). */
+	TArray<float> BaseValues;
+
+	/** Ordinals the archetype provides a value for. */
+	TBitArray<> Specified;
+};
+
+// ===== Data Asset =====
+
+/**
+ * UGASCoreAttributeArchetypeDataAsset
+ *
+ * Shared base attribute values for a class of actors (typically an enemy type), per level.
+ * - Replaces the per-instance init GameplayEffects for mass enemies: values are evaluated once per
+ *   (archetype, level) and written as base values (see UGASCoreAttributeSet::InitializeFromArchetype).
+ * - Still GE compatible: values land in the normal FGameplayAttributeData storage through the ASC, so
+ *   modifiers, MMCs and attribute delegates work unchanged.
+ */
+UCLASS(BlueprintType)
+class GASCORE_API UGASCoreAttributeArchetypeDataAsset : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Attribute set class the rows belong to (rows for other classes are ignored). */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Attribute Archetype")
+	TSubclassOf<UGASCoreAttributeSet> AttributeSetClass;
+
+	/** Authored base values. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Attribute Archetype", meta=(TitleProperty="Attribute"))
+	TArray<FGASCoreArchetypeAttributeValue> Attributes;
+
+	/**
+	 * Values at Level, evaluated on first request and cached on the asset (game thread).
+	 * Returns null if AttributeSetClass is not set.
+	 */
+	const FGASCoreArchetypeLevelValues* GetLevelValues(int32 Level) const;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	/** Level → resolved values. Heap-allocated so returned pointers survive later insertions. */
+	mutable TMap<int32, TUniquePtr<FGASCoreArchetypeLevelValues>> LevelCache;
+};
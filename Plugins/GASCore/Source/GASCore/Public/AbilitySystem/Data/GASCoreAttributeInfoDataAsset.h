@@ -60,6 +60,20 @@ struct FGASCoreAttributeInformation
  * Designer-authored container of attribute UI rows.
  * - The controller iterates these rows to broadcast initial values.
  * - It also uses the FGameplayAttribute identity per row to bind live updates.
+ *
+ * Lookup:
+ * - Authored rows: tag lookups go through an exact-match tag -> row index table built in PostLoad, rebuilt on editor
+ *   property changes, and built on first use for assets created at runtime. When several rows share a tag, the
+ *   first one wins.
+ * - Baked rows: binary search (the bake is sorted by tag name and unique).
+ *
+ * Cooked data:
+ * - Cooking bakes the rows into BakedRows: rows with an invalid tag or attribute are dropped, and so are later rows
+ *   repeating a tag (first authored row wins, as above), each with a cook warning. The rest are sorted by tag name,
+ *   and each row stores the byte offset of its FGameplayAttributeData inside the attribute set.
+ * - Cooked builds iterate the baked table: AreRowsValidated() is true, so callers skip per-row validation, and
+ *   GetRowNumericValue reads values by offset instead of resolving the attribute property.
+ * - The editor always uses the authored rows, so edits never go stale against a bake.
  */
 UCLASS(BlueprintType)
 class GASCORE_API UGASCoreAttributeInfoDataAsset : public UDataAsset
@@ -68,15 +82,21 @@ class GASCORE_API UGASCoreAttributeInfoDataAsset : public UDataAsset
 
 public:
 
-	/**
-	 * Return all authored rows.
-	 * Note: Returns by value for BP convenience. For large sets, consider adding a C++ const-ref accessor.
-	 */
-	TArray<FGASCoreAttributeInformation> GetAttributeInformation() const { return AttributeInformation; }
+	/** Rows to iterate (AttributeValue is not filled in): the baked table in cooked builds, else the authored rows. */
+	const TArray<FGASCoreAttributeInformation>& GetAttributeInformation() const { return UseBakedRows() ? BakedRows : AttributeInformation; }
 
 	/** BP-friendly way to retrieve the list without exposing the UPROPERTY directly. */
 	UFUNCTION(BlueprintPure, Category="GASCore|Attribute Info")
-	void GetAttributeInformation_BP(TArray<FGASCoreAttributeInformation>& OutRows) const { OutRows = AttributeInformation; }
+	void GetAttributeInformation_BP(TArray<FGASCoreAttributeInformation>& OutRows) const { OutRows = GetAttributeInformation(); }
+
+	/** True when every row of GetAttributeInformation has a valid tag and attribute (checked at cook time). */
+	bool AreRowsValidated() const { return UseBakedRows(); }
+
+	/**
+	 * Current value of GetAttributeInformation()[RowIndex] on Set (which must be of the row attribute's set class).
+	 * Baked rows read through the cooked offset; authored rows go through the FGameplayAttribute.
+	 */
+	float GetRowNumericValue(int32 RowIndex, const UAttributeSet* Set) const;
 
 	/**
 	 * Find the first row that matches AttributeTag exactly.
@@ -84,13 +104,53 @@ public:
 	 * @param bLogNotFound		Optional error logging if the tag is missing from this asset.
 	 * @return					Matching row by value, or a default-constructed row if not found.
 	 *
-	 * Note: Returns by value (convenient for BP). For C++ hot paths, you may add a pointer/const-ref accessor.
+	 * Note: Returns by value (convenient for BP). C++ hot paths should use FindAttributeInfoRowByTag.
 	 */
 	virtual FGASCoreAttributeInformation FindAttributeInfoByTag(const FGameplayTag& AttributeTag, bool bLogNotFound = false) const;
 
+	/** Authored row for AttributeTag (exact match, hashed), or null. Points into the asset: no FText copies. */
+	const FGASCoreAttributeInformation* FindAttributeInfoRowByTag(const FGameplayTag& AttributeTag, bool bLogNotFound = false) const;
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+#endif
+
 private:
 
 	/** Authored rows. TitleProperty helps identify each row in the editor details panel. */
 	UPROPERTY(EditDefaultsOnly, Category="GASCore|Attribute Info", meta=(TitleProperty="{AttributeName}"))
 	TArray<FGASCoreAttributeInformation> AttributeInformation;
+
+	/** Cook output: validated rows, sorted by tag name (LexicalLess) with unique tags. Empty in uncooked data. */
+	UPROPERTY()
+	TArray<FGASCoreAttributeInformation> BakedRows;
+
+	/** Cook output: FGameplayAttributeData byte offset per baked row (INDEX_NONE for plain float attributes). */
+	UPROPERTY()
+	TArray<int32> BakedAttributeOffsets;
+
+	/** Cook output: BakedRows is authoritative. */
+	UPROPERTY()
+	bool bHasBakedRows = false;
+
+	/** Baked rows are only used by cooked builds. */
+	bool UseBakedRows() const { return bHasBakedRows && FPlatformProperties::RequiresCookedData(); }
+
+	/** Rebuild RowIndexByTag from the authored rows (left empty when the baked rows are in use). */
+	void RebuildRowIndex() const;
+
+	/** Baked row for AttributeTag (binary search over BakedRows), or null. */
+	const FGASCoreAttributeInformation* FindBakedRow(const FGameplayTag& AttributeTag) const;
+
+	/** Sort order of BakedRows (tag names, lexically: stable between the cooking machine and the target). */
+	static bool BakedRowTagLess(const FGameplayTag& A, const FGameplayTag& B) { return A.GetTagName().LexicalLess(B.GetTagName()); }
+
+	/** Exact AttributeTag -> index into the authored rows (rows with an invalid tag are skipped; unused with baked rows). */
+	mutable TMap<FGameplayTag, int32> RowIndexByTag;
+
+	/** RowIndexByTag reflects GetAttributeInformation. */
+	mutable bool bRowIndexBuilt = false;
 };
\ No newline at end of file
@@ -0,0 +1,34 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+// ===== Engine Includes =====
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+
+#include "AbilitySystem/Formulas/GASCoreAttributeFormulas.h"
+
+#include "GASCoreFormulaCoefficientsDataAsset.generated.h"
+
+/**
+ * UGASCoreFormulaCoefficientsDataAsset
+ *
+ * Data-driven coefficient table for the native secondary formulas (GASCoreFormulas).
+ * - Defaults equal the GDD values; designers retune per game mode / difficulty without touching GEs.
+ * - Referenced by UGASCoreMMCSecondaryFormula and UGASCoreExecCalcSecondaryAttributes (null = GDD defaults).
+ */
+UCLASS(BlueprintType)
+class GASCORE_API UGASCoreFormulaCoefficientsDataAsset : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Formulas", meta=(ShowOnlyInnerProperties))
+	FGASCoreFormulaCoefficients Coefficients;
+
+	/** Coefficients of Asset, or the GDD defaults when Asset is null. */
+	static const FGASCoreFormulaCoefficients& Resolve(const UGASCoreFormulaCoefficientsDataAsset* Asset)
+	{
+		return Asset ? Asset->Coefficients : FGASCoreFormulaCoefficients::GetDefault();
+	}
+};
@@ -0,0 +1,74 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+// ===== Engine Includes =====
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+
+#include "GASCoreGameDataAsset.generated.h"
+
+class APlayerController;
+class UCurveTable;
+class UDataTable;
+class UGameplayAbility;
+class UGameplayEffect;
+class UGASCoreAttributeInfoDataAsset;
+
+/**
+ * UGASCoreGameDataAsset
+ *
+ * Primary asset listing the GAS data a game wants resident before gameplay, so first use in combat never loads
+ * synchronously.
+ * - Every reference is soft and tagged with an asset bundle: "Combat" (effects, abilities, curve tables), "UI"
+ *   (attribute info, message table) or "Input" (player controller classes, whose defaults hard-reference their
+ *   mapping contexts and input configs). The asset manager preloads the bundles asynchronously at startup.
+ * - Register the type in DefaultGame.ini (PrimaryAssetTypesToScan, type "GASCoreGameData").
+ * - The same references feed GASCoreSyncLoadReporter, which flags any of them loading synchronously in gameplay.
+ */
+UCLASS(BlueprintType)
+class GASCORE_API UGASCoreGameDataAsset : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Primary asset type name used for scanning and preloading. */
+	static const FPrimaryAssetType PrimaryAssetType;
+
+	/** Bundle names used by the meta tags below. */
+	static const FName CombatBundle;
+	static const FName UIBundle;
+	static const FName InputBundle;
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override { return FPrimaryAssetId(PrimaryAssetType, GetFName()); }
+
+	/** Every soft reference in this asset (all bundles). */
+	void GetAllAssetPaths(TArray<FSoftObjectPath>& OutPaths) const;
+
+	/** GameplayEffect classes applied in combat (damage, regen, pickups). */
+	UPROPERTY(EditDefaultsOnly, Category="GASCore|Game Data|Combat", meta=(AssetBundles="Combat"))
+	TArray<TSoftClassPtr<UGameplayEffect>> GameplayEffects;
+
+	/** Ability classes granted at runtime. */
+	UPROPERTY(EditDefaultsOnly, Category="GASCore|Game Data|Combat", meta=(AssetBundles="Combat"))
+	TArray<TSoftClassPtr<UGameplayAbility>> Abilities;
+
+	/** Curve tables read by effects and formulas (scalable floats). */
+	UPROPERTY(EditDefaultsOnly, Category="GASCore|Game Data|Combat", meta=(AssetBundles="Combat"))
+	TArray<TSoftObjectPtr<UCurveTable>> CurveTables;
+
+	/** Attribute menu / HUD attribute info assets. */
+	UPROPERTY(EditDefaultsOnly, Category="GASCore|Game Data|UI", meta=(AssetBundles="UI"))
+	TArray<TSoftObjectPtr<UGASCoreAttributeInfoDataAsset>> AttributeInfos;
+
+	/** UI message rows (effect asset tag popups). */
+	UPROPERTY(EditDefaultsOnly, Category="GASCore|Game Data|UI", meta=(AssetBundles="UI"))
+	TArray<TSoftObjectPtr<UDataTable>> MessageTables;
+
+	/**
+	 * Player controller classes to have resident before login/possession. Loading a class loads its defaults'
+	 * mapping contexts, input actions and ability input configs, so possession never loads input synchronously.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="GASCore|Game Data|Input", meta=(AssetBundles="Input"))
+	TArray<TSoftClassPtr<APlayerController>> PlayerControllerClasses;
+};
@@ -0,0 +1,54 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ActiveGameplayEffectHandle.h"
+#include "GameplayEffectTypes.h"
+#include "Templates/SubclassOf.h"
+
+class AActor;
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+/**
+ * FGASCoreEffectBatch
+ *
+ * One GameplayEffect on many targets (AoE explosions, effect zones):
+ * - One context and one spec (through FGASCoreEffectSpecCache) for the whole batch; source attributes are
+ *   captured once. The spec is applied to every target ASC, the same way an ability applies one spec handle to
+ *   all of its target data (GAS copies the spec per target and captures target attributes on application).
+ * - Targets resolving to the same ASC (e.g., avatar and PlayerState) receive the effect once; targets already at
+ *   the stack limit of an inert capped effect are skipped (FGASCoreEffectSpecTemplate::WouldBeDiscarded).
+ * - Effect-applied notifications are deferred to the end of the batch (FGASCoreDeferredEffectNotifyScope);
+ *   attribute change batches already coalesce at end of frame.
+ *
+ * Server-authoritative, like any effect application.
+ */
+class GASCORE_API FGASCoreEffectBatch
+{
+public:
+	/**
+	 * Apply EffectClass at Level from Source to every target. Source may have no ASC (world hazards): the
+	 * spec is then owned by the first target ASC and applied to self on each target.
+	 * Returns the number of targets the effect was applied to; OutHandles (optional) receives one handle per ASC.
+	 */
+	static int32 ApplyEffectToTargets(AActor* Source, TSubclassOf<UGameplayEffect> EffectClass, float Level,
+		TArrayView<AActor* const> Targets, TArray<FActiveGameplayEffectHandle>* OutHandles = nullptr);
+
+	/**
+	 * Apply a prebuilt spec (e.g. baked at projectile spawn, source attributes already captured) to every target.
+	 * Applied from the spec's instigator ASC when it still exists, otherwise to self on each target.
+	 * Same target de-duplication and deferred notifications as ApplyEffectToTargets.
+	 */
+	static int32 ApplySpecToTargets(const FGameplayEffectSpecHandle& SpecHandle, TArrayView<AActor* const> Targets,
+		TArray<FActiveGameplayEffectHandle>* OutHandles = nullptr);
+
+private:
+	/** Unique target ASCs, in target order. */
+	static void GatherTargetASCs(TArrayView<AActor* const> Targets, TArray<UAbilitySystemComponent*, TInlineAllocator<64>>& OutTargetASCs);
+
+	/** Apply Spec to every ASC (from SourceASC if set) inside one deferred-notification scope. */
+	static int32 ApplySpec(const FGameplayEffectSpec& Spec, UAbilitySystemComponent* SourceASC,
+		TArrayView<UAbilitySystemComponent* const> TargetASCs, TArray<FActiveGameplayEffectHandle>* OutHandles);
+};
@@ -0,0 +1,46 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectTypes.h"
+#include "Templates/SubclassOf.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+/**
+ * FGASCoreEffectSpecCache
+ *
+ * Spec prototypes for "static" GameplayEffects, keyed on (GE class, integral level):
+ * - Static = no executions, no custom/attribute-based magnitudes (modifiers and duration are scalable floats
+ *   or SetByCaller). Their spec does not depend on the source beyond its context and tags.
+ * - The first request builds the spec through the ASC as usual and keeps a copy; later requests copy that
+ *   prototype and swap in the new context (source tags are recaptured), skipping the duration/period/chance
+ *   curve lookups and capture setup of spec initialization.
+ * - Non-static classes and fractional levels always take ASC::MakeOutgoingSpec.
+ *
+ * Invalidation: the whole cache drops when any curve table is reloaded (UCurveTable global cache id, as
+ * FScalableFloat does), and in the editor when a GameplayEffect or curve table is edited.
+ * Game thread only; GASCore.EffectSpecCache.Enable 0 bypasses it.
+ */
+class GASCORE_API FGASCoreEffectSpecCache
+{
+public:
+	/** Drop-in for ASC->MakeOutgoingSpec(EffectClass, Level, Context). */
+	static FGameplayEffectSpecHandle MakeOutgoingSpec(UAbilitySystemComponent* ASC, TSubclassOf<UGameplayEffect> EffectClass,
+		float Level, FGameplayEffectContextHandle Context);
+
+	/**
+	 * Prototype spec for (EffectClass, Level), built through ASC on first use (Context seeds that build only).
+	 * Null when the class is not cacheable, Level is fractional or the cache is disabled. Valid until the next Reset.
+	 */
+	static const FGameplayEffectSpec* FindOrAddPrototype(UAbilitySystemComponent* ASC, TSubclassOf<UGameplayEffect> EffectClass,
+		float Level, const FGameplayEffectContextHandle& Context);
+
+	/** True when EffectClass qualifies for prototype caching. */
+	static bool IsCacheable(const UGameplayEffect& Effect);
+
+	/** Drop every prototype. */
+	static void Reset();
+};
@@ -0,0 +1,78 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ActiveGameplayEffectHandle.h"
+#include "GameplayEffectTypes.h"
+#include "Templates/SubclassOf.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+/**
+ * FGASCoreEffectSpecTemplate
+ *
+ * Invariant part of repeated applications of one GameplayEffect at one level, resolved once:
+ * - The GE CDO and its duration classification (no CDO lookups per application).
+ * - Whether the effect is static (FGASCoreEffectSpecCache::IsCacheable); static effects share the cache's
+ *   (class, level) prototype.
+ *
+ * Apply clones the prototype into a stack spec and patches only the context (instigator/causer/source tags),
+ * so repeated applications allocate no FGameplayEffectSpec / spec handle. Non-static effects fall back to
+ * MakeOutgoingSpec.
+ *
+ * Stack-aware early-out: a stacking effect whose re-application at the stack limit changes nothing (no duration
+ * refresh, no period reset, no overflow effects/clear) is skipped before any context/spec work when the target
+ * already holds StackLimitCount stacks (WouldBeDiscarded).
+ *
+ * Holds the class by value; the owner keeps it referenced (e.g., through the UPROPERTY config it came from).
+ */
+struct GASCORE_API FGASCoreEffectSpecTemplate
+{
+	FGASCoreEffectSpecTemplate() = default;
+	FGASCoreEffectSpecTemplate(TSubclassOf<UGameplayEffect> InEffectClass, float InLevel) { Initialize(InEffectClass, InLevel); }
+
+	/** Resolve the invariant data for EffectClass at Level. */
+	void Initialize(TSubclassOf<UGameplayEffect> InEffectClass, float InLevel);
+
+	/** True when initialized with a valid class. */
+	bool IsValid() const { return Effect != nullptr; }
+
+	/** True when this template was built for (InEffectClass, InLevel). */
+	bool Matches(const TSubclassOf<UGameplayEffect>& InEffectClass, const float InLevel) const { return EffectClass == InEffectClass && Level == InLevel; }
+
+	const UGameplayEffect* GetEffect() const { return Effect; }
+	TSubclassOf<UGameplayEffect> GetEffectClass() const { return EffectClass; }
+	float GetLevel() const { return Level; }
+	EGameplayEffectDurationType GetDurationPolicy() const { return DurationPolicy; }
+	bool IsNonInstant() const { return DurationPolicy != EGameplayEffectDurationType::Instant; }
+	bool IsInfinite() const { return DurationPolicy == EGameplayEffectDurationType::Infinite; }
+	bool IsPeriodic() const { return bPeriodic; }
+	bool IsStatic() const { return bStatic; }
+
+	/**
+	 * True when applying to TargetASC is a guaranteed no-op: the effect is capped-and-inert (see above) and the
+	 * target already holds the full stack. InstigatorASC is the spec's instigator (stacks aggregated by source).
+	 */
+	bool WouldBeDiscarded(const UAbilitySystemComponent* TargetASC, const UAbilitySystemComponent* InstigatorASC) const;
+
+	/**
+	 * Build the spec on TargetASC (as its own outgoing spec) with Context and apply it to TargetASC.
+	 * PredictionKey: client prediction (a local key) or the server's application under the client's key.
+	 */
+	FActiveGameplayEffectHandle ApplyToSelf(UAbilitySystemComponent* TargetASC, FGameplayEffectContextHandle Context,
+		FPredictionKey PredictionKey = FPredictionKey()) const;
+
+private:
+	TSubclassOf<UGameplayEffect> EffectClass;
+	const UGameplayEffect* Effect = nullptr;
+	float Level = 1.f;
+	EGameplayEffectDurationType DurationPolicy = EGameplayEffectDurationType::Instant;
+	bool bStatic = false;
+	bool bPeriodic = false;
+
+	/** Re-application at StackLimitCount is inert (0 = not a capped stacking effect). */
+	int32 InertStackLimit = 0;
+	bool bStacksBySource = false;
+};
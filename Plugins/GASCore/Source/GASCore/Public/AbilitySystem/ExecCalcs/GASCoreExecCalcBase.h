@@ -0,0 +1,43 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectExecutionCalculation.h"
+
+#include "GASCoreExecCalcBase.generated.h"
+
+/**
+ * UGASCoreExecCalcBase
+ *
+ * Shared base of the GASCore executions: captures are built once into RelevantAttributesToCapture
+ * (PostInitProperties / PostLoad / editor changes) from BuildAttributeCaptureDefinitions, like UGASCoreMMCBase.
+ */
+UCLASS(Abstract)
+class GASCORE_API UGASCoreExecCalcBase : public UGameplayEffectExecutionCalculation
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+protected:
+	/** Append every capture this execution reads (called whenever the configuration may have changed). */
+	virtual void BuildAttributeCaptureDefinitions(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures) const {}
+
+	/** Tag-aware evaluation parameters from the owning spec. */
+	static FAggregatorEvaluateParameters MakeEvaluationParameters(const FGameplayEffectCustomExecutionParameters& ExecutionParams);
+
+	/** Captured magnitude (0 when CaptureDef is unset or not captured). */
+	static float GetCapturedMagnitude(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
+		const FGameplayEffectAttributeCaptureDefinition& CaptureDef, const FAggregatorEvaluateParameters& EvaluationParameters);
+
+private:
+	/** Rebuild RelevantAttributesToCapture from BuildAttributeCaptureDefinitions. */
+	void RefreshAttributeCaptureDefinitions();
+};
@@ -0,0 +1,66 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "AbilitySystem/ExecCalcs/GASCoreExecCalcBase.h"
+
+#include "GASCoreExecCalcDamage.generated.h"
+
+class UGASCoreFormulaCoefficientsDataAsset;
+
+/**
+ * UGASCoreExecCalcDamage
+ *
+ * Native combat pipeline for one hit (GASCoreFormulas::ResolveDamage):
+ * - Base damage from the SetByCaller DamageSetByCallerTag.
+ * - Source ArmorPenetration / CriticalHitChance / CriticalHitDamage (snapshotted at spec creation) and
+ *   target Armor / BlockChance / CriticalHitResistance are captured once per execution.
+ * - Block (no crit when blocked) → crit → armor, then a single Additive modifier on IncomingDamageAttribute.
+ *
+ * The meta attribute is consumed by the target set (Builder.RegisterIncomingDamage), which subtracts it from Health.
+ * Unset captures read as 0, so a set without e.g. BlockChance simply never blocks.
+ */
+UCLASS()
+class GASCORE_API UGASCoreExecCalcDamage : public UGASCoreExecCalcBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
+		FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const override;
+
+protected:
+	virtual void BuildAttributeCaptureDefinitions(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures) const override;
+
+	// SetByCaller tag carrying the raw damage of the hit.
+	UPROPERTY(EditAnywhere, Category="GASCore|Exec|Damage")
+	FGameplayTag DamageSetByCallerTag;
+
+	// Meta attribute receiving the final damage (e.g., UTDAttributeSet::GetIncomingDamageAttribute()).
+	UPROPERTY(EditAnywhere, Category="GASCore|Exec|Damage")
+	FGameplayAttribute IncomingDamageAttribute;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|Exec|Damage|Source")
+	FGameplayEffectAttributeCaptureDefinition SourceArmorPenetration;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|Exec|Damage|Source")
+	FGameplayEffectAttributeCaptureDefinition SourceCriticalHitChance;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|Exec|Damage|Source")
+	FGameplayEffectAttributeCaptureDefinition SourceCriticalHitDamage;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|Exec|Damage|Target")
+	FGameplayEffectAttributeCaptureDefinition TargetArmor;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|Exec|Damage|Target")
+	FGameplayEffectAttributeCaptureDefinition TargetBlockChance;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|Exec|Damage|Target")
+	FGameplayEffectAttributeCaptureDefinition TargetCriticalHitResistance;
+
+	// Optional coefficient table (null = GDD defaults).
+	UPROPERTY(EditAnywhere, Category="GASCore|Exec|Damage")
+	TObjectPtr<UGASCoreFormulaCoefficientsDataAsset> Coefficients;
+};
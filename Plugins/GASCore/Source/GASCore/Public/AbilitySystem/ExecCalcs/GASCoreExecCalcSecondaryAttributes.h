@@ -0,0 +1,46 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystem/ExecCalcs/GASCoreExecCalcBase.h"
+#include "AbilitySystem/Formulas/GASCorePrimaryAttributeCaptures.h"
+
+#include "GASCoreExecCalcSecondaryAttributes.generated.h"
+
+class UGASCoreFormulaCoefficientsDataAsset;
+
+/**
+ * UGASCoreExecCalcSecondaryAttributes
+ *
+ * Writes every configured secondary attribute in one execution:
+ * - Captures the five primaries once, runs GASCoreFormulas::EvaluateAll (Armor / ArmorPenetration computed once
+ *   and shared), then emits one Override modifier per entry in TargetAttributes.
+ *
+ * Usage:
+ * - Instant or periodic GE (executions do not re-run on capture change); reapply when primaries change,
+ *   or use UGASCoreMMCSecondaryFormula on an infinite GE for live updates.
+ */
+UCLASS()
+class GASCORE_API UGASCoreExecCalcSecondaryAttributes : public UGASCoreExecCalcBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
+		FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const override;
+
+protected:
+	virtual void BuildAttributeCaptureDefinitions(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures) const override;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|Exec|Formula")
+	FGASCorePrimaryAttributeCaptures PrimaryCaptures;
+
+	// Formula → attribute written with its result. Formulas without an entry are skipped.
+	UPROPERTY(EditAnywhere, Category="GASCore|Exec|Formula")
+	TMap<EGASCoreSecondaryFormula, FGameplayAttribute> TargetAttributes;
+
+	// Optional coefficient table (null = GDD defaults).
+	UPROPERTY(EditAnywhere, Category="GASCore|Exec|Formula")
+	TObjectPtr<UGASCoreFormulaCoefficientsDataAsset> Coefficients;
+};
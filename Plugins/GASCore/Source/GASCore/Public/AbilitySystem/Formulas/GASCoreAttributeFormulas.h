@@ -0,0 +1,275 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+// GASCoreAttributeFormulas
+// Purpose:
+// - Native, inline versions of the secondary-attribute formulas from docs/gdd/attribute_formulas.cpp.
+// - Coefficients are data (FGASCoreFormulaCoefficients / UGASCoreFormulaCoefficientsDataAsset); the GDD values
+//   are the struct defaults.
+//
+// Consumers:
+// - UGASCoreMMCSecondaryFormula: one MMC evaluating one formula from captured primaries.
+// - UGASCoreExecCalcSecondaryAttributes: one execution writing every secondary in a single pass.
+// - Derived attribute graphs (FGASCoreAttributeMetadataBuilder::DeclareDerivedAttribute).
+//
+// Notes:
+// - Pure float math, no UObject access: safe on any thread and trivially inlined.
+// - Formulas that depend on other secondaries (BlockChance ← Armor, crits ← ArmorPenetration) take them as
+//   parameters; Evaluate() chains them from primaries exactly like the GDD's CalculateAllSecondaryAttributes.
+// - EvaluateAllBatch runs the same formulas over structure-of-arrays buffers, FGASCoreFormulaBatch::Lanes actors
+//   per SIMD register (wave spawns, see FGASCoreAttributeBatchInitializer).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GASCoreAttributeFormulas.generated.h"
+
+/** Secondary attributes with a GDD formula. */
+UENUM(BlueprintType)
+enum class EGASCoreSecondaryFormula : uint8
+{
+	Armor,
+	ArmorPenetration,
+	BlockChance,
+	CriticalHitChance,
+	CriticalHitDamage,
+	CriticalHitResistance,
+	Evasion,
+	MaxHealth,
+	HealthRegeneration,
+	MaxMana,
+	ManaRegeneration,
+	MaxStamina,
+	StaminaRegeneration,
+
+	Count UMETA(Hidden)
+};
+
+/** Primary inputs of the formulas. */
+USTRUCT(BlueprintType)
+struct FGASCorePrimaryAttributeValues
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="GASCore|Formulas")
+	float Strength = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="GASCore|Formulas")
+	float Dexterity = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="GASCore|Formulas")
+	float Intelligence = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="GASCore|Formulas")
+	float Endurance = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="GASCore|Formulas")
+	float Vigor = 0.f;
+};
+
+/**
+ * Formula coefficients (defaults = docs/gdd/attribute_formulas.cpp).
+ * Naming: <Attribute><Role>, e.g. Armor = ArmorScale * (Endurance + ArmorOffset).
+ */
+USTRUCT(BlueprintType)
+struct GASCORE_API FGASCoreFormulaCoefficients
+{
+	GENERATED_BODY()
+
+	// Attack Power = AttackPowerScale * (Strength + WeaponDamage)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Offense") float AttackPowerScale = 1.5f;
+	// Spell Power = SpellPowerScale * (Intelligence + SpellBase)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Offense") float SpellPowerScale = 1.5f;
+
+	// Armor = ArmorScale * (Endurance + ArmorOffset)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Defense") float ArmorScale = 1.25f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Defense") float ArmorOffset = 5.f;
+	// Armor Penetration = ArmorPenetrationScale * (Strength + ArmorPenetrationOffset)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Offense") float ArmorPenetrationScale = 0.45f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Offense") float ArmorPenetrationOffset = 3.f;
+	// Block Chance = clamp(Armor * BlockChancePerArmor, 0, BlockChanceMax)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Defense") float BlockChancePerArmor = 0.2f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Defense") float BlockChanceMax = 60.f;
+
+	// Crit Chance = clamp(CritChanceScale * (Dexterity + CritChanceOffset) + ArmorPenetration * CritChancePerArmorPenetration, 0, CritChanceMax)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Critical") float CritChanceScale = 0.4f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Critical") float CritChanceOffset = 2.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Critical") float CritChancePerArmorPenetration = 0.1f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Critical") float CritChanceMax = 95.f;
+	// Crit Damage = CritDamagePerDexterity * Dexterity + ArmorPenetration * CritDamagePerArmorPenetration + CritDamageBase
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Critical") float CritDamagePerDexterity = 1.15f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Critical") float CritDamagePerArmorPenetration = 0.2f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Critical") float CritDamageBase = 50.f;
+	// Crit Resistance = CritResistancePerArmor * Armor
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Critical") float CritResistancePerArmor = 0.5f;
+
+	// Evasion = EvasionScale * (Dexterity + Endurance) + EvasionBase
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Defense") float EvasionScale = 0.3f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Defense") float EvasionBase = 2.f;
+
+	// Max Health = MaxHealthPerVigor * Vigor + MaxHealthBase; Health Regen = HealthRegenScale * (Vigor + HealthRegenOffset)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Vitals") float MaxHealthPerVigor = 10.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Vitals") float MaxHealthBase = 50.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Vitals") float HealthRegenScale = 0.5f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Vitals") float HealthRegenOffset = 1.f;
+
+	// Max Mana = MaxManaPerIntelligence * Intelligence + MaxManaBase; Mana Regen = ManaRegenPerIntelligence * Intelligence + ManaRegenBase
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Vitals") float MaxManaPerIntelligence = 5.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Vitals") float MaxManaBase = 25.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Vitals") float ManaRegenPerIntelligence = 1.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Vitals") float ManaRegenBase = 3.f;
+
+	// Max Stamina = MaxStaminaPerVigor * Vigor + MaxStaminaBase; Stamina Regen = StaminaRegenScale * (Vigor + StaminaRegenOffset)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Vitals") float MaxStaminaPerVigor = 10.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Vitals") float MaxStaminaBase = 50.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Vitals") float StaminaRegenScale = 0.5f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Vitals") float StaminaRegenOffset = 1.f;
+
+	// Damage pipeline (GASCoreFormulas::ResolveDamage). Tuning values: the GDD defines the stats, not the mitigation curve.
+	// Effective Armor = Armor * (1 - clamp(ArmorPenetration, 0, 100) / 100)
+	// Armor multiplier = ArmorMitigationConstant / (ArmorMitigationConstant + Effective Armor)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Damage") float ArmorMitigationConstant = 100.f;
+	// Blocked hits deal Damage * BlockDamageMultiplier (and cannot crit).
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Damage") float BlockDamageMultiplier = 0.5f;
+	// Effective Crit Chance = max(Crit Chance - Crit Resistance * CritResistanceChanceScale, 0)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Damage") float CritResistanceChanceScale = 0.25f;
+
+	/** Shared GDD defaults. */
+	static const FGASCoreFormulaCoefficients& GetDefault();
+};
+
+namespace GASCoreFormulas
+{
+	/** Primary input index (SoA buffer index and input mask bit). */
+	enum EPrimaryInput : int32
+	{
+		Strength,
+		Dexterity,
+		Intelligence,
+		Endurance,
+		Vigor,
+
+		NumPrimaryInputs
+	};
+
+	constexpr int32 NumSecondaryFormulas = static_cast<int32>(EGASCoreSecondaryFormula::Count);
+}
+
+/**
+ * Structure-of-arrays buffers for GASCoreFormulas::EvaluateAllBatch.
+ * - Primaries[Input][Actor] in, Secondaries[Formula][Actor] out.
+ * - Buffers are 16-byte aligned and padded to a multiple of Lanes (padding lanes are zero and ignored).
+ */
+struct GASCORE_API FGASCoreFormulaBatch
+{
+	/** Actors per SIMD step (VectorRegister4Float: SSE / NEON). */
+	static constexpr int32 Lanes = 4;
+
+	using FBuffer = TArray<float, TAlignedHeapAllocator<16>>;
+
+	FBuffer Primaries[GASCoreFormulas::NumPrimaryInputs];
+	FBuffer Secondaries[GASCoreFormulas::NumSecondaryFormulas];
+
+	/** Size every buffer for InNum actors (keeps allocations across waves). Primaries are zeroed. */
+	void Reset(int32 InNum);
+
+	int32 Num() const { return NumActors; }
+
+	/** Padded length of every buffer. */
+	int32 NumPadded() const { return Primaries[0].Num(); }
+
+	float GetSecondary(const EGASCoreSecondaryFormula Formula, const int32 Actor) const { return Secondaries[static_cast<int32>(Formula)][Actor]; }
+
+private:
+	int32 NumActors = 0;
+};
+
+/** Inline formula library (see file header). */
+namespace GASCoreFormulas
+{
+	using FCoefficients = FGASCoreFormulaCoefficients;
+	using FPrimaries = FGASCorePrimaryAttributeValues;
+
+	FORCEINLINE float AttackPower(const FPrimaries& P, const float WeaponDamage, const FCoefficients& C) { return C.AttackPowerScale * (P.Strength + WeaponDamage); }
+	FORCEINLINE float SpellPower(const FPrimaries& P, const float SpellBase, const FCoefficients& C)     { return C.SpellPowerScale * (P.Intelligence + SpellBase); }
+
+	FORCEINLINE float Armor(const float Endurance, const FCoefficients& C)                { return C.ArmorScale * (Endurance + C.ArmorOffset); }
+	FORCEINLINE float ArmorPenetration(const float Strength, const FCoefficients& C)      { return C.ArmorPenetrationScale * (Strength + C.ArmorPenetrationOffset); }
+	FORCEINLINE float BlockChance(const float InArmor, const FCoefficients& C)            { return FMath::Clamp(InArmor * C.BlockChancePerArmor, 0.f, C.BlockChanceMax); }
+	FORCEINLINE float CriticalHitResistance(const float InArmor, const FCoefficients& C)  { return C.CritResistancePerArmor * InArmor; }
+
+	FORCEINLINE float CriticalHitChance(const float Dexterity, const float InArmorPenetration, const FCoefficients& C)
+	{
+		return FMath::Clamp(C.CritChanceScale * (Dexterity + C.CritChanceOffset) + InArmorPenetration * C.CritChancePerArmorPenetration, 0.f, C.CritChanceMax);
+	}
+
+	FORCEINLINE float CriticalHitDamage(const float Dexterity, const float InArmorPenetration, const FCoefficients& C)
+	{
+		return C.CritDamagePerDexterity * Dexterity + InArmorPenetration * C.CritDamagePerArmorPenetration + C.CritDamageBase;
+	}
+
+	FORCEINLINE float Evasion(const float Dexterity, const float Endurance, const FCoefficients& C) { return C.EvasionScale * (Dexterity + Endurance) + C.EvasionBase; }
+
+	FORCEINLINE float MaxHealth(const float Vigor, const FCoefficients& C)                 { return C.MaxHealthPerVigor * Vigor + C.MaxHealthBase; }
+	FORCEINLINE float HealthRegeneration(const float Vigor, const FCoefficients& C)        { return C.HealthRegenScale * (Vigor + C.HealthRegenOffset); }
+	FORCEINLINE float MaxMana(const float Intelligence, const FCoefficients& C)            { return C.MaxManaPerIntelligence * Intelligence + C.MaxManaBase; }
+	FORCEINLINE float ManaRegeneration(const float Intelligence, const FCoefficients& C)   { return C.ManaRegenPerIntelligence * Intelligence + C.ManaRegenBase; }
+	FORCEINLINE float MaxStamina(const float Vigor, const FCoefficients& C)                { return C.MaxStaminaPerVigor * Vigor + C.MaxStaminaBase; }
+	FORCEINLINE float StaminaRegeneration(const float Vigor, const FCoefficients& C)       { return C.StaminaRegenScale * (Vigor + C.StaminaRegenOffset); }
+
+	// ----- Damage pipeline -----
+
+	/** Inputs of one hit (percent values as authored: 25 = 25%). */
+	struct FDamageInputs
+	{
+		float BaseDamage = 0.f;
+		float SourceArmorPenetration = 0.f;
+		float SourceCriticalHitChance = 0.f;
+		float SourceCriticalHitDamage = 0.f;
+		float TargetArmor = 0.f;
+		float TargetBlockChance = 0.f;
+		float TargetCriticalHitResistance = 0.f;
+	};
+
+	struct FDamageResult
+	{
+		float Damage = 0.f;
+		bool bBlocked = false;
+		bool bCriticalHit = false;
+	};
+
+	FORCEINLINE float EffectiveArmor(const float TargetArmor, const float SourceArmorPenetration)
+	{
+		return FMath::Max(TargetArmor, 0.f) * (1.f - FMath::Clamp(SourceArmorPenetration, 0.f, 100.f) * 0.01f);
+	}
+
+	FORCEINLINE float ArmorDamageMultiplier(const float InEffectiveArmor, const FCoefficients& C)
+	{
+		return C.ArmorMitigationConstant / (C.ArmorMitigationConstant + FMath::Max(InEffectiveArmor, 0.f));
+	}
+
+	FORCEINLINE float EffectiveCriticalHitChance(const float CritChance, const float CritResistance, const FCoefficients& C)
+	{
+		return FMath::Max(CritChance - CritResistance * C.CritResistanceChanceScale, 0.f);
+	}
+
+	/** Crit Damage is the bonus in percent (150 → x2.5). */
+	FORCEINLINE float CriticalHitMultiplier(const float CritDamage) { return 1.f + FMath::Max(CritDamage, 0.f) * 0.01f; }
+
+	/**
+	 * Block → crit → armor, in one pass. Rolls are uniform in [0, 100) (passed in so callers own the RNG;
+	 * a roll below the chance succeeds).
+	 */
+	GASCORE_API FDamageResult ResolveDamage(const FDamageInputs& In, float BlockRoll, float CritRoll, const FCoefficients& C);
+
+	/** One secondary from primaries (dependent secondaries are chained as in the GDD). */
+	GASCORE_API float Evaluate(EGASCoreSecondaryFormula Formula, const FPrimaries& P, const FCoefficients& C);
+
+	/** Every secondary from primaries in one pass, indexed by EGASCoreSecondaryFormula. */
+	GASCORE_API void EvaluateAll(const FPrimaries& P, const FCoefficients& C, float (&OutValues)[NumSecondaryFormulas]);
+
+	/** Primaries a formula reads (for capture setup), as a mask of (1 << EPrimaryInput) bits. */
+	GASCORE_API uint8 GetPrimaryInputMask(EGASCoreSecondaryFormula Formula);
+
+	/** Evaluate every secondary for all actors in Batch (vectorized, Lanes actors per step). */
+	GASCORE_API void EvaluateAllBatch(FGASCoreFormulaBatch& Batch, const FCoefficients& C);
+}
@@ -0,0 +1,49 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectTypes.h"
+#include "AbilitySystem/Formulas/GASCoreAttributeFormulas.h"
+
+#include "GASCorePrimaryAttributeCaptures.generated.h"
+
+struct FGameplayEffectSpec;
+struct FGameplayEffectCustomExecutionParameters;
+
+/**
+ * FGASCorePrimaryAttributeCaptures
+ *
+ * Capture definitions for the five formula inputs. GASCore does not own the primary attributes,
+ * so the game points these at its own set (e.g., UTDAttributeSet::GetStrengthAttribute()).
+ * Unset captures read as 0.
+ */
+USTRUCT(BlueprintType)
+struct GASCORE_API FGASCorePrimaryAttributeCaptures
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category="GASCore|Formulas")
+	FGameplayEffectAttributeCaptureDefinition Strength;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|Formulas")
+	FGameplayEffectAttributeCaptureDefinition Dexterity;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|Formulas")
+	FGameplayEffectAttributeCaptureDefinition Intelligence;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|Formulas")
+	FGameplayEffectAttributeCaptureDefinition Endurance;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|Formulas")
+	FGameplayEffectAttributeCaptureDefinition Vigor;
+
+	/** Append the valid captures whose bit is set in InputMask (see GASCoreFormulas::GetPrimaryInputMask). */
+	void AppendCaptures(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures, uint8 InputMask = 0xFF) const;
+
+	/** Resolve captured values from a spec (MMC path). */
+	FGASCorePrimaryAttributeValues Evaluate(const FGameplayEffectSpec& Spec, uint8 InputMask = 0xFF) const;
+
+	/** Resolve captured values from an execution (exec calc path). */
+	FGASCorePrimaryAttributeValues Evaluate(const FGameplayEffectCustomExecutionParameters& ExecutionParams, uint8 InputMask = 0xFF) const;
+};
@@ -0,0 +1,91 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayModMagnitudeCalculation.h"
+#include "GameplayTagContainer.h"
+
+#include "GASCoreMMCBase.generated.h"
+
+UENUM(BlueprintType)
+enum class EGASCoreMMCRoundingPolicy : uint8
+{
+	None,
+	RoundHalfToEven,
+	Floor,
+	Ceil
+};
+
+/** Where level-scaled MMC terms read the level from. */
+UENUM(BlueprintType)
+enum class EGASCoreMMCLevelSource : uint8
+{
+	// IGASCoreCombatInterface::GetActorLevel on Context.SourceObject; active effects re-evaluate when the source
+	// broadcasts GetActorLevelChangedDelegate.
+	CombatInterface,
+	// Spec.GetLevel(): fixed when the spec is made; reapply the GE when the level changes.
+	SpecLevel,
+	// SetByCaller magnitude under LevelSetByCallerTag (1 when missing).
+	SetByCaller,
+	// Captured LevelAttributeDef (non-snapshot captures re-evaluate only when that attribute changes).
+	CapturedAttribute
+};
+
+/**
+ * UGASCoreMMCBase
+ *
+ * Shared base of the GASCore MMCs.
+ * - Capture definitions are built once into RelevantAttributesToCapture (PostInitProperties / PostLoad /
+ *   editor changes) from BuildAttributeCaptureDefinitions, so GetAttributeCaptureDefinitions stays the engine's
+ *   plain const getter instead of rebuilding a mutable array every time GAS asks.
+ * - Level source policy (LevelSource) shared by level-scaled MMCs.
+ * - Rounding policy helper for display-oriented outputs.
+ */
+UCLASS(Abstract)
+class GASCORE_API UGASCoreMMCBase : public UGameplayModMagnitudeCalculation
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	/** LevelSource == CombatInterface: the source's level-changed broadcast (server registration only, engine default). */
+	virtual FOnExternalGameplayModifierDependencyChange* GetExternalModifierDependencyMulticast(const FGameplayEffectSpec& Spec,
+		UWorld* World) const override;
+
+protected:
+	/** Append every capture this MMC reads (called whenever the configuration may have changed). */
+	virtual void BuildAttributeCaptureDefinitions(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures) const {}
+
+	/** Value of a captured attribute (post-aggregation, tag-aware); 0 if not captured. */
+	static float GetCapturedMagnitude(const FGameplayEffectSpec& Spec, const FGameplayEffectAttributeCaptureDefinition& CaptureDef,
+		const FAggregatorEvaluateParameters& EvaluationParameters);
+
+	/** Level per LevelSource (see EGASCoreMMCLevelSource). */
+	float GetSourceLevel(const FGameplayEffectSpec& Spec, const FAggregatorEvaluateParameters& EvaluationParameters) const;
+
+	/** Policy for reading the level. */
+	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Level")
+	EGASCoreMMCLevelSource LevelSource = EGASCoreMMCLevelSource::CombatInterface;
+
+	/** SetByCaller tag carrying the level (LevelSource == SetByCaller). */
+	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Level", meta=(EditCondition="LevelSource == EGASCoreMMCLevelSource::SetByCaller", EditConditionHides))
+	FGameplayTag LevelSetByCallerTag;
+
+	/** Level attribute capture (LevelSource == CapturedAttribute); registered with the other captures. */
+	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Level", meta=(EditCondition="LevelSource == EGASCoreMMCLevelSource::CapturedAttribute", EditConditionHides))
+	FGameplayEffectAttributeCaptureDefinition LevelAttributeDef;
+
+	/** Apply a rounding policy. */
+	static float ApplyRoundingPolicy(float Value, EGASCoreMMCRoundingPolicy Policy);
+
+private:
+	/** Rebuild RelevantAttributesToCapture from BuildAttributeCaptureDefinitions. */
+	void RefreshAttributeCaptureDefinitions();
+};
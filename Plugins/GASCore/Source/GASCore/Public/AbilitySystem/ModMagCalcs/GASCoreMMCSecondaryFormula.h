@@ -0,0 +1,49 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystem/ModMagCalcs/GASCoreMMCBase.h"
+#include "AbilitySystem/Formulas/GASCorePrimaryAttributeCaptures.h"
+
+#include "GASCoreMMCSecondaryFormula.generated.h"
+
+class UGASCoreFormulaCoefficientsDataAsset;
+
+/**
+ * UGASCoreMMCSecondaryFormula
+ *
+ * One GDD secondary formula as a single MMC:
+ *   Final = GASCoreFormulas::Evaluate(Formula, CapturedPrimaries, Coefficients)
+ *
+ * Why:
+ * - Replaces the BP modifier chains (several modifiers + aggregator passes per secondary) with one native call.
+ * - Dependent secondaries (BlockChance ← Armor, crits ← ArmorPenetration) are chained from the primaries inside
+ *   the formula, so no intermediate attribute needs to be up to date first.
+ *
+ * Notes:
+ * - Only the primaries the formula reads are captured (non-snapshot captures recompute on change).
+ * - Subclass in BP, pick Formula and point PrimaryCaptures at the game's primary attributes.
+ */
+UCLASS()
+class GASCORE_API UGASCoreMMCSecondaryFormula : public UGASCoreMMCBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual float CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const override;
+
+protected:
+	// Captures only the primaries used by Formula.
+	virtual void BuildAttributeCaptureDefinitions(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures) const override;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Formula")
+	EGASCoreSecondaryFormula Formula = EGASCoreSecondaryFormula::Armor;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Formula")
+	FGASCorePrimaryAttributeCaptures PrimaryCaptures;
+
+	// Optional coefficient table (null = GDD defaults).
+	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Formula")
+	TObjectPtr<UGASCoreFormulaCoefficientsDataAsset> Coefficients;
+};
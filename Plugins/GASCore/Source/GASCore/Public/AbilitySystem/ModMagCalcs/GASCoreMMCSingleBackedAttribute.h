@@ -3,19 +3,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "GameplayModMagnitudeCalculation.h"
+#include "AbilitySystem/ModMagCalcs/GASCoreMMCBase.h"
 
 #include "GASCoreMMCSingleBackedAttribute.generated.h"
 
-UENUM(BlueprintType)
-enum class EGASCoreMMCRoundingPolicy : uint8
-{
-	None,
-	RoundHalfToEven,
-	Floor,
-	Ceil
-};
-
 /**
  * UCoreMMC_SingleAttributeBase
  *
@@ -27,18 +18,19 @@ enum class EGASCoreMMCRoundingPolicy : uint8
  * Where:
  * - CapturedAttribute is read via the capture defined in CapturedAttributeDef
  *   (set AttributeToCapture, AttributeSource, and bSnapshot in BP or C++).
- * - Level is resolved from ICombatInterface on the Spec's Context.SourceObject if available,
- *   otherwise (see .cpp) you may choose to fall back to Spec.GetLevel().
+ * - Level comes from LevelSource (UGASCoreMMCBase): ICombatInterface on the Spec's Context.SourceObject (legacy
+ *   default), the spec level, a SetByCaller tag, or a captured Level attribute.
  *
  * Notes:
- * - This class overrides GetAttributeCaptureDefinitions() so that GAS will capture the attribute
- *   you configured on the class default object (CDO) before any GameplayEffectSpec uses it.
+ * - The capture is registered once (UGASCoreMMCBase builds RelevantAttributesToCapture on load/edit), so GAS
+ *   captures the attribute configured on the class default object (CDO) before any GameplayEffectSpec uses it.
+ * - For formulas over several attributes use UGASCoreMMCWeightedAttributes (one modifier instead of a chain).
  * - CalculateBaseMagnitude_Implementation returns the "base magnitude." The owning GameplayEffect
  *   can still apply its own PreAdd/Coefficient/PostAdd via FCustomCalculationBasedFloat.
  * - Keep this calculation allocation-free and fast; it runs on the game thread.
  */
 UCLASS()
-class GASCORE_API UGASCoreMMCSingleBackedAttribute : public UGameplayModMagnitudeCalculation
+class GASCORE_API UGASCoreMMCSingleBackedAttribute : public UGASCoreMMCBase
 {
 	GENERATED_BODY()
 
@@ -48,10 +40,10 @@ public:
 	// Called by GAS to compute the base magnitude for a GE modifier that references this MMC.
 	virtual float CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const override;
 
-	// Returns the capture definitions to register on the Spec; ensures our attribute is captured.
-	virtual const TArray<FGameplayEffectAttributeCaptureDefinition>& GetAttributeCaptureDefinitions() const override;
-
 protected:
+	// Registers CapturedAttributeDef (built once, see UGASCoreMMCBase).
+	virtual void BuildAttributeCaptureDefinitions(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures) const override;
+
 	// Single attribute to capture (choose Attribute, Source, and Snapshot in BP).
 	// Example (C++):
 	//   CaptureDef.AttributeToCapture = UGASCoreAttributeSet::GetVigorAttribute();
@@ -75,11 +67,4 @@ protected:
 	// Optional rounding of the final output (display convenience).
 	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Rounding Policy")
 	EGASCoreMMCRoundingPolicy RoundingPolicy = EGASCoreMMCRoundingPolicy::RoundHalfToEven;
-
-private:
-	// Backing array returned by GetAttributeCaptureDefinitions(); must be a stable ref.
-	mutable TArray<FGameplayEffectAttributeCaptureDefinition> CachedCaptures;
-
-	// Applies the rounding policy. (No clamping here to keep logic minimal.)
-	float FinalizeOutput(float Value) const;
 };
\ No newline at end of file
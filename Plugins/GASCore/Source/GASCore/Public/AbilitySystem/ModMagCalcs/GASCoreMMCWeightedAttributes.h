@@ -0,0 +1,66 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystem/ModMagCalcs/GASCoreMMCBase.h"
+
+#include "GASCoreMMCWeightedAttributes.generated.h"
+
+/** One weighted term: Coefficient * CapturedAttribute. */
+USTRUCT(BlueprintType)
+struct FGASCoreMMCWeightedTerm
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Properties")
+	FGameplayEffectAttributeCaptureDefinition CapturedAttributeDef;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Properties")
+	float Coefficient = 1.f;
+};
+
+/**
+ * UGASCoreMMCWeightedAttributes
+ *
+ * Linear combination of N captured attributes and Level in one evaluation:
+ *   Final = BaseMagnitude + Σ Terms[i].Coefficient * Captured(Terms[i]) + LevelMultiplier * Level
+ *
+ * Why:
+ * - UGASCoreMMCSingleBackedAttribute reads one attribute, so formulas like MaxHealth = a·Vigor + b·Endurance + c·Level
+ *   needed one modifier (and one aggregator pass) per term. This is one modifier per formula.
+ *
+ * Notes:
+ * - Captures are registered once (see UGASCoreMMCBase); the same attribute may appear in several terms.
+ * - Level resolution and rounding behave as in UGASCoreMMCSingleBackedAttribute.
+ */
+UCLASS()
+class GASCORE_API UGASCoreMMCWeightedAttributes : public UGASCoreMMCBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual float CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const override;
+
+protected:
+	virtual void BuildAttributeCaptureDefinitions(TArray<FGameplayEffectAttributeCaptureDefinition>& OutCaptures) const override;
+
+	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Properties", meta=(TitleProperty="CapturedAttributeDef"))
+	TArray<FGASCoreMMCWeightedTerm> Terms;
+
+	// Constant base part of the formula.
+	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Properties")
+	float BaseMagnitude = 0.f;
+
+	// Multiplies the Actor Level.
+	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Properties")
+	float LevelMultiplier = 0.f;
+
+	// Negative captured values are treated as 0 (same default as the single-attribute MMC).
+	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Properties")
+	bool bClampNegativeAttributes = true;
+
+	// Optional rounding of the final output (display convenience).
+	UPROPERTY(EditAnywhere, Category="GASCore|MMC|Rounding Policy")
+	EGASCoreMMCRoundingPolicy RoundingPolicy = EGASCoreMMCRoundingPolicy::RoundHalfToEven;
+};
@@ -0,0 +1,119 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Templates/SubclassOf.h"
+#include "UObject/TopLevelAssetPath.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+/**
+ * FGASCoreAbilitySystemSnapshot
+ *
+ * Compact binary save state of one ability system (checkpoints, save games, seamless travel):
+ * - Attribute base values of every spawned UGASCoreAttributeSet, read through the class metadata offsets
+ *   (no reflection). Meta attributes are not saved. Other attribute set classes are skipped.
+ * - Granted abilities: class, level and dynamic source tags (input tags).
+ * - Persistent active effects: effects whose asset tags match PersistentEffectTags or whose class is one of
+ *   PersistentEffectClasses (e.g. infinite attribute init effects, for a restore that skips initialization), with
+ *   level, stack count, remaining duration and SetByCaller magnitudes. Everything else (zone / pickup effects,
+ *   ability-owned effects) is rebuilt by the game as usual and is not saved.
+ *
+ * Format: header (magic, version), then a class table (class paths, each resolved once per process on load and
+ * cached) and a name table (attribute and tag names), then sections that refer to both by packed index. Attribute
+ * values are stored per class layout (attribute names once per class), so reordering or adding attributes keeps
+ * old saves loadable; unknown names are dropped.
+ *
+ * Apply (authority only), after the character was initialized as usual or instead of that initialization:
+ * 1) Base values other than clamped Currents written directly through UGASCoreAttributeSet::SetCurrentNumeric
+ *    (unchanged values skipped); no effects are re-run to rebuild them.
+ * 2) Abilities granted when missing, otherwise their level and input tags updated (GASCore input tag index kept).
+ * 3) Persistent effects re-applied (through FGASCoreEffectSpecCache), skipped when the class is already active.
+ * 4) Clamped Currents last, once the effects restored their Maxes.
+ */
+struct GASCORE_API FGASCoreAbilitySystemSnapshot
+{
+	/** Capture AbilitySystem's state; PersistentEffectTags and PersistentEffectClasses select the active effects to keep. */
+	static FGASCoreAbilitySystemSnapshot Capture(const UAbilitySystemComponent& AbilitySystem, const FGameplayTagContainer& PersistentEffectTags,
+		TConstArrayView<TSubclassOf<UGameplayEffect>> PersistentEffectClasses = {});
+
+	/** Restore onto AbilitySystem (server / standalone). @return false on a non-authoritative owner. */
+	bool Apply(UAbilitySystemComponent& AbilitySystem) const;
+
+	/** Write the binary form to OutBytes (replacing its contents). */
+	void Save(TArray<uint8>& OutBytes) const;
+
+	/** Replace this snapshot with the one in Bytes. @return false (snapshot left empty) on a bad or truncated blob. */
+	bool Load(TConstArrayView<uint8> Bytes);
+
+	bool IsEmpty() const { return AttributeSets.IsEmpty() && Abilities.IsEmpty() && Effects.IsEmpty(); }
+
+	void Reset();
+
+private:
+	/** Attribute names of one attribute set class, in the saving build's ordinal order. */
+	struct FAttributeLayout
+	{
+		int32 ClassIndex = INDEX_NONE;
+		TArray<int32> NameIndices;
+	};
+
+	struct FAttributeSetValues
+	{
+		int32 LayoutIndex = INDEX_NONE;
+		TArray<float> BaseValues;
+	};
+
+	struct FAbility
+	{
+		int32 ClassIndex = INDEX_NONE;
+		int32 Level = 1;
+		TArray<int32> TagNameIndices;
+	};
+
+	struct FEffect
+	{
+		int32 ClassIndex = INDEX_NONE;
+		float Level = 1.f;
+		int32 StackCount = 1;
+
+		/** Seconds left (< 0 = infinite). */
+		float TimeRemaining = -1.f;
+
+		TArray<TPair<int32, float>> SetByCallerTags;
+		TArray<TPair<int32, float>> SetByCallerNames;
+	};
+
+	int32 AddClass(const UClass* Class);
+	int32 AddName(FName Name);
+
+	/** Class of ClassIndex (cached across loads), null when it no longer exists. */
+	UClass* ResolveClass(int32 ClassIndex) const;
+
+	/** Tags of TagNameIndices that still exist. */
+	FGameplayTagContainer ResolveTags(TConstArrayView<int32> TagNameIndices) const;
+
+	void Serialize(FArchive& Ar);
+
+	/** Every index refers into the tables and every value row matches its layout (checked after Load). */
+	bool HasValidIndices() const;
+
+	/** Write the saved bases of either the clamped Currents or every other attribute. */
+	void ApplyAttributes(UAbilitySystemComponent& AbilitySystem, bool bCurrents) const;
+	void ApplyAbilities(UAbilitySystemComponent& AbilitySystem) const;
+	void ApplyEffects(UAbilitySystemComponent& AbilitySystem) const;
+
+	TArray<FTopLevelAssetPath> Classes;
+	TArray<FName> Names;
+	TArray<FAttributeLayout> Layouts;
+	TArray<FAttributeSetValues> AttributeSets;
+	TArray<FAbility> Abilities;
+	TArray<FEffect> Effects;
+
+	/** Lookup while capturing. */
+	TMap<const UClass*, int32> ClassIndices;
+	TMap<FName, int32> NameIndices;
+};
@@ -0,0 +1,68 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "GameFramework/Actor.h"
+#include "GameplayTagContainer.h"
+
+#include "GASCoreGameplayCueBurstActor.generated.h"
+
+/** One batched cue execution: the tag replicates as a net index, location and normal quantized. */
+USTRUCT()
+struct GASCORE_API FGASCoreBatchedCue
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGameplayTag CueTag;
+
+	UPROPERTY()
+	FVector_NetQuantize Location = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector_NetQuantizeNormal Normal = FVector::UpVector;
+
+	/** Passed as FGameplayCueParameters::RawMagnitude (e.g., damage for floating combat text). */
+	UPROPERTY()
+	float Magnitude = 0.f;
+
+	/** Actor the cue executes on (routed effect cues); null = location-only cue on the executing proxy. */
+	UPROPERTY()
+	TObjectPtr<AActor> Target = nullptr;
+};
+
+/** Native, client-side: a burst was executed locally (listeners filter by CueTag, e.g. combat text). */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FGASCoreOnCueBurstExecuted, const UWorld* /*World*/, TConstArrayView<FGASCoreBatchedCue> /*Cues*/);
+
+/**
+ * Replicated proxy for one relevancy cell of UGASCoreGameplayCueBatchSubsystem.
+ *
+ * - Sits at the cell centre, so normal distance-based relevancy decides which connections receive its bursts.
+ * - MulticastExecuteCueBurst carries every cue of the cell for one server frame; each machine (listen server
+ *   included, dedicated server excluded) executes them locally through the gameplay cue manager.
+ * - After executing, OnCueBurstExecuted hands the whole burst to native listeners (one call per burst, not per cue).
+ * - Has no replicated state: channels stay cheap and the actor is reused for the lifetime of the world.
+ */
+UCLASS(NotBlueprintable, NotPlaceable, Transient)
+class GASCORE_API AGASCoreGameplayCueBurstActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AGASCoreGameplayCueBurstActor();
+
+	/** Execute Cues on every connection this cell is relevant to (and locally). */
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastExecuteCueBurst(const TArray<FGASCoreBatchedCue>& Cues);
+
+	/** Fires once per executed burst on every non-dedicated machine, after the cue manager handled it. */
+	static FGASCoreOnCueBurstExecuted OnCueBurstExecuted;
+
+	/**
+	 * Run each cue as a non-replicated Executed event at its location, on its Target or else on Executor, then
+	 * broadcast OnCueBurstExecuted. Shared by the cell multicast and per-connection routed bursts.
+	 */
+	static void ExecuteCues(AActor* Executor, TConstArrayView<FGASCoreBatchedCue> Cues);
+};
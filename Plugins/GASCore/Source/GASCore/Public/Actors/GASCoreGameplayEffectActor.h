@@ -6,6 +6,12 @@
 // - Data-driven GameplayEffect application/removal controlled by FCoreEffectConfig entries.
 // - Tracks non-instant effects (HasDuration or Infinite; Periodic is covered) via handles for precise removal.
 // - Uses TWeakObjectPtr for GC-safe ASC tracking.
+// - Rows are bucketed per overlap timing when the templates are resolved (BeginPlay, pool reuse, editor edits):
+//   an overlap walks only its rows, and each row's template carries the cached CDO classification.
+// - Tracked handles are also indexed per target ASC, so removal only visits that target's handles.
+//   Entries leave as soon as their effect ends (each tracked ASC's OnAnyGameplayEffectRemovedDelegate); destroyed
+//   targets are purged by a periodic sweep (GASCore.EffectActor.TrackingSweepInterval). "stat GASCore" shows the
+//   totals, GASCore.EffectActor.DumpTracking the per-actor counts.
 // - See CoreGameplayEffect.cpp for implementation (recommend renaming that file to a .cpp).
 //
 // Design:
@@ -21,6 +27,41 @@
 //   - If you configure bDestroyOnEffectApplication on multiple entries, consider deferring destruction
 //     until all entries are processed to avoid early-exit (see note in implementation).
 //
+// Multi-component actors (sphere + mesh, ...):
+//   - Overlaps are reference counted per target: the first component overlap applies, further ones only count,
+//     and the last end-overlap removes. A count the targets' real overlaps no longer back (an unbound end-overlap,
+//     manual calls) is reset, so single-event setups behave as before.
+//
+// Pooling (UGASCoreEffectActorPoolSubsystem):
+//   - Actors spawned through the pool subsystem are "consumed" (bDestroyOnEffectApplication/Removal) back into
+//     their class pool (hidden, no collision, dormant) instead of being destroyed; placed actors still Destroy().
+//
+// Zone mode (bZoneMode, large fire fields / healing circles):
+//   - Server timer every ZoneTickInterval: one ComponentOverlapMulti against the actor's collision, diffed against
+//     the previous occupants. Entrants/leavers get the overlap/end-overlap policies in bulk through
+//     FGASCoreEffectBatch (applications) and the per-ASC tracking index (removals). OnOverlap/EndOverlap are ignored.
+//
+// Predicted pickups (bPredictedPickup):
+//   - The owning client's overlap hides the pickup locally and predicts its Instant ApplyOnOverlap rows on its own
+//     ASC under a prediction key, then asks the server (UGASCoreAbilitySystemComponent::ServerPredictedPickup).
+//   - The server validates the request and applies the rows under the client's key (GAS drops the predicted effects
+//     when the key catches up), or rejects and the client restores the pickup. The confirmed hide arrives through the
+//     normal dormancy flush.
+//   - Each ASC is served once per stay (recorded before applying, cleared on its end overlap) and a prediction key
+//     is accepted once: repeated or replayed requests are rejected.
+//   - The server's own overlap of a remote player waits GASCore.PredictedPickup.ServerGrace for the request, then
+//     applies authoritatively (clients that do not predict); a request arriving after that is acknowledged only.
+//
+// Respawn:
+//   - RespawnDelay > 0: consumption schedules a copy (same class, transform and rows) on UGASCorePickupSpawnerSubsystem.
+//
+// Spatial registry:
+//   - Active actors are filed in UGASCoreEffectActorRegistrySubsystem under their rows' asset tags (AI/UI queries).
+//
+// Replication cost:
+//   - Starts DORM_Initial with a low net update frequency; state changes (pool activation/deactivation) flush
+//     dormancy once, so idle pickups cost nothing per net tick. NetCullDistance (> 0) sets the relevancy radius.
+//
 // Networking note:
 //   - Applying/removing gameplay effects is typically server-authoritative.
 //     Ensure overlap events run on the server or route via server RPCs (HasAuthority()).
@@ -32,11 +73,14 @@
 #include "CoreMinimal.h"
 #include "ActiveGameplayEffectHandle.h"
 #include "GameplayEffect.h"
+#include "AbilitySystem/Effects/GASCoreEffectSpecTemplate.h"
 #include "GameFramework/Actor.h"
+#include "TimerManager.h"
 #include "GASCoreGameplayEffectActor.generated.h"
 
 class UAbilitySystemComponent;
 class UGameplayEffect;
+class UGASCoreAbilitySystemComponent;
 
 // -----------------------------------------------------------------------------
 // Effect timing policies
@@ -172,6 +216,12 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void OnRep_ReplicatedMovement() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 
 public:
 	// -----------------------------------------------------------------------
@@ -196,6 +246,53 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GASCore|Gameplay Effect |Functions")
 	void EndOverlap(AActor* TargetActor);
 
+	// -----------------------------------------------------------------------
+	// POOLED LIFECYCLE (driven by UGASCoreEffectActorPoolSubsystem)
+	// -----------------------------------------------------------------------
+
+	/**
+	 * Reset for (re)use at Transform and mark this actor as pool-owned (consumption releases it to the pool).
+	 * InGameplayEffects replaces the rows (null = class defaults); InActorLevel > 0 overrides every row's level.
+	 */
+	void ActivateFromPool(const FTransform& Transform, const TArray<FGASCoreEffectConfig>* InGameplayEffects, float InActorLevel);
+
+	/** Hide, disable collision and drop tracked handles until reused (stays net dormant). */
+	void DeactivateToPool();
+
+	/** True while deactivated in a pool. */
+	bool IsInPool() const { return bInPool; }
+
+	/** Union of the asset tags of every row's GameplayEffect (registry key). */
+	FGameplayTagContainer GetEffectAssetTags() const;
+
+	/** Live tracked (removable) effect handles / distinct target ASCs (debug). */
+	int32 GetNumTrackedEffects() const { return ActiveGameplayEffects.Num(); }
+	int32 GetNumTrackedTargets() const { return TrackedHandlesByASC.Num(); }
+
+	/** Heap bytes of the tracking maps, spec templates, row tables and overlap / zone sets (GASCore.MemReport). */
+	SIZE_T GetTrackingAllocatedSize() const;
+
+	// -----------------------------------------------------------------------
+	// PREDICTED PICKUP (bPredictedPickup)
+	// -----------------------------------------------------------------------
+
+	/**
+	 * Server: validate and apply a pickup the client predicted under PredictionKey (inside the client's prediction
+	 * window). False when the client should roll back: invalid, repeated or already served by another request.
+	 */
+	bool ConfirmPredictedPickup(UGASCoreAbilitySystemComponent* ASC, const FPredictionKey& PredictionKey);
+
+	/** Client: the server refused the pickup; show it again. */
+	void RollbackPredictedPickup();
+
+	// -----------------------------------------------------------------------
+	// ZONE MODE
+	// -----------------------------------------------------------------------
+
+	/** Change the zone poll period (restarts the zone timer when running). */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|Gameplay Effect Actor|Zone")
+	void SetZoneTickInterval(float InZoneTickInterval);
+
 protected:
 	// -----------------------------------------------------------------------
 	// EFFECT CONFIGURATIONS
@@ -214,6 +311,33 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GASCore|Gameplay Effect Actor|Gameplay Effects", meta = (TitleProperty = "EffectClass"))
 	TArray<FGASCoreEffectConfig> GameplayEffects;
 
+	/**
+	 * Predicted pickup: the owning client hides the pickup and predicts its Instant ApplyOnOverlap rows immediately;
+	 * the server confirms or rolls back. Player pawns controlled by remote clients are served through that request, or
+	 * by the server's own overlap after GASCore.PredictedPickup.ServerGrace when none arrives.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GASCore|Gameplay Effect Actor|Prediction")
+	bool bPredictedPickup = false;
+
+	/** Seconds after consumption until a copy respawns here (UGASCorePickupSpawnerSubsystem); 0 = never. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GASCore|Gameplay Effect Actor|Respawn", meta = (ClampMin = "0.0", Units = "s"))
+	float RespawnDelay = 0.f;
+
+	/** Network relevancy radius in cm for this pickup (0 = engine/class default NetCullDistanceSquared). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GASCore|Gameplay Effect Actor|Replication", meta = (ClampMin = "0.0", Units = "cm"))
+	float NetCullDistance = 0.f;
+
+	/**
+	 * Zone mode: the server polls the first query-enabled primitive component every ZoneTickInterval and applies/removes
+	 * effects for actors that entered/left since the previous poll. OnOverlap/EndOverlap calls are ignored.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GASCore|Gameplay Effect Actor|Zone")
+	bool bZoneMode = false;
+
+	/** Seconds between zone polls. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GASCore|Gameplay Effect Actor|Zone", meta = (EditCondition = "bZoneMode", ClampMin = "0.05"))
+	float ZoneTickInterval = 0.5f;
+
 private:
 	// -----------------------------------------------------------------------
 	// COMPONENTS
@@ -235,22 +359,135 @@ private:
 	UPROPERTY()
 	TMap<FActiveGameplayEffectHandle, FGASCoreTrackedEffect> ActiveGameplayEffects;
 
+	/** Secondary index of ActiveGameplayEffects: handles per target ASC (kept in sync on apply/remove/sweep). */
+	TMap<TWeakObjectPtr<UAbilitySystemComponent>, TArray<FActiveGameplayEffectHandle>> TrackedHandlesByASC;
+
+	/** Our OnAnyGameplayEffectRemovedDelegate binding per tracked ASC (same keys as TrackedHandlesByASC). */
+	TMap<TWeakObjectPtr<UAbilitySystemComponent>, FDelegateHandle> EffectRemovedDelegates;
+
+	/** Running while anything is tracked; drives SweepTrackedEffects. */
+	FTimerHandle TrackingSweepTimer;
+
+	/** GASCore.EffectActor.MaxTrackedEffects was exceeded (warned once). */
+	bool bTrackingCapWarned = false;
+
+	/** Per-row spec templates (same index as GameplayEffects), resolved in BeginPlay. */
+	TArray<FGASCoreEffectSpecTemplate> EffectTemplates;
+
+	/** Row indices (with an EffectClass) per timing, rebuilt with the templates. */
+	TArray<int32> ApplyOnOverlapRows;
+	TArray<int32> ApplyOnEndOverlapRows;
+	TArray<int32> RemoveOnOverlapRows;
+	TArray<int32> RemoveOnEndOverlapRows;
+
+	/** Client: a predicted pickup is waiting for the server (until its key catches up). */
+	bool bPredictedPickupPending = false;
+
+	/** Client: this pickup was hidden by our own prediction (restored on rejection). */
+	bool bHiddenByPrediction = false;
+
+	/** Server: ASCs served during their current stay, with the prediction key used (0 = server overlap, unpredicted). */
+	TMap<TWeakObjectPtr<UAbilitySystemComponent>, FPredictionKey::KeyType> ServedPickupASCs;
+
+	/** Server: last prediction key accepted per ASC (kept across stays: a key confirms one pickup). */
+	TMap<TWeakObjectPtr<UAbilitySystemComponent>, FPredictionKey::KeyType> AcceptedPickupKeys;
+
+	/** OnOverlap calls not yet matched by EndOverlap, per target (component overlaps of multi-primitive actors). */
+	TMap<TWeakObjectPtr<AActor>, int32> OverlapRefCounts;
+
+	/** Zone occupants (with an ASC) of the previous poll. */
+	TSet<TWeakObjectPtr<AActor>> ZoneOccupants;
+
+	/** Drives TickZone while zone mode is running (server). */
+	FTimerHandle ZoneTimer;
+
+	/** Handed out by UGASCoreEffectActorPoolSubsystem: consumption returns it there instead of destroying it. */
+	bool bPoolOwned = false;
+
+	/** Deactivated in the pool (ignores overlaps). */
+	bool bInPool = false;
+
 	// -----------------------------------------------------------------------
 	// CORE OPERATIONS
 	// -----------------------------------------------------------------------
 
+	/** Number of this actor's primitive components currently overlapping TargetActor. */
+	int32 CountOverlappingComponents(const AActor* TargetActor) const;
+
 	/** Apply all effects whose ApplicationPolicy matches the given timing. */
 	void ApplyAllGameplayEffects(AActor* TargetActor, EGASCoreEffectApplicationPolicy ApplicationPolicy);
 
 	/** Remove all effects whose RemovalPolicy matches the given timing. */
 	void RemoveAllGameplayEffects(AActor* TargetActor, EGASCoreEffectRemovalPolicy RemovalPolicy);
 
-	/** Build context/spec and apply a single configured effect to the target. */
-	void ApplyGameplayEffectToTarget(AActor* TargetActor, const FGASCoreEffectConfig& EffectConfig);
+	/** Build context/spec (from the row's template) and apply a single configured effect to the target. */
+	void ApplyGameplayEffectToTarget(AActor* TargetActor, const FGASCoreEffectConfig& EffectConfig,
+		const FGASCoreEffectSpecTemplate& EffectTemplate);
+
+	/**
+	 * bPredictedPickup routing for an overlap: true when the overlap is handled (or deliberately ignored) by the
+	 * predicted path, false to process it normally (listen-server host, AI, non-player actors).
+	 */
+	bool HandlePredictedPickupOverlap(AActor* TargetActor);
+
+	/** Client: predict the pickup on ASC and send the request. */
+	void PredictPickup(UGASCoreAbilitySystemComponent* ASC);
+
+	/** Client: the server acknowledged the prediction key (confirmed or rejected). */
+	void HandlePredictedPickupCaughtUp();
+
+	/** Server: no request came for a remote player's overlap within the grace period; pick up authoritatively. */
+	void HandleServerPickupGraceExpired(TWeakObjectPtr<AActor> TargetActor);
+
+	/** Server: TargetActor's ASC if it may still be served this stay (recorded before any application), else null. */
+	UAbilitySystemComponent* ClaimPickupFor(AActor* TargetActor, FPredictionKey::KeyType PredictionKey);
+
+	/** Context for TargetASC with this actor as source object and causer. */
+	FGameplayEffectContextHandle MakePickupEffectContext(UAbilitySystemComponent* TargetASC) const;
+
+	/** Server: start polling the zone (no-op outside zone mode). */
+	void StartZone();
+
+	/** Stop polling and forget the occupants (their effects stay, as on Destroy). */
+	void StopZone();
+
+	/** One zone poll: overlap query, occupant diff, bulk apply/remove. */
+	void TickZone();
+
+	/** Apply every row with ApplicationPolicy to Targets through one batch per row; tracks removable handles. */
+	void ApplyZoneEffects(TArrayView<AActor* const> Targets, EGASCoreEffectApplicationPolicy ApplicationPolicy);
+
+	/** Resolve every row's template and rebuild the per-timing row buckets (BeginPlay, pool reactivation, edits). */
+	void InitializeEffectTemplates();
+
+	/** Rows applied for ApplicationPolicy / removed for RemovalPolicy (empty for DoNotApply / DoNotRemove). */
+	const TArray<int32>& GetApplicationRows(EGASCoreEffectApplicationPolicy ApplicationPolicy);
+	const TArray<int32>& GetRemovalRows(EGASCoreEffectRemovalPolicy RemovalPolicy);
+
+	/** Consumable finished (destroy flags): release to the pool when pool-owned, otherwise Destroy(). */
+	void Consume();
+
+	/** Template of GameplayEffects[Index], re-resolved if the row changed since BeginPlay. */
+	const FGASCoreEffectSpecTemplate& GetEffectTemplate(int32 Index);
 
 	/** Remove stacks/effects previously applied by this actor that match the config. */
 	void RemoveGameplayEffectFromTarget(AActor* TargetActor, const FGASCoreEffectConfig& EffectConfig);
 
+	/** Record a tracked handle in both ActiveGameplayEffects and the per-ASC index (starts the sweep). */
+	void TrackEffect(const FActiveGameplayEffectHandle& Handle, const FGASCoreTrackedEffect& Track);
+
+	/** Drop a tracked handle from both maps; the last handle of a target also unbinds from its ASC. */
+	void UntrackEffect(const FActiveGameplayEffectHandle& Handle);
+
+	/** Forget every tracked handle and unbind from all tracked ASCs (pool release, EndPlay). */
+	void ResetTracking();
+
+	/** A tracked ASC lost an active effect (expired or removed elsewhere): untrack it if it was ours. */
+	void HandleTrackedEffectRemoved(const FActiveGameplayEffect& RemovedEffect);
+
+	/** Drop entries whose target ASC is gone or whose handle expired on it; stops itself when nothing is left. */
+	void SweepTrackedEffects();
+
 	// -----------------------------------------------------------------------
 	// HELPERS (inspect GE class characteristics)
 	// -----------------------------------------------------------------------
@@ -36,6 +36,12 @@ struct GASCORE_API FGASCoreAbilityInputAction
  * Data asset that holds a collection of input actions and their associated input tags.
  * Used to configure and map input actions to ability input tags for the GAS input system.
  * Place instances of this Data Asset in your game content and reference it from your PlayerController.
+ *
+ * Lookup:
+ * - FindAbilityInputActionByTag is an exact-match hash lookup (same semantics as the input bindings). The table is
+ *   built in PostLoad, rebuilt on editor property changes, and built on first use for assets created at runtime.
+ * - FindAbilityInputActionByTagHierarchical additionally falls back to a MatchesTag scan.
+ * - When several rows share a tag, the first row wins.
  */
 UCLASS()
 class GASCORE_API UGASCoreAbilityInputConfig : public UDataAsset
@@ -52,7 +58,29 @@ public:
 	 */
 	virtual const UInputAction* FindAbilityInputActionByTag(const FGameplayTag& InputTag, bool bLogNotFound = false) const;
 
+	/**
+	 * Exact lookup first; on a miss, the first row whose InputTag matches InputTag hierarchically
+	 * (e.g. a row tagged InputTag.Action.1 answers InputTag.Action). Linear on the fallback path.
+	 */
+	const UInputAction* FindAbilityInputActionByTagHierarchical(const FGameplayTag& InputTag, bool bLogNotFound = false) const;
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 	/** Array of input actions mapped to ability tags. Used for configuring ability input triggers. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="GASCore|Ability Input Config|Input")
 	TArray<FGASCoreAbilityInputAction> AbilityInputActions;
+
+private:
+	/** Rebuild InputActionsByTag from AbilityInputActions. */
+	void RebuildInputActionLookup() const;
+
+	/** Exact InputTag -> action (rows with a null action or invalid tag are skipped). Actions are kept alive by AbilityInputActions. */
+	mutable TMap<FGameplayTag, const UInputAction*> InputActionsByTag;
+
+	/** InputActionsByTag reflects AbilityInputActions. */
+	mutable bool bInputActionLookupBuilt = false;
 };
\ No newline at end of file
@@ -10,6 +10,9 @@
 #include "GASCoreAbilityInputConfig.h"
 #include "GASCoreEnhancedInputComponent.generated.h"
 
+/** Receives every ability input tag held this frame in one call (see BindAbilityInputActionsAggregated). */
+DECLARE_DELEGATE_OneParam(FGASCoreHeldInputTagsDelegate, TArrayView<const FGameplayTag> /*HeldInputTags*/);
+
 /**
  * Custom input component that binds ability input actions from a data-driven config.
  * Provides template-based binding for input delegates using tags.
@@ -17,6 +20,16 @@
  * Modular notes:
  * - This component is plugin-agnostic regarding the game module; it only depends on EnhancedInput and GameplayTags.
  * - Your game can subclass PlayerController and use this component directly.
+ *
+ * Aggregated held input:
+ * - BindAbilityInputActionsAggregated collects the tags of every Triggered ability action during input processing
+ *   and delivers them in one callback per frame, instead of one callback per held action per frame.
+ * - The owner calls FlushHeldAbilityInput after input processing (PlayerController::PostProcessInput); if it does not,
+ *   the pending tags are flushed at the end of the frame.
+ *
+ * Binding cache:
+ * - Both Bind functions remember the config they bound. Binding the same config again (re-possession, respawn,
+ *   a repeated SetupInputComponent) keeps the existing bindings; a different config replaces them.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class GASCORE_API UGASCoreEnhancedInputComponent : public UEnhancedInputComponent
@@ -43,6 +56,48 @@ public:
 	template<class UserClass, typename PressedFuncType, typename ReleasedFuncType, typename HeldFuncType>
 	void BindAbilityInputActions(const UGASCoreAbilityInputConfig* InputConfig, UserClass* Object,
 		PressedFuncType PressedFunc, ReleasedFuncType ReleasedFunc, HeldFuncType HeldFunc);
+
+	/**
+	 * Same as BindAbilityInputActions, but held input is aggregated: HeldTagsFunc is invoked once per frame with
+	 * the tags of all ability actions that triggered this frame (no duplicates, in trigger order).
+	 *
+	 * @param HeldTagsFunc Member function of UserClass taking TArrayView<const FGameplayTag> (may be nullptr).
+	 */
+	template<class UserClass, typename PressedFuncType, typename ReleasedFuncType, typename HeldTagsFuncType>
+	void BindAbilityInputActionsAggregated(const UGASCoreAbilityInputConfig* InputConfig, UserClass* Object,
+		PressedFuncType PressedFunc, ReleasedFuncType ReleasedFunc, HeldTagsFuncType HeldTagsFunc);
+
+	/** Deliver the held tags collected so far this frame. No-op when nothing is pending. */
+	void FlushHeldAbilityInput();
+
+	/** True when InputConfig's ability actions are already bound on this component. */
+	bool HasAbilityInputBindings(const UGASCoreAbilityInputConfig* InputConfig) const { return InputConfig && BoundAbilityInputConfig == InputConfig; }
+
+	/** Remove every ability action binding made by the Bind functions. */
+	void ClearAbilityInputBindings();
+
+private:
+	/** Triggered handler of aggregated bindings: records the tag and makes sure a flush happens this frame. */
+	void CollectHeldInputTag(FGameplayTag InputTag);
+
+	/** Aggregated held-input callback (bound by BindAbilityInputActionsAggregated). */
+	FGASCoreHeldInputTagsDelegate HeldInputTagsDelegate;
+
+	/** Tags triggered since the last flush. */
+	TArray<FGameplayTag, TInlineAllocator<8>> PendingHeldInputTags;
+
+	/** End-of-frame fallback flush already scheduled for this frame. */
+	bool bHeldInputFlushScheduled = false;
+
+	/** Start binding InputConfig; returns false if it is already bound (cached bindings are kept). */
+	bool BeginAbilityInputBinding(const UGASCoreAbilityInputConfig* InputConfig);
+
+	/** Config whose ability actions are currently bound. */
+	UPROPERTY(Transient)
+	TObjectPtr<const UGASCoreAbilityInputConfig> BoundAbilityInputConfig;
+
+	/** Handles of the ability action bindings made for BoundAbilityInputConfig. */
+	TArray<uint32> AbilityBindingHandles;
 };
 
 template <class UserClass, typename PressedFuncType, typename ReleasedFuncType, typename HeldFuncType>
@@ -51,6 +106,11 @@ void UGASCoreEnhancedInputComponent::BindAbilityInputActions(const UGASCoreAbili
 {
 	check(InputConfig);
 
+	if (!BeginAbilityInputBinding(InputConfig))
+	{
+		return;
+	}
+
 	for (const FGASCoreAbilityInputAction& InputAction : InputConfig->AbilityInputActions)
 	{
 		// Only bind if both an InputAction asset and a valid InputTag are present.
@@ -59,16 +119,54 @@ void UGASCoreEnhancedInputComponent::BindAbilityInputActions(const UGASCoreAbili
 			// For function pointers, check for nullptr (not .IsValid()).
 			if (PressedFunc)
 			{
-				BindAction(InputAction.InputAction, ETriggerEvent::Started, Object, PressedFunc, InputAction.InputTag);	
+				AbilityBindingHandles.Add(BindAction(InputAction.InputAction, ETriggerEvent::Started, Object, PressedFunc, InputAction.InputTag).GetHandle());
 			}
 			if (ReleasedFunc)
 			{
-				BindAction(InputAction.InputAction, ETriggerEvent::Completed, Object, ReleasedFunc, InputAction.InputTag);
+				AbilityBindingHandles.Add(BindAction(InputAction.InputAction, ETriggerEvent::Completed, Object, ReleasedFunc, InputAction.InputTag).GetHandle());
 			}
 			if (HeldFunc)
 			{
-				BindAction(InputAction.InputAction, ETriggerEvent::Triggered, Object, HeldFunc, InputAction.InputTag);
+				AbilityBindingHandles.Add(BindAction(InputAction.InputAction, ETriggerEvent::Triggered, Object, HeldFunc, InputAction.InputTag).GetHandle());
+			}
+		}
+	}
+}
+
+template <class UserClass, typename PressedFuncType, typename ReleasedFuncType, typename HeldTagsFuncType>
+void UGASCoreEnhancedInputComponent::BindAbilityInputActionsAggregated(const UGASCoreAbilityInputConfig* InputConfig, UserClass* Object,
+	PressedFuncType PressedFunc, ReleasedFuncType ReleasedFunc, HeldTagsFuncType HeldTagsFunc)
+{
+	check(InputConfig);
+
+	if (!BeginAbilityInputBinding(InputConfig))
+	{
+		return;
+	}
+
+	if (HeldTagsFunc)
+	{
+		HeldInputTagsDelegate.BindUObject(Object, HeldTagsFunc);
+	}
+
+	for (const FGASCoreAbilityInputAction& InputAction : InputConfig->AbilityInputActions)
+	{
+		if (InputAction.InputAction && InputAction.InputTag.IsValid())
+		{
+			if (PressedFunc)
+			{
+				AbilityBindingHandles.Add(BindAction(InputAction.InputAction, ETriggerEvent::Started, Object, PressedFunc, InputAction.InputTag).GetHandle());
+			}
+			if (ReleasedFunc)
+			{
+				AbilityBindingHandles.Add(BindAction(InputAction.InputAction, ETriggerEvent::Completed, Object, ReleasedFunc, InputAction.InputTag).GetHandle());
+			}
+			if (HeldTagsFunc)
+			{
+				// Held events land on the component; the owner hears about them once per frame.
+				AbilityBindingHandles.Add(BindAction(InputAction.InputAction, ETriggerEvent::Triggered, this,
+					&UGASCoreEnhancedInputComponent::CollectHeldInputTag, InputAction.InputTag).GetHandle());
 			}
 		}
 	}
-}
\ No newline at end of file
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayModMagnitudeCalculation.h"
 #include "UObject/Interface.h"
 #include "GASCoreCombatInterface.generated.h"
 
@@ -19,6 +20,8 @@ class UGASCoreCombatInterface : public UInterface
  * Lightweight gameplay interface exposing combat-related queries to decouple systems.
  * Current responsibility:
  * - Provide an Actor's level as a non-Attribute integer for calculations (e.g., MMCs).
+ * - Announce level changes, so active effects whose MMCs read GetActorLevel re-evaluate only then
+ *   (UGASCoreMMCBase returns GetActorLevelChangedDelegate as its external modifier dependency).
  *
  * Design notes:
  * - Using a plain virtual here (not UFUNCTION). That keeps it lightweight and allows
@@ -36,5 +39,8 @@ public:
 	// Contract: Must be fast and safe to call during effect evaluation (no blocking).
 	virtual int32 GetActorLevel();
 
+	// Broadcast after GetActorLevel changed (null = the level never changes at runtime).
+	virtual FOnExternalGameplayModifierDependencyChange* GetActorLevelChangedDelegate() { return nullptr; }
+
 	virtual FVector GetAbilitySpawnLocation();
 };
@@ -0,0 +1,34 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "UObject/Interface.h"
+#include "GASCoreCursorHitInterface.generated.h"
+
+struct FHitResult;
+
+// This class does not need to be modified.
+UINTERFACE()
+class UGASCoreCursorHitInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * IGASCoreCursorHitInterface
+ *
+ * Implemented by player controllers that own a shared per-frame cursor hit service, so GASCore tasks
+ * (UGASCoreTargetDataFromAimTrace) reuse that frame's trace instead of tracing again.
+ * Controllers without it fall back to APlayerController::GetHitResultUnderCursor.
+ */
+class GASCORE_API IGASCoreCursorHitInterface
+{
+	GENERATED_BODY()
+
+public:
+
+	/** This frame's cursor hit on Channel; returns true for a blocking hit. Local controllers only. */
+	virtual bool GetAbilityCursorHit(ECollisionChannel Channel, FHitResult& OutHit) = 0;
+};
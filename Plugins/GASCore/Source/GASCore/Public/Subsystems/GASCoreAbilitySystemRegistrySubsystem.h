@@ -0,0 +1,58 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreAbilitySystemRegistrySubsystem.generated.h"
+
+class UAbilitySystemComponent;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FGASCoreOnAbilitySystemRegistryChanged, UAbilitySystemComponent* /*AbilitySystem*/);
+
+/**
+ * UGASCoreAbilitySystemRegistrySubsystem
+ *
+ * Purpose:
+ * - The world's initialized ability system components, for tools (GASAttachEditor) that list or pick ASCs
+ *   without walking the global UObject array (TObjectIterator) and filtering by world.
+ *
+ * How it works:
+ * - GASCore ASCs register from InitAbilityActorInfo (repeat calls on possession / avatar changes are no-ops) and
+ *   unregister from OnUnregister. Other UAbilitySystemComponent classes can call Register/Unregister themselves.
+ * - OnAbilitySystemRegistered / OnAbilitySystemUnregistered fire on every add and remove so listeners keep their
+ *   own lists current instead of re-querying. Deinitialize unregisters what is left (listeners see every removal).
+ */
+UCLASS()
+class GASCORE_API UGASCoreAbilitySystemRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreAbilitySystemRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	/** Add AbilitySystem and broadcast OnAbilitySystemRegistered (no-op when already registered). */
+	void Register(UAbilitySystemComponent* AbilitySystem);
+
+	/** Remove AbilitySystem and broadcast OnAbilitySystemUnregistered (no-op when not registered). */
+	void Unregister(UAbilitySystemComponent* AbilitySystem);
+
+	/** Registered components, in no particular order (swap-removed). */
+	TConstArrayView<TWeakObjectPtr<UAbilitySystemComponent>> GetAbilitySystems() const { return AbilitySystems; }
+
+	/** Fired after a component joined the registry. */
+	FGASCoreOnAbilitySystemRegistryChanged OnAbilitySystemRegistered;
+
+	/** Fired after a component left the registry (the component may already be tearing down). */
+	FGASCoreOnAbilitySystemRegistryChanged OnAbilitySystemUnregistered;
+
+	// ===== UWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+
+private:
+	/** Registered components (swap-removed). */
+	TArray<TWeakObjectPtr<UAbilitySystemComponent>> AbilitySystems;
+};
@@ -0,0 +1,81 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreAbilityTickSubsystem.generated.h"
+
+class UGASCoreAbilitySystemComponent;
+
+/**
+ * UGASCoreAbilityTickSubsystem
+ *
+ * High-level behavior
+ * - Ticks every UGASCoreAbilitySystemComponent that has work this frame from a single tickable instead of one
+ *   component tick function each (no per-component tick-graph entry, prerequisite walk or dispatch).
+ * - The engine already decides when an ASC needs to tick: UGameplayTasksComponent::UpdateShouldTick runs when a
+ *   ticking ability task starts or ends, montage replication toggles or an attribute set asks for ticks, and
+ *   activates / deactivates the component. UGASCoreAbilitySystemComponent::SetComponentTickEnabled routes
+ *   activation here (Register / Unregister) instead of to its own tick function.
+ * - A component stays registered while active, because UpdateShouldTick only toggles activation: an auto-activated
+ *   component that gains a ticking task later is never told again. The pass checks GetShouldTick per component and
+ *   only ticks those with work.
+ * - Active effect durations and periods are timer-driven and never need the component tick, so an ASC with only
+ *   duration effects stays out of the list.
+ *
+ * Data layout
+ * - Registered components live in one dense array, sorted by address whenever membership changes so the pass over
+ *   them walks memory forward. An index map keeps Register / Unregister O(1).
+ * - Components unregistered during the pass are nulled and compacted after it; registrations made during the pass
+ *   are appended and tick in the same pass.
+ * - Components that were deactivated without the tick call (or unregistered from the world) are dropped by the pass.
+ *
+ * Timing
+ * - Runs with the world tickables (after the actor/component tick groups), instead of TG_PrePhysics. Ability tasks
+ *   that read physics results already tolerate a frame of latency; tasks that must run before movement should keep
+ *   GASCore.AbilityTick.Consolidate off.
+ */
+UCLASS()
+class GASCORE_API UGASCoreAbilityTickSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreAbilityTickSubsystem* Get(const UObject* WorldContextObject);
+
+	/** GASCore.AbilityTick.Consolidate: ASCs tick through the subsystem instead of their own tick function. */
+	static bool IsConsolidationEnabled();
+
+	/** Tick Component from the shared pass (idempotent). */
+	void Register(UGASCoreAbilitySystemComponent* Component);
+
+	/** Stop ticking Component (idempotent; safe during the pass). */
+	void Unregister(UGASCoreAbilitySystemComponent* Component);
+
+	/** Number of components in the pass (active ones; idle ones are skipped each frame). */
+	int32 GetNumRegistered() const { return ComponentIndices.Num(); }
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return ComponentIndices.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** Compact nulled slots, sort by address and rebuild ComponentIndices. */
+	void RebuildOrder();
+
+	/** Dense, address-ordered list (null = unregistered during the pass, compacted afterwards). */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UGASCoreAbilitySystemComponent>> Components;
+
+	/** Component → slot in Components. */
+	TMap<TObjectKey<UGASCoreAbilitySystemComponent>, int32> ComponentIndices;
+
+	/** Membership changed since the last rebuild. */
+	bool bOrderDirty = false;
+};
@@ -0,0 +1,51 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AbilitySystem/Attributes/GASCoreAttributeBatchInitializer.h"
+
+#include "GASCoreAttributeBatchSubsystem.generated.h"
+
+/**
+ * UGASCoreAttributeBatchSubsystem
+ *
+ * Purpose:
+ * - Collects attribute-set initializations requested during a frame (e.g., a wave of enemies spawning) and runs
+ *   them as one FGASCoreAttributeBatchInitializer pass instead of per-actor init GameplayEffects.
+ *
+ * How it works:
+ * - RequestInitialization queues the set; Tick (after actor ticks) executes the whole queue once.
+ * - Attributes stay at their defaults until then; bind UI to attribute change delegates, not to init order.
+ */
+UCLASS()
+class GASCORE_API UGASCoreAttributeBatchSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreAttributeBatchSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Server (and clients, for sets with deferred initial replication): queue Set for batched initialization from
+	 * Archetype at Level (end of frame).
+	 * Initializes immediately when the set's world has no subsystem.
+	 */
+	static void RequestInitialization(UGASCoreAttributeSet* Set, const UGASCoreAttributeArchetypeDataAsset* Archetype,
+		int32 Level, bool bEvaluateDerivedAttributes = true);
+
+	/** Initialize every queued set now. */
+	void FlushPendingInitializations();
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Pending.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	FGASCoreAttributeBatchInitializer Pending;
+};
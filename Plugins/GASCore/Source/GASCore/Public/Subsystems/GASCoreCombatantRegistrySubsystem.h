@@ -0,0 +1,88 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreCombatantRegistrySubsystem.generated.h"
+
+/**
+ * UGASCoreCombatantRegistrySubsystem
+ *
+ * Purpose:
+ * - One list of the world's damageable combatants (IGASCoreCombatInterface implementers) for systems that need
+ *   "who could be hit around here" (homing projectiles) without per-query actor iteration or overlap tests.
+ *
+ * How it works:
+ * - Combatants register themselves on BeginPlay and unregister on EndPlay.
+ * - The first query of a frame rebuilds a uniform 2D spatial hash (GASCore.CombatantHash.CellSize) of every
+ *   combatant's location; later queries that frame reuse it. A query whose radius does not exceed the cell size
+ *   visits at most 3x3 cells, so per-projectile lookups are constant time regardless of combatant count.
+ * - Runs on server and clients alike (client-simulated projectiles home locally).
+ */
+UCLASS()
+class GASCORE_API UGASCoreCombatantRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreCombatantRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	/** Add Combatant (no-op when already registered). */
+	void RegisterCombatant(AActor* Combatant);
+
+	/** Remove Combatant. */
+	void UnregisterCombatant(const AActor* Combatant);
+
+	/**
+	 * Nearest registered combatant within Radius (cm, 2D) of Origin, skipping IgnoreA/IgnoreB (caster, instigator).
+	 * Null when none is in range.
+	 */
+	AActor* FindNearestCombatant(const FVector& Origin, float Radius, const AActor* IgnoreA = nullptr, const AActor* IgnoreB = nullptr);
+
+	/** Nearest registered combatant within Radius (cm, 2D) of Origin accepted by Filter (e.g. hostile only). */
+	AActor* FindNearestCombatant(const FVector& Origin, float Radius, TFunctionRef<bool(const AActor& Combatant)> Filter);
+
+	/**
+	 * Whether Combatant is a valid hostile target for Source (a caster or projectile instigator).
+	 * - Never Source itself. With team ids on both (IGenericTeamAgentInterface), the team attitude decides.
+	 * - Otherwise players and AI oppose each other: hostile when exactly one of the two pawns is player controlled.
+	 */
+	static bool IsHostile(const AActor* Source, const AActor& Combatant);
+
+	/** Registered combatants (entries may be stale until the next hash rebuild). */
+	TConstArrayView<TWeakObjectPtr<AActor>> GetCombatants() const { return Combatants; }
+
+	// ===== UWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+
+private:
+	/** Rebuild the spatial hash if it was last built in an earlier frame. */
+	void EnsureHashBuilt();
+
+	/** Nearest hashed combatant in range accepted by Filter (hash must be built). */
+	AActor* FindNearestInHash(const FVector& Origin, float Radius, TFunctionRef<bool(const AActor& Combatant)> Filter) const;
+
+	/** Cell of a world location. */
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/** Registered combatants (swap-removed). */
+	TArray<TWeakObjectPtr<AActor>> Combatants;
+
+	// ===== Per-frame spatial hash (parallel arrays, rebuilt on the first query of a frame) =====
+
+	TArray<AActor*> HashedActors;
+	TArray<FVector2D> HashedLocations;
+
+	/** Cell -> indices into HashedActors / HashedLocations. */
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<4>>> Cells;
+
+	/** Cell size the hash was built with (the CVar may change between frames). */
+	double HashCellSize = 1.0;
+
+	/** GFrameCounter of the last rebuild. */
+	uint64 HashFrame = MAX_uint64;
+};
@@ -0,0 +1,68 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreEffectActorPoolSubsystem.generated.h"
+
+class AGASCoreGameplayEffectActor;
+struct FGASCoreEffectConfig;
+
+/** Deactivated actors of one class, ready for reuse. */
+USTRUCT()
+struct FGASCoreEffectActorPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AGASCoreGameplayEffectActor>> Actors;
+};
+
+/**
+ * UGASCoreEffectActorPoolSubsystem
+ *
+ * Purpose:
+ * - Per-class pools of consumable AGASCoreGameplayEffectActor pickups (potions, crystals, loot explosions), so a
+ *   consumed pickup is deactivated and reused instead of destroyed and respawned (no spawn, channel open/close or
+ *   GC churn per pickup).
+ *
+ * How it works:
+ * - SpawnEffectActor reuses a pooled actor of the class (or spawns one) and reinitializes its effect rows and level.
+ * - Actors handed out here consume into ReleaseEffectActor instead of Destroy(): hidden, collision off, tracking
+ *   dropped and net dormant until reused. Up to GASCore.EffectActorPool.MaxPerClass actors per class are kept;
+ *   extra ones are destroyed.
+ * - Server only; clients see the replicated hidden state.
+ */
+UCLASS()
+class GASCORE_API UGASCoreEffectActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreEffectActorPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Server: activate a pooled ActorClass actor at Transform (spawning one if the pool is empty).
+	 * InGameplayEffects replaces the effect rows (null = the class defaults); InActorLevel > 0 overrides every row's level.
+	 */
+	AGASCoreGameplayEffectActor* SpawnEffectActor(TSubclassOf<AGASCoreGameplayEffectActor> ActorClass, const FTransform& Transform,
+		const TArray<FGASCoreEffectConfig>* InGameplayEffects = nullptr, float InActorLevel = -1.f);
+
+	/** Server: deactivate Actor into its class pool (destroyed when the pool is full). */
+	void ReleaseEffectActor(AGASCoreGameplayEffectActor* Actor);
+
+	/** Number of pooled (inactive) actors of ActorClass. */
+	int32 GetNumPooled(TSubclassOf<AGASCoreGameplayEffectActor> ActorClass) const;
+
+	// ===== UWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+
+private:
+	/** Inactive actors per exact class. */
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FGASCoreEffectActorPool> Pools;
+};
@@ -0,0 +1,96 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "GASCoreEffectActorRegistrySubsystem.generated.h"
+
+class AGASCoreGameplayEffectActor;
+
+/**
+ * UGASCoreEffectActorRegistrySubsystem
+ *
+ * Purpose:
+ * - Spatial lookup of AGASCoreGameplayEffectActors by the asset tags of their effects (e.g., UI.Message.HealthPotion),
+ *   for AI "nearest health pickup" and minimap queries, instead of GetAllActorsOfClass scans.
+ *
+ * How it works:
+ * - Effect actors register themselves (BeginPlay, pool reactivation) and unregister (EndPlay, pool deactivation).
+ * - One uniform 2D grid (GASCore.EffectActorRegistry.CellSize) per tag; an actor is filed under every asset tag of
+ *   its rows and all their parents, so a query for UI.Message finds UI.Message.HealthPotion pickups too.
+ * - Radius queries visit only the covered cells; nearest-N expands rings of cells from the origin and stops once
+ *   the next ring cannot beat the N-th candidate.
+ * - Hidden actors (consumed on this machine) are skipped. Runs on server and clients alike.
+ */
+UCLASS()
+class GASCORE_API UGASCoreEffectActorRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreEffectActorRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	/** File Actor at its current location under its effect asset tags (re-registering updates it). */
+	void RegisterEffectActor(AGASCoreGameplayEffectActor* Actor);
+
+	/** Remove Actor from every grid. */
+	void UnregisterEffectActor(const AGASCoreGameplayEffectActor* Actor);
+
+	/** Actors carrying Tag within Radius (cm, 2D) of Origin, unsorted. */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|Effect Actor Registry")
+	void FindEffectActorsInRadius(FGameplayTag Tag, FVector Origin, float Radius, TArray<AGASCoreGameplayEffectActor*>& OutActors) const;
+
+	/** Up to Count actors carrying Tag nearest to Origin (2D), nearest first. MaxRadius <= 0 = unbounded. */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|Effect Actor Registry")
+	void FindNearestEffectActors(FGameplayTag Tag, FVector Origin, int32 Count, TArray<AGASCoreGameplayEffectActor*>& OutActors,
+		float MaxRadius = 0.f) const;
+
+	/** Number of registered actors. */
+	int32 GetNumEffectActors() const { return Records.Num(); }
+
+	// ===== UWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+
+private:
+	struct FGridEntry
+	{
+		TWeakObjectPtr<AGASCoreGameplayEffectActor> Actor;
+		FVector2D Location = FVector2D::ZeroVector;
+	};
+
+	/** One tag's grid; cell bounds let nearest-N stop at the occupied area. */
+	struct FTagGrid
+	{
+		TMap<FIntPoint, TArray<FGridEntry>> Cells;
+		FIntPoint MinCell = FIntPoint(MAX_int32, MAX_int32);
+		FIntPoint MaxCell = FIntPoint(MIN_int32, MIN_int32);
+	};
+
+	/** Where an actor was filed (for removal). */
+	struct FRecord
+	{
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		TArray<FGameplayTag> Tags;
+	};
+
+	TMap<FGameplayTag, FTagGrid> Grids;
+	TMap<FObjectKey, FRecord> Records;
+
+	/** Cell size the grids were built with (grids are rebuilt if the CVar changes). */
+	float CellSize = 0.f;
+
+	FIntPoint GetCell(const FVector2D& Location) const;
+
+	/** Append the live, visible entries of Cell within RadiusSquared of Origin (Radius <= 0: all). */
+	static void GatherCell(const FTagGrid& Grid, const FIntPoint& Cell, const FVector2D& Origin, float RadiusSquared,
+		TArray<TPair<float, AGASCoreGameplayEffectActor*>>& OutCandidates);
+
+	/** Re-file every record with the current cell size. */
+	void RebuildGrids();
+};
@@ -0,0 +1,63 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Actors/GASCoreGameplayCueBurstActor.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreGameplayCueBatchSubsystem.generated.h"
+
+/**
+ * UGASCoreGameplayCueBatchSubsystem
+ *
+ * Purpose:
+ * - Impact cues (projectile hits, shotgun pellets) without one multicast/RPC per impact.
+ *
+ * How it works:
+ * - Server code queues cues with QueueCue during the frame. At the end of the frame the queue is grouped by
+ *   relevancy cell (GASCore.CueBatch.CellSize, world grid) and each cell sends one unreliable multicast through its
+ *   AGASCoreGameplayCueBurstActor proxy, carrying every cue of the cell as quantized location/normal + tag.
+ * - Clients (and a listen server) execute the burst locally as non-replicated Executed cue events, then hand it to
+ *   AGASCoreGameplayCueBurstActor::OnCueBurstExecuted listeners (e.g., the GASCoreUI combat text renderer).
+ * - Cell proxies are spawned the first time a cell is used and kept for the world's lifetime. The very first burst
+ *   of a fresh cell can arrive before its channel opens and be dropped (cosmetic only).
+ * - Bursts above GASCore.CueBatch.MaxPerBurst cues are split into several multicasts.
+ * - Cue tags with a High/Cosmetic routing rule skip the cells and go through UGASCoreGameplayCueRoutingSubsystem
+ *   instead (per connection, culled by view) whenever it can route.
+ */
+UCLASS()
+class GASCORE_API UGASCoreGameplayCueBatchSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreGameplayCueBatchSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Server: execute CueTag at Location on every relevant machine with this frame's burst of its cell.
+	 * Magnitude arrives as the cue's RawMagnitude (damage numbers, heal amounts).
+	 */
+	void QueueCue(const FGameplayTag& CueTag, const FVector& Location, const FVector& Normal = FVector::UpVector, float Magnitude = 0.f);
+
+	/** Server: send every queued cue now (normally done at the end of the frame). */
+	void FlushQueuedCues();
+
+	// ===== UWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+
+private:
+	/** Proxy of Cell, spawned on first use. */
+	AGASCoreGameplayCueBurstActor* FindOrSpawnCellProxy(const FIntVector& Cell);
+
+	/** Cues queued this frame. */
+	TArray<FGASCoreBatchedCue> QueuedCues;
+
+	/** Relevancy cell -> proxy actor. */
+	UPROPERTY()
+	TMap<FIntVector, TObjectPtr<AGASCoreGameplayCueBurstActor>> CellProxies;
+
+	bool bFlushScheduled = false;
+};
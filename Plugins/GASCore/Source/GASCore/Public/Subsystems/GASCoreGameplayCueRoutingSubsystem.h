@@ -0,0 +1,134 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Actors/GASCoreGameplayCueBurstActor.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreGameplayCueRoutingSubsystem.generated.h"
+
+class APlayerController;
+class UGASCoreAbilitySystemComponent;
+class UNetConnection;
+
+/** How a cue tag is culled per receiving connection. */
+UENUM()
+enum class EGASCoreCueRoutingPriority : uint8
+{
+	/** Never culled: keeps the normal path (ASC multicast / cell burst). Death, boss phases, gameplay-relevant cues. */
+	Always,
+
+	/** Culled by distance from the viewer only (GASCore.CueRouting.HighDistance). */
+	High,
+
+	/** Culled by distance (GASCore.CueRouting.CosmeticDistance) and the viewer's view cone. Hits, pickups, regen ticks. */
+	Cosmetic
+};
+
+/** Priority of a cue tag and its children (the most specific matching rule wins). */
+USTRUCT()
+struct GASCORE_API FGASCoreCueRoutingRule
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGameplayTag CueTag;
+
+	UPROPERTY()
+	EGASCoreCueRoutingPriority Priority = EGASCoreCueRoutingPriority::Cosmetic;
+};
+
+/**
+ * UGASCoreGameplayCueRoutingSubsystem
+ *
+ * Purpose:
+ * - Cosmetic Executed cues (hits, pickups, regen ticks) without sending them to clients that cannot see them.
+ *
+ * How it works:
+ * - Rules ([/Script/GASCore.GASCoreGameplayCueRoutingSubsystem] +Rules=(CueTag=...,Priority=...)) give cue tags a
+ *   priority. Unlisted tags are Always, so routing is opt-in per tag.
+ * - Server code (UGASCoreAbilitySystemComponent's Executed cue replication, UGASCoreGameplayCueBatchSubsystem's flush)
+ *   queues routable cues here instead of multicasting them. At the end of the frame each receiving player gets the
+ *   cues it can see, culled against its view (distance from the view target, view cone of the camera; anything
+ *   within GASCore.CueRouting.NearDistance always passes), as one unreliable client RPC on its own GASCore ASC.
+ *   Local players of a listen server execute theirs directly.
+ * - Cues predicted by a client skip that client (it already played them), like the engine multicast.
+ * - Routing needs a receiver per remote player: if any remote player controller has no GASCore ASC (on its player
+ *   state or pawn), CanRoute is false and callers keep the normal path for the frame.
+ * - Routed cues carry tag, target, location, normal and magnitude only (no effect context). Cues whose notifies need
+ *   the instigator or the full context should stay Always.
+ */
+UCLASS(Config=Game)
+class GASCORE_API UGASCoreGameplayCueRoutingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreGameplayCueRoutingSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Priority of CueTag from the rules (cached per tag). */
+	EGASCoreCueRoutingPriority GetPriority(const FGameplayTag& CueTag) const;
+
+	/** Server with routing enabled and a receiver for every remote player (cached per frame). */
+	bool CanRoute() const;
+
+	/** CanRoute and CueTag is not Always. */
+	bool ShouldRoute(const FGameplayTag& CueTag) const { return GetPriority(CueTag) != EGASCoreCueRoutingPriority::Always && CanRoute(); }
+
+	/** Server: route Cue to the players that can see it at the end of the frame; SkipConnection already played it. */
+	void QueueCue(const FGASCoreBatchedCue& Cue, const UNetConnection* SkipConnection = nullptr);
+
+	/** Server: cull and send every queued cue now (normally done at the end of the frame). */
+	void FlushRoutedCues();
+
+	// ===== UWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+
+private:
+	struct FRoutedCue
+	{
+		/** Target is carried in TargetActor until the flush (the queue is not GC-visible). */
+		FGASCoreBatchedCue Cue;
+		TWeakObjectPtr<AActor> TargetActor;
+		EGASCoreCueRoutingPriority Priority = EGASCoreCueRoutingPriority::Cosmetic;
+		TWeakObjectPtr<const UNetConnection> SkipConnection;
+	};
+
+	struct FViewer
+	{
+		APlayerController* PlayerController = nullptr;
+
+		/** Remote players: ASC the burst is sent through (null = local player, executed here). */
+		UGASCoreAbilitySystemComponent* Receiver = nullptr;
+
+		const UNetConnection* Connection = nullptr;
+
+		/** View target location (distance) and camera view point (cone). */
+		FVector Focus = FVector::ZeroVector;
+		FVector ViewLocation = FVector::ZeroVector;
+		FVector ViewDirection = FVector::ForwardVector;
+	};
+
+	/** GASCore ASC a remote player receives routed cues through (player state first, then pawn). */
+	static UGASCoreAbilitySystemComponent* FindReceiver(const APlayerController& PlayerController);
+
+	/** Every player controller with its view; false if a remote one has no receiver. */
+	bool GatherViewers(TArray<FViewer, TInlineAllocator<16>>& OutViewers) const;
+
+	/** Cue tag rules (config). */
+	UPROPERTY(Config)
+	TArray<FGASCoreCueRoutingRule> Rules;
+
+	mutable TMap<FGameplayTag, EGASCoreCueRoutingPriority> PriorityCache;
+
+	mutable uint64 CanRouteFrame = MAX_uint64;
+	mutable bool bCanRoute = false;
+
+	TArray<FRoutedCue> QueuedCues;
+
+	bool bFlushScheduled = false;
+};
@@ -0,0 +1,145 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "GASCoreLagCompensationSubsystem.generated.h"
+
+/** Client -> server: a client-fired (predicted) projectile hit Target. */
+USTRUCT()
+struct GASCORE_API FGASCoreProjectileHitReport
+{
+	GENERATED_BODY()
+
+	/** Actor hit; a non-ability actor (or none) only counts as the centre of an ImpactRadius splash. */
+	UPROPERTY()
+	TObjectPtr<AActor> Target = nullptr;
+
+	UPROPERTY()
+	FVector_NetQuantize ImpactPoint = FVector::ZeroVector;
+
+	/** Launch of the client's projectile, checked against the shot the server spawned. */
+	UPROPERTY()
+	FVector_NetQuantize Origin = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector_NetQuantizeNormal Direction = FVector::ForwardVector;
+
+	/** Server world time of what the client saw when the hit happened (its server clock minus half its ping). */
+	UPROPERTY()
+	double ServerTime = 0.0;
+};
+
+/** Server record of one projectile fired by a predicting client: what its reported hits are checked against. */
+struct FGASCoreProjectileShot
+{
+	FVector Origin = FVector::ZeroVector;
+	FVector Direction = FVector::ForwardVector;
+
+	/** Fastest speed the flight can reach (0 = unbounded, no travel time check). */
+	float Speed = 0.f;
+
+	/** Projectile collision radius (distance an impact may lie off the flight line). */
+	float CollisionRadius = 0.f;
+
+	/** No gravity or homing: impacts lie on the line from Origin along Direction. */
+	bool bStraightFlight = true;
+
+	/** Server time the shot was spawned here. */
+	double ServerTime = 0.0;
+
+	/** Piercing shots: ability targets already accepted for this shot. */
+	TArray<TWeakObjectPtr<AActor>, TInlineAllocator<2>> HitActors;
+};
+
+/**
+ * UGASCoreLagCompensationSubsystem
+ *
+ * Purpose:
+ * - Server-side rewind so hits reported by clients that fire projectiles immediately (see
+ *   UGASCoreProjectileAbility::bClientPredictedProjectiles) are checked against where the target was when the client
+ *   saw it, without trusting the client and without re-simulating the projectile's path.
+ *
+ * How it works:
+ * - Every server frame the location of each registered combatant (UGASCoreCombatantRegistrySubsystem) is recorded
+ *   into a ring of GASCore.LagCompensation.HistoryFrames frames. Storage is structure-of-arrays: one frame time
+ *   ring, plus per combatant row its collision cylinder and a contiguous block of HistoryFrames locations.
+ * - ValidateShotPath checks the report against the shot the server spawned: launch origin within
+ *   GASCore.LagCompensation.OriginTolerance, direction within GASCore.LagCompensation.MaxAngle, the impact on the
+ *   flight line (straight flights) and reachable at the shot's speed between firing (at most MaxRewindMs before the
+ *   server saw the shot) and the reported time.
+ * - ValidateHit additionally interpolates the target's location at the reported time (no more than
+ *   GASCore.LagCompensation.MaxRewindMs in the past) and accepts the impact when it lies within the target's capsule
+ *   inflated by GASCore.LagCompensation.Tolerance.
+ * - Records on dedicated and listen servers only (standalone validates against current locations).
+ */
+UCLASS()
+class GASCORE_API UGASCoreLagCompensationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreLagCompensationSubsystem* Get(const UObject* WorldContextObject);
+
+	/** True if Report passes ValidateShotPath for Shot and its impact lies on the target's capsule as it was at Report.ServerTime. */
+	bool ValidateHit(const FGASCoreProjectileHitReport& Report, const FGASCoreProjectileShot& Shot) const;
+
+	/** True if Report's launch matches Shot and Shot could have reached the impact by Report.ServerTime (see class comment). */
+	bool ValidateShotPath(const FGASCoreProjectileHitReport& Report, const FGASCoreProjectileShot& Shot) const;
+
+	/** Server world time, the clock of reports and shots. */
+	double GetServerTime() const;
+
+	/**
+	 * Target's recorded location at ServerTime (interpolated between the bracketing frames) and its collision cylinder.
+	 * False when the target has no history covering ServerTime.
+	 */
+	bool GetRewoundLocation(const AActor* Target, double ServerTime, FVector& OutLocation, float& OutRadius, float& OutHalfHeight) const;
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** Record one frame for every combatant (adding rows for new ones, dropping rows of gone ones). */
+	void RecordFrame(double Now);
+
+	/** Swap-remove row Row (its whole location block), keeping RowByActor in sync. */
+	void RemoveRow(int32 Row);
+
+	/** Ring slot of the Age-th most recent frame (0 = newest). */
+	int32 SlotForAge(int32 Age) const { return (NewestSlot - Age + HistoryFrames) % HistoryFrames; }
+
+	/** Frames kept per combatant. */
+	int32 HistoryFrames = 0;
+
+	/** Ring of frame times (HistoryFrames entries). */
+	TArray<double> FrameTimes;
+
+	/** Slot of the newest recorded frame, and the number of frames recorded so far (up to HistoryFrames). */
+	int32 NewestSlot = INDEX_NONE;
+	int32 NumFrames = 0;
+
+	// ===== Per-combatant rows (same index) =====
+
+	TArray<TWeakObjectPtr<AActor>> RowActors;
+	TArray<TObjectKey<AActor>> RowKeys;
+	TArray<float> RowRadii;
+	TArray<float> RowHalfHeights;
+
+	/** First frame time recorded for the row (older rewinds have no data). */
+	TArray<double> RowSince;
+
+	/** RowActors.Num() * HistoryFrames locations; row r owns [r * HistoryFrames, (r + 1) * HistoryFrames). */
+	TArray<FVector> RowLocations;
+
+	TMap<TObjectKey<AActor>, int32> RowByActor;
+};
@@ -0,0 +1,75 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Actors/GASCoreGameplayEffectActor.h"
+
+#include "GASCorePickupSpawnerSubsystem.generated.h"
+
+/**
+ * UGASCorePickupSpawnerSubsystem
+ *
+ * Purpose:
+ * - Server-side respawn scheduling for AGASCoreGameplayEffectActor pickups: one time-ordered min-heap for the
+ *   world instead of a Blueprint timer per pickup.
+ *
+ * How it works:
+ * - ScheduleRespawn pushes (time, class, transform, rows, level); the subsystem only ticks while the heap is not
+ *   empty and each tick pops every due entry (at most GASCore.PickupSpawner.MaxSpawnsPerFrame, the rest next frame).
+ * - Due entries are activated through UGASCoreEffectActorPoolSubsystem::SpawnEffectActor (pooled instances reused).
+ * - Cancelled ids are skipped lazily when they reach the top of the heap.
+ * - Pickups with RespawnDelay > 0 schedule themselves when consumed.
+ */
+UCLASS()
+class GASCORE_API UGASCorePickupSpawnerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCorePickupSpawnerSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Server: activate an ActorClass pickup at Transform after Delay seconds. InGameplayEffects replaces its rows
+	 * (null = class defaults); InActorLevel > 0 overrides every row's level. Returns an id for CancelRespawn (INDEX_NONE on clients).
+	 */
+	int32 ScheduleRespawn(TSubclassOf<AGASCoreGameplayEffectActor> ActorClass, const FTransform& Transform, float Delay,
+		const TArray<FGASCoreEffectConfig>* InGameplayEffects = nullptr, float InActorLevel = -1.f);
+
+	/** Drop a scheduled respawn (no-op if it already happened). */
+	void CancelRespawn(int32 RespawnId);
+
+	/** Number of pending respawns (cancelled ones included until they are popped). */
+	int32 GetNumPendingRespawns() const { return Respawns.Num(); }
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Respawns.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	struct FRespawn
+	{
+		double Time = 0.0;
+		int32 Id = INDEX_NONE;
+		TSubclassOf<AGASCoreGameplayEffectActor> ActorClass;
+		FTransform Transform;
+		TOptional<TArray<FGASCoreEffectConfig>> GameplayEffects;
+		float ActorLevel = -1.f;
+	};
+
+	/** Min-heap on Time (Respawns.HeapTop() is the next due). */
+	TArray<FRespawn> Respawns;
+
+	/** Ids cancelled while still in the heap. */
+	TSet<int32> CancelledIds;
+
+	int32 NextRespawnId = 0;
+
+	/** Heap order: earliest first. */
+	static bool IsEarlier(const FRespawn& A, const FRespawn& B) { return A.Time < B.Time; }
+};
@@ -0,0 +1,80 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreProjectilePoolSubsystem.generated.h"
+
+class AGASCoreSpawnedActorByGameplayAbility;
+
+/** Deactivated projectiles of one class, ready for reuse. */
+USTRUCT()
+struct FGASCoreProjectilePool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AGASCoreSpawnedActorByGameplayAbility>> Actors;
+};
+
+/**
+ * UGASCoreProjectilePoolSubsystem
+ *
+ * Purpose:
+ * - Per-class pools of AGASCoreSpawnedActorByGameplayAbility projectiles, so a cast reuses a deactivated projectile
+ *   instead of spawning a replicated actor (and opening a channel) that is destroyed a moment later.
+ *
+ * How it works:
+ * - AcquireProjectile pops a pooled actor of the class (or spawns one) and resets it through ActivateFromPool:
+ *   transform, owner/instigator, collision, movement velocity and lifespan.
+ * - Pool-owned projectiles return through ReleaseProjectile when their lifespan expires or when gameplay calls
+ *   ReleaseOrDestroy on impact: movement stopped, hidden, collision off, owner cleared, net dormant.
+ *   Up to GASCore.ProjectilePool.MaxPerClass actors per class are kept; extra ones are destroyed.
+ * - AcquireProjectiles does the same for a whole volley (spread/multi-shot abilities) with one pool lookup.
+ * - PrewarmProjectiles fills a class pool ahead of time (UGASCoreProjectileAbility::PoolPrewarmCount on grant).
+ * - Server only; clients see the replicated hidden/movement state.
+ */
+UCLASS()
+class GASCORE_API UGASCoreProjectilePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreProjectilePoolSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Server: activate a pooled ProjectileClass actor at Transform (spawning one if the pool is empty). */
+	AGASCoreSpawnedActorByGameplayAbility* AcquireProjectile(TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> ProjectileClass,
+		const FTransform& Transform, AActor* Owner, APawn* Instigator);
+
+	/**
+	 * Server: AcquireProjectile for every transform of a volley (one pool lookup, spawning only the shortfall).
+	 * Appends to OutProjectiles in transform order; returns the number acquired.
+	 */
+	int32 AcquireProjectiles(TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> ProjectileClass, TArrayView<const FTransform> Transforms,
+		AActor* Owner, APawn* Instigator, TArray<AGASCoreSpawnedActorByGameplayAbility*>& OutProjectiles);
+
+	/** Server: deactivate Projectile into its class pool (destroyed when the pool is full). */
+	void ReleaseProjectile(AGASCoreSpawnedActorByGameplayAbility* Projectile);
+
+	/** Server: spawn deactivated ProjectileClass actors until Count are pooled (capped by MaxPerClass). */
+	void PrewarmProjectiles(TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> ProjectileClass, int32 Count);
+
+	/** Number of pooled (inactive) projectiles of ProjectileClass. */
+	int32 GetNumPooled(TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> ProjectileClass) const;
+
+	// ===== UWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+
+private:
+	/** Spawn an inactive-ready projectile (AlwaysSpawn; BeginPlay has run when this returns). */
+	AGASCoreSpawnedActorByGameplayAbility* SpawnProjectile(TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> ProjectileClass,
+		const FTransform& Transform) const;
+
+	/** Inactive projectiles per exact class. */
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FGASCoreProjectilePool> Pools;
+};
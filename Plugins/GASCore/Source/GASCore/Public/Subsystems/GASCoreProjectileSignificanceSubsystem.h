@@ -0,0 +1,71 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreProjectileSignificanceSubsystem.generated.h"
+
+class AGASCoreSpawnedActorByGameplayAbility;
+
+/**
+ * UGASCoreProjectileSignificanceSubsystem
+ *
+ * Purpose:
+ * - Full movement/FX fidelity only for projectiles a player can actually see.
+ *
+ * How it works:
+ * - Live projectiles register themselves (BeginPlay / ActivateFromPool) and unregister on release or EndPlay.
+ * - Every GASCore.ProjectileSignificance.UpdateInterval seconds each projectile is tested against every player
+ *   controller's view point (local ones on clients, all of them on the server): significant when within
+ *   GASCore.ProjectileSignificance.NearDistance of a view, or inside a view frustum cone up to FarDistance.
+ * - Changes are pushed through AGASCoreSpawnedActorByGameplayAbility::SetSignificant (reduced movement tick, FX
+ *   paused and hidden, cosmetic hook). Movement keeps sweeping its full step, so hits are detected late, never skipped.
+ *
+ * Note: a self-contained evaluator rather than the engine SignificanceManager plugin, which would need a plugin
+ * dependency plus a game-side driver calling Update with the viewpoints every frame.
+ */
+UCLASS()
+class GASCORE_API UGASCoreProjectileSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreProjectileSignificanceSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Start evaluating Projectile (significant until the next update says otherwise). */
+	void RegisterProjectile(AGASCoreSpawnedActorByGameplayAbility* Projectile);
+
+	/** Stop evaluating Projectile. */
+	void UnregisterProjectile(AGASCoreSpawnedActorByGameplayAbility* Projectile);
+
+	/** Number of registered projectiles. */
+	int32 GetNumProjectiles() const { return Projectiles.Num(); }
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Projectiles.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** One player view (location, forward, cos of the half FOV plus margin). */
+	struct FViewPoint
+	{
+		FVector Location;
+		FVector Forward;
+		float CosHalfFOV;
+	};
+
+	/** Gather player view points (controllers with a camera manager or a pawn). */
+	void GatherViewPoints(TArray<FViewPoint, TInlineAllocator<4>>& OutViews) const;
+
+	/** Registered projectiles (swap-removed). */
+	TArray<TWeakObjectPtr<AGASCoreSpawnedActorByGameplayAbility>> Projectiles;
+
+	/** Time since the last evaluation. */
+	float TimeSinceUpdate = 0.f;
+};
@@ -0,0 +1,158 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreProjectileSimulationSubsystem.generated.h"
+
+class AGASCoreSpawnedActorByGameplayAbility;
+
+/**
+ * Opaque handle to a projectile simulated by UGASCoreProjectileSimulationSubsystem.
+ * Ids are never reused within a world, so a stale handle simply stops resolving.
+ */
+struct FGASCoreSimProjectileHandle
+{
+	int32 Id = INDEX_NONE;
+
+	bool IsValid() const { return Id != INDEX_NONE; }
+	void Reset() { Id = INDEX_NONE; }
+};
+
+/** Launch parameters of one simulated projectile. */
+struct FGASCoreSimProjectileParams
+{
+	FVector Origin = FVector::ZeroVector;
+
+	/** Constant velocity (cm/s); simulated projectiles fly straight. */
+	FVector Velocity = FVector::ZeroVector;
+
+	/** Sphere radius of the per-frame sweep. */
+	float Radius = 8.f;
+
+	/** Seconds before the projectile expires without a hit. */
+	float LifeSpan = 5.f;
+
+	/** Channel of the sweep (what the projectile can hit). */
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_WorldDynamic;
+
+	/** Ignored by the sweep (the caster). */
+	TWeakObjectPtr<AActor> Owner;
+
+	/** Applied to the ability system of the actor hit (authority only). */
+	FGameplayEffectSpecHandle EffectSpec;
+};
+
+/** A simulated projectile hit something (already removed from the simulation; effect already applied). */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FGASCoreSimProjectileImpactSignature, FGASCoreSimProjectileHandle /*Handle*/, const FHitResult& /*Hit*/);
+
+/** After each step: ids and positions of every live projectile, same order (feed an instanced mesh or a Niagara array). */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FGASCoreSimProjectilesMovedSignature, TArrayView<const int32> /*HandleIds*/, TArrayView<const FVector> /*Positions*/);
+
+/**
+ * UGASCoreProjectileSimulationSubsystem
+ *
+ * High-level behavior
+ * - Simulates swarms of simple projectiles (bullet-hell patterns) as data instead of actors: no actor, no
+ *   UProjectileMovementComponent tick and no overlap events per projectile.
+ * - Projectiles that need gameplay behavior (homing, custom impact logic) are promoted to full actors through
+ *   UGASCoreProjectilePoolSubsystem with PromoteToActor.
+ *
+ * Data layout
+ * - Structure-of-arrays: positions, velocities, radii, remaining life, channels, owners and effect specs live in
+ *   parallel dense arrays (swap-removed). Handles map to dense slots through IdToIndex.
+ *
+ * Tick pipeline
+ * 1) Integrate: advance positions and lifetimes; runs through ParallelFor once the projectile count reaches
+ *    GASCore.ProjectileSim.ParallelThreshold. Pure math, no UObject access.
+ * 2) Sweep (game thread): one sphere sweep per live projectile from its previous to its new position, in a single
+ *    pass over the dense arrays (simple collision, owner ignored).
+ * 3) Remove hit / expired projectiles, then apply effect specs and broadcast OnImpact (callbacks may launch more).
+ * 4) Broadcast OnProjectilesMoved for the visuals.
+ *
+ * Networking
+ * - The subsystem does not replicate. Effects are applied only outside NM_Client; clients may run the same
+ *   launches for visuals.
+ */
+UCLASS()
+class GASCORE_API UGASCoreProjectileSimulationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreProjectileSimulationSubsystem* Get(const UObject* WorldContextObject);
+
+	// ===== Projectile API =====
+
+	/** Start simulating a projectile. Returns an invalid handle on bad input (zero velocity or lifespan). */
+	FGASCoreSimProjectileHandle Launch(const FGASCoreSimProjectileParams& Params);
+
+	/** Remove a projectile without impact. Resets the handle. */
+	void Stop(FGASCoreSimProjectileHandle& Handle);
+
+	/**
+	 * Authority: replace the simulated projectile with a pooled ProjectileClass actor at its current position and
+	 * velocity (the effect spec stays with the caller). Resets the handle; returns null if it did not resolve.
+	 */
+	AGASCoreSpawnedActorByGameplayAbility* PromoteToActor(FGASCoreSimProjectileHandle& Handle,
+		TSubclassOf<AGASCoreSpawnedActorByGameplayAbility> ProjectileClass);
+
+	/** True while the handle refers to a live projectile. */
+	bool IsSimulating(const FGASCoreSimProjectileHandle& Handle) const { return Handle.IsValid() && IdToIndex.Contains(Handle.Id); }
+
+	/** Current position (false if the handle is stale). */
+	bool GetProjectileLocation(const FGASCoreSimProjectileHandle& Handle, FVector& OutLocation) const;
+
+	/** Number of live projectiles. */
+	int32 GetNumProjectiles() const { return Positions.Num(); }
+
+	FGASCoreSimProjectileImpactSignature OnImpact;
+	FGASCoreSimProjectilesMovedSignature OnProjectilesMoved;
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Positions.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** Result of one projectile step. */
+	enum class EStepResult : uint8
+	{
+		Continue,
+		Expired,
+		Hit
+	};
+
+	/** Dense slot of a handle, or INDEX_NONE. */
+	int32 FindIndex(const FGASCoreSimProjectileHandle& Handle) const;
+
+	/** Swap-remove the projectile at dense slot Index, keeping IdToIndex in sync. */
+	void RemoveAt(int32 Index);
+
+	// ===== Structure-of-arrays projectile storage (all arrays share the same dense index) =====
+
+	TArray<int32> HandleIds;
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<float> Radii;
+	TArray<float> RemainingLife;
+	TArray<TEnumAsByte<ECollisionChannel>> TraceChannels;
+	TArray<TWeakObjectPtr<AActor>> Owners;
+	TArray<FGameplayEffectSpecHandle> EffectSpecs;
+
+	// Per-step scratch (written in the integrate/sweep phases, read in the resolve phase).
+	TArray<FVector> PreviousPositions;
+	TArray<EStepResult> StepResults;
+
+	/** Handle id -> dense slot. */
+	TMap<int32, int32> IdToIndex;
+
+	/** Next handle id to hand out. */
+	int32 NextHandleId = 0;
+};
@@ -0,0 +1,68 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreRegenerationSubsystem.generated.h"
+
+class UGASCoreAttributeSet;
+
+/**
+ * UGASCoreRegenerationSubsystem
+ *
+ * Purpose:
+ * - Server-side native regeneration for every registered attribute set (Builder.RegisterRegeneration pairs),
+ *   in one batched pass at GASCore.Regen.Interval instead of a periodic GameplayEffect per vital per actor.
+ *
+ * How it works:
+ * - Each pass adds Rate * Elapsed to a per-set, per-vital accumulator. The vital is only written (so replicated)
+ *   once the accumulator reaches GASCore.Regen.CommitThreshold or the vital reaches 0/Max; the fractional remainder
+ *   carries over to the next pass.
+ * - Clients do not run this: they extrapolate from the replicated value and rate (UGASCoreAttributeSet::GetExtrapolatedValue),
+ *   and every commit or other write acts as a correction.
+ * - Sets are held weakly; destroyed actors drop out on the next pass.
+ */
+UCLASS()
+class GASCORE_API UGASCoreRegenerationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreRegenerationSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Server: start regenerating Set (no-op on clients, for sets without regenerations, or if already registered). */
+	static void RegisterAttributeSet(UGASCoreAttributeSet* Set);
+
+	/** Stop regenerating Set (pending fractions are dropped). */
+	static void UnregisterAttributeSet(const UGASCoreAttributeSet* Set);
+
+	/** Integrate Elapsed seconds for every registered set now. */
+	void IntegrateRegeneration(float Elapsed);
+
+	/** Number of registered sets. */
+	int32 GetNumAttributeSets() const { return Sets.Num(); }
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Sets.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** Registered sets; PendingOffsets[i] is the first accumulator of Sets[i] in Pending. */
+	TArray<TWeakObjectPtr<UGASCoreAttributeSet>> Sets;
+	TArray<int32> PendingOffsets;
+
+	/** Not yet committed regeneration per (set, metadata regeneration index), flat. */
+	TArray<float> Pending;
+
+	/** Time accumulated since the last pass. */
+	float TimeSinceIntegration = 0.f;
+
+	/** Remove Sets[Index] and its accumulators. */
+	void RemoveAt(int32 Index);
+};
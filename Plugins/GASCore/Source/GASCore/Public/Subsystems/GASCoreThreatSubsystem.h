@@ -0,0 +1,69 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreThreatSubsystem.generated.h"
+
+class UGASCoreCombatantRegistrySubsystem;
+class UGASCoreThreatComponent;
+
+/**
+ * UGASCoreThreatSubsystem
+ *
+ * Purpose:
+ * - Server-side scheduler for UGASCoreThreatComponent: target selection on events and at a throttled rate instead
+ *   of every enemy polling every player each tick.
+ *
+ * How it works:
+ * - Components register on BeginPlay (authority) and unregister on EndPlay.
+ * - Requested components (damage taken, AddThreat) are evaluated in the subsystem's next tick. Damage arrives in the
+ *   end-of-frame damage batch flush, after this frame's tick, so a hit retargets on the following frame.
+ * - Every other active component is evaluated once per GASCore.Threat.UpdateInterval, round-robin: each frame
+ *   handles Num * DeltaTime / Interval of them, so the cost is flat across frames.
+ * - Proximity aggro queries the shared combatant spatial hash (UGASCoreCombatantRegistrySubsystem), built at most
+ *   once per frame for every system that queries it.
+ */
+UCLASS()
+class GASCORE_API UGASCoreThreatSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreThreatSubsystem* Get(const UObject* WorldContextObject);
+
+	void RegisterComponent(UGASCoreThreatComponent* Component);
+	void UnregisterComponent(UGASCoreThreatComponent* Component);
+
+	/** Evaluate Component in the next tick (once, however often requested; the following frame from the damage flush). */
+	void RequestEvaluation(UGASCoreThreatComponent* Component);
+
+	/** Number of registered components. */
+	int32 GetNumComponents() const { return Components.Num(); }
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Components.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** Evaluate one component (skipped when inactive). */
+	void Evaluate(UGASCoreThreatComponent& Component, double Now, UGASCoreCombatantRegistrySubsystem* CombatantRegistry) const;
+
+	/** Registered components (swap-removed). */
+	TArray<TWeakObjectPtr<UGASCoreThreatComponent>> Components;
+
+	/** Event-requested components for this frame. */
+	TArray<TWeakObjectPtr<UGASCoreThreatComponent>> Requested;
+
+	/** Round-robin position in Components. */
+	int32 Cursor = 0;
+
+	/** Fractional components owed to the round-robin (carried between frames). */
+	float PendingBudget = 0.f;
+};
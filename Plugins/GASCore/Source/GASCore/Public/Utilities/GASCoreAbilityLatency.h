@@ -0,0 +1,40 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Ability activation latency instrumentation ("feels laggy" measurements, soak tests).
+// - Every phase is measured in milliseconds from the input press that led to the activation.
+// - Per ability class, each phase keeps a ring buffer of the latest samples (percentiles via GASCore.AbilityLatency.Dump).
+// - The latest sample of each phase also feeds "stat GASCore" and the GASCoreAbilityLatency CSV category.
+// - Game thread only. GASCore.AbilityLatency.Enable=0 turns recording off; compiled out in Shipping.
+
+#ifndef GASCORE_ABILITY_LATENCY
+#define GASCORE_ABILITY_LATENCY !UE_BUILD_SHIPPING
+#endif
+
+#if GASCORE_ABILITY_LATENCY
+
+namespace GASCoreAbilityLatency
+{
+	enum class EPhase : uint8
+	{
+		LocalActivate,   // press -> ActivateAbility on the pressing machine
+		ServerConfirm,   // press -> server caught up with the activation prediction key (predicting clients only)
+		FirstCue,        // press -> first gameplay cue the ability reported
+		End,             // press -> EndAbility
+		Num
+	};
+
+	/** Recording is on (GASCore.AbilityLatency.Enable). */
+	GASCORE_API bool IsEnabled();
+
+	/** Add one Milliseconds sample for AbilityClass. */
+	GASCORE_API void Record(const UClass* AbilityClass, EPhase Phase, double Milliseconds);
+
+	/** Count a predicted activation the server rejected. */
+	GASCORE_API void RecordRejected(const UClass* AbilityClass);
+}
+
+#endif
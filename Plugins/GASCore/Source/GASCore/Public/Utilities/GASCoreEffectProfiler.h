@@ -0,0 +1,152 @@
+// Copyright DermanDanisman, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// GameplayEffect cost accounting (server perf, regression gate for GAS work).
+// - GASCore.EffectProfiler.Enable 1 starts recording; GASCore.EffectProfiler.Dump [TopN] [sources] prints the
+//   top-N GE classes by total time (optionally split per source class); GASCore.EffectProfiler.Reset clears.
+// - Buckets: (GE class, source class). Source = effect causer, else instigator, else source object of the context.
+// - Phases (count + total microseconds, inclusive of nested work):
+//   SpecCreation  - MakeOutgoingSpec on GASCore ASCs and GASCore prototype clones.
+//   Execution     - ApplyGameplayEffectSpecToSelf of Instant effects (modifiers, executions, callbacks).
+//   Aggregation   - ApplyGameplayEffectSpecToSelf of Duration/Infinite effects (aggregator add + re-evaluation).
+//   PreAttributeChange / PostGameplayEffectExecute - UGASCoreAttributeSet callbacks; PreAttributeChange is
+//   charged to the effect being applied (or "(none)" for aggregator updates outside an application).
+// - Per ASC (the GAS debugger's cost view): cumulative time of the phases run on it (an application and the attribute
+//   callbacks nested in it count once, work on other ASCs nested inside stays included), attribute Current changes
+//   and ability activations. GetAbilitySystemCost returns the totals since the last Reset; rates are up to the reader.
+//   GASCore ASCs drop their entry in OnUnregister (RemoveAbilitySystem), so destroyed ASCs do not accumulate.
+// - Game thread only; compiled out when GASCORE_EFFECT_PROFILER is 0 (default: non-shipping builds).
+
+#ifndef GASCORE_EFFECT_PROFILER
+#define GASCORE_EFFECT_PROFILER !UE_BUILD_SHIPPING
+#endif
+
+class UAbilitySystemComponent;
+struct FGameplayEffectContextHandle;
+
+enum class EGASCoreEffectCostPhase : uint8
+{
+	SpecCreation,
+	Execution,
+	Aggregation,
+	PreAttributeChange,
+	PostGameplayEffectExecute,
+
+	Num
+};
+
+#if GASCORE_EFFECT_PROFILER
+
+/** Cumulative cost of one ASC since the last GASCoreEffectProfiler::Reset. */
+struct FGASCoreAbilitySystemCost
+{
+	/** Profiled phases run on the ASC (outermost per ASC, inclusive of nested work). */
+	double Microseconds = 0.0;
+
+	/** Current value changes of its GASCore attribute sets (PostAttributeChange with a new value). */
+	uint64 AttributeChanges = 0;
+
+	/** Abilities activated on it (NotifyAbilityActivated). */
+	uint64 AbilityActivations = 0;
+};
+
+namespace GASCoreEffectProfiler
+{
+	/** Mirrors GASCore.EffectProfiler.Enable. */
+	extern GASCORE_API bool bEnabled;
+
+	FORCEINLINE bool IsEnabled() { return bEnabled; }
+
+	/** Source object used for bucketing (causer → instigator → source object). */
+	GASCORE_API const UObject* GetContextSource(const FGameplayEffectContextHandle& Context);
+
+	/** Add one sample. EffectClass/Source may be null (bucketed as "(none)"). */
+	GASCORE_API void Record(EGASCoreEffectCostPhase Phase, const UClass* EffectClass, const UObject* Source, double Microseconds);
+
+	/** Effect being applied on the game thread (innermost), charged for nested PreAttributeChange samples. */
+	GASCORE_API void PushActiveEffect(const UClass* EffectClass, const UObject* Source);
+	GASCORE_API void PopActiveEffect();
+	GASCORE_API void GetActiveEffect(const UClass*& OutEffectClass, const UObject*& OutSource);
+
+	/** Target ASC of an opening scope; false if an enclosing scope already charges it (no double counting). */
+	GASCORE_API bool PushTarget(const UAbilitySystemComponent* Target);
+	GASCORE_API void PopTarget(const UAbilitySystemComponent* Target, bool bCharge, double Microseconds);
+
+	GASCORE_API void RecordAttributeChange(const UAbilitySystemComponent* Target);
+	GASCORE_API void RecordAbilityActivation(const UAbilitySystemComponent* Target);
+
+	/** Totals of AbilitySystem (zero if nothing was recorded for it). */
+	GASCORE_API FGASCoreAbilitySystemCost GetAbilitySystemCost(const UAbilitySystemComponent* AbilitySystem);
+
+	/** Forget the totals of AbilitySystem (it is going away). */
+	GASCORE_API void RemoveAbilitySystem(const UAbilitySystemComponent* AbilitySystem);
+
+	GASCORE_API void Reset();
+	GASCORE_API void Dump(FOutputDevice& Ar, int32 TopN, bool bPerSource);
+}
+
+/**
+ * Times its lifetime into (Phase, EffectClass, Source) and the Target ASC when profiling is enabled; optionally marks
+ * the active effect.
+ */
+class FGASCoreEffectCostScope
+{
+public:
+	FGASCoreEffectCostScope(const EGASCoreEffectCostPhase InPhase, const UClass* InEffectClass, const UObject* InSource,
+		const UAbilitySystemComponent* InTarget, const bool bInActiveEffect = false)
+		: Phase(InPhase), EffectClass(InEffectClass), Source(InSource), Target(InTarget), bActiveEffect(bInActiveEffect)
+		, StartCycles(GASCoreEffectProfiler::IsEnabled() ? FPlatformTime::Cycles64() : 0)
+	{
+		if (StartCycles)
+		{
+			bChargeTarget = GASCoreEffectProfiler::PushTarget(Target);
+			if (bActiveEffect)
+			{
+				GASCoreEffectProfiler::PushActiveEffect(EffectClass, Source);
+			}
+		}
+	}
+
+	~FGASCoreEffectCostScope()
+	{
+		if (StartCycles)
+		{
+			if (bActiveEffect)
+			{
+				GASCoreEffectProfiler::PopActiveEffect();
+			}
+			const double Microseconds = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0;
+			GASCoreEffectProfiler::PopTarget(Target, bChargeTarget, Microseconds);
+			GASCoreEffectProfiler::Record(Phase, EffectClass, Source, Microseconds);
+		}
+	}
+
+	UE_NONCOPYABLE(FGASCoreEffectCostScope);
+
+private:
+	EGASCoreEffectCostPhase Phase;
+	const UClass* EffectClass;
+	const UObject* Source;
+	const UAbilitySystemComponent* Target;
+	bool bActiveEffect;
+	bool bChargeTarget = false;
+	uint64 StartCycles;
+};
+
+/** Target: the ASC the work runs on (may be null). */
+#define GASCORE_EFFECT_COST_SCOPE(Phase, EffectClass, Source, Target) \
+	const FGASCoreEffectCostScope PREPROCESSOR_JOIN(GASCoreEffectCostScope_, __LINE__)(Phase, EffectClass, Source, Target)
+
+/** Cost scope that is also the active effect for nested attribute callbacks (applications). */
+#define GASCORE_EFFECT_APPLICATION_SCOPE(Phase, EffectClass, Source, Target) \
+	const FGASCoreEffectCostScope PREPROCESSOR_JOIN(GASCoreEffectCostScope_, __LINE__)(Phase, EffectClass, Source, Target, true)
+
+#else
+
+#define GASCORE_EFFECT_COST_SCOPE(Phase, EffectClass, Source, Target)
+#define GASCORE_EFFECT_APPLICATION_SCOPE(Phase, EffectClass, Source, Target)
+
+#endif
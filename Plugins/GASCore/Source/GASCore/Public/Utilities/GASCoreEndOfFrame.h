@@ -0,0 +1,19 @@
+// Copyright DermanDanisman, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// End-of-frame deferral for GASCore objects (attribute delta batches, derived attribute recompute).
+// - One global FCoreDelegates::OnEndFrame binding; objects register per frame, not per object lifetime.
+// - Game thread only. Entries are weak: destroyed objects are skipped.
+// - Callbacks may schedule again; those run at the end of the next frame.
+
+namespace GASCoreEndOfFrame
+{
+	/** Flush callback invoked with the scheduled object. */
+	using FFlushFunction = void(*)(UObject* Object);
+
+	/** Call Flush(Object) once at the end of the current frame (schedule once per frame per object). */
+	GASCORE_API void Schedule(UObject* Object, FFlushFunction Flush);
+}
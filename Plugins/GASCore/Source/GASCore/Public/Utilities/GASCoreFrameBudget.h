@@ -0,0 +1,88 @@
+// Copyright DermanDanisman, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Per-frame cost of the GASCore hot paths, for frame budget dashboards (the game's TD.Budget overlay).
+// - GASCore.FrameBudget.Enable 1 starts timing (dashboards switch it on while shown).
+// - Areas (inclusive wall time, game thread only; a nested scope of the same area counts once):
+//   EffectApplication  - ApplyGameplayEffectSpecToSelf on GASCore ASCs.
+//   AttributeCallbacks - UGASCoreAttributeSet Pre/Post(Base)AttributeChange and PostGameplayEffectExecute, plus the
+//                        end-of-frame attribute delta / damage batch broadcast. Nested in EffectApplication.
+//   AbilityActivation  - input activations (TryActivateAbilityFromInput, checks included) and the ActivateAbility
+//                        of every UGASCoreGameplayAbility however it was triggered (tags, events, server side).
+//   ProjectileUpdate   - UGASCoreProjectileSimulationSubsystem tick.
+//   UIBroadcast        - GASCoreUI widget controller / view model flushes, overhead bar and combat text updates.
+// - ConsumeFrame returns the totals since its previous call and clears them; call it once per frame.
+// - Compiled out when GASCORE_FRAME_BUDGET is 0 (default: non-shipping builds).
+
+#ifndef GASCORE_FRAME_BUDGET
+#define GASCORE_FRAME_BUDGET !UE_BUILD_SHIPPING
+#endif
+
+enum class EGASCoreFrameBudgetArea : uint8
+{
+	EffectApplication,
+	AttributeCallbacks,
+	AbilityActivation,
+	ProjectileUpdate,
+	UIBroadcast,
+
+	Num
+};
+
+#if GASCORE_FRAME_BUDGET
+
+namespace GASCoreFrameBudget
+{
+	/** Mirrors GASCore.FrameBudget.Enable. */
+	extern GASCORE_API bool bEnabled;
+
+	FORCEINLINE bool IsEnabled() { return bEnabled; }
+
+	/** Display name of Area ("GE Application", ...). */
+	GASCORE_API const TCHAR* GetAreaName(EGASCoreFrameBudgetArea Area);
+
+	/** Opening scope of Area; false if an enclosing scope of the same area already times it (or off the game thread). */
+	GASCORE_API bool Enter(EGASCoreFrameBudgetArea Area);
+	GASCORE_API void Exit(EGASCoreFrameBudgetArea Area, uint64 Cycles);
+
+	/** Microseconds per area since the previous call, then clear. */
+	GASCORE_API void ConsumeFrame(double (&OutMicroseconds)[static_cast<int32>(EGASCoreFrameBudgetArea::Num)]);
+}
+
+/** Times its lifetime into Area when frame budgeting is enabled. */
+class FGASCoreFrameBudgetScope
+{
+public:
+	explicit FGASCoreFrameBudgetScope(const EGASCoreFrameBudgetArea InArea)
+		: Area(InArea)
+		, StartCycles(GASCoreFrameBudget::IsEnabled() && GASCoreFrameBudget::Enter(InArea) ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	~FGASCoreFrameBudgetScope()
+	{
+		if (StartCycles)
+		{
+			GASCoreFrameBudget::Exit(Area, FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+
+	UE_NONCOPYABLE(FGASCoreFrameBudgetScope);
+
+private:
+	EGASCoreFrameBudgetArea Area;
+	uint64 StartCycles;
+};
+
+/** Area: an EGASCoreFrameBudgetArea enumerator name (GASCORE_FRAME_BUDGET_SCOPE(EffectApplication)). */
+#define GASCORE_FRAME_BUDGET_SCOPE(Area) \
+	const FGASCoreFrameBudgetScope PREPROCESSOR_JOIN(GASCoreFrameBudgetScope_, __LINE__)(EGASCoreFrameBudgetArea::Area)
+
+#else
+
+#define GASCORE_FRAME_BUDGET_SCOPE(Area)
+
+#endif
@@ -0,0 +1,44 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Memreport-style heap accounting for GAS state, per ability system and per owner class.
+// - GASCore.MemReport [-asc] prints, for the world's registered ASCs (UGASCoreAbilitySystemRegistrySubsystem):
+//   - ActiveEffects: active GE container entries plus their specs' modifier, modified-attribute and set-by-caller storage.
+//   - Abilities: the activatable spec array plus the instanced ability objects.
+//   - AttributeSets: the set objects plus their per-instance GASCore state (UGASCoreAttributeSet::GetInstanceAllocatedSize).
+//   - Tags: the owned tag count maps. The engine keeps them private, so they are estimated from the owned tags and
+//     their parents (one map element per tag).
+//   - GASCore: the GASCore ASC's own containers (UGASCoreAbilitySystemComponent::GetCoreAllocatedSize).
+//   Rows are aggregated by owner class; -asc also lists every ASC.
+// - Shared state: the per-class attribute metadata tables (FGASCoreAttributeMetadata, shared by every instance of a
+//   class) and the tracking maps of every effect actor in the world.
+// - Contributors: other modules register a named callback returning the bytes they hold for a world (path buffers,
+//   registries), printed as one line each.
+// - Bytes are heap allocations (GetAllocatedSize / FArchiveCountMem max); allocator slack and engine-internal caches
+//   are not counted. Use the numbers to compare builds and find growth, Memory Insights for the allocator view.
+// - Game thread only; compiled out when GASCORE_MEM_REPORT is 0 (default: non-shipping builds).
+
+#ifndef GASCORE_MEM_REPORT
+#define GASCORE_MEM_REPORT !UE_BUILD_SHIPPING
+#endif
+
+#if GASCORE_MEM_REPORT
+
+class FOutputDevice;
+class UWorld;
+
+namespace GASCoreMemoryReport
+{
+	/** Add (or replace) a named line of the report: Measure returns the bytes held for the world. */
+	GASCORE_API void RegisterContributor(FName Name, TFunction<SIZE_T(const UWorld& World)> Measure);
+
+	GASCORE_API void UnregisterContributor(FName Name);
+
+	/** Print the report for World (bPerAbilitySystem: one row per ASC as well as per owner class). */
+	GASCORE_API void Dump(const UWorld& World, FOutputDevice& Ar, bool bPerAbilitySystem);
+}
+
+#endif
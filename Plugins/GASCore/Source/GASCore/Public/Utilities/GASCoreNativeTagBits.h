@@ -0,0 +1,54 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+// Packed bits for a fixed set of native tags (input tags, attribute tags, UI roots).
+// - Each registered tag owns one bit of a uint64. Register the project's native tags once at startup.
+// - Every tag (registered or not) resolves to FGASCoreTagBits: its own bit plus the bits of its registered
+//   ancestors, so hierarchical MatchesTag against registered tags and group membership ("is any input tag")
+//   become one AND instead of a tag-node walk or a container scan.
+// - Get is one hash lookup into the resolved-bits cache (unregistered tags are resolved on first query);
+//   registering a tag later updates every cached entry. Code testing the same tag repeatedly (per frame, per
+//   event) should keep the FGASCoreTagBits from one Get and test masks against it: that part is the single AND.
+// - Any thread: the registry and the cache are guarded by a read/write lock (cache hits share it, first queries of
+//   a tag and Register take it exclusively).
+
+/** Membership of one tag in the registered native tag set. */
+struct FGASCoreTagBits
+{
+	/** Bit of the tag itself (0 when the tag is not registered). */
+	uint64 Exact = 0;
+
+	/** Exact plus the bits of every registered ancestor. */
+	uint64 Hierarchy = 0;
+
+	/** Tag is exactly one of Bits (MatchesTagExact against a registered tag or group mask). */
+	bool MatchesExact(const uint64 Bits) const { return (Exact & Bits) != 0; }
+
+	/** Tag is one of Bits or a child of one of them (MatchesTag against registered tags). */
+	bool Matches(const uint64 Bits) const { return (Hierarchy & Bits) != 0; }
+};
+
+namespace GASCoreNativeTagBits
+{
+	/** Registered tags fit a single uint64. */
+	inline constexpr int32 MaxTags = 64;
+
+	/** Assign Tag a bit (idempotent). Returns its bit, or 0 for an invalid tag / a full set (logged). */
+	GASCORE_API uint64 Register(const FGameplayTag& Tag);
+
+	/** Bits of Tag (empty for an invalid tag). */
+	GASCORE_API FGASCoreTagBits Get(const FGameplayTag& Tag);
+
+	/** OR of the exact bits of Tags (unregistered tags contribute nothing). */
+	GASCORE_API uint64 MakeMask(const FGameplayTagContainer& Tags);
+
+	/** OR of the hierarchy bits of Tags (the container HasTag-matches every returned bit). */
+	GASCORE_API uint64 MakeHierarchyMask(const FGameplayTagContainer& Tags);
+
+	/** Number of registered tags. */
+	GASCORE_API int32 Num();
+}
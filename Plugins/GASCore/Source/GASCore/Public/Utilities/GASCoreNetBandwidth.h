@@ -0,0 +1,60 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Sender-side bandwidth accounting for GAS replication, per connection.
+// - GASCore.NetBandwidth.Enable 1 starts a session; GASCore.NetBandwidth.Dump [TopN] prints per-connection totals and
+//   the most expensive items; GASCore.NetBandwidth.Write saves every row as CSV to Saved/Profiling;
+//   GASCore.NetBandwidth.Reset restarts the session. Per-frame totals also go to the GASCoreNetBandwidth CSV category.
+// - Three kinds of items:
+//   - Attribute: one replicated property of an attribute set owned by a GASCore ASC ("UTDAttributeSet.Health").
+//   - Field: one replicated property of the ASC itself (ActiveGameplayEffects, MinimalReplicationTags, ...).
+//   - RPC: one remote function of the ASC (engine GAS RPCs and GASCore's own).
+// - Properties: at each net update of the owner (ASC PreReplication) every tracked property is compared with its
+//   value at the previous update. A change is charged to every connection with an open channel to the owner that its
+//   replication condition lets through (attribute sets' dynamic tier conditions included, COND_Never skipped).
+//   Fast arrays charge their changed items only (per-item replication keys) plus a removal id per removed item.
+// - RPCs: the parameters are charged to the owning connection (Client / Server) or to every open channel (Multicast).
+// - Bits are payload bits, measured by net-serializing the value: object references count as a 32-bit NetGUID;
+//   property handles, bunch and packet headers, initial channel bunches and resends are not counted. The numbers
+//   rank bandwidth consumers and compare configurations; Networking Insights remains the exact wire view.
+// - Per-ASC totals (GetAbilitySystemBits) feed the GAS debugger's cost view.
+// - Game thread only; compiled out in Shipping/Test.
+
+#ifndef GASCORE_NET_BANDWIDTH
+#define GASCORE_NET_BANDWIDTH !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+#if GASCORE_NET_BANDWIDTH
+
+class FOutputDevice;
+class UAbilitySystemComponent;
+class UFunction;
+
+namespace GASCoreNetBandwidth
+{
+	/** Mirrors GASCore.NetBandwidth.Enable. */
+	GASCORE_API bool IsEnabled();
+
+	/** Authority, owner net update (PreReplication): charge the ASC's and its attribute sets' changes since the last one. */
+	GASCORE_API void RecordReplication(const UAbilitySystemComponent& AbilitySystem);
+
+	/** Remote call of Function on AbilitySystem (CallRemoteFunction) with its parameter block. */
+	GASCORE_API void RecordRemoteFunction(const UAbilitySystemComponent& AbilitySystem, UFunction& Function, void* Parameters);
+
+	/** Bits charged to AbilitySystem this session (its fields, attribute sets and RPCs, summed over receivers). */
+	GASCORE_API int64 GetAbilitySystemBits(const UAbilitySystemComponent& AbilitySystem);
+
+	/** Restart the session (drops totals and property snapshots). */
+	GASCORE_API void Reset();
+
+	/** Print per-connection totals and the top-N items of each connection. */
+	GASCORE_API void Dump(FOutputDevice& Ar, int32 TopN);
+
+	/** Write every (connection, item) row as CSV; returns the file path (empty on failure). */
+	GASCORE_API FString WriteCsv();
+}
+
+#endif
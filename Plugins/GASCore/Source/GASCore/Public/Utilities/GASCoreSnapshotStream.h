@@ -0,0 +1,138 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// ASC snapshot streaming for inspecting a remote (dedicated) server from the GAS debugger.
+// - Server: GASCore.SnapshotStream.Port N (> 0) listens for TCP debug clients (GASCore.SnapshotStream.MaxClients) on
+//   GASCore.SnapshotStream.BindAddress (loopback by default; 0.0.0.0 exposes the stream to the network).
+//   Every 1 / GASCore.SnapshotStream.Rate seconds each client receives the directory of the server's ASCs
+//   (UGASCoreAbilitySystemRegistrySubsystem, only when it changed) and a snapshot of the ASCs it selected.
+// - Snapshots are deltas against what that client last received: changed attribute values, tags added / removed /
+//   recounted, and active effect handles added / removed / restacked. Newly selected ASCs and attribute set changes
+//   send a full snapshot.
+// - Client: FGASCoreSnapshotStreamClient connects, selects ASCs and mirrors their state (SGASAttachEditor's Remote
+//   category). Non-blocking sockets are pumped on the game thread (server: core ticker; client: Tick); host names
+//   resolve asynchronously and the connect completes in Tick, so the editor never waits on the network.
+// - Received payloads are read with a size limit and bounded element counts (a peer cannot make us allocate more
+//   than its message size).
+// - Wire format: uint32 payload size + payload (FArchive, little endian), first payload byte is the message type.
+// - Compiled out in Shipping/Test.
+
+#ifndef GASCORE_SNAPSHOT_STREAM
+#define GASCORE_SNAPSHOT_STREAM !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+#if GASCORE_SNAPSHOT_STREAM
+
+class FSocket;
+
+/** One ASC listed by the server. */
+struct FGASCoreRemoteComponent
+{
+	/** Server-side object id (stable for the component's lifetime). */
+	uint32 Id = 0;
+
+	/** Avatar (or owner) name. */
+	FString Name;
+};
+
+/** Mirrored state of one selected ASC. */
+struct FGASCoreRemoteSnapshot
+{
+	struct FEffect
+	{
+		FString Name;
+		int32 StackCount = 0;
+
+		/** Server world time the effect expires (-1 = infinite). */
+		float EndTime = -1.f;
+	};
+
+	/** Server world time of the last snapshot. */
+	double ServerTime = 0.0;
+
+	/** Attribute name / current value, in server order. */
+	TArray<TPair<FString, float>> Attributes;
+
+	/** Tag -> count. */
+	TMap<FString, int32> Tags;
+
+	/** Active effect handle id -> effect. */
+	TMap<int32, FEffect> Effects;
+};
+
+/** Debug client of a server's snapshot stream (game thread). */
+class GASCORE_API FGASCoreSnapshotStreamClient
+{
+public:
+	~FGASCoreSnapshotStreamClient();
+
+	/**
+	 * Start connecting to Host:Port; resolution and the TCP handshake complete in Tick (IsConnecting until then).
+	 * False (with OutError) when it fails at once; later failures disconnect and leave GetLastError.
+	 */
+	bool Connect(const FString& Host, int32 Port, FString& OutError);
+
+	void Disconnect();
+
+	bool IsConnected() const { return Socket != nullptr && !bConnecting; }
+
+	/** Resolving the host or waiting for the handshake. */
+	bool IsConnecting() const { return PendingResolve.IsValid() || bConnecting; }
+
+	/** Why the last connection attempt failed or the connection was lost. */
+	const FString& GetLastError() const { return LastError; }
+
+	/** Advance the connection attempt, then read and apply everything the server sent. Disconnects when the server went away. */
+	void Tick();
+
+	/** Replace the selection; the server answers with full snapshots of newly selected ASCs. */
+	void Select(const TArray<uint32>& Ids);
+
+	const TArray<FGASCoreRemoteComponent>& GetComponents() const { return Components; }
+
+	/** Mirrored state of a selected ASC (null until its first snapshot arrived). */
+	const FGASCoreRemoteSnapshot* GetSnapshot(const uint32 Id) const { return Snapshots.Find(Id); }
+
+	/** Increases whenever the directory or a snapshot changed. */
+	uint64 GetRevision() const { return Revision; }
+
+private:
+	/** Apply one complete payload. False on a malformed message. */
+	bool HandleMessage(const TArray<uint8>& Payload);
+
+	/** Create the socket and start the non-blocking connect to Address. */
+	bool StartConnect(const TSharedRef<class FInternetAddr>& Address);
+
+	/** Finish the resolve / handshake in progress. False when it failed (LastError set). */
+	bool TickConnect();
+
+	/** Disconnect keeping Error as the reason. */
+	void Fail(const FString& Error);
+
+	/** Result slot of an asynchronous host resolution (filled on a worker thread, read in Tick). */
+	struct FPendingResolve;
+	TSharedPtr<FPendingResolve, ESPMode::ThreadSafe> PendingResolve;
+
+	FSocket* Socket = nullptr;
+
+	/** Socket created, handshake not completed yet. */
+	bool bConnecting = false;
+	double ConnectDeadline = 0.0;
+	int32 ConnectPort = 0;
+	FString LastError;
+
+	/** Received bytes not yet forming a complete message. */
+	TArray<uint8> ReceiveBuffer;
+
+	/** Queued bytes the socket did not take yet. */
+	TArray<uint8> SendBuffer;
+
+	TArray<FGASCoreRemoteComponent> Components;
+	TMap<uint32, FGASCoreRemoteSnapshot> Snapshots;
+	uint64 Revision = 0;
+};
+
+#endif
@@ -0,0 +1,145 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Low-overhead recorder of GAS state changes on selected ASCs, replayed by the GAS debugger's timeline.
+// - Watch(ASC) adds an ASC as a source (at most GASCore.StateRecorder.MaxSources). While a source is being
+//   watched, the recorder closes one frame per engine frame (one global FCoreDelegates::OnEndFrame binding).
+// - Only deltas are stored, as 12-byte events: attribute values changed since the previous frame (one compare per
+//   attribute per frame), tags added or removed (generic tag event), active effects added or removed, and ability
+//   activations and ends (ASC delegates). Watch records the ASC's current state once, so replay has a full base.
+// - Fixed-size rings: GASCore.StateRecorder.Capacity events and GASCore.StateRecorder.MaxFrames frames, allocated
+//   once per session. An evicted event is folded into a base state, so every retained frame still replays exactly.
+// - Per-frame budget: polled attribute changes fill a frame up to GASCore.StateRecorder.MaxEventsPerFrame events;
+//   the rest keep their last recorded value and are retried next frame (counted on the frame as deferred). Tag,
+//   effect and ability events are never dropped, so the replayed state stays exact. That budget and the fixed memory
+//   (~1.3 MB at the defaults) make it safe to leave on in playtests.
+// - GASCore.StateRecorder.Dump prints the session; GASCore.StateRecorder.Reset drops it and stops watching.
+// - Game thread only; compiled out in Shipping/Test.
+
+#ifndef GASCORE_STATE_RECORDER
+#define GASCORE_STATE_RECORDER !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+#if GASCORE_STATE_RECORDER
+
+class FOutputDevice;
+class UAbilitySystemComponent;
+
+enum class EGASCoreRecordedEventType : uint8
+{
+	/** Key = attribute name, Value = new current value. */
+	Attribute,
+
+	/** Key = tag name, Value = new count (0 = removed). */
+	Tag,
+
+	/** Key = active effect handle id (see GetEffectName), Value = stack count. */
+	EffectAdded,
+
+	/** Key = active effect handle id. */
+	EffectRemoved,
+
+	/** Key = ability class name. */
+	AbilityActivated,
+
+	/** Key = ability class name. */
+	AbilityEnded,
+};
+
+/** One recorded delta. */
+struct FGASCoreRecordedEvent
+{
+	/** Source index (GetSourceName). */
+	uint8 Source = 0;
+
+	EGASCoreRecordedEventType Type = EGASCoreRecordedEventType::Attribute;
+
+	/** Name index (GetName) or effect handle id, depending on Type. */
+	int32 Key = 0;
+
+	float Value = 0.f;
+};
+
+/** One recorded engine frame. */
+struct FGASCoreRecordedFrame
+{
+	/** GFrameCounter when the frame closed. */
+	uint64 EngineFrame = 0;
+
+	/** Seconds since the session started. */
+	double Time = 0.0;
+
+	/** Sequence number of the frame's first event. */
+	uint64 FirstEvent = 0;
+
+	/** Recorded events. */
+	uint32 NumEvents = 0;
+
+	/** Attribute changes over the per-frame budget (recorded on a later frame). */
+	uint32 NumDropped = 0;
+};
+
+/** Replayed state of one source at the end of a frame (keys as in FGASCoreRecordedEvent). */
+struct FGASCoreRecordedState
+{
+	TMap<int32, float> Attributes;
+
+	/** Tag -> count (present tags only). */
+	TMap<int32, int32> Tags;
+
+	/** Active effect handle id -> stack count. */
+	TMap<int32, int32> Effects;
+
+	/** Ability class -> active instances. */
+	TMap<int32, int32> Abilities;
+
+	void Apply(const FGASCoreRecordedEvent& Event);
+};
+
+namespace GASCoreStateRecorder
+{
+	/** Start recording AbilitySystem (no-op when already watched). Returns false when MaxSources are in use. */
+	GASCORE_API bool Watch(UAbilitySystemComponent* AbilitySystem);
+
+	/** Stop recording AbilitySystem. Its recorded frames stay replayable. */
+	GASCORE_API void Unwatch(UAbilitySystemComponent* AbilitySystem);
+
+	GASCORE_API bool IsWatching(const UAbilitySystemComponent* AbilitySystem);
+
+	/** Drop the session (sources, events, frames) and stop watching. */
+	GASCORE_API void Reset();
+
+	/** Increases whenever a frame closes or the session resets (cheap "anything new?" check for viewers). */
+	GASCORE_API uint64 GetRevision();
+
+	// ===== Replay =====
+
+	/** Sources ever watched this session; the index is FGASCoreRecordedEvent::Source. */
+	GASCORE_API int32 GetNumSources();
+	GASCORE_API FString GetSourceName(int32 Source);
+	GASCORE_API UAbilitySystemComponent* GetSourceComponent(int32 Source);
+
+	/** Replayable frames, oldest first. */
+	GASCORE_API int32 GetNumFrames();
+	GASCORE_API const FGASCoreRecordedFrame& GetFrame(int32 Index);
+
+	/** Events of frame Index, in recording order. */
+	GASCORE_API void GetFrameEvents(int32 Index, TArray<FGASCoreRecordedEvent>& OutEvents);
+
+	/** State of every source at the end of frame Index. OutStates is indexed by source. */
+	GASCORE_API void BuildState(int32 Index, TArray<FGASCoreRecordedState>& OutStates);
+
+	/** Attribute, tag or ability name of a key. */
+	GASCORE_API FName GetName(int32 Key);
+
+	/** Effect definition name of an active effect handle id. */
+	GASCORE_API FName GetEffectName(int32 HandleId);
+
+	/** Print sources, retained window, event counts and memory. */
+	GASCORE_API void Dump(FOutputDevice& Ar);
+}
+
+#endif
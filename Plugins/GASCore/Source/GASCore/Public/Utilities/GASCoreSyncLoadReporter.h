@@ -0,0 +1,31 @@
+// Copyright DermanDanisman, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Synchronous load hitch report for GAS assets (pairs with the startup preload of UGASCoreGameDataAsset bundles).
+// - Watched packages are registered by the game (the preloaded bundle contents). Whenever one of them is loaded
+//   synchronously while a game world is playing, a warning with the package name is logged and counted.
+// - GASCore.SyncLoadReport.All 1 reports every synchronous load during gameplay, not only watched packages.
+// - GASCore.SyncLoadReport.Dump prints the counts; GASCore.SyncLoadReport.Reset clears them.
+// - Game thread only; compiled out when GASCORE_SYNC_LOAD_REPORTER is 0 (default: non-shipping builds).
+
+#ifndef GASCORE_SYNC_LOAD_REPORTER
+#define GASCORE_SYNC_LOAD_REPORTER !UE_BUILD_SHIPPING
+#endif
+
+#if GASCORE_SYNC_LOAD_REPORTER
+
+class FOutputDevice;
+
+namespace GASCoreSyncLoadReporter
+{
+	/** Watch the packages of Paths; starts listening on first call. */
+	GASCORE_API void AddWatchedAssets(TConstArrayView<FSoftObjectPath> Paths);
+
+	GASCORE_API void Reset();
+	GASCORE_API void Dump(FOutputDevice& Ar);
+}
+
+#endif
@@ -0,0 +1,41 @@
+// Copyright DermanDanisman, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Gameplay tag replication frequency recorder (soak sessions -> fast replication config).
+// - GASCore.TagRepProfiler.Enable 1 starts a session; GASCore.TagRepProfiler.Dump [TopN] prints per-tag totals,
+//   average and peak replications per second; GASCore.TagRepProfiler.Write saves the recommended
+//   [/Script/GameplayTags.GameplayTagsSettings] block (FastReplication, CommonlyReplicatedTags,
+//   NetIndexFirstBitSegment) to Saved/Profiling; GASCore.TagRepProfiler.Reset restarts the session.
+// - Counts come from the engine's own per-tag replication counters (UGameplayTagsManager::NotifyTagReplicated, fed
+//   by every FGameplayTag / container NetSerialize on the sending side); a 1 Hz ticker turns them into rates.
+// - Recommended tags are the most replicated ones covering GASCore.TagRepProfiler.Coverage of all replications.
+//   Server and clients must ship the same list, and FastReplication needs identical tag tables on both ends.
+// - Game thread only; compiled out in Shipping/Test, where the engine does not count.
+
+#ifndef GASCORE_TAG_REPLICATION_PROFILER
+#define GASCORE_TAG_REPLICATION_PROFILER !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+#if GASCORE_TAG_REPLICATION_PROFILER
+
+class FOutputDevice;
+
+namespace GASCoreTagReplicationProfiler
+{
+	/** Mirrors GASCore.TagRepProfiler.Enable. */
+	GASCORE_API bool IsEnabled();
+
+	/** Restart the session: baseline the engine counters now. */
+	GASCORE_API void Reset();
+
+	/** Print the top-N replicated tags of the session and the recommended settings. */
+	GASCORE_API void Dump(FOutputDevice& Ar, int32 TopN);
+
+	/** Write the recommended GameplayTagsSettings block; returns the file path (empty on failure). */
+	GASCORE_API FString WriteRecommendedConfig();
+}
+
+#endif
@@ -0,0 +1,30 @@
+// © 2025 Heathrow (Derman). All rights reserved.
+
+using UnrealBuildTool;
+
+public class GASCoreBenchmarks : ModuleRules
+{
+	public GASCoreBenchmarks(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"GASCore",
+				"GameplayAbilities",
+				"GameplayTags",
+				"GameplayTasks"
+			}
+		);
+	}
+}
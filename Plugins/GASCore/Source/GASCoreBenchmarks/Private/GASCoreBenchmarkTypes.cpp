@@ -0,0 +1,24 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "GASCoreBenchmarkTypes.h"
+
+void UGASCoreBenchmarkAttributeSet::ConfigureAttributeMetadata(FGASCoreAttributeMetadataBuilder& Builder) const
+{
+	Super::ConfigureAttributeMetadata(Builder);
+
+	Builder.RegisterCurrentMaxPair(GetHealthAttribute(), GetMaxHealthAttribute());
+	Builder.RegisterCurrentMaxPair(GetManaAttribute(), GetMaxManaAttribute());
+	Builder.SetIntegerStorage(GetHealthAttribute());
+	Builder.SetIntegerStorage(GetMaxHealthAttribute());
+	Builder.SetRoundingDecimals(GetManaAttribute(), 2);
+	Builder.SetRoundingDecimals(GetMaxManaAttribute(), 2);
+	Builder.SetClampRange(GetStrengthAttribute(), 0.f, 999.f);
+}
+
+UGASCoreBenchmarkMMC::UGASCoreBenchmarkMMC()
+{
+	CapturedAttributeDef.AttributeToCapture = UGASCoreBenchmarkAttributeSet::GetStrengthAttribute();
+	CapturedAttributeDef.AttributeSource = EGameplayEffectAttributeCaptureSource::Target;
+	CapturedAttributeDef.bSnapshot = false;
+	LevelSource = EGASCoreMMCLevelSource::SpecLevel;
+}
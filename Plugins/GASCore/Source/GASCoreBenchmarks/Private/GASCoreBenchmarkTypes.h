@@ -0,0 +1,54 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+// Synthetic GASCore types for the microbenchmarks (GASCoreMicrobenchmarks.cpp).
+// - The attribute set mirrors a typical game set: an integer vital pair, a fractional pair and an unpaired primary,
+//   so both the clamped and the plain paths of the callbacks are measured.
+// - The MMC captures the primary from the target with a spec-level term (no combat interface on the owner).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystem/Attributes/GASCoreAttributeSet.h"
+#include "AbilitySystem/ModMagCalcs/GASCoreMMCSingleBackedAttribute.h"
+
+#include "GASCoreBenchmarkTypes.generated.h"
+
+UCLASS(Transient)
+class UGASCoreBenchmarkAttributeSet : public UGASCoreAttributeSet
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FGameplayAttributeData Health;
+	ATTRIBUTE_ACCESSORS(UGASCoreBenchmarkAttributeSet, Health)
+
+	UPROPERTY()
+	FGameplayAttributeData MaxHealth;
+	ATTRIBUTE_ACCESSORS(UGASCoreBenchmarkAttributeSet, MaxHealth)
+
+	UPROPERTY()
+	FGameplayAttributeData Mana;
+	ATTRIBUTE_ACCESSORS(UGASCoreBenchmarkAttributeSet, Mana)
+
+	UPROPERTY()
+	FGameplayAttributeData MaxMana;
+	ATTRIBUTE_ACCESSORS(UGASCoreBenchmarkAttributeSet, MaxMana)
+
+	UPROPERTY()
+	FGameplayAttributeData Strength;
+	ATTRIBUTE_ACCESSORS(UGASCoreBenchmarkAttributeSet, Strength)
+
+protected:
+	virtual void ConfigureAttributeMetadata(FGASCoreAttributeMetadataBuilder& Builder) const override;
+};
+
+UCLASS(Transient)
+class UGASCoreBenchmarkMMC : public UGASCoreMMCSingleBackedAttribute
+{
+	GENERATED_BODY()
+
+public:
+	UGASCoreBenchmarkMMC();
+};
@@ -0,0 +1,17 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "GASCoreBenchmarks.h"
+
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+void FGASCoreBenchmarksModule::StartupModule()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FGASCoreBenchmarksModule::StartupModule);
+	// The benchmarks are console driven (GASCore.Bench.Run); nothing to set up.
+}
+
+void FGASCoreBenchmarksModule::ShutdownModule()
+{
+}
+
+IMPLEMENT_MODULE(FGASCoreBenchmarksModule, GASCoreBenchmarks)
@@ -0,0 +1,346 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+// GASCoreMicrobenchmarks
+// Purpose:
+// - Cost of the GASCore hot callbacks in isolation, so metadata-table / offset-cache changes can be compared
+//   without the noise of a full game frame.
+//
+// How it works:
+// - GASCore.Bench.Run [Iterations] [NameFilter] (server or standalone world): spawns a transient owner with an ASC and
+//   a UGASCoreBenchmarkAttributeSet, builds a synthetic instant spec whose modifier uses UGASCoreBenchmarkMMC, then
+//   calls each case Iterations times (after a warm-up), Repetitions times, and keeps the best repetition.
+// - Inputs vary with the call index so nothing is constant-folded; results feed a volatile sink.
+// - Cycles are TSC reference cycles on x86 (rdtsc), platform timer ticks elsewhere; ns come from FPlatformTime.
+// - GASCore.EffectProfiler.Enable is switched off for the run (its scopes would be measured too).
+// - Results: "GASCoreBench" log lines and Saved/Profiling/GASCoreBench/Summary.csv (build, changelist, case).
+
+#include "GASCoreBenchmarkTypes.h"
+
+#include "AbilitySystem/Formulas/GASCoreAttributeFormulas.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameplayEffect.h"
+#include "GameplayEffectExtension.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#if PLATFORM_WINDOWS
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogGASCoreBench, Log, All);
+
+/** Friend of UGASCoreAttributeSet (RoundToDecimals / FindAttributeDataConst are not public). */
+class FGASCoreMicrobenchmarks
+{
+public:
+	static void Run(UWorld& World, int32 Iterations, const FString& Filter);
+
+private:
+	static constexpr int32 Repetitions = 5;
+
+	struct FResult
+	{
+		FString Name;
+		int32 Iterations = 0;
+		double NanosecondsPerCall = 0.0;
+		double CyclesPerCall = 0.0;
+	};
+
+	static uint64 ReadCycles()
+	{
+#if PLATFORM_CPU_X86_FAMILY
+		return __rdtsc();
+#else
+		return FPlatformTime::Cycles64();
+#endif
+	}
+
+	/** Time Body(Index) -> float over Iterations calls; best of Repetitions. */
+	template <typename BodyType>
+	static void Measure(const TCHAR* Name, const int32 Iterations, const FString& Filter, TArray<FResult>& Results, BodyType&& Body)
+	{
+		if (!Filter.IsEmpty() && !FCString::Stristr(Name, *Filter))
+		{
+			return;
+		}
+
+		volatile float Sink = 0.f;
+		for (int32 Index = 0; Index < FMath::Max(Iterations / 10, 1); ++Index)
+		{
+			Sink = Sink + Body(Index);
+		}
+
+		double BestSeconds = TNumericLimits<double>::Max();
+		uint64 BestCycles = TNumericLimits<uint64>::Max();
+		for (int32 Repetition = 0; Repetition < Repetitions; ++Repetition)
+		{
+			const uint64 StartTime = FPlatformTime::Cycles64();
+			const uint64 StartCycles = ReadCycles();
+			for (int32 Index = 0; Index < Iterations; ++Index)
+			{
+				Sink = Sink + Body(Index);
+			}
+			const uint64 EndCycles = ReadCycles();
+			const uint64 EndTime = FPlatformTime::Cycles64();
+
+			BestSeconds = FMath::Min(BestSeconds, FPlatformTime::ToSeconds64(EndTime - StartTime));
+			BestCycles = FMath::Min(BestCycles, EndCycles - StartCycles);
+		}
+
+		FResult& Result = Results.AddDefaulted_GetRef();
+		Result.Name = Name;
+		Result.Iterations = Iterations;
+		Result.NanosecondsPerCall = BestSeconds * 1e9 / Iterations;
+		Result.CyclesPerCall = static_cast<double>(BestCycles) / Iterations;
+	}
+
+	static void WriteSummary(const TArray<FResult>& Results);
+};
+
+namespace GASCoreMicrobenchmarksPrivate
+{
+	/** Switch a console variable, returning its previous value. */
+	static bool SetConsoleBool(const TCHAR* Name, const bool bValue)
+	{
+		IConsoleVariable* Variable = IConsoleManager::Get().FindConsoleVariable(Name);
+		if (!Variable)
+		{
+			return false;
+		}
+
+		const bool bPrevious = Variable->GetBool();
+		Variable->Set(bValue, ECVF_SetByCode);
+		return bPrevious;
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs RunCommand(
+		TEXT("GASCore.Bench.Run"),
+		TEXT("Microbenchmark the GASCore hot callbacks: GASCore.Bench.Run [Iterations=100000] [NameFilter]."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (!World || World->GetNetMode() == NM_Client)
+			{
+				UE_LOG(LogGASCoreBench, Warning, TEXT("GASCoreBench: run it in a server or standalone world."));
+				return;
+			}
+
+			const int32 Iterations = Args.IsValidIndex(0) ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+			FGASCoreMicrobenchmarks::Run(*World, Iterations, Args.IsValidIndex(1) ? Args[1] : FString());
+		}));
+}
+
+void FGASCoreMicrobenchmarks::Run(UWorld& World, const int32 Iterations, const FString& Filter)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FGASCoreMicrobenchmarks::Run);
+
+	// ----- Synthetic owner, attribute set and spec -----
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+	AActor* Owner = World.SpawnActor<AActor>(SpawnParameters);
+	if (!Owner)
+	{
+		return;
+	}
+
+	UAbilitySystemComponent* AbilitySystem = NewObject<UAbilitySystemComponent>(Owner, TEXT("GASCoreBenchAbilitySystem"));
+	AbilitySystem->RegisterComponent();
+	AbilitySystem->InitAbilityActorInfo(Owner, Owner);
+
+	UGASCoreBenchmarkAttributeSet* Set = NewObject<UGASCoreBenchmarkAttributeSet>(Owner);
+	AbilitySystem->AddSpawnedAttribute(Set);
+	AbilitySystem->SetNumericAttributeBase(UGASCoreBenchmarkAttributeSet::GetMaxHealthAttribute(), 1000.f);
+	AbilitySystem->SetNumericAttributeBase(UGASCoreBenchmarkAttributeSet::GetHealthAttribute(), 500.f);
+	AbilitySystem->SetNumericAttributeBase(UGASCoreBenchmarkAttributeSet::GetMaxManaAttribute(), 200.f);
+	AbilitySystem->SetNumericAttributeBase(UGASCoreBenchmarkAttributeSet::GetManaAttribute(), 100.f);
+	AbilitySystem->SetNumericAttributeBase(UGASCoreBenchmarkAttributeSet::GetStrengthAttribute(), 25.f);
+
+	// Instant effect with one MMC-driven modifier: the spec captures Strength from the target like a real GE.
+	UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), NAME_None, RF_Transient);
+	Effect->DurationPolicy = EGameplayEffectDurationType::Instant;
+	FCustomCalculationBasedFloat Calculation;
+	Calculation.CalculationClassMagnitude = UGASCoreBenchmarkMMC::StaticClass();
+	FGameplayModifierInfo& Modifier = Effect->Modifiers.AddDefaulted_GetRef();
+	Modifier.Attribute = UGASCoreBenchmarkAttributeSet::GetHealthAttribute();
+	Modifier.ModifierOp = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(Calculation);
+
+	FGameplayEffectSpec Spec(Effect, AbilitySystem->MakeEffectContext(), 1.f);
+	Spec.CapturedRelevantAttributes.CaptureAttributes(AbilitySystem, EGameplayEffectAttributeCaptureSource::Target);
+	const UGASCoreBenchmarkMMC* Calculator = GetDefault<UGASCoreBenchmarkMMC>();
+
+	FGameplayModifierEvaluatedData HealthExecution(UGASCoreBenchmarkAttributeSet::GetHealthAttribute(), EGameplayModOp::Additive, -5.f);
+	FGameplayModifierEvaluatedData MaxHealthExecution(UGASCoreBenchmarkAttributeSet::GetMaxHealthAttribute(), EGameplayModOp::Additive, 10.f);
+	const FGameplayEffectModCallbackData HealthData(Spec, HealthExecution, *AbilitySystem);
+	const FGameplayEffectModCallbackData MaxHealthData(Spec, MaxHealthExecution, *AbilitySystem);
+
+	const FGameplayAttribute Attributes[] =
+	{
+		UGASCoreBenchmarkAttributeSet::GetHealthAttribute(),
+		UGASCoreBenchmarkAttributeSet::GetMaxHealthAttribute(),
+		UGASCoreBenchmarkAttributeSet::GetManaAttribute(),
+		UGASCoreBenchmarkAttributeSet::GetMaxManaAttribute(),
+		UGASCoreBenchmarkAttributeSet::GetStrengthAttribute()
+	};
+	constexpr int32 NumAttributes = UE_ARRAY_COUNT(Attributes);
+
+	// Build the class metadata table outside the timed loops.
+	Set->GetAttributeMetadata();
+
+	const FGASCoreFormulaCoefficients& Coefficients = FGASCoreFormulaCoefficients::GetDefault();
+	auto MakePrimaries = [](const int32 Index)
+	{
+		FGASCorePrimaryAttributeValues Primaries;
+		Primaries.Strength = 10.f + (Index & 15);
+		Primaries.Dexterity = 12.f + (Index & 7);
+		Primaries.Intelligence = 8.f + (Index & 31);
+		Primaries.Endurance = 14.f + (Index & 3);
+		Primaries.Vigor = 9.f + (Index & 63);
+		return Primaries;
+	};
+
+	constexpr int32 BatchActors = 256;
+	FGASCoreFormulaBatch Batch;
+	Batch.Reset(BatchActors);
+	for (int32 Input = 0; Input < GASCoreFormulas::NumPrimaryInputs; ++Input)
+	{
+		for (int32 Actor = 0; Actor < BatchActors; ++Actor)
+		{
+			Batch.Primaries[Input][Actor] = 5.f + ((Actor * (Input + 3)) & 63);
+		}
+	}
+
+	const bool bEffectProfilerWasEnabled = GASCoreMicrobenchmarksPrivate::SetConsoleBool(TEXT("GASCore.EffectProfiler.Enable"), false);
+
+	// ----- Cases -----
+
+	TArray<FResult> Results;
+
+	Measure(TEXT("AttributeSet.RoundToDecimals(0)"), Iterations, Filter, Results, [](const int32 Index)
+	{
+		return UGASCoreAttributeSet::RoundToDecimals(12.345f + (Index & 1023) * 0.37f, 0);
+	});
+
+	Measure(TEXT("AttributeSet.RoundToDecimals(2)"), Iterations, Filter, Results, [](const int32 Index)
+	{
+		return UGASCoreAttributeSet::RoundToDecimals(12.345f + (Index & 1023) * 0.37f, 2);
+	});
+
+	Measure(TEXT("AttributeSet.FindAttributeDataConst"), Iterations, Filter, Results, [Set, &Attributes](const int32 Index)
+	{
+		const FGameplayAttributeData* Data = Set->FindAttributeDataConst(Attributes[Index % NumAttributes]);
+		return Data ? Data->GetCurrentValue() : 0.f;
+	});
+
+	// Paired Current: one in four values lands above Max and is clamped.
+	Measure(TEXT("AttributeSet.PreAttributeChange(Health)"), Iterations, Filter, Results, [Set](const int32 Index)
+	{
+		float NewValue = 400.f + (Index & 1023) * 0.8f;
+		Set->PreAttributeChange(UGASCoreBenchmarkAttributeSet::GetHealthAttribute(), NewValue);
+		return NewValue;
+	});
+
+	Measure(TEXT("AttributeSet.PreAttributeChange(Strength)"), Iterations, Filter, Results, [Set](const int32 Index)
+	{
+		float NewValue = 20.f + (Index & 255) * 0.13f;
+		Set->PreAttributeChange(UGASCoreBenchmarkAttributeSet::GetStrengthAttribute(), NewValue);
+		return NewValue;
+	});
+
+	Measure(TEXT("AttributeSet.PostGameplayEffectExecute(Health)"), Iterations, Filter, Results, [Set, &HealthData, &HealthExecution](const int32 /*Index*/)
+	{
+		Set->PostGameplayEffectExecute(HealthData);
+		return HealthExecution.Magnitude;
+	});
+
+	// Max execution: re-clamps the paired Current (through the ASC when it moves).
+	Measure(TEXT("AttributeSet.PostGameplayEffectExecute(MaxHealth)"), Iterations, Filter, Results, [Set, &MaxHealthData, &MaxHealthExecution](const int32 /*Index*/)
+	{
+		Set->PostGameplayEffectExecute(MaxHealthData);
+		return MaxHealthExecution.Magnitude;
+	});
+
+	Measure(TEXT("MMCSingleBackedAttribute.CalculateBaseMagnitude"), Iterations, Filter, Results, [Calculator, &Spec](const int32 /*Index*/)
+	{
+		return Calculator->CalculateBaseMagnitude_Implementation(Spec);
+	});
+
+	Measure(TEXT("Formulas.Evaluate(MaxHealth)"), Iterations, Filter, Results, [&MakePrimaries, &Coefficients](const int32 Index)
+	{
+		return GASCoreFormulas::Evaluate(EGASCoreSecondaryFormula::MaxHealth, MakePrimaries(Index), Coefficients);
+	});
+
+	Measure(TEXT("Formulas.Evaluate(CriticalHitChance)"), Iterations, Filter, Results, [&MakePrimaries, &Coefficients](const int32 Index)
+	{
+		return GASCoreFormulas::Evaluate(EGASCoreSecondaryFormula::CriticalHitChance, MakePrimaries(Index), Coefficients);
+	});
+
+	Measure(TEXT("Formulas.EvaluateAll"), Iterations, Filter, Results, [&MakePrimaries, &Coefficients](const int32 Index)
+	{
+		float Values[GASCoreFormulas::NumSecondaryFormulas];
+		GASCoreFormulas::EvaluateAll(MakePrimaries(Index), Coefficients, Values);
+		return Values[Index % GASCoreFormulas::NumSecondaryFormulas];
+	});
+
+	Measure(TEXT("Formulas.EvaluateAllBatch(256 actors)"), FMath::Max(Iterations / BatchActors, 1), Filter, Results, [&Batch, &Coefficients](const int32 Index)
+	{
+		GASCoreFormulas::EvaluateAllBatch(Batch, Coefficients);
+		return Batch.GetSecondary(EGASCoreSecondaryFormula::Armor, Index % BatchActors);
+	});
+
+	Measure(TEXT("Formulas.ResolveDamage"), Iterations, Filter, Results, [&Coefficients](const int32 Index)
+	{
+		GASCoreFormulas::FDamageInputs Inputs;
+		Inputs.BaseDamage = 50.f + (Index & 63);
+		Inputs.SourceArmorPenetration = 15.f;
+		Inputs.SourceCriticalHitChance = 25.f;
+		Inputs.SourceCriticalHitDamage = 150.f;
+		Inputs.TargetArmor = 40.f + (Index & 31);
+		Inputs.TargetBlockChance = 10.f;
+		Inputs.TargetCriticalHitResistance = 12.f;
+		const float Roll = static_cast<float>((Index * 37) % 100);
+		return GASCoreFormulas::ResolveDamage(Inputs, Roll, 99.f - Roll, Coefficients).Damage;
+	});
+
+	GASCoreMicrobenchmarksPrivate::SetConsoleBool(TEXT("GASCore.EffectProfiler.Enable"), bEffectProfilerWasEnabled);
+	Owner->Destroy();
+
+	// ----- Report -----
+
+	const TCHAR* CycleUnit = PLATFORM_CPU_X86_FAMILY ? TEXT("cycles") : TEXT("ticks");
+	for (const FResult& Result : Results)
+	{
+		UE_LOG(LogGASCoreBench, Display, TEXT("GASCoreBench %-50s %9.2f ns/call %9.1f %s/call (%d calls, best of %d)"),
+			*Result.Name, Result.NanosecondsPerCall, Result.CyclesPerCall, CycleUnit, Result.Iterations, Repetitions);
+	}
+	WriteSummary(Results);
+}
+
+void FGASCoreMicrobenchmarks::WriteSummary(const TArray<FResult>& Results)
+{
+	const FString Path = FPaths::ProfilingDir() / TEXT("GASCoreBench") / TEXT("Summary.csv");
+	if (!FPaths::FileExists(Path))
+	{
+		FFileHelper::SaveStringToFile(TEXT("Build,Changelist,Case,Calls,NsPerCall,CyclesPerCall\n"), *Path);
+	}
+
+	FString Rows;
+	for (const FResult& Result : Results)
+	{
+		Rows += FString::Printf(TEXT("%s,%u,%s,%d,%.3f,%.1f\n"), FApp::GetBuildVersion(), FEngineVersion::Current().GetChangelist(),
+			*Result.Name, Result.Iterations, Result.NanosecondsPerCall, Result.CyclesPerCall);
+	}
+	if (!FFileHelper::SaveStringToFile(Rows, *Path, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogGASCoreBench, Warning, TEXT("GASCoreBench: could not write %s"), *Path);
+	}
+}
@@ -0,0 +1,21 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "Modules/ModuleManager.h"
+
+/**
+ * GASCoreBenchmarks (developer tool module, not packaged in shipping)
+ *
+ * Microbenchmarks of the GASCore hot callbacks on a synthetic attribute set and spec:
+ *   GASCore.Bench.Run [Iterations] [NameFilter]
+ * Reports ns and cycles per call (best of several repetitions) to the log and to
+ * Saved/Profiling/GASCoreBench/Summary.csv. See GASCoreMicrobenchmarks.cpp.
+ */
+class FGASCoreBenchmarksModule : public IModuleInterface
+{
+public:
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+};
@@ -13,6 +13,7 @@ public class GASCoreUI : ModuleRules
             "Core", 
             "CoreUObject", 
             "Engine",
+            "FieldNotification",
             "GASCore",
             "GameplayAbilities", 
             "GameplayTasks", 
@@ -1,9 +1,14 @@
 ﻿#include "GASCoreUI.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Utilities/GASCoreUITrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(GASCoreUIChannel);
 
 #define LOCTEXT_NAMESPACE "FGASCoreUIModule"
 
 void FGASCoreUIModule::StartupModule()
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(FGASCoreUIModule::StartupModule);
     
 }
 
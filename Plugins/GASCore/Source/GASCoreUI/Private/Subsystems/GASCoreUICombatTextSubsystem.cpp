@@ -0,0 +1,287 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreUICombatTextSubsystem.h"
+
+#include "Actors/GASCoreGameplayCueBurstActor.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "SceneView.h"
+#include "Styling/CoreStyle.h"
+#include "UI/Widgets/SGASCoreUICombatTextOverlay.h"
+#include "Utilities/GASCoreUITrace.h"
+
+static TAutoConsoleVariable<float> CVarGASCoreUICombatTextLifetime(
+	TEXT("GASCore.UI.CombatText.Lifetime"),
+	1.f,
+	TEXT("Seconds a floating combat text number stays on screen (fades over the last 40%)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreUICombatTextRiseSpeed(
+	TEXT("GASCore.UI.CombatText.RiseSpeed"),
+	80.f,
+	TEXT("World units per second a combat text number rises from its spawn location."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreUICombatTextJitter(
+	TEXT("GASCore.UI.CombatText.Jitter"),
+	25.f,
+	TEXT("Random horizontal spawn offset (world units) so simultaneous hits on one target do not stack exactly."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGASCoreUICombatTextMaxEntries(
+	TEXT("GASCore.UI.CombatText.MaxEntries"),
+	256,
+	TEXT("Maximum live combat text numbers; at the cap a new number replaces the oldest one."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGASCoreUICombatTextFontSize(
+	TEXT("GASCore.UI.CombatText.FontSize"),
+	20,
+	TEXT("Font size of combat text numbers (the digit glyph cache is rebuilt when this changes)."),
+	ECVF_Default);
+
+UGASCoreUICombatTextSubsystem* UGASCoreUICombatTextSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreUICombatTextSubsystem>() : nullptr;
+}
+
+void UGASCoreUICombatTextSubsystem::RegisterCombatTextCue(const FGameplayTag CueTag, const FLinearColor Color)
+{
+	if (CueTag.IsValid())
+	{
+		CueColors.Add(CueTag, Color);
+	}
+}
+
+void UGASCoreUICombatTextSubsystem::UnregisterCombatTextCue(const FGameplayTag CueTag)
+{
+	CueColors.Remove(CueTag);
+}
+
+void UGASCoreUICombatTextSubsystem::AddCombatText(const FVector WorldLocation, const float Value, const FLinearColor Color)
+{
+	GASCOREUI_BROADCAST_SCOPE(UGASCoreUICombatTextSubsystem::AddCombatText);
+	if (IsRunningDedicatedServer() || !FSlateApplication::IsInitialized())
+	{
+		return;
+	}
+
+	BuildGlyphCache();
+
+	// At the cap, reuse the oldest number's slot (arrays are swap-removed, so find it by age).
+	int32 Index = INDEX_NONE;
+	const int32 MaxEntries = FMath::Max(1, CVarGASCoreUICombatTextMaxEntries.GetValueOnGameThread());
+	if (WorldLocations.Num() >= MaxEntries)
+	{
+		Index = 0;
+		for (int32 Candidate = 1; Candidate < Ages.Num(); ++Candidate)
+		{
+			Index = Ages[Candidate] > Ages[Index] ? Candidate : Index;
+		}
+	}
+	else
+	{
+		Index = WorldLocations.AddUninitialized();
+		Texts.AddDefaulted();
+		TextWidths.AddUninitialized();
+		Colors.AddUninitialized();
+		Ages.AddUninitialized();
+		ScreenPositions.AddZeroed();
+		OnScreen.Add(false);
+	}
+
+	const float Jitter = CVarGASCoreUICombatTextJitter.GetValueOnGameThread();
+	WorldLocations[Index] = WorldLocation + FVector(FMath::FRandRange(-Jitter, Jitter), FMath::FRandRange(-Jitter, Jitter), 0.f);
+	Colors[Index] = Color;
+	Ages[Index] = 0.f;
+	OnScreen[Index] = false;
+
+	// Preformat once; the width comes from the cached digit advances. Clamped so huge values cannot overflow int32.
+	const int32 Number = FMath::RoundToInt32(FMath::Min<double>(FMath::Abs(Value), MAX_int32));
+	FString& Text = Texts[Index];
+	Text = FString::FromInt(Number);
+
+	float Width = 0.f;
+	for (const TCHAR Digit : Text)
+	{
+		Width += DigitWidths[Digit - TEXT('0')];
+	}
+	TextWidths[Index] = Width;
+
+	EnsureOverlay();
+}
+
+void UGASCoreUICombatTextSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (!IsRunningDedicatedServer())
+	{
+		CueBurstHandle = AGASCoreGameplayCueBurstActor::OnCueBurstExecuted.AddUObject(this, &UGASCoreUICombatTextSubsystem::HandleCueBurst);
+	}
+}
+
+void UGASCoreUICombatTextSubsystem::Deinitialize()
+{
+	AGASCoreGameplayCueBurstActor::OnCueBurstExecuted.Remove(CueBurstHandle);
+	CueBurstHandle.Reset();
+
+	RemoveOverlay();
+
+	CueColors.Reset();
+	WorldLocations.Reset();
+	Texts.Reset();
+	TextWidths.Reset();
+	Colors.Reset();
+	Ages.Reset();
+	ScreenPositions.Reset();
+	OnScreen.Reset();
+
+	Super::Deinitialize();
+}
+
+void UGASCoreUICombatTextSubsystem::Tick(const float DeltaTime)
+{
+	GASCOREUI_BROADCAST_SCOPE(UGASCoreUICombatTextSubsystem::Tick);
+
+	Lifetime = FMath::Max(CVarGASCoreUICombatTextLifetime.GetValueOnGameThread(), UE_KINDA_SMALL_NUMBER);
+
+	for (int32 Index = WorldLocations.Num() - 1; Index >= 0; --Index)
+	{
+		Ages[Index] += DeltaTime;
+		if (Ages[Index] >= Lifetime)
+		{
+			RemoveEntry(Index);
+		}
+	}
+
+	ProjectEntries();
+}
+
+TStatId UGASCoreUICombatTextSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGASCoreUICombatTextSubsystem, STATGROUP_Tickables);
+}
+
+void UGASCoreUICombatTextSubsystem::HandleCueBurst(const UWorld* BurstWorld, const TConstArrayView<FGASCoreBatchedCue> Cues)
+{
+	GASCOREUI_BROADCAST_SCOPE(UGASCoreUICombatTextSubsystem::HandleCueBurst);
+	// The delegate is global (PIE runs several worlds); only numbers of this world.
+	if (BurstWorld != GetWorld() || CueColors.IsEmpty())
+	{
+		return;
+	}
+
+	for (const FGASCoreBatchedCue& Cue : Cues)
+	{
+		if (const FLinearColor* Color = CueColors.Find(Cue.CueTag))
+		{
+			AddCombatText(Cue.Location, Cue.Magnitude, *Color);
+		}
+	}
+}
+
+void UGASCoreUICombatTextSubsystem::ProjectEntries()
+{
+	const UWorld* World = GetWorld();
+	const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+	const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+	FViewport* Viewport = LocalPlayer && LocalPlayer->ViewportClient ? LocalPlayer->ViewportClient->Viewport : nullptr;
+
+	FSceneViewProjectionData ProjectionData;
+	if (!Viewport || !LocalPlayer->GetProjectionData(Viewport, ProjectionData))
+	{
+		ProjectedViewportSize = FVector2f::ZeroVector;
+		return;
+	}
+
+	// One matrix for the whole batch.
+	const FMatrix ViewProjection = ProjectionData.ComputeViewProjectionMatrix();
+	const FIntRect ViewRect = ProjectionData.GetConstrainedViewRect();
+	const FIntPoint ViewportSize = Viewport->GetSizeXY();
+	ProjectedViewportSize = FVector2f(ViewportSize.X, ViewportSize.Y);
+
+	const float RiseSpeed = CVarGASCoreUICombatTextRiseSpeed.GetValueOnGameThread();
+	for (int32 Index = 0; Index < WorldLocations.Num(); ++Index)
+	{
+		const FVector Location = WorldLocations[Index] + FVector(0.f, 0.f, Ages[Index] * RiseSpeed);
+
+		FVector2D ScreenPosition;
+		OnScreen[Index] = FSceneView::ProjectWorldToScreen(Location, ViewRect, ViewProjection, ScreenPosition);
+		ScreenPositions[Index] = FVector2f(ScreenPosition);
+	}
+}
+
+void UGASCoreUICombatTextSubsystem::RemoveEntry(const int32 Index)
+{
+	WorldLocations.RemoveAtSwap(Index, EAllowShrinking::No);
+	Texts.RemoveAtSwap(Index, EAllowShrinking::No);
+	TextWidths.RemoveAtSwap(Index, EAllowShrinking::No);
+	Colors.RemoveAtSwap(Index, EAllowShrinking::No);
+	Ages.RemoveAtSwap(Index, EAllowShrinking::No);
+	ScreenPositions.RemoveAtSwap(Index, EAllowShrinking::No);
+	OnScreen.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void UGASCoreUICombatTextSubsystem::BuildGlyphCache()
+{
+	const int32 FontSize = FMath::Max(1, CVarGASCoreUICombatTextFontSize.GetValueOnGameThread());
+	if (FontSize == CachedFontSize)
+	{
+		return;
+	}
+
+	CachedFontSize = FontSize;
+	Font = FCoreStyle::GetDefaultFontStyle("Bold", FontSize);
+	Font.OutlineSettings.OutlineSize = 1;
+
+	// Numbers only ever contain digits, so ten measurements cover every width.
+	const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	for (int32 Digit = 0; Digit < 10; ++Digit)
+	{
+		const TCHAR Glyph[2] = { static_cast<TCHAR>(TEXT('0') + Digit), TEXT('\0') };
+		DigitWidths[Digit] = FontMeasure->Measure(Glyph, Font).X;
+	}
+	GlyphHeight = FontMeasure->GetMaxCharacterHeight(Font);
+}
+
+void UGASCoreUICombatTextSubsystem::EnsureOverlay()
+{
+	if (Overlay.IsValid() && OverlayViewportClient.IsValid())
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+	const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+	UGameViewportClient* ViewportClient = LocalPlayer ? LocalPlayer->ViewportClient.Get() : nullptr;
+	if (!ViewportClient)
+	{
+		return;
+	}
+
+	// Above gameplay HUD widgets so numbers read over health bars.
+	Overlay = SNew(SGASCoreUICombatTextOverlay, this);
+	ViewportClient->AddViewportWidgetContent(Overlay.ToSharedRef(), 10);
+	OverlayViewportClient = ViewportClient;
+}
+
+void UGASCoreUICombatTextSubsystem::RemoveOverlay()
+{
+	if (UGameViewportClient* ViewportClient = OverlayViewportClient.Get())
+	{
+		if (Overlay.IsValid())
+		{
+			ViewportClient->RemoveViewportWidgetContent(Overlay.ToSharedRef());
+		}
+	}
+	Overlay.Reset();
+	OverlayViewportClient.Reset();
+}
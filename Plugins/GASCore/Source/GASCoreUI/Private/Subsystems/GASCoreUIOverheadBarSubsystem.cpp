@@ -0,0 +1,265 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreUIOverheadBarSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "SceneView.h"
+#include "UI/WidgetControllers/GASCoreUIOverheadBarController.h"
+#include "UI/Widgets/SGASCoreUIOverheadBarOverlay.h"
+#include "Utilities/GASCoreUITrace.h"
+
+static TAutoConsoleVariable<float> CVarGASCoreUIOverheadBarMaxDistance(
+	TEXT("GASCore.UI.OverheadBar.MaxDistance"),
+	3000.f,
+	TEXT("On-screen actors within this distance of the view get an overhead bar."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreUIOverheadBarRecentDamageSeconds(
+	TEXT("GASCore.UI.OverheadBar.RecentDamageSeconds"),
+	3.f,
+	TEXT("On-screen actors damaged within this many seconds get an overhead bar regardless of distance."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGASCoreUIOverheadBarMaxBars(
+	TEXT("GASCore.UI.OverheadBar.MaxBars"),
+	64,
+	TEXT("Maximum overhead bars allocated at once; further candidates wait until a bar is released."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreUIOverheadBarScreenMargin(
+	TEXT("GASCore.UI.OverheadBar.ScreenMargin"),
+	40.f,
+	TEXT("Pixels outside the view rect that still count as on screen (avoids bar churn at the edges)."),
+	ECVF_Default);
+
+UGASCoreUIOverheadBarSubsystem* UGASCoreUIOverheadBarSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreUIOverheadBarSubsystem>() : nullptr;
+}
+
+void UGASCoreUIOverheadBarSubsystem::RegisterActor(AActor* Actor, UAbilitySystemComponent* ASC, const FGameplayAttribute& CurrentAttribute,
+	const FGameplayAttribute& MaxAttribute, const float HeightOffset, const FLinearColor& FillColor)
+{
+	if (IsRunningDedicatedServer() || !Actor || !ASC || !CurrentAttribute.IsValid() || !MaxAttribute.IsValid()
+		|| IndexByActor.Contains(Actor))
+	{
+		return;
+	}
+
+	const TObjectKey<AActor> ActorKey(Actor);
+	IndexByActor.Add(ActorKey, Actors.Num());
+	Actors.Add(Actor);
+	ActorKeys.Add(ActorKey);
+	AbilitySystemComponents.Add(ASC);
+	CurrentAttributes.Add(CurrentAttribute);
+	MaxAttributes.Add(MaxAttribute);
+	HeightOffsets.Add(HeightOffset);
+	FillColors.Add(FillColor);
+	LastDamageTimes.Add(-UE_BIG_NUMBER);
+	ScreenPositions.AddZeroed();
+	Bars.Add(nullptr);
+
+	// Always-on but native and tiny: only stamps the damage time. Values are read by allocated bars.
+	DamageListenerHandles.Add(ASC->GetGameplayAttributeValueChangeDelegate(CurrentAttribute).AddWeakLambda(this,
+		[this, ActorKey](const FOnAttributeChangeData& Data)
+		{
+			HandleCurrentChanged(ActorKey, Data.OldValue, Data.NewValue);
+		}));
+}
+
+void UGASCoreUIOverheadBarSubsystem::UnregisterActor(const AActor* Actor)
+{
+	if (const int32* Index = IndexByActor.Find(Actor))
+	{
+		RemoveAt(*Index);
+	}
+}
+
+void UGASCoreUIOverheadBarSubsystem::Deinitialize()
+{
+	for (int32 Index = Actors.Num() - 1; Index >= 0; --Index)
+	{
+		RemoveAt(Index);
+	}
+	FreeBars.Reset();
+
+	RemoveOverlay();
+
+	Super::Deinitialize();
+}
+
+void UGASCoreUIOverheadBarSubsystem::Tick(float DeltaTime)
+{
+	GASCOREUI_BROADCAST_SCOPE(UGASCoreUIOverheadBarSubsystem::Tick);
+
+	const UWorld* World = GetWorld();
+	const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+	const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+	FViewport* Viewport = LocalPlayer && LocalPlayer->ViewportClient ? LocalPlayer->ViewportClient->Viewport : nullptr;
+
+	FSceneViewProjectionData ProjectionData;
+	const bool bHasView = Viewport && LocalPlayer->GetProjectionData(Viewport, ProjectionData);
+
+	// One matrix for the whole batch.
+	const FMatrix ViewProjection = bHasView ? ProjectionData.ComputeViewProjectionMatrix() : FMatrix::Identity;
+	const FIntRect ViewRect = bHasView ? ProjectionData.GetConstrainedViewRect() : FIntRect();
+	const FIntPoint ViewportSize = bHasView ? Viewport->GetSizeXY() : FIntPoint::ZeroValue;
+	ProjectedViewportSize = FVector2f(ViewportSize.X, ViewportSize.Y);
+
+	const float Margin = CVarGASCoreUIOverheadBarScreenMargin.GetValueOnGameThread();
+	const FBox2D ScreenBounds(FVector2D(ViewRect.Min) - Margin, FVector2D(ViewRect.Max) + Margin);
+	const float MaxDistanceSq = FMath::Square(CVarGASCoreUIOverheadBarMaxDistance.GetValueOnGameThread());
+	const double RecentDamageSeconds = CVarGASCoreUIOverheadBarRecentDamageSeconds.GetValueOnGameThread();
+	const int32 MaxBars = CVarGASCoreUIOverheadBarMaxBars.GetValueOnGameThread();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	for (int32 Index = Actors.Num() - 1; Index >= 0; --Index)
+	{
+		const AActor* Actor = Actors[Index].Get();
+		if (!Actor || !AbilitySystemComponents[Index].IsValid())
+		{
+			RemoveAt(Index);
+			continue;
+		}
+
+		bool bWanted = false;
+		if (bHasView && !Actor->IsHidden())
+		{
+			const FVector Location = Actor->GetActorLocation() + FVector(0.f, 0.f, HeightOffsets[Index]);
+			FVector2D ScreenPosition;
+			if (FSceneView::ProjectWorldToScreen(Location, ViewRect, ViewProjection, ScreenPosition)
+				&& ScreenBounds.IsInside(ScreenPosition))
+			{
+				ScreenPositions[Index] = FVector2f(ScreenPosition);
+				bWanted = FVector::DistSquared(ProjectionData.ViewOrigin, Location) <= MaxDistanceSq
+					|| Now - LastDamageTimes[Index] <= RecentDamageSeconds;
+			}
+		}
+
+		if (bWanted && !Bars[Index] && NumBars < MaxBars)
+		{
+			AllocateBar(Index);
+		}
+		else if (!bWanted && Bars[Index])
+		{
+			ReleaseBar(Index);
+		}
+	}
+
+	if (NumBars > 0)
+	{
+		EnsureOverlay();
+	}
+}
+
+TStatId UGASCoreUIOverheadBarSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGASCoreUIOverheadBarSubsystem, STATGROUP_Tickables);
+}
+
+void UGASCoreUIOverheadBarSubsystem::HandleCurrentChanged(const TObjectKey<AActor> ActorKey, const float OldValue, const float NewValue)
+{
+	GASCOREUI_BROADCAST_SCOPE(UGASCoreUIOverheadBarSubsystem::HandleCurrentChanged);
+	if (NewValue >= OldValue)
+	{
+		return;
+	}
+
+	const int32* Index = IndexByActor.Find(ActorKey);
+	const UWorld* World = GetWorld();
+	if (Index && World)
+	{
+		LastDamageTimes[*Index] = World->GetTimeSeconds();
+	}
+}
+
+void UGASCoreUIOverheadBarSubsystem::RemoveAt(const int32 Index)
+{
+	ReleaseBar(Index);
+
+	if (UAbilitySystemComponent* ASC = AbilitySystemComponents[Index].Get())
+	{
+		ASC->GetGameplayAttributeValueChangeDelegate(CurrentAttributes[Index]).Remove(DamageListenerHandles[Index]);
+	}
+
+	IndexByActor.Remove(ActorKeys[Index]);
+	const int32 LastIndex = Actors.Num() - 1;
+	if (Index != LastIndex)
+	{
+		IndexByActor[ActorKeys[LastIndex]] = Index;
+	}
+
+	Actors.RemoveAtSwap(Index, EAllowShrinking::No);
+	ActorKeys.RemoveAtSwap(Index, EAllowShrinking::No);
+	AbilitySystemComponents.RemoveAtSwap(Index, EAllowShrinking::No);
+	CurrentAttributes.RemoveAtSwap(Index, EAllowShrinking::No);
+	MaxAttributes.RemoveAtSwap(Index, EAllowShrinking::No);
+	HeightOffsets.RemoveAtSwap(Index, EAllowShrinking::No);
+	FillColors.RemoveAtSwap(Index, EAllowShrinking::No);
+	LastDamageTimes.RemoveAtSwap(Index, EAllowShrinking::No);
+	DamageListenerHandles.RemoveAtSwap(Index, EAllowShrinking::No);
+	ScreenPositions.RemoveAtSwap(Index, EAllowShrinking::No);
+	Bars.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void UGASCoreUIOverheadBarSubsystem::AllocateBar(const int32 Index)
+{
+	UGASCoreUIOverheadBarController* Bar = !FreeBars.IsEmpty() ? FreeBars.Pop(EAllowShrinking::No).Get()
+		: NewObject<UGASCoreUIOverheadBarController>(this);
+
+	Bar->BindBar(AbilitySystemComponents[Index].Get(), CurrentAttributes[Index], MaxAttributes[Index]);
+	Bars[Index] = Bar;
+	++NumBars;
+}
+
+void UGASCoreUIOverheadBarSubsystem::ReleaseBar(const int32 Index)
+{
+	if (UGASCoreUIOverheadBarController* Bar = Bars[Index])
+	{
+		Bar->UnbindBar();
+		FreeBars.Add(Bar);
+		Bars[Index] = nullptr;
+		--NumBars;
+	}
+}
+
+void UGASCoreUIOverheadBarSubsystem::EnsureOverlay()
+{
+	if (Overlay.IsValid() && OverlayViewportClient.IsValid())
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+	const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+	UGameViewportClient* ViewportClient = LocalPlayer ? LocalPlayer->ViewportClient.Get() : nullptr;
+	if (!ViewportClient)
+	{
+		return;
+	}
+
+	// Below combat text (ZOrder 10) so damage numbers read over the bars.
+	Overlay = SNew(SGASCoreUIOverheadBarOverlay, this);
+	ViewportClient->AddViewportWidgetContent(Overlay.ToSharedRef(), 5);
+	OverlayViewportClient = ViewportClient;
+}
+
+void UGASCoreUIOverheadBarSubsystem::RemoveOverlay()
+{
+	if (UGameViewportClient* ViewportClient = OverlayViewportClient.Get())
+	{
+		if (Overlay.IsValid())
+		{
+			ViewportClient->RemoveViewportWidgetContent(Overlay.ToSharedRef());
+		}
+	}
+	Overlay.Reset();
+	OverlayViewportClient.Reset();
+}
@@ -0,0 +1,139 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/GASCoreUIWidgetPoolSubsystem.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "UI/Widgets/GASCoreUIUserWidget.h"
+
+static TAutoConsoleVariable<int32> CVarGASCoreUIWidgetPoolMaxPerClass(
+	TEXT("GASCore.UI.WidgetPool.MaxPerClass"),
+	8,
+	TEXT("Maximum pooled popup widgets per class; acquiring beyond this recycles the oldest live widget of the class."),
+	ECVF_Default);
+
+UGASCoreUIWidgetPoolSubsystem* UGASCoreUIWidgetPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGASCoreUIWidgetPoolSubsystem>() : nullptr;
+}
+
+UGASCoreUIUserWidget* UGASCoreUIWidgetPoolSubsystem::AcquireWidget(APlayerController* OwningPlayer,
+	const TSubclassOf<UGASCoreUIUserWidget> WidgetClass)
+{
+	if (!WidgetClass || !OwningPlayer)
+	{
+		return nullptr;
+	}
+
+	FGASCoreUIWidgetPool& Pool = Pools.FindOrAdd(WidgetClass.Get());
+
+	// Widgets destroyed externally (world cleanup, GC after a level change) drop out of the live list.
+	Pool.Active.RemoveAll([](const TObjectPtr<UGASCoreUIUserWidget>& Widget) { return !IsValid(Widget); });
+
+	// At the cap, recycle the oldest live widget instead of allocating.
+	const int32 MaxPerClass = FMath::Max(1, CVarGASCoreUIWidgetPoolMaxPerClass.GetValueOnGameThread());
+	if (Pool.Free.IsEmpty() && Pool.Active.Num() >= MaxPerClass)
+	{
+		UGASCoreUIUserWidget* Oldest = Pool.Active[0];
+		Pool.Active.RemoveAt(0, EAllowShrinking::No);
+		Deactivate(Pool, Oldest);
+	}
+
+	UGASCoreUIUserWidget* Widget = PopOrCreate(Pool, OwningPlayer, WidgetClass);
+	if (!Widget)
+	{
+		return nullptr;
+	}
+
+	Pool.Active.Add(Widget);
+	Widget->bActiveInPool = true;
+	Widget->NativeOnAcquiredFromPool();
+	return Widget;
+}
+
+void UGASCoreUIWidgetPoolSubsystem::ReleaseWidget(UGASCoreUIUserWidget* Widget)
+{
+	if (!IsValid(Widget) || !Widget->bActiveInPool)
+	{
+		return;
+	}
+
+	FGASCoreUIWidgetPool* Pool = Pools.Find(Widget->GetClass());
+	if (!Pool || Pool->Active.RemoveSingle(Widget) == 0)
+	{
+		return;
+	}
+
+	Deactivate(*Pool, Widget);
+}
+
+void UGASCoreUIWidgetPoolSubsystem::PrewarmWidgets(APlayerController* OwningPlayer,
+	const TSubclassOf<UGASCoreUIUserWidget> WidgetClass, const int32 Count)
+{
+	if (!WidgetClass || !OwningPlayer)
+	{
+		return;
+	}
+
+	FGASCoreUIWidgetPool& Pool = Pools.FindOrAdd(WidgetClass.Get());
+	const int32 Target = FMath::Min(Count, CVarGASCoreUIWidgetPoolMaxPerClass.GetValueOnGameThread());
+	while (Pool.Free.Num() + Pool.Active.Num() < Target)
+	{
+		UGASCoreUIUserWidget* Widget = CreateWidget<UGASCoreUIUserWidget>(OwningPlayer, WidgetClass);
+		if (!Widget)
+		{
+			return;
+		}
+		Widget->OwningPool = this;
+		Pool.Free.Add(Widget);
+	}
+}
+
+int32 UGASCoreUIWidgetPoolSubsystem::GetNumFree(const TSubclassOf<UGASCoreUIUserWidget> WidgetClass) const
+{
+	const FGASCoreUIWidgetPool* Pool = Pools.Find(WidgetClass.Get());
+	return Pool ? Pool->Free.Num() : 0;
+}
+
+void UGASCoreUIWidgetPoolSubsystem::Deinitialize()
+{
+	Pools.Reset();
+
+	Super::Deinitialize();
+}
+
+UGASCoreUIUserWidget* UGASCoreUIWidgetPoolSubsystem::PopOrCreate(FGASCoreUIWidgetPool& Pool, APlayerController* OwningPlayer,
+	const TSubclassOf<UGASCoreUIUserWidget> WidgetClass)
+{
+	while (!Pool.Free.IsEmpty())
+	{
+		UGASCoreUIUserWidget* Candidate = Pool.Free.Pop(EAllowShrinking::No);
+		if (IsValid(Candidate))
+		{
+			// Split-screen: a widget released by one local player can serve another.
+			if (Candidate->GetOwningPlayer() != OwningPlayer)
+			{
+				Candidate->SetOwningPlayer(OwningPlayer);
+			}
+			return Candidate;
+		}
+	}
+
+	UGASCoreUIUserWidget* Widget = CreateWidget<UGASCoreUIUserWidget>(OwningPlayer, WidgetClass);
+	if (Widget)
+	{
+		Widget->OwningPool = this;
+	}
+	return Widget;
+}
+
+void UGASCoreUIWidgetPoolSubsystem::Deactivate(FGASCoreUIWidgetPool& Pool, UGASCoreUIUserWidget* Widget)
+{
+	Widget->bActiveInPool = false;
+	Widget->RemoveFromParent();
+	Widget->NativeOnReleasedToPool();
+	Pool.Free.Add(Widget);
+}
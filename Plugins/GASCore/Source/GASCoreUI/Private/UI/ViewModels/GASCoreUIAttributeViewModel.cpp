@@ -0,0 +1,214 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "UI/ViewModels/GASCoreUIAttributeViewModel.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystem/Data/GASCoreAttributeInfoDataAsset.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Utilities/GASCoreEndOfFrame.h"
+#include "Utilities/GASCoreUITrace.h"
+
+void UGASCoreUIAttributeViewModel::FFieldNotificationClassDescriptor::ForEachField(const UClass* Class,
+	TFunctionRef<bool(::UE::FieldNotification::FFieldId FieldId)> Callback) const
+{
+	if (const UBlueprintGeneratedClass* BlueprintClass = Cast<const UBlueprintGeneratedClass>(Class))
+	{
+		BlueprintClass->ForEachFieldNotify(Callback, true);
+	}
+}
+
+void UGASCoreUIAttributeViewModel::BindToAbilitySystem(UAbilitySystemComponent* ASC, const UGASCoreAttributeInfoDataAsset* AttributeInfo)
+{
+	UnbindFromAbilitySystem();
+	if (!ASC || !AttributeInfo)
+	{
+		return;
+	}
+
+	// Field name -> id, for every native and Blueprint field of this class.
+	TMap<FName, UE::FieldNotification::FFieldId> FieldsByName;
+	GetFieldNotificationDescriptor().ForEachField(GetClass(), [&FieldsByName](const UE::FieldNotification::FFieldId FieldId)
+	{
+		FieldsByName.Add(FieldId.GetName(), FieldId);
+		return true;
+	});
+
+	BoundAbilitySystemComponent = ASC;
+	for (const FGASCoreAttributeInformation& Row : AttributeInfo->GetAttributeInformation())
+	{
+		const FName FieldName(Row.AttributeGetter.GetName());
+		const UE::FieldNotification::FFieldId* FieldId = FieldsByName.Find(FieldName);
+		FProperty* Property = FieldId ? FindFProperty<FProperty>(GetClass(), FieldName) : nullptr;
+		if (!Property || !(Property->IsA<FFloatProperty>() || Property->IsA<FDoubleProperty>()))
+		{
+			continue;
+		}
+
+		const int32 Index = BoundFields.AddDefaulted();
+		FBoundField& Field = BoundFields[Index];
+		Field.Attribute = Row.AttributeGetter;
+		Field.FieldId = *FieldId;
+		Field.Property = Property;
+		Field.Handle = ASC->GetGameplayAttributeValueChangeDelegate(Field.Attribute).AddWeakLambda(this,
+			[this, Index](const FOnAttributeChangeData& Data)
+			{
+				if (!BoundFields.IsValidIndex(Index))
+				{
+					return;
+				}
+
+				BoundFields[Index].PendingValue = Data.NewValue;
+				BoundFields[Index].bDirty = true;
+				if (!bFlushScheduled)
+				{
+					bFlushScheduled = true;
+					GASCoreEndOfFrame::Schedule(this, [](UObject* Object)
+					{
+						CastChecked<UGASCoreUIAttributeViewModel>(Object)->FlushDirtyFields();
+					});
+				}
+			});
+
+		// Initial value right away, so bindings made before the first change show real data.
+		if (WriteField(Field, ASC->GetNumericAttribute(Field.Attribute)))
+		{
+			BroadcastFieldValueChanged(Field.FieldId);
+		}
+	}
+}
+
+void UGASCoreUIAttributeViewModel::UnbindFromAbilitySystem()
+{
+	if (UAbilitySystemComponent* ASC = BoundAbilitySystemComponent.Get())
+	{
+		for (const FBoundField& Field : BoundFields)
+		{
+			ASC->GetGameplayAttributeValueChangeDelegate(Field.Attribute).Remove(Field.Handle);
+		}
+	}
+
+	// A scheduled flush still runs but finds nothing dirty.
+	BoundFields.Reset();
+	BoundAbilitySystemComponent.Reset();
+}
+
+FDelegateHandle UGASCoreUIAttributeViewModel::AddFieldValueChangedDelegate(UE::FieldNotification::FFieldId InFieldId,
+	FFieldValueChangedDelegate InNewDelegate)
+{
+	FDelegateHandle Result;
+	if (InFieldId.IsValid())
+	{
+		Result = Delegates.Add(this, InFieldId, MoveTemp(InNewDelegate));
+		if (Result.IsValid())
+		{
+			EnabledFieldNotifications.PadToNum(InFieldId.GetIndex() + 1, false);
+			EnabledFieldNotifications[InFieldId.GetIndex()] = true;
+		}
+	}
+	return Result;
+}
+
+bool UGASCoreUIAttributeViewModel::RemoveFieldValueChangedDelegate(UE::FieldNotification::FFieldId InFieldId, FDelegateHandle InHandle)
+{
+	if (!InFieldId.IsValid() || !InHandle.IsValid() || !EnabledFieldNotifications.IsValidIndex(InFieldId.GetIndex())
+		|| !EnabledFieldNotifications[InFieldId.GetIndex()])
+	{
+		return false;
+	}
+
+	const UE::FieldNotification::FFieldMulticastDelegate::FRemoveFromResult RemoveResult = Delegates.RemoveFrom(this, InFieldId, InHandle);
+	EnabledFieldNotifications[InFieldId.GetIndex()] = RemoveResult.bHasOtherBoundDelegates;
+	return RemoveResult.bRemoved;
+}
+
+int32 UGASCoreUIAttributeViewModel::RemoveAllFieldValueChangedDelegates(FDelegateUserObjectConst InUserObject)
+{
+	if (!InUserObject)
+	{
+		return 0;
+	}
+
+	const UE::FieldNotification::FFieldMulticastDelegate::FRemoveAllResult RemoveResult = Delegates.RemoveAll(this, InUserObject);
+	EnabledFieldNotifications = RemoveResult.HasFields;
+	return RemoveResult.RemoveCount;
+}
+
+int32 UGASCoreUIAttributeViewModel::RemoveAllFieldValueChangedDelegates(UE::FieldNotification::FFieldId InFieldId,
+	FDelegateUserObjectConst InUserObject)
+{
+	if (!InUserObject)
+	{
+		return 0;
+	}
+
+	const UE::FieldNotification::FFieldMulticastDelegate::FRemoveAllResult RemoveResult = Delegates.RemoveAll(this, InFieldId, InUserObject);
+	EnabledFieldNotifications = RemoveResult.HasFields;
+	return RemoveResult.RemoveCount;
+}
+
+const UE::FieldNotification::IClassDescriptor& UGASCoreUIAttributeViewModel::GetFieldNotificationDescriptor() const
+{
+	static FFieldNotificationClassDescriptor Instance;
+	return Instance;
+}
+
+void UGASCoreUIAttributeViewModel::BroadcastFieldValueChanged(UE::FieldNotification::FFieldId InFieldId)
+{
+	// Unbound fields cost nothing beyond the property write.
+	if (InFieldId.IsValid() && EnabledFieldNotifications.IsValidIndex(InFieldId.GetIndex()) && EnabledFieldNotifications[InFieldId.GetIndex()])
+	{
+		Delegates.Broadcast(this, InFieldId);
+	}
+}
+
+void UGASCoreUIAttributeViewModel::BeginDestroy()
+{
+	UnbindFromAbilitySystem();
+
+	Super::BeginDestroy();
+}
+
+bool UGASCoreUIAttributeViewModel::WriteField(const FBoundField& Field, const float Value)
+{
+	if (const FFloatProperty* FloatProperty = CastField<FFloatProperty>(Field.Property))
+	{
+		float* ValuePtr = FloatProperty->ContainerPtrToValuePtr<float>(this);
+		if (*ValuePtr == Value)
+		{
+			return false;
+		}
+		*ValuePtr = Value;
+		return true;
+	}
+
+	if (const FDoubleProperty* DoubleProperty = CastField<FDoubleProperty>(Field.Property))
+	{
+		double* ValuePtr = DoubleProperty->ContainerPtrToValuePtr<double>(this);
+		if (*ValuePtr == Value)
+		{
+			return false;
+		}
+		*ValuePtr = Value;
+		return true;
+	}
+	return false;
+}
+
+void UGASCoreUIAttributeViewModel::FlushDirtyFields()
+{
+	GASCOREUI_BROADCAST_SCOPE(UGASCoreUIAttributeViewModel::FlushDirtyFields);
+	bFlushScheduled = false;
+
+	for (int32 Index = 0; Index < BoundFields.Num(); ++Index)
+	{
+		FBoundField& Field = BoundFields[Index];
+		if (Field.bDirty)
+		{
+			Field.bDirty = false;
+			if (WriteField(Field, Field.PendingValue))
+			{
+				BroadcastFieldValueChanged(Field.FieldId);
+			}
+		}
+	}
+}
@@ -0,0 +1,32 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "UI/WidgetControllers/GASCoreUIOverheadBarController.h"
+
+#include "AbilitySystemComponent.h"
+
+void UGASCoreUIOverheadBarController::BindBar(UAbilitySystemComponent* ASC, const FGameplayAttribute& CurrentAttribute,
+	const FGameplayAttribute& MaxAttribute)
+{
+	UnbindBar();
+	if (!ASC)
+	{
+		return;
+	}
+
+	SetWidgetControllerParams(FGASCoreUIWidgetControllerParams(nullptr, nullptr, ASC, nullptr));
+
+	// A freshly allocated bar shows the right values immediately; changes then arrive coalesced.
+	CurrentValue = ASC->GetNumericAttribute(CurrentAttribute);
+	MaxValue = ASC->GetNumericAttribute(MaxAttribute);
+
+	BindCoalescedAttribute(CurrentAttribute, [this](const float NewValue) { CurrentValue = NewValue; });
+	BindCoalescedAttribute(MaxAttribute, [this](const float NewValue) { MaxValue = NewValue; });
+}
+
+void UGASCoreUIOverheadBarController::UnbindBar()
+{
+	UnbindCoalescedAttributes();
+	SetWidgetControllerParams(FGASCoreUIWidgetControllerParams());
+	CurrentValue = 0.f;
+	MaxValue = 0.f;
+}
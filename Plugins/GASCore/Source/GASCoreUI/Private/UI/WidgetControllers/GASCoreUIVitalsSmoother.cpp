@@ -0,0 +1,161 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "UI/WidgetControllers/GASCoreUIVitalsSmoother.h"
+
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "Utilities/GASCoreUITrace.h"
+
+static TAutoConsoleVariable<float> CVarGASCoreUIVitalsRefreshRate(
+	TEXT("GASCore.UI.VitalsSmoothing.RefreshRate"),
+	30.f,
+	TEXT("Hz at which smoothed vitals step and publish. <= 0 disables smoothing (targets publish immediately)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreUIVitalsInterpSpeed(
+	TEXT("GASCore.UI.VitalsSmoothing.InterpSpeed"),
+	10.f,
+	TEXT("FInterpTo speed used to move displayed vitals toward their targets."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreUIVitalsMinStep(
+	TEXT("GASCore.UI.VitalsSmoothing.MinStep"),
+	0.5f,
+	TEXT("Smallest change in displayed value (attribute units) that is published to widgets."),
+	ECVF_Default);
+
+int32 UGASCoreUIVitalsSmoother::AddChannel(TFunction<void(float)> Publish)
+{
+	FChannel& Channel = Channels.AddDefaulted_GetRef();
+	Channel.Publish = MoveTemp(Publish);
+	return Channels.Num() - 1;
+}
+
+void UGASCoreUIVitalsSmoother::SetTarget(const int32 ChannelIndex, const float Target, const bool bSnap)
+{
+	if (!Channels.IsValidIndex(ChannelIndex))
+	{
+		return;
+	}
+
+	FChannel& Channel = Channels[ChannelIndex];
+	Channel.Target = Target;
+
+	if (bSnap || !Channel.bHasTarget || CVarGASCoreUIVitalsRefreshRate.GetValueOnGameThread() <= 0.f)
+	{
+		Channel.bHasTarget = true;
+		Channel.Displayed = Target;
+		Channel.Published = Target;
+		if (Channel.Publish)
+		{
+			Channel.Publish(Target);
+		}
+		return;
+	}
+
+	if (Channel.Displayed != Target)
+	{
+		StartTimer();
+	}
+}
+
+void UGASCoreUIVitalsSmoother::SetTargetSource(const int32 ChannelIndex, TFunction<float()> Source)
+{
+	if (Channels.IsValidIndex(ChannelIndex))
+	{
+		Channels[ChannelIndex].Source = MoveTemp(Source);
+	}
+}
+
+void UGASCoreUIVitalsSmoother::Reset()
+{
+	StopTimer();
+	Channels.Reset();
+}
+
+void UGASCoreUIVitalsSmoother::BeginDestroy()
+{
+	Reset();
+
+	Super::BeginDestroy();
+}
+
+void UGASCoreUIVitalsSmoother::Step()
+{
+	GASCOREUI_BROADCAST_SCOPE(UGASCoreUIVitalsSmoother::Step);
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		StopTimer();
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	const float DeltaTime = static_cast<float>(FMath::Clamp(Now - LastStepTime, 0.0, 0.25));
+	LastStepTime = Now;
+
+	const float InterpSpeed = CVarGASCoreUIVitalsInterpSpeed.GetValueOnGameThread();
+	const float MinStep = FMath::Max(0.f, CVarGASCoreUIVitalsMinStep.GetValueOnGameThread());
+
+	bool bAnyMoving = false;
+	for (FChannel& Channel : Channels)
+	{
+		// A source still changing (a regenerating vital) keeps the timer alive even if the display caught up.
+		if (Channel.Source && Channel.bHasTarget)
+		{
+			const float PreviousTarget = Channel.Target;
+			Channel.Target = Channel.Source();
+			bAnyMoving |= Channel.Target != PreviousTarget;
+		}
+
+		if (Channel.Displayed == Channel.Target)
+		{
+			continue;
+		}
+
+		// FInterpTo converges asymptotically; finish once the remainder would not be visible anyway.
+		Channel.Displayed = FMath::FInterpTo(Channel.Displayed, Channel.Target, DeltaTime, InterpSpeed);
+		if (FMath::Abs(Channel.Target - Channel.Displayed) < MinStep)
+		{
+			Channel.Displayed = Channel.Target;
+		}
+		bAnyMoving |= Channel.Displayed != Channel.Target;
+
+		const bool bSettled = Channel.Displayed == Channel.Target;
+		if ((bSettled && Channel.Published != Channel.Target) || FMath::Abs(Channel.Displayed - Channel.Published) >= MinStep)
+		{
+			Channel.Published = Channel.Displayed;
+			if (Channel.Publish)
+			{
+				Channel.Publish(Channel.Displayed);
+			}
+		}
+	}
+
+	if (!bAnyMoving)
+	{
+		StopTimer();
+	}
+}
+
+void UGASCoreUIVitalsSmoother::StartTimer()
+{
+	UWorld* World = GetWorld();
+	if (!World || World->GetTimerManager().IsTimerActive(StepTimerHandle))
+	{
+		return;
+	}
+
+	LastStepTime = World->GetTimeSeconds();
+	const float Interval = 1.f / FMath::Max(1.f, CVarGASCoreUIVitalsRefreshRate.GetValueOnGameThread());
+	World->GetTimerManager().SetTimer(StepTimerHandle, FTimerDelegate::CreateUObject(this, &UGASCoreUIVitalsSmoother::Step), Interval, true);
+}
+
+void UGASCoreUIVitalsSmoother::StopTimer()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(StepTimerHandle);
+	}
+	StepTimerHandle.Invalidate();
+}
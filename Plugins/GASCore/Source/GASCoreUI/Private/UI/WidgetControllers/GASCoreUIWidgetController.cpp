@@ -46,6 +46,23 @@
 
 #include "GASCoreUI/Public/UI/WidgetControllers/GASCoreUIWidgetController.h"
 
+#include "AbilitySystemComponent.h"
+#include "Misc/App.h"
+#include "Utilities/GASCoreEndOfFrame.h"
+#include "Utilities/GASCoreUITrace.h"
+
+static TAutoConsoleVariable<bool> CVarGASCoreUICoalesceAttributeUpdates(
+	TEXT("GASCore.UI.CoalesceAttributeUpdates"),
+	true,
+	TEXT("If true, coalesced widget controller attributes broadcast once per flush with the latest value. If false, every change broadcasts immediately."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreUIAttributeFlushInterval(
+	TEXT("GASCore.UI.AttributeFlushInterval"),
+	0.f,
+	TEXT("Minimum seconds between coalesced attribute flushes per widget controller. 0 = once per frame."),
+	ECVF_Default);
+
 void UGASCoreUIWidgetController::SetWidgetControllerParams(const FGASCoreUIWidgetControllerParams& InWidgetControllerParams)
 {
 	// DEPENDENCY INJECTION: Assign all gameplay system references at once
@@ -125,4 +142,108 @@ void UGASCoreUIWidgetController::BindCallbacksToDependencies()
 	//   {
 	//       CoreASC->OnEffectAssetTags.AddLambda([this](const FGameplayTagContainer& Tags) { ... });
 	//   }
-}
\ No newline at end of file
+}
+
+void UGASCoreUIWidgetController::BindCoalescedAttribute(const FGameplayAttribute& Attribute, TFunction<void(float)> Broadcast)
+{
+	if (!AbilitySystemComponent || !Attribute.IsValid() || !Broadcast)
+	{
+		return;
+	}
+
+	// All coalesced handles live on one ASC so UnbindCoalescedAttributes can remove them in one place.
+	if (CoalescedAbilitySystemComponent.IsValid() && CoalescedAbilitySystemComponent.Get() != AbilitySystemComponent)
+	{
+		UnbindCoalescedAttributes();
+	}
+	CoalescedAbilitySystemComponent = AbilitySystemComponent;
+
+	const int32 Index = CoalescedAttributes.AddDefaulted();
+	FCoalescedAttribute& Entry = CoalescedAttributes[Index];
+	Entry.Attribute = Attribute;
+	Entry.Broadcast = MoveTemp(Broadcast);
+	Entry.Handle = AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute).AddWeakLambda(this,
+		[this, Index](const FOnAttributeChangeData& Data)
+		{
+			MarkAttributeDirty(Index, Data.NewValue);
+		});
+}
+
+void UGASCoreUIWidgetController::UnbindCoalescedAttributes()
+{
+	if (UAbilitySystemComponent* ASC = CoalescedAbilitySystemComponent.Get())
+	{
+		for (const FCoalescedAttribute& Entry : CoalescedAttributes)
+		{
+			ASC->GetGameplayAttributeValueChangeDelegate(Entry.Attribute).Remove(Entry.Handle);
+		}
+	}
+
+	// A scheduled flush still runs but finds nothing dirty.
+	CoalescedAttributes.Reset();
+	CoalescedAbilitySystemComponent.Reset();
+}
+
+void UGASCoreUIWidgetController::MarkAttributeDirty(int32 Index, float NewValue)
+{
+	GASCOREUI_BROADCAST_SCOPE(UGASCoreUIWidgetController::MarkAttributeDirty);
+	if (!CoalescedAttributes.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	FCoalescedAttribute& Entry = CoalescedAttributes[Index];
+	if (!CVarGASCoreUICoalesceAttributeUpdates.GetValueOnGameThread())
+	{
+		Entry.bDirty = false;
+		Entry.Broadcast(NewValue);
+		return;
+	}
+
+	Entry.PendingValue = NewValue;
+	Entry.bDirty = true;
+	ScheduleFlush();
+}
+
+void UGASCoreUIWidgetController::ScheduleFlush()
+{
+	if (bAttributeFlushScheduled)
+	{
+		return;
+	}
+
+	bAttributeFlushScheduled = true;
+	GASCoreEndOfFrame::Schedule(this, [](UObject* Object)
+	{
+		UGASCoreUIWidgetController* Controller = CastChecked<UGASCoreUIWidgetController>(Object);
+		Controller->bAttributeFlushScheduled = false;
+
+		// Rate-limited: try again next frame until the interval has elapsed; values keep coalescing meanwhile.
+		const float Interval = CVarGASCoreUIAttributeFlushInterval.GetValueOnGameThread();
+		if (Interval > 0.f && FApp::GetCurrentTime() - Controller->LastAttributeFlushTime < Interval)
+		{
+			Controller->ScheduleFlush();
+			return;
+		}
+
+		Controller->FlushDirtyAttributes();
+	});
+}
+
+void UGASCoreUIWidgetController::FlushDirtyAttributes()
+{
+	GASCOREUI_BROADCAST_SCOPE(UGASCoreUIWidgetController::FlushDirtyAttributes);
+	LastAttributeFlushTime = FApp::GetCurrentTime();
+
+	// Index loop: a Blueprint handler may unbind (shrinking the array) mid-flush.
+	for (int32 Index = 0; Index < CoalescedAttributes.Num(); ++Index)
+	{
+		FCoalescedAttribute& Entry = CoalescedAttributes[Index];
+		if (Entry.bDirty)
+		{
+			Entry.bDirty = false;
+			const TFunction<void(float)> Broadcast = Entry.Broadcast;
+			Broadcast(Entry.PendingValue);
+		}
+	}
+}
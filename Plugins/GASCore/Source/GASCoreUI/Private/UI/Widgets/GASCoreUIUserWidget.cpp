@@ -46,6 +46,8 @@
 
 #include "GASCoreUI/Public/UI/Widgets/GASCoreUIUserWidget.h"
 
+#include "Subsystems/GASCoreUIWidgetPoolSubsystem.h"
+
 void UGASCoreUIUserWidget::SetWidgetController(UObject* InWidgetController)
 {
 	// CONTROLLER REFERENCE HANDOFF:
@@ -61,4 +63,22 @@ void UGASCoreUIUserWidget::SetWidgetController(UObject* InWidgetController)
 	// Blueprint implementers should ensure their binding logic is idempotent or
 	// guards against duplicate bindings if this is called multiple times.
 	OnWidgetControllerSet();
-}
\ No newline at end of file
+}
+
+void UGASCoreUIUserWidget::ReleaseToPool()
+{
+	if (UGASCoreUIWidgetPoolSubsystem* Pool = OwningPool.Get())
+	{
+		Pool->ReleaseWidget(this);
+	}
+}
+
+void UGASCoreUIUserWidget::NativeOnAcquiredFromPool()
+{
+	OnAcquiredFromPool();
+}
+
+void UGASCoreUIUserWidget::NativeOnReleasedToPool()
+{
+	OnReleasedToPool();
+}
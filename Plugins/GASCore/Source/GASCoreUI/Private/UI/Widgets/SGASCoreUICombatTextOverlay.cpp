@@ -0,0 +1,57 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "UI/Widgets/SGASCoreUICombatTextOverlay.h"
+
+#include "Rendering/DrawElements.h"
+#include "Subsystems/GASCoreUICombatTextSubsystem.h"
+#include "Utilities/GASCoreUITrace.h"
+
+void SGASCoreUICombatTextOverlay::Construct(const FArguments& InArgs, UGASCoreUICombatTextSubsystem* InSubsystem)
+{
+	Subsystem = InSubsystem;
+	SetVisibility(EVisibility::HitTestInvisible);
+	SetCanTick(false);
+	ForceVolatile(true);
+}
+
+int32 SGASCoreUICombatTextOverlay::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const UGASCoreUICombatTextSubsystem* Text = Subsystem.Get();
+	if (!Text || Text->ProjectedViewportSize.X <= 0.f || Text->ProjectedViewportSize.Y <= 0.f)
+	{
+		return LayerId;
+	}
+
+	GASCOREUI_TRACE_SCOPE(SGASCoreUICombatTextOverlay::OnPaint);
+
+	// Projected positions are viewport pixels; the overlay fills the viewport in Slate units (DPI scaled).
+	const FVector2f PixelToLocal = FVector2f(AllottedGeometry.GetLocalSize()) / Text->ProjectedViewportSize;
+	const float Lifetime = Text->Lifetime;
+	const float FadeStart = Lifetime * 0.6f;
+
+	const int32 Num = Text->WorldLocations.Num();
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		if (!Text->OnScreen[Index])
+		{
+			continue;
+		}
+
+		// Fade out over the last 40% of the lifetime.
+		const float Age = Text->Ages[Index];
+		const float Alpha = Age <= FadeStart ? 1.f : 1.f - (Age - FadeStart) / (Lifetime - FadeStart);
+
+		FLinearColor Color = Text->Colors[Index];
+		Color.A *= Alpha * InWidgetStyle.GetColorAndOpacityTint().A;
+
+		const FVector2f Size(Text->TextWidths[Index], Text->GlyphHeight);
+		const FVector2f Position = Text->ScreenPositions[Index] * PixelToLocal - Size * 0.5f;
+
+		FSlateDrawElement::MakeText(OutDrawElements, LayerId,
+			AllottedGeometry.ToPaintGeometry(Size, FSlateLayoutTransform(Position)),
+			Text->Texts[Index], Text->Font, ESlateDrawEffect::None, Color);
+	}
+
+	return LayerId;
+}
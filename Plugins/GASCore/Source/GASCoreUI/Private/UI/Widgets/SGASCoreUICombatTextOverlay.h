@@ -0,0 +1,30 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class UGASCoreUICombatTextSubsystem;
+
+/**
+ * Full-viewport, hit-test-invisible leaf widget that paints every live combat text number of its subsystem.
+ * Volatile: the numbers move every frame, so caching the paint would only cost invalidation work.
+ */
+class SGASCoreUICombatTextOverlay : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGASCoreUICombatTextOverlay) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, UGASCoreUICombatTextSubsystem* InSubsystem);
+
+	// ===== SWidget =====
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override { return FVector2D::ZeroVector; }
+
+private:
+	TWeakObjectPtr<UGASCoreUICombatTextSubsystem> Subsystem;
+};
@@ -0,0 +1,74 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "UI/Widgets/SGASCoreUIOverheadBarOverlay.h"
+
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+#include "Subsystems/GASCoreUIOverheadBarSubsystem.h"
+#include "UI/WidgetControllers/GASCoreUIOverheadBarController.h"
+#include "Utilities/GASCoreUITrace.h"
+
+static TAutoConsoleVariable<float> CVarGASCoreUIOverheadBarWidth(
+	TEXT("GASCore.UI.OverheadBar.Width"),
+	60.f,
+	TEXT("Overhead bar width in Slate units."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGASCoreUIOverheadBarHeight(
+	TEXT("GASCore.UI.OverheadBar.Height"),
+	6.f,
+	TEXT("Overhead bar height in Slate units."),
+	ECVF_Default);
+
+void SGASCoreUIOverheadBarOverlay::Construct(const FArguments& InArgs, UGASCoreUIOverheadBarSubsystem* InSubsystem)
+{
+	Subsystem = InSubsystem;
+	SetVisibility(EVisibility::HitTestInvisible);
+	SetCanTick(false);
+	ForceVolatile(true);
+}
+
+int32 SGASCoreUIOverheadBarOverlay::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const UGASCoreUIOverheadBarSubsystem* Bars = Subsystem.Get();
+	if (!Bars || Bars->NumBars == 0 || Bars->ProjectedViewportSize.X <= 0.f || Bars->ProjectedViewportSize.Y <= 0.f)
+	{
+		return LayerId;
+	}
+
+	GASCOREUI_TRACE_SCOPE(SGASCoreUIOverheadBarOverlay::OnPaint);
+
+	// Projected positions are viewport pixels; the overlay fills the viewport in Slate units (DPI scaled).
+	const FVector2f PixelToLocal = FVector2f(AllottedGeometry.GetLocalSize()) / Bars->ProjectedViewportSize;
+	const FVector2f BarSize(CVarGASCoreUIOverheadBarWidth.GetValueOnGameThread(), CVarGASCoreUIOverheadBarHeight.GetValueOnGameThread());
+	const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("WhiteBrush");
+	const FLinearColor BackgroundColor(0.f, 0.f, 0.f, 0.6f * InWidgetStyle.GetColorAndOpacityTint().A);
+
+	for (int32 Index = 0; Index < Bars->Bars.Num(); ++Index)
+	{
+		const UGASCoreUIOverheadBarController* Bar = Bars->Bars[Index];
+		if (!Bar)
+		{
+			continue;
+		}
+
+		// Backgrounds on LayerId, fills on LayerId + 1: two draw layers for every bar, so Slate batches them.
+		const FVector2f Position = Bars->ScreenPositions[Index] * PixelToLocal - BarSize * 0.5f;
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+			AllottedGeometry.ToPaintGeometry(BarSize, FSlateLayoutTransform(Position)),
+			WhiteBrush, ESlateDrawEffect::None, BackgroundColor);
+
+		const float Fill = Bar->GetFillFraction();
+		if (Fill > 0.f)
+		{
+			FLinearColor FillColor = Bars->FillColors[Index];
+			FillColor.A *= InWidgetStyle.GetColorAndOpacityTint().A;
+			FSlateDrawElement::MakeBox(OutDrawElements, LayerId + 1,
+				AllottedGeometry.ToPaintGeometry(FVector2f(BarSize.X * Fill, BarSize.Y), FSlateLayoutTransform(Position)),
+				WhiteBrush, ESlateDrawEffect::None, FillColor);
+		}
+	}
+
+	return LayerId + 1;
+}
@@ -0,0 +1,30 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class UGASCoreUIOverheadBarSubsystem;
+
+/**
+ * Full-viewport, hit-test-invisible leaf widget that paints every allocated overhead bar of its subsystem
+ * (background + fill box each). Volatile for the same reason as the combat text overlay.
+ */
+class SGASCoreUIOverheadBarOverlay : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGASCoreUIOverheadBarOverlay) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, UGASCoreUIOverheadBarSubsystem* InSubsystem);
+
+	// ===== SWidget =====
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override { return FVector2D::ZeroVector; }
+
+private:
+	TWeakObjectPtr<UGASCoreUIOverheadBarSubsystem> Subsystem;
+};
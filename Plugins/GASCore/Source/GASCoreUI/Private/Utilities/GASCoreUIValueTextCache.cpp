@@ -0,0 +1,105 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Utilities/GASCoreUIValueTextCache.h"
+
+#include "AbilitySystem/Attributes/GASCoreAttributeSet.h"
+#include "HAL/IConsoleManager.h"
+#include "Internationalization/Internationalization.h"
+
+static TAutoConsoleVariable<int32> CVarGASCoreUIValueTextCacheMaxEntries(
+	TEXT("GASCore.UI.ValueTextCache.MaxEntries"),
+	2048,
+	TEXT("Formatted attribute value texts kept; the cache is cleared when it grows past this."),
+	ECVF_Default);
+
+namespace GASCoreUIValueTextCache
+{
+	namespace Private
+	{
+		constexpr int32 MaxDecimals = 6;
+
+		/** (quantized value, decimals) -> text. */
+		TMap<TPair<int64, int32>, FText> Texts;
+
+		/** Attribute -> rounding decimals (class metadata never changes at runtime outside the editor). */
+		TMap<FGameplayAttribute, int32> DecimalsByAttribute;
+
+		bool bCultureHookBound = false;
+
+		void BindCultureHook()
+		{
+			if (!bCultureHookBound)
+			{
+				bCultureHookBound = true;
+				FInternationalization::Get().OnCultureChanged().AddStatic(&GASCoreUIValueTextCache::Reset);
+			}
+		}
+	}
+
+	FText Format(const float Value, const int32 Decimals)
+	{
+		check(IsInGameThread());
+		using namespace Private;
+
+		const int32 ClampedDecimals = FMath::Clamp(Decimals, 0, MaxDecimals);
+		const double Scale = FMath::Pow(10.0, ClampedDecimals);
+		const TPair<int64, int32> Key(FMath::RoundToInt64(static_cast<double>(Value) * Scale), ClampedDecimals);
+
+		if (const FText* Cached = Texts.Find(Key))
+		{
+			return *Cached;
+		}
+
+		BindCultureHook();
+		if (Texts.Num() >= CVarGASCoreUIValueTextCacheMaxEntries.GetValueOnGameThread())
+		{
+			Texts.Reset();
+		}
+
+		FNumberFormattingOptions Options;
+		Options.MinimumFractionalDigits = ClampedDecimals;
+		Options.MaximumFractionalDigits = ClampedDecimals;
+		return Texts.Add(Key, FText::AsNumber(static_cast<double>(Key.Key) / Scale, &Options));
+	}
+
+	FText FormatAttribute(const FGameplayAttribute& Attribute, const float Value)
+	{
+		return Format(Value, GetAttributeDecimals(Attribute));
+	}
+
+	int32 GetAttributeDecimals(const FGameplayAttribute& Attribute)
+	{
+		check(IsInGameThread());
+		using namespace Private;
+
+		if (const int32* Cached = DecimalsByAttribute.Find(Attribute))
+		{
+			return *Cached;
+		}
+
+		const UClass* SetClass = Attribute.GetAttributeSetClass();
+		const UGASCoreAttributeSet* SetDefaults = SetClass ? Cast<UGASCoreAttributeSet>(SetClass->GetDefaultObject()) : nullptr;
+		const int32 Decimals = SetDefaults ? SetDefaults->GetRoundingDecimals(Attribute) : 0;
+#if WITH_EDITOR
+		// Quantization can be edited on the set defaults in the editor; do not pin it there.
+		return Decimals;
+#else
+		return DecimalsByAttribute.Add(Attribute, Decimals);
+#endif
+	}
+
+	void Reset()
+	{
+		Private::Texts.Reset();
+	}
+}
+
+FText UGASCoreUIValueTextLibrary::FormatAttributeValue(const FGameplayAttribute& Attribute, const float Value)
+{
+	return GASCoreUIValueTextCache::FormatAttribute(Attribute, Value);
+}
+
+FText UGASCoreUIValueTextLibrary::FormatValue(const float Value, const int32 Decimals)
+{
+	return GASCoreUIValueTextCache::Format(Value, Decimals);
+}
@@ -0,0 +1,123 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Fonts/SlateFontInfo.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreUICombatTextSubsystem.generated.h"
+
+class SGASCoreUICombatTextOverlay;
+class UGameViewportClient;
+struct FGASCoreBatchedCue;
+
+/**
+ * UGASCoreUICombatTextSubsystem
+ *
+ * Purpose:
+ * - Floating combat text (damage/heal numbers) for AoE fights with 100+ hits per second, without a UMG widget
+ *   per number.
+ *
+ * How it works:
+ * - Input: server code queues a registered cue tag with the number as magnitude through
+ *   UGASCoreGameplayCueBatchSubsystem::QueueCue; every relevant client receives the cell's burst and this subsystem
+ *   picks the registered tags out of AGASCoreGameplayCueBurstActor::OnCueBurstExecuted (one call per burst).
+ *   AddCombatText adds a number directly (local/predicted feedback).
+ * - Storage: structure-of-arrays (world location, preformatted text, width, colour, age), swap-removed when expired;
+ *   GASCore.UI.CombatText.MaxEntries caps it (the oldest number is replaced).
+ * - Tick: ages every number, then projects all of them to screen in one pass with a single view-projection matrix
+ *   of the primary local player.
+ * - Rendering: one full-viewport Slate leaf widget draws every number as a text element in OnPaint. Digit advance
+ *   widths are measured once per font size (glyph cache), so centering a number costs no font measurement.
+ * - Never active on a dedicated server.
+ */
+UCLASS()
+class GASCOREUI_API UGASCoreUICombatTextSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreUICombatTextSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Burst cues with CueTag become numbers drawn in Color (e.g., damage white, heal green). */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|UI|Combat Text")
+	void RegisterCombatTextCue(FGameplayTag CueTag, FLinearColor Color);
+
+	/** Stop turning CueTag bursts into numbers. */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|UI|Combat Text")
+	void UnregisterCombatTextCue(FGameplayTag CueTag);
+
+	/** Local: show |Value| (rounded) rising from WorldLocation. */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|UI|Combat Text")
+	void AddCombatText(FVector WorldLocation, float Value, FLinearColor Color);
+
+	/** Numbers currently alive. */
+	int32 GetNumEntries() const { return WorldLocations.Num(); }
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return WorldLocations.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	friend class SGASCoreUICombatTextOverlay;
+
+	/** OnCueBurstExecuted listener: registered tags of this world's bursts become numbers. */
+	void HandleCueBurst(const UWorld* BurstWorld, TConstArrayView<FGASCoreBatchedCue> Cues);
+
+	/** Project every live number with the primary local player's view (one matrix for the whole batch). */
+	void ProjectEntries();
+
+	/** Swap-remove the number at Index from every array. */
+	void RemoveEntry(int32 Index);
+
+	/** Measure digit advances for the current font size (no-op when already cached). */
+	void BuildGlyphCache();
+
+	/** Add the overlay to the primary local player's viewport (once). */
+	void EnsureOverlay();
+
+	/** Remove the overlay from its viewport. */
+	void RemoveOverlay();
+
+	/** Cue tag -> text colour. */
+	TMap<FGameplayTag, FLinearColor> CueColors;
+
+	// ===== Structure-of-arrays number storage (shared dense index) =====
+
+	TArray<FVector> WorldLocations;
+	TArray<FString> Texts;
+	TArray<float> TextWidths;
+	TArray<FLinearColor> Colors;
+	TArray<float> Ages;
+
+	// Written by ProjectEntries, read by the overlay's OnPaint.
+	TArray<FVector2f> ScreenPositions;
+	TArray<bool> OnScreen;
+
+	/** Seconds a number lives (GASCore.UI.CombatText.Lifetime, sampled each tick). */
+	float Lifetime = 1.f;
+
+	/** Pixel size of the viewport the positions were projected into. */
+	FVector2f ProjectedViewportSize = FVector2f::ZeroVector;
+
+	// ===== Glyph cache =====
+
+	FSlateFontInfo Font;
+	float DigitWidths[10] = {};
+	float GlyphHeight = 0.f;
+	int32 CachedFontSize = 0;
+
+	// ===== Overlay =====
+
+	TSharedPtr<SGASCoreUICombatTextOverlay> Overlay;
+	TWeakObjectPtr<UGameViewportClient> OverlayViewportClient;
+
+	FDelegateHandle CueBurstHandle;
+};
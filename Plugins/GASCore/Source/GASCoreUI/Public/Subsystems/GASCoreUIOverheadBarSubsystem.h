@@ -0,0 +1,119 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h" // FGameplayAttribute
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreUIOverheadBarSubsystem.generated.h"
+
+class SGASCoreUIOverheadBarOverlay;
+class UAbilitySystemComponent;
+class UGameViewportClient;
+class UGASCoreUIOverheadBarController;
+
+/**
+ * UGASCoreUIOverheadBarSubsystem
+ *
+ * Purpose:
+ * - Enemy overhead health bars without a UWidgetComponent per enemy: off-screen and distant enemies cost no widget,
+ *   no tick and no render.
+ *
+ * How it works:
+ * - Actors register with their ASC and Current/Max attributes (RegisterActor from BeginPlay). A registration is a few
+ *   array slots plus one native change listener that only stamps "recently damaged" when Current drops.
+ * - Tick: one batched projection pass (single view-projection matrix of the primary local player) over every
+ *   registered actor. A bar is allocated for actors on screen and within GASCore.UI.OverheadBar.MaxDistance, or on
+ *   screen and damaged within GASCore.UI.OverheadBar.RecentDamageSeconds; other bars are released.
+ * - Allocated bars are pooled UGASCoreUIOverheadBarController objects that subscribe Current/Max through the
+ *   coalesced attribute path of UGASCoreUIWidgetController. At most GASCore.UI.OverheadBar.MaxBars exist at once.
+ * - Rendering: one full-viewport Slate leaf widget draws every allocated bar (background + fill box) in OnPaint.
+ * - Never active on a dedicated server.
+ */
+UCLASS()
+class GASCOREUI_API UGASCoreUIOverheadBarSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreUIOverheadBarSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Track Actor for an overhead bar showing CurrentAttribute / MaxAttribute of ASC,
+	 * drawn HeightOffset above the actor's location in FillColor.
+	 */
+	void RegisterActor(AActor* Actor, UAbilitySystemComponent* ASC, const FGameplayAttribute& CurrentAttribute,
+		const FGameplayAttribute& MaxAttribute, float HeightOffset, const FLinearColor& FillColor = FLinearColor::Red);
+
+	/** Stop tracking Actor (releases its bar). */
+	void UnregisterActor(const AActor* Actor);
+
+	/** Registered actors / bars currently allocated. */
+	int32 GetNumRegistered() const { return Actors.Num(); }
+	int32 GetNumBars() const { return NumBars; }
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Actors.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	friend class SGASCoreUIOverheadBarOverlay;
+
+	/** Current dropped on the actor's ASC: keep (or make) its bar visible for a while. */
+	void HandleCurrentChanged(TObjectKey<AActor> ActorKey, float OldValue, float NewValue);
+
+	/** Swap-remove registration Index (releases its bar, removes its listener). */
+	void RemoveAt(int32 Index);
+
+	/** Pooled controller bound to registration Index. */
+	void AllocateBar(int32 Index);
+
+	/** Return registration Index's controller to the pool. */
+	void ReleaseBar(int32 Index);
+
+	/** Add the overlay to the primary local player's viewport (once). */
+	void EnsureOverlay();
+
+	/** Remove the overlay from its viewport. */
+	void RemoveOverlay();
+
+	// ===== Structure-of-arrays registrations (shared dense index) =====
+
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	TArray<TObjectKey<AActor>> ActorKeys;
+	TArray<TWeakObjectPtr<UAbilitySystemComponent>> AbilitySystemComponents;
+	TArray<FGameplayAttribute> CurrentAttributes;
+	TArray<FGameplayAttribute> MaxAttributes;
+	TArray<float> HeightOffsets;
+	TArray<FLinearColor> FillColors;
+	TArray<double> LastDamageTimes;
+	TArray<FDelegateHandle> DamageListenerHandles;
+
+	// Written by Tick, read by the overlay's OnPaint.
+	TArray<FVector2f> ScreenPositions;
+
+	/** Allocated bar per registration (null when none). */
+	UPROPERTY()
+	TArray<TObjectPtr<UGASCoreUIOverheadBarController>> Bars;
+
+	/** Released controllers ready for reuse. */
+	UPROPERTY()
+	TArray<TObjectPtr<UGASCoreUIOverheadBarController>> FreeBars;
+
+	/** Actor -> dense index. */
+	TMap<TObjectKey<AActor>, int32> IndexByActor;
+
+	/** Allocated (non-null) entries of Bars. */
+	int32 NumBars = 0;
+
+	/** Pixel size of the viewport the positions were projected into. */
+	FVector2f ProjectedViewportSize = FVector2f::ZeroVector;
+
+	TSharedPtr<SGASCoreUIOverheadBarOverlay> Overlay;
+	TWeakObjectPtr<UGameViewportClient> OverlayViewportClient;
+};
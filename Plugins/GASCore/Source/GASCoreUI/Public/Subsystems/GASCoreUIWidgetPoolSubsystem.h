@@ -0,0 +1,80 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GASCoreUIWidgetPoolSubsystem.generated.h"
+
+class APlayerController;
+class UGASCoreUIUserWidget;
+
+/** Widgets of one class: free ones ready for reuse, live ones in acquire order (oldest first). */
+USTRUCT()
+struct FGASCoreUIWidgetPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UGASCoreUIUserWidget>> Free;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UGASCoreUIUserWidget>> Active;
+};
+
+/**
+ * UGASCoreUIWidgetPoolSubsystem
+ *
+ * Purpose:
+ * - Per-class pools of UGASCoreUIUserWidget popups (MessageWidgetRowDelegate toasts, pickup notifications), so a burst
+ *   of messages reuses widgets instead of paying CreateWidget per message and leaving garbage behind.
+ *
+ * How it works:
+ * - AcquireWidget pops a free widget of the class (or creates one) and fires its OnAcquiredFromPool hook.
+ *   The caller adds it to the viewport/container as it would a freshly created widget.
+ * - ReleaseWidget (or UGASCoreUIUserWidget::ReleaseToPool from the widget's own graph, e.g. when its fade ends)
+ *   removes it from its parent, fires OnReleasedToPool and returns it to the free list.
+ * - At most GASCore.UI.WidgetPool.MaxPerClass widgets of a class are live; acquiring beyond that recycles the
+ *   oldest live one, so a class never allocates more than the cap.
+ * - Local UI only; the pool makes no authority decisions.
+ */
+UCLASS()
+class GASCOREUI_API UGASCoreUIWidgetPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UGASCoreUIWidgetPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Live WidgetClass widget owned by OwningPlayer: pooled, newly created, or the oldest live one recycled at the cap. */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|UI|Widget Pool", meta = (DeterminesOutputType = "WidgetClass"))
+	UGASCoreUIUserWidget* AcquireWidget(APlayerController* OwningPlayer, TSubclassOf<UGASCoreUIUserWidget> WidgetClass);
+
+	/** Return a live pooled widget to its class pool. Widgets not acquired from the pool are ignored. */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|UI|Widget Pool")
+	void ReleaseWidget(UGASCoreUIUserWidget* Widget);
+
+	/** Create free WidgetClass widgets until Count exist for the class (capped by MaxPerClass). */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|UI|Widget Pool")
+	void PrewarmWidgets(APlayerController* OwningPlayer, TSubclassOf<UGASCoreUIUserWidget> WidgetClass, int32 Count);
+
+	/** Number of free (released) widgets of WidgetClass. */
+	int32 GetNumFree(TSubclassOf<UGASCoreUIUserWidget> WidgetClass) const;
+
+	// ===== UWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+
+private:
+	/** Free widget or a new one; null if creation failed. */
+	UGASCoreUIUserWidget* PopOrCreate(FGASCoreUIWidgetPool& Pool, APlayerController* OwningPlayer, TSubclassOf<UGASCoreUIUserWidget> WidgetClass);
+
+	/** Deactivate a live widget into Pool.Free (caller already removed it from Pool.Active). */
+	static void Deactivate(FGASCoreUIWidgetPool& Pool, UGASCoreUIUserWidget* Widget);
+
+	/** Pools per exact widget class. */
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FGASCoreUIWidgetPool> Pools;
+};
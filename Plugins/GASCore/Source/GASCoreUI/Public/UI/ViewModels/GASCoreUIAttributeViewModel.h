@@ -0,0 +1,99 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h" // FGameplayAttribute
+#include "FieldNotificationDelegate.h"
+#include "INotifyFieldValueChanged.h"
+#include "UObject/Object.h"
+
+#include "GASCoreUIAttributeViewModel.generated.h"
+
+class UAbilitySystemComponent;
+class UGASCoreAttributeInfoDataAsset;
+
+/**
+ * UGASCoreUIAttributeViewModel
+ *
+ * Purpose:
+ * - Field-notify view model for attribute displays: MVVM view bindings update only the bound widget properties,
+ *   with no per-change Blueprint event graph and no per-attribute dynamic multicast delegate.
+ *
+ * How it works:
+ * - Subclasses (C++ or a view model Blueprint) declare one FieldNotify float/double per attribute, named after the
+ *   attribute (e.g., "Health", "MaxHealth").
+ * - BindToAbilitySystem walks the rows of a UGASCoreAttributeInfoDataAsset; every row whose AttributeGetter name
+ *   matches a field-notify property is bound (rows without a field are skipped), so the data asset decides which
+ *   fields are live.
+ * - Changes coalesce like UGASCoreUIWidgetController::BindCoalescedAttribute: the latest value is written once at
+ *   end of frame and the field is broadcast only if it changed and something is bound to it.
+ * - Implements INotifyFieldValueChanged natively (FieldNotification module), so GASCoreUI does not depend on the
+ *   ModelViewViewModel plugin; the project enables that plugin for the widget-side bindings.
+ */
+UCLASS(Abstract, Blueprintable, BlueprintType)
+class GASCOREUI_API UGASCoreUIAttributeViewModel : public UObject, public INotifyFieldValueChanged
+{
+	GENERATED_BODY()
+
+public:
+	/** Descriptor for Blueprint-declared fields; UHT chains native FieldNotify properties of subclasses onto it. */
+	struct FFieldNotificationClassDescriptor : public ::UE::FieldNotification::IClassDescriptor
+	{
+		virtual void ForEachField(const UClass* Class, TFunctionRef<bool(::UE::FieldNotification::FFieldId FieldId)> Callback) const override;
+	};
+
+	/** Bind every AttributeInfo row that has a matching field to ASC, pushing current values immediately. */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|UI|View Model")
+	void BindToAbilitySystem(UAbilitySystemComponent* ASC, const UGASCoreAttributeInfoDataAsset* AttributeInfo);
+
+	/** Remove every attribute subscription. Field values keep their last state. */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|UI|View Model")
+	void UnbindFromAbilitySystem();
+
+	/** Number of attributes currently bound to fields. */
+	int32 GetNumBoundAttributes() const { return BoundFields.Num(); }
+
+	// ===== INotifyFieldValueChanged =====
+
+	virtual FDelegateHandle AddFieldValueChangedDelegate(UE::FieldNotification::FFieldId InFieldId, FFieldValueChangedDelegate InNewDelegate) override final;
+	virtual bool RemoveFieldValueChangedDelegate(UE::FieldNotification::FFieldId InFieldId, FDelegateHandle InHandle) override final;
+	virtual int32 RemoveAllFieldValueChangedDelegates(FDelegateUserObjectConst InUserObject) override final;
+	virtual int32 RemoveAllFieldValueChangedDelegates(UE::FieldNotification::FFieldId InFieldId, FDelegateUserObjectConst InUserObject) override final;
+	virtual const UE::FieldNotification::IClassDescriptor& GetFieldNotificationDescriptor() const override;
+	virtual void BroadcastFieldValueChanged(UE::FieldNotification::FFieldId InFieldId) override;
+
+protected:
+	virtual void BeginDestroy() override;
+
+private:
+	/** One attribute -> field binding. */
+	struct FBoundField
+	{
+		FGameplayAttribute Attribute;
+		UE::FieldNotification::FFieldId FieldId;
+		FProperty* Property = nullptr;
+		FDelegateHandle Handle;
+		float PendingValue = 0.f;
+		bool bDirty = false;
+	};
+
+	/** Write Value into the field's property; returns true if it changed. */
+	bool WriteField(const FBoundField& Field, float Value);
+
+	/** Write and broadcast every dirty field (end of frame). */
+	void FlushDirtyFields();
+
+	TArray<FBoundField> BoundFields;
+
+	/** ASC the subscriptions were added to. */
+	TWeakObjectPtr<UAbilitySystemComponent> BoundAbilitySystemComponent;
+
+	/** Field-notify listeners (widget view bindings). */
+	UE::FieldNotification::FFieldMulticastDelegate Delegates;
+
+	/** Fields with at least one listener; others are written but not broadcast. */
+	TBitArray<> EnabledFieldNotifications;
+
+	bool bFlushScheduled = false;
+};
@@ -0,0 +1,36 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UI/WidgetControllers/GASCoreUIWidgetController.h"
+
+#include "GASCoreUIOverheadBarController.generated.h"
+
+/**
+ * UGASCoreUIOverheadBarController
+ *
+ * Model side of one allocated overhead bar (UGASCoreUIOverheadBarSubsystem).
+ * - Subscribes Current/Max through the base class's coalesced attribute path, so a bar updates at most once per
+ *   flush however many hits land in a frame.
+ * - Pooled by the subsystem: BindBar when a bar is allocated, UnbindBar when it is released.
+ */
+UCLASS(Transient)
+class GASCOREUI_API UGASCoreUIOverheadBarController : public UGASCoreUIWidgetController
+{
+	GENERATED_BODY()
+
+public:
+	/** Read the current values of Current/Max on ASC and subscribe to their changes. */
+	void BindBar(UAbilitySystemComponent* ASC, const FGameplayAttribute& CurrentAttribute, const FGameplayAttribute& MaxAttribute);
+
+	/** Drop the subscriptions and the ASC reference. */
+	void UnbindBar();
+
+	/** Current / Max in [0, 1] (0 while Max is 0). */
+	float GetFillFraction() const { return MaxValue > 0.f ? FMath::Clamp(CurrentValue / MaxValue, 0.f, 1.f) : 0.f; }
+
+private:
+	float CurrentValue = 0.f;
+	float MaxValue = 0.f;
+};
@@ -0,0 +1,74 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+#include "GASCoreUIVitalsSmoother.generated.h"
+
+/**
+ * UGASCoreUIVitalsSmoother
+ *
+ * Purpose:
+ * - Client-side smoothing for vitals bars: replicated Health/Mana changes glide instead of jumping, and bars are
+ *   pushed at a fixed UI refresh rate rather than once per replicated change.
+ *
+ * How it works:
+ * - Owners (widget controllers) add one channel per vital with a publish callback, then feed targets through
+ *   SetTarget. The first target of a channel snaps.
+ * - A looping world timer at GASCore.UI.VitalsSmoothing.RefreshRate interpolates every channel toward its target;
+ *   it runs only while some channel is still moving, so settled vitals cost nothing.
+ * - A channel publishes only when its displayed value moved at least GASCore.UI.VitalsSmoothing.MinStep (or
+ *   reached the target), so the bound widgets invalidate only when what they show actually changes.
+ * - A channel may also have a target source, sampled every step while the timer runs (e.g.,
+ *   UGASCoreAttributeSet::GetExtrapolatedValue, so regenerating vitals keep filling between replicated writes).
+ *   The timer keeps running while a source's value changes and stops once it holds still (the vital is full).
+ */
+UCLASS()
+class GASCOREUI_API UGASCoreUIVitalsSmoother : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Add a channel; Publish receives the displayed value. Returns the channel index. */
+	int32 AddChannel(TFunction<void(float)> Publish);
+
+	/** Set a channel's target value. bSnap (or the channel's first target) publishes it immediately. */
+	void SetTarget(int32 Channel, float Target, bool bSnap = false);
+
+	/** Sample Source as the channel's target on every step (null clears it). SetTarget still starts the timer. */
+	void SetTargetSource(int32 Channel, TFunction<float()> Source);
+
+	/** Current displayed (smoothed) value of a channel. */
+	float GetDisplayedValue(int32 Channel) const { return Channels.IsValidIndex(Channel) ? Channels[Channel].Displayed : 0.f; }
+
+	/** Remove every channel and stop the timer. */
+	void Reset();
+
+	virtual void BeginDestroy() override;
+
+private:
+	struct FChannel
+	{
+		TFunction<void(float)> Publish;
+		TFunction<float()> Source;
+		float Target = 0.f;
+		float Displayed = 0.f;
+		float Published = 0.f;
+		bool bHasTarget = false;
+	};
+
+	/** Timer step: interpolate and publish; stops the timer once everything settled. */
+	void Step();
+
+	void StartTimer();
+	void StopTimer();
+
+	TArray<FChannel> Channels;
+
+	FTimerHandle StepTimerHandle;
+
+	/** World time of the previous step (timers may fire late under hitches). */
+	double LastStepTime = 0.0;
+};
@@ -31,6 +31,13 @@
 //     or use weak captures/handles to avoid dangling references.
 //   - MessageWidgetRowDelegate broadcasts whole rows; keep row structs lightweight.
 //
+// Coalesced attribute updates:
+//   - BindCoalescedAttribute() subscribes to an attribute and marks it dirty on change instead of broadcasting.
+//   - Dirty values flush once at end of frame (or at GASCore.UI.AttributeFlushInterval), latest value only,
+//     so Blueprint widget graphs run at most once per flush per value under regen + damage spam.
+//   - Widgets should turn broadcast floats into text with UGASCoreUIValueTextLibrary::FormatAttributeValue
+//     (cached per quantized value) rather than ToText/AsNumber per update.
+//
 // Related types:
 //   - FGASCoreUIMessageWidgetRow: DataTable row mapping a GameplayTag to message content/widget/icon.
 //   - UGASCoreAbilitySystemComponent: can broadcast effect asset tags to drive UI messages.
@@ -38,6 +45,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AttributeSet.h" // FGameplayAttribute
 #include "GameplayTagContainer.h"
 #include "UObject/Object.h"
 #include "Engine/DataTable.h" // FTableRowBase
@@ -142,6 +150,10 @@ struct FGASCoreUIMessageWidgetRow : public FTableRowBase
 /** Broadcasts a message widget row to the UI (e.g., HUD overlay). */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FUIMessageWidgetRowSignature, FGASCoreUIMessageWidgetRow, MessageWidgetRow);
 
+/** Broadcasts a row together with its MessageWidget, already acquired from UGASCoreUIWidgetPoolSubsystem. */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FUIMessageWidgetSignature, FGASCoreUIMessageWidgetRow, MessageWidgetRow,
+	UGASCoreUIUserWidget*, MessageWidget);
+
 /**
  * UGASCoreUIWidgetController
  *
@@ -177,7 +189,21 @@ public:
 	 */
 	virtual void BindCallbacksToDependencies();
 
+	/** Broadcast every dirty coalesced attribute now (e.g., before a widget snapshot). */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|WidgetController")
+	void FlushDirtyAttributes();
+
 protected:
+	/**
+	 * Subscribe to Attribute on the AbilitySystemComponent with frame coalescing.
+	 * Changes only mark the attribute dirty; Broadcast runs with the latest value on the next flush.
+	 * With GASCore.UI.CoalesceAttributeUpdates 0, Broadcast runs immediately (legacy behavior).
+	 */
+	void BindCoalescedAttribute(const FGameplayAttribute& Attribute, TFunction<void(float)> Broadcast);
+
+	/** Remove every coalesced binding from the ASC it was made on and drop pending values. */
+	void UnbindCoalescedAttributes();
+
 	/** Owning player controller (HUD/input). */
 	UPROPERTY(BlueprintReadOnly, Category = "GASCore|Widget Controller")
 	TObjectPtr<APlayerController> PlayerController;
@@ -193,4 +219,31 @@ protected:
 	/** Attribute Set with gameplay stats. */
 	UPROPERTY(BlueprintReadOnly, Category = "GASCore|Widget Controller")
 	TObjectPtr<UAttributeSet> AttributeSet;
+
+private:
+	/** One coalesced binding: latest value waits here until the flush. */
+	struct FCoalescedAttribute
+	{
+		FGameplayAttribute Attribute;
+		FDelegateHandle Handle;
+		TFunction<void(float)> Broadcast;
+		float PendingValue = 0.f;
+		bool bDirty = false;
+	};
+
+	/** Change callback: store the value and schedule a flush. */
+	void MarkAttributeDirty(int32 Index, float NewValue);
+
+	/** Schedule FlushDirtyAttributes at end of frame (once per frame). */
+	void ScheduleFlush();
+
+	TArray<FCoalescedAttribute> CoalescedAttributes;
+
+	/** ASC the coalesced handles were added to (params may be swapped later). */
+	TWeakObjectPtr<UAbilitySystemComponent> CoalescedAbilitySystemComponent;
+
+	/** App time of the last flush, for the optional UI rate limit. */
+	double LastAttributeFlushTime = 0.0;
+
+	bool bAttributeFlushScheduled = false;
 };
\ No newline at end of file
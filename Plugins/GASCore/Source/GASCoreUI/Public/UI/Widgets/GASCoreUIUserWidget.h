@@ -55,6 +55,7 @@
 // See also:
 //   - UI/WidgetControllers/CoreWidgetController.* (base Controller implementation)
 //   - UI/WidgetControllers/CoreHUDWidgetController.* (example concrete Controller)
+//   - Subsystems/GASCoreUIWidgetPoolSubsystem.* (pooled popups; OnAcquiredFromPool/OnReleasedToPool hooks)
 
 #pragma once
 
@@ -62,6 +63,8 @@
 #include "Blueprint/UserWidget.h"
 #include "GASCoreUIUserWidget.generated.h"
 
+class UGASCoreUIWidgetPoolSubsystem;
+
 /**
  * UGASCoreUIUserWidget
  *
@@ -130,7 +133,32 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GASCore|User Widget|Widget Controller")
 	virtual void SetWidgetController(UObject* InWidgetController);
 
+	/**
+	 * Return this widget to the UGASCoreUIWidgetPoolSubsystem it was acquired from (e.g., when a popup's fade ends).
+	 * No-op for widgets created outside the pool or already released.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GASCore|User Widget|Pool")
+	void ReleaseToPool();
+
+	/** True between AcquireWidget and release. */
+	UFUNCTION(BlueprintPure, Category = "GASCore|User Widget|Pool")
+	bool IsActiveInPool() const { return bActiveInPool; }
+
 protected:
+	/** Pool hook: the widget was handed out again. Reset per-use state here; fires OnAcquiredFromPool. */
+	virtual void NativeOnAcquiredFromPool();
+
+	/** Pool hook: the widget was removed from its parent and parked. Stop animations/timers here; fires OnReleasedToPool. */
+	virtual void NativeOnReleasedToPool();
+
+	/** Blueprint pool hook: reset text/icon/animation state before the widget is shown again. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "GASCore|User Widget|Pool", meta = (DisplayName = "On Acquired From Pool"))
+	void OnAcquiredFromPool();
+
+	/** Blueprint pool hook: the widget left the screen and waits for reuse (also fires when recycled at the cap). */
+	UFUNCTION(BlueprintImplementableEvent, Category = "GASCore|User Widget|Pool", meta = (DisplayName = "On Released To Pool"))
+	void OnReleasedToPool();
+
 	/**
 	 * Blueprint event called immediately after the Widget Controller is assigned.
 	 * 
@@ -188,4 +216,12 @@ private:
 	 */
 	UPROPERTY()
 	TObjectPtr<UObject> WidgetController = nullptr;
+
+	friend class UGASCoreUIWidgetPoolSubsystem;
+
+	/** Pool that created this widget (unset for widgets created directly). */
+	TWeakObjectPtr<UGASCoreUIWidgetPoolSubsystem> OwningPool;
+
+	/** Set by the pool while the widget is handed out. */
+	bool bActiveInPool = false;
 };
\ No newline at end of file
@@ -0,0 +1,25 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+#include "Utilities/GASCoreFrameBudget.h"
+
+// Insights channel for GASCore UI work (widget controller and view model broadcasts, vitals smoothing, overlays).
+// - Off by default: run with -trace=cpu,GASCoreUI or toggle it at runtime with "Trace.Enable GASCoreUI" /
+//   "Trace.Disable GASCoreUI" (Development and Test builds). While off a scope costs one channel check.
+// - Exported so game widget controllers put their broadcasts on the same channel (GASCOREUI_TRACE_SCOPE).
+// - Broadcast entry points use GASCOREUI_BROADCAST_SCOPE, which also charges the UI Broadcasts area of
+//   GASCoreFrameBudget (the frame budget dashboard). Slate painting is left out: it is not broadcast work.
+
+UE_TRACE_CHANNEL_EXTERN(GASCoreUIChannel, GASCOREUI_API);
+
+/** Insights CPU scope on the GASCoreUI channel. */
+#define GASCOREUI_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, GASCoreUIChannel)
+
+/** GASCOREUI_TRACE_SCOPE plus the GASCoreFrameBudget UI broadcast area. */
+#define GASCOREUI_BROADCAST_SCOPE(Name) \
+	GASCOREUI_TRACE_SCOPE(Name); \
+	GASCORE_FRAME_BUDGET_SCOPE(UIBroadcast)
@@ -0,0 +1,46 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h" // FGameplayAttribute
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "GASCoreUIValueTextCache.generated.h"
+
+// Cached number -> FText formatting for attribute displays.
+// - Key: value quantized to the attribute's rounding decimals (UGASCoreAttributeSet quantization table) + decimals,
+//   so every value the set can actually hold maps to one cached FText (vitals are integers: near 100% hits).
+// - Bounded by GASCore.UI.ValueTextCache.MaxEntries (cleared when full); cleared on culture change.
+// - Game thread only.
+
+namespace GASCoreUIValueTextCache
+{
+	/** Value rounded to Decimals (0-6), formatted with exactly Decimals fractional digits. */
+	GASCOREUI_API FText Format(float Value, int32 Decimals);
+
+	/** Format with Attribute's rounding decimals (its set's class metadata; 0 for non-GASCore sets). */
+	GASCOREUI_API FText FormatAttribute(const FGameplayAttribute& Attribute, float Value);
+
+	/** Rounding decimals of Attribute, cached per attribute. */
+	GASCOREUI_API int32 GetAttributeDecimals(const FGameplayAttribute& Attribute);
+
+	/** Drop every cached text (also done automatically on culture change). */
+	GASCOREUI_API void Reset();
+}
+
+/** Blueprint access to GASCoreUIValueTextCache: use instead of ToText/AsNumber on attribute broadcasts. */
+UCLASS()
+class GASCOREUI_API UGASCoreUIValueTextLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Cached display text of Value, rounded like Attribute is stored. */
+	UFUNCTION(BlueprintPure, Category = "GASCore|UI|Text", meta = (DisplayName = "Format Attribute Value (Cached)"))
+	static FText FormatAttributeValue(const FGameplayAttribute& Attribute, float Value);
+
+	/** Cached display text of Value with Decimals fractional digits. */
+	UFUNCTION(BlueprintPure, Category = "GASCore|UI|Text", meta = (DisplayName = "Format Value (Cached)"))
+	static FText FormatValue(float Value, int32 Decimals = 0);
+};
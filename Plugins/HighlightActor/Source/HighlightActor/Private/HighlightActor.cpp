@@ -1,11 +1,37 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "HighlightActor.h"
+#include "HighlightActorStats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DEFINE_LOG_CATEGORY(LogHighlight);
+
+DEFINE_STAT(STAT_Highlight_PerformHighlight);
+DEFINE_STAT(STAT_Highlight_Trace);
+DEFINE_STAT(STAT_Highlight_AreaUpdate);
+DEFINE_STAT(STAT_Highlight_ScreenSpaceBuild);
+DEFINE_STAT(STAT_Highlight_CustomDepthFlush);
+DEFINE_STAT(STAT_Highlight_Traces);
+DEFINE_STAT(STAT_Highlight_Changes);
+DEFINE_STAT(STAT_Highlight_InterfaceChecks);
+DEFINE_STAT(STAT_Highlight_CustomDepthChanges);
+
+CSV_DEFINE_CATEGORY(HighlightActor, true);
+
+UE_TRACE_CHANNEL_DEFINE(HighlightChannel);
+
+TAutoConsoleVariable<float> CVarHighlightBudgetFrameUs(
+	TEXT("Highlight.Budget.FrameUs"),
+	0.f,
+	TEXT("Per-frame budget (microseconds) for one UHighlightInteraction tick. ")
+	TEXT("Ticks over budget log a warning (at most once per second). 0 disables the check."),
+	ECVF_Default);
 
 #define LOCTEXT_NAMESPACE "FHighlightActorModule"
 
 void FHighlightActorModule::StartupModule()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHighlightActorModule::StartupModule);
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
 }
 
@@ -0,0 +1,60 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+/**
+ * HighlightActor profiling
+ *
+ * - Stats:  "stat Highlight" in any non-shipping build. Counters reset every frame (per-frame rates).
+ * - CSV:    the HighlightActor category records PerformHighlight / Trace timings and per-frame counts.
+ * - Insights: run with -trace=cpu,Highlight (or "Trace.Enable Highlight" at runtime) to get the scoped timings
+ *             below as CPU events on their own channel.
+ * - Budget: Highlight.Budget.FrameUs > 0 logs a (rate-limited) warning when one UHighlightInteraction tick
+ *           spends more than that many microseconds on highlight work.
+ */
+
+DECLARE_LOG_CATEGORY_EXTERN(LogHighlight, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("Highlight"), STATGROUP_Highlight, STATCAT_Advanced);
+
+// Cycle counters
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Perform Highlight"), STAT_Highlight_PerformHighlight, STATGROUP_Highlight, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Strategy Trace"), STAT_Highlight_Trace, STATGROUP_Highlight, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Area Update"), STAT_Highlight_AreaUpdate, STATGROUP_Highlight, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Screen-Space Build"), STAT_Highlight_ScreenSpaceBuild, STATGROUP_Highlight, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Custom Depth Flush"), STAT_Highlight_CustomDepthFlush, STATGROUP_Highlight, );
+
+// Per-frame counters
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Traces"), STAT_Highlight_Traces, STATGROUP_Highlight, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Highlight Changes"), STAT_Highlight_Changes, STATGROUP_Highlight, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("ImplementsInterface Checks"), STAT_Highlight_InterfaceChecks, STATGROUP_Highlight, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Custom Depth Changes"), STAT_Highlight_CustomDepthChanges, STATGROUP_Highlight, );
+
+CSV_DECLARE_CATEGORY_EXTERN(HighlightActor);
+
+UE_TRACE_CHANNEL_EXTERN(HighlightChannel);
+
+extern TAutoConsoleVariable<float> CVarHighlightBudgetFrameUs;
+
+/** Cycle stat + CSV timing + Insights CPU scope on the Highlight channel with one name (STAT_Highlight_<Name> / HighlightActor.<Name>). */
+#define HIGHLIGHT_SCOPE_CYCLE_COUNTER(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_Highlight_##Name); \
+	CSV_SCOPED_TIMING_STAT(HighlightActor, Name); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Highlight_##Name, HighlightChannel)
+
+/** Insights CPU scope on the Highlight channel only (entry points without a stat of their own). */
+#define HIGHLIGHT_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, HighlightChannel)
+
+/** Per-frame counter stat + CSV custom stat accumulated over the frame. */
+#define HIGHLIGHT_INC_COUNTER(Name) \
+	INC_DWORD_STAT(STAT_Highlight_##Name); \
+	CSV_CUSTOM_STAT(HighlightActor, Name, 1, ECsvCustomStatOp::Accumulate)
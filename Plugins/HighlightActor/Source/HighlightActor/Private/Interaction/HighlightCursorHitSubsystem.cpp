@@ -0,0 +1,148 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Interaction/HighlightCursorHitSubsystem.h"
+#include "HighlightActorStats.h"
+
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/PlayerController.h"
+
+UHighlightCursorHitSubsystem* UHighlightCursorHitSubsystem::Get(const APlayerController* PC)
+{
+	const ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+	return LocalPlayer ? LocalPlayer->GetSubsystem<UHighlightCursorHitSubsystem>() : nullptr;
+}
+
+bool UHighlightCursorHitSubsystem::GetCursorHit(APlayerController* PC, const ECollisionChannel Channel,
+	const bool bTraceComplex, const float TraceDistance, FHitResult& OutHit)
+{
+	HIGHLIGHT_TRACE_SCOPE(UHighlightCursorHitSubsystem::GetCursorHit);
+	if (!PC || !PC->GetWorld())
+	{
+		return false;
+	}
+
+	// Reuse this frame's result for an identical query, unless the camera moved on since (late-frame consumers).
+	const float CameraTime = GetCameraTime(PC);
+	if (SharedChannels.Contains(Channel))
+	{
+		return GetSharedChannelHit(PC, Channel, bTraceComplex, TraceDistance, CameraTime, OutHit);
+	}
+	FCursorHitEntry* Entry = Entries.FindByPredicate([&](const FCursorHitEntry& E)
+	{
+		return E.Channel == Channel && E.bTraceComplex == bTraceComplex && E.TraceDistance == TraceDistance;
+	});
+	if (Entry && Entry->FrameNumber == GFrameCounter && Entry->CameraTime == CameraTime)
+	{
+		OutHit = Entry->Hit;
+		return Entry->bHit;
+	}
+
+	if (!Entry)
+	{
+		Entry = &Entries.AddDefaulted_GetRef();
+		Entry->Channel = Channel;
+		Entry->bTraceComplex = bTraceComplex;
+		Entry->TraceDistance = TraceDistance;
+	}
+
+	Entry->FrameNumber = GFrameCounter;
+	Entry->CameraTime = CameraTime;
+	Entry->Hit = FHitResult();
+	Entry->bHit = false;
+
+	// One deprojection per frame and camera update, shared by every channel.
+	if (UpdateCursorRay(PC, CameraTime))
+	{
+		const FCollisionQueryParams Params(SCENE_QUERY_STAT(HighlightCursorHit), bTraceComplex, PC->GetPawn());
+		Entry->bHit = PC->GetWorld()->LineTraceSingleByChannel(
+			Entry->Hit,
+			RayOrigin,
+			RayOrigin + RayDirection * TraceDistance,
+			Channel,
+			Params
+		);
+	}
+
+	OutHit = Entry->Hit;
+	return Entry->bHit;
+}
+
+void UHighlightCursorHitSubsystem::SetSharedChannels(const TConstArrayView<TEnumAsByte<ECollisionChannel>> Channels,
+	const float MinTraceDistance)
+{
+	SharedChannels = Channels;
+	SharedMinTraceDistance = MinTraceDistance;
+	for (FSharedTrace& Shared : SharedTraces)
+	{
+		Shared.FrameNumber = MAX_uint64;
+	}
+}
+
+bool UHighlightCursorHitSubsystem::GetSharedChannelHit(const APlayerController* PC, const ECollisionChannel Channel,
+	const bool bTraceComplex, const float TraceDistance, const float CameraTime, FHitResult& OutHit)
+{
+	// One trace per frame, camera update and complex flag for the whole set; only a longer query retraces.
+	FSharedTrace& Shared = SharedTraces[bTraceComplex ? 1 : 0];
+	const bool bReuse = Shared.FrameNumber == GFrameCounter && Shared.CameraTime == CameraTime
+		&& Shared.TraceDistance >= TraceDistance;
+	if (!bReuse)
+	{
+		Shared.FrameNumber = GFrameCounter;
+		Shared.CameraTime = CameraTime;
+		Shared.TraceDistance = FMath::Max(TraceDistance, SharedMinTraceDistance);
+		Shared.Hits.Reset();
+
+		if (UpdateCursorRay(PC, CameraTime))
+		{
+			// Object queries report every component the ray passes through, whatever its channel responses.
+			const FCollisionQueryParams Params(SCENE_QUERY_STAT(HighlightCursorHitShared), bTraceComplex, PC->GetPawn());
+			PC->GetWorld()->LineTraceMultiByObjectType(
+				Shared.Hits,
+				RayOrigin,
+				RayOrigin + RayDirection * Shared.TraceDistance,
+				FCollisionObjectQueryParams(FCollisionObjectQueryParams::AllObjects),
+				Params
+			);
+			Shared.Hits.Sort([](const FHitResult& A, const FHitResult& B) { return A.Distance < B.Distance; });
+		}
+	}
+
+	// The nearest component blocking Channel is where a single-channel trace would have stopped.
+	for (const FHitResult& Hit : Shared.Hits)
+	{
+		if (Hit.Distance > TraceDistance)
+		{
+			break;
+		}
+		const UPrimitiveComponent* Component = Hit.GetComponent();
+		if (Component && Component->GetCollisionResponseToChannel(Channel) == ECR_Block)
+		{
+			OutHit = Hit;
+			OutHit.bBlockingHit = true;
+			return true;
+		}
+	}
+	OutHit = FHitResult();
+	return false;
+}
+
+float UHighlightCursorHitSubsystem::GetCameraTime(const APlayerController* PC)
+{
+	return PC->PlayerCameraManager ? PC->PlayerCameraManager->GetCameraCacheTime() : 0.f;
+}
+
+bool UHighlightCursorHitSubsystem::UpdateCursorRay(const APlayerController* PC, const float CameraTime)
+{
+	if (RayFrameNumber != GFrameCounter || RayCameraTime != CameraTime)
+	{
+		RayFrameNumber = GFrameCounter;
+		RayCameraTime = CameraTime;
+		bRayValid = PC->DeprojectMousePositionToWorld(RayOrigin, RayDirection);
+	}
+	return bRayValid;
+}
@@ -0,0 +1,83 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Interaction/HighlightManagerSubsystem.h"
+
+#include "HighlightActorStats.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+UHighlightManagerSubsystem* UHighlightManagerSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UHighlightManagerSubsystem>() : nullptr;
+}
+
+void UHighlightManagerSubsystem::RequestCustomDepth(UPrimitiveComponent* Component, const bool bRenderCustomDepth, const int32 StencilValue)
+{
+	if (!IsValid(Component))
+	{
+		return;
+	}
+
+	FCustomDepthRequest Request;
+	Request.bRenderCustomDepth = bRenderCustomDepth;
+	Request.StencilValue = StencilValue;
+
+	if (UHighlightManagerSubsystem* Manager = Get(Component))
+	{
+		Manager->Pending.Add(Component, Request); // last request in a frame wins
+	}
+	else
+	{
+		ApplyCustomDepth(Component, Request);
+	}
+}
+
+void UHighlightManagerSubsystem::FlushPendingChanges()
+{
+	HIGHLIGHT_SCOPE_CYCLE_COUNTER(CustomDepthFlush);
+
+	for (const TPair<TWeakObjectPtr<UPrimitiveComponent>, FCustomDepthRequest>& Pair : Pending)
+	{
+		if (UPrimitiveComponent* Component = Pair.Key.Get())
+		{
+			ApplyCustomDepth(Component, Pair.Value);
+		}
+	}
+	Pending.Reset();
+}
+
+void UHighlightManagerSubsystem::ApplyCustomDepth(UPrimitiveComponent* Component, const FCustomDepthRequest& Request)
+{
+	// Each setter marks render state dirty; only call the ones whose value actually changes.
+	if (Request.bRenderCustomDepth && Component->CustomDepthStencilValue != Request.StencilValue)
+	{
+		HIGHLIGHT_INC_COUNTER(CustomDepthChanges);
+		Component->SetCustomDepthStencilValue(Request.StencilValue);
+	}
+	if (Component->bRenderCustomDepth != Request.bRenderCustomDepth)
+	{
+		HIGHLIGHT_INC_COUNTER(CustomDepthChanges);
+		Component->SetRenderCustomDepth(Request.bRenderCustomDepth);
+	}
+}
+
+void UHighlightManagerSubsystem::Deinitialize()
+{
+	Pending.Reset();
+	Super::Deinitialize();
+}
+
+void UHighlightManagerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	FlushPendingChanges();
+}
+
+TStatId UHighlightManagerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHighlightManagerSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,45 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Interaction/HighlightProxyComponent.h"
+
+#include "HighlightActor.h"
+#include "GameFramework/Actor.h"
+
+UHighlightProxyComponent::UHighlightProxyComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	ConfigureAsHighlightProxy(this);
+}
+
+void UHighlightProxyComponent::ConfigureAsHighlightProxy(UShapeComponent* Shape)
+{
+	if (!Shape)
+	{
+		return;
+	}
+
+	Shape->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	Shape->SetCollisionResponseToAllChannels(ECR_Ignore);
+	Shape->SetCollisionResponseToChannel(HIGHLIGHTABLE, ECR_Block);
+	Shape->SetGenerateOverlapEvents(false);
+	Shape->SetCanEverAffectNavigation(false);
+	Shape->CanCharacterStepUpOn = ECB_No;
+	Shape->SetHiddenInGame(true);
+}
+
+void UHighlightProxyComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	const AActor* Owner = GetOwner();
+	const UCapsuleComponent* OwnerCapsule = Owner ? Cast<UCapsuleComponent>(Owner->GetRootComponent()) : nullptr;
+	if (bMatchOwnerCapsule && OwnerCapsule && OwnerCapsule != this)
+	{
+		SetCapsuleSize(
+			OwnerCapsule->GetUnscaledCapsuleRadius() + ProxyPadding,
+			OwnerCapsule->GetUnscaledCapsuleHalfHeight() + ProxyPadding,
+			/*bUpdateOverlaps=*/false);
+	}
+}
@@ -0,0 +1,228 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Interaction/HighlightRegistrySubsystem.h"
+
+#include "HighlightActorStats.h"
+
+#include "Interaction/HighlightInterface.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "SceneView.h"
+
+UHighlightRegistrySubsystem* UHighlightRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UHighlightRegistrySubsystem>() : nullptr;
+}
+
+void UHighlightRegistrySubsystem::RegisterActor(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	// The only interface check: registered actors are known to be highlightable.
+	HIGHLIGHT_INC_COUNTER(InterfaceChecks);
+	if (!Actor->GetClass()->ImplementsInterface(UHighlightInterface::StaticClass()))
+	{
+		return;
+	}
+
+	if (Actors.Contains(Actor))
+	{
+		RefreshActorBounds(Actor);
+		return;
+	}
+
+	Actors.Add(Actor);
+	LocalBounds.Add(Actor->CalculateComponentsBoundingBoxInLocalSpace(/*bNonColliding=*/true));
+	BuiltFrame = MAX_uint64; // indices changed
+}
+
+void UHighlightRegistrySubsystem::UnregisterActor(AActor* Actor)
+{
+	const int32 Index = Actors.IndexOfByKey(Actor);
+	if (Index != INDEX_NONE)
+	{
+		Actors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		LocalBounds.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		BuiltFrame = MAX_uint64;
+	}
+}
+
+void UHighlightRegistrySubsystem::RefreshActorBounds(AActor* Actor)
+{
+	const int32 Index = Actors.IndexOfByKey(Actor);
+	if (Index != INDEX_NONE && IsValid(Actor))
+	{
+		LocalBounds[Index] = Actor->CalculateComponentsBoundingBoxInLocalSpace(/*bNonColliding=*/true);
+	}
+}
+
+bool UHighlightRegistrySubsystem::PickUnderCursor(APlayerController* PC, FHitResult& OutHit)
+{
+	float MouseX = 0.f, MouseY = 0.f;
+	if (!PC || !PC->GetMousePosition(MouseX, MouseY))
+	{
+		return false;
+	}
+	return PickAtScreenPosition(PC, FVector2D(MouseX, MouseY), OutHit);
+}
+
+SIZE_T UHighlightRegistrySubsystem::GetAllocatedSize() const
+{
+	SIZE_T Bytes = Actors.GetAllocatedSize() + LocalBounds.GetAllocatedSize() + ScreenEntries.GetAllocatedSize() + GridCells.GetAllocatedSize();
+	for (const TArray<int32>& Cell : GridCells)
+	{
+		Bytes += Cell.GetAllocatedSize();
+	}
+	return Bytes;
+}
+
+bool UHighlightRegistrySubsystem::PickAtScreenPosition(APlayerController* PC, const FVector2D& ScreenPosition, FHitResult& OutHit)
+{
+	HIGHLIGHT_TRACE_SCOPE(UHighlightRegistrySubsystem::PickAtScreenPosition);
+	if (!BuildScreenSpace(PC))
+	{
+		return false;
+	}
+
+	const FIntPoint Cell(
+		FMath::FloorToInt((ScreenPosition.X - GridOrigin.X) / CellSizePx),
+		FMath::FloorToInt((ScreenPosition.Y - GridOrigin.Y) / CellSizePx));
+	if (Cell.X < 0 || Cell.Y < 0 || Cell.X >= GridSize.X || Cell.Y >= GridSize.Y)
+	{
+		return false;
+	}
+
+	// Nearest candidate whose rect contains the cursor.
+	const FScreenEntry* Best = nullptr;
+	for (const int32 EntryIndex : GridCells[Cell.Y * GridSize.X + Cell.X])
+	{
+		const FScreenEntry& Entry = ScreenEntries[EntryIndex];
+		if (Entry.Rect.IsInside(ScreenPosition) && (!Best || Entry.DepthSq < Best->DepthSq))
+		{
+			Best = &Entry;
+		}
+	}
+
+	AActor* Actor = Best ? Actors[Best->ActorIndex].Get() : nullptr;
+	if (!Actor)
+	{
+		return false;
+	}
+
+	OutHit = FHitResult(Actor, Cast<UPrimitiveComponent>(Actor->GetRootComponent()), Best->WorldCenter,
+		(ViewOrigin - Best->WorldCenter).GetSafeNormal());
+	OutHit.bBlockingHit = true;
+	OutHit.Distance = FMath::Sqrt(Best->DepthSq);
+	return true;
+}
+
+bool UHighlightRegistrySubsystem::BuildScreenSpace(APlayerController* PC)
+{
+	if (BuiltFrame == GFrameCounter && BuiltFor == PC)
+	{
+		return GridSize.X > 0;
+	}
+
+	HIGHLIGHT_SCOPE_CYCLE_COUNTER(ScreenSpaceBuild);
+
+	BuiltFrame = GFrameCounter;
+	BuiltFor = PC;
+	ScreenEntries.Reset();
+	GridSize = FIntPoint::ZeroValue;
+
+	ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+	if (!LocalPlayer || !LocalPlayer->ViewportClient || !LocalPlayer->ViewportClient->Viewport)
+	{
+		return false;
+	}
+
+	// One projection setup for the whole frame (UGameplayStatics::ProjectWorldToScreen rebuilds it per call).
+	FSceneViewProjectionData ProjectionData;
+	if (!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+	{
+		return false;
+	}
+	const FMatrix ViewProjection = ProjectionData.ComputeViewProjectionMatrix();
+	const FIntRect ViewRect = ProjectionData.GetConstrainedViewRect();
+	ViewOrigin = ProjectionData.ViewOrigin;
+
+	GridOrigin = ViewRect.Min;
+	GridSize = FIntPoint(
+		FMath::DivideAndRoundUp(FMath::Max(ViewRect.Width(), 1), CellSizePx),
+		FMath::DivideAndRoundUp(FMath::Max(ViewRect.Height(), 1), CellSizePx));
+	GridCells.SetNum(GridSize.X * GridSize.Y, EAllowShrinking::No);
+	for (TArray<int32>& Cell : GridCells)
+	{
+		Cell.Reset();
+	}
+
+	for (int32 ActorIndex = 0; ActorIndex < Actors.Num(); ++ActorIndex)
+	{
+		const AActor* Actor = Actors[ActorIndex].Get();
+		if (!Actor || Actor->IsHidden() || !LocalBounds[ActorIndex].IsValid)
+		{
+			continue;
+		}
+
+		const FBox WorldBox = LocalBounds[ActorIndex].TransformBy(Actor->GetActorTransform());
+		const FVector Min = WorldBox.Min;
+		const FVector Max = WorldBox.Max;
+
+		// Screen rect of the 8 corners; skip boxes that cross the near plane (behind the camera).
+		FBox2D Rect(ForceInit);
+		bool bAllInFront = true;
+		for (int32 Corner = 0; Corner < 8 && bAllInFront; ++Corner)
+		{
+			const FVector Point(
+				(Corner & 1) ? Max.X : Min.X,
+				(Corner & 2) ? Max.Y : Min.Y,
+				(Corner & 4) ? Max.Z : Min.Z);
+			FVector2D Screen;
+			bAllInFront = FSceneView::ProjectWorldToScreen(Point, ViewRect, ViewProjection, Screen);
+			Rect += Screen;
+		}
+		if (!bAllInFront)
+		{
+			continue;
+		}
+
+		// Cull fully off-screen rects, then bin into every overlapped cell.
+		const FIntPoint MinCell(
+			FMath::FloorToInt((Rect.Min.X - GridOrigin.X) / CellSizePx),
+			FMath::FloorToInt((Rect.Min.Y - GridOrigin.Y) / CellSizePx));
+		const FIntPoint MaxCell(
+			FMath::FloorToInt((Rect.Max.X - GridOrigin.X) / CellSizePx),
+			FMath::FloorToInt((Rect.Max.Y - GridOrigin.Y) / CellSizePx));
+		if (MaxCell.X < 0 || MaxCell.Y < 0 || MinCell.X >= GridSize.X || MinCell.Y >= GridSize.Y)
+		{
+			continue;
+		}
+
+		const int32 EntryIndex = ScreenEntries.Num();
+		FScreenEntry& Entry = ScreenEntries.AddDefaulted_GetRef();
+		Entry.ActorIndex = ActorIndex;
+		Entry.Rect = Rect;
+		Entry.WorldCenter = WorldBox.GetCenter();
+		Entry.DepthSq = FVector::DistSquared(ViewOrigin, Entry.WorldCenter);
+
+		for (int32 Y = FMath::Max(MinCell.Y, 0); Y <= FMath::Min(MaxCell.Y, GridSize.Y - 1); ++Y)
+		{
+			for (int32 X = FMath::Max(MinCell.X, 0); X <= FMath::Min(MaxCell.X, GridSize.X - 1); ++X)
+			{
+				GridCells[Y * GridSize.X + X].Add(EntryIndex);
+			}
+		}
+	}
+
+	return true;
+}
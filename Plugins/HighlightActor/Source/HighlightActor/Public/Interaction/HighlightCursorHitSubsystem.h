@@ -0,0 +1,110 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+#include "Subsystems/LocalPlayerSubsystem.h"
+#include "HighlightCursorHitSubsystem.generated.h"
+
+class APlayerController;
+
+/**
+ * UHighlightCursorHitSubsystem
+ *
+ * Purpose:
+ * - Per-local-player cursor hit provider shared by every system that needs "what is under the mouse".
+ * - Deprojects the cursor once per camera update and runs at most one line trace per camera update per query
+ *   (channel + complex flag + distance). Repeated requests in the same frame return the cached FHitResult.
+ * - Results are keyed on the frame and the camera cache time, so a late-frame consumer (after UpdateCameraManager,
+ *   e.g. UHighlightInteraction::bLateCursorSampling) never gets a ray deprojected with last frame's view.
+ * - Shared channel set (SetSharedChannels): queries on any channel of the set are answered by ONE multi-object
+ *   trace per frame. Each channel's hit is the nearest component along the ray that blocks that channel, exactly
+ *   what a single-channel trace would stop at. So highlighting (HIGHLIGHTABLE) and click-to-move (NAVIGATION) share one
+ *   physics query per frame instead of one each. The shared trace is cached per complex flag, so consumers that
+ *   disagree on bTraceComplex cost at most one trace each per frame instead of retracing on every request.
+ * - Every trace ignores the controller's pawn, so the cursor never resolves to the avatar under it.
+ *
+ * Consumers:
+ * - UCursorTraceStrategy (HIGHLIGHTABLE channel) for hover highlighting.
+ * - Game code forwarding the NAVIGATION-channel hit to UClickToMoveComponent::OnClickHeld via InHitResult
+ *   (or its late cursor hit provider).
+ */
+UCLASS()
+class HIGHLIGHTACTOR_API UHighlightCursorHitSubsystem : public ULocalPlayerSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the subsystem for the controller's local player (null for remote/server-side controllers). */
+	static UHighlightCursorHitSubsystem* Get(const APlayerController* PC);
+
+	/**
+	 * Returns the cursor hit for the given channel, tracing at most once per frame for each distinct query.
+	 * @param PC            Local player controller used to deproject the cursor.
+	 * @param Channel       Trace channel to test against.
+	 * @param bTraceComplex Whether to trace against complex collision.
+	 * @param TraceDistance Length of the ray from the deprojected cursor origin.
+	 * @param OutHit        Cached (or freshly traced) hit result for this frame.
+	 * @return true if the trace produced a blocking hit.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Highlight|Trace")
+	bool GetCursorHit(APlayerController* PC, ECollisionChannel Channel, bool bTraceComplex, float TraceDistance, FHitResult& OutHit);
+
+	/**
+	 * Channels answered from the one shared trace per frame (e.g., HIGHLIGHTABLE and the click-to-move channel).
+	 * The shared ray is at least MinTraceDistance long, so consumers asking for different lengths still share it.
+	 */
+	void SetSharedChannels(TConstArrayView<TEnumAsByte<ECollisionChannel>> Channels, float MinTraceDistance);
+
+private:
+	/** One cached trace result, valid for the frame it was produced in. */
+	struct FCursorHitEntry
+	{
+		TEnumAsByte<ECollisionChannel> Channel = ECC_Visibility;
+		bool bTraceComplex = false;
+		float TraceDistance = 0.f;
+		uint64 FrameNumber = 0;
+		float CameraTime = 0.f;
+		bool bHit = false;
+		FHitResult Hit;
+	};
+
+	/** Deprojects the cursor for this frame and camera update (cached); returns false if the cursor is not over the viewport. */
+	bool UpdateCursorRay(const APlayerController* PC, float CameraTime);
+
+	/** Camera cache time of PC's camera manager (changes once UpdateCameraManager has run this frame). */
+	static float GetCameraTime(const APlayerController* PC);
+
+	/** Cached results, one per distinct query; only a handful of channels are ever requested. */
+	TArray<FCursorHitEntry, TInlineAllocator<4>> Entries;
+
+	/** Run (or reuse) this frame's shared trace and pick Channel's blocking hit from it. */
+	bool GetSharedChannelHit(const APlayerController* PC, ECollisionChannel Channel, bool bTraceComplex, float TraceDistance,
+		float CameraTime, FHitResult& OutHit);
+
+	/** Channels served by the shared trace. */
+	TArray<TEnumAsByte<ECollisionChannel>, TInlineAllocator<4>> SharedChannels;
+
+	/** One frame's shared trace: every component along the ray (nearest first) and when / how far it was run. */
+	struct FSharedTrace
+	{
+		TArray<FHitResult> Hits;
+		uint64 FrameNumber = MAX_uint64;
+		float CameraTime = 0.f;
+		float TraceDistance = 0.f;
+	};
+
+	/** Shared traces indexed by the complex flag (simple, complex). */
+	FSharedTrace SharedTraces[2];
+	float SharedMinTraceDistance = 0.f;
+
+	/** Frame-cached cursor ray (world origin + direction). */
+	uint64 RayFrameNumber = MAX_uint64;
+	float RayCameraTime = 0.f;
+	bool bRayValid = false;
+	FVector RayOrigin = FVector::ZeroVector;
+	FVector RayDirection = FVector::ForwardVector;
+};
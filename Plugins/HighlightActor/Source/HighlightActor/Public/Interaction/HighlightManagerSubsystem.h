@@ -0,0 +1,67 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HighlightManagerSubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * UHighlightManagerSubsystem
+ *
+ * Purpose:
+ * - Batches custom-depth (outline) changes so highlight callbacks never touch render state directly.
+ *
+ * How it works:
+ * - RequestCustomDepth records the desired state per component (last request in a frame wins).
+ * - Tick (after actor/component ticks, before rendering) applies each component's final state once and skips
+ *   components already in that state, so highlight/unhighlight pairs within one frame cost nothing.
+ */
+UCLASS()
+class HIGHLIGHTACTOR_API UHighlightManagerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UHighlightManagerSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Queue a custom-depth change for Component (applied at the end of the frame).
+	 * Falls back to applying immediately when the component's world has no manager.
+	 * @param bRenderCustomDepth Whether the component should render into custom depth.
+	 * @param StencilValue       Stencil written while rendering custom depth (ignored when disabling).
+	 */
+	static void RequestCustomDepth(UPrimitiveComponent* Component, bool bRenderCustomDepth, int32 StencilValue = 0);
+
+	/** Apply every queued change now (e.g., before a capture that must see the current outlines). */
+	void FlushPendingChanges();
+
+	/** Heap bytes of the queued custom-depth changes. */
+	SIZE_T GetAllocatedSize() const { return Pending.GetAllocatedSize(); }
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Pending.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** Desired end-of-frame state for one component. */
+	struct FCustomDepthRequest
+	{
+		bool bRenderCustomDepth = false;
+		int32 StencilValue = 0;
+	};
+
+	/** Set only what differs from the component's current state. */
+	static void ApplyCustomDepth(UPrimitiveComponent* Component, const FCustomDepthRequest& Request);
+
+	/** Pending requests, keyed by component. */
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, FCustomDepthRequest> Pending;
+};
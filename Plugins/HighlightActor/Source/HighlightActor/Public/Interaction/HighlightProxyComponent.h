@@ -0,0 +1,47 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/CapsuleComponent.h"
+#include "HighlightProxyComponent.generated.h"
+
+class UShapeComponent;
+
+/**
+ * UHighlightProxyComponent
+ *
+ * Purpose:
+ * - Cheap query-only capsule that is the only thing on a highlightable actor responding to HIGHLIGHTABLE.
+ *   Hover traces then hit one simple capsule instead of per-triangle skeletal/static mesh collision.
+ *
+ * Usage:
+ * - Add to a highlightable actor and set its meshes to ignore HIGHLIGHTABLE.
+ * - bMatchOwnerCapsule sizes it from the owner's root capsule (characters) plus ProxyPadding.
+ * - For a box (props, chests), use any UBoxComponent and call ConfigureAsHighlightProxy on it.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class HIGHLIGHTACTOR_API UHighlightProxyComponent : public UCapsuleComponent
+{
+	GENERATED_BODY()
+
+public:
+	UHighlightProxyComponent(const FObjectInitializer& ObjectInitializer);
+
+	/** Make Shape a highlight proxy: query-only, ignores every channel except HIGHLIGHTABLE, no overlaps/nav. */
+	UFUNCTION(BlueprintCallable, Category="Highlight|Proxy")
+	static void ConfigureAsHighlightProxy(UShapeComponent* Shape);
+
+	/** Copy the owner's root capsule size (if the root is a capsule) on register. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Highlight|Proxy")
+	bool bMatchOwnerCapsule = true;
+
+	/** Extra radius/half-height (cm) over the owner's capsule; a slightly larger target is easier to hover. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Highlight|Proxy", meta=(ClampMin="0.0", EditCondition="bMatchOwnerCapsule"))
+	float ProxyPadding = 10.f;
+
+protected:
+	virtual void OnRegister() override;
+};
@@ -0,0 +1,94 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HighlightRegistrySubsystem.generated.h"
+
+class AActor;
+class APlayerController;
+
+/**
+ * UHighlightRegistrySubsystem
+ *
+ * Purpose:
+ * - Registry of highlightable actors (IHighlightInterface) for physics-free, screen-space hover picking
+ *   (EHighlightDetectionMode::ScreenSpaceBounds).
+ *
+ * How it works:
+ * - Actors register on BeginPlay (and unregister on EndPlay). Their component bounds are cached in local space
+ *   once at registration; the interface check happens there too, never per hover change.
+ * - The first pick of a frame projects every registered actor's bounds to screen once (one view-projection matrix,
+ *   8 corners per actor) and bins the screen rects into a uniform 2D grid. Picks then only test one grid cell.
+ * - Overlapping candidates are depth-ordered: the actor whose bounds center is closest to the view wins.
+ */
+UCLASS()
+class HIGHLIGHTACTOR_API UHighlightRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UHighlightRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	/** Register a highlightable actor (must implement IHighlightInterface). Safe to call more than once. */
+	UFUNCTION(BlueprintCallable, Category="Highlight|Registry")
+	void RegisterActor(AActor* Actor);
+
+	/** Remove an actor from the registry (e.g., EndPlay). */
+	UFUNCTION(BlueprintCallable, Category="Highlight|Registry")
+	void UnregisterActor(AActor* Actor);
+
+	/** Re-cache an actor's local bounds (after swapping meshes/weapons). */
+	UFUNCTION(BlueprintCallable, Category="Highlight|Registry")
+	void RefreshActorBounds(AActor* Actor);
+
+	/**
+	 * Pick the nearest registered actor whose screen-space bounds contain the cursor.
+	 * @return true if an actor was found; OutHit carries the actor, its root primitive and its bounds center.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Highlight|Trace")
+	bool PickUnderCursor(APlayerController* PC, FHitResult& OutHit);
+
+	/** Same as PickUnderCursor for an explicit viewport position (pixels). */
+	bool PickAtScreenPosition(APlayerController* PC, const FVector2D& ScreenPosition, FHitResult& OutHit);
+
+	/** Number of registered actors. */
+	int32 GetNumRegistered() const { return Actors.Num(); }
+
+	/** Heap bytes of the registered bounds and the per-frame screen grid. */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	/** One registered actor's projected rectangle for the current frame. */
+	struct FScreenEntry
+	{
+		int32 ActorIndex = INDEX_NONE;
+		FBox2D Rect = FBox2D(ForceInit);
+		float DepthSq = 0.f;
+		FVector WorldCenter = FVector::ZeroVector;
+	};
+
+	/** Project all registered bounds and rebuild the grid for PC's view (once per frame per controller). */
+	bool BuildScreenSpace(APlayerController* PC);
+
+	// Registered actors and their cached local-space bounds (parallel arrays, swap-removed).
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	TArray<FBox> LocalBounds;
+
+	// Per-frame screen data.
+	TArray<FScreenEntry> ScreenEntries;
+	TArray<TArray<int32>> GridCells;     // indices into ScreenEntries
+	FIntPoint GridSize = FIntPoint::ZeroValue;
+	FIntPoint GridOrigin = FIntPoint::ZeroValue;
+	FVector ViewOrigin = FVector::ZeroVector;
+	uint64 BuiltFrame = MAX_uint64;
+	TWeakObjectPtr<APlayerController> BuiltFor;
+
+	/** Grid cell size in pixels; a handful of actors per cell on a typical top-down screen. */
+	static constexpr int32 CellSizePx = 64;
+};
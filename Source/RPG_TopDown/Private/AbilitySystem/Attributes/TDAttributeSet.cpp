@@ -1,165 +1,148 @@
 #include "AbilitySystem/Attributes/TDAttributeSet.h"
 
 #include "TDGameplayTags.h"
+#include "AbilitySystem/Formulas/GASCoreAttributeFormulas.h"
+#include "GameplayEffectExtension.h"
+#include "Subsystems/GASCoreGameplayCueBatchSubsystem.h"
 #include "Net/UnrealNetwork.h"
 
 UTDAttributeSet::UTDAttributeSet()
 {
-	// Register current↔max pairs once; base class handles all clamping and rounding consistently.
-	// This centralizes the rule: Current ∈ [0, Max] and ensures policy is enforced in Pre/Post callbacks.
-	RegisterCurrentMaxPair(GetHealthAttribute(),   GetMaxHealthAttribute());
-	RegisterCurrentMaxPair(GetManaAttribute(),     GetMaxManaAttribute());
-	RegisterCurrentMaxPair(GetStaminaAttribute(),  GetMaxStaminaAttribute());
+	// Current↔Max pairs are class metadata now (ConfigureAttributeMetadata), so instances build nothing here.
+}
+
+TConstArrayView<FGASCoreAttributeSchemaRow> UTDAttributeSet::GetAttributeSchema()
+{
+	static const FGASCoreAttributeSchemaRow Schema[] = { TD_ATTRIBUTE_SCHEMA(GASCORE_ATTRIBUTE_SCHEMA_ROW, UTDAttributeSet) };
+	return Schema;
+}
+
+void UTDAttributeSet::ConfigureAttributeMetadata(FGASCoreAttributeMetadataBuilder& Builder) const
+{
+	Super::ConfigureAttributeMetadata(Builder);
+
+	// Schema rows: Current↔Max pairs (Current ∈ [0, Max], enforced by the base Pre/Post callbacks), native
+	// regeneration (UGASCoreRegenerationSubsystem) and decimals (vitals use integer storage: fixed-point memory,
+	// small varints on the wire).
+	Builder.ApplySchema(GetAttributeSchema());
+
+	// Damage execution output (UGASCoreExecCalcDamage) → Health.
+	Builder.RegisterIncomingDamage(GetIncomingDamageAttribute(), GetHealthAttribute());
+
+	// Same formulas for batched initialization (FGASCoreAttributeBatchInitializer, wave spawns).
+	Builder.BindFormulaInputs(GetStrengthAttribute(), GetDexterityAttribute(), GetIntelligenceAttribute(),
+		GetEnduranceAttribute(), GetVigorAttribute());
+	Builder.BindFormulaOutput(EGASCoreSecondaryFormula::Armor,                 GetArmorAttribute());
+	Builder.BindFormulaOutput(EGASCoreSecondaryFormula::ArmorPenetration,      GetArmorPenetrationAttribute());
+	Builder.BindFormulaOutput(EGASCoreSecondaryFormula::BlockChance,           GetBlockChanceAttribute());
+	Builder.BindFormulaOutput(EGASCoreSecondaryFormula::CriticalHitChance,     GetCriticalHitChanceAttribute());
+	Builder.BindFormulaOutput(EGASCoreSecondaryFormula::CriticalHitDamage,     GetCriticalHitDamageAttribute());
+	Builder.BindFormulaOutput(EGASCoreSecondaryFormula::CriticalHitResistance, GetCriticalHitResistanceAttribute());
+	Builder.BindFormulaOutput(EGASCoreSecondaryFormula::MaxHealth,             GetMaxHealthAttribute());
+	Builder.BindFormulaOutput(EGASCoreSecondaryFormula::HealthRegeneration,    GetHealthRegenerationAttribute());
+	Builder.BindFormulaOutput(EGASCoreSecondaryFormula::MaxMana,               GetMaxManaAttribute());
+	Builder.BindFormulaOutput(EGASCoreSecondaryFormula::ManaRegeneration,      GetManaRegenerationAttribute());
+	Builder.BindFormulaOutput(EGASCoreSecondaryFormula::MaxStamina,            GetMaxStaminaAttribute());
+	Builder.BindFormulaOutput(EGASCoreSecondaryFormula::StaminaRegeneration,   GetStaminaRegenerationAttribute());
+
+	// Derived (secondary) attributes: the native GDD formulas (GASCoreFormulas) with the default coefficient table.
+	// Only instances that enable the graph (SetEvaluateDerivedAttributes) evaluate these; players still derive them
+	// through the secondary MMC GE.
+	using namespace GASCoreFormulas;
+	Builder.DeclareDerivedAttribute(GetArmorAttribute(), { GetEnduranceAttribute() },
+		[](const UGASCoreAttributeSet& Set) { return Armor(static_cast<const ThisClass&>(Set).GetEndurance(), FCoefficients::GetDefault()); });
+	Builder.DeclareDerivedAttribute(GetArmorPenetrationAttribute(), { GetStrengthAttribute() },
+		[](const UGASCoreAttributeSet& Set) { return ArmorPenetration(static_cast<const ThisClass&>(Set).GetStrength(), FCoefficients::GetDefault()); });
+	Builder.DeclareDerivedAttribute(GetBlockChanceAttribute(), { GetArmorAttribute() },
+		[](const UGASCoreAttributeSet& Set) { return BlockChance(static_cast<const ThisClass&>(Set).GetArmor(), FCoefficients::GetDefault()); });
+	Builder.DeclareDerivedAttribute(GetCriticalHitChanceAttribute(), { GetDexterityAttribute(), GetArmorPenetrationAttribute() },
+		[](const UGASCoreAttributeSet& Set)
+		{
+			const ThisClass& S = static_cast<const ThisClass&>(Set);
+			return CriticalHitChance(S.GetDexterity(), S.GetArmorPenetration(), FCoefficients::GetDefault());
+		});
+	Builder.DeclareDerivedAttribute(GetCriticalHitDamageAttribute(), { GetDexterityAttribute(), GetArmorPenetrationAttribute() },
+		[](const UGASCoreAttributeSet& Set)
+		{
+			const ThisClass& S = static_cast<const ThisClass&>(Set);
+			return CriticalHitDamage(S.GetDexterity(), S.GetArmorPenetration(), FCoefficients::GetDefault());
+		});
+	Builder.DeclareDerivedAttribute(GetCriticalHitResistanceAttribute(), { GetArmorAttribute() },
+		[](const UGASCoreAttributeSet& Set) { return CriticalHitResistance(static_cast<const ThisClass&>(Set).GetArmor(), FCoefficients::GetDefault()); });
+	Builder.DeclareDerivedAttribute(GetMaxHealthAttribute(), { GetVigorAttribute() },
+		[](const UGASCoreAttributeSet& Set) { return MaxHealth(static_cast<const ThisClass&>(Set).GetVigor(), FCoefficients::GetDefault()); });
+	Builder.DeclareDerivedAttribute(GetHealthRegenerationAttribute(), { GetVigorAttribute() },
+		[](const UGASCoreAttributeSet& Set) { return HealthRegeneration(static_cast<const ThisClass&>(Set).GetVigor(), FCoefficients::GetDefault()); });
+	Builder.DeclareDerivedAttribute(GetMaxManaAttribute(), { GetIntelligenceAttribute() },
+		[](const UGASCoreAttributeSet& Set) { return MaxMana(static_cast<const ThisClass&>(Set).GetIntelligence(), FCoefficients::GetDefault()); });
+	Builder.DeclareDerivedAttribute(GetManaRegenerationAttribute(), { GetIntelligenceAttribute() },
+		[](const UGASCoreAttributeSet& Set) { return ManaRegeneration(static_cast<const ThisClass&>(Set).GetIntelligence(), FCoefficients::GetDefault()); });
+	Builder.DeclareDerivedAttribute(GetMaxStaminaAttribute(), { GetVigorAttribute() },
+		[](const UGASCoreAttributeSet& Set) { return MaxStamina(static_cast<const ThisClass&>(Set).GetVigor(), FCoefficients::GetDefault()); });
+	Builder.DeclareDerivedAttribute(GetStaminaRegenerationAttribute(), { GetVigorAttribute() },
+		[](const UGASCoreAttributeSet& Set) { return StaminaRegeneration(static_cast<const ThisClass&>(Set).GetVigor(), FCoefficients::GetDefault()); });
+}
+
+void UTDAttributeSet::OnIncomingDamageApplied(const FGameplayAttribute& TargetAttr, const float Damage, const float OldValue,
+	const float NewValue, const FGameplayEffectModCallbackData& Data)
+{
+	Super::OnIncomingDamageApplied(TargetAttr, Damage, OldValue, NewValue, Data);
+
+	// Damage numbers ride the batched cue bursts: one unreliable multicast per cell per frame, not per hit.
+	const AActor* Avatar = Data.Target.GetAvatarActor();
+	UGASCoreGameplayCueBatchSubsystem* CueBatch = UGASCoreGameplayCueBatchSubsystem::Get(Avatar);
+	if (!CueBatch || Damage <= 0.f)
+	{
+		return;
+	}
+
+	const FVector Location = Avatar->GetActorLocation() + FVector(0.f, 0.f, Avatar->GetSimpleCollisionHalfHeight());
+	CueBatch->QueueCue(FTDGameplayTags::Get().GameplayCue_CombatText_Damage, Location, FVector::UpVector, Damage);
 }
 
 void UTDAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	// ===================
-	// Primary Attributes 
-	// ===================
+	// COND_Dynamic → the effective condition is per instance (tier policy, see GetReplicatedCustomConditionState).
 	// REPNOTIFY_Always → even equivalent values still trigger OnRep for prediction/UI reconciliation.
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, Strength,     COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, Dexterity,    COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, Intelligence, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, Endurance,    COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, Vigor,        COND_None, REPNOTIFY_Always);
-
-	// ===================
-	// Secondary Attributes 
-	// ===================
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, Armor,                 COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, ArmorPenetration,     COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, BlockChance,          COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, CriticalHitChance,    COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, CriticalHitDamage,    COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, CriticalHitResistance,COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, HealthRegeneration,   COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, MaxHealth,            COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, ManaRegeneration,     COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, MaxMana,              COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, StaminaRegeneration,  COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, MaxStamina,           COND_None, REPNOTIFY_Always);
-
-	// ===================
-	// Vital Attributes
-	// ===================
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, Health,  COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, Mana,    COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UTDAttributeSet, Stamina, COND_None, REPNOTIFY_Always);
-}
-
-// =======================================
-// Primary Attributes Rep Notify Functions
-// =======================================
-
-void UTDAttributeSet::OnRep_Strength(const FGameplayAttributeData& OldStrength) const
-{
-	// Macro emits ASC->HandleGameplayAttributeValuesChange notifications.
-	// Listeners (UI, prediction systems) will be informed of the updated value.
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, Strength, OldStrength);
-}
-
-void UTDAttributeSet::OnRep_Dexterity(const FGameplayAttributeData& OldDexterity) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, Dexterity, OldDexterity);
-}
-
-void UTDAttributeSet::OnRep_Intelligence(const FGameplayAttributeData& OldIntelligence) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, Intelligence, OldIntelligence);
-}
-
-void UTDAttributeSet::OnRep_Endurance(const FGameplayAttributeData& OldEndurance) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, Endurance, OldEndurance);
-}
-
-void UTDAttributeSet::OnRep_Vigor(const FGameplayAttributeData& OldVigor) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, Vigor, OldVigor);
-}
-
-// =======================================
-// Secondary Attributes Rep Notify Functions
-// =======================================
-
-void UTDAttributeSet::OnRep_Armor(const FGameplayAttributeData& OldArmor) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, Armor, OldArmor);
-}
+	// Push-based → only compared after the base set marks them dirty (Post[Base]AttributeChange).
+	FDoRepLifetimeParams Params;
+	Params.Condition = COND_Dynamic;
+	Params.RepNotifyCondition = REPNOTIFY_Always;
+	Params.bIsPushBased = true;
 
-void UTDAttributeSet::OnRep_ArmorPenetration(const FGameplayAttributeData& OldArmorPenetration) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, ArmorPenetration, OldArmorPenetration);
+	TD_ATTRIBUTE_SCHEMA(GASCORE_ATTRIBUTE_SCHEMA_LIFETIME, UTDAttributeSet)
 }
 
-void UTDAttributeSet::OnRep_BlockChance(const FGameplayAttributeData& OldBlockChance) const
+void UTDAttributeSet::GetReplicatedCustomConditionState(FCustomPropertyConditionState& OutActiveState) const
 {
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, BlockChance, OldBlockChance);
-}
+	Super::GetReplicatedCustomConditionState(OutActiveState);
 
-void UTDAttributeSet::OnRep_CriticalHitChance(const FGameplayAttributeData& OldCriticalHitChance) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, CriticalHitChance, OldCriticalHitChance);
+	TD_ATTRIBUTE_SCHEMA(GASCORE_ATTRIBUTE_SCHEMA_CONDITION, UTDAttributeSet)
 }
 
-void UTDAttributeSet::OnRep_CriticalHitDamage(const FGameplayAttributeData& OldCriticalHitDamage) const
+void UTDAttributeSet::SetTierReplicationCondition(const ETDAttributeTier Tier, const ELifetimeCondition Condition)
 {
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, CriticalHitDamage, OldCriticalHitDamage);
+	check(Tier < ETDAttributeTier::MAX);
+	TierConditions[static_cast<uint8>(Tier)] = Condition;
 }
 
-void UTDAttributeSet::OnRep_CriticalHitResistance(const FGameplayAttributeData& OldCriticalHitResistance) const
+ELifetimeCondition UTDAttributeSet::GetAttributeReplicationCondition(const FGameplayAttribute& Attribute) const
 {
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, CriticalHitResistance, OldCriticalHitResistance);
+	TD_ATTRIBUTE_SCHEMA(GASCORE_ATTRIBUTE_SCHEMA_CURRENT_CONDITION, UTDAttributeSet)
+	return Super::GetAttributeReplicationCondition(Attribute);
 }
 
-void UTDAttributeSet::OnRep_HealthRegeneration(const FGameplayAttributeData& OldHealthRegeneration) const
+void UTDAttributeSet::OnAttributeLeftInitialization(const FGameplayAttribute& Attribute) const
 {
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, HealthRegeneration, OldHealthRegeneration);
-}
-
-void UTDAttributeSet::OnRep_MaxHealth(const FGameplayAttributeData& OldMaxHealth) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, MaxHealth, OldMaxHealth);
-}
-
-void UTDAttributeSet::OnRep_ManaRegeneration(const FGameplayAttributeData& OldManaRegeneration) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, ManaRegeneration, OldManaRegeneration);
-}
-
-void UTDAttributeSet::OnRep_MaxMana(const FGameplayAttributeData& OldMaxMana) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, MaxMana, OldMaxMana);
-}
-
-void UTDAttributeSet::OnRep_StaminaRegeneration(const FGameplayAttributeData& OldStaminaRegeneration) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, StaminaRegeneration, OldStaminaRegeneration);
-}
-
-void UTDAttributeSet::OnRep_MaxStamina(const FGameplayAttributeData& OldMaxStamina) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, MaxStamina, OldMaxStamina);
+	TD_ATTRIBUTE_SCHEMA(GASCORE_ATTRIBUTE_SCHEMA_LIVE_CONDITION, UTDAttributeSet)
 }
 
 // =======================================
-// Vital Attributes Rep Notify Functions
+// Rep Notify Functions
 // =======================================
 
-void UTDAttributeSet::OnRep_Health(const FGameplayAttributeData& OldHealth) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, Health, OldHealth);
-}
-
-void UTDAttributeSet::OnRep_Mana(const FGameplayAttributeData& OldMana) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, Mana, OldMana);
-}
-
-void UTDAttributeSet::OnRep_Stamina(const FGameplayAttributeData& OldStamina) const
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UTDAttributeSet, Stamina, OldStamina);
-}
\ No newline at end of file
+// GAMEPLAYATTRIBUTE_REPNOTIFY emits ASC->HandleGameplayAttributeValuesChange notifications so listeners
+// (UI, prediction systems) are informed of the updated value.
+TD_ATTRIBUTE_SCHEMA(GASCORE_ATTRIBUTE_SCHEMA_REPNOTIFY, UTDAttributeSet)
@@ -4,15 +4,23 @@
 #include "AbilitySystem/Components/TDAbilitySystemComponent.h"
 
 #include "TDGameplayTags.h"
+#include "Net/Core/PropertyConditions/PropertyConditions.h"
+#include "Net/UnrealNetwork.h"
 
 
 UTDAbilitySystemComponent::UTDAbilitySystemComponent()
 {
+	// No own tick function: ticking ability tasks run through UGASCoreAbilityTickSubsystem
+	// (GASCore.AbilityTick.Consolidate), which only visits the ASC while it has work.
 	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UTDAbilitySystemComponent::BindASCDelegates()
 {
+	if (AreASCDelegatesBound())
+	{
+		return;
+	}
 	Super::BindASCDelegates();
 
 	const FTDGameplayTags& GameplayTags = FTDGameplayTags::Get();
@@ -22,9 +30,28 @@ void UTDAbilitySystemComponent::BindASCDelegates()
 		FString::Printf(TEXT("Tag: %s"), *GameplayTags.Attributes_Secondary_Armor.ToString()));*/
 }
 
-void UTDAbilitySystemComponent::ClientHandleGameplayEffectAppliedToSelf(UAbilitySystemComponent* AbilitySystemComponent,
-	const FGameplayEffectSpec& GameplayEffectSpec, FActiveGameplayEffectHandle ActiveGameplayEffectHandle)
+void UTDAbilitySystemComponent::SetEffectStateReplicationSuppressed(const bool bSuppressed)
 {
-	Super::ClientHandleGameplayEffectAppliedToSelf(AbilitySystemComponent, GameplayEffectSpec, ActiveGameplayEffectHandle);
+	if (bEffectStateReplicationSuppressed == bSuppressed)
+	{
+		return;
+	}
+	bEffectStateReplicationSuppressed = bSuppressed;
+
+	// Same custom conditions the replication mode drives; re-enabled only where the mode replicates them.
+	const EGameplayEffectReplicationMode Mode = ReplicationMode;
+	DOREPCUSTOMCONDITION_SETACTIVE_FAST(UAbilitySystemComponent, ActiveGameplayEffects, !bSuppressed && Mode != EGameplayEffectReplicationMode::Minimal);
+	DOREPCUSTOMCONDITION_SETACTIVE_FAST(UAbilitySystemComponent, MinimalReplicationTags, !bSuppressed && Mode != EGameplayEffectReplicationMode::Full);
 }
 
+void UTDAbilitySystemComponent::GetReplicatedCustomConditionState(FCustomPropertyConditionState& OutActiveState) const
+{
+	Super::GetReplicatedCustomConditionState(OutActiveState);
+
+	// Replicator created while suppressed (e.g., a connection joining a crowded map).
+	if (bEffectStateReplicationSuppressed)
+	{
+		DOREPCUSTOMCONDITION_ACTIVE_FAST(UAbilitySystemComponent, ActiveGameplayEffects, false);
+		DOREPCUSTOMCONDITION_ACTIVE_FAST(UAbilitySystemComponent, MinimalReplicationTags, false);
+	}
+}
@@ -3,6 +3,10 @@
 
 #include "Actors/TDProjectileActor.h"
 
+#include "AbilitySystemComponent.h"
+#include "AbilitySystem/Attributes/TDAttributeSet.h"
+#include "Mass/TDCrowdSubsystem.h"
+
 
 // Sets default values
 ATDProjectileActor::ATDProjectileActor()
@@ -25,3 +29,31 @@ void ATDProjectileActor::OnSphereCollisionOverlap(UPrimitiveComponent* Overlappe
 	                                SweepResult);
 }
 
+void ATDProjectileActor::ApplyImpactRadiusToNonActorTargets(const UWorld* World, const FVector& ImpactPoint,
+	const FGameplayEffectSpecHandle& Spec) const
+{
+	const FGameplayEffectSpec* EffectSpec = Spec.Data.Get();
+	UTDCrowdSubsystem* Crowd = UTDCrowdSubsystem::Get(World);
+	if (!EffectSpec || !Crowd)
+	{
+		return;
+	}
+
+	const float BaseDamage = CrowdDamage.GetValueAtLevel(EffectSpec->GetLevel());
+	if (BaseDamage <= 0.f)
+	{
+		return;
+	}
+
+	// Same source stats the exec calc would capture; crowd defenses come from the entity fragments.
+	float ArmorPenetration = 0.f, CriticalHitChance = 0.f, CriticalHitDamage = 0.f;
+	if (const UAbilitySystemComponent* SourceASC = EffectSpec->GetContext().GetOriginalInstigatorAbilitySystemComponent())
+	{
+		ArmorPenetration = SourceASC->GetNumericAttribute(UTDAttributeSet::GetArmorPenetrationAttribute());
+		CriticalHitChance = SourceASC->GetNumericAttribute(UTDAttributeSet::GetCriticalHitChanceAttribute());
+		CriticalHitDamage = SourceASC->GetNumericAttribute(UTDAttributeSet::GetCriticalHitDamageAttribute());
+	}
+
+	Crowd->ApplyCrowdDamageInRadius(ImpactPoint, ImpactRadius, BaseDamage, ArmorPenetration, CriticalHitChance, CriticalHitDamage);
+}
+
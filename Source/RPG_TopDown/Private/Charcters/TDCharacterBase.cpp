@@ -8,8 +8,14 @@
 #include "AbilitySystem/Components/TDAbilityInitComponent.h"
 #include "AbilitySystem/Components/TDDefaultAttributeInitComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "IAnimationBudgetAllocator.h"
+#include "SkeletalMeshComponentBudgeted.h"
+#include "Subsystems/GASCoreCombatantRegistrySubsystem.h"
+#include "Utilities/GASCoreLogging.h"
 
-ATDCharacterBase::ATDCharacterBase()
+ATDCharacterBase::ATDCharacterBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USkeletalMeshComponentBudgeted>(ACharacter::MeshComponentName))
 {
 	// Disable tick by default for performance. Subclasses can enable as needed.
 	PrimaryActorTick.bCanEverTick = false;
@@ -28,11 +34,34 @@ ATDCharacterBase::ATDCharacterBase()
 
 void ATDCharacterBase::BeginPlay()
 {
+	// Before Super: the body mesh registers with the allocator in its own BeginPlay.
+	if (USkeletalMeshComponentBudgeted* BudgetedMesh = Cast<USkeletalMeshComponentBudgeted>(GetMesh()))
+	{
+		BudgetedMesh->SetAutoRegisterWithBudgetAllocator(bUseAnimationBudget);
+	}
+	SetupWeaponMesh();
+
 	Super::BeginPlay();
 
+	// Damageable combatant for homing/targeting queries (server and clients).
+	if (UGASCoreCombatantRegistrySubsystem* CombatantRegistry = UGASCoreCombatantRegistrySubsystem::Get(this))
+	{
+		CombatantRegistry->RegisterCombatant(this);
+	}
+
 	// Post-begin initialization for GAS can be placed here or in possession/OnRep_PlayerState for players.
 }
 
+void ATDCharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGASCoreCombatantRegistrySubsystem* CombatantRegistry = UGASCoreCombatantRegistrySubsystem::Get(this))
+	{
+		CombatantRegistry->UnregisterCombatant(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ATDCharacterBase::InitializeAbilityActorInfo()
 {
 	// Intended for subclasses:
@@ -49,11 +78,84 @@ UAbilitySystemComponent* ATDCharacterBase::GetAbilitySystemComponent() const
 
 FVector ATDCharacterBase::GetAbilitySpawnLocation()
 {
-	check(WeaponMesh)
-	return WeaponMesh->GetSocketLocation(WeaponAbilitySpawnSocketName);
+	const UMeshComponent* Weapon = GetWeaponComponent();
+	check(Weapon)
+	return Weapon->GetSocketLocation(WeaponAbilitySpawnSocketName);
 }
 
 UAttributeSet* ATDCharacterBase::GetAttributeSet() const
 {
 	return AttributeSet;
 }
+
+UMeshComponent* ATDCharacterBase::GetWeaponComponent() const
+{
+	if (WeaponStaticMeshComponent)
+	{
+		return WeaponStaticMeshComponent;
+	}
+	return WeaponMesh;
+}
+
+bool ATDCharacterBase::SetAnimationSignificance(const float Significance, const bool bNeverSkip)
+{
+	if (!IsAnimationBudgeted())
+	{
+		return false;
+	}
+
+	USkeletalMeshComponentBudgeted* BudgetedMesh = CastChecked<USkeletalMeshComponentBudgeted>(GetMesh());
+	IAnimationBudgetAllocator::Get(GetWorld())->SetComponentSignificance(BudgetedMesh, Significance, bNeverSkip);
+	return true;
+}
+
+bool ATDCharacterBase::IsAnimationBudgeted() const
+{
+	const USkeletalMeshComponentBudgeted* BudgetedMesh = Cast<USkeletalMeshComponentBudgeted>(GetMesh());
+	if (!BudgetedMesh || BudgetedMesh->GetAnimationBudgetHandle() == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const IAnimationBudgetAllocator* Allocator = IAnimationBudgetAllocator::Get(GetWorld());
+	return Allocator && Allocator->GetEnabled();
+}
+
+void ATDCharacterBase::SetupWeaponMesh()
+{
+	if (!WeaponMesh)
+	{
+		return;
+	}
+
+	switch (WeaponMeshMode)
+	{
+	case ETDWeaponMeshMode::LeaderPose:
+		// Skinned to the body skeleton: sits at the body root and reuses its bone transforms.
+		WeaponMesh->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+		WeaponMesh->SetLeaderPoseComponent(GetMesh());
+		break;
+
+	case ETDWeaponMeshMode::Static:
+		if (!StaticWeaponMesh)
+		{
+			GASCORE_LOG_WARNING(TEXT("%s: WeaponMeshMode is Static but StaticWeaponMesh is not set; keeping the skeletal weapon."), *GetName());
+			break;
+		}
+
+		WeaponStaticMeshComponent = NewObject<UStaticMeshComponent>(this, TEXT("WeaponStatic"));
+		WeaponStaticMeshComponent->SetStaticMesh(StaticWeaponMesh);
+		WeaponStaticMeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		WeaponStaticMeshComponent->SetupAttachment(WeaponMesh->GetAttachParent(), WeaponMesh->GetAttachSocketName());
+		WeaponStaticMeshComponent->SetRelativeTransform(WeaponMesh->GetRelativeTransform());
+		WeaponStaticMeshComponent->RegisterComponent();
+
+		// No pose, no tick, no render state: the skeletal weapon only keeps its asset for Blueprint reads.
+		WeaponMesh->SetComponentTickEnabled(false);
+		WeaponMesh->UnregisterComponent();
+		break;
+
+	default:
+		break;
+	}
+}
@@ -5,25 +5,66 @@
 #include "Charcters/TDEnemyCharacter.h"
 
 #include "HighlightActor.h"
+#include "Interaction/HighlightManagerSubsystem.h"
+#include "Interaction/HighlightProxyComponent.h"
+#include "Interaction/HighlightRegistrySubsystem.h"
 #include "AbilitySystem/Attributes/TDAttributeSet.h"
+#include "AbilitySystem/Data/GASCoreAttributeArchetypeDataAsset.h"
+#include "Subsystems/GASCoreAttributeBatchSubsystem.h"
+#include "Subsystems/GASCoreCombatantRegistrySubsystem.h"
+#include "Subsystems/GASCoreRegenerationSubsystem.h"
+#include "Subsystems/GASCoreUIOverheadBarSubsystem.h"
+#include "Subsystems/TDEnemyPoolSubsystem.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/MeshComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Game/TDReplicationGraph.h"
 #include "GASCore/Public/AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
+#include "AbilitySystem/Components/TDAbilityInitComponent.h"
 #include "AbilitySystem/Components/TDAbilitySystemComponent.h"
+#include "AbilitySystem/Components/GASCoreThreatComponent.h"
+#include "Charcters/TDPlayerCharacter.h"
+#include "Net/UnrealNetwork.h"
 #include "RPG_TopDown/RPG_TopDown.h"
 
 // Sets default values
-ATDEnemyCharacter::ATDEnemyCharacter()
+ATDEnemyCharacter::ATDEnemyCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
 {
-	// Set mesh collision to respond to the custom highlight channel.
-	GetMesh()->SetCollisionResponseToChannel(HIGHLIGHTABLE, ECR_Block);
+	// Hover traces hit a simple capsule proxy (sized from the character capsule) instead of the skeletal mesh.
+	HighlightProxy = CreateDefaultSubobject<UHighlightProxyComponent>("HighlightProxy");
+	HighlightProxy->SetupAttachment(GetRootComponent());
+	GetMesh()->SetCollisionResponseToChannel(HIGHLIGHTABLE, ECR_Ignore);
+
+	// Target selection from damage and proximity to player characters (server, throttled by UGASCoreThreatSubsystem).
+	ThreatComponent = CreateDefaultSubobject<UGASCoreThreatComponent>("ThreatComponent");
+	ThreatComponent->SetAggroTargetClass(ATDPlayerCharacter::StaticClass());
 
 	// Create the Ability System Component for the AI enemy.
 	// Unlike player characters, AI own their own ASC and AttributeSet.
 	AbilitySystemComponent = CreateDefaultSubobject<UTDAbilitySystemComponent>("AbilitySystemComponent");
 	AbilitySystemComponent->SetIsReplicated(true); // Enable replication for multiplayer.
-	AbilitySystemComponent->SetReplicationMode(EGameplayEffectReplicationMode::Minimal); // Minimal: fewer network updates.
+	AbilitySystemComponent->SetReplicationMode(EGameplayEffectReplicationMode::Minimal); // Class policy applied in PostInitializeComponents.
 
 	// Create the Attribute Set for this AI character.
-	AttributeSet = CreateDefaultSubobject<UTDAttributeSet>("AttributeSet");
+	// Only vitals (health bars) reach clients; primary/secondary stats stay on the server where GE math runs.
+	UTDAttributeSet* TDAttributeSet = CreateDefaultSubobject<UTDAttributeSet>("AttributeSet");
+	TDAttributeSet->SetTierReplicationCondition(ETDAttributeTier::Primary, COND_Never);
+	TDAttributeSet->SetTierReplicationCondition(ETDAttributeTier::Secondary, COND_Never);
+	// Vitals too until they change: clients run the same archetype initialization (archetype + level replicate).
+	TDAttributeSet->SetDeferInitialReplication(true);
+	AttributeSet = TDAttributeSet;
+}
+
+void ATDEnemyCharacter::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// Blueprint class defaults are known now (the constructor used the native default); before replication starts.
+	if (AbilitySystemComponent)
+	{
+		AbilitySystemComponent->SetReplicationMode(AbilitySystemReplicationMode);
+	}
 }
 
 // Called when the game starts or when spawned
@@ -31,9 +72,84 @@ void ATDEnemyCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Initialize the Ability System with this actor as both owner and avatar.
-	// For AI, this is done here since AI owns its own ASC/AttributeSet.
-	InitializeAbilityActorInfo();
+	// Attributes at spawn (health bars, deterministic client init); the rest of GAS waits for ActivateAbilitySystem.
+	RequestArchetypeInitialization();
+	if (!bLazyAbilitySystemActivation || bAbilitySystemAwake)
+	{
+		ActivateAbilitySystem();
+	}
+	else if (UGASCoreAbilitySystemComponent* CoreASC = Cast<UGASCoreAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		// First damage (any effect applied to self) wakes it.
+		CoreASC->OnDemandInitialization.BindUObject(this, &ThisClass::ActivateAbilitySystem);
+	}
+
+	// Full-fidelity values to restore when High; the subsystem lowers them while no player is near or looking.
+	HighMovementTickInterval = GetCharacterMovement()->GetComponentTickInterval();
+	HighMeshTickInterval = GetMesh()->GetComponentTickInterval();
+	HighNetUpdateFrequency = GetNetUpdateFrequency();
+	HighNetPriority = NetPriority;
+
+	// Clients may receive an enemy that is already pooled.
+	if (!bInPool)
+	{
+		RegisterWithWorldSystems();
+	}
+	else
+	{
+		ApplyPoolState();
+	}
+}
+
+void ATDEnemyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterFromWorldSystems();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ATDEnemyCharacter::RegisterWithWorldSystems()
+{
+	// Make this enemy pickable by the screen-space (physics-free) highlight mode.
+	if (UHighlightRegistrySubsystem* Registry = UHighlightRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterActor(this);
+	}
+
+	// Overhead health bar: allocated by the bar manager only while on screen and near, or recently damaged.
+	if (UGASCoreUIOverheadBarSubsystem* OverheadBars = UGASCoreUIOverheadBarSubsystem::Get(this))
+	{
+		OverheadBars->RegisterActor(this, AbilitySystemComponent, UTDAttributeSet::GetHealthAttribute(),
+			UTDAttributeSet::GetMaxHealthAttribute(), GetCapsuleComponent()->GetScaledCapsuleHalfHeight() + OverheadBarOffset);
+	}
+
+	if (bUseSignificance)
+	{
+		if (UTDEnemySignificanceSubsystem* EnemySignificance = UTDEnemySignificanceSubsystem::Get(this))
+		{
+			EnemySignificance->RegisterEnemy(this);
+		}
+	}
+}
+
+void ATDEnemyCharacter::UnregisterFromWorldSystems()
+{
+	if (UHighlightRegistrySubsystem* Registry = UHighlightRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterActor(this);
+	}
+
+	if (UGASCoreUIOverheadBarSubsystem* OverheadBars = UGASCoreUIOverheadBarSubsystem::Get(this))
+	{
+		OverheadBars->UnregisterActor(this);
+	}
+
+	if (UTDEnemySignificanceSubsystem* EnemySignificance = UTDEnemySignificanceSubsystem::Get(this))
+	{
+		EnemySignificance->UnregisterEnemy(this);
+	}
+	SetSignificance(ETDEnemySignificance::High);
+	SetReplicationReduced(false);
 }
 
 void ATDEnemyCharacter::InitializeAbilityActorInfo()
@@ -50,18 +166,250 @@ void ATDEnemyCharacter::InitializeAbilityActorInfo()
 	}
 }
 
+void ATDEnemyCharacter::ActivateAbilitySystem()
+{
+	if (bAbilitySystemInitialized || !AbilitySystemComponent)
+	{
+		return;
+	}
+	bAbilitySystemInitialized = true;
+
+	if (UGASCoreAbilitySystemComponent* CoreASC = Cast<UGASCoreAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		CoreASC->OnDemandInitialization.Unbind();
+	}
+
+	// Initialize the Ability System with this actor as both owner and avatar (AI owns its own ASC/AttributeSet).
+	InitializeAbilityActorInfo();
+
+	if (HasAuthority())
+	{
+		bAbilitySystemAwake = true;
+
+		// Startup grants (cached startup input tags per class); pooled enemies keep theirs across reuse.
+		if (AbilityInitComponent && AbilitySystemComponent->GetActivatableAbilities().IsEmpty())
+		{
+			AbilityInitComponent->AddCharacterAbilities();
+		}
+	}
+}
+
+void ATDEnemyCharacter::OnRep_AbilitySystemAwake()
+{
+	if (bAbilitySystemAwake && HasActorBegunPlay())
+	{
+		ActivateAbilitySystem();
+	}
+}
+
+void ATDEnemyCharacter::RequestArchetypeInitialization()
+{
+	// Base values from the shared archetype table. Queued with every other enemy spawned this frame: secondaries
+	// are evaluated for the whole wave in one SoA pass, then follow the primaries through the set's native
+	// derived-attribute graph (no MMC GE). Clients reproduce it (deterministic) instead of receiving the values.
+	const UGASCoreAttributeSet* CoreSet = Cast<UGASCoreAttributeSet>(AttributeSet);
+	if (AttributeArchetype == InitializedArchetype.Get() && EnemyCharacterLevel == InitializedLevel)
+	{
+		return;
+	}
+	if (AttributeArchetype && CoreSet && (HasAuthority() || CoreSet->IsInitialReplicationDeferred()))
+	{
+		InitializedArchetype = AttributeArchetype;
+		InitializedLevel = EnemyCharacterLevel;
+		UGASCoreAttributeBatchSubsystem::RequestInitialization(CastChecked<UGASCoreAttributeSet>(AttributeSet),
+			AttributeArchetype, EnemyCharacterLevel);
+	}
+
+	// Server: vitals regenerate in the world's batched regeneration pass.
+	UGASCoreRegenerationSubsystem::RegisterAttributeSet(Cast<UGASCoreAttributeSet>(AttributeSet));
+}
+
+void ATDEnemyCharacter::ActivateFromPool(const FTransform& Transform, UGASCoreAttributeArchetypeDataAsset* Archetype,
+	const int32 Level)
+{
+	bPoolOwned = true;
+	bInPool = false;
+
+	// Awake before changing replicated state; movement replication carries the new transform of a reused enemy.
+	SetNetDormancy(DORM_Awake);
+
+	// Abilities granted for the previous archetype do not belong to another one: grant the startup set afresh
+	// (a dormant ASC grants it when it wakes).
+	const bool bKeepAbilities = !Archetype || Archetype == AttributeArchetype;
+	if (Archetype)
+	{
+		AttributeArchetype = Archetype;
+	}
+	if (!bKeepAbilities && AbilitySystemComponent)
+	{
+		AbilitySystemComponent->ClearAllAbilities();
+		if (bAbilitySystemInitialized && AbilityInitComponent)
+		{
+			AbilityInitComponent->AddCharacterAbilities();
+		}
+	}
+	if (Level > 0)
+	{
+		EnemyCharacterLevel = Level;
+	}
+
+	SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	ApplyPoolState();
+
+	// Same batched path as a fresh spawn, on a set that DeactivateToPool already returned to class defaults (a new
+	// pool spawn already initialized in BeginPlay when neither archetype nor level changed).
+	RequestArchetypeInitialization();
+
+	ReceiveActivatedFromPool();
+}
+
+void ATDEnemyCharacter::DeactivateToPool()
+{
+	bInPool = true;
+
+	if (bHighlighted)
+	{
+		UnHighlightActor();
+	}
+	if (AController* EnemyController = GetController())
+	{
+		EnemyController->StopMovement();
+	}
+	SetLifeSpan(0.f);
+
+	// Effects first: attribute defaults must not sit under a leftover modifier.
+	if (UGASCoreAbilitySystemComponent* CoreASC = Cast<UGASCoreAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		CoreASC->ResetForReuse(true);
+	}
+	if (UGASCoreAttributeSet* CoreSet = Cast<UGASCoreAttributeSet>(AttributeSet))
+	{
+		UGASCoreRegenerationSubsystem::UnregisterAttributeSet(CoreSet);
+		CoreSet->ResetToClassDefaults();
+		InitializedArchetype.Reset();
+		InitializedLevel = INDEX_NONE;
+	}
+
+	SetActorHiddenInGame(true);
+	ApplyPoolState();
+
+	ReceiveDeactivatedToPool();
+
+	// The pooled state still replicates before the channel goes dormant.
+	SetNetDormancy(DORM_DormantAll);
+}
+
+void ATDEnemyCharacter::ApplyPoolState()
+{
+	const bool bActive = !bInPool;
+
+	// Pooled enemies are neither hover, homing nor overhead bar targets (unregistering also restores High).
+	if (UGASCoreCombatantRegistrySubsystem* CombatantRegistry = UGASCoreCombatantRegistrySubsystem::Get(this))
+	{
+		if (bActive)
+		{
+			CombatantRegistry->RegisterCombatant(this);
+		}
+		else
+		{
+			CombatantRegistry->UnregisterCombatant(this);
+		}
+	}
+	if (bActive)
+	{
+		RegisterWithWorldSystems();
+	}
+	else
+	{
+		UnregisterFromWorldSystems();
+	}
+
+	SetActorEnableCollision(bActive);
+	ThreatComponent->SetActive(bActive);
+	GetMesh()->SetComponentTickEnabled(bActive);
+	if (WeaponMesh)
+	{
+		WeaponMesh->SetComponentTickEnabled(bActive);
+	}
+	UCharacterMovementComponent* Movement = GetCharacterMovement();
+	if (bActive)
+	{
+		Movement->SetDefaultMovementMode();
+	}
+	else
+	{
+		Movement->StopMovementImmediately();
+		Movement->DisableMovement();
+	}
+	Movement->SetComponentTickEnabled(bActive);
+}
+
+void ATDEnemyCharacter::OnRep_AttributeInit()
+{
+	if (HasActorBegunPlay())
+	{
+		RequestArchetypeInitialization();
+	}
+}
+
+void ATDEnemyCharacter::OnRep_InPool()
+{
+	if (HasActorBegunPlay())
+	{
+		ApplyPoolState();
+	}
+}
+
+void ATDEnemyCharacter::ReleaseOrDestroy()
+{
+	if (bInPool || IsActorBeingDestroyed())
+	{
+		return;
+	}
+
+	UTDEnemyPoolSubsystem* Pool = bPoolOwned ? UTDEnemyPoolSubsystem::Get(this) : nullptr;
+	if (Pool && HasAuthority())
+	{
+		Pool->ReleaseEnemy(this);
+		return;
+	}
+	Destroy();
+}
+
+void ATDEnemyCharacter::LifeSpanExpired()
+{
+	if (bPoolOwned && HasAuthority())
+	{
+		ReleaseOrDestroy();
+		return;
+	}
+	Super::LifeSpanExpired();
+}
+
+void ATDEnemyCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ATDEnemyCharacter, bInPool);
+	DOREPLIFETIME(ATDEnemyCharacter, EnemyCharacterLevel);
+	DOREPLIFETIME(ATDEnemyCharacter, AttributeArchetype);
+	DOREPLIFETIME(ATDEnemyCharacter, bAbilitySystemAwake);
+}
+
 void ATDEnemyCharacter::HighlightActor()
 {
+	// Hovered enemies are about to be targeted: wake GAS locally before the first ability interaction.
+	ActivateAbilitySystem();
+
 	// Mark as highlighted for internal logic or UI.
 	bHighlighted = true;
 
-	// Enable custom depth rendering for outline/FX.
-	GetMesh()->SetRenderCustomDepth(true);
-	GetMesh()->SetCustomDepthStencilValue(CUSTOM_DEPTH_RED);
+	// Enable custom depth rendering for outline/FX (batched; applied once at end of frame).
+	UHighlightManagerSubsystem::RequestCustomDepth(GetMesh(), true, CUSTOM_DEPTH_RED);
 
-	// Also highlight the weapon mesh (if present).
-	WeaponMesh->SetRenderCustomDepth(true);
-	WeaponMesh->SetCustomDepthStencilValue(CUSTOM_DEPTH_RED);
+	// Also highlight the weapon (if present).
+	UHighlightManagerSubsystem::RequestCustomDepth(GetWeaponComponent(), true, CUSTOM_DEPTH_RED);
 }
 
 void ATDEnemyCharacter::UnHighlightActor()
@@ -69,9 +417,69 @@ void ATDEnemyCharacter::UnHighlightActor()
 	// Unmark as highlighted.
 	bHighlighted = false;
 
-	// Disable custom depth rendering.
-	GetMesh()->SetRenderCustomDepth(false);
-	WeaponMesh->SetRenderCustomDepth(false);
+	// Disable custom depth rendering (batched).
+	UHighlightManagerSubsystem::RequestCustomDepth(GetMesh(), false);
+	UHighlightManagerSubsystem::RequestCustomDepth(GetWeaponComponent(), false);
+}
+
+void ATDEnemyCharacter::SetSignificance(const ETDEnemySignificance NewSignificance)
+{
+	if (Significance == NewSignificance) return;
+	Significance = NewSignificance;
+
+	const bool bHigh = Significance == ETDEnemySignificance::High;
+	const bool bLow = Significance == ETDEnemySignificance::Low;
+	const float ReducedTickInterval = bLow ? LowSignificanceTickInterval : MediumSignificanceTickInterval;
+
+	// Movement integrates the larger delta (AI paths stay correct, just coarser); the anim graph ticks less often.
+	// A budgeted body mesh gets its rate from the animation budget allocator, ranked by this significance instead.
+	GetCharacterMovement()->SetComponentTickInterval(bHigh ? HighMovementTickInterval : ReducedTickInterval);
+	if (!SetAnimationSignificance(bHigh ? 1.f : (bLow ? 0.1f : 0.5f)))
+	{
+		GetMesh()->SetComponentTickInterval(bHigh ? HighMeshTickInterval : ReducedTickInterval);
+	}
+
+	// Weapon pose is detail nobody sees off screen: no tick, no bone transforms.
+	if (WeaponMesh)
+	{
+		WeaponMesh->bNoSkeletonUpdate = !bHigh;
+		WeaponMesh->SetComponentTickEnabled(bHigh);
+	}
+
+	// Off-screen enemies cannot be hovered: take the proxy out of the HIGHLIGHTABLE query scene.
+	HighlightProxy->SetCollisionEnabled(bHigh ? ECollisionEnabled::QueryOnly : ECollisionEnabled::NoCollision);
+
+	// Server: far enemies (actor, ASC and attribute set together) are replicated less often and lose to closer ones
+	// when the connection is saturated.
+	if (HasAuthority())
+	{
+		SetNetUpdateFrequency(bLow ? FMath::Min(LowSignificanceNetUpdateFrequency, HighNetUpdateFrequency) : HighNetUpdateFrequency);
+		NetPriority = bLow ? LowSignificanceNetPriority : HighNetPriority;
+		UTDReplicationGraph::NotifyNetUpdateFrequencyChanged(this);
+	}
+
+	ReceiveSignificanceChanged(Significance);
+}
+
+void ATDEnemyCharacter::SetReplicationReduced(const bool bReduced)
+{
+	const bool bNewReduced = bReduced && bReduceReplicationWhenCrowded && HasAuthority();
+	if (bReplicationReduced == bNewReduced)
+	{
+		return;
+	}
+	bReplicationReduced = bNewReduced;
+
+	if (UTDAbilitySystemComponent* TDASC = Cast<UTDAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		TDASC->SetEffectStateReplicationSuppressed(bReplicationReduced);
+	}
+
+	// Resumed: send the current tags / effects with the next update rather than at the Low rate.
+	if (!bReplicationReduced)
+	{
+		ForceNetUpdate();
+	}
 }
 
 int32 ATDEnemyCharacter::GetActorLevel()
@@ -11,10 +11,12 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Player/TDPlayerController.h"
 #include "Player/TDPlayerState.h"
+#include "Subsystems/GASCoreRegenerationSubsystem.h"
 #include "UI/HUD/TDHUD.h"
 
 // Sets default values
-ATDPlayerCharacter::ATDPlayerCharacter()
+ATDPlayerCharacter::ATDPlayerCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
 {
 	// Orient rotation to the movement direction (character faces where it moves).
 	GetCharacterMovement()->bOrientRotationToMovement = true;
@@ -31,18 +33,35 @@ ATDPlayerCharacter::ATDPlayerCharacter()
 	bUseControllerRotationRoll = false;
 }
 
+void ATDPlayerCharacter::NotifyControllerChanged()
+{
+	Super::NotifyControllerChanged();
+
+	SetAnimationSignificance(1.f, IsLocallyControlled());
+}
+
 void ATDPlayerCharacter::PossessedBy(AController* NewController)
 {
 	Super::PossessedBy(NewController);
 
 	// Initialize Ability System Actor Info for the server context (PlayerState owner, this avatar).
 	InitializeAbilityActorInfo();
+
+	// After seamless travel / reconnect the PlayerState carries the full GAS state: restored in one step below.
+	ATDPlayerState* TDPlayerState = GetPlayerState<ATDPlayerState>();
+	const bool bRestoringTravelState = TDPlayerState && TDPlayerState->HasTravelGASState();
 	
 	// Give startup abilities to this character (server only).
-	if (AbilityInitComponent)
+	if (AbilityInitComponent && !bRestoringTravelState)
 	{
 		AbilityInitComponent->AddCharacterAbilities();
 	}
+
+	// Saved state on top of the startup state, or the travelled state instead of it.
+	if (TDPlayerState)
+	{
+		TDPlayerState->ApplyPendingGASState();
+	}
 }
 
 void ATDPlayerCharacter::OnRep_PlayerState()
@@ -53,12 +72,27 @@ void ATDPlayerCharacter::OnRep_PlayerState()
 	InitializeAbilityActorInfo();
 }
 
-int32 ATDPlayerCharacter::GetActorLevel()
+void ATDPlayerCharacter::BindPlayerLevel(ATDPlayerState* PlayerState)
+{
+	if (LevelPlayerState.Get() != PlayerState)
+	{
+		if (ATDPlayerState* Previous = LevelPlayerState.Get())
+		{
+			Previous->OnPlayerLevelChanged.Remove(PlayerLevelChangedHandle);
+		}
+		PlayerLevelChangedHandle = PlayerState->OnPlayerLevelChanged.AddUObject(this, &ATDPlayerCharacter::HandlePlayerLevelChanged);
+		LevelPlayerState = PlayerState;
+	}
+	HandlePlayerLevelChanged(CachedLevel, PlayerState->GetPlayerLevel());
+}
+
+void ATDPlayerCharacter::HandlePlayerLevelChanged(int32 /*OldLevel*/, const int32 NewLevel)
 {
-	// Get the custom PlayerState class.
-	const ATDPlayerState* TDPlayerState = GetPlayerState<ATDPlayerState>();
-	check(TDPlayerState); // Should exist when ASC is initialized.
-	return TDPlayerState->GetPlayerLevel();
+	if (CachedLevel != NewLevel)
+	{
+		CachedLevel = NewLevel;
+		OnActorLevelChanged.Broadcast();
+	}
 }
 
 void ATDPlayerCharacter::InitializeAbilityActorInfo()
@@ -73,6 +107,8 @@ void ATDPlayerCharacter::InitializeAbilityActorInfo()
 			ATDPlayerState* TDPlayerState = GetPlayerState<ATDPlayerState>();
 			if (TDPlayerState)
 			{
+				BindPlayerLevel(TDPlayerState);
+
 				// The ASC and AttributeSet live on the PlayerState for player characters.
 				AbilitySystemComponent = Cast<UTDAbilitySystemComponent>(TDPlayerState->GetAbilitySystemComponent());
 				AttributeSet = Cast<UTDAttributeSet>(TDPlayerState->GetAttributeSet());
@@ -102,10 +138,22 @@ void ATDPlayerCharacter::InitializeAbilityActorInfo()
 
 			// Apply default attribute initialization once ASC and AttributeSet are valid.
 			// DefaultAttributeInitComponent is assumed to be provided by ATDCharacterBase.
-			if (AbilitySystemComponent && AttributeSet && DefaultAttributeInitComponent->DefaultPrimaryAttributes)
+			// Skipped for a travelled PlayerState: its restored state already holds the init effects (PossessedBy).
+			if (AbilitySystemComponent && AttributeSet && DefaultAttributeInitComponent->HasDefaultAttributes()
+				&& !(TDPlayerState && TDPlayerState->HasTravelGASState()))
 			{
 				DefaultAttributeInitComponent->InitializeDefaultAttributes(AbilitySystemComponent);
+
+				if (TDPlayerState && HasAuthority())
+				{
+					TArray<TSubclassOf<UGameplayEffect>> InitEffects;
+					DefaultAttributeInitComponent->GetDefaultAttributeEffectClasses(InitEffects);
+					TDPlayerState->SetAttributeInitEffects(MoveTemp(InitEffects));
+				}
 			}
+
+			// Server: vitals regenerate in the world's batched regeneration pass (no-op on clients).
+			UGASCoreRegenerationSubsystem::RegisterAttributeSet(Cast<UGASCoreAttributeSet>(AttributeSet));
 		}
 	}
 }
\ No newline at end of file
@@ -5,3 +5,21 @@
 
 #include "Game/TDGameMode.h"
 
+#include "Kismet/GameplayStatics.h"
+#include "Player/TDBotPlayerController.h"
+
+APlayerController* ATDGameMode::SpawnPlayerController(const ENetRole InRemoteRole, const FString& Options)
+{
+	if (!UGameplayStatics::HasOption(Options, TEXT("TDBot")))
+	{
+		return Super::SpawnPlayerController(InRemoteRole, Options);
+	}
+
+	if (!BotPlayerControllerClass)
+	{
+		UE_LOG(LogGameMode, Warning, TEXT("ATDGameMode: TDBot login but BotPlayerControllerClass is not set, spawning a player controller."));
+		return Super::SpawnPlayerController(InRemoteRole, Options);
+	}
+
+	return SpawnPlayerControllerCommon(InRemoteRole, FVector::ZeroVector, FRotator::ZeroRotator, BotPlayerControllerClass);
+}
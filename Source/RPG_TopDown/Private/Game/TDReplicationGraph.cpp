@@ -0,0 +1,220 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Game/TDReplicationGraph.h"
+
+#include "Actors/GASCoreGameplayEffectActor.h"
+#include "Actors/GASCoreSpawnedActorByGameplayAbility.h"
+#include "Charcters/TDEnemyCharacter.h"
+#include "Engine/LevelScriptActor.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/Info.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "Player/TDPlayerState.h"
+#include "ReplicationGraphTypes.h"
+#include "UObject/UObjectIterator.h"
+
+static TAutoConsoleVariable<float> CVarTDRepGraphCellSize(
+	TEXT("TD.RepGraph.CellSize"),
+	10000.f,
+	TEXT("Spatial grid cell size (cm) of the replication graph (read when the graph is created)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarTDRepGraphSpatialBias(
+	TEXT("TD.RepGraph.SpatialBias"),
+	-200000.f,
+	TEXT("Grid origin offset (cm, X and Y) so every playable location maps to a positive cell (read when the graph is created)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarTDRepGraphDisableSpatialRebuilds(
+	TEXT("TD.RepGraph.DisableSpatialRebuilds"),
+	true,
+	TEXT("Grow the grid in place instead of rebuilding it when an actor leaves the biased bounds."),
+	ECVF_Default);
+
+void UTDReplicationGraph::NotifyNetUpdateFrequencyChanged(AActor* Actor)
+{
+	const UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+	const UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	UTDReplicationGraph* Graph = NetDriver ? NetDriver->GetReplicationDriver<UTDReplicationGraph>() : nullptr;
+	if (!Graph)
+	{
+		return;
+	}
+
+	if (FGlobalActorReplicationInfo* GlobalInfo = Graph->GlobalActorReplicationInfoMap.Find(Actor))
+	{
+		GlobalInfo->Settings.ReplicationPeriodFrame = Graph->GetReplicationPeriodFrameForFrequency(Actor->GetNetUpdateFrequency());
+	}
+}
+
+void UTDReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	// Explicit routes; every other class is inferred from its CDO (GetMappingPolicy).
+	ClassRepNodePolicies.Set(AReplicationGraphDebugActor::StaticClass(), ETDClassRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(ALevelScriptActor::StaticClass(), ETDClassRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(APlayerController::StaticClass(), ETDClassRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(APlayerState::StaticClass(), ETDClassRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(AInfo::StaticClass(), ETDClassRepNodeMapping::RelevantAllConnections);
+	ClassRepNodePolicies.Set(ATDEnemyCharacter::StaticClass(), ETDClassRepNodeMapping::Spatialize_Dormancy);
+	ClassRepNodePolicies.Set(AGASCoreSpawnedActorByGameplayAbility::StaticClass(), ETDClassRepNodeMapping::Spatialize_Dormancy);
+	ClassRepNodePolicies.Set(AGASCoreGameplayEffectActor::StaticClass(), ETDClassRepNodeMapping::Spatialize_Dormancy);
+
+	// Replication period and cull distance per loaded replicated class (later-loaded classes use their parent's).
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		const AActor* CDO = Class->IsChildOf(AActor::StaticClass()) ? Cast<AActor>(Class->GetDefaultObject(false)) : nullptr;
+		if (!CDO || !CDO->GetIsReplicated() || Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists)
+			|| Class->GetName().StartsWith(TEXT("SKEL_")) || Class->GetName().StartsWith(TEXT("REINST_")))
+		{
+			continue;
+		}
+
+		const ETDClassRepNodeMapping Mapping = GetMappingPolicy(Class);
+		FClassReplicationInfo ClassInfo;
+		ClassInfo.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(CDO->GetNetUpdateFrequency());
+		if (Mapping == ETDClassRepNodeMapping::Spatialize_Static || Mapping == ETDClassRepNodeMapping::Spatialize_Dynamic
+			|| Mapping == ETDClassRepNodeMapping::Spatialize_Dormancy)
+		{
+			ClassInfo.SetCullDistanceSquared(CDO->GetNetCullDistanceSquared());
+		}
+		GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+	}
+}
+
+void UTDReplicationGraph::InitGlobalGraphNodes()
+{
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = CVarTDRepGraphCellSize.GetValueOnGameThread();
+	GridNode->SpatialBias = FVector2D(CVarTDRepGraphSpatialBias.GetValueOnGameThread());
+	if (CVarTDRepGraphDisableSpatialRebuilds.GetValueOnGameThread())
+	{
+		GridNode->AddToClassRebuildDenyList(AActor::StaticClass());
+	}
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+
+	// Finds the world's PlayerStates itself; hands out a few of them per frame to every connection.
+	PlayerStateNode = CreateNewNode<UReplicationGraphNode_PlayerStateFrequencyLimiter>();
+	AddGlobalGraphNode(PlayerStateNode);
+}
+
+void UTDReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	AddConnectionGraphNode(CreateNewNode<UTDReplicationGraphNode_AlwaysRelevant_ForConnection>(), RepGraphConnection);
+}
+
+ETDClassRepNodeMapping UTDReplicationGraph::GetMappingPolicy(UClass* Class)
+{
+	if (const ETDClassRepNodeMapping* Policy = ClassRepNodePolicies.Get(Class))
+	{
+		return *Policy;
+	}
+
+	const AActor* CDO = Class->GetDefaultObject<AActor>();
+	ETDClassRepNodeMapping Policy = ETDClassRepNodeMapping::Spatialize_Static;
+	if (CDO->bAlwaysRelevant)
+	{
+		Policy = ETDClassRepNodeMapping::RelevantAllConnections;
+	}
+	else if (CDO->bOnlyRelevantToOwner)
+	{
+		Policy = ETDClassRepNodeMapping::NotRouted;
+	}
+	else if (CDO->IsReplicatingMovement())
+	{
+		// Movement replication is the best available hint that instances move.
+		Policy = ETDClassRepNodeMapping::Spatialize_Dynamic;
+	}
+
+	ClassRepNodePolicies.Set(Class, Policy);
+	return Policy;
+}
+
+void UTDReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case ETDClassRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+
+	case ETDClassRepNodeMapping::Spatialize_Static:
+		GlobalInfo.Settings.SetCullDistanceSquared(ActorInfo.Actor->GetNetCullDistanceSquared());
+		GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+		break;
+
+	case ETDClassRepNodeMapping::Spatialize_Dynamic:
+		GlobalInfo.Settings.SetCullDistanceSquared(ActorInfo.Actor->GetNetCullDistanceSquared());
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+		break;
+
+	case ETDClassRepNodeMapping::Spatialize_Dormancy:
+		// Instance cull distance (e.g., AGASCoreGameplayEffectActor::NetCullDistance set before registration).
+		GlobalInfo.Settings.SetCullDistanceSquared(ActorInfo.Actor->GetNetCullDistanceSquared());
+		GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+		break;
+
+	case ETDClassRepNodeMapping::NotRouted:
+	default:
+		break;
+	}
+}
+
+void UTDReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case ETDClassRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+
+	case ETDClassRepNodeMapping::Spatialize_Static:
+		GridNode->RemoveActor_Static(ActorInfo);
+		break;
+
+	case ETDClassRepNodeMapping::Spatialize_Dynamic:
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+		break;
+
+	case ETDClassRepNodeMapping::Spatialize_Dormancy:
+		GridNode->RemoveActor_Dormancy(ActorInfo);
+		break;
+
+	case ETDClassRepNodeMapping::NotRouted:
+	default:
+		break;
+	}
+}
+
+void UTDReplicationGraphNode_AlwaysRelevant_ForConnection::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	// Rebuilt every frame: possession and view targets change without the graph being told.
+	ReplicationActorList.Reset();
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		ReplicationActorList.ConditionalAdd(Viewer.InViewer);
+		ReplicationActorList.ConditionalAdd(Viewer.ViewTarget);
+
+		if (const APlayerController* PC = Cast<APlayerController>(Viewer.InViewer))
+		{
+			// Own PlayerState at full rate (the ASC and owner-only attribute tiers live there).
+			ReplicationActorList.ConditionalAdd(PC->GetPlayerState<ATDPlayerState>());
+			if (PC->GetPawn() != Viewer.ViewTarget)
+			{
+				ReplicationActorList.ConditionalAdd(PC->GetPawn());
+			}
+		}
+	}
+
+	Super::GatherActorListsForConnection(Params);
+}
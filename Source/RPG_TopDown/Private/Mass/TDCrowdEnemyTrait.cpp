@@ -0,0 +1,18 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Mass/TDCrowdEnemyTrait.h"
+
+#include "MassCommonFragments.h"
+#include "MassEntityTemplateRegistry.h"
+#include "MassEntityUtils.h"
+
+void UTDCrowdEnemyTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+	BuildContext.AddTag<FTDCrowdEnemyTag>();
+	BuildContext.AddFragment_GetRef<FTDCrowdVitalsFragment>() = Vitals;
+	BuildContext.AddFragment_GetRef<FTDCrowdCombatFragment>() = Combat;
+	BuildContext.RequireFragment<FTransformFragment>();
+
+	FMassEntityManager& EntityManager = UE::Mass::Utils::GetEntityManagerChecked(World);
+	BuildContext.AddConstSharedFragment(EntityManager.GetOrCreateConstSharedFragment(Parameters));
+}
@@ -0,0 +1,273 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Mass/TDCrowdProcessors.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystem/Attributes/TDAttributeSet.h"
+#include "AbilitySystem/Formulas/GASCoreAttributeFormulas.h"
+#include "Charcters/TDEnemyCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Mass/TDCrowdSubsystem.h"
+#include "Mass/TDCrowdTypes.h"
+#include "MassCommonFragments.h"
+#include "MassCommonTypes.h"
+#include "MassExecutionContext.h"
+#include "Subsystems/GASCoreAttributeBatchSubsystem.h"
+#include "Subsystems/TDEnemyPoolSubsystem.h"
+
+static TAutoConsoleVariable<int32> CVarTDCrowdMaxPromotionsPerFrame(
+	TEXT("TD.Crowd.MaxPromotionsPerFrame"),
+	8,
+	TEXT("Crowd enemies promoted to ATDEnemyCharacter actors per frame at most (the rest wait for the next frame)."),
+	ECVF_Default);
+
+namespace TDCrowdProcessors
+{
+	// Crowd entities are not replicated, so the simulation only runs where every player sees it (see UTDCrowdSubsystem).
+	static constexpr int32 StandaloneExecutionFlags = int32(EProcessorExecutionFlags::Standalone);
+}
+
+// ===== Regeneration =====
+
+UTDCrowdRegenProcessor::UTDCrowdRegenProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = TDCrowdProcessors::StandaloneExecutionFlags;
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	bRequiresGameThreadExecution = false;
+}
+
+void UTDCrowdRegenProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddRequirement<FTDCrowdVitalsFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddTagRequirement<FTDCrowdEnemyTag>(EMassFragmentPresence::All);
+}
+
+void UTDCrowdRegenProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	EntityQuery.ForEachEntityChunk(Context, [](FMassExecutionContext& ChunkContext)
+	{
+		const float DeltaTime = ChunkContext.GetDeltaTimeSeconds();
+		const TArrayView<FTDCrowdVitalsFragment> VitalsList = ChunkContext.GetMutableFragmentView<FTDCrowdVitalsFragment>();
+		for (FTDCrowdVitalsFragment& Vitals : VitalsList)
+		{
+			if (Vitals.Health > 0.f && Vitals.HealthRegeneration > 0.f)
+			{
+				Vitals.Health = FMath::Min(Vitals.Health + Vitals.HealthRegeneration * DeltaTime, Vitals.MaxHealth);
+			}
+		}
+	});
+}
+
+// ===== Damage =====
+
+UTDCrowdDamageProcessor::UTDCrowdDamageProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = TDCrowdProcessors::StandaloneExecutionFlags;
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	ExecutionOrder.ExecuteAfter.Add(UTDCrowdRegenProcessor::StaticClass()->GetFName());
+
+	// Reads the subsystem queue and broadcasts kills.
+	bRequiresGameThreadExecution = true;
+}
+
+void UTDCrowdDamageProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FTDCrowdVitalsFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FTDCrowdCombatFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddTagRequirement<FTDCrowdEnemyTag>(EMassFragmentPresence::All);
+}
+
+void UTDCrowdDamageProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	UTDCrowdSubsystem* Crowd = UTDCrowdSubsystem::Get(EntityManager.GetWorld());
+	if (!Crowd || !Crowd->HasPendingDamage())
+	{
+		return;
+	}
+
+	const TArray<FTDCrowdDamageRequest> Requests = Crowd->ConsumeDamageRequests();
+	const FGASCoreFormulaCoefficients& Coefficients = FGASCoreFormulaCoefficients::GetDefault();
+	TArray<FVector> KilledLocations;
+
+	EntityQuery.ForEachEntityChunk(Context, [&Requests, &Coefficients, &KilledLocations](FMassExecutionContext& ChunkContext)
+	{
+		const TConstArrayView<FTransformFragment> Transforms = ChunkContext.GetFragmentView<FTransformFragment>();
+		const TArrayView<FTDCrowdVitalsFragment> VitalsList = ChunkContext.GetMutableFragmentView<FTDCrowdVitalsFragment>();
+		const TConstArrayView<FTDCrowdCombatFragment> CombatList = ChunkContext.GetFragmentView<FTDCrowdCombatFragment>();
+
+		for (int32 Index = 0; Index < ChunkContext.GetNumEntities(); ++Index)
+		{
+			FTDCrowdVitalsFragment& Vitals = VitalsList[Index];
+			if (Vitals.Health <= 0.f)
+			{
+				continue;
+			}
+
+			const FVector Location = Transforms[Index].GetTransform().GetLocation();
+			const FTDCrowdCombatFragment& Combat = CombatList[Index];
+			for (const FTDCrowdDamageRequest& Request : Requests)
+			{
+				if (FVector::DistSquared(Location, Request.Center) > FMath::Square(Request.Radius))
+				{
+					continue;
+				}
+
+				GASCoreFormulas::FDamageInputs Inputs;
+				Inputs.BaseDamage = Request.BaseDamage;
+				Inputs.SourceArmorPenetration = Request.SourceArmorPenetration;
+				Inputs.SourceCriticalHitChance = Request.SourceCriticalHitChance;
+				Inputs.SourceCriticalHitDamage = Request.SourceCriticalHitDamage;
+				Inputs.TargetArmor = Combat.Armor;
+				Inputs.TargetBlockChance = Combat.BlockChance;
+				Inputs.TargetCriticalHitResistance = Combat.CriticalHitResistance;
+
+				const GASCoreFormulas::FDamageResult Result = GASCoreFormulas::ResolveDamage(Inputs,
+					FMath::FRandRange(0.f, 100.f), FMath::FRandRange(0.f, 100.f), Coefficients);
+				Vitals.Health = FMath::Max(Vitals.Health - Result.Damage, 0.f);
+			}
+
+			if (Vitals.Health <= 0.f)
+			{
+				KilledLocations.Add(Location);
+				ChunkContext.Defer().DestroyEntity(ChunkContext.GetEntity(Index));
+			}
+		}
+	});
+
+	for (const FVector& Location : KilledLocations)
+	{
+		Crowd->OnCrowdEnemyKilled.Broadcast(Location);
+	}
+}
+
+// ===== Promotion =====
+
+UTDCrowdPromotionProcessor::UTDCrowdPromotionProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = TDCrowdProcessors::StandaloneExecutionFlags;
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	ExecutionOrder.ExecuteAfter.Add(UTDCrowdDamageProcessor::StaticClass()->GetFName());
+
+	// Spawns / activates actors.
+	bRequiresGameThreadExecution = true;
+}
+
+void UTDCrowdPromotionProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FTDCrowdVitalsFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddConstSharedRequirement<FTDCrowdEnemyParameters>();
+	EntityQuery.AddTagRequirement<FTDCrowdEnemyTag>(EMassFragmentPresence::All);
+}
+
+void UTDCrowdPromotionProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	UWorld* World = EntityManager.GetWorld();
+	UTDEnemyPoolSubsystem* Pool = UTDEnemyPoolSubsystem::Get(World);
+	const int32 MaxPromotions = CVarTDCrowdMaxPromotionsPerFrame.GetValueOnGameThread();
+	if (!Pool || MaxPromotions <= 0)
+	{
+		return;
+	}
+
+	TArray<FVector, TInlineAllocator<8>> PlayerLocations;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (const APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr)
+		{
+			PlayerLocations.Add(Pawn->GetActorLocation());
+		}
+	}
+	if (PlayerLocations.IsEmpty())
+	{
+		return;
+	}
+
+	struct FPromotion
+	{
+		FMassEntityHandle Entity;
+		FTransform Transform;
+		float HealthFraction = 1.f;
+		const FTDCrowdEnemyParameters* Parameters = nullptr;
+	};
+	TArray<FPromotion, TInlineAllocator<8>> Promotions;
+
+	EntityQuery.ForEachEntityChunk(Context, [&PlayerLocations, &Promotions, MaxPromotions](FMassExecutionContext& ChunkContext)
+	{
+		const FTDCrowdEnemyParameters& Parameters = ChunkContext.GetConstSharedFragment<FTDCrowdEnemyParameters>();
+		if (!Parameters.PromotedClass || Promotions.Num() >= MaxPromotions)
+		{
+			return;
+		}
+
+		const float RadiusSquared = FMath::Square(Parameters.PromotionRadius);
+		const TConstArrayView<FTransformFragment> Transforms = ChunkContext.GetFragmentView<FTransformFragment>();
+		const TConstArrayView<FTDCrowdVitalsFragment> VitalsList = ChunkContext.GetFragmentView<FTDCrowdVitalsFragment>();
+
+		for (int32 Index = 0; Index < ChunkContext.GetNumEntities() && Promotions.Num() < MaxPromotions; ++Index)
+		{
+			const FTDCrowdVitalsFragment& Vitals = VitalsList[Index];
+			if (Vitals.Health <= 0.f)
+			{
+				continue;
+			}
+
+			const FTransform& Transform = Transforms[Index].GetTransform();
+			const FVector Location = Transform.GetLocation();
+			for (const FVector& PlayerLocation : PlayerLocations)
+			{
+				if (FVector::DistSquared2D(Location, PlayerLocation) <= RadiusSquared)
+				{
+					Promotions.Add({ ChunkContext.GetEntity(Index), Transform, Vitals.Health / FMath::Max(Vitals.MaxHealth, 1.f), &Parameters });
+					break;
+				}
+			}
+		}
+	});
+
+	// Entities stand on the ground; characters are placed by their capsule center.
+	TArray<TPair<ATDEnemyCharacter*, float>, TInlineAllocator<8>> Promoted;
+	for (const FPromotion& Promotion : Promotions)
+	{
+		const FTDCrowdEnemyParameters& Parameters = *Promotion.Parameters;
+		const ATDEnemyCharacter* EnemyCDO = Parameters.PromotedClass->GetDefaultObject<ATDEnemyCharacter>();
+		FTransform SpawnTransform = Promotion.Transform;
+		SpawnTransform.AddToTranslation(FVector(0.f, 0.f, EnemyCDO->GetCapsuleComponent()->GetScaledCapsuleHalfHeight()));
+
+		ATDEnemyCharacter* Enemy = Pool->AcquireEnemy(Parameters.PromotedClass, SpawnTransform,
+			Parameters.PromotedArchetype, Parameters.PromotedLevel);
+		if (Enemy)
+		{
+			Promoted.Emplace(Enemy, Promotion.HealthFraction);
+			Context.Defer().DestroyEntity(Promotion.Entity);
+		}
+	}
+	if (Promoted.IsEmpty())
+	{
+		return;
+	}
+
+	// The promoted enemies' archetype initialization is queued for end of frame; run it now so the health
+	// fraction is applied to the initialized MaxHealth (one batch for every promotion this frame).
+	if (UGASCoreAttributeBatchSubsystem* AttributeBatch = UGASCoreAttributeBatchSubsystem::Get(World))
+	{
+		AttributeBatch->FlushPendingInitializations();
+	}
+	for (const TPair<ATDEnemyCharacter*, float>& Pair : Promoted)
+	{
+		UAbilitySystemComponent* ASC = Pair.Key->GetAbilitySystemComponent();
+		if (ASC && Pair.Value < 1.f)
+		{
+			const float MaxHealth = ASC->GetNumericAttribute(UTDAttributeSet::GetMaxHealthAttribute());
+			ASC->SetNumericAttributeBase(UTDAttributeSet::GetHealthAttribute(), FMath::Max(MaxHealth * Pair.Value, 1.f));
+		}
+	}
+}
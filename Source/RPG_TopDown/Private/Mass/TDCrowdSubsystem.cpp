@@ -0,0 +1,37 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Mass/TDCrowdSubsystem.h"
+
+#include "Engine/World.h"
+
+UTDCrowdSubsystem* UTDCrowdSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTDCrowdSubsystem>() : nullptr;
+}
+
+void UTDCrowdSubsystem::ApplyCrowdDamageInRadius(const FVector& Center, const float Radius, const float BaseDamage,
+	const float SourceArmorPenetration, const float SourceCriticalHitChance, const float SourceCriticalHitDamage)
+{
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() != NM_Standalone || Radius <= 0.f || BaseDamage <= 0.f)
+	{
+		return;
+	}
+
+	FTDCrowdDamageRequest& Request = PendingDamage.AddDefaulted_GetRef();
+	Request.Center = Center;
+	Request.Radius = Radius;
+	Request.BaseDamage = BaseDamage;
+	Request.SourceArmorPenetration = SourceArmorPenetration;
+	Request.SourceCriticalHitChance = SourceCriticalHitChance;
+	Request.SourceCriticalHitDamage = SourceCriticalHitDamage;
+}
+
+void UTDCrowdSubsystem::Deinitialize()
+{
+	PendingDamage.Reset();
+	OnCrowdEnemyKilled.Clear();
+
+	Super::Deinitialize();
+}
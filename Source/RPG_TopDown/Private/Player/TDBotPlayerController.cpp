@@ -0,0 +1,172 @@
+// © 2025 Heathrow (Derman). All rights reserved.This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Player/TDBotPlayerController.h"
+
+#include "AbilitySystemBlueprintLibrary.h"
+#include "EngineUtils.h"
+#include "NavigationSystem.h"
+#include "TDGameplayTags.h"
+#include "AbilitySystem/Components/GASCoreAbilitySystemComponent.h"
+#include "Actors/TDGameplayEffectActor.h"
+#include "Components/ClickToMoveComponent.h"
+#include "TimerManager.h"
+
+ATDBotPlayerController::ATDBotPlayerController()
+{
+	PrimaryActorTick.bCanEverTick = true;
+}
+
+void ATDBotPlayerController::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!IsLocalController())
+	{
+		return;
+	}
+
+	// Each bot process gets its own sequence.
+	Random.Initialize(FPlatformTime::Cycles() ^ GetUniqueID());
+
+	if (AbilityInputTags.IsEmpty())
+	{
+		const FTDGameplayTags& Tags = FTDGameplayTags::Get();
+		AbilityInputTags = { Tags.InputTag_RMB, Tags.InputTag_QuickSlot_1, Tags.InputTag_QuickSlot_2, Tags.InputTag_QuickSlot_3, Tags.InputTag_QuickSlot_4 };
+	}
+
+	// First order soon after login instead of everyone moving on the same frame.
+	GetWorldTimerManager().SetTimer(OrderTimer, this, &ThisClass::IssueMoveOrder, Random.FRandRange(0.5f, 1.5f) * OrderInterval, /*bLoop=*/false);
+}
+
+void ATDBotPlayerController::Tick(const float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (IsLocalController())
+	{
+		TickAbilityInput(DeltaSeconds);
+	}
+}
+
+bool ATDBotPlayerController::GetAbilityCursorHit(const ECollisionChannel Channel, FHitResult& OutHit)
+{
+	const APawn* ControlledPawn = GetPawn();
+	if (!ControlledPawn)
+	{
+		return false;
+	}
+
+	OutHit = FHitResult(ControlledPawn->GetActorLocation(), AimLocation);
+	OutHit.Location = AimLocation;
+	OutHit.ImpactPoint = AimLocation;
+	OutHit.ImpactNormal = FVector::UpVector;
+	OutHit.bBlockingHit = true;
+	return true;
+}
+
+void ATDBotPlayerController::IssueMoveOrder()
+{
+	GetWorldTimerManager().SetTimer(OrderTimer, this, &ThisClass::IssueMoveOrder, Random.FRandRange(0.5f, 1.5f) * OrderInterval, /*bLoop=*/false);
+
+	const APawn* ControlledPawn = GetPawn();
+	if (!ControlledPawn)
+	{
+		return;
+	}
+
+	const FVector Origin = ControlledPawn->GetActorLocation();
+	FVector Destination;
+	if (Random.FRand() < PickupChance && FindPickupLocation(Origin, Destination))
+	{
+		ClickToMove(Destination);
+		return;
+	}
+
+	FNavLocation NavLocation;
+	const UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (NavSystem && NavSystem->GetRandomReachablePointInRadius(Origin, WanderRadius, NavLocation))
+	{
+		ClickToMove(NavLocation.Location);
+	}
+}
+
+bool ATDBotPlayerController::FindPickupLocation(const FVector& Origin, FVector& OutLocation) const
+{
+	float BestDistanceSquared = FMath::Square(PickupSearchRadius);
+	bool bFound = false;
+	for (TActorIterator<ATDGameplayEffectActor> It(GetWorld()); It; ++It)
+	{
+		const float DistanceSquared = FVector::DistSquared(Origin, It->GetActorLocation());
+		if (DistanceSquared < BestDistanceSquared)
+		{
+			BestDistanceSquared = DistanceSquared;
+			OutLocation = It->GetActorLocation();
+			bFound = true;
+		}
+	}
+	return bFound;
+}
+
+void ATDBotPlayerController::ClickToMove(const FVector& Destination)
+{
+	// Same sequence as a short LMB click on the ground: autorun along a path to the projected destination.
+	FHitResult Hit(nullptr, nullptr, Destination, FVector::UpVector);
+	Hit.ImpactPoint = Destination;
+	Hit.bBlockingHit = true;
+
+	ClickToMoveComponent->SetIsTargeting(false);
+	ClickToMoveComponent->OnClickPressed();
+	ClickToMoveComponent->OnClickHeld(/*bUseInternalHitResult=*/false, Hit);
+	ClickToMoveComponent->OnClickReleased();
+}
+
+void ATDBotPlayerController::TickAbilityInput(const float DeltaSeconds)
+{
+	UGASCoreAbilitySystemComponent* AbilitySystem = GetBotAbilitySystem();
+	if (!AbilitySystem)
+	{
+		return;
+	}
+
+	if (HeldInputTag.IsValid())
+	{
+		AbilitySystem->AbilityInputTagHeld(HeldInputTag);
+		HoldRemaining -= DeltaSeconds;
+		if (HoldRemaining <= 0.f)
+		{
+			ReleaseAbilityInput();
+		}
+		return;
+	}
+
+	if (AbilityInputTags.IsEmpty() || Random.FRand() >= AbilityPressesPerSecond * DeltaSeconds)
+	{
+		return;
+	}
+
+	if (const APawn* ControlledPawn = GetPawn())
+	{
+		const FVector2D Offset = FVector2D(Random.VRand()).GetSafeNormal() * Random.FRandRange(0.f, AimRadius);
+		AimLocation = ControlledPawn->GetActorLocation() + FVector(Offset, 0.f);
+	}
+
+	HeldInputTag = AbilityInputTags[Random.RandHelper(AbilityInputTags.Num())];
+	HoldRemaining = AbilityHoldSeconds;
+	AbilitySystem->AbilityInputTagHeld(HeldInputTag);
+}
+
+void ATDBotPlayerController::ReleaseAbilityInput()
+{
+	if (UGASCoreAbilitySystemComponent* AbilitySystem = GetBotAbilitySystem())
+	{
+		AbilitySystem->AbilityInputTagReleased(HeldInputTag);
+	}
+	HeldInputTag = FGameplayTag();
+}
+
+UGASCoreAbilitySystemComponent* ATDBotPlayerController::GetBotAbilitySystem() const
+{
+	return Cast<UGASCoreAbilitySystemComponent>(UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(GetPawn()));
+}
@@ -10,8 +10,11 @@
 #include "AbilitySystem/Components/TDAbilitySystemComponent.h"
 #include "Components/ClickToMoveComponent.h"
 #include "Input/TDEnhancedInputComponent.h"       // UTDEnhancedInputComponent for binding with tags
+#include "HighlightActor.h"                       // HIGHLIGHTABLE
 #include "Input/TDInputConfig.h"
+#include "UI/HUD/TDHUD.h"
 #include "Interaction/HighlightInteraction.h"     // UHighlightInteraction
+#include "Interaction/HighlightCursorHitSubsystem.h" // UHighlightCursorHitSubsystem (shared per-frame cursor hits)
 
 ATDPlayerController::ATDPlayerController()
 {
@@ -26,30 +29,42 @@ ATDPlayerController::ATDPlayerController()
 	
 }
 
+bool ATDPlayerController::GetAbilityCursorHit(const ECollisionChannel Channel, FHitResult& OutHit)
+{
+	if (UHighlightCursorHitSubsystem* CursorHits = UHighlightCursorHitSubsystem::Get(this))
+	{
+		return CursorHits->GetCursorHit(this, Channel, /*bTraceComplex=*/false, HitResultTraceDistance, OutHit);
+	}
+	return GetHitResultUnderCursor(Channel, /*bTraceComplex=*/false, OutHit);
+}
+
 void ATDPlayerController::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Only local player controllers have a valid ULocalPlayer pointer.
-	// Mapping contexts are a client/local concern (do not assert on server).
-	const ULocalPlayer* LocalPlayer = Cast<ULocalPlayer>(Player);
-	if (LocalPlayer)
-	{
-		// Early assert to catch missing input mapping context setup in BP/defaults.
-		checkf(GASInputMappingContext, TEXT("ATDPlayerController: GASInputMappingContext is null on [%s]. Set it in defaults/BP."), *GetNameSafe(this));
-
-		// Get the Enhanced Input subsystem for this local player and register the mapping context.
-		if (UEnhancedInputLocalPlayerSubsystem* InputSystem = LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>())
-		{
-			// Priority 0 (higher is higher priority, but 0 is fine for a primary context).
-			InputSystem->AddMappingContext(GASInputMappingContext, /*Priority=*/0);
-		}
-	}
+	AddInputMappingContext();
 
 	// Configure mouse for top-down/RTS-like control.
 	bShowMouseCursor = true;
 	DefaultMouseCursor = EMouseCursor::Default;
 
+	// Targeting state is pushed on highlight changes; held input reads the cached flag.
+	HighlightInteraction->OnHighlightedActorChanged.AddUObject(this, &ThisClass::OnHighlightedActorChanged);
+	bTargeting = HighlightInteraction->GetHighlightedActor() != nullptr;
+
+	// Highlighting and click-to-move answer their channels from one cursor trace per frame.
+	if (UHighlightCursorHitSubsystem* CursorHits = UHighlightCursorHitSubsystem::Get(this))
+	{
+		const TEnumAsByte<ECollisionChannel> SharedChannels[] = { HIGHLIGHTABLE, ClickToMoveComponent->GetCursorTraceChannel() };
+		CursorHits->SetSharedChannels(SharedChannels, HitResultTraceDistance);
+	}
+
+	// Late hold sampling (bLateHeldCursorSampling) pulls its nav-channel hit from the shared cursor hit cache too.
+	ClickToMoveComponent->SetLateCursorHitProvider(FClickToMoveCursorHitProvider::CreateWeakLambda(this, [this](FHitResult& OutHit)
+	{
+		return GetAbilityCursorHit(ClickToMoveComponent->GetCursorTraceChannel(), OutHit);
+	}));
+
 	// Set input mode to Game and UI (allows both gameplay and UI input).
 	FInputModeGameAndUI InputModeData;
 	// Do not lock mouse to viewport (allows dragging out for multi-monitor).
@@ -60,6 +75,39 @@ void ATDPlayerController::BeginPlay()
 	SetInputMode(InputModeData);
 }
 
+void ATDPlayerController::AcknowledgePossession(APawn* P)
+{
+	Super::AcknowledgePossession(P);
+
+	// New pawn, new ASC: drop the cached pointer (looked up again on first use).
+	TDAbilitySystemComponent = nullptr;
+
+	// Respawn path: the context normally survives; re-adding it would force a full mapping rebuild.
+	AddInputMappingContext();
+}
+
+void ATDPlayerController::AddInputMappingContext() const
+{
+	// Only local player controllers have a valid ULocalPlayer pointer.
+	// Mapping contexts are a client/local concern (do not assert on server).
+	const ULocalPlayer* LocalPlayer = Cast<ULocalPlayer>(Player);
+	if (!LocalPlayer)
+	{
+		return;
+	}
+
+	// Early assert to catch missing input mapping context setup in BP/defaults.
+	checkf(GASInputMappingContext, TEXT("ATDPlayerController: GASInputMappingContext is null on [%s]. Set it in defaults/BP."), *GetNameSafe(this));
+
+	// Get the Enhanced Input subsystem for this local player and register the mapping context.
+	UEnhancedInputLocalPlayerSubsystem* InputSystem = LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>();
+	if (InputSystem && !InputSystem->HasMappingContext(GASInputMappingContext))
+	{
+		// Priority 0 (higher is higher priority, but 0 is fine for a primary context).
+		InputSystem->AddMappingContext(GASInputMappingContext, /*Priority=*/0);
+	}
+}
+
 void ATDPlayerController::SetupInputComponent()
 {
 	Super::SetupInputComponent();
@@ -73,19 +121,39 @@ void ATDPlayerController::SetupInputComponent()
 		TDEnhancedInputComponent->BindAction(MoveAction, ETriggerEvent::Triggered, this, &ThisClass::Move);
 	}
 
+	// Optional: the attribute menu can also be opened from the overlay (ATDHUD::OpenAttributeMenu).
+	if (ToggleAttributeMenuAction)
+	{
+		TDEnhancedInputComponent->BindAction(ToggleAttributeMenuAction, ETriggerEvent::Started, this, &ThisClass::ToggleAttributeMenu);
+	}
+
 	// Bind all ability input actions (Pressed/Released/Held) using the data-driven input config.
+	// Held input is aggregated: one callback per frame with every held tag. The component caches the bindings per
+	// config, so this is a no-op when they already exist.
 	if (ensureMsgf(InputConfig != nullptr, TEXT("ATDPlayerController: InputConfig is null. Set it in defaults/BP.")))
 	{
-		TDEnhancedInputComponent->BindAbilityInputActions(
+		BuildInputRoutes();
+		TDEnhancedInputComponent->BindAbilityInputActionsAggregated(
 			InputConfig,
 			this,
 			&ThisClass::AbilityInputActionTagPressed,
 			&ThisClass::AbilityInputActionReleased,
-			&ThisClass::AbilityInputActionHeld
+			&ThisClass::AbilityInputActionsHeld
 		);
 	}
 }
 
+void ATDPlayerController::PostProcessInput(const float DeltaTime, const bool bGamePaused)
+{
+	// Flush before the rest of the tick so held-input activations go out with this frame's RPCs.
+	if (UTDEnhancedInputComponent* TDEnhancedInputComponent = Cast<UTDEnhancedInputComponent>(InputComponent))
+	{
+		TDEnhancedInputComponent->FlushHeldAbilityInput();
+	}
+
+	Super::PostProcessInput(DeltaTime, bGamePaused);
+}
+
 void ATDPlayerController::Move(const FInputActionValue& InputActionValue)
 {
 	ClickToMoveComponent->SetAutoRunActive(false);
@@ -111,6 +179,24 @@ void ATDPlayerController::Move(const FInputActionValue& InputActionValue)
 	}
 }
 
+void ATDPlayerController::ToggleAttributeMenu()
+{
+	ATDHUD* TDHUD = Cast<ATDHUD>(GetHUD());
+	if (!TDHUD)
+	{
+		return;
+	}
+
+	if (TDHUD->IsAttributeMenuOpen())
+	{
+		TDHUD->CloseAttributeMenu();
+	}
+	else
+	{
+		TDHUD->OpenAttributeMenu();
+	}
+}
+
 UTDAbilitySystemComponent* ATDPlayerController::GetASC()
 {
 	if (TDAbilitySystemComponent == nullptr)
@@ -120,66 +206,103 @@ UTDAbilitySystemComponent* ATDPlayerController::GetASC()
 	return TDAbilitySystemComponent;
 }
 
-void ATDPlayerController::AbilityInputActionTagPressed(const FGameplayTag InputTag)
+void ATDPlayerController::BuildInputRoutes()
 {
-	// LMB is shared by abilities and movement; gate movement when targeting.
-	if (InputTag.MatchesTagExact(FTDGameplayTags::Get().InputTag_LMB))
+	InputRoutes.Reset();
+
+	const FGameplayTag& LMBTag = FTDGameplayTags::Get().InputTag_LMB;
+	for (const FGASCoreAbilityInputAction& Action : InputConfig->AbilityInputActions)
 	{
-		const bool bIsTargeting = HighlightInteraction && (HighlightInteraction->GetHighlightedActor() != nullptr);
-		ClickToMoveComponent->SetIsTargeting(bIsTargeting);
-		ClickToMoveComponent->OnClickPressed();
+		if (Action.InputTag.IsValid() && !InputRoutes.ContainsByPredicate(
+			[&Action](const FInputRouteEntry& Entry) { return Entry.InputTag == Action.InputTag; }))
+		{
+			InputRoutes.Add({ Action.InputTag, Action.InputTag == LMBTag ? EInputRoute::Pointer : EInputRoute::Ability });
+		}
 	}
 }
 
-void ATDPlayerController::AbilityInputActionReleased(const FGameplayTag InputTag)
+ATDPlayerController::EInputRoute ATDPlayerController::FindInputRoute(const FGameplayTag& InputTag) const
 {
-	// Non-LMB: forward to ASC.
-	if (!InputTag.MatchesTagExact(FTDGameplayTags::Get().InputTag_LMB))
+	for (const FInputRouteEntry& Entry : InputRoutes)
 	{
-		if (GetASC())
+		if (Entry.InputTag == InputTag)
 		{
-			GetASC()->AbilityInputTagReleased(InputTag);
+			return Entry.Route;
 		}
-		return;
 	}
+	return EInputRoute::Ability;
+}
+
+void ATDPlayerController::OnHighlightedActorChanged(AActor* NewActor)
+{
+	bTargeting = NewActor != nullptr;
+}
+
+void ATDPlayerController::AbilityInputActionTagPressed(const FGameplayTag InputTag)
+{
+	// Pointer (LMB) is shared by abilities and movement; gate movement when targeting.
+	if (FindInputRoute(InputTag) == EInputRoute::Pointer)
+	{
+		// Hover may be throttled (adaptive trace rate); decide targeting on a fresh trace (pushes bTargeting).
+		HighlightInteraction->RefreshHighlightNow();
+		ClickToMoveComponent->SetIsTargeting(bTargeting);
+		ClickToMoveComponent->OnClickPressed();
+	}
+}
 
-	// LMB: if targeting, forward to ASC; otherwise finalize click-to-move (build a path on short press).
-	if (HighlightInteraction->GetHighlightedActor())
+void ATDPlayerController::AbilityInputActionReleased(const FGameplayTag InputTag)
+{
+	// Ability input (and the pointer while targeting) goes to the ASC; otherwise finalize click-to-move
+	// (build a path on short press).
+	if (FindInputRoute(InputTag) == EInputRoute::Ability || bTargeting)
 	{
-		if (GetASC())
+		if (UTDAbilitySystemComponent* ASC = GetASC())
 		{
-			GetASC()->AbilityInputTagReleased(InputTag);
+			ASC->AbilityInputTagReleased(InputTag);
 		}
+		return;
 	}
-	else
-	{
-		ClickToMoveComponent->OnClickReleased();
-	}
+
+	ClickToMoveComponent->OnClickReleased();
 }
 
-void ATDPlayerController::AbilityInputActionHeld(const FGameplayTag InputTag)
+void ATDPlayerController::AbilityInputActionsHeld(const TArrayView<const FGameplayTag> InputTags)
 {
-	// Non-LMB: forward to ASC.
-	if (!InputTag.MatchesTagExact(FTDGameplayTags::Get().InputTag_LMB))
+	// One route lookup per held tag: ability tags (and the pointer while targeting) go to the ASC.
+	TArray<FGameplayTag, TInlineAllocator<8>> ASCInputTags;
+	for (const FGameplayTag& InputTag : InputTags)
 	{
-		if (GetASC())
+		if (FindInputRoute(InputTag) == EInputRoute::Ability || bTargeting)
 		{
-			GetASC()->AbilityInputTagHeld(InputTag);
+			ASCInputTags.Add(InputTag);
+		}
+		else
+		{
+			HandleClickToMoveHeld();
 		}
-		return;
 	}
 
-	// LMB: when targeting, let ASC handle. Otherwise, let ClickToMove do its own NAVIGATION-channel trace.
-	if (HighlightInteraction->GetHighlightedActor())
+	if (!ASCInputTags.IsEmpty())
 	{
-		if (GetASC())
+		if (UTDAbilitySystemComponent* ASC = GetASC())
 		{
-			GetASC()->AbilityInputTagHeld(InputTag);
+			ASC->AbilityInputTagsHeld(ASCInputTags);
 		}
 	}
+}
+
+void ATDPlayerController::HandleClickToMoveHeld()
+{
+	if (UHighlightCursorHitSubsystem* CursorHits = UHighlightCursorHitSubsystem::Get(this))
+	{
+		// Nav-channel hit from the shared per-frame trace (the same one highlighting reads its channel from).
+		FHitResult NavHit;
+		CursorHits->GetCursorHit(this, ClickToMoveComponent->GetCursorTraceChannel(), /*bTraceComplex=*/false, HitResultTraceDistance, NavHit);
+		ClickToMoveComponent->OnClickHeld(/*bUseInternalHitResult=*/false, NavHit);
+	}
 	else
 	{
 		// Use internal nav-channel trace to get a ground point (avoids mixing highlight hits with nav hits).
 		ClickToMoveComponent->OnClickHeld(/*bUseInternalHitResult=*/true, FHitResult());
 	}
-}
\ No newline at end of file
+}
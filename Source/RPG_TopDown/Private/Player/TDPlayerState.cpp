@@ -4,14 +4,19 @@
 
 #include "Player/TDPlayerState.h"
 
+#include "AbilitySystem/Attributes/GASCoreAttributeMetadata.h"
 #include "AbilitySystem/Attributes/TDAttributeSet.h"
 #include "AbilitySystem/Components/TDAbilitySystemComponent.h"
+#include "AbilitySystem/Persistence/GASCoreAbilitySystemSnapshot.h"
+#include "Game/TDReplicationGraph.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "TimerManager.h"
 
 ATDPlayerState::ATDPlayerState()
 {
-	// Increase net update frequency for responsive attribute and state replication.
-	SetNetUpdateFrequency(100.f);
+	// Low idle rate: ASC activity forces updates and combat raises the rate (see NotifyNetActivity).
+	SetNetUpdateFrequency(IdleNetUpdateFrequency);
 
 	// Create the GAS AbilitySystemComponent as a default subobject.
 	// PlayerState is the authoritative owner for player-controlled characters.
@@ -20,7 +25,11 @@ ATDPlayerState::ATDPlayerState()
 	AbilitySystemComponent->SetReplicationMode(EGameplayEffectReplicationMode::Mixed); // Server sends important GE data.
 
 	// Create the GAS AttributeSet as a default subobject.
-	AttributeSet = CreateDefaultSubobject<UTDAttributeSet>("AttributeSet");
+	// Vitals replicate to everyone (party frames); primary/secondary stats only feed the owner's attribute menu.
+	UTDAttributeSet* TDAttributeSet = CreateDefaultSubobject<UTDAttributeSet>("AttributeSet");
+	TDAttributeSet->SetTierReplicationCondition(ETDAttributeTier::Primary, COND_OwnerOnly);
+	TDAttributeSet->SetTierReplicationCondition(ETDAttributeTier::Secondary, COND_OwnerOnly);
+	AttributeSet = TDAttributeSet;
 }
 
 void ATDPlayerState::GetLifetimeReplicatedProps(TArray<class FLifetimeProperty>& OutLifetimeProps) const
@@ -28,13 +37,125 @@ void ATDPlayerState::GetLifetimeReplicatedProps(TArray<class FLifetimeProperty>&
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	// Register PlayerLevel for replication so clients receive updates.
-	DOREPLIFETIME(ATDPlayerState, PlayerLevel);
+	// Push-based: only compared when SetPlayerLevel marks it dirty (idle PlayerStates cost nothing per update).
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ATDPlayerState, PlayerLevel, Params);
 }
 
 void ATDPlayerState::BeginPlay()
 {
 	Super::BeginPlay();
 	// PlayerState exists on server and owning client early; GAS may initialize later via Character.
+
+	if (HasAuthority())
+	{
+		// Blueprint defaults are known now (the constructor used the native default).
+		SetAdaptiveNetUpdateFrequency(IdleNetUpdateFrequency);
+		BindNetActivityDelegates();
+	}
+}
+
+void ATDPlayerState::BindNetActivityDelegates()
+{
+	if (!AbilitySystemComponent)
+	{
+		return;
+	}
+
+	AbilitySystemComponent->OnGameplayEffectAppliedDelegateToSelf.AddUObject(this, &ThisClass::HandleEffectAppliedForNet);
+	AbilitySystemComponent->OnAnyGameplayEffectRemovedDelegate().AddUObject(this, &ThisClass::HandleEffectRemovedForNet);
+	AbilitySystemComponent->AbilityActivatedCallbacks.AddUObject(this, &ThisClass::HandleAbilityActivatedForNet);
+	AbilitySystemComponent->RegisterGenericGameplayTagEvent().AddUObject(this, &ThisClass::HandleTagChangedForNet);
+
+	// Coalesced per frame (one callback for every attribute changed this frame).
+	if (UGASCoreAbilitySystemComponent* CoreASC = Cast<UGASCoreAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		CoreASC->OnAttributeDeltaBatch.AddUObject(this, &ThisClass::HandleAttributeDeltasForNet);
+	}
+
+	if (const UGASCoreAttributeSet* CoreSet = Cast<UGASCoreAttributeSet>(AttributeSet))
+	{
+		const FGASCoreAttributeMetadata& Metadata = FGASCoreAttributeMetadata::Get(CoreSet);
+		RegeneratingOrdinals.Init(false, Metadata.Num());
+		for (const FGASCoreRegeneration& Regeneration : Metadata.Regenerations)
+		{
+			RegeneratingOrdinals[Regeneration.CurrentOrdinal] = true;
+		}
+	}
+}
+
+void ATDPlayerState::NotifyNetActivity(const bool bCombatEvent)
+{
+	if (LastForcedNetUpdateFrame != GFrameCounter)
+	{
+		LastForcedNetUpdateFrame = GFrameCounter;
+		ForceNetUpdate();
+	}
+
+	if (!bCombatEvent || BurstDuration <= 0.f || LastNetBurstRefreshFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastNetBurstRefreshFrame = GFrameCounter;
+
+	if (!bNetBurstActive)
+	{
+		bNetBurstActive = true;
+		SetAdaptiveNetUpdateFrequency(BurstNetUpdateFrequency);
+	}
+	GetWorldTimerManager().SetTimer(NetBurstTimerHandle, this, &ThisClass::EndNetBurst, BurstDuration, false);
+}
+
+void ATDPlayerState::EndNetBurst()
+{
+	bNetBurstActive = false;
+	SetAdaptiveNetUpdateFrequency(IdleNetUpdateFrequency);
+}
+
+void ATDPlayerState::SetAdaptiveNetUpdateFrequency(const float Frequency)
+{
+	if (GetNetUpdateFrequency() != Frequency)
+	{
+		SetNetUpdateFrequency(Frequency);
+		UTDReplicationGraph::NotifyNetUpdateFrequencyChanged(this);
+	}
+}
+
+void ATDPlayerState::HandleEffectAppliedForNet(UAbilitySystemComponent* ASC, const FGameplayEffectSpec& Spec,
+	FActiveGameplayEffectHandle Handle)
+{
+	NotifyNetActivity(true);
+}
+
+void ATDPlayerState::HandleEffectRemovedForNet(const FActiveGameplayEffect& Effect)
+{
+	NotifyNetActivity(false);
+}
+
+void ATDPlayerState::HandleAbilityActivatedForNet(UGameplayAbility* Ability)
+{
+	NotifyNetActivity(true);
+}
+
+void ATDPlayerState::HandleAttributeDeltasForNet(const TArrayView<const FGASCoreAttributeDelta> Deltas)
+{
+	const UGASCoreAttributeSet* CoreSet = Cast<UGASCoreAttributeSet>(AttributeSet);
+	const FGASCoreAttributeMetadata* Metadata = CoreSet ? &FGASCoreAttributeMetadata::Get(CoreSet) : nullptr;
+	for (const FGASCoreAttributeDelta& Delta : Deltas)
+	{
+		const int32 Ordinal = Metadata ? Metadata->GetOrdinal(Delta.Attribute) : INDEX_NONE;
+		if (Ordinal == INDEX_NONE || !RegeneratingOrdinals.IsValidIndex(Ordinal) || !RegeneratingOrdinals[Ordinal])
+		{
+			NotifyNetActivity(false);
+			return;
+		}
+	}
+}
+
+void ATDPlayerState::HandleTagChangedForNet(const FGameplayTag Tag, const int32 NewCount)
+{
+	NotifyNetActivity(false);
 }
 
 UAbilitySystemComponent* ATDPlayerState::GetAbilitySystemComponent() const
@@ -48,8 +169,99 @@ UAttributeSet* ATDPlayerState::GetAttributeSet() const
 	return AttributeSet;
 }
 
-void ATDPlayerState::OnRep_PlayerLevel(int32 OldLevel)
+void ATDPlayerState::SetPlayerLevel(const int32 NewLevel)
+{
+	if (PlayerLevel != NewLevel)
+	{
+		const int32 OldLevel = PlayerLevel;
+		PlayerLevel = NewLevel;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ATDPlayerState, PlayerLevel, this);
+		OnPlayerLevelChanged.Broadcast(OldLevel, NewLevel);
+	}
+}
+
+void ATDPlayerState::SaveGASState(TArray<uint8>& OutBytes) const
+{
+	OutBytes.Reset();
+	if (AbilitySystemComponent)
+	{
+		FGASCoreAbilitySystemSnapshot::Capture(*AbilitySystemComponent, PersistentEffectTags).Save(OutBytes);
+	}
+}
+
+void ATDPlayerState::SetPendingGASState(TArray<uint8> Bytes)
+{
+	PendingGASState = MoveTemp(Bytes);
+	bPendingGASStateFromTravel = false;
+}
+
+void ATDPlayerState::SetAttributeInitEffects(TArray<TSubclassOf<UGameplayEffect>> EffectClasses)
+{
+	AttributeInitEffects = MoveTemp(EffectClasses);
+}
+
+bool ATDPlayerState::ApplyPendingGASState()
+{
+	if (PendingGASState.IsEmpty() || !AbilitySystemComponent)
+	{
+		return false;
+	}
+
+	FGASCoreAbilitySystemSnapshot Snapshot;
+	const bool bLoaded = Snapshot.Load(PendingGASState);
+	PendingGASState.Empty();
+	bPendingGASStateFromTravel = false;
+	return bLoaded && Snapshot.Apply(*AbilitySystemComponent);
+}
+
+void ATDPlayerState::CopyProperties(APlayerState* PlayerState)
+{
+	Super::CopyProperties(PlayerState);
+
+	if (ATDPlayerState* TDPlayerState = Cast<ATDPlayerState>(PlayerState))
+	{
+		ForwardGASState(*TDPlayerState);
+	}
+}
+
+void ATDPlayerState::OverrideWith(APlayerState* PlayerState)
+{
+	Super::OverrideWith(PlayerState);
+
+	if (const ATDPlayerState* TDPlayerState = Cast<ATDPlayerState>(PlayerState))
+	{
+		TDPlayerState->ForwardGASState(*this);
+	}
+}
+
+void ATDPlayerState::ForwardGASState(ATDPlayerState& Target) const
+{
+	Target.SetPlayerLevel(PlayerLevel);
+	if (!AbilitySystemComponent)
+	{
+		return;
+	}
+
+	// Still pending here (travelled again before an avatar restored it): pass it on unchanged.
+	if (!PendingGASState.IsEmpty())
+	{
+		Target.PendingGASState = PendingGASState;
+		Target.bPendingGASStateFromTravel = bPendingGASStateFromTravel;
+	}
+	else
+	{
+		// The init effects travel with the state, so the new avatar neither re-applies them nor re-grants abilities.
+		FGASCoreAbilitySystemSnapshot::Capture(*AbilitySystemComponent, PersistentEffectTags, AttributeInitEffects).Save(Target.PendingGASState);
+		Target.bPendingGASStateFromTravel = !Target.PendingGASState.IsEmpty();
+	}
+	Target.AttributeInitEffects = AttributeInitEffects;
+}
+
+void ATDPlayerState::OnRep_PlayerLevel(const int32 OldLevel)
 {
-	// Client-side reaction to level changes (e.g., update HUD, re-run derived stat display).
-	// Note: Reapplying derived infinite GE (if required) should be initiated on server.
+	// Clients: the avatar refreshes its cached level (HUD and MMC re-evaluation listen there).
+	if (OldLevel != PlayerLevel)
+	{
+		OnPlayerLevelChanged.Broadcast(OldLevel, PlayerLevel);
+	}
 }
\ No newline at end of file
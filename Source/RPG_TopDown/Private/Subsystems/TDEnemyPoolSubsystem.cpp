@@ -0,0 +1,114 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/TDEnemyPoolSubsystem.h"
+
+#include "Charcters/TDEnemyCharacter.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarTDEnemyPoolMaxPerClass(
+	TEXT("TD.EnemyPool.MaxPerClass"),
+	64,
+	TEXT("Inactive enemies kept per class for reuse; released enemies beyond this are destroyed."),
+	ECVF_Default);
+
+UTDEnemyPoolSubsystem* UTDEnemyPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTDEnemyPoolSubsystem>() : nullptr;
+}
+
+ATDEnemyCharacter* UTDEnemyPoolSubsystem::AcquireEnemy(const TSubclassOf<ATDEnemyCharacter> EnemyClass, const FTransform& Transform,
+	UGASCoreAttributeArchetypeDataAsset* Archetype, const int32 Level)
+{
+	const UWorld* World = GetWorld();
+	if (!EnemyClass || !World || World->GetNetMode() == NM_Client)
+	{
+		return nullptr;
+	}
+
+	// Reuse: pooled actors may have been destroyed externally (streaming, level cleanup) in the meantime.
+	ATDEnemyCharacter* Enemy = nullptr;
+	if (FTDEnemyPool* Pool = Pools.Find(EnemyClass.Get()))
+	{
+		while (!Enemy && !Pool->Actors.IsEmpty())
+		{
+			ATDEnemyCharacter* Candidate = Pool->Actors.Pop(EAllowShrinking::No);
+			Enemy = IsValid(Candidate) ? Candidate : nullptr;
+		}
+	}
+
+	if (!Enemy)
+	{
+		Enemy = SpawnEnemy(EnemyClass, Transform);
+		if (!Enemy)
+		{
+			return nullptr;
+		}
+	}
+
+	Enemy->ActivateFromPool(Transform, Archetype, Level);
+	return Enemy;
+}
+
+void UTDEnemyPoolSubsystem::ReleaseEnemy(ATDEnemyCharacter* Enemy)
+{
+	if (!IsValid(Enemy) || Enemy->IsInPool() || !Enemy->HasAuthority())
+	{
+		return;
+	}
+
+	FTDEnemyPool& Pool = Pools.FindOrAdd(Enemy->GetClass());
+	if (Pool.Actors.Num() >= CVarTDEnemyPoolMaxPerClass.GetValueOnGameThread())
+	{
+		Enemy->Destroy();
+		return;
+	}
+
+	Enemy->DeactivateToPool();
+	Pool.Actors.Add(Enemy);
+}
+
+void UTDEnemyPoolSubsystem::PrewarmEnemies(const TSubclassOf<ATDEnemyCharacter> EnemyClass, const int32 Count)
+{
+	const UWorld* World = GetWorld();
+	if (!EnemyClass || !World || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	const int32 Target = FMath::Min(Count, CVarTDEnemyPoolMaxPerClass.GetValueOnGameThread());
+	Pools.FindOrAdd(EnemyClass.Get()).Actors.Reserve(Target);
+
+	// Spawning runs BeginPlay, which may touch the pools (map reallocation): look the pool up again every time.
+	while (GetNumPooled(EnemyClass) < Target)
+	{
+		ATDEnemyCharacter* Enemy = SpawnEnemy(EnemyClass, FTransform::Identity);
+		if (!Enemy)
+		{
+			return;
+		}
+		Enemy->DeactivateToPool();
+		Pools.FindChecked(EnemyClass.Get()).Actors.Add(Enemy);
+	}
+}
+
+int32 UTDEnemyPoolSubsystem::GetNumPooled(const TSubclassOf<ATDEnemyCharacter> EnemyClass) const
+{
+	const FTDEnemyPool* Pool = Pools.Find(EnemyClass.Get());
+	return Pool ? Pool->Actors.Num() : 0;
+}
+
+void UTDEnemyPoolSubsystem::Deinitialize()
+{
+	Pools.Reset();
+
+	Super::Deinitialize();
+}
+
+ATDEnemyCharacter* UTDEnemyPoolSubsystem::SpawnEnemy(const TSubclassOf<ATDEnemyCharacter> EnemyClass, const FTransform& Transform) const
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	return GetWorld()->SpawnActor<ATDEnemyCharacter>(EnemyClass, Transform, SpawnParameters);
+}
@@ -0,0 +1,199 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/TDEnemySignificanceSubsystem.h"
+
+#include "Camera/PlayerCameraManager.h"
+#include "Charcters/TDEnemyCharacter.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarTDEnemySignificanceUpdateInterval(
+	TEXT("TD.EnemySignificance.UpdateInterval"),
+	0.25f,
+	TEXT("Seconds between enemy significance evaluations (0 = every frame)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarTDEnemySignificanceNearDistance(
+	TEXT("TD.EnemySignificance.NearDistance"),
+	1500.f,
+	TEXT("Enemies within this distance (cm) of any player view point are always High."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarTDEnemySignificanceFarDistance(
+	TEXT("TD.EnemySignificance.FarDistance"),
+	6000.f,
+	TEXT("Enemies inside a player's view cone stay High up to this distance (cm); beyond it of every view they are Low."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarTDEnemySignificanceFOVMargin(
+	TEXT("TD.EnemySignificance.FOVMarginDegrees"),
+	15.f,
+	TEXT("Degrees added to the half FOV so enemies just off screen (and about to enter it) keep full fidelity."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarTDEnemyReplicationCrowdedRelevantEnemies(
+	TEXT("TD.EnemyReplication.CrowdedRelevantEnemies"),
+	48,
+	TEXT("Server: a player with more enemies than this within net cull distance is crowded. Low significance enemies relevant only to crowded players stop replicating GE-driven state (tags, active effects). 0 = never."),
+	ECVF_Default);
+
+UTDEnemySignificanceSubsystem* UTDEnemySignificanceSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTDEnemySignificanceSubsystem>() : nullptr;
+}
+
+void UTDEnemySignificanceSubsystem::RegisterEnemy(ATDEnemyCharacter* Enemy)
+{
+	if (IsValid(Enemy))
+	{
+		Enemies.AddUnique(Enemy);
+	}
+}
+
+void UTDEnemySignificanceSubsystem::UnregisterEnemy(ATDEnemyCharacter* Enemy)
+{
+	Enemies.RemoveSwap(Enemy, EAllowShrinking::No);
+}
+
+void UTDEnemySignificanceSubsystem::Tick(const float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTDEnemySignificanceSubsystem::Tick);
+
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate < CVarTDEnemySignificanceUpdateInterval.GetValueOnGameThread())
+	{
+		return;
+	}
+	TimeSinceUpdate = 0.f;
+
+	TArray<FViewPoint, TInlineAllocator<4>> Views;
+	GatherViewPoints(Views);
+
+	const float NearDistSq = FMath::Square(CVarTDEnemySignificanceNearDistance.GetValueOnGameThread());
+	const float FarDistSq = FMath::Square(CVarTDEnemySignificanceFarDistance.GetValueOnGameThread());
+
+	// Server: relevant enemies per view (one per connection) for the replication safety valve. Each view is crowded
+	// from its own count of the previous pass.
+	const int32 CrowdedThreshold = CVarTDEnemyReplicationCrowdedRelevantEnemies.GetValueOnGameThread();
+	const bool bServer = GetWorld()->GetNetMode() < NM_Client;
+	const bool bCountRelevant = bServer && CrowdedThreshold > 0;
+	bool bAnyViewCrowded = false;
+	if (bCountRelevant)
+	{
+		for (FViewPoint& View : Views)
+		{
+			const TPair<TWeakObjectPtr<const APlayerController>, int32>* LastCount = LastRelevantEnemies.FindByPredicate(
+				[&View](const TPair<TWeakObjectPtr<const APlayerController>, int32>& Pair) { return Pair.Key == View.PlayerController; });
+			View.bCrowded = LastCount && LastCount->Value > CrowdedThreshold;
+			bAnyViewCrowded |= View.bCrowded;
+		}
+	}
+	TArray<int32, TInlineAllocator<4>> RelevantEnemies;
+	RelevantEnemies.SetNumZeroed(bCountRelevant ? Views.Num() : 0);
+
+	for (int32 Index = Enemies.Num() - 1; Index >= 0; --Index)
+	{
+		ATDEnemyCharacter* Enemy = Enemies[Index].Get();
+		if (!Enemy)
+		{
+			Enemies.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+
+		// No view at all (server without players, loading): keep full fidelity rather than guess.
+		ETDEnemySignificance Significance = Views.IsEmpty() ? ETDEnemySignificance::High : ETDEnemySignificance::Low;
+		const FVector Location = Enemy->GetActorLocation();
+		const float CullDistSq = Enemy->GetNetCullDistanceSquared();
+		bool bRelevantToUncrowdedView = false;
+		for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
+		{
+			const FViewPoint& View = Views[ViewIndex];
+			const FVector ToEnemy = Location - View.Location;
+			const float DistSq = ToEnemy.SizeSquared();
+			if (bCountRelevant && DistSq <= CullDistSq)
+			{
+				++RelevantEnemies[ViewIndex];
+				bRelevantToUncrowdedView |= !View.bCrowded;
+			}
+			if (Significance == ETDEnemySignificance::High || DistSq > FarDistSq)
+			{
+				continue;
+			}
+			if (DistSq <= NearDistSq || FVector::DotProduct(ToEnemy, View.Forward) >= View.CosHalfFOV * FMath::Sqrt(DistSq))
+			{
+				Significance = ETDEnemySignificance::High;
+				if (!bCountRelevant)
+				{
+					break;
+				}
+				continue;
+			}
+			Significance = ETDEnemySignificance::Medium;
+		}
+
+		if (Significance != Enemy->GetSignificance())
+		{
+			Enemy->SetSignificance(Significance);
+		}
+		// Replication state is per actor: reduce only when no uncrowded player would miss it.
+		if (bServer)
+		{
+			Enemy->SetReplicationReduced(bAnyViewCrowded && !bRelevantToUncrowdedView && Significance == ETDEnemySignificance::Low);
+		}
+	}
+
+	MaxRelevantEnemies = 0;
+	LastRelevantEnemies.Reset();
+	for (int32 ViewIndex = 0; ViewIndex < RelevantEnemies.Num(); ++ViewIndex)
+	{
+		MaxRelevantEnemies = FMath::Max(MaxRelevantEnemies, RelevantEnemies[ViewIndex]);
+		LastRelevantEnemies.Emplace(Views[ViewIndex].PlayerController, RelevantEnemies[ViewIndex]);
+	}
+}
+
+void UTDEnemySignificanceSubsystem::GatherViewPoints(TArray<FViewPoint, TInlineAllocator<4>>& OutViews) const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const float MarginDegrees = CVarTDEnemySignificanceFOVMargin.GetValueOnGameThread();
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!PC || (!PC->PlayerCameraManager && !PC->GetPawn()))
+		{
+			continue;
+		}
+
+		FVector Location;
+		FRotator Rotation;
+		PC->GetPlayerViewPoint(Location, Rotation);
+
+		const float FOV = PC->PlayerCameraManager ? PC->PlayerCameraManager->GetFOVAngle() : 90.f;
+		const float HalfAngle = FMath::Clamp(FOV * 0.5f + MarginDegrees, 0.f, 180.f);
+
+		FViewPoint& View = OutViews.AddDefaulted_GetRef();
+		View.PlayerController = PC;
+		View.Location = Location;
+		View.Forward = Rotation.Vector();
+		View.CosHalfFOV = FMath::Cos(FMath::DegreesToRadians(HalfAngle));
+	}
+}
+
+void UTDEnemySignificanceSubsystem::Deinitialize()
+{
+	Enemies.Reset();
+	LastRelevantEnemies.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UTDEnemySignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTDEnemySignificanceSubsystem, STATGROUP_Tickables);
+}
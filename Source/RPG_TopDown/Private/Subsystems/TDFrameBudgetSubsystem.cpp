@@ -0,0 +1,408 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/TDFrameBudgetSubsystem.h"
+
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Interaction/HighlightInteraction.h"
+#include "Misc/OutputDevice.h"
+#include "Subsystems/ClickToMovePathFollowerSubsystem.h"
+#include "Subsystems/ClickToMovePathRequestSubsystem.h"
+#include "Trace/Trace.h"
+#include "Utilities/GASCoreFrameBudget.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTDBudget, Log, All);
+
+static_assert(static_cast<int32>(ETDFrameBudgetArea::UIBroadcast) == static_cast<int32>(EGASCoreFrameBudgetArea::UIBroadcast)
+	&& static_cast<int32>(ETDFrameBudgetArea::Highlight) == static_cast<int32>(EGASCoreFrameBudgetArea::Num),
+	"ETDFrameBudgetArea must start with the GASCore areas, in order");
+
+namespace TDFrameBudget
+{
+	static TAutoConsoleVariable<float> CVarEffectApplicationMs(
+		TEXT("TD.Budget.EffectApplicationMs"), 1.f,
+		TEXT("Per-frame budget (ms) of GameplayEffect application on GASCore ASCs (TD.Budget dashboard). <= 0 = none."),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarAttributeCallbacksMs(
+		TEXT("TD.Budget.AttributeCallbacksMs"), 0.5f,
+		TEXT("Per-frame budget (ms) of GASCore attribute set callbacks and attribute delta broadcasts. <= 0 = none."),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarAbilityActivationMs(
+		TEXT("TD.Budget.AbilityActivationMs"), 0.5f,
+		TEXT("Per-frame budget (ms) of ability activation (input activation and GASCore ActivateAbility). <= 0 = none."),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarProjectileUpdateMs(
+		TEXT("TD.Budget.ProjectileUpdateMs"), 0.5f,
+		TEXT("Per-frame budget (ms) of the GASCore projectile simulation tick. <= 0 = none."),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarUIBroadcastMs(
+		TEXT("TD.Budget.UIBroadcastMs"), 0.5f,
+		TEXT("Per-frame budget (ms) of widget controller / view model broadcasts, overhead bars and combat text. <= 0 = none."),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarHighlightMs(
+		TEXT("TD.Budget.HighlightMs"), 0.25f,
+		TEXT("Per-frame budget (ms) of the local players' highlight interaction ticks. <= 0 = none."),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarClickToMoveMs(
+		TEXT("TD.Budget.ClickToMoveMs"), 0.5f,
+		TEXT("Per-frame budget (ms) of the click-to-move path queue and path follower ticks. <= 0 = none."),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<bool> CVarOverlay(
+		TEXT("TD.Budget.Overlay"), true,
+		TEXT("Draw the frame budget dashboard on screen while it runs (TD.Budget.Start)."),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float>* const BudgetVariables[] = { &CVarEffectApplicationMs, &CVarAttributeCallbacksMs,
+		&CVarAbilityActivationMs, &CVarProjectileUpdateMs, &CVarUIBroadcastMs, &CVarHighlightMs, &CVarClickToMoveMs };
+	static_assert(UE_ARRAY_COUNT(BudgetVariables) == static_cast<int32>(ETDFrameBudgetArea::Num), "Budget variables out of sync");
+
+	static const TCHAR* AreaNames[] = { TEXT("GE Application"), TEXT("Attribute Callbacks"), TEXT("Ability Activation"),
+		TEXT("Projectile Update"), TEXT("UI Broadcasts"), TEXT("Highlight"), TEXT("Click-to-Move") };
+	static_assert(UE_ARRAY_COUNT(AreaNames) == static_cast<int32>(ETDFrameBudgetArea::Num), "Area names out of sync");
+
+	/** Weight of the newest frame in the smoothed average (about the last 20 frames). */
+	static constexpr float AverageWeight = 0.05f;
+
+	/**
+	 * Switch a console variable, returning its previous value. Sets at the variable's current priority so a value QA
+	 * typed in the console (SetByConsole) does not make the switch a no-op.
+	 */
+	static bool SetConsoleBool(const TCHAR* Name, const bool bValue)
+	{
+		IConsoleVariable* Variable = IConsoleManager::Get().FindConsoleVariable(Name);
+		if (!Variable)
+		{
+			return false;
+		}
+
+		const bool bPrevious = Variable->GetBool();
+		Variable->Set(bValue, static_cast<EConsoleVariableFlags>(Variable->GetFlags() & ECVF_SetByMask));
+		return bPrevious;
+	}
+
+#if GASCORE_FRAME_BUDGET
+	/** Insights channels of the dashboard's systems, turned on by TD.Budget.CombatPreset. */
+	static const TCHAR* const PresetTraceChannels[] = { TEXT("GASCore"), TEXT("GASCoreUI"), TEXT("Highlight"), TEXT("ClickToMove") };
+
+	static FAutoConsoleCommandWithWorldAndArgs StartCommand(
+		TEXT("TD.Budget.Start"),
+		TEXT("Start the combat frame budget dashboard in this world (overlay: TD.Budget.Overlay)."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& /*Args*/, UWorld* World)
+		{
+			if (UTDFrameBudgetSubsystem* Dashboard = UTDFrameBudgetSubsystem::Get(World))
+			{
+				Dashboard->Start();
+			}
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs StopCommand(
+		TEXT("TD.Budget.Stop"),
+		TEXT("Stop the combat frame budget dashboard (counters are kept for TD.Budget.Dump)."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& /*Args*/, UWorld* World)
+		{
+			if (UTDFrameBudgetSubsystem* Dashboard = UTDFrameBudgetSubsystem::Get(World))
+			{
+				Dashboard->Stop();
+			}
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs ResetCommand(
+		TEXT("TD.Budget.Reset"),
+		TEXT("Clear the combat frame budget counters, peaks and worst frame."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& /*Args*/, UWorld* World)
+		{
+			if (UTDFrameBudgetSubsystem* Dashboard = UTDFrameBudgetSubsystem::Get(World))
+			{
+				Dashboard->Reset();
+			}
+		}));
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice DumpCommand(
+		TEXT("TD.Budget.Dump"),
+		TEXT("Print the combat frame budget table: per area budget, last / average / peak ms, frames over budget and the worst frame."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& /*Args*/, UWorld* World, FOutputDevice& Ar)
+		{
+			if (const UTDFrameBudgetSubsystem* Dashboard = UTDFrameBudgetSubsystem::Get(World))
+			{
+				Dashboard->Dump(Ar);
+			}
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs CombatPresetCommand(
+		TEXT("TD.Budget.CombatPreset"),
+		TEXT("Combat frame profiling preset: reset and start the budget dashboard and enable the GASCore, GASCoreUI, ")
+		TEXT("Highlight and ClickToMove Insights channels."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& /*Args*/, UWorld* World)
+		{
+			UTDFrameBudgetSubsystem* Dashboard = UTDFrameBudgetSubsystem::Get(World);
+			if (!Dashboard)
+			{
+				return;
+			}
+
+			Dashboard->Reset();
+			Dashboard->Start();
+#if UE_TRACE_ENABLED
+			for (const TCHAR* Channel : PresetTraceChannels)
+			{
+				UE::Trace::ToggleChannel(Channel, true);
+			}
+#endif
+			UE_LOG(LogTDBudget, Log, TEXT("TD.Budget: combat preset on (dashboard + GASCore/GASCoreUI/Highlight/ClickToMove trace channels)."));
+		}));
+#endif
+}
+
+UTDFrameBudgetSubsystem* UTDFrameBudgetSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTDFrameBudgetSubsystem>() : nullptr;
+}
+
+bool UTDFrameBudgetSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if GASCORE_FRAME_BUDGET
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+#else
+	return false;
+#endif
+}
+
+void UTDFrameBudgetSubsystem::Deinitialize()
+{
+	Stop();
+
+	Super::Deinitialize();
+}
+
+const TCHAR* UTDFrameBudgetSubsystem::GetAreaName(const ETDFrameBudgetArea Area)
+{
+	return Area < ETDFrameBudgetArea::Num ? TDFrameBudget::AreaNames[static_cast<int32>(Area)] : TEXT("(invalid)");
+}
+
+float UTDFrameBudgetSubsystem::GetBudgetMs(const ETDFrameBudgetArea Area)
+{
+	return Area < ETDFrameBudgetArea::Num ? TDFrameBudget::BudgetVariables[static_cast<int32>(Area)]->GetValueOnGameThread() : 0.f;
+}
+
+void UTDFrameBudgetSubsystem::Start()
+{
+	if (IsRunning())
+	{
+		return;
+	}
+
+	bFrameBudgetWasEnabled = TDFrameBudget::SetConsoleBool(TEXT("GASCore.FrameBudget.Enable"), true);
+#if GASCORE_FRAME_BUDGET
+	// Drop whatever another dashboard (or a previous run) left in the accumulators.
+	double Discarded[static_cast<int32>(EGASCoreFrameBudgetArea::Num)];
+	GASCoreFrameBudget::ConsumeFrame(Discarded);
+#endif
+
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UTDFrameBudgetSubsystem::Sample);
+	DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateUObject(this, &UTDFrameBudgetSubsystem::DrawOverlay));
+}
+
+void UTDFrameBudgetSubsystem::Stop()
+{
+	if (!IsRunning())
+	{
+		return;
+	}
+
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PostActorTickHandle.Reset();
+	UDebugDrawService::Unregister(DrawHandle);
+	DrawHandle.Reset();
+
+	TDFrameBudget::SetConsoleBool(TEXT("GASCore.FrameBudget.Enable"), bFrameBudgetWasEnabled);
+}
+
+void UTDFrameBudgetSubsystem::Reset()
+{
+	for (FAreaStats& Stats : Areas)
+	{
+		Stats = FAreaStats();
+	}
+	SampledFrames = 0;
+
+	FMemory::Memzero(WorstFrameMs);
+	WorstFrameRatio = 0.f;
+	WorstFrameNumber = 0;
+}
+
+float UTDFrameBudgetSubsystem::SampleHighlightMs() const
+{
+	double Microseconds = 0.0;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		const UHighlightInteraction* Highlight = PlayerController && PlayerController->IsLocalController()
+			? PlayerController->FindComponentByClass<UHighlightInteraction>() : nullptr;
+		if (Highlight && Highlight->GetLastTickFrame() == GFrameCounter)
+		{
+			Microseconds += Highlight->GetLastTickMicroseconds();
+		}
+	}
+	return static_cast<float>(Microseconds * 0.001);
+}
+
+float UTDFrameBudgetSubsystem::SampleClickToMoveMs() const
+{
+	// Both subsystems skip their tick when idle; a stale stamp means no work this frame.
+	double Microseconds = 0.0;
+	if (const UClickToMovePathRequestSubsystem* PathRequests = UClickToMovePathRequestSubsystem::Get(this))
+	{
+		Microseconds += PathRequests->GetLastTickFrame() == GFrameCounter ? PathRequests->GetLastTickMicroseconds() : 0.0;
+	}
+	if (const UClickToMovePathFollowerSubsystem* PathFollowers = UClickToMovePathFollowerSubsystem::Get(this))
+	{
+		Microseconds += PathFollowers->GetLastTickFrame() == GFrameCounter ? PathFollowers->GetLastTickMicroseconds() : 0.0;
+	}
+	return static_cast<float>(Microseconds * 0.001);
+}
+
+void UTDFrameBudgetSubsystem::Sample(UWorld* World, ELevelTick /*TickType*/, float /*DeltaSeconds*/)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	float FrameMs[NumAreas] = {};
+#if GASCORE_FRAME_BUDGET
+	double CoreMicroseconds[static_cast<int32>(EGASCoreFrameBudgetArea::Num)];
+	GASCoreFrameBudget::ConsumeFrame(CoreMicroseconds);
+	for (int32 Index = 0; Index < static_cast<int32>(EGASCoreFrameBudgetArea::Num); ++Index)
+	{
+		FrameMs[Index] = static_cast<float>(CoreMicroseconds[Index] * 0.001);
+	}
+#endif
+	FrameMs[static_cast<int32>(ETDFrameBudgetArea::Highlight)] = SampleHighlightMs();
+	FrameMs[static_cast<int32>(ETDFrameBudgetArea::ClickToMove)] = SampleClickToMoveMs();
+
+	++SampledFrames;
+	float FrameRatio = 0.f;
+	for (int32 Index = 0; Index < NumAreas; ++Index)
+	{
+		FAreaStats& Stats = Areas[Index];
+		const float Ms = FrameMs[Index];
+		Stats.LastMs = Ms;
+		Stats.AverageMs = SampledFrames == 1 ? Ms : FMath::Lerp(Stats.AverageMs, Ms, TDFrameBudget::AverageWeight);
+		Stats.PeakMs = FMath::Max(Stats.PeakMs, Ms);
+
+		const float BudgetMs = GetBudgetMs(static_cast<ETDFrameBudgetArea>(Index));
+		if (BudgetMs > 0.f)
+		{
+			Stats.OverBudgetFrames += Ms > BudgetMs ? 1 : 0;
+			FrameRatio = FMath::Max(FrameRatio, Ms / BudgetMs);
+		}
+	}
+
+	if (FrameRatio > WorstFrameRatio)
+	{
+		WorstFrameRatio = FrameRatio;
+		WorstFrameNumber = GFrameCounter;
+		FMemory::Memcpy(WorstFrameMs, FrameMs, sizeof(WorstFrameMs));
+	}
+}
+
+void UTDFrameBudgetSubsystem::Dump(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("TD.Budget: %s, %u frames sampled, worst frame %llu (%.2fx budget)."),
+		IsRunning() ? TEXT("running") : TEXT("stopped"), SampledFrames, WorstFrameNumber, WorstFrameRatio);
+	Ar.Logf(TEXT("  %-20s %8s %8s %8s %8s %8s %8s"), TEXT("Area"), TEXT("Budget"), TEXT("Last"), TEXT("Avg"), TEXT("Peak"),
+		TEXT("Over"), TEXT("Worst"));
+	for (int32 Index = 0; Index < NumAreas; ++Index)
+	{
+		const FAreaStats& Stats = Areas[Index];
+		const ETDFrameBudgetArea Area = static_cast<ETDFrameBudgetArea>(Index);
+		Ar.Logf(TEXT("  %-20s %8.2f %8.3f %8.3f %8.3f %8u %8.3f"), GetAreaName(Area), GetBudgetMs(Area),
+			Stats.LastMs, Stats.AverageMs, Stats.PeakMs, Stats.OverBudgetFrames, WorstFrameMs[Index]);
+	}
+}
+
+void UTDFrameBudgetSubsystem::DrawOverlay(UCanvas* Canvas, APlayerController* PlayerController)
+{
+	if (!Canvas || !GEngine || !PlayerController || PlayerController->GetWorld() != GetWorld()
+		|| !TDFrameBudget::CVarOverlay.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	UFont* Font = GEngine->GetSmallFont();
+	float CharWidth = 0.f;
+	float LineHeight = 0.f;
+	Canvas->StrLen(Font, TEXT("0"), CharWidth, LineHeight);
+
+	// Name column, six value columns, then a bar of Last against the budget (full width = budget; red past it).
+	const float Padding = 4.f;
+	const float NameWidth = CharWidth * 22.f;
+	const float ValueWidth = CharWidth * 9.f;
+	const float BarWidth = CharWidth * 12.f;
+	const float Width = NameWidth + ValueWidth * 6.f + BarWidth;
+	const float X = 40.f;
+	const float Y = 120.f;
+
+	Canvas->SetDrawColor(FColor(0, 0, 0, 170));
+	Canvas->DrawTile(Canvas->DefaultTexture, X - Padding, Y - Padding, Width + Padding * 2.f, LineHeight * (NumAreas + 2) + Padding * 2.f,
+		0.f, 0.f, 1.f, 1.f);
+
+	Canvas->SetDrawColor(FColor::White);
+	Canvas->DrawText(Font, FString::Printf(TEXT("Combat frame budget   frame %llu   game thread %.2f ms   sampled %u   worst frame %llu (%.2fx)"),
+		GFrameCounter, FPlatformTime::ToMilliseconds(GGameThreadTime), SampledFrames, WorstFrameNumber, WorstFrameRatio), X, Y);
+
+	static const TCHAR* Headers[] = { TEXT("Budget"), TEXT("Last"), TEXT("Avg"), TEXT("Peak"), TEXT("Over"), TEXT("Worst") };
+	float RowY = Y + LineHeight;
+	Canvas->SetDrawColor(FColor(180, 180, 180));
+	Canvas->DrawText(Font, TEXT("Area (ms)"), X, RowY);
+	for (int32 Column = 0; Column < UE_ARRAY_COUNT(Headers); ++Column)
+	{
+		Canvas->DrawText(Font, Headers[Column], X + NameWidth + ValueWidth * Column, RowY);
+	}
+
+	for (int32 Index = 0; Index < NumAreas; ++Index)
+	{
+		RowY += LineHeight;
+		const FAreaStats& Stats = Areas[Index];
+		const ETDFrameBudgetArea Area = static_cast<ETDFrameBudgetArea>(Index);
+		const float BudgetMs = GetBudgetMs(Area);
+		const bool bOverNow = BudgetMs > 0.f && Stats.LastMs > BudgetMs;
+		const bool bOverOnAverage = BudgetMs > 0.f && Stats.AverageMs > BudgetMs;
+
+		Canvas->SetDrawColor(bOverNow ? FColor::Red : bOverOnAverage ? FColor::Orange : FColor::White);
+		Canvas->DrawText(Font, GetAreaName(Area), X, RowY);
+		const FString Values[] = {
+			FString::Printf(TEXT("%.2f"), BudgetMs), FString::Printf(TEXT("%.3f"), Stats.LastMs),
+			FString::Printf(TEXT("%.3f"), Stats.AverageMs), FString::Printf(TEXT("%.3f"), Stats.PeakMs),
+			FString::Printf(TEXT("%u"), Stats.OverBudgetFrames), FString::Printf(TEXT("%.3f"), WorstFrameMs[Index]) };
+		for (int32 Column = 0; Column < UE_ARRAY_COUNT(Values); ++Column)
+		{
+			Canvas->DrawText(Font, Values[Column], X + NameWidth + ValueWidth * Column, RowY);
+		}
+
+		if (BudgetMs > 0.f)
+		{
+			const float BarX = X + NameWidth + ValueWidth * 6.f;
+			const float BarHeight = LineHeight * 0.6f;
+			const float BarY = RowY + (LineHeight - BarHeight) * 0.5f;
+			Canvas->SetDrawColor(FColor(60, 60, 60, 200));
+			Canvas->DrawTile(Canvas->DefaultTexture, BarX, BarY, BarWidth, BarHeight, 0.f, 0.f, 1.f, 1.f);
+			Canvas->SetDrawColor(bOverNow ? FColor::Red : FColor::Green);
+			Canvas->DrawTile(Canvas->DefaultTexture, BarX, BarY, BarWidth * FMath::Min(Stats.LastMs / BudgetMs, 1.f), BarHeight,
+				0.f, 0.f, 1.f, 1.f);
+		}
+	}
+}
@@ -0,0 +1,365 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/TDSoakTestSubsystem.h"
+
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Player/TDBotPlayerController.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Utilities/GASCoreNetBandwidth.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTDSoak, Log, All);
+
+CSV_DEFINE_CATEGORY(TDSoak, true);
+
+namespace TDSoakTest
+{
+	static const TCHAR* ReportHeader = TEXT("Seconds,Players,Bots,Frames,GameThreadMs,GameThreadMsP95,GameThreadMsMax,FrameMs,NetInKBps,NetOutKBps,GASKbps\n");
+
+	/** Switch a profiler console variable, returning its previous value. */
+	static bool SetConsoleBool(const TCHAR* Name, const bool bValue)
+	{
+		IConsoleVariable* Variable = IConsoleManager::Get().FindConsoleVariable(Name);
+		if (!Variable)
+		{
+			return false;
+		}
+
+		const bool bPrevious = Variable->GetBool();
+		Variable->Set(bValue, ECVF_SetByCode);
+		return bPrevious;
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs StartCommand(
+		TEXT("TD.Soak.Start"),
+		TEXT("Start a soak report on this server: TD.Soak.Start [Seconds] [MinBots]."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UTDSoakTestSubsystem* Soak = UTDSoakTestSubsystem::Get(World))
+			{
+				Soak->Start(Args.IsValidIndex(0) ? FCString::Atof(*Args[0]) : 0.f, Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 0);
+			}
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs StopCommand(
+		TEXT("TD.Soak.Stop"),
+		TEXT("End the running soak report now."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& /*Args*/, UWorld* World)
+		{
+			if (UTDSoakTestSubsystem* Soak = UTDSoakTestSubsystem::Get(World))
+			{
+				Soak->Stop();
+			}
+		}));
+}
+
+void UTDSoakTestSubsystem::FWindow::Reset(const double Time, const int64 Bits)
+{
+	GameThreadMs.Reset();
+	FrameMsSum = 0.0;
+	InBytesPerSecondSum = 0.0;
+	OutBytesPerSecondSum = 0.0;
+	StartTime = Time;
+	StartBits = Bits;
+}
+
+void UTDSoakTestSubsystem::FWindow::Add(const float FrameGameThreadMs, const float FrameMs, const uint32 InBytesPerSecond, const uint32 OutBytesPerSecond)
+{
+	GameThreadMs.Add(FrameGameThreadMs);
+	FrameMsSum += FrameMs;
+	InBytesPerSecondSum += InBytesPerSecond;
+	OutBytesPerSecondSum += OutBytesPerSecond;
+}
+
+UTDSoakTestSubsystem* UTDSoakTestSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTDSoakTestSubsystem>() : nullptr;
+}
+
+bool UTDSoakTestSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UTDSoakTestSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Command line runs start once per process, in the first world that begins play.
+	static bool bCommandLineRunStarted = false;
+	if (bCommandLineRunStarted || InWorld.GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	float Seconds = 0.f;
+	const bool bWithSeconds = FParse::Value(FCommandLine::Get(), TEXT("TDSoak="), Seconds);
+	if (bWithSeconds || FParse::Param(FCommandLine::Get(), TEXT("TDSoak")))
+	{
+		int32 Bots = 0;
+		FParse::Value(FCommandLine::Get(), TEXT("TDSoakBots="), Bots);
+
+		bCommandLineRunStarted = true;
+		Start(Seconds, Bots);
+		bExitWhenDone = !FParse::Param(FCommandLine::Get(), TEXT("TDSoakNoExit"));
+	}
+}
+
+void UTDSoakTestSubsystem::Start(const float Seconds, const int32 InMinBots)
+{
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client)
+	{
+		UE_LOG(LogTDSoak, Warning, TEXT("TDSoak: run it on the server."));
+		return;
+	}
+
+	Stop();
+
+	DurationSeconds = Seconds > 0.f ? Seconds : DefaultDurationSeconds;
+	MinBots = FMath::Max(InMinBots, 0);
+	bNetBandwidthWasEnabled = TDSoakTest::SetConsoleBool(TEXT("GASCore.NetBandwidth.Enable"), true);
+	Stage = EStage::WaitingForBots;
+	StageStartTime = World->GetRealTimeSeconds();
+
+	UE_LOG(LogTDSoak, Display, TEXT("TDSoak: waiting for %d bots (up to %.0f s), then soaking %.0f s"), MinBots, BotWaitSeconds, DurationSeconds);
+}
+
+void UTDSoakTestSubsystem::Stop()
+{
+	if (!IsRunning())
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	if (Stage == EStage::Measure && World)
+	{
+		const double Now = World->GetRealTimeSeconds();
+		const int64 Bits = SamplePlayerBits();
+		UE_LOG(LogTDSoak, Display, TEXT("TDSoak RESULT Players=%d Bots=%d %s"),
+			World->GetGameState() ? World->GetGameState()->PlayerArray.Num() : 0, CountBots(), *FormatWindow(Run, Now, Bits, /*bForLog=*/true));
+
+		WriteSummary(FString::Printf(TEXT("%s,%u,%s,%d,%s"),
+			FApp::GetBuildVersion(), FEngineVersion::Current().GetChangelist(), *World->GetMapName(), CountBots(),
+			*FormatWindow(Run, Now, Bits, /*bForLog=*/false)));
+	}
+
+#if CSV_PROFILER
+	if (bOwnsCsvCapture)
+	{
+		FCsvProfiler::Get()->EndCapture();
+	}
+#endif
+	bOwnsCsvCapture = false;
+
+	Stage = EStage::Idle;
+	TDSoakTest::SetConsoleBool(TEXT("GASCore.NetBandwidth.Enable"), bNetBandwidthWasEnabled);
+}
+
+void UTDSoakTestSubsystem::Tick(const float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTDSoakTestSubsystem::Tick);
+
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const double Now = World->GetRealTimeSeconds();
+	if (Stage == EStage::WaitingForBots)
+	{
+		const int32 Bots = CountBots();
+		const bool bTimedOut = Now - StageStartTime >= BotWaitSeconds;
+		if (Bots >= MinBots || bTimedOut)
+		{
+			UE_CLOG(bTimedOut && Bots < MinBots, LogTDSoak, Warning, TEXT("TDSoak: only %d of %d bots connected, measuring anyway."), Bots, MinBots);
+			BeginMeasure();
+		}
+		return;
+	}
+
+	// GGameThreadTime is the previous frame's game thread time; the frame time includes the server tick-rate wait.
+	const float FrameGameThreadMs = static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime));
+	const float FrameMs = static_cast<float>(FApp::GetDeltaTime() * 1000.0);
+	const UNetDriver* NetDriver = World->GetNetDriver();
+	const uint32 InBytesPerSecond = NetDriver ? NetDriver->InBytesPerSecond : 0;
+	const uint32 OutBytesPerSecond = NetDriver ? NetDriver->OutBytesPerSecond : 0;
+
+	Report.Add(FrameGameThreadMs, FrameMs, InBytesPerSecond, OutBytesPerSecond);
+	Run.Add(FrameGameThreadMs, FrameMs, InBytesPerSecond, OutBytesPerSecond);
+	CSV_CUSTOM_STAT(TDSoak, GameThreadMs, FrameGameThreadMs, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(TDSoak, NetOutKBps, OutBytesPerSecond / 1024.f, ECsvCustomStatOp::Set);
+
+	if (Now - Report.StartTime >= ReportInterval)
+	{
+		WriteReportRow();
+	}
+
+	if (Now - StageStartTime >= DurationSeconds)
+	{
+		Stop();
+		UE_LOG(LogTDSoak, Display, TEXT("TDSoak COMPLETE"));
+		if (bExitWhenDone)
+		{
+			bExitWhenDone = false;
+			FPlatformMisc::RequestExitWithStatus(false, 0);
+		}
+	}
+}
+
+void UTDSoakTestSubsystem::BeginMeasure()
+{
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetRealTimeSeconds() : 0.0;
+	const int64 Bits = SamplePlayerBits();
+	Report.Reset(Now, Bits);
+	Run.Reset(Now, Bits);
+
+	ReportPath = FPaths::ProfilingDir() / TEXT("TDSoak") / FString::Printf(TEXT("Soak-%s.csv"), *FDateTime::Now().ToString());
+	FFileHelper::SaveStringToFile(TDSoakTest::ReportHeader, *ReportPath);
+
+#if CSV_PROFILER
+	FCsvProfiler* Csv = FCsvProfiler::Get();
+	bOwnsCsvCapture = !Csv->IsCapturing();
+	if (bOwnsCsvCapture)
+	{
+		Csv->BeginCapture();
+	}
+#endif
+	CSV_METADATA(TEXT("TDSoakBots"), *FString::FromInt(CountBots()));
+
+	Stage = EStage::Measure;
+	StageStartTime = Now;
+	UE_LOG(LogTDSoak, Display, TEXT("TDSoak: measuring with %d bots, report %s"), CountBots(), *ReportPath);
+}
+
+FString UTDSoakTestSubsystem::FormatWindow(const FWindow& Window, const double Now, const int64 Bits, const bool bForLog) const
+{
+	const int32 Frames = FMath::Max(Window.GameThreadMs.Num(), 1);
+	const double Seconds = FMath::Max(Now - Window.StartTime, UE_SMALL_NUMBER);
+
+	double GameThreadSum = 0.0;
+	float GameThreadMax = 0.f;
+	for (const float Milliseconds : Window.GameThreadMs)
+	{
+		GameThreadSum += Milliseconds;
+		GameThreadMax = FMath::Max(GameThreadMax, Milliseconds);
+	}
+	TArray<float> Sorted = Window.GameThreadMs;
+	Sorted.Sort();
+	const float GameThreadP95 = Sorted.IsEmpty() ? 0.f : Sorted[FMath::Min(FMath::FloorToInt(Sorted.Num() * 0.95f), Sorted.Num() - 1)];
+
+	const float GameThreadMean = static_cast<float>(GameThreadSum / Frames);
+	const float FrameMean = static_cast<float>(Window.FrameMsSum / Frames);
+	const float InKBps = static_cast<float>(Window.InBytesPerSecondSum / Frames / 1024.0);
+	const float OutKBps = static_cast<float>(Window.OutBytesPerSecondSum / Frames / 1024.0);
+	const float GASKbps = static_cast<float>((Bits - Window.StartBits) / 1000.0 / Seconds);
+
+	if (bForLog)
+	{
+		return FString::Printf(TEXT("Seconds=%.0f Frames=%d GameThreadMs=%.3f GameThreadMsP95=%.3f GameThreadMsMax=%.3f FrameMs=%.3f NetInKBps=%.1f NetOutKBps=%.1f GASKbps=%.1f"),
+			Seconds, Window.GameThreadMs.Num(), GameThreadMean, GameThreadP95, GameThreadMax, FrameMean, InKBps, OutKBps, GASKbps);
+	}
+	return FString::Printf(TEXT("%.0f,%d,%.3f,%.3f,%.3f,%.3f,%.1f,%.1f,%.1f"),
+		Seconds, Window.GameThreadMs.Num(), GameThreadMean, GameThreadP95, GameThreadMax, FrameMean, InKBps, OutKBps, GASKbps);
+}
+
+void UTDSoakTestSubsystem::WriteReportRow()
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const double Now = World->GetRealTimeSeconds();
+	const int64 Bits = SamplePlayerBits();
+	const int32 Players = World->GetGameState() ? World->GetGameState()->PlayerArray.Num() : 0;
+
+	// Seconds column is the time into the run; the window's own length is implied by ReportInterval.
+	FString Window = FormatWindow(Report, Now, Bits, /*bForLog=*/false);
+	Window.Split(TEXT(","), nullptr, &Window);
+	const FString Row = FString::Printf(TEXT("%.0f,%d,%d,%s\n"), Now - StageStartTime, Players, CountBots(), *Window);
+	if (!FFileHelper::SaveStringToFile(Row, *ReportPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogTDSoak, Warning, TEXT("TDSoak: could not write %s"), *ReportPath);
+	}
+
+	Report.Reset(Now, Bits);
+}
+
+void UTDSoakTestSubsystem::WriteSummary(const FString& Row) const
+{
+	const FString Path = FPaths::ProfilingDir() / TEXT("TDSoak") / TEXT("Summary.csv");
+	if (!FPaths::FileExists(Path))
+	{
+		FFileHelper::SaveStringToFile(TEXT("Build,Changelist,Map,Bots,Seconds,Frames,GameThreadMs,GameThreadMsP95,GameThreadMsMax,FrameMs,NetInKBps,NetOutKBps,GASKbps\n"), *Path);
+	}
+	if (!FFileHelper::SaveStringToFile(Row + TEXT("\n"), *Path, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogTDSoak, Warning, TEXT("TDSoak: could not write %s"), *Path);
+	}
+}
+
+int32 UTDSoakTestSubsystem::CountBots() const
+{
+	int32 Bots = 0;
+	if (const UWorld* World = GetWorld())
+	{
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			if (Cast<ATDBotPlayerController>(It->Get()))
+			{
+				++Bots;
+			}
+		}
+	}
+	return Bots;
+}
+
+int64 UTDSoakTestSubsystem::SamplePlayerBits() const
+{
+	int64 Bits = 0;
+#if GASCORE_NET_BANDWIDTH
+	const UWorld* World = GetWorld();
+	const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+	if (GameState)
+	{
+		for (APlayerState* PlayerState : GameState->PlayerArray)
+		{
+			if (const UAbilitySystemComponent* AbilitySystem = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(PlayerState))
+			{
+				Bits += GASCoreNetBandwidth::GetAbilitySystemBits(*AbilitySystem);
+			}
+		}
+	}
+#endif
+	return Bits;
+}
+
+void UTDSoakTestSubsystem::Deinitialize()
+{
+	Stop();
+
+	Super::Deinitialize();
+}
+
+TStatId UTDSoakTestSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTDSoakTestSubsystem, STATGROUP_Tickables);
+}
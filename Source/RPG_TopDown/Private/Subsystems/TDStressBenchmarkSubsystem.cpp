@@ -0,0 +1,513 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#include "Subsystems/TDStressBenchmarkSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "Charcters/TDEnemyCharacter.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerStart.h"
+#include "GameplayEffect.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "Subsystems/TDEnemyPoolSubsystem.h"
+#include "Utilities/GASCoreEffectProfiler.h"
+#include "Utilities/GASCoreNetBandwidth.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTDBenchmark, Log, All);
+
+CSV_DEFINE_CATEGORY(TDBenchmark, true);
+
+namespace TDStressBenchmark
+{
+	static TArray<int32> ParseCounts(const FString& Text)
+	{
+		TArray<FString> Parts;
+		Text.ParseIntoArray(Parts, TEXT(","));
+
+		TArray<int32> Counts;
+		for (const FString& Part : Parts)
+		{
+			const int32 Count = FCString::Atoi(*Part);
+			if (Count > 0)
+			{
+				Counts.Add(Count);
+			}
+		}
+		return Counts;
+	}
+
+	/** Switch a profiler console variable, returning its previous value. */
+	static bool SetConsoleBool(const TCHAR* Name, const bool bValue)
+	{
+		IConsoleVariable* Variable = IConsoleManager::Get().FindConsoleVariable(Name);
+		if (!Variable)
+		{
+			return false;
+		}
+
+		const bool bPrevious = Variable->GetBool();
+		Variable->Set(bValue, ECVF_SetByCode);
+		return bPrevious;
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs RunCommand(
+		TEXT("TD.Benchmark.Run"),
+		TEXT("Run the GAS stress benchmark on this server world: TD.Benchmark.Run [Count,Count,...] (default from config)."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UTDStressBenchmarkSubsystem* Benchmark = UTDStressBenchmarkSubsystem::Get(World))
+			{
+				Benchmark->Run(Args.IsEmpty() ? TArray<int32>() : ParseCounts(FString::Join(Args, TEXT(","))));
+			}
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs StopCommand(
+		TEXT("TD.Benchmark.Stop"),
+		TEXT("Abort the running GAS stress benchmark."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& /*Args*/, UWorld* World)
+		{
+			if (UTDStressBenchmarkSubsystem* Benchmark = UTDStressBenchmarkSubsystem::Get(World))
+			{
+				Benchmark->Stop();
+			}
+		}));
+}
+
+UTDStressBenchmarkSubsystem* UTDStressBenchmarkSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTDStressBenchmarkSubsystem>() : nullptr;
+}
+
+bool UTDStressBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UTDStressBenchmarkSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Command line runs start once per process, in the first world that begins play.
+	static bool bCommandLineRunStarted = false;
+	if (bCommandLineRunStarted || InWorld.GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	FString CountsText;
+	const bool bWithCounts = FParse::Value(FCommandLine::Get(), TEXT("TDBenchmark="), CountsText, false);
+	if (bWithCounts || FParse::Param(FCommandLine::Get(), TEXT("TDBenchmark")))
+	{
+		bCommandLineRunStarted = true;
+		Run(bWithCounts ? TDStressBenchmark::ParseCounts(CountsText) : TArray<int32>());
+		bExitWhenDone = !FParse::Param(FCommandLine::Get(), TEXT("TDBenchmarkNoExit"));
+	}
+}
+
+void UTDStressBenchmarkSubsystem::Run(const TArray<int32>& Counts)
+{
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client)
+	{
+		UE_LOG(LogTDBenchmark, Warning, TEXT("TDBenchmark: run it on the server (or standalone)."));
+		return;
+	}
+
+	Stop();
+
+	PendingCounts = Counts.IsEmpty() ? DefaultCounts : Counts;
+	if (PendingCounts.IsEmpty())
+	{
+		return;
+	}
+
+	bEffectProfilerWasEnabled = TDStressBenchmark::SetConsoleBool(TEXT("GASCore.EffectProfiler.Enable"), true);
+	bNetBandwidthWasEnabled = TDStressBenchmark::SetConsoleBool(TEXT("GASCore.NetBandwidth.Enable"), true);
+	BeginStage();
+}
+
+void UTDStressBenchmarkSubsystem::Stop()
+{
+	if (!IsRunning() && PendingCounts.IsEmpty())
+	{
+		return;
+	}
+
+#if CSV_PROFILER
+	if (bOwnsCsvCapture)
+	{
+		FCsvProfiler::Get()->EndCapture();
+	}
+#endif
+	bOwnsCsvCapture = false;
+
+	ReleaseEnemies();
+	PendingCounts.Reset();
+	Stage = EStage::Idle;
+
+	TDStressBenchmark::SetConsoleBool(TEXT("GASCore.EffectProfiler.Enable"), bEffectProfilerWasEnabled);
+	TDStressBenchmark::SetConsoleBool(TEXT("GASCore.NetBandwidth.Enable"), bNetBandwidthWasEnabled);
+}
+
+void UTDStressBenchmarkSubsystem::BeginStage()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTDStressBenchmarkSubsystem::BeginStage);
+
+	UWorld* World = GetWorld();
+	UTDEnemyPoolSubsystem* Pool = UTDEnemyPoolSubsystem::Get(World);
+	const TSubclassOf<ATDEnemyCharacter> LoadedEnemyClass = EnemyClass.IsNull() ? ATDEnemyCharacter::StaticClass() : EnemyClass.LoadSynchronous();
+	if (!Pool || !LoadedEnemyClass)
+	{
+		UE_LOG(LogTDBenchmark, Error, TEXT("TDBenchmark: no enemy pool or enemy class, aborting."));
+		Stop();
+		return;
+	}
+
+	CrowdCenter = FVector::ZeroVector;
+	for (TActorIterator<APlayerStart> It(World); It; ++It)
+	{
+		CrowdCenter = It->GetActorLocation();
+		break;
+	}
+
+	// Square grid around the crowd centre.
+	const int32 Count = PendingCounts[0];
+	const int32 Columns = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+	const float HalfExtent = (Columns - 1) * SpawnSpacing * 0.5f;
+	CrowdRadius = HalfExtent * UE_SQRT_2;
+
+	TArray<TSubclassOf<UGameplayEffect>> LoadedInitEffects;
+	for (const TSoftClassPtr<UGameplayEffect>& Effect : InitEffects)
+	{
+		if (UClass* EffectClass = Effect.LoadSynchronous())
+		{
+			LoadedInitEffects.Add(EffectClass);
+		}
+	}
+	const TSubclassOf<UGameplayEffect> LoadedDamageEffect = DamageEffect.LoadSynchronous();
+	const TSubclassOf<UGameplayEffect> LoadedRegenEffect = RegenEffect.LoadSynchronous();
+
+	Enemies.Reset(Count);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FVector Location = CrowdCenter + FVector((Index % Columns) * SpawnSpacing - HalfExtent, (Index / Columns) * SpawnSpacing - HalfExtent, 0.f);
+		ATDEnemyCharacter* Enemy = Pool->AcquireEnemy(LoadedEnemyClass, FTransform(Location));
+		if (!Enemy)
+		{
+			continue;
+		}
+
+		// Awake like an aggroed enemy (abilities granted, delegates bound), then the steady-state load.
+		Enemy->ActivateAbilitySystem();
+		if (UAbilitySystemComponent* AbilitySystem = Enemy->GetAbilitySystemComponent())
+		{
+			for (const TSubclassOf<UGameplayEffect>& Effect : LoadedInitEffects)
+			{
+				ApplyEffect(*AbilitySystem, Effect);
+			}
+			ApplyEffect(*AbilitySystem, LoadedDamageEffect);
+			ApplyEffect(*AbilitySystem, LoadedRegenEffect);
+		}
+		Enemies.Add(Enemy);
+	}
+
+	if (UClass* ZoneClass = EffectZoneClass.LoadSynchronous())
+	{
+		for (int32 Index = 0; Index < NumEffectZones; ++Index)
+		{
+			FActorSpawnParameters SpawnParameters;
+			SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+			if (AActor* Zone = World->SpawnActor<AActor>(ZoneClass, FTransform(CrowdCenter), SpawnParameters))
+			{
+				EffectZones.Add(Zone);
+			}
+		}
+	}
+
+	NextProjectileEnemy = 0;
+	PendingProjectileActivations = 0.f;
+	GameThreadMs.Reset();
+	Stage = EStage::Warmup;
+	StageStartTime = World->GetRealTimeSeconds();
+
+	UE_LOG(LogTDBenchmark, Display, TEXT("TDBenchmark: stage %d enemies (%d spawned, %d zones), warming up %.1f s"),
+		Count, Enemies.Num(), EffectZones.Num(), WarmupSeconds);
+}
+
+void UTDStressBenchmarkSubsystem::ApplyEffect(UAbilitySystemComponent& AbilitySystem, const TSubclassOf<UGameplayEffect> EffectClass) const
+{
+	if (!EffectClass)
+	{
+		return;
+	}
+
+	FGameplayEffectContextHandle Context = AbilitySystem.MakeEffectContext();
+	Context.AddSourceObject(AbilitySystem.GetAvatarActor());
+	AbilitySystem.ApplyGameplayEffectToSelf(EffectClass->GetDefaultObject<UGameplayEffect>(), 1.f, Context);
+}
+
+void UTDStressBenchmarkSubsystem::Tick(const float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTDStressBenchmarkSubsystem::Tick);
+
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	FireProjectiles(DeltaTime);
+	SweepEffectZones();
+
+	const double Elapsed = World->GetRealTimeSeconds() - StageStartTime;
+	if (Stage == EStage::Warmup)
+	{
+		if (Elapsed < WarmupSeconds)
+		{
+			return;
+		}
+
+#if CSV_PROFILER
+		FCsvProfiler* Csv = FCsvProfiler::Get();
+		bOwnsCsvCapture = !Csv->IsCapturing();
+		if (bOwnsCsvCapture)
+		{
+			Csv->BeginCapture();
+		}
+#endif
+		CSV_METADATA(TEXT("TDBenchmarkEnemies"), *FString::FromInt(Enemies.Num()));
+
+		// Profiler totals are sampled at the start and end of the window (per-ASC, so unrelated ASCs do not count).
+		SampleTotals(StartGASMicroseconds, StartBits);
+		MemoryPerAbilitySystem = MeasureMemoryPerAbilitySystem();
+		Stage = EStage::Measure;
+		StageStartTime = World->GetRealTimeSeconds();
+		return;
+	}
+
+	// GGameThreadTime is the previous frame's game thread time.
+	const float FrameGameThreadMs = static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime));
+	GameThreadMs.Add(FrameGameThreadMs);
+	CSV_CUSTOM_STAT(TDBenchmark, GameThreadMs, FrameGameThreadMs, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(TDBenchmark, Enemies, Enemies.Num(), ECsvCustomStatOp::Set);
+
+	if (Elapsed >= MeasureSeconds)
+	{
+		EndStage();
+	}
+}
+
+void UTDStressBenchmarkSubsystem::FireProjectiles(const float DeltaTime)
+{
+	if (!ProjectileAbilityTag.IsValid() || Enemies.IsEmpty())
+	{
+		return;
+	}
+
+	PendingProjectileActivations += Enemies.Num() * ProjectileActivationsPerEnemyPerSecond * DeltaTime;
+	const int32 Activations = FMath::Min(FMath::FloorToInt(PendingProjectileActivations), Enemies.Num());
+	PendingProjectileActivations -= Activations;
+
+	const FGameplayTagContainer AbilityTags(ProjectileAbilityTag);
+	for (int32 Index = 0; Index < Activations; ++Index)
+	{
+		NextProjectileEnemy = (NextProjectileEnemy + 1) % Enemies.Num();
+		const ATDEnemyCharacter* Enemy = Enemies[NextProjectileEnemy];
+		if (UAbilitySystemComponent* AbilitySystem = IsValid(Enemy) && !Enemy->IsInPool() ? Enemy->GetAbilitySystemComponent() : nullptr)
+		{
+			AbilitySystem->TryActivateAbilitiesByTag(AbilityTags);
+		}
+	}
+}
+
+void UTDStressBenchmarkSubsystem::SweepEffectZones()
+{
+	const UWorld* World = GetWorld();
+	if (EffectZones.IsEmpty() || !World)
+	{
+		return;
+	}
+
+	// Each zone circles on its own ring, so together they cross the whole crowd.
+	const float Time = static_cast<float>(World->GetTimeSeconds());
+	for (int32 Index = 0; Index < EffectZones.Num(); ++Index)
+	{
+		AActor* Zone = EffectZones[Index];
+		if (!IsValid(Zone))
+		{
+			continue;
+		}
+
+		const float Radius = CrowdRadius * (Index + 1) / (EffectZones.Num() + 1);
+		const float Angle = FMath::DegreesToRadians(Time * EffectZoneDegreesPerSecond + Index * 360.f / EffectZones.Num());
+		Zone->SetActorLocation(CrowdCenter + FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.f));
+	}
+}
+
+void UTDStressBenchmarkSubsystem::SampleTotals(double& OutGASMicroseconds, int64& OutBits) const
+{
+	OutGASMicroseconds = 0.0;
+	OutBits = 0;
+	for (const ATDEnemyCharacter* Enemy : Enemies)
+	{
+		const UAbilitySystemComponent* AbilitySystem = IsValid(Enemy) ? Enemy->GetAbilitySystemComponent() : nullptr;
+		if (!AbilitySystem)
+		{
+			continue;
+		}
+
+#if GASCORE_EFFECT_PROFILER
+		OutGASMicroseconds += GASCoreEffectProfiler::GetAbilitySystemCost(AbilitySystem).Microseconds;
+#endif
+#if GASCORE_NET_BANDWIDTH
+		OutBits += GASCoreNetBandwidth::GetAbilitySystemBits(*AbilitySystem);
+#endif
+	}
+}
+
+float UTDStressBenchmarkSubsystem::MeasureMemoryPerAbilitySystem() const
+{
+	int64 Bytes = 0;
+	int32 NumAbilitySystems = 0;
+	for (const ATDEnemyCharacter* Enemy : Enemies)
+	{
+		UAbilitySystemComponent* AbilitySystem = IsValid(Enemy) ? Enemy->GetAbilitySystemComponent() : nullptr;
+		if (!AbilitySystem)
+		{
+			continue;
+		}
+
+		Bytes += FArchiveCountMem(AbilitySystem).GetMax();
+		for (UAttributeSet* AttributeSet : AbilitySystem->GetSpawnedAttributes())
+		{
+			if (AttributeSet)
+			{
+				Bytes += FArchiveCountMem(AttributeSet).GetMax();
+			}
+		}
+		++NumAbilitySystems;
+	}
+	return NumAbilitySystems > 0 ? static_cast<float>(Bytes) / NumAbilitySystems : 0.f;
+}
+
+void UTDStressBenchmarkSubsystem::EndStage()
+{
+	const UWorld* World = GetWorld();
+	const double Seconds = World ? FMath::Max(World->GetRealTimeSeconds() - StageStartTime, UE_SMALL_NUMBER) : 1.0;
+
+	double EndGASMicroseconds = 0.0;
+	int64 EndBits = 0;
+	SampleTotals(EndGASMicroseconds, EndBits);
+
+	const int32 Frames = FMath::Max(GameThreadMs.Num(), 1);
+	double GameThreadSum = 0.0;
+	for (const float Milliseconds : GameThreadMs)
+	{
+		GameThreadSum += Milliseconds;
+	}
+	TArray<float> Sorted = GameThreadMs;
+	Sorted.Sort();
+	const float GameThreadP95 = Sorted.IsEmpty() ? 0.f : Sorted[FMath::Min(FMath::FloorToInt(Sorted.Num() * 0.95f), Sorted.Num() - 1)];
+
+	const float GameThreadMean = static_cast<float>(GameThreadSum / Frames);
+	const float GASMsPerFrame = static_cast<float>((EndGASMicroseconds - StartGASMicroseconds) / 1000.0 / Frames);
+	const float KbitsPerSecond = static_cast<float>((EndBits - StartBits) / 1000.0 / Seconds);
+
+	UE_LOG(LogTDBenchmark, Display, TEXT("TDBenchmark RESULT Enemies=%d Frames=%d GameThreadMs=%.3f GameThreadMsP95=%.3f GASMsPerFrame=%.3f BytesPerASC=%.0f Kbps=%.1f"),
+		Enemies.Num(), GameThreadMs.Num(), GameThreadMean, GameThreadP95, GASMsPerFrame, MemoryPerAbilitySystem, KbitsPerSecond);
+
+	WriteSummary(FString::Printf(TEXT("%s,%u,%s,%d,%d,%.3f,%.3f,%.3f,%.0f,%.1f"),
+		FApp::GetBuildVersion(), FEngineVersion::Current().GetChangelist(), World ? *World->GetMapName() : TEXT(""),
+		Enemies.Num(), GameThreadMs.Num(), GameThreadMean, GameThreadP95, GASMsPerFrame, MemoryPerAbilitySystem, KbitsPerSecond));
+
+#if CSV_PROFILER
+	if (bOwnsCsvCapture)
+	{
+		FCsvProfiler::Get()->EndCapture();
+	}
+#endif
+	bOwnsCsvCapture = false;
+
+	ReleaseEnemies();
+	PendingCounts.RemoveAt(0);
+	if (!PendingCounts.IsEmpty())
+	{
+		BeginStage();
+		return;
+	}
+
+	Stop();
+	UE_LOG(LogTDBenchmark, Display, TEXT("TDBenchmark COMPLETE"));
+	if (bExitWhenDone)
+	{
+		bExitWhenDone = false;
+		FPlatformMisc::RequestExitWithStatus(false, 0);
+	}
+}
+
+void UTDStressBenchmarkSubsystem::ReleaseEnemies()
+{
+	UTDEnemyPoolSubsystem* Pool = UTDEnemyPoolSubsystem::Get(GetWorld());
+	for (ATDEnemyCharacter* Enemy : Enemies)
+	{
+		// Enemies that died during the stage may already be back in the pool.
+		if (!IsValid(Enemy) || Enemy->IsInPool())
+		{
+			continue;
+		}
+
+		if (Pool)
+		{
+			Pool->ReleaseEnemy(Enemy);
+		}
+		else
+		{
+			Enemy->Destroy();
+		}
+	}
+	Enemies.Reset();
+
+	for (AActor* Zone : EffectZones)
+	{
+		if (IsValid(Zone))
+		{
+			Zone->Destroy();
+		}
+	}
+	EffectZones.Reset();
+}
+
+void UTDStressBenchmarkSubsystem::WriteSummary(const FString& Row) const
+{
+	const FString Path = FPaths::ProfilingDir() / TEXT("TDBenchmark") / TEXT("Summary.csv");
+	if (!FPaths::FileExists(Path))
+	{
+		FFileHelper::SaveStringToFile(TEXT("Build,Changelist,Map,Enemies,Frames,GameThreadMs,GameThreadMsP95,GASMsPerFrame,BytesPerASC,Kbps\n"), *Path);
+	}
+	if (!FFileHelper::SaveStringToFile(Row + TEXT("\n"), *Path, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogTDBenchmark, Warning, TEXT("TDBenchmark: could not write %s"), *Path);
+	}
+}
+
+void UTDStressBenchmarkSubsystem::Deinitialize()
+{
+	Stop();
+
+	Super::Deinitialize();
+}
+
+TStatId UTDStressBenchmarkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTDStressBenchmarkSubsystem, STATGROUP_Tickables);
+}
@@ -2,6 +2,13 @@
 
 #include "TDAssetManager.h"
 #include "TDGameplayTags.h" // FTDGameplayTags::InitializeNativeGameplayTags
+#include "AbilitySystem/Attributes/GASCoreAttributeTagRegistry.h"
+#include "AbilitySystem/Data/GASCoreGameDataAsset.h"
+#include "AbilitySystem/Attributes/GASCoreAttributeMetadata.h"
+#include "Engine/StreamableManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Utilities/GASCoreLogging.h"
+#include "Utilities/GASCoreSyncLoadReporter.h"
 
 UTDAssetManager& UTDAssetManager::Get()
 {
@@ -15,9 +22,65 @@ UTDAssetManager& UTDAssetManager::Get()
 
 void UTDAssetManager::StartInitialLoading()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTDAssetManager::StartInitialLoading);
+
 	// Maintain base asset manager initialization.
 	Super::StartInitialLoading();
 
-	// Register all native gameplay tags used by the project before gameplay begins.
-	FTDGameplayTags::InitializeNativeGameplayTags();
+	// Native tags are static definitions; fill the FTDGameplayTags accessors before gameplay begins.
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FTDGameplayTags::InitializeNativeGameplayTags);
+		FTDGameplayTags::InitializeNativeGameplayTags();
+	}
+
+	// One-time registries build on worker tasks while engine init continues; first use waits if still running.
+	GASCoreAttributeTagRegistry::BuildAsync();
+	FGASCoreAttributeMetadata::PrewarmAsync();
+
+	// Primary asset ids are only complete after the registry scan (editor builds scan asynchronously).
+	CallOrRegister_OnCompletedInitialScan(FSimpleMulticastDelegate::FDelegate::CreateUObject(this, &UTDAssetManager::PreloadGameData));
+}
+
+void UTDAssetManager::PreloadGameData()
+{
+	TArray<FPrimaryAssetId> GameDataIds;
+	GetPrimaryAssetIdList(UGASCoreGameDataAsset::PrimaryAssetType, GameDataIds);
+	if (GameDataIds.IsEmpty())
+	{
+		GASCORE_LOG_WARNING(TEXT("No %s primary assets found; GAS data will load on demand."), *UGASCoreGameDataAsset::PrimaryAssetType.ToString());
+		return;
+	}
+
+	const TArray<FName> Bundles = { UGASCoreGameDataAsset::CombatBundle, UGASCoreGameDataAsset::UIBundle, UGASCoreGameDataAsset::InputBundle };
+	GameDataPreloadHandle = LoadPrimaryAssets(GameDataIds, Bundles,
+		FStreamableDelegate::CreateUObject(this, &UTDAssetManager::OnGameDataPreloaded), FStreamableManager::AsyncLoadHighPriority);
+
+	// Null handle: everything named was already resident.
+	if (!GameDataPreloadHandle.IsValid())
+	{
+		OnGameDataPreloaded();
+	}
+}
+
+void UTDAssetManager::OnGameDataPreloaded()
+{
+	bGameDataPreloaded = true;
+
+	TArray<UObject*> GameDataObjects;
+	GetPrimaryAssetObjectList(UGASCoreGameDataAsset::PrimaryAssetType, GameDataObjects);
+
+	TArray<FSoftObjectPath> Paths;
+	for (const UObject* Object : GameDataObjects)
+	{
+		if (const UGASCoreGameDataAsset* GameData = Cast<UGASCoreGameDataAsset>(Object))
+		{
+			GameData->GetAllAssetPaths(Paths);
+		}
+	}
+
+#if GASCORE_SYNC_LOAD_REPORTER
+	GASCoreSyncLoadReporter::AddWatchedAssets(Paths);
+#endif
+
+	GASCORE_LOG_LOG(TEXT("Preloaded %d GAS game data assets (%d referenced assets)."), GameDataObjects.Num(), Paths.Num());
 }
@@ -1,102 +1,98 @@
 // © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
 
 #include "TDGameplayTags.h"
-#include "GameplayTagsManager.h"
 
-FTDGameplayTags FTDGameplayTags::TDGameplayTags;
+#include "AbilitySystem/Attributes/GASCoreAttributeTagRegistry.h"
+#include "AbilitySystem/Attributes/TDAttributeSet.h"
 
-void FTDGameplayTags::InitializeNativeGameplayTags()
+// Static native tags: the GameplayTags module registers these when this module loads. Attribute tags are also
+// bound to their UTDAttributeSet property for GASCoreAttributeTagRegistry lookups.
+namespace TDGameplayTags
 {
 	// -----------------------------------------------------------------------------
-	// Primary Attributes
+	// Attributes (TD_ATTRIBUTE_SCHEMA rows; Evasion has no backing attribute yet)
 	// -----------------------------------------------------------------------------
-	TDGameplayTags.Attributes_Primary_Strength = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Primary.Strength")),
-		TEXT("Increases physical damage"));
-	
-	TDGameplayTags.Attributes_Primary_Dexterity = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Primary.Dexterity")),
-		TEXT("Increases attack speed, movement speed and evasion chance"));
-	
-	TDGameplayTags.Attributes_Primary_Intelligence = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Primary.Intelligence")),
-		TEXT("Increases mana and magical damage"));
-	
-	TDGameplayTags.Attributes_Primary_Endurance = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Primary.Endurance")),
-		TEXT("Increases load capacity and stamina"));
-	
-	TDGameplayTags.Attributes_Primary_Vigor = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Primary.Vigor")),
-		TEXT("Increases resilience and health"));
+	TD_ATTRIBUTE_SCHEMA(GASCORE_ATTRIBUTE_SCHEMA_DEFINE_TAG, UTDAttributeSet)
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Attributes_Secondary_Evasion, "Attributes.Secondary.Evasion", "Chance to evade incoming attacks; can scale from Dexterity");
 
 	// -----------------------------------------------------------------------------
-	// Secondary Attributes
+	// Input Tags
 	// -----------------------------------------------------------------------------
-	TDGameplayTags.Attributes_Secondary_Armor = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Secondary.Armor")),
-		TEXT("Mitigates incoming physical damage; often scales from Endurance/Resilience"));
-	
-	TDGameplayTags.Attributes_Secondary_ArmorPenetration = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Secondary.ArmorPenetration")),
-		TEXT("Reduces target's effective armor; improves damage vs armored targets"));
-	
-	TDGameplayTags.Attributes_Secondary_BlockChance = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Secondary.BlockChance")),
-		TEXT("Chance to block incoming attacks; can scale from Armor"));
-
-	TDGameplayTags.Attributes_Secondary_Evasion = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Secondary.Evasion")),
-	TEXT("Chance to evade incoming attacks; can scale from Dexterity"));
-	
-	TDGameplayTags.Attributes_Secondary_CriticalHitChance = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Secondary.CriticalHitChance")),
-		TEXT("Chance for attacks to crit; typically scales from Armor Penetration/Dexterity"));
-	
-	TDGameplayTags.Attributes_Secondary_CriticalHitDamage = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Secondary.CriticalHitDamage")),
-		TEXT("Crit damage multiplier or bonus; often scales from Armor Penetration"));
-	
-	TDGameplayTags.Attributes_Secondary_CriticalHitResistance = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Secondary.CriticalHitResistance")),
-		TEXT("Reduces chance or impact of incoming crits; scales from Armor"));
-	
-	TDGameplayTags.Attributes_Secondary_MaxHealth = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Secondary.MaxHealth")),
-		TEXT("Maximum health pool; typically derived from Vigor"));
-	
-	TDGameplayTags.Attributes_Secondary_HealthRegeneration = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Secondary.HealthRegeneration")),
-		TEXT("Health per second; typically scales from Vigor"));
-	
-	TDGameplayTags.Attributes_Secondary_MaxMana = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Secondary.MaxMana")),
-		TEXT("Maximum mana pool; typically derived from Intelligence"));
-	
-	TDGameplayTags.Attributes_Secondary_ManaRegeneration = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Secondary.ManaRegeneration")),
-		TEXT("Mana per second; typically scales from Intelligence"));
-	
-	TDGameplayTags.Attributes_Secondary_StaminaRegeneration = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Secondary.StaminaRegeneration")),
-		TEXT("Stamina per second; typically scales from Endurance"));
-	
-	TDGameplayTags.Attributes_Secondary_MaxStamina = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Secondary.MaxStamina")),
-		TEXT("Maximum stamina pool; typically derived from Endurance"));
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(InputTag_LMB, "InputTag.LMB", "Input Tag for Left Mouse Button");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(InputTag_RMB, "InputTag.RMB", "Input Tag for Right Mouse Button");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(InputTag_QuickSlot_1, "InputTag.QuickSlot1", "Input Tag for 1 key");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(InputTag_QuickSlot_2, "InputTag.QuickSlot2", "Input Tag for 2 key");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(InputTag_QuickSlot_3, "InputTag.QuickSlot3", "Input Tag for 3 key");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(InputTag_QuickSlot_4, "InputTag.QuickSlot4", "Input Tag for 4 key");
 
 	// -----------------------------------------------------------------------------
-	// Vital Attributes
+	// UI Messages
 	// -----------------------------------------------------------------------------
-	TDGameplayTags.Attributes_Vital_Health = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Vital.Health")),
-		TEXT(""));
-	
-	TDGameplayTags.Attributes_Vital_Mana = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Vital.Mana")),
-		TEXT(""));
-	
-	TDGameplayTags.Attributes_Vital_Stamina = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("Attributes.Vital.Stamina")),
-		TEXT(""));
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(UI_Message, "UI.Message", "Parent of effect asset tags that pop a HUD message row");
 
 	// -----------------------------------------------------------------------------
-	// Input Tags
+	// Gameplay Cues
 	// -----------------------------------------------------------------------------
-	TDGameplayTags.InputTag_LMB = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("InputTag.LMB")),
-		TEXT("Input Tag for Left Mouse Button"));
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(GameplayCue_CombatText_Damage, "GameplayCue.CombatText.Damage", "Batched damage number burst (magnitude = damage dealt) for floating combat text");
+}
+
+FTDGameplayTags FTDGameplayTags::TDGameplayTags;
+
+void FTDGameplayTags::InitializeNativeGameplayTags()
+{
+	// The tags themselves are already registered (static definitions above); this only fills the struct accessors
+	// that existing call sites use.
+	TDGameplayTags.Attributes_Primary_Strength = TDGameplayTags::Attributes_Primary_Strength;
+	TDGameplayTags.Attributes_Primary_Dexterity = TDGameplayTags::Attributes_Primary_Dexterity;
+	TDGameplayTags.Attributes_Primary_Intelligence = TDGameplayTags::Attributes_Primary_Intelligence;
+	TDGameplayTags.Attributes_Primary_Endurance = TDGameplayTags::Attributes_Primary_Endurance;
+	TDGameplayTags.Attributes_Primary_Vigor = TDGameplayTags::Attributes_Primary_Vigor;
+	TDGameplayTags.Attributes_Secondary_Armor = TDGameplayTags::Attributes_Secondary_Armor;
+	TDGameplayTags.Attributes_Secondary_ArmorPenetration = TDGameplayTags::Attributes_Secondary_ArmorPenetration;
+	TDGameplayTags.Attributes_Secondary_BlockChance = TDGameplayTags::Attributes_Secondary_BlockChance;
+	TDGameplayTags.Attributes_Secondary_Evasion = TDGameplayTags::Attributes_Secondary_Evasion;
+	TDGameplayTags.Attributes_Secondary_CriticalHitChance = TDGameplayTags::Attributes_Secondary_CriticalHitChance;
+	TDGameplayTags.Attributes_Secondary_CriticalHitDamage = TDGameplayTags::Attributes_Secondary_CriticalHitDamage;
+	TDGameplayTags.Attributes_Secondary_CriticalHitResistance = TDGameplayTags::Attributes_Secondary_CriticalHitResistance;
+	TDGameplayTags.Attributes_Secondary_MaxHealth = TDGameplayTags::Attributes_Secondary_MaxHealth;
+	TDGameplayTags.Attributes_Secondary_HealthRegeneration = TDGameplayTags::Attributes_Secondary_HealthRegeneration;
+	TDGameplayTags.Attributes_Secondary_MaxMana = TDGameplayTags::Attributes_Secondary_MaxMana;
+	TDGameplayTags.Attributes_Secondary_ManaRegeneration = TDGameplayTags::Attributes_Secondary_ManaRegeneration;
+	TDGameplayTags.Attributes_Secondary_StaminaRegeneration = TDGameplayTags::Attributes_Secondary_StaminaRegeneration;
+	TDGameplayTags.Attributes_Secondary_MaxStamina = TDGameplayTags::Attributes_Secondary_MaxStamina;
+	TDGameplayTags.Attributes_Vital_Health = TDGameplayTags::Attributes_Vital_Health;
+	TDGameplayTags.Attributes_Vital_Mana = TDGameplayTags::Attributes_Vital_Mana;
+	TDGameplayTags.Attributes_Vital_Stamina = TDGameplayTags::Attributes_Vital_Stamina;
+	TDGameplayTags.InputTag_LMB = TDGameplayTags::InputTag_LMB;
+	TDGameplayTags.InputTag_RMB = TDGameplayTags::InputTag_RMB;
+	TDGameplayTags.InputTag_QuickSlot_1 = TDGameplayTags::InputTag_QuickSlot_1;
+	TDGameplayTags.InputTag_QuickSlot_2 = TDGameplayTags::InputTag_QuickSlot_2;
+	TDGameplayTags.InputTag_QuickSlot_3 = TDGameplayTags::InputTag_QuickSlot_3;
+	TDGameplayTags.InputTag_QuickSlot_4 = TDGameplayTags::InputTag_QuickSlot_4;
+	TDGameplayTags.UI_Message = TDGameplayTags::UI_Message;
+	TDGameplayTags.GameplayCue_CombatText_Damage = TDGameplayTags::GameplayCue_CombatText_Damage;
+
+	TDGameplayTags.RegisterTagBits();
+}
 
-	TDGameplayTags.InputTag_RMB = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("InputTag.RMB")),
-	TEXT("Input Tag for Right Mouse Button"));
+void FTDGameplayTags::RegisterTagBits()
+{
+	using namespace GASCoreNativeTagBits;
 
-	TDGameplayTags.InputTag_QuickSlot_1 = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("InputTag.QuickSlot1")),
-	TEXT("Input Tag for 1 key"));
+	// Inputs first: the hottest checks (per input event / held frame).
+	InputTagBit_LMB = Register(InputTag_LMB);
+	InputTagsMask = InputTagBit_LMB | Register(InputTag_RMB) | Register(InputTag_QuickSlot_1) | Register(InputTag_QuickSlot_2)
+		| Register(InputTag_QuickSlot_3) | Register(InputTag_QuickSlot_4);
 
-	TDGameplayTags.InputTag_QuickSlot_2 = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("InputTag.QuickSlot2")),
-	TEXT("Input Tag for 2 key"));
+	// UI roots.
+	UIMessageBit = Register(UI_Message);
 
-	TDGameplayTags.InputTag_QuickSlot_3 = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("InputTag.QuickSlot3")),
-	TEXT("Input Tag for 3 key"));
+	// Attribute tags (schema rows plus Evasion).
+#define TD_REGISTER_ATTRIBUTE_TAG_BIT(Class, Name, DataType, Tier, MaxAttribute, RegenAttribute, Decimals, TagName, Tag, Comment) \
+	AttributeTagsMask |= Register(TDGameplayTags::TagName);
+	TD_ATTRIBUTE_SCHEMA(TD_REGISTER_ATTRIBUTE_TAG_BIT, UTDAttributeSet)
+#undef TD_REGISTER_ATTRIBUTE_TAG_BIT
+	AttributeTagsMask |= Register(Attributes_Secondary_Evasion);
 
-	TDGameplayTags.InputTag_QuickSlot_4 = UGameplayTagsManager::Get().AddNativeGameplayTag(FName(TEXT("InputTag.QuickSlot4")),
-	TEXT("Input Tag for 4 key"));
-}
\ No newline at end of file
+	Register(GameplayCue_CombatText_Damage);
+}
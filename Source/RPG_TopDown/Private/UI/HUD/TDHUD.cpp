@@ -6,12 +6,26 @@
 
 // Engine
 #include "Blueprint/UserWidget.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "TimerManager.h"
 
 // Project
+#include "TDGameplayTags.h"
+#include "Subsystems/GASCoreUICombatTextSubsystem.h"
 #include "UI/WidgetControllers/TDAttributeMenuWidgetController.h"
 #include "UI/WidgetControllers/TDHUDWidgetController.h"
 #include "UI/Widgets/TDUserWidget.h"
 
+ATDHUD::ATDHUD()
+{
+	// Soft paths only (nothing loads here); BP_HUD may override either.
+	AttributeMenuWidgetControllerClass = TSoftClassPtr<UTDAttributeMenuWidgetController>(FSoftObjectPath(
+		TEXT("/Game/Blueprints/UI/WidgetController/BP_AttributeMenuWidgetController.BP_AttributeMenuWidgetController_C")));
+	AttributeMenuWidgetClass = TSoftClassPtr<UTDUserWidget>(FSoftObjectPath(
+		TEXT("/Game/Blueprints/UI/AttributeMenu/WBP_AttributeMenu.WBP_AttributeMenu_C")));
+}
+
 UTDHUDWidgetController* ATDHUD::GetHUDWidgetController(const FGASCoreUIWidgetControllerParams& InWidgetControllerParams)
 {
 	// Lazily create controller and bind delegates once.
@@ -31,14 +45,16 @@ UTDHUDWidgetController* ATDHUD::GetHUDWidgetController(const FGASCoreUIWidgetCon
 UTDAttributeMenuWidgetController* ATDHUD::GetAttributeMenuWidgetController(
 	const FGASCoreUIWidgetControllerParams& InWidgetControllerParams)
 {
-	// Lazily create Attribute Menu controller and bind delegates once.
+	// Lazily create the Attribute Menu controller. It binds its delegates itself while the menu is open
+	// (BroadcastInitialValues on open, UnbindCallbacksFromDependencies on close).
 	if (AttributeMenuWidgetController == nullptr)
 	{
-		AttributeMenuWidgetController = NewObject<UTDAttributeMenuWidgetController>(this, AttributeMenuWidgetControllerClass);
+		// Normally streamed already (RequestSubWidgetClassesLoad); a menu opened before that loads the class now.
+		UClass* ControllerClass = AttributeMenuWidgetControllerClass.IsNull()
+			? UTDAttributeMenuWidgetController::StaticClass() : AttributeMenuWidgetControllerClass.LoadSynchronous();
+		AttributeMenuWidgetController = NewObject<UTDAttributeMenuWidgetController>(this, ControllerClass);
 
 		AttributeMenuWidgetController->SetWidgetControllerParams(InWidgetControllerParams);
-
-		AttributeMenuWidgetController->BindCallbacksToDependencies();
 	}
 	return AttributeMenuWidgetController;
 }
@@ -75,4 +91,95 @@ void ATDHUD::InitializeHUD(APlayerController* InPlayerController, APlayerState*
 
 	// Finally, add the widget to the viewport so it becomes visible.
 	UserWidget->AddToViewport();
-}
\ No newline at end of file
+
+	// The attribute menu is built on first open; stream its classes once the first frame is out.
+	CachedWidgetControllerParams = WidgetControllerParams;
+	GetWorldTimerManager().SetTimerForNextTick(this, &ATDHUD::RequestSubWidgetClassesLoad);
+
+	// Damage numbers are drawn by the batched combat text renderer, not per-hit widgets.
+	if (UGASCoreUICombatTextSubsystem* CombatText = UGASCoreUICombatTextSubsystem::Get(this))
+	{
+		CombatText->RegisterCombatTextCue(FTDGameplayTags::Get().GameplayCue_CombatText_Damage, DamageNumberColor);
+	}
+}
+
+UTDUserWidget* ATDHUD::OpenAttributeMenu()
+{
+	if (!AttributeMenuWidget)
+	{
+		UClass* WidgetClass = AttributeMenuWidgetClass.LoadSynchronous();
+		if (!WidgetClass)
+		{
+			return nullptr;
+		}
+		AttributeMenuWidget = CreateWidget<UTDUserWidget>(GetOwningPlayerController(), WidgetClass);
+		if (!AttributeMenuWidget)
+		{
+			return nullptr;
+		}
+		AttributeMenuWidget->SetWidgetController(GetAttributeMenuWidgetController(CachedWidgetControllerParams));
+	}
+
+	if (!AttributeMenuWidget->IsInViewport())
+	{
+		AttributeMenuWidget->AddToViewport();
+
+		// Binds the controller's attribute delegates while open and resyncs every row once.
+		AttributeMenuWidgetController->BroadcastInitialValues();
+	}
+	return AttributeMenuWidget;
+}
+
+void ATDHUD::CloseAttributeMenu()
+{
+	if (AttributeMenuWidget && AttributeMenuWidget->IsInViewport())
+	{
+		AttributeMenuWidget->RemoveFromParent();
+		AttributeMenuWidgetController->UnbindCallbacksFromDependencies();
+	}
+}
+
+bool ATDHUD::IsAttributeMenuOpen() const
+{
+	return AttributeMenuWidget && AttributeMenuWidget->IsInViewport();
+}
+
+void ATDHUD::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (SubWidgetClassesHandle.IsValid())
+	{
+		SubWidgetClassesHandle->CancelHandle();
+		SubWidgetClassesHandle.Reset();
+	}
+
+	// Controller teardown: the ASC may outlive the HUD (seamless travel, HUD class swaps).
+	if (AttributeMenuWidgetController)
+	{
+		AttributeMenuWidgetController->UnbindCallbacksFromDependencies();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ATDHUD::RequestSubWidgetClassesLoad()
+{
+	if (SubWidgetClassesHandle.IsValid())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> PathsToLoad;
+	for (const FSoftObjectPath& Path : { AttributeMenuWidgetControllerClass.ToSoftObjectPath(), AttributeMenuWidgetClass.ToSoftObjectPath() })
+	{
+		if (!Path.IsNull() && !Path.ResolveObject())
+		{
+			PathsToLoad.Add(Path);
+		}
+	}
+
+	// Default priority: gameplay streaming stays ahead of a menu the player may never open.
+	if (!PathsToLoad.IsEmpty())
+	{
+		SubWidgetClassesHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(PathsToLoad), FStreamableDelegate());
+	}
+}
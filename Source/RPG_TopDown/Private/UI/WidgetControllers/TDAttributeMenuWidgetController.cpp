@@ -7,17 +7,26 @@
 
 #include "AbilitySystem/Attributes/TDAttributeSet.h"   // For AttributeSet type used by GetNumericValue
 #include "AbilitySystem/Data/TDAttributeInfo.h"        // For AttributeInfo data asset definitions
+#include "Utilities/GASCoreUITrace.h"
 
 void UTDAttributeMenuWidgetController::BroadcastInitialValues()
 {
+	GASCOREUI_BROADCAST_SCOPE(UTDAttributeMenuWidgetController::BroadcastInitialValues);
 	// The controller must have a valid Data Asset to provide UI metadata and attribute identities.
 	check(AttributeInfoDataAsset);
 
-	// Iterate all authored UI rows (Tag + Name/Description + AttributeGetter).
-	for (const FGASCoreAttributeInformation& AttributeInfoRow : AttributeInfoDataAsset->GetAttributeInformation())
+	// The menu is opening: live updates from now on (no-op when already bound), then one full resync below.
+	BindCallbacksToDependencies();
+
+	// Iterate all UI rows (Tag + Name/Description + AttributeGetter). Cooked rows were validated at cook time.
+	const TArray<FGASCoreAttributeInformation>& Rows = AttributeInfoDataAsset->GetAttributeInformation();
+	const bool bRowsValidated = AttributeInfoDataAsset->AreRowsValidated();
+	for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
 	{
+		const FGASCoreAttributeInformation& AttributeInfoRow = Rows[RowIndex];
+
 		// Defensive: Author each row with its FGameplayAttribute identity.
-		if (!AttributeInfoRow.AttributeGetter.IsValid())
+		if (!bRowsValidated && !AttributeInfoRow.AttributeGetter.IsValid())
 		{
 			UE_LOG(LogTemp, Warning, TEXT("AttributeGetter not set for row '%s' in '%s'"),
 				*AttributeInfoRow.AttributeName.ToString(), *GetNameSafe(AttributeInfoDataAsset));
@@ -25,7 +34,7 @@ void UTDAttributeMenuWidgetController::BroadcastInitialValues()
 		}
 
 		// Compute and broadcast this row's current value to any UI listeners.
-		BroadcastAttributeInfo(AttributeInfoRow.AttributeTag);
+		BroadcastAttributeInfo(RowIndex);
 	}
 }
 
@@ -34,11 +43,22 @@ void UTDAttributeMenuWidgetController::BindCallbacksToDependencies()
 	// Data Asset must be set; ASC/AttributeSet validity is ensured by the base controller's lifecycle.
 	check(AttributeInfoDataAsset);
 
-	// Bind a value-change callback per authored row (one per FGameplayAttribute identity).
-	for (const FGASCoreAttributeInformation& AttributeInfoRow : AttributeInfoDataAsset->GetAttributeInformation())
+	// Bound while the menu is open only; a second open must not stack bindings.
+	if (bCallbacksBound || !AbilitySystemComponent)
 	{
+		return;
+	}
+	bCallbacksBound = true;
+
+	// Bind a value-change callback per row (one per FGameplayAttribute identity).
+	const TArray<FGASCoreAttributeInformation>& Rows = AttributeInfoDataAsset->GetAttributeInformation();
+	const bool bRowsValidated = AttributeInfoDataAsset->AreRowsValidated();
+	for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+	{
+		const FGASCoreAttributeInformation& AttributeInfoRow = Rows[RowIndex];
+
 		// Note: If a row has no AttributeGetter, there's nothing to bind for live updates.
-		if (!AttributeInfoRow.AttributeGetter.IsValid())
+		if (!bRowsValidated && !AttributeInfoRow.AttributeGetter.IsValid())
 		{
 			UE_LOG(LogTemp, Warning, TEXT("Skipping delegate bind; AttributeGetter not set for row '%s' in '%s'"),
 				*AttributeInfoRow.AttributeName.ToString(), *GetNameSafe(AttributeInfoDataAsset));
@@ -46,25 +66,47 @@ void UTDAttributeMenuWidgetController::BindCallbacksToDependencies()
 		}
 
 		// Subscribe to ASC's per-attribute change delegate.
-		// Capture the row by value on purpose (loop locals go out of scope after binding).
-		AbilitySystemComponent
+		// Capture only the tag and row index: the change data already carries the new value, and the row's text never changes.
+		const FDelegateHandle Handle = AbilitySystemComponent
 			->GetGameplayAttributeValueChangeDelegate(AttributeInfoRow.AttributeGetter)
-			.AddLambda([this, AttributeInfoRow](const FOnAttributeChangeData& /*AttributeChangedData*/)
+			.AddWeakLambda(this, [this, RowIndex, AttributeTag = AttributeInfoRow.AttributeTag](const FOnAttributeChangeData& AttributeChangedData)
 			{
-				// On change, recompute and broadcast only this row.
-				BroadcastAttributeInfo(AttributeInfoRow.AttributeTag);
+				AttributeValueChangedDelegate.Broadcast(AttributeTag, AttributeChangedData.NewValue);
+
+				// Rows still listening on AttributeInfoDelegate for live values keep getting the full row until they
+				// move to AttributeValueChangedDelegate; the copy is skipped once nothing is bound.
+				if (AttributeInfoDelegate.IsBound())
+				{
+					BroadcastAttributeInfo(RowIndex);
+				}
 			});
+		AttributeChangeHandles.Emplace(AttributeInfoRow.AttributeGetter, Handle);
+	}
+}
+
+void UTDAttributeMenuWidgetController::UnbindCallbacksFromDependencies()
+{
+	// The ASC may already be gone (pawn/player state teardown); its delegates went with it.
+	if (AbilitySystemComponent)
+	{
+		for (const TPair<FGameplayAttribute, FDelegateHandle>& AttributeChangeHandle : AttributeChangeHandles)
+		{
+			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(AttributeChangeHandle.Key).Remove(AttributeChangeHandle.Value);
+		}
 	}
+	AttributeChangeHandles.Reset();
+	bCallbacksBound = false;
 }
 
-void UTDAttributeMenuWidgetController::BroadcastAttributeInfo(const FGameplayTag& AttributeTag) const
+void UTDAttributeMenuWidgetController::BroadcastAttributeInfo(const int32 RowIndex) const
 {
-	// Lookup authored metadata (Name/Description/Getter) by tag.
-	FGASCoreAttributeInformation Info = AttributeInfoDataAsset->FindAttributeInfoByTag(AttributeTag);
+	GASCOREUI_BROADCAST_SCOPE(UTDAttributeMenuWidgetController::BroadcastAttributeInfo);
+	// One copy per row to fill in the value (the asset row itself stays untouched).
+	FGASCoreAttributeInformation Info = AttributeInfoDataAsset->GetAttributeInformation()[RowIndex];
 
-	// Compute the current numeric value from our AttributeSet using the row's FGameplayAttribute identity.
-	// Note: GetNumericValue accepts the base UAttributeSet*; a concrete cast is not strictly required here.
-	Info.AttributeValue = Info.AttributeGetter.GetNumericValue(AttributeSet);
+	// Current numeric value from our AttributeSet: a baked offset read in cooked builds, else the row's
+	// FGameplayAttribute identity (GetNumericValue accepts the base UAttributeSet*).
+	Info.AttributeValue = AttributeInfoDataAsset->GetRowNumericValue(RowIndex, AttributeSet);
 
 	// Notify any bound UI widgets. Widgets can filter by matching Info.AttributeTag in BP.
 	AttributeInfoDelegate.Broadcast(Info);
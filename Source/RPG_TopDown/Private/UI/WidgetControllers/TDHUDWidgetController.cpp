@@ -7,9 +7,15 @@
 
 #include "AbilitySystem/Attributes/TDAttributeSet.h"
 #include "AbilitySystem/Components/TDAbilitySystemComponent.h"
+#include "TDGameplayTags.h"
+#include "Subsystems/GASCoreUIWidgetPoolSubsystem.h"
+#include "UI/ViewModels/GASCoreUIAttributeViewModel.h"
+#include "UI/WidgetControllers/GASCoreUIVitalsSmoother.h"
+#include "Utilities/GASCoreUITrace.h"
 
 void UTDHUDWidgetController::BroadcastInitialValues()
 {
+	GASCOREUI_BROADCAST_SCOPE(UTDHUDWidgetController::BroadcastInitialValues);
 	Super::BroadcastInitialValues();
 }
 
@@ -18,57 +24,72 @@ void UTDHUDWidgetController::BindCallbacksToDependencies()
 	// Validate and cast the bound AttributeSet to your game's concrete type.
 	const UTDAttributeSet* CoreAttributeSet = CastChecked<UTDAttributeSet>(AttributeSet);
 
-	// Subscribe to GAS attribute change notifications.
-	// Each delegate receives FOnAttributeChangeData with the new value; we forward the float to UI.
+	// Subscribe to GAS attribute change notifications through the base-class coalescing path:
+	// regen + damage can change a vital several times per frame, but each delegate fires at most once per flush
+	// with the latest value. Reset first so a repeated bind does not double up.
+	UnbindCoalescedAttributes();
 
-	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(CoreAttributeSet->GetHealthAttribute()).AddLambda(
-		[this](const FOnAttributeChangeData& Data)
-		{
-			OnHealthChanged.Broadcast(Data.NewValue);
-		}
-	);
-	
-	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(CoreAttributeSet->GetMaxHealthAttribute()).AddLambda(
-		[this](const FOnAttributeChangeData& Data)
-		{
-			OnMaxHealthChanged.Broadcast(Data.NewValue);		
-		}
-	);
-	
-	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(CoreAttributeSet->GetManaAttribute()).AddLambda(
-		[this](const FOnAttributeChangeData& Data)
-		{
-			OnManaChanged.Broadcast(Data.NewValue);
-		}
-	);
+	BindCoalescedAttribute(CoreAttributeSet->GetMaxHealthAttribute(), [this](float NewValue) { OnMaxHealthChanged.Broadcast(NewValue); });
+	BindCoalescedAttribute(CoreAttributeSet->GetMaxManaAttribute(), [this](float NewValue) { OnMaxManaChanged.Broadcast(NewValue); });
+	BindCoalescedAttribute(CoreAttributeSet->GetMaxStaminaAttribute(), [this](float NewValue) { OnMaxStaminaChanged.Broadcast(NewValue); });
 
-	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(CoreAttributeSet->GetMaxManaAttribute()).AddLambda(
-		[this](const FOnAttributeChangeData& Data)
+	// Current vitals: either straight through, or as smoother targets. The smoother publishes the displayed value at
+	// the UI refresh rate and only when it visibly moved, so bars glide and invalidate far less often.
+	if (bSmoothVitals)
+	{
+		if (!VitalsSmoother)
 		{
-			OnMaxManaChanged.Broadcast(Data.NewValue);
+			VitalsSmoother = NewObject<UGASCoreUIVitalsSmoother>(this);
 		}
-	);
+		VitalsSmoother->Reset();
 
-	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(CoreAttributeSet->GetStaminaAttribute()).AddLambda(
-		[this](const FOnAttributeChangeData& Data)
+		const int32 HealthChannel = VitalsSmoother->AddChannel([this](float Value) { OnHealthChanged.Broadcast(Value); });
+		const int32 ManaChannel = VitalsSmoother->AddChannel([this](float Value) { OnManaChanged.Broadcast(Value); });
+		const int32 StaminaChannel = VitalsSmoother->AddChannel([this](float Value) { OnStaminaChanged.Broadcast(Value); });
+
+		// Natively regenerating vitals are written (and replicated) in steps; the extrapolated value keeps the bars
+		// filling in between. Non-regenerating attributes simply return their current value.
+		const TWeakObjectPtr<const UTDAttributeSet> WeakAttributeSet(CoreAttributeSet);
+		auto MakeExtrapolatedSource = [WeakAttributeSet](const FGameplayAttribute& Attribute)
 		{
-			OnStaminaChanged.Broadcast(Data.NewValue);
-		}
-	);
+			return [WeakAttributeSet, Attribute]()
+			{
+				const UTDAttributeSet* Set = WeakAttributeSet.Get();
+				return Set ? Set->GetExtrapolatedValue(Attribute) : 0.f;
+			};
+		};
+		VitalsSmoother->SetTargetSource(HealthChannel, MakeExtrapolatedSource(CoreAttributeSet->GetHealthAttribute()));
+		VitalsSmoother->SetTargetSource(ManaChannel, MakeExtrapolatedSource(CoreAttributeSet->GetManaAttribute()));
+		VitalsSmoother->SetTargetSource(StaminaChannel, MakeExtrapolatedSource(CoreAttributeSet->GetStaminaAttribute()));
 
-	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(CoreAttributeSet->GetMaxStaminaAttribute()).AddLambda(
-		[this](const FOnAttributeChangeData& Data)
+		BindCoalescedAttribute(CoreAttributeSet->GetHealthAttribute(), [this, HealthChannel](float NewValue) { VitalsSmoother->SetTarget(HealthChannel, NewValue); });
+		BindCoalescedAttribute(CoreAttributeSet->GetManaAttribute(), [this, ManaChannel](float NewValue) { VitalsSmoother->SetTarget(ManaChannel, NewValue); });
+		BindCoalescedAttribute(CoreAttributeSet->GetStaminaAttribute(), [this, StaminaChannel](float NewValue) { VitalsSmoother->SetTarget(StaminaChannel, NewValue); });
+	}
+	else
+	{
+		BindCoalescedAttribute(CoreAttributeSet->GetHealthAttribute(), [this](float NewValue) { OnHealthChanged.Broadcast(NewValue); });
+		BindCoalescedAttribute(CoreAttributeSet->GetManaAttribute(), [this](float NewValue) { OnManaChanged.Broadcast(NewValue); });
+		BindCoalescedAttribute(CoreAttributeSet->GetStaminaAttribute(), [this](float NewValue) { OnStaminaChanged.Broadcast(NewValue); });
+	}
+
+	// MVVM path: the view model subscribes on its own and broadcasts per field, so widgets bound to it need none of
+	// the delegates above.
+	if (VitalsViewModelClass && VitalsAttributeInfo)
+	{
+		if (!VitalsViewModel)
 		{
-			OnMaxStaminaChanged.Broadcast(Data.NewValue);
+			VitalsViewModel = NewObject<UGASCoreUIAttributeViewModel>(this, VitalsViewModelClass);
 		}
-	);
+		VitalsViewModel->BindToAbilitySystem(AbilitySystemComponent, VitalsAttributeInfo);
+	}
 
 	// MESSAGEWIDGETROWDELEGATE USAGE:
 	// Forward GameplayEffect asset tags (e.g., "UI.Message.HealthPotion") to the UI for display.
 	//
 	// HOW IT WORKS:
 	// 1. UGASCoreAbilitySystemComponent broadcasts effect asset tags when GEs are applied
-	// 2. We filter for "UI.Message.*" tags and look up corresponding DataTable rows
+	// 2. MessageRowsByTag (built once below) holds only "UI.Message.*" rows, so one hash lookup both filters and finds
 	// 3. Broadcast the full row data to widgets via MessageWidgetRowDelegate
 	//
 	// DATATABLE SETUP REQUIREMENTS:
@@ -79,27 +100,71 @@ void UTDHUDWidgetController::BindCallbacksToDependencies()
 	//
 	// WIDGET BINDING:
 	// Widgets should bind to MessageWidgetRowDelegate to receive and display these message notifications.
-	Cast<UTDAbilitySystemComponent>(AbilitySystemComponent)->OnEffectAssetTags.AddLambda(
+	// Rows with a MessageWidget class also fire MessageWidgetDelegate with a popup from UGASCoreUIWidgetPoolSubsystem;
+	// widgets add that one (and ReleaseToPool it when it fades out) rather than CreateWidget, so potion spam reuses
+	// popups instead of allocating one per message.
+	BuildMessageRowMap();
+
+#if WITH_EDITOR
+	// Editor reimport/edits reallocate rows; rebuild so cached pointers never dangle.
+	if (MessageWidgetDataTable)
+	{
+		MessageWidgetDataTable->OnDataTableChanged().RemoveAll(this);
+		MessageWidgetDataTable->OnDataTableChanged().AddUObject(this, &UTDHUDWidgetController::BuildMessageRowMap);
+	}
+#endif
+
+	Cast<UTDAbilitySystemComponent>(AbilitySystemComponent)->OnEffectAssetTags.AddWeakLambda(this,
 		[this](const FGameplayTagContainer& AssetTags)
 		{
 			for (const FGameplayTag& Tag : AssetTags)
 			{
-				// Filter for UI message tags to avoid processing unrelated effect tags
-				const FGameplayTag MessageTag = FGameplayTag::RequestGameplayTag(FName("UI.Message"));
-
-				if (Tag.MatchesTag(MessageTag))
+				// Non-message tags and tags without a row simply miss
+				if (const FGASCoreUIMessageWidgetRow* const* MessageRow = MessageRowsByTag.Find(Tag))
 				{
-					// DataTable lookup: row key should match the tag's FName
-					const FGASCoreUIMessageWidgetRow* MessageRow = GetDataTableRowByTag<FGASCoreUIMessageWidgetRow>(MessageWidgetDataTable, Tag);
-					if (MessageRow && MessageRow->MessageTag.IsValid())
-					{
-						// Broadcast the complete row to widgets for display
-						MessageWidgetRowDelegate.Broadcast(*MessageRow);
-					}
-					// else: No matching row found; tag may be misconfigured or DataTable incomplete
+					// Broadcast the complete row to widgets for display
+					MessageWidgetRowDelegate.Broadcast(**MessageRow);
+					BroadcastPooledMessageWidget(**MessageRow);
 				}
-				// else: Not a UI.Message tag; ignore (could handle other tag families here)
 			}
 		}
 	);
 }
+
+void UTDHUDWidgetController::BroadcastPooledMessageWidget(const FGASCoreUIMessageWidgetRow& MessageRow)
+{
+	if (!MessageRow.MessageWidget || !MessageWidgetDelegate.IsBound())
+	{
+		return;
+	}
+
+	UGASCoreUIWidgetPoolSubsystem* WidgetPool = UGASCoreUIWidgetPoolSubsystem::Get(PlayerController);
+	if (UGASCoreUIUserWidget* MessageWidget = WidgetPool ? WidgetPool->AcquireWidget(PlayerController, MessageRow.MessageWidget) : nullptr)
+	{
+		MessageWidgetDelegate.Broadcast(MessageRow, MessageWidget);
+	}
+}
+
+void UTDHUDWidgetController::BuildMessageRowMap()
+{
+	MessageRowsByTag.Reset();
+
+	if (!MessageWidgetDataTable || !MessageWidgetDataTable->GetRowStruct()
+		|| !MessageWidgetDataTable->GetRowStruct()->IsChildOf(FGASCoreUIMessageWidgetRow::StaticStruct()))
+	{
+		return;
+	}
+
+	const FTDGameplayTags& Tags = FTDGameplayTags::Get();
+
+	for (const TPair<FName, uint8*>& RowPair : MessageWidgetDataTable->GetRowMap())
+	{
+		// Row key is the tag's FName; unknown names or tags outside UI.Message are skipped (matches the old filter)
+		const FGameplayTag RowTag = FGameplayTag::RequestGameplayTag(RowPair.Key, /*ErrorIfNotFound*/ false);
+		const FGASCoreUIMessageWidgetRow* MessageRow = reinterpret_cast<const FGASCoreUIMessageWidgetRow*>(RowPair.Value);
+		if (Tags.IsUIMessageTag(RowTag) && MessageRow && MessageRow->MessageTag.IsValid())
+		{
+			MessageRowsByTag.Add(RowTag, MessageRow);
+		}
+	}
+}
@@ -3,7 +3,20 @@
 
 #include "UI/Widgets/TDUserWidget.h"
 
+#include "UI/WidgetControllers/TDAttributeMenuWidgetController.h"
+
 void UTDUserWidget::SetWidgetController(UObject* InWidgetController)
 {
 	Super::SetWidgetController(InWidgetController);
 }
+
+void UTDUserWidget::NativeDestruct()
+{
+	// Re-shown menus rebind in BroadcastInitialValues (ATDHUD::OpenAttributeMenu).
+	if (UTDAttributeMenuWidgetController* AttributeMenuController = Cast<UTDAttributeMenuWidgetController>(GetAssociatedWidgetController()))
+	{
+		AttributeMenuController->UnbindCallbacksFromDependencies();
+	}
+
+	Super::NativeDestruct();
+}
@@ -0,0 +1,40 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "AbilitySystem/Attributes/GASCoreAttributeSchema.h"
+
+/**
+ * UTDAttributeSet attribute schema (format: GASCoreAttributeSchema.h).
+ *
+ * Adding an attribute: add a row here, then the literal UPROPERTY(ReplicatedUsing=OnRep_Name) and
+ * UFUNCTION() OnRep_Name declarations in TDAttributeSet.h at the same position. Accessors, RepNotify bodies,
+ * replication registration, tier conditions, metadata and the native tag all come from the row.
+ *
+ * Row order is the memory layout: vitals first (read by every damage/regen/UI update, 6 × 16 bytes in two cache
+ * lines), then primary, then secondary attributes.
+ */
+#define TD_ATTRIBUTE_SCHEMA(X, Class) \
+	/* Vital */ \
+	X(Class, Health,                FGASCoreFixedPointAttributeData, ETDAttributeTier::Vital,     MaxHealth,  HealthRegeneration,  0,  Attributes_Vital_Health,                  "Attributes.Vital.Health",                  "") \
+	X(Class, MaxHealth,             FGASCoreFixedPointAttributeData, ETDAttributeTier::Vital,     ,           ,                    0,  Attributes_Secondary_MaxHealth,           "Attributes.Secondary.MaxHealth",           "Maximum health pool; typically derived from Vigor") \
+	X(Class, Mana,                  FGASCoreFixedPointAttributeData, ETDAttributeTier::Vital,     MaxMana,    ManaRegeneration,    0,  Attributes_Vital_Mana,                    "Attributes.Vital.Mana",                    "") \
+	X(Class, MaxMana,               FGASCoreFixedPointAttributeData, ETDAttributeTier::Vital,     ,           ,                    0,  Attributes_Secondary_MaxMana,             "Attributes.Secondary.MaxMana",             "Maximum mana pool; typically derived from Intelligence") \
+	X(Class, Stamina,               FGASCoreFixedPointAttributeData, ETDAttributeTier::Vital,     MaxStamina, StaminaRegeneration, 0,  Attributes_Vital_Stamina,                 "Attributes.Vital.Stamina",                 "") \
+	X(Class, MaxStamina,            FGASCoreFixedPointAttributeData, ETDAttributeTier::Vital,     ,           ,                    0,  Attributes_Secondary_MaxStamina,          "Attributes.Secondary.MaxStamina",          "Maximum stamina pool; typically derived from Endurance") \
+	/* Primary */ \
+	X(Class, Strength,              FGameplayAttributeData,          ETDAttributeTier::Primary,   ,           ,                    -1, Attributes_Primary_Strength,              "Attributes.Primary.Strength",              "Increases physical damage") \
+	X(Class, Dexterity,             FGameplayAttributeData,          ETDAttributeTier::Primary,   ,           ,                    -1, Attributes_Primary_Dexterity,             "Attributes.Primary.Dexterity",             "Increases attack speed, movement speed and evasion chance") \
+	X(Class, Intelligence,          FGameplayAttributeData,          ETDAttributeTier::Primary,   ,           ,                    -1, Attributes_Primary_Intelligence,          "Attributes.Primary.Intelligence",          "Increases mana and magical damage") \
+	X(Class, Endurance,             FGameplayAttributeData,          ETDAttributeTier::Primary,   ,           ,                    -1, Attributes_Primary_Endurance,             "Attributes.Primary.Endurance",             "Increases load capacity and stamina") \
+	X(Class, Vigor,                 FGameplayAttributeData,          ETDAttributeTier::Primary,   ,           ,                    -1, Attributes_Primary_Vigor,                 "Attributes.Primary.Vigor",                 "Increases resilience and health") \
+	/* Secondary */ \
+	X(Class, Armor,                 FGameplayAttributeData,          ETDAttributeTier::Secondary, ,           ,                    -1, Attributes_Secondary_Armor,               "Attributes.Secondary.Armor",               "Mitigates incoming physical damage; often scales from Endurance/Resilience") \
+	X(Class, ArmorPenetration,      FGameplayAttributeData,          ETDAttributeTier::Secondary, ,           ,                    -1, Attributes_Secondary_ArmorPenetration,    "Attributes.Secondary.ArmorPenetration",    "Reduces target's effective armor; improves damage vs armored targets") \
+	X(Class, BlockChance,           FGameplayAttributeData,          ETDAttributeTier::Secondary, ,           ,                    -1, Attributes_Secondary_BlockChance,         "Attributes.Secondary.BlockChance",         "Chance to block incoming attacks; can scale from Armor") \
+	X(Class, CriticalHitChance,     FGameplayAttributeData,          ETDAttributeTier::Secondary, ,           ,                    -1, Attributes_Secondary_CriticalHitChance,   "Attributes.Secondary.CriticalHitChance",   "Chance for attacks to crit; typically scales from Armor Penetration/Dexterity") \
+	X(Class, CriticalHitDamage,     FGameplayAttributeData,          ETDAttributeTier::Secondary, ,           ,                    -1, Attributes_Secondary_CriticalHitDamage,   "Attributes.Secondary.CriticalHitDamage",   "Crit damage multiplier or bonus; often scales from Armor Penetration") \
+	X(Class, CriticalHitResistance, FGameplayAttributeData,          ETDAttributeTier::Secondary, ,           ,                    -1, Attributes_Secondary_CriticalHitResistance, "Attributes.Secondary.CriticalHitResistance", "Reduces chance or impact of incoming crits; scales from Armor") \
+	X(Class, HealthRegeneration,    FGameplayAttributeData,          ETDAttributeTier::Secondary, ,           ,                    -1, Attributes_Secondary_HealthRegeneration,  "Attributes.Secondary.HealthRegeneration",  "Health per second; typically scales from Vigor") \
+	X(Class, ManaRegeneration,      FGameplayAttributeData,          ETDAttributeTier::Secondary, ,           ,                    -1, Attributes_Secondary_ManaRegeneration,    "Attributes.Secondary.ManaRegeneration",    "Mana per second; typically scales from Intelligence") \
+	X(Class, StaminaRegeneration,   FGameplayAttributeData,          ETDAttributeTier::Secondary, ,           ,                    -1, Attributes_Secondary_StaminaRegeneration, "Attributes.Secondary.StaminaRegeneration", "Stamina per second; typically scales from Endurance")
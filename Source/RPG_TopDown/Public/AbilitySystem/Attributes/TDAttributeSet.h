@@ -3,20 +3,47 @@
 #include "CoreMinimal.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystem/Attributes/GASCoreAttributeSet.h"
+#include "AbilitySystem/Attributes/TDAttributeSchema.h"
+#include "UObject/CoreNetTypes.h"
 #include "TDAttributeSet.generated.h"
 
+class FCustomPropertyConditionState;
+
+/**
+ * Replication tiers of UTDAttributeSet.
+ * - Primary:   Strength, Dexterity, Intelligence, Endurance, Vigor.
+ * - Secondary: Armor, penetration, block/crit stats and regeneration rates.
+ * - Vital:     Health/Mana/Stamina and their Max (health bars need these on every client).
+ */
+UENUM(BlueprintType)
+enum class ETDAttributeTier : uint8
+{
+	Primary,
+	Secondary,
+	Vital,
+
+	MAX UMETA(Hidden)
+};
+
 /**
  * UTDAttributeSet
  *
  * Game-specific AttributeSet that:
- * - Declares primary, secondary, and vital attributes.
+ * - Declares vital, primary, and secondary attributes, driven by TD_ATTRIBUTE_SCHEMA (TDAttributeSchema.h).
  * - Uses RepNotify to propagate server-authoritative changes to clients.
- * - In the constructor (see .cpp), registers Current↔Max pairs and fills the
- *   Tag→Accessor registry which powers generic UI broadcasting.
+ * - Registers Current↔Max pairs once per class in ConfigureAttributeMetadata (see .cpp).
+ * - Vitals use integer storage and FGASCoreFixedPointAttributeData (fixed-point memory, varint on the wire).
+ * - IncomingDamage is a server-only meta attribute drained into Health (Builder.RegisterIncomingDamage).
  *
  * Replication note:
  * - We use REPNOTIFY_Always so even "equivalent" updates still trigger RepNotifies
  *   (important for client prediction reconciliation and UI consistency).
+ * - Every attribute replicates with a per-instance (COND_Dynamic) condition taken from its tier.
+ *   Owners pick what each tier costs: players send Primary/Secondary to the owner only, enemies keep them
+ *   server-side (GE/MMC math runs on the server) and only replicate Vitals.
+ * - With deferred initial replication (enemies), an attribute stays COND_Never until it first changes outside
+ *   archetype initialization, then switches to its tier condition (clients initialize it themselves until then).
+ * - All attributes are push-based; UGASCoreAttributeSet marks them dirty on every Base/Current change.
  */
 UCLASS()
 class RPG_TOPDOWN_API UTDAttributeSet : public UGASCoreAttributeSet
@@ -32,6 +59,74 @@ public:
 	 */
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	/** Seeds each attribute's dynamic replication condition from its tier. */
+	virtual void GetReplicatedCustomConditionState(FCustomPropertyConditionState& OutActiveState) const override;
+
+	/**
+	 * Replication condition for every attribute of Tier (COND_None by default, e.g. COND_OwnerOnly / COND_Never).
+	 * Call from the owner's constructor: the condition is read when the set starts replicating.
+	 */
+	void SetTierReplicationCondition(ETDAttributeTier Tier, ELifetimeCondition Condition);
+
+	/** Current replication condition of Tier. */
+	ELifetimeCondition GetTierReplicationCondition(ETDAttributeTier Tier) const { return TierConditions[static_cast<uint8>(Tier)]; }
+
+	/** Tier condition of Attribute (COND_Never while its initial replication is still deferred). */
+	virtual ELifetimeCondition GetAttributeReplicationCondition(const FGameplayAttribute& Attribute) const override;
+
+	/** Schema rows of this set (name, Max partner, regeneration rate, decimals), in declaration order. */
+	static TConstArrayView<FGASCoreAttributeSchemaRow> GetAttributeSchema();
+
+protected:
+	/** Health/Mana/Stamina ↔ Max pairs and vital integer storage (built once per class, shared by every instance). */
+	virtual void ConfigureAttributeMetadata(FGASCoreAttributeMetadataBuilder& Builder) const override;
+
+	/** Deferred initial replication: Attribute starts replicating with its tier condition. */
+	virtual void OnAttributeLeftInitialization(const FGameplayAttribute& Attribute) const override;
+
+	/** Server: queue a damage number (GameplayCue.CombatText.Damage) above the damaged avatar. */
+	virtual void OnIncomingDamageApplied(const FGameplayAttribute& TargetAttr, float Damage, float OldValue, float NewValue,
+		const FGameplayEffectModCallbackData& Data) override;
+
+private:
+	/** Per-tier replication condition (indexed by ETDAttributeTier). */
+	ELifetimeCondition TierConditions[static_cast<uint8>(ETDAttributeTier::MAX)] = { COND_None, COND_None, COND_None };
+
+public:
+
+	// Attributes are declared in TD_ATTRIBUTE_SCHEMA order (TDAttributeSchema.h), which is also their memory layout.
+	// Accessors, RepNotify bodies, replication, metadata and tags come from the schema; only UHT-visible
+	// declarations are spelled out here.
+
+	// =========================
+	// Vital Attributes
+	// =========================
+
+	/** Current health value - how much health the character currently has */
+	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Health, Category="GASCore|Attributes|Vitals")
+	FGASCoreFixedPointAttributeData Health;
+
+	/** Maximum health value - upper bound for Health */
+	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_MaxHealth, Category="GASCore|Attributes|Vitals")
+	FGASCoreFixedPointAttributeData MaxHealth;
+
+	/** Current mana value - resource for casting abilities */
+	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Mana, Category="GASCore|Attributes|Vitals")
+	FGASCoreFixedPointAttributeData Mana;
+
+	/** Maximum mana value - upper bound for Mana */
+	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_MaxMana, Category="GASCore|Attributes|Vitals")
+	FGASCoreFixedPointAttributeData MaxMana;
+
+	/** Current stamina value - resource for physical actions like sprinting */
+	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Stamina, Category="GASCore|Attributes|Vitals")
+	FGASCoreFixedPointAttributeData Stamina;
+
+	/** Maximum stamina value - upper bound for Stamina */
+	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_MaxStamina, Category="GASCore|Attributes|Vitals")
+	FGASCoreFixedPointAttributeData MaxStamina;
+
+
 	// =========================
 	// Primary Attributes
 	// =========================
@@ -39,72 +134,23 @@ public:
 	/** Current Strength value - how much Strength the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Strength, Category="GASCore|Attributes|Primary")
 	FGameplayAttributeData Strength;
-	/** Generates attribute accessors (getter/setter/initter) for Strength */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, Strength);
 
 	/** Current Dexterity value - how much Dexterity the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Dexterity, Category="GASCore|Attributes|Primary")
 	FGameplayAttributeData Dexterity;
-	/** Generates attribute accessors (getter/setter/initter) for Dexterity */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, Dexterity);
 
 	/** Current Intelligence value - how much Intelligence the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Intelligence, Category="GASCore|Attributes|Primary")
 	FGameplayAttributeData Intelligence;
-	/** Generates attribute accessors (getter/setter/initter) for Intelligence */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, Intelligence);
 
 	/** Current Endurance value - how much Endurance the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Endurance, Category="GASCore|Attributes|Primary")
 	FGameplayAttributeData Endurance;
-	/** Generates attribute accessors (getter/setter/initter) for Endurance */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, Endurance);
 
 	/** Current Vigor value - how much Vigor the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Vigor, Category="GASCore|Attributes|Primary")
 	FGameplayAttributeData Vigor;
-	/** Generates attribute accessors (getter/setter/initter) for Vigor */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, Vigor);
-
-	
-	// =======================================
-	// Primary Attributes Rep Notify Functions
-	// =======================================
 
-	/**
-	 * RepNotify for Strength attribute. Triggers attribute change delegates and
-	 * ensures clients update UI/prediction based on server authoritative values.
-	 */
-	UFUNCTION()
-	void OnRep_Strength(const FGameplayAttributeData& OldStrength) const;
-
-	/**
-	 * RepNotify for Dexterity attribute. Triggers attribute change delegates and
-	 * ensures clients update UI/prediction based on server authoritative values.
-	 */
-	UFUNCTION()
-	void OnRep_Dexterity(const FGameplayAttributeData& OldDexterity) const;
-
-	/**
-	 * RepNotify for Intelligence attribute. Triggers attribute change delegates and
-	 * ensures clients update UI/prediction based on server authoritative values.
-	 */
-	UFUNCTION()
-	void OnRep_Intelligence(const FGameplayAttributeData& OldIntelligence) const;
-	
-	/**
-	 * RepNotify for Endurance attribute. Triggers attribute change delegates and
-	 * ensures clients update UI/prediction based on server authoritative values.
-	 */
-	UFUNCTION()
-	void OnRep_Endurance(const FGameplayAttributeData& OldEndurance) const;
-
-	/**
-	 * RepNotify for Vigor attribute. Triggers attribute change delegates and
-	 * ensures clients update UI/prediction based on server authoritative values.
-	 */
-	UFUNCTION()
-	void OnRep_Vigor(const FGameplayAttributeData& OldVigor) const;
 
 	// =========================
 	// Secondary Attributes
@@ -113,165 +159,117 @@ public:
 	/** Current Armor value - how much Armor the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Armor, Category="GASCore|Attributes|Secondary")
 	FGameplayAttributeData Armor;
-	/** Generates attribute accessors (getter/setter/initter) for Armor */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, Armor);
 
 	/** Current ArmorPenetration value - how much ArmorPenetration the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_ArmorPenetration, Category="GASCore|Attributes|Secondary")
 	FGameplayAttributeData ArmorPenetration;
-	/** Generates attribute accessors (getter/setter/initter) for ArmorPenetration */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, ArmorPenetration);
 
 	/** Current BlockChance value - how much BlockChance the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_BlockChance, Category="GASCore|Attributes|Secondary")
 	FGameplayAttributeData BlockChance;
-	/** Generates attribute accessors (getter/setter/initter) for BlockChance */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, BlockChance);
 
 	/** Current CriticalHitChance value - how much CriticalHitChance the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_CriticalHitChance, Category="GASCore|Attributes|Secondary")
 	FGameplayAttributeData CriticalHitChance;
-	/** Generates attribute accessors (getter/setter/initter) for CriticalHitChance */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, CriticalHitChance);
 
 	/** Current CriticalHitDamage value - how much CriticalHitDamage the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_CriticalHitDamage, Category="GASCore|Attributes|Secondary")
 	FGameplayAttributeData CriticalHitDamage;
-	/** Generates attribute accessors (getter/setter/initter) for CriticalHitDamage */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, CriticalHitDamage);
 
 	/** Current CriticalHitResistance value - how much CriticalHitResistance the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_CriticalHitResistance, Category="GASCore|Attributes|Secondary")
 	FGameplayAttributeData CriticalHitResistance;
-	/** Generates attribute accessors (getter/setter/initter) for CriticalHitResistance */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, CriticalHitResistance);
-	
-	/** Maximum health value - upper bound for Health */
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_MaxHealth, Category="GASCore|Attributes|Vitals")
-	FGameplayAttributeData MaxHealth;
-	/** Generates attribute accessors for MaxHealth */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, MaxHealth);
 
 	/** Current HealthRegeneration value - how much HealthRegeneration the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_HealthRegeneration, Category="GASCore|Attributes|Secondary")
 	FGameplayAttributeData HealthRegeneration;
-	/** Generates attribute accessors (getter/setter/initter) for HealthRegeneration */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, HealthRegeneration);
-
-	/** Maximum mana value - upper bound for Mana */
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_MaxMana, Category="GASCore|Attributes|Vitals")
-	FGameplayAttributeData MaxMana;
-	/** Generates attribute accessors for MaxMana */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, MaxMana);
 
 	/** Current ManaRegeneration value - how much ManaRegeneration the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_ManaRegeneration, Category="GASCore|Attributes|Secondary")
 	FGameplayAttributeData ManaRegeneration;
-	/** Generates attribute accessors (getter/setter/initter) for ManaRegeneration */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, ManaRegeneration);
-
-	/** Maximum stamina value - upper bound for Stamina */
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_MaxStamina, Category="GASCore|Attributes|Vitals")
-	FGameplayAttributeData MaxStamina;
-	/** Generates attribute accessors for MaxStamina */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, MaxStamina);
 
 	/** Current StaminaRegeneration value - how much StaminaRegeneration the character currently has */
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_StaminaRegeneration, Category="GASCore|Attributes|Secondary")
 	FGameplayAttributeData StaminaRegeneration;
-	/** Generates attribute accessors (getter/setter/initter) for StaminaRegeneration */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, StaminaRegeneration);
 
 	// =======================================
-	// Secondary Attributes Rep Notify Functions
+	// Meta Attributes (server-only, not replicated)
+	// =======================================
+
+	/** Final damage of a hit (UGASCoreExecCalcDamage output); consumed into Health by the base set and reset to 0 */
+	UPROPERTY(BlueprintReadOnly, Category="GASCore|Attributes|Meta")
+	FGameplayAttributeData IncomingDamage;
+	/** Generates attribute accessors (getter/setter/initter) for IncomingDamage */
+	ATTRIBUTE_ACCESSORS(UTDAttributeSet, IncomingDamage);
+
+	/** Generates attribute accessors (getter/setter/initter) for every schema attribute */
+	TD_ATTRIBUTE_SCHEMA(GASCORE_ATTRIBUTE_SCHEMA_ACCESSORS, UTDAttributeSet);
+
+	// =======================================
+	// Rep Notify Functions (bodies: GASCORE_ATTRIBUTE_SCHEMA_REPNOTIFY)
 	// =======================================
 
-	/** RepNotify for Armor attribute */
+	/**
+	 * RepNotifies trigger attribute change delegates and ensure clients update UI/prediction based on
+	 * server authoritative values. Regenerating vitals also reset their regeneration baseline.
+	 */
 	UFUNCTION()
-	void OnRep_Armor(const FGameplayAttributeData& OldArmor) const;
+	void OnRep_Health(const FGASCoreFixedPointAttributeData& OldHealth) const;
 
-	/** RepNotify for ArmorPenetration attribute */
 	UFUNCTION()
-	void OnRep_ArmorPenetration(const FGameplayAttributeData& OldArmorPenetration) const;
+	void OnRep_MaxHealth(const FGASCoreFixedPointAttributeData& OldMaxHealth) const;
 
-	/** RepNotify for BlockChance attribute */
 	UFUNCTION()
-	void OnRep_BlockChance(const FGameplayAttributeData& OldBlockChance) const;
+	void OnRep_Mana(const FGASCoreFixedPointAttributeData& OldMana) const;
 
-	/** RepNotify for CriticalHitChance attribute */
 	UFUNCTION()
-	void OnRep_CriticalHitChance(const FGameplayAttributeData& OldCriticalHitChance) const;
+	void OnRep_MaxMana(const FGASCoreFixedPointAttributeData& OldMaxMana) const;
 
-	/** RepNotify for CriticalHitDamage attribute */
 	UFUNCTION()
-	void OnRep_CriticalHitDamage(const FGameplayAttributeData& OldCriticalHitDamage) const;
-	
-	/** RepNotify for CriticalHitResistance attribute */
+	void OnRep_Stamina(const FGASCoreFixedPointAttributeData& OldStamina) const;
+
 	UFUNCTION()
-	void OnRep_CriticalHitResistance(const FGameplayAttributeData& OldCriticalHitResistance) const;
+	void OnRep_MaxStamina(const FGASCoreFixedPointAttributeData& OldMaxStamina) const;
 
-	/** RepNotify for HealthRegeneration attribute */
 	UFUNCTION()
-	void OnRep_HealthRegeneration(const FGameplayAttributeData& OldHealthRegeneration) const;
-	
-	/** RepNotify for MaxHealth attribute */
+	void OnRep_Strength(const FGameplayAttributeData& OldStrength) const;
+
 	UFUNCTION()
-	void OnRep_MaxHealth(const FGameplayAttributeData& OldMaxHealth) const;
+	void OnRep_Dexterity(const FGameplayAttributeData& OldDexterity) const;
 
-	/** RepNotify for ManaRegeneration attribute */
 	UFUNCTION()
-	void OnRep_ManaRegeneration(const FGameplayAttributeData& OldManaRegeneration) const;
+	void OnRep_Intelligence(const FGameplayAttributeData& OldIntelligence) const;
 
-	/** RepNotify for MaxMana attribute */
 	UFUNCTION()
-	void OnRep_MaxMana(const FGameplayAttributeData& OldMaxMana) const;
+	void OnRep_Endurance(const FGameplayAttributeData& OldEndurance) const;
 
-	/** RepNotify for StaminaRegeneration attribute */
 	UFUNCTION()
-	void OnRep_StaminaRegeneration(const FGameplayAttributeData& OldStaminaRegeneration) const;
+	void OnRep_Vigor(const FGameplayAttributeData& OldVigor) const;
 
-	/** RepNotify for MaxStamina attribute */
 	UFUNCTION()
-	void OnRep_MaxStamina(const FGameplayAttributeData& OldMaxStamina) const;
-	
-	// =========================
-	// Vital Attributes
-	// =========================
+	void OnRep_Armor(const FGameplayAttributeData& OldArmor) const;
 
-	/** Current health value - how much health the character currently has */
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Health, Category="GASCore|Attributes|Vitals")
-	FGameplayAttributeData Health;
-	/** Generates attribute accessors (getter/setter/initter) for Health */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, Health);
+	UFUNCTION()
+	void OnRep_ArmorPenetration(const FGameplayAttributeData& OldArmorPenetration) const;
 
-	/** Current mana value - resource for casting abilities */
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Mana, Category="GASCore|Attributes|Vitals")
-	FGameplayAttributeData Mana;
-	/** Generates attribute accessors for Mana */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, Mana);
+	UFUNCTION()
+	void OnRep_BlockChance(const FGameplayAttributeData& OldBlockChance) const;
 
-	/** Current stamina value - resource for physical actions like sprinting */
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Stamina, Category="GASCore|Attributes|Vitals")
-	FGameplayAttributeData Stamina;
-	/** Generates attribute accessors for Stamina */
-	ATTRIBUTE_ACCESSORS(UTDAttributeSet, Stamina);
+	UFUNCTION()
+	void OnRep_CriticalHitChance(const FGameplayAttributeData& OldCriticalHitChance) const;
+
+	UFUNCTION()
+	void OnRep_CriticalHitDamage(const FGameplayAttributeData& OldCriticalHitDamage) const;
 
-	// =======================================
-	// Vital Attributes Rep Notify Functions
-	// =======================================
-	
-	/**
-	 * RepNotify for Health attribute. Triggers attribute change delegates and
-	 * ensures clients update UI/prediction based on server authoritative values.
-	 */
 	UFUNCTION()
-	void OnRep_Health(const FGameplayAttributeData& OldHealth) const;
-	
-	/** RepNotify for Mana attribute */
+	void OnRep_CriticalHitResistance(const FGameplayAttributeData& OldCriticalHitResistance) const;
+
+	UFUNCTION()
+	void OnRep_HealthRegeneration(const FGameplayAttributeData& OldHealthRegeneration) const;
+
 	UFUNCTION()
-	void OnRep_Mana(const FGameplayAttributeData& OldMana) const;
-	
-	/** RepNotify for Stamina attribute */
+	void OnRep_ManaRegeneration(const FGameplayAttributeData& OldManaRegeneration) const;
+
 	UFUNCTION()
-	void OnRep_Stamina(const FGameplayAttributeData& OldStamina) const;
-};
\ No newline at end of file
+	void OnRep_StaminaRegeneration(const FGameplayAttributeData& OldStaminaRegeneration) const;
+};
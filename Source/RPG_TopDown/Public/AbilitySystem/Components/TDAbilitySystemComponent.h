@@ -18,9 +18,17 @@ public:
 
 	virtual void BindASCDelegates() override;
 
-protected:
+	/**
+	 * Server: stop (or resume) replicating GE-driven state: the minimal replication tags and, in Full/Mixed mode,
+	 * the active effect list. Clients keep the last values they received; resuming sends the current state.
+	 * Bandwidth safety valve for distant enemies (see ATDEnemyCharacter::SetReplicationReduced).
+	 */
+	void SetEffectStateReplicationSuppressed(bool bSuppressed);
 
-	virtual void ClientHandleGameplayEffectAppliedToSelf(UAbilitySystemComponent* AbilitySystemComponent,
-		const FGameplayEffectSpec& GameplayEffectSpec, FActiveGameplayEffectHandle ActiveGameplayEffectHandle) override;
-	
+	bool IsEffectStateReplicationSuppressed() const { return bEffectStateReplicationSuppressed; }
+
+	virtual void GetReplicatedCustomConditionState(FCustomPropertyConditionState& OutActiveState) const override;
+
+private:
+	bool bEffectStateReplicationSuppressed = false;
 };
@@ -4,8 +4,16 @@
 
 #include "CoreMinimal.h"
 #include "Actors/GASCoreSpawnedActorByGameplayAbility.h"
+#include "ScalableFloat.h"
 #include "TDProjectileActor.generated.h"
 
+/**
+ * ATDProjectileActor
+ *
+ * Game projectile. AoE impacts (ImpactRadius > 0) also damage Mass crowd enemies in the radius through
+ * UTDCrowdSubsystem (standalone games only), with CrowdDamage at the payload's level and the instigator's offensive
+ * attributes.
+ */
 UCLASS()
 class RPG_TOPDOWN_API ATDProjectileActor : public AGASCoreSpawnedActorByGameplayAbility
 {
@@ -21,4 +29,11 @@ protected:
 
 	virtual void OnSphereCollisionOverlap(UPrimitiveComponent* OverlappedComponent,
 		AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult) override;
+
+	virtual void ApplyImpactRadiusToNonActorTargets(const UWorld* World, const FVector& ImpactPoint,
+		const FGameplayEffectSpecHandle& Spec) const override;
+
+	/** Base damage dealt to crowd enemies within ImpactRadius, by payload level (0 leaves the crowd untouched). */
+	UPROPERTY(EditDefaultsOnly, Category = "Crowd", meta = (EditCondition = "ImpactRadius > 0"))
+	FScalableFloat CrowdDamage;
 };
@@ -19,6 +19,23 @@ class UTDAbilityInitComponent;
 class UTDDefaultAttributeInitComponent;
 class UAttributeSet;
 class UAbilitySystemComponent;
+class UMeshComponent;
+class UStaticMesh;
+class UStaticMeshComponent;
+
+/** How the character's weapon is rendered. */
+UENUM(BlueprintType)
+enum class ETDWeaponMeshMode : uint8
+{
+	/** WeaponMesh evaluates its own pose (weapons with their own animated skeleton). */
+	Independent,
+
+	/** WeaponMesh is skinned to the character skeleton and copies the body pose (no pose evaluation of its own). */
+	LeaderPose,
+
+	/** Rigid weapon: StaticWeaponMesh is rendered on the hand socket and WeaponMesh is unregistered. */
+	Static
+};
 
 /**
  * ATDCharacterBase
@@ -27,6 +44,12 @@ class UAbilitySystemComponent;
  * - Use as base for both player and AI characters that require Ability System integration.
  * - Owns references to Ability System Component (ASC) and Attribute Set.
  * - Provides initialization path and accessors for UI/controllers.
+ *
+ * Animation cost:
+ * - The body mesh is a USkeletalMeshComponentBudgeted: with bUseAnimationBudget it registers with the engine's
+ *   animation budget allocator (a.Budget.*), which lowers update rates of the least significant meshes to stay
+ *   within the per-frame ms budget. Subclasses feed significance through SetAnimationSignificance.
+ * - WeaponMeshMode removes the weapon's own pose evaluation (LeaderPose) or the skeletal weapon entirely (Static).
  */
 UCLASS(Abstract)
 class RPG_TOPDOWN_API ATDCharacterBase : public ACharacter, public IAbilitySystemInterface, public IGASCoreCombatInterface
@@ -36,8 +59,8 @@ class RPG_TOPDOWN_API ATDCharacterBase : public ACharacter, public IAbilitySyste
 public:
 	// ===== Construction & Lifecycle =====
 
-	/** Sets default values for this character's properties. */
-	ATDCharacterBase();
+	/** Sets default values for this character's properties (body mesh is a USkeletalMeshComponentBudgeted). */
+	ATDCharacterBase(const FObjectInitializer& ObjectInitializer);
 
 	// ===== IAbilitySystemInterface =====
 
@@ -53,9 +76,14 @@ public:
 	/** Returns the owned Attribute Set for this character (used for GAS stats). */
 	virtual UAttributeSet* GetAttributeSet() const;
 
+	/** Rendered weapon component: the static weapon in Static mode, WeaponMesh otherwise. */
+	UFUNCTION(BlueprintPure, Category="Combat")
+	UMeshComponent* GetWeaponComponent() const;
+
 protected:
 	// ===== Engine overrides =====
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// ===== Initialization =====
 
@@ -66,6 +94,18 @@ protected:
 	 */
 	virtual void InitializeAbilityActorInfo();
 
+	// ===== Animation =====
+
+	/**
+	 * Significance of the body mesh for the animation budget allocator (higher = updated first, 1 = full detail).
+	 * bNeverSkip keeps the mesh at full rate regardless of load. Returns false when the mesh is not budgeted
+	 * (bUseAnimationBudget off, or the allocator is disabled), so callers can fall back to tick intervals.
+	 */
+	bool SetAnimationSignificance(float Significance, bool bNeverSkip = false);
+
+	/** True while the body mesh is registered with the animation budget allocator. */
+	bool IsAnimationBudgeted() const;
+
 	// ===== Components & GAS References =====
 
 	/** Skeletal mesh for the character's weapon. Exposed to the editor for assignment and setup. */
@@ -75,6 +115,22 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Combat")
 	FName WeaponAbilitySpawnSocketName;
 
+	/** Independent / LeaderPose / Static weapon rendering (applied at BeginPlay). */
+	UPROPERTY(EditDefaultsOnly, Category="Combat")
+	ETDWeaponMeshMode WeaponMeshMode = ETDWeaponMeshMode::Independent;
+
+	/** Rigid weapon used in Static mode (needs the same sockets as the skeletal weapon, e.g. the spawn socket). */
+	UPROPERTY(EditDefaultsOnly, Category="Combat", meta=(EditCondition="WeaponMeshMode==ETDWeaponMeshMode::Static"))
+	TObjectPtr<UStaticMesh> StaticWeaponMesh;
+
+	/** Component created for StaticWeaponMesh at BeginPlay (Static mode only). */
+	UPROPERTY(Transient, VisibleInstanceOnly, Category="Combat")
+	TObjectPtr<UStaticMeshComponent> WeaponStaticMeshComponent;
+
+	/** Register the body mesh with the animation budget allocator (read at BeginPlay). */
+	UPROPERTY(EditDefaultsOnly, Category="Performance")
+	bool bUseAnimationBudget = true;
+
 	/** Ability System Component for this actor.
 	 * For players, often owned by the PlayerState; for AI, by the Character.
 	 */
@@ -92,4 +148,8 @@ protected:
 	/** Handles granting abilities and startup logic. */
 	UPROPERTY(VisibleAnywhere, Category="GAS|Abilities")
 	TObjectPtr<UTDAbilityInitComponent> AbilityInitComponent;
+
+private:
+	/** Apply WeaponMeshMode: leader pose on the body, or swap the skeletal weapon for StaticWeaponMesh. */
+	void SetupWeaponMesh();
 };
\ No newline at end of file
@@ -5,10 +5,16 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayEffectTypes.h"
 #include "TDCharacterBase.h"
 #include "Interaction/HighlightInterface.h"
+#include "Subsystems/TDEnemySignificanceSubsystem.h"
 #include "TDEnemyCharacter.generated.h"
 
+class UGASCoreThreatComponent;
+class UHighlightProxyComponent;
+class UGASCoreAttributeArchetypeDataAsset;
+
 /**
  * ATDEnemyCharacter
  *
@@ -18,6 +24,31 @@
  * Design:
  * - AI owns its own ASC/AttributeSet (unlike players whose ASC lives on PlayerState).
  * - Level typically lives on the character itself for AI. See GetActorLevel().
+ *
+ * Significance (UTDEnemySignificanceSubsystem, bUseSignificance):
+ * - Medium (off screen): movement and body mesh tick at MediumSignificanceTickInterval, the weapon mesh stops
+ *   ticking and updating its pose, and the hover proxy stops colliding.
+ * - Low (far from every player): movement and body mesh tick at LowSignificanceTickInterval and, on the server,
+ *   the actor (and with it its ASC and attribute set) replicates at LowSignificanceNetUpdateFrequency with
+ *   LowSignificanceNetPriority.
+ *
+ * Replication detail (server):
+ * - AbilitySystemReplicationMode per enemy class: Minimal for trash mobs (tags and cues only), Full for bosses whose
+ *   buffs clients display (active effects with durations and stacks).
+ * - Crowd safety valve (bReduceReplicationWhenCrowded): while any connection has more than
+ *   TD.EnemyReplication.CrowdedRelevantEnemies enemies within net cull distance, Low significance enemies stop
+ *   replicating GE-driven state (tags, active effects) until they come closer or the crowd thins.
+ *
+ * Threat (server): ThreatComponent picks the target (damage dealt to this enemy, proximity aggro on player
+ * characters); AI logic reads GetThreatTarget or listens to its OnThreatTargetChanged. Pooled enemies forget it.
+ *
+ * Pooling (UTDEnemyPoolSubsystem):
+ * - Pool-owned enemies return to their class pool instead of being destroyed (ReleaseOrDestroy, lifespan expiry):
+ *   abilities cancelled, every active effect and loose tag removed, attributes back to class defaults, hidden,
+ *   collision and movement off, unregistered from the world's enemy systems, net dormant.
+ * - ActivateFromPool re-runs only the archetype initialization (batched); the ASC, attribute set, init components
+ *   and delegate bindings are kept. Granted abilities survive unless the new archetype differs.
+ * - bInPool replicates so clients drop collision and registrations of pooled enemies too.
  */
 UCLASS()
 class RPG_TOPDOWN_API ATDEnemyCharacter : public ATDCharacterBase, public IHighlightInterface
@@ -26,7 +57,7 @@ class RPG_TOPDOWN_API ATDEnemyCharacter : public ATDCharacterBase, public IHighl
 
 public:
 	// Sets default values for this character's properties
-	ATDEnemyCharacter();
+	ATDEnemyCharacter(const FObjectInitializer& ObjectInitializer);
 
 	/** Sets the actor as highlighted (visual feedback, e.g. for mouseover). */
 	virtual void HighlightActor() override;
@@ -41,13 +72,186 @@ public:
 	/** Combat Interface: return this enemy's level (used by MMCs, scaling, etc.). */
 	virtual int32 GetActorLevel() override;
 
+	/** Current fidelity bucket (cosmetic code should skip work below High). */
+	UFUNCTION(BlueprintPure, Category = "Significance")
+	ETDEnemySignificance GetSignificance() const { return Significance; }
+
+	/** Switch tick rates, weapon animation, hover collision and net priority (driven by UTDEnemySignificanceSubsystem). */
+	virtual void SetSignificance(ETDEnemySignificance NewSignificance);
+
+	/** Server: stop / resume replicating GE-driven ASC state (driven by UTDEnemySignificanceSubsystem; no-op unless bReduceReplicationWhenCrowded). */
+	void SetReplicationReduced(bool bReduced);
+
+	bool IsReplicationReduced() const { return bReplicationReduced; }
+
+	// ===== Lazy ability system =====
+
+	/**
+	 * Wake the dormant ASC in one step: actor info, ASC delegates and (server) startup ability grants. Called on
+	 * aggro (AI), the first effect applied (damage), hover (client), and on clients when the server's wake replicates.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GAS")
+	void ActivateAbilitySystem();
+
+	/** False while dormant (attributes initialized, no actor info, delegates or granted abilities). */
+	UFUNCTION(BlueprintPure, Category = "GAS")
+	bool IsAbilitySystemActive() const { return bAbilitySystemInitialized; }
+
+	// ===== Pooled lifecycle (driven by UTDEnemyPoolSubsystem) =====
+
+	/**
+	 * Server: reset for (re)use and mark this enemy as pool-owned: transform, visibility, collision, movement and
+	 * world registrations, then attributes from Archetype at Level (null / <= 0 keep the current ones).
+	 * Subclasses reset their own state and call Super.
+	 */
+	virtual void ActivateFromPool(const FTransform& Transform, UGASCoreAttributeArchetypeDataAsset* Archetype, int32 Level);
+
+	/** Server: clear ASC and attribute state, hide, disable collision and movement, and go net dormant until reused. */
+	virtual void DeactivateToPool();
+
+	/** True while deactivated in a pool. */
+	bool IsInPool() const { return bInPool; }
+
+	/** Server: back to the pool when pool-owned, destroyed otherwise (call instead of Destroy, e.g., on death). */
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	void ReleaseOrDestroy();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 protected:
+	virtual void PostInitializeComponents() override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Pool-owned enemies go back to the pool instead of being destroyed. */
+	virtual void LifeSpanExpired() override;
 
 	/** Initialize GAS owner/avatar for AI (AI owns its own ASC/AttributeSet). */
 	virtual void InitializeAbilityActorInfo() override;
 	
-	/** AI level value; typically server-only relevance for calculations. */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Character Class Defaults")
+	/** AI level value (replicated with AttributeArchetype: clients initialize attributes from both). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_AttributeInit, Category = "Character Class Defaults")
 	int32 EnemyCharacterLevel;
+
+	/**
+	 * Shared per-level base attributes for this enemy type (horde-friendly: no init GEs per instance).
+	 * Applied at BeginPlay (even while the ASC is dormant) at EnemyCharacterLevel, on the server and on clients: the set defers
+	 * initial replication, so a spawn replicates this asset and the level instead of the initialized values.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_AttributeInit, Category = "Character Class Defaults")
+	TObjectPtr<UGASCoreAttributeArchetypeDataAsset> AttributeArchetype;
+
+	/**
+	 * Keep the ASC dormant until ActivateAbilitySystem (for enemies the player may never reach). Attributes are still
+	 * initialized at spawn (health bars); off = initialize the ASC in BeginPlay.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "GAS")
+	bool bLazyAbilitySystemActivation = true;
+
+	/** Height of the overhead health bar above the top of the capsule. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UI")
+	float OverheadBarOffset = 30.f;
+
+	/** Server-side threat table and target selection (evaluated by UGASCoreThreatSubsystem). */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI")
+	TObjectPtr<UGASCoreThreatComponent> ThreatComponent;
+
+	/** Simple capsule that alone blocks HIGHLIGHTABLE, so hover traces never hit the skeletal mesh per-triangle. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Interactable)
+	TObjectPtr<UHighlightProxyComponent> HighlightProxy;
+
+	/** Evaluate significance (reduced fidelity when no player is near or can see this enemy). */
+	UPROPERTY(EditDefaultsOnly, Category = "Significance")
+	bool bUseSignificance = true;
+
+	/** Movement and body mesh tick interval while Medium (seconds). */
+	UPROPERTY(EditDefaultsOnly, Category = "Significance", meta = (ClampMin = "0.0", EditCondition = "bUseSignificance"))
+	float MediumSignificanceTickInterval = 0.05f;
+
+	/** Movement and body mesh tick interval while Low (seconds). */
+	UPROPERTY(EditDefaultsOnly, Category = "Significance", meta = (ClampMin = "0.0", EditCondition = "bUseSignificance"))
+	float LowSignificanceTickInterval = 0.2f;
+
+	/** Server: net update frequency while Low (Hz). */
+	UPROPERTY(EditDefaultsOnly, Category = "Significance", meta = (ClampMin = "0.1", EditCondition = "bUseSignificance"))
+	float LowSignificanceNetUpdateFrequency = 2.f;
+
+	/** Server: net priority while Low. */
+	UPROPERTY(EditDefaultsOnly, Category = "Significance", meta = (ClampMin = "0.0", EditCondition = "bUseSignificance"))
+	float LowSignificanceNetPriority = 0.5f;
+
+	/** ASC replication mode of this enemy class (Full: clients see active effects, e.g. boss buffs). */
+	UPROPERTY(EditDefaultsOnly, Category = "GAS|Replication")
+	EGameplayEffectReplicationMode AbilitySystemReplicationMode = EGameplayEffectReplicationMode::Minimal;
+
+	/** Allow the crowd safety valve to suppress GE-driven replication while Low (off for bosses). */
+	UPROPERTY(EditDefaultsOnly, Category = "GAS|Replication")
+	bool bReduceReplicationWhenCrowded = true;
+
+	/** Significance changed: start/stop cosmetic updates (VFX, audio, anim blueprint features). */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Significance")
+	void ReceiveSignificanceChanged(ETDEnemySignificance NewSignificance);
+
+	/** Server: taken from the pool (restart AI logic, spawn effects). */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Pooling")
+	void ReceiveActivatedFromPool();
+
+	/** Server: returned to the pool (stop AI logic, timers). */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Pooling")
+	void ReceiveDeactivatedToPool();
+
+private:
+	/** Deactivated in a pool (replicated: clients mirror the local collision/registration state). */
+	UPROPERTY(ReplicatedUsing = OnRep_InPool)
+	bool bInPool = false;
+
+	/** Server woke the ASC (replicated: clients wake theirs for cues and prediction). */
+	UPROPERTY(ReplicatedUsing = OnRep_AbilitySystemAwake)
+	bool bAbilitySystemAwake = false;
+
+	/** This machine's ASC is initialized (see ActivateAbilitySystem). */
+	bool bAbilitySystemInitialized = false;
+
+	UFUNCTION()
+	void OnRep_AbilitySystemAwake();
+
+	/** Handed out by UTDEnemyPoolSubsystem (release instead of destroy). */
+	bool bPoolOwned = false;
+
+	UFUNCTION()
+	void OnRep_InPool();
+
+	/** Clients: re-run the deterministic initialization for a new archetype / level (pool reuse). */
+	UFUNCTION()
+	void OnRep_AttributeInit();
+
+	/** Local part of the pool state: collision, movement/mesh ticks and world registrations. */
+	void ApplyPoolState();
+
+	/** Highlight registry, overhead bar and significance registration (BeginPlay/EndPlay and pool transitions). */
+	void RegisterWithWorldSystems();
+	void UnregisterFromWorldSystems();
+
+	/**
+	 * Queue the batched archetype initialization (server, and clients with deferred replication), register regen.
+	 * Once per archetype and level: a pool spawn's BeginPlay and activation, or both OnRep_AttributeInit calls of
+	 * one update, initialize once.
+	 */
+	void RequestArchetypeInitialization();
+
+	/** Archetype / level the attribute set was last initialized from (cleared when the set returns to defaults). */
+	TWeakObjectPtr<const UGASCoreAttributeArchetypeDataAsset> InitializedArchetype;
+	int32 InitializedLevel = INDEX_NONE;
+
+	/** Current bucket (see GetSignificance). */
+	ETDEnemySignificance Significance = ETDEnemySignificance::High;
+
+	/** GE-driven ASC replication suppressed (see SetReplicationReduced). */
+	bool bReplicationReduced = false;
+
+	/** Full-fidelity values captured at BeginPlay, restored when High. */
+	float HighMovementTickInterval = 0.f;
+	float HighMeshTickInterval = 0.f;
+	float HighNetUpdateFrequency = 0.f;
+	float HighNetPriority = 0.f;
 };
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include "TDCharacterBase.h"
 #include "TDPlayerCharacter.generated.h"
 
+class ATDPlayerState;
+
 /**
  * ATDPlayerCharacter
  *
@@ -26,7 +28,7 @@ class RPG_TOPDOWN_API ATDPlayerCharacter : public ATDCharacterBase
 
 public:
 	// Sets default values for this character's properties
-	ATDPlayerCharacter();
+	ATDPlayerCharacter(const FObjectInitializer& ObjectInitializer);
 
 	/** Called when this character is possessed by a new controller (server-side).
 	  * Initializes the Ability System with the new controller and state.
@@ -39,13 +41,33 @@ public:
 	  */
 	virtual void OnRep_PlayerState() override;
 
-	/** Combat Interface: get level from PlayerState for player-controlled characters. */
-	virtual int32 GetActorLevel() override;
-	
+	/** The locally controlled character is never skipped by the animation budget allocator. */
+	virtual void NotifyControllerChanged() override;
+
+	/** Combat Interface: the PlayerState's level, cached on the avatar (MMCs read it on every evaluation). */
+	virtual int32 GetActorLevel() override { return CachedLevel; }
+
+	/** Combat Interface: broadcast after the cached level changed (level-dependent MMCs re-evaluate on it). */
+	virtual FOnExternalGameplayModifierDependencyChange* GetActorLevelChangedDelegate() override { return &OnActorLevelChanged; }
+
 protected:
 
 	/** Initialize GAS owner/avatar references (PlayerState owner, this character as avatar). */
 	virtual void InitializeAbilityActorInfo() override;
 
-	
+private:
+	/** Follow PlayerState's level (unbinds the previous one; re-possession and pooled avatars rebind). */
+	void BindPlayerLevel(ATDPlayerState* PlayerState);
+
+	void HandlePlayerLevelChanged(int32 OldLevel, int32 NewLevel);
+
+	/** Mirror of ATDPlayerState::PlayerLevel, refreshed by OnPlayerLevelChanged. */
+	int32 CachedLevel = 1;
+
+	FOnExternalGameplayModifierDependencyChange OnActorLevelChanged;
+
+	/** PlayerState whose OnPlayerLevelChanged is bound. */
+	TWeakObjectPtr<ATDPlayerState> LevelPlayerState;
+
+	FDelegateHandle PlayerLevelChangedHandle;
 };
\ No newline at end of file
@@ -8,12 +8,24 @@
 #include "GameFramework/GameMode.h"
 #include "TDGameMode.generated.h"
 
+class ATDBotPlayerController;
+
 /**
- * 
+ * ATDGameMode
+ *
+ * Soak tests: logins with the TDBot URL option (bot clients, "127.0.0.1?TDBot") get BotPlayerControllerClass
+ * instead of PlayerControllerClass.
  */
 UCLASS()
 class RPG_TOPDOWN_API ATDGameMode : public AGameMode
 {
 	GENERATED_BODY()
-	
+
+public:
+	virtual APlayerController* SpawnPlayerController(ENetRole InRemoteRole, const FString& Options) override;
+
+protected:
+	/** Controller of bot logins (a Blueprint child with the player's input assets). Unset = bots play as players. */
+	UPROPERTY(EditDefaultsOnly, Category="Classes")
+	TSubclassOf<ATDBotPlayerController> BotPlayerControllerClass;
 };
@@ -0,0 +1,93 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+
+#include "TDReplicationGraph.generated.h"
+
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_GridSpatialization2D;
+class UReplicationGraphNode_PlayerStateFrequencyLimiter;
+
+/** How actors of a class are routed to the graph's nodes. */
+enum class ETDClassRepNodeMapping : uint8
+{
+	/** Not in a global node: PlayerControllers, PlayerStates and view targets come from the per-connection node. */
+	NotRouted,
+	/** Every connection, every frame (game state, world settings, bAlwaysRelevant classes). */
+	RelevantAllConnections,
+	/** Grid, never moves (placed actors without movement replication). */
+	Spatialize_Static,
+	/** Grid, re-binned every frame (pawns, anything replicating movement). */
+	Spatialize_Dynamic,
+	/** Grid, static while dormant and dynamic while awake (pickups, pooled enemies and projectiles). */
+	Spatialize_Dormancy,
+};
+
+/**
+ * UTDReplicationGraph
+ *
+ * Purpose:
+ * - Server net consider cost that scales with the density around each player instead of the world population:
+ *   with the default relevancy every replicated actor is tested against every connection every frame.
+ *
+ * How it works:
+ * - Enemies, ability projectiles and effect pickups live in a 2D spatial grid (TD.RepGraph.CellSize); a connection
+ *   only considers the actors in the cells around its viewers. They are routed as dormancy-aware, so pooled and
+ *   idle actors cost nothing until FlushNetDormancy/DORM_Awake, and are re-binned only while awake.
+ * - Other classes are routed from their CDO: bAlwaysRelevant / AInfo to every connection, movement replication to
+ *   the dynamic grid, the rest to the static grid.
+ * - Per connection: its PlayerController, its own ATDPlayerState and the viewed pawn, every frame at full rate.
+ *   Other players' PlayerStates go through a frequency limiter (a few per frame), not 100 Hz to everyone.
+ * - Per-actor values are honored: NetCullDistanceSquared at registration, and NetUpdateFrequency changes reported
+ *   through NotifyNetUpdateFrequencyChanged (enemy significance).
+ *
+ * Enabled by ReplicationDriverClassName in DefaultEngine.ini ([/Script/OnlineSubsystemUtils.IpNetDriver]).
+ * bOnlyRelevantToOwner classes other than the above are not routed: attach them to their owner as dependent
+ * actors (GlobalActorReplicationInfoMap.AddDependentActor) or list them in InitGlobalActorClassSettings.
+ */
+UCLASS(Transient, config = Engine)
+class RPG_TOPDOWN_API UTDReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	/** Server: re-read Actor's NetUpdateFrequency into its replication period (no-op without this graph). */
+	static void NotifyNetUpdateFrequencyChanged(AActor* Actor);
+
+	// ===== UReplicationGraph =====
+
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+private:
+	/** Policy of Class: explicit entry (or a parent's), otherwise inferred from the CDO and cached. */
+	ETDClassRepNodeMapping GetMappingPolicy(UClass* Class);
+
+	/** Routing policy per class (TClassMap: subclasses inherit their parent's entry). */
+	TClassMap<ETDClassRepNodeMapping> ClassRepNodePolicies;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_PlayerStateFrequencyLimiter> PlayerStateNode;
+};
+
+/** Per connection: the connection's PlayerController, its own PlayerState and each viewer's view target. */
+UCLASS()
+class RPG_TOPDOWN_API UTDReplicationGraphNode_AlwaysRelevant_ForConnection : public UReplicationGraphNode_AlwaysRelevant_ForConnection
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+};
@@ -0,0 +1,34 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTraitBase.h"
+#include "Mass/TDCrowdTypes.h"
+
+#include "TDCrowdEnemyTrait.generated.h"
+
+/**
+ * UTDCrowdEnemyTrait
+ *
+ * Adds the GAS-lite crowd enemy fragments to a Mass entity config. Combine with the MassGameplay movement and
+ * visualization traits (instanced static meshes with vertex-animated materials) for the swarm's motion and look.
+ */
+UCLASS(meta = (DisplayName = "TD Crowd Enemy"))
+class RPG_TOPDOWN_API UTDCrowdEnemyTrait : public UMassEntityTraitBase
+{
+	GENERATED_BODY()
+
+protected:
+	virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+
+	/** Initial vitals of every entity. */
+	UPROPERTY(EditAnywhere, Category = "Crowd")
+	FTDCrowdVitalsFragment Vitals;
+
+	UPROPERTY(EditAnywhere, Category = "Crowd")
+	FTDCrowdCombatFragment Combat;
+
+	UPROPERTY(EditAnywhere, Category = "Crowd")
+	FTDCrowdEnemyParameters Parameters;
+};
@@ -0,0 +1,67 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityQuery.h"
+#include "MassProcessor.h"
+
+#include "TDCrowdProcessors.generated.h"
+
+/**
+ * Crowd enemy processors (standalone only, in order): regeneration → queued damage → promotion to actors.
+ */
+
+/** Health regeneration of living crowd enemies (parallel-safe, no UObject access). */
+UCLASS()
+class RPG_TOPDOWN_API UTDCrowdRegenProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UTDCrowdRegenProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
+
+/** Applies UTDCrowdSubsystem's queued damage and destroys dead entities. */
+UCLASS()
+class RPG_TOPDOWN_API UTDCrowdDamageProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UTDCrowdDamageProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
+
+/**
+ * Promotes entities within PromotionRadius of a player pawn to pooled ATDEnemyCharacter actors (real ASC), keeping
+ * their health fraction. At most TD.Crowd.MaxPromotionsPerFrame per frame so a charge into the swarm does not hitch.
+ */
+UCLASS()
+class RPG_TOPDOWN_API UTDCrowdPromotionProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UTDCrowdPromotionProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
@@ -0,0 +1,57 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mass/TDCrowdTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "TDCrowdSubsystem.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FTDCrowdEnemyKilledSignature, const FVector&, Location);
+
+/**
+ * UTDCrowdSubsystem
+ *
+ * Purpose:
+ * - Gameplay-facing side of the Mass crowd enemies: abilities queue damage here instead of addressing entities.
+ *
+ * How it works:
+ * - ApplyCrowdDamageInRadius queues a request (AoE projectile impacts call it, see ATDProjectileActor::CrowdDamage);
+ *   UTDCrowdDamageProcessor applies every queued request to the crowd
+ *   in one pass per frame (block, crit and armor resolved with GASCoreFormulas), destroys the dead entities and
+ *   broadcasts OnCrowdEnemyKilled for each (loot, XP, death FX).
+ * - Standalone only: crowd entities are not replicated, so remote clients could neither see nor target unpromoted
+ *   crowd members. The crowd processors therefore run only in NM_Standalone and ApplyCrowdDamageInRadius ignores
+ *   other net modes; networked levels spawn ATDEnemyCharacter actors (UTDEnemyPoolSubsystem) instead of Mass crowds.
+ */
+UCLASS()
+class RPG_TOPDOWN_API UTDCrowdSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UTDCrowdSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Standalone: damage every crowd enemy within Radius of Center (applied by the next crowd damage pass). */
+	UFUNCTION(BlueprintCallable, Category = "Crowd", meta = (AdvancedDisplay = "SourceArmorPenetration,SourceCriticalHitChance,SourceCriticalHitDamage"))
+	void ApplyCrowdDamageInRadius(const FVector& Center, float Radius, float BaseDamage, float SourceArmorPenetration = 0.f,
+		float SourceCriticalHitChance = 0.f, float SourceCriticalHitDamage = 0.f);
+
+	/** Requests queued since the last damage pass (the queue is left empty). */
+	TArray<FTDCrowdDamageRequest> ConsumeDamageRequests() { return MoveTemp(PendingDamage); }
+
+	bool HasPendingDamage() const { return PendingDamage.Num() > 0; }
+
+	/** A crowd enemy died at Location (standalone). */
+	UPROPERTY(BlueprintAssignable, Category = "Crowd")
+	FTDCrowdEnemyKilledSignature OnCrowdEnemyKilled;
+
+	// ===== UWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+
+private:
+	TArray<FTDCrowdDamageRequest> PendingDamage;
+};
@@ -0,0 +1,91 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+
+#include "TDCrowdTypes.generated.h"
+
+class ATDEnemyCharacter;
+class UGASCoreAttributeArchetypeDataAsset;
+
+/**
+ * Crowd enemies (GAS-lite): swarm units simulated as Mass entities instead of ATDEnemyCharacter actors.
+ * - Vitals and the defensive stats the damage pipeline reads live in fragments; regeneration and damage run in
+ *   Mass processors (TDCrowdProcessors.h), with the same GASCoreFormulas damage resolution as the GAS exec calc.
+ * - Entities close to a player are promoted to a pooled ATDEnemyCharacter with a real ASC (health carried over).
+ */
+
+/** Crowd enemy vitals (the GAS-lite counterpart of the vital attributes). */
+USTRUCT()
+struct RPG_TOPDOWN_API FTDCrowdVitalsFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Crowd", meta = (ClampMin = "0.0"))
+	float Health = 100.f;
+
+	UPROPERTY(EditAnywhere, Category = "Crowd", meta = (ClampMin = "1.0"))
+	float MaxHealth = 100.f;
+
+	/** Health per second. */
+	UPROPERTY(EditAnywhere, Category = "Crowd", meta = (ClampMin = "0.0"))
+	float HealthRegeneration = 0.f;
+};
+
+/** Defensive stats read by crowd damage (percent values as authored: 25 = 25%). */
+USTRUCT()
+struct RPG_TOPDOWN_API FTDCrowdCombatFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Crowd", meta = (ClampMin = "0.0"))
+	float Armor = 0.f;
+
+	UPROPERTY(EditAnywhere, Category = "Crowd", meta = (ClampMin = "0.0", ClampMax = "100.0"))
+	float BlockChance = 0.f;
+
+	UPROPERTY(EditAnywhere, Category = "Crowd", meta = (ClampMin = "0.0"))
+	float CriticalHitResistance = 0.f;
+};
+
+/** Per-config promotion settings shared by every entity of the archetype. */
+USTRUCT()
+struct RPG_TOPDOWN_API FTDCrowdEnemyParameters : public FMassConstSharedFragment
+{
+	GENERATED_BODY()
+
+	/** Actor the entity becomes near a player (acquired from UTDEnemyPoolSubsystem). */
+	UPROPERTY(EditAnywhere, Category = "Crowd")
+	TSubclassOf<ATDEnemyCharacter> PromotedClass;
+
+	/** Archetype / level of the promoted actor (null / <= 0 keep the class defaults). */
+	UPROPERTY(EditAnywhere, Category = "Crowd")
+	TObjectPtr<UGASCoreAttributeArchetypeDataAsset> PromotedArchetype;
+
+	UPROPERTY(EditAnywhere, Category = "Crowd")
+	int32 PromotedLevel = 0;
+
+	/** Distance to a player pawn at which the entity is promoted (close combat range). */
+	UPROPERTY(EditAnywhere, Category = "Crowd", meta = (ClampMin = "0.0", Units = "cm"))
+	float PromotionRadius = 1200.f;
+};
+
+/** Marks crowd enemy entities. */
+USTRUCT()
+struct RPG_TOPDOWN_API FTDCrowdEnemyTag : public FMassTag
+{
+	GENERATED_BODY()
+};
+
+/** Damage queued on UTDCrowdSubsystem, applied by UTDCrowdDamageProcessor to every crowd enemy in range. */
+struct FTDCrowdDamageRequest
+{
+	FVector Center = FVector::ZeroVector;
+	float Radius = 0.f;
+	float BaseDamage = 0.f;
+	float SourceArmorPenetration = 0.f;
+	float SourceCriticalHitChance = 0.f;
+	float SourceCriticalHitDamage = 0.f;
+};
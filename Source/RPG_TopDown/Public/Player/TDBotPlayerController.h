@@ -0,0 +1,105 @@
+// © 2025 Heathrow (Derman). All rights reserved.This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Player/TDPlayerController.h"
+#include "TDBotPlayerController.generated.h"
+
+class UGASCoreAbilitySystemComponent;
+
+/**
+ * ATDBotPlayerController
+ *
+ * Scripted player for soak tests: drives the same client paths a human does, so the server sees real player
+ * traffic (movement orders, predicted ability activations, effect-actor overlaps).
+ *
+ * How it works:
+ * - Local controller only (the bot client process, usually -nullrhi). The server copy is a plain player controller.
+ * - Every OrderInterval seconds: walk to the nearest effect actor within PickupSearchRadius (PickupChance), or to a
+ *   random reachable point within WanderRadius. Orders go through UClickToMoveComponent as a short click
+ *   (pressed / held with a synthetic hit / released), so they take the autorun path of a real click.
+ * - AbilityPressesPerSecond: presses a random AbilityInputTags entry, holds it for AbilityHoldSeconds through
+ *   UGASCoreAbilitySystemComponent::AbilityInputTagHeld, then releases it.
+ * - Cursor-driven abilities aim at a random point within AimRadius (GetAbilityCursorHit), picked per press.
+ *
+ * Running:
+ * - ATDGameMode spawns BotPlayerControllerClass for logins with the TDBot URL option, e.g.
+ *   "RPG_TopDown 127.0.0.1?TDBot -game -nullrhi -nosound". Use a Blueprint child of this class (it needs the
+ *   input assets of the player controller).
+ */
+UCLASS()
+class RPG_TOPDOWN_API ATDBotPlayerController : public ATDPlayerController
+{
+	GENERATED_BODY()
+
+public:
+	ATDBotPlayerController();
+
+	virtual void Tick(float DeltaSeconds) override;
+
+	// ===== IGASCoreCursorHitInterface =====
+
+	/** Bots have no cursor: the current aim point. */
+	virtual bool GetAbilityCursorHit(ECollisionChannel Channel, FHitResult& OutHit) override;
+
+protected:
+	virtual void BeginPlay() override;
+
+	/** Ability input tags pressed at random (empty = RMB and the quick slots). */
+	UPROPERTY(EditDefaultsOnly, Category="Bot")
+	TArray<FGameplayTag> AbilityInputTags;
+
+	/** Seconds between movement orders (randomized by ±50%). */
+	UPROPERTY(EditDefaultsOnly, Category="Bot", meta=(ClampMin="0.1"))
+	float OrderInterval = 4.f;
+
+	UPROPERTY(EditDefaultsOnly, Category="Bot", meta=(ClampMin="0"))
+	float WanderRadius = 2000.f;
+
+	/** Chance per order to walk to the nearest effect actor instead of wandering. */
+	UPROPERTY(EditDefaultsOnly, Category="Bot", meta=(ClampMin="0", ClampMax="1"))
+	float PickupChance = 0.3f;
+
+	UPROPERTY(EditDefaultsOnly, Category="Bot", meta=(ClampMin="0"))
+	float PickupSearchRadius = 5000.f;
+
+	UPROPERTY(EditDefaultsOnly, Category="Bot", meta=(ClampMin="0"))
+	float AbilityPressesPerSecond = 1.f;
+
+	UPROPERTY(EditDefaultsOnly, Category="Bot", meta=(ClampMin="0"))
+	float AbilityHoldSeconds = 0.2f;
+
+	UPROPERTY(EditDefaultsOnly, Category="Bot", meta=(ClampMin="0"))
+	float AimRadius = 1000.f;
+
+private:
+	/** Issue the next movement order. */
+	void IssueMoveOrder();
+
+	/** Nearest effect actor within PickupSearchRadius. */
+	bool FindPickupLocation(const FVector& Origin, FVector& OutLocation) const;
+
+	/** Short click at Destination through the click-to-move component. */
+	void ClickToMove(const FVector& Destination);
+
+	/** Press / hold / release the scripted ability input. */
+	void TickAbilityInput(float DeltaSeconds);
+
+	void ReleaseAbilityInput();
+
+	UGASCoreAbilitySystemComponent* GetBotAbilitySystem() const;
+
+	FTimerHandle OrderTimer;
+
+	/** Input held this frame (invalid = none) and its remaining hold time. */
+	FGameplayTag HeldInputTag;
+	float HoldRemaining = 0.f;
+
+	FVector AimLocation = FVector::ZeroVector;
+
+	FRandomStream Random;
+};
@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "GameFramework/PlayerController.h"
+#include "Interfaces/GASCoreCursorHitInterface.h"
 #include "TDPlayerController.generated.h"
 
 class UClickToMoveComponent;
@@ -29,9 +30,21 @@ class UTDAbilitySystemComponent;
  * GAS Input:
  * - Ability input binding is data-driven via UTDInputConfig. Input actions are mapped to FGameplayTag
  *   and are forwarded to handler functions on this controller (Pressed/Released/Held).
+ * - Ability tasks get cursor hits from UHighlightCursorHitSubsystem (IGASCoreCursorHitInterface), sharing
+ *   the frame's traces with highlighting and click-to-move. HIGHLIGHTABLE and the click-to-move channel are a shared
+ *   channel set, so both come from one cursor trace per frame.
+ * - Input tags are routed through a table built once per input config (InputRoutes): LMB is a pointer route
+ *   (ASC while targeting, click-to-move otherwise), everything else goes to the ASC. Targeting is pushed by
+ *   UHighlightInteraction::OnHighlightedActorChanged, so held input never polls the highlight.
+ *
+ * Zero-hitch possession:
+ * - List this controller class in a UGASCoreGameDataAsset ("Input" bundle) so its mapping context and input
+ *   config are resident before login.
+ * - Re-possession (respawn) reuses everything: the mapping context is only added if missing, and the input
+ *   component keeps its cached ability bindings for the same InputConfig.
  */
 UCLASS()
-class RPG_TOPDOWN_API ATDPlayerController : public APlayerController
+class RPG_TOPDOWN_API ATDPlayerController : public APlayerController, public IGASCoreCursorHitInterface
 {
 	GENERATED_BODY()
 
@@ -39,6 +52,10 @@ public:
 	/** Default constructor. Sets replication and creates highlight interaction component. */
 	ATDPlayerController();
 
+	// ===== IGASCoreCursorHitInterface =====
+
+	virtual bool GetAbilityCursorHit(ECollisionChannel Channel, FHitResult& OutHit) override;
+
 protected:
 	// ===== APlayerController overrides =====
 
@@ -48,6 +65,12 @@ protected:
 	/** Binds Enhanced Input actions to local handler functions. */
 	virtual void SetupInputComponent() override;
 
+	/** Re-possession: make sure the mapping context is still registered (no-op when it is). */
+	virtual void AcknowledgePossession(APawn* P) override;
+
+	/** Delivers this frame's aggregated held ability input once all input has been processed. */
+	virtual void PostProcessInput(const float DeltaTime, const bool bGamePaused) override;
+
 	// ===== Components =====
 
 	/** Component handling highlighting logic for the player (e.g., interactable outlines).
@@ -76,6 +99,12 @@ private:
 	UPROPERTY(EditAnywhere, Category="Enhanced Input")
 	TObjectPtr<UInputAction> MoveAction = nullptr;
 
+	/** Attribute menu toggle input action (optional).
+	  * Opens ATDHUD's attribute menu when closed and closes it when open.
+	  */
+	UPROPERTY(EditAnywhere, Category="Enhanced Input")
+	TObjectPtr<UInputAction> ToggleAttributeMenuAction = nullptr;
+
 	/** Data asset mapping ability-related input actions to gameplay tags.
 	  * Used by Enhanced Input to bind ability input events (Pressed/Released/Held) to handler functions.
 	  */
@@ -89,6 +118,9 @@ private:
 	/** Lazy getter for the controller's ASC. */
 	UTDAbilitySystemComponent* GetASC();
 
+	/** Add GASInputMappingContext for the local player unless it is already registered. */
+	void AddInputMappingContext() const;
+
 	// ===== Input handlers =====
 
 	/** Handler function for movement input.
@@ -97,13 +129,48 @@ private:
 	  */
 	void Move(const FInputActionValue& InputActionValue);
 
+	/** Handler for ToggleAttributeMenuAction: open or close the HUD's attribute menu. */
+	void ToggleAttributeMenu();
+
 	/** Ability input handler for "Pressed" (ETriggerEvent::Started). */
 	void AbilityInputActionTagPressed(FGameplayTag InputTag);
 
 	/** Ability input handler for "Released" (ETriggerEvent::Completed). */
 	void AbilityInputActionReleased(FGameplayTag InputTag);
 
-	/** Ability input handler for "Held" (ETriggerEvent::Triggered). */
-	void AbilityInputActionHeld(FGameplayTag InputTag);
-	
+	/** Ability input handler for "Held" (ETriggerEvent::Triggered), aggregated: every tag held this frame. */
+	void AbilityInputActionsHeld(TArrayView<const FGameplayTag> InputTags);
+
+	/** Pointer route held without a target: feed click-to-move this frame's nav-channel cursor hit. */
+	void HandleClickToMoveHeld();
+
+	// ===== Input routing =====
+
+	/** Where an ability input tag goes. */
+	enum class EInputRoute : uint8
+	{
+		Ability,    // forwarded to the ASC
+		Pointer     // ASC while targeting a highlighted actor, click-to-move otherwise (LMB)
+	};
+
+	struct FInputRouteEntry
+	{
+		FGameplayTag InputTag;
+		EInputRoute Route = EInputRoute::Ability;
+	};
+
+	/** Route per input tag of InputConfig (a handful of entries; tags not in the table go to the ASC). */
+	TArray<FInputRouteEntry, TInlineAllocator<8>> InputRoutes;
+
+	/** Highlighted actor present (pushed by OnHighlightedActorChanged). */
+	bool bTargeting = false;
+
+	/** Fill InputRoutes from InputConfig (SetupInputComponent). */
+	void BuildInputRoutes();
+
+	/** Route of InputTag. */
+	EInputRoute FindInputRoute(const FGameplayTag& InputTag) const;
+
+	/** UHighlightInteraction::OnHighlightedActorChanged. */
+	void OnHighlightedActorChanged(AActor* NewActor);
 };
\ No newline at end of file
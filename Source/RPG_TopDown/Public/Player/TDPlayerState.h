@@ -7,10 +7,20 @@
 #include "CoreMinimal.h"
 #include "AbilitySystemInterface.h"
 #include "GameFramework/PlayerState.h"
+#include "GameplayTagContainer.h"
 #include "TDPlayerState.generated.h"
 
 class UAttributeSet;
 class UAbilitySystemComponent;
+class UGameplayAbility;
+class UGameplayEffect;
+struct FActiveGameplayEffect;
+struct FActiveGameplayEffectHandle;
+struct FGameplayEffectSpec;
+struct FGASCoreAttributeDelta;
+
+/** PlayerLevel changed (server: SetPlayerLevel; clients: replication). */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FTDOnPlayerLevelChanged, int32 /*OldLevel*/, int32 /*NewLevel*/);
 
 /**
  * ATDPlayerState
@@ -21,6 +31,21 @@ class UAbilitySystemComponent;
  *
  * In Unreal GAS, PlayerState is the preferred owner for AbilitySystemComponent (ASC) and attributes
  * for persistent, replicated state across possession changes.
+ *
+ * Adaptive net update frequency (server):
+ * - Idle, the PlayerState replicates at IdleNetUpdateFrequency. ASC activity (effect applied/removed, ability
+ *   activated, attribute change, owned tag change) forces an update (once per frame), so changes still leave
+ *   in the next net tick.
+ * - Combat events (effect applied, ability activated) raise the rate to BurstNetUpdateFrequency for BurstDuration
+ *   seconds after the last one. Regeneration-only attribute changes do not count: clients extrapolate them.
+ *
+ * GAS save state (server):
+ * - SaveGASState writes a FGASCoreAbilitySystemSnapshot (attribute bases, granted abilities, active effects tagged
+ *   with one of PersistentEffectTags) for checkpoints and save games; SetPendingGASState queues bytes to restore.
+ * - Seamless travel and reconnects (CopyProperties / OverrideWith) queue the old PlayerState's snapshot on the new
+ *   one, including the infinite attribute init effects (SetAttributeInitEffects). That state is complete: the avatar
+ *   skips the attribute init effects and startup ability grants and restores it in one step (HasTravelGASState).
+ * - Saved states are applied by the avatar on top of the usual initialization (ApplyPendingGASState).
  */
 UCLASS()
 class RPG_TOPDOWN_API ATDPlayerState : public APlayerState, public IAbilitySystemInterface
@@ -42,8 +67,51 @@ public:
 	/** Read-only getter for player level. */
 	FORCEINLINE int32 GetPlayerLevel() const { return PlayerLevel; };
 
+	/** Server: change the player level (push-model: marks PlayerLevel dirty). */
+	void SetPlayerLevel(int32 NewLevel);
+
+	/** Fires on server and clients whenever PlayerLevel actually changes. */
+	FTDOnPlayerLevelChanged OnPlayerLevelChanged;
+
+	/** Server: write the GAS save state (binary FGASCoreAbilitySystemSnapshot) to OutBytes. */
+	void SaveGASState(TArray<uint8>& OutBytes) const;
+
+	/** Server: queue a saved GAS state; restored by the next ApplyPendingGASState. */
+	void SetPendingGASState(TArray<uint8> Bytes);
+
+	/** Server: the pending state came from the previous PlayerState and replaces attribute init and startup grants. */
+	FORCEINLINE bool HasTravelGASState() const { return bPendingGASStateFromTravel && !PendingGASState.IsEmpty(); }
+
+	/** Server: infinite attribute init effects applied by the avatar (carried over on travel, not re-applied). */
+	void SetAttributeInitEffects(TArray<TSubclassOf<UGameplayEffect>> EffectClasses);
+
+	/** Server: restore the queued GAS state (after startup attributes and abilities). @return false if none was queued or it failed to load. */
+	bool ApplyPendingGASState();
+
+	/** Seamless travel / reconnect: the new PlayerState restores this one's GAS state. */
+	virtual void CopyProperties(APlayerState* PlayerState) override;
+
+	/** Reconnect: PlayerState is the inactive one this player left; its GAS state is restored here. */
+	virtual void OverrideWith(APlayerState* PlayerState) override;
+
 protected:
 	virtual void BeginPlay() override;
+
+	/** Net update rate while the ASC is idle (Hz); activity forces an update on top of it. */
+	UPROPERTY(EditDefaultsOnly, Category = "Net", meta = (ClampMin = "1.0"))
+	float IdleNetUpdateFrequency = 10.f;
+
+	/** Net update rate during a combat burst (Hz). */
+	UPROPERTY(EditDefaultsOnly, Category = "Net", meta = (ClampMin = "1.0"))
+	float BurstNetUpdateFrequency = 100.f;
+
+	/** Seconds after the last combat event the burst rate is kept (0 = no burst, forced updates only). */
+	UPROPERTY(EditDefaultsOnly, Category = "Net", meta = (ClampMin = "0.0"))
+	float BurstDuration = 2.f;
+
+	/** Active effects with one of these asset tags are part of the GAS save state (see SaveGASState). */
+	UPROPERTY(EditDefaultsOnly, Category = "Persistence")
+	FGameplayTagContainer PersistentEffectTags;
 	
 	/** The AbilitySystemComponent for this player, authoritatively owned and replicated. */
 	UPROPERTY(VisibleAnywhere)
@@ -54,11 +122,51 @@ protected:
 	TObjectPtr<UAttributeSet> AttributeSet;
 
 private:
-	// Replicated player level with RepNotify for HUD/UI reactions.
+	// Replicated (push-based) player level with RepNotify for HUD/UI reactions. Write through SetPlayerLevel.
 	UPROPERTY(VisibleAnywhere, ReplicatedUsing=OnRep_PlayerLevel)
 	int32 PlayerLevel = 1;
 
 	// RepNotify hook: broadcast/update UI on PlayerLevel changes when replicated to clients.
 	UFUNCTION()
 	void OnRep_PlayerLevel(int32 OldLevel);
+
+	/** Server: listen to the ASC for replication-relevant activity. */
+	void BindNetActivityDelegates();
+
+	/** Force a net update (once per frame); combat events also start or extend the burst window. */
+	void NotifyNetActivity(bool bCombatEvent);
+
+	/** Burst window elapsed: back to IdleNetUpdateFrequency. */
+	void EndNetBurst();
+
+	void SetAdaptiveNetUpdateFrequency(float Frequency);
+
+	void HandleEffectAppliedForNet(UAbilitySystemComponent* ASC, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+	void HandleEffectRemovedForNet(const FActiveGameplayEffect& Effect);
+	void HandleAbilityActivatedForNet(UGameplayAbility* Ability);
+	void HandleAttributeDeltasForNet(TArrayView<const FGASCoreAttributeDelta> Deltas);
+	void HandleTagChangedForNet(FGameplayTag Tag, int32 NewCount);
+
+	/** Server: level and GAS state of this PlayerState queued on Target (travel / reconnect). */
+	void ForwardGASState(ATDPlayerState& Target) const;
+
+	/** GAS save state waiting for the avatar (SetPendingGASState, CopyProperties). */
+	TArray<uint8> PendingGASState;
+
+	/** Attribute init effects of the avatar (see SetAttributeInitEffects). */
+	TArray<TSubclassOf<UGameplayEffect>> AttributeInitEffects;
+
+	/** Attribute ordinals written by native regeneration (extrapolated on clients, not activity). */
+	TBitArray<> RegeneratingOrdinals;
+
+	FTimerHandle NetBurstTimerHandle;
+
+	/** Frames of the last forced update / burst refresh (one of each per frame at most). */
+	uint64 LastForcedNetUpdateFrame = 0;
+	uint64 LastNetBurstRefreshFrame = 0;
+
+	bool bNetBurstActive = false;
+
+	/** PendingGASState was forwarded by ForwardGASState (see HasTravelGASState). */
+	bool bPendingGASStateFromTravel = false;
 };
\ No newline at end of file
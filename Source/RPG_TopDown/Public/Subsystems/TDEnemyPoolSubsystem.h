@@ -0,0 +1,80 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "TDEnemyPoolSubsystem.generated.h"
+
+class ATDEnemyCharacter;
+class UGASCoreAttributeArchetypeDataAsset;
+
+/** Deactivated enemies of one class, ready for reuse. */
+USTRUCT()
+struct FTDEnemyPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<ATDEnemyCharacter>> Actors;
+};
+
+/**
+ * UTDEnemyPoolSubsystem
+ *
+ * Purpose:
+ * - Per-class pools of ATDEnemyCharacter, so a wave re-uses dead enemies instead of constructing a character with
+ *   its ASC, attribute set and init components (and running InitAbilityActorInfo/BindASCDelegates) every spawn.
+ *
+ * How it works:
+ * - AcquireEnemy pops a pooled enemy of the class (or spawns one) and resets it through ActivateFromPool:
+ *   transform, visibility, collision, movement, registrations and the batched archetype initialization.
+ * - Pool-owned enemies return through ReleaseEnemy when gameplay calls ReleaseOrDestroy (death) or their lifespan
+ *   expires: abilities cancelled, active effects and loose tags removed, attributes back to class defaults, hidden,
+ *   collision and movement off, net dormant. Up to TD.EnemyPool.MaxPerClass enemies per class are kept.
+ * - Granted abilities stay with a pooled enemy and are only cleared when it is re-acquired with another archetype.
+ * - PrewarmEnemies fills a class pool ahead of time (loading screens, before a horde wave).
+ * - Server only; clients see the replicated pooled state.
+ */
+UCLASS()
+class RPG_TOPDOWN_API UTDEnemyPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UTDEnemyPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Server: activate a pooled EnemyClass enemy at Transform (spawning one if the pool is empty).
+	 * Archetype / Level override the enemy's defaults (null / <= 0 keep them).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Enemy Pool", meta = (AdvancedDisplay = "Archetype,Level"))
+	ATDEnemyCharacter* AcquireEnemy(TSubclassOf<ATDEnemyCharacter> EnemyClass, const FTransform& Transform,
+		UGASCoreAttributeArchetypeDataAsset* Archetype = nullptr, int32 Level = 0);
+
+	/** Server: deactivate Enemy into its class pool (destroyed when the pool is full). */
+	UFUNCTION(BlueprintCallable, Category = "Enemy Pool")
+	void ReleaseEnemy(ATDEnemyCharacter* Enemy);
+
+	/** Server: spawn deactivated EnemyClass enemies until Count are pooled (capped by MaxPerClass). */
+	UFUNCTION(BlueprintCallable, Category = "Enemy Pool")
+	void PrewarmEnemies(TSubclassOf<ATDEnemyCharacter> EnemyClass, int32 Count);
+
+	/** Number of pooled (inactive) enemies of EnemyClass. */
+	UFUNCTION(BlueprintPure, Category = "Enemy Pool")
+	int32 GetNumPooled(TSubclassOf<ATDEnemyCharacter> EnemyClass) const;
+
+	// ===== UWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+
+private:
+	/** Spawn a fresh enemy (BeginPlay has run when this returns). */
+	ATDEnemyCharacter* SpawnEnemy(TSubclassOf<ATDEnemyCharacter> EnemyClass, const FTransform& Transform) const;
+
+	/** Inactive enemies per exact class. */
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FTDEnemyPool> Pools;
+};
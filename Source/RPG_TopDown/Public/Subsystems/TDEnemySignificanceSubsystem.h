@@ -0,0 +1,104 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "TDEnemySignificanceSubsystem.generated.h"
+
+class APlayerController;
+class ATDEnemyCharacter;
+
+/** Fidelity bucket of an enemy (see UTDEnemySignificanceSubsystem). */
+UENUM(BlueprintType)
+enum class ETDEnemySignificance : uint8
+{
+	/** Near a player, or on screen: full fidelity. */
+	High,
+	/** Within FarDistance of a player but off screen: reduced tick rates, no weapon animation, no hover collision. */
+	Medium,
+	/** Beyond FarDistance of every player: lowest tick rates and low replication priority. */
+	Low
+};
+
+/**
+ * UTDEnemySignificanceSubsystem
+ *
+ * Purpose:
+ * - Horde maps: full movement/animation/replication cost only for enemies a player is close to or can see.
+ *
+ * How it works:
+ * - Enemies register in BeginPlay and unregister in EndPlay (restoring full fidelity).
+ * - Every TD.EnemySignificance.UpdateInterval seconds each enemy is bucketed against every player controller's view
+ *   point (local ones on clients, all of them on the server):
+ *   - High:   within NearDistance of a view, or inside a view cone (FOV + FOVMarginDegrees) up to FarDistance.
+ *   - Medium: within FarDistance of a view, but off screen.
+ *   - Low:    beyond FarDistance of every view.
+ * - Changes are pushed through ATDEnemyCharacter::SetSignificance (tick intervals, weapon mesh, hover proxy, net
+ *   priority), so the cost of a bucket change is paid once, not per frame.
+ * - Server: the same pass counts the enemies within net cull distance of each view (one per connection). A view
+ *   whose count exceeds TD.EnemyReplication.CrowdedRelevantEnemies is crowded. Replication state is per actor, so a
+ *   Low enemy reduces its replication (ATDEnemyCharacter::SetReplicationReduced) only while every view it is
+ *   relevant to is crowded: a player in a quiet area keeps full state for its enemies whatever other players see.
+ *   Each view's decision uses its own count from the previous pass.
+ *
+ * Note: same self-contained evaluator as UGASCoreProjectileSignificanceSubsystem rather than the engine
+ * SignificanceManager plugin (plugin dependency plus a driver feeding it view points every frame).
+ */
+UCLASS()
+class RPG_TOPDOWN_API UTDEnemySignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UTDEnemySignificanceSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Start evaluating Enemy (High until the next update says otherwise). */
+	void RegisterEnemy(ATDEnemyCharacter* Enemy);
+
+	/** Stop evaluating Enemy. */
+	void UnregisterEnemy(ATDEnemyCharacter* Enemy);
+
+	/** Number of registered enemies. */
+	int32 GetNumEnemies() const { return Enemies.Num(); }
+
+	/** Server: largest number of enemies relevant to one player view at the last evaluation. */
+	int32 GetMaxRelevantEnemies() const { return MaxRelevantEnemies; }
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Enemies.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** One player view (location, forward, cos of the half FOV plus margin). */
+	struct FViewPoint
+	{
+		TWeakObjectPtr<const APlayerController> PlayerController;
+		FVector Location;
+		FVector Forward;
+		float CosHalfFOV;
+
+		/** Server: this view's previous pass count exceeded the crowded threshold. */
+		bool bCrowded = false;
+	};
+
+	/** Gather player view points (controllers with a camera manager or a pawn). */
+	void GatherViewPoints(TArray<FViewPoint, TInlineAllocator<4>>& OutViews) const;
+
+	/** Registered enemies (swap-removed). */
+	TArray<TWeakObjectPtr<ATDEnemyCharacter>> Enemies;
+
+	/** Time since the last evaluation. */
+	float TimeSinceUpdate = 0.f;
+
+	/** Server: see GetMaxRelevantEnemies. */
+	int32 MaxRelevantEnemies = 0;
+
+	/** Server: relevant enemy count of each player view at the last evaluation (a handful of players: linear scans). */
+	TArray<TPair<TWeakObjectPtr<const APlayerController>, int32>, TInlineAllocator<4>> LastRelevantEnemies;
+};
@@ -0,0 +1,119 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "TDFrameBudgetSubsystem.generated.h"
+
+class APlayerController;
+class UCanvas;
+
+/** Dashboard rows. The GASCore areas come first, in EGASCoreFrameBudgetArea order. */
+enum class ETDFrameBudgetArea : uint8
+{
+	EffectApplication,
+	AttributeCallbacks,
+	AbilityActivation,
+	ProjectileUpdate,
+	UIBroadcast,
+	Highlight,
+	ClickToMove,
+
+	Num
+};
+
+/**
+ * UTDFrameBudgetSubsystem
+ *
+ * Purpose:
+ * - One "combat frame" view of the per-frame cost of every gameplay system that scales with a fight, each against
+ *   its own ms budget, so QA can screenshot the overlay (or paste TD.Budget.Dump) when a frame spikes.
+ *
+ * How it works:
+ * - While running, samples once per frame after the world tick (FWorldDelegates::OnWorldPostActorTick):
+ *   - GASCore areas (GE application, attribute callbacks, ability activation, projectile update, UI broadcasts) from
+ *     GASCoreFrameBudget, which is switched on for the run. Its totals are process wide: with several worlds in one
+ *     process (PIE listen server + clients) the running dashboard sees all of them.
+ *   - Highlight: UHighlightInteraction tick cost of this world's local player controllers.
+ *   - Click-to-move: UClickToMovePathRequestSubsystem + UClickToMovePathFollowerSubsystem tick cost.
+ *   Work flushed at the end of a frame (attribute delta batches, view model flushes) lands in the next sample.
+ * - Per area: last / smoothed / peak ms and the number of sampled frames over budget (TD.Budget.<Area>Ms).
+ *   The frame with the worst budget ratio is kept whole ("worst frame" column) so a spike can be read after the fact.
+ * - The overlay is a debug canvas draw ("Game" debug draw service) in the sampling world's viewport; TD.Budget.Overlay.
+ *
+ * Running (non-shipping):
+ * - TD.Budget.Start / TD.Budget.Stop, TD.Budget.Dump (log/console table), TD.Budget.Reset (counters and peaks).
+ * - TD.Budget.CombatPreset: reset, start, and turn on the Insights channels of the same systems
+ *   (GASCore, GASCoreUI, Highlight, ClickToMove) so a trace taken next to the overlay has matching scopes.
+ */
+UCLASS()
+class RPG_TOPDOWN_API UTDFrameBudgetSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UTDFrameBudgetSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Start sampling (and drawing the overlay). No-op while running. */
+	void Start();
+
+	/** Stop sampling and restore GASCore.FrameBudget.Enable. Counters are kept for a later Dump. */
+	void Stop();
+
+	/** Clear counters, peaks and the worst frame. */
+	void Reset();
+
+	/** Print the dashboard table. */
+	void Dump(FOutputDevice& Ar) const;
+
+	bool IsRunning() const { return PostActorTickHandle.IsValid(); }
+
+	/** Display name of an area. */
+	static const TCHAR* GetAreaName(ETDFrameBudgetArea Area);
+
+	// ===== UWorldSubsystem =====
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+private:
+	static constexpr int32 NumAreas = static_cast<int32>(ETDFrameBudgetArea::Num);
+
+	struct FAreaStats
+	{
+		float LastMs = 0.f;
+		float AverageMs = 0.f;
+		float PeakMs = 0.f;
+		uint32 OverBudgetFrames = 0;
+	};
+
+	/** Budget of Area in ms (TD.Budget.<Area>Ms; <= 0 = no budget). */
+	static float GetBudgetMs(ETDFrameBudgetArea Area);
+
+	void Sample(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/** Highlight and click-to-move cost of this frame (ms), read from their last tick stamps. */
+	float SampleHighlightMs() const;
+	float SampleClickToMoveMs() const;
+
+	void DrawOverlay(UCanvas* Canvas, APlayerController* PlayerController);
+
+	FAreaStats Areas[NumAreas];
+
+	/** Frames sampled since the last Reset. */
+	uint32 SampledFrames = 0;
+
+	/** Frame with the highest ms / budget ratio of any area since the last Reset. */
+	float WorstFrameMs[NumAreas] = {};
+	float WorstFrameRatio = 0.f;
+	uint64 WorstFrameNumber = 0;
+
+	FDelegateHandle PostActorTickHandle;
+	FDelegateHandle DrawHandle;
+
+	/** GASCore.FrameBudget.Enable before Start (restored by Stop). */
+	bool bFrameBudgetWasEnabled = false;
+};
@@ -0,0 +1,127 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "TDSoakTestSubsystem.generated.h"
+
+/**
+ * UTDSoakTestSubsystem
+ *
+ * Purpose:
+ * - Pre-release load test: a dedicated server with N scripted bot clients (ATDBotPlayerController) played for a
+ *   fixed time, reporting server tick time and bandwidth the same way on every run.
+ *
+ * How it works:
+ * - Server only. Waits until MinBots bot controllers have logged in (or BotWaitSeconds passed), then measures for
+ *   the soak duration. GASCore.NetBandwidth.Enable is switched on for the run.
+ * - Per frame: server game-thread ms (GGameThreadTime) and frame ms go to the CSV profiler (category TDSoak).
+ * - Every ReportInterval: one row (players, bots, game-thread mean / p95 / max, frame ms, net driver in / out
+ *   KB/s, player ASC replicated kbit/s from GASCoreNetBandwidth) in Saved/Profiling/TDSoak/Soak-<time>.csv.
+ * - At the end: a "TDSoak RESULT" log line over the whole run, appended to Saved/Profiling/TDSoak/Summary.csv with
+ *   the build version and changelist.
+ *
+ * Running:
+ * - Server: RPG_TopDownServer <Map> -log -TDSoak[=Seconds] [-TDSoakBots=N] [-TDSoakNoExit]; exits after the run
+ *   ("TDSoak COMPLETE" in the log) unless -TDSoakNoExit.
+ * - Bots: N x RPG_TopDown <ServerAddress>?TDBot -game -nullrhi -nosound (see ATDGameMode::BotPlayerControllerClass).
+ * - Console: TD.Soak.Start [Seconds], TD.Soak.Stop.
+ */
+UCLASS(config = Game)
+class RPG_TOPDOWN_API UTDSoakTestSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UTDSoakTestSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Server: soak for Seconds (<= 0 = DefaultDurationSeconds) once MinBots bots are in. Restarts a running soak. */
+	void Start(float Seconds, int32 InMinBots);
+
+	/** End the soak now (writes the results gathered so far). */
+	void Stop();
+
+	bool IsRunning() const { return Stage != EStage::Idle; }
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return IsRunning(); }
+	virtual TStatId GetStatId() const override;
+
+protected:
+	/** Soak duration when none is given. */
+	UPROPERTY(config)
+	float DefaultDurationSeconds = 600.f;
+
+	/** Seconds between report rows. */
+	UPROPERTY(config)
+	float ReportInterval = 10.f;
+
+	/** Give up waiting for bots after this long and measure with whoever is connected. */
+	UPROPERTY(config)
+	float BotWaitSeconds = 120.f;
+
+private:
+	enum class EStage : uint8
+	{
+		Idle,
+		WaitingForBots,
+		Measure
+	};
+
+	/** Per-frame samples of one window (report row or whole run). */
+	struct FWindow
+	{
+		TArray<float> GameThreadMs;
+		double FrameMsSum = 0.0;
+		double InBytesPerSecondSum = 0.0;
+		double OutBytesPerSecondSum = 0.0;
+		double StartTime = 0.0;
+		int64 StartBits = 0;
+
+		void Reset(double Time, int64 Bits);
+		void Add(float FrameGameThreadMs, float FrameMs, uint32 InBytesPerSecond, uint32 OutBytesPerSecond);
+	};
+
+	/** Window statistics as a CSV fragment (and the matching log fields). */
+	FString FormatWindow(const FWindow& Window, double Now, int64 Bits, bool bForLog) const;
+
+	void BeginMeasure();
+
+	void WriteReportRow();
+
+	void WriteSummary(const FString& Row) const;
+
+	int32 CountBots() const;
+
+	/** Replicated bits of every player's ASC so far (GASCoreNetBandwidth). */
+	int64 SamplePlayerBits() const;
+
+	EStage Stage = EStage::Idle;
+
+	double StageStartTime = 0.0;
+
+	float DurationSeconds = 0.f;
+
+	int32 MinBots = 0;
+
+	FWindow Report;
+	FWindow Run;
+
+	/** Per-run report file (Saved/Profiling/TDSoak/Soak-<time>.csv). */
+	FString ReportPath;
+
+	bool bOwnsCsvCapture = false;
+
+	bool bNetBandwidthWasEnabled = false;
+
+	/** Started from the command line: exit when done. */
+	bool bExitWhenDone = false;
+};
@@ -0,0 +1,183 @@
+// © 2025 Heathrow (Derman). All rights reserved. This project is the intellectual property of Heathrow (Derman) and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited. Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "TDStressBenchmarkSubsystem.generated.h"
+
+class ATDEnemyCharacter;
+class UGameplayEffect;
+class UAbilitySystemComponent;
+
+/**
+ * UTDStressBenchmarkSubsystem
+ *
+ * Purpose:
+ * - Reproducible GAS perf baseline: the same horde load at 100 / 500 / 1000 enemies, measured the same way on every
+ *   commit, so numbers from two builds can be compared.
+ *
+ * How it works:
+ * - Server only. One stage per enemy count: spawn (through UTDEnemyPoolSubsystem, on a grid around the world
+ *   origin / first player start), apply InitEffects, DamageEffect and RegenEffect to every enemy, then warm up for
+ *   WarmupSeconds and measure for MeasureSeconds while a rotating slice of enemies fires ProjectileAbilityTag and
+ *   NumEffectZones EffectZoneClass actors sweep circles through the crowd. Enemies go back to the pool between stages.
+ * - Per frame: game-thread ms (GGameThreadTime) and the enemy count go to the CSV profiler (category TDBenchmark);
+ *   a CSV capture runs for each measured stage when none is already running.
+ * - Per stage: game-thread ms (mean / p95), GAS callback ms per frame (GASCoreEffectProfiler per-ASC cost), memory
+ *   per ASC (ASC + spawned attribute sets, FArchiveCountMem) and replicated kbit/s (GASCoreNetBandwidth per-ASC bits).
+ *   Both profilers are switched on for the run. Results are logged as "TDBenchmark RESULT" lines and appended to
+ *   Saved/Profiling/TDBenchmark/Summary.csv with the build version and changelist.
+ *
+ * Running:
+ * - Console: TD.Benchmark.Run [Count,Count,...] (default: DefaultCounts), TD.Benchmark.Stop.
+ * - Automated / Gauntlet: -TDBenchmark[=100,500,1000] starts when the world begins play and requests exit after
+ *   the last stage ("TDBenchmark COMPLETE" in the log); add -TDBenchmarkNoExit to keep the session.
+ *
+ * Config ([/Script/RPG_TopDown.TDStressBenchmarkSubsystem] in DefaultGame.ini): unset classes / tags skip that part
+ * of the load.
+ */
+UCLASS(config = Game)
+class RPG_TOPDOWN_API UTDStressBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor; returns null if the world has no subsystem (e.g., during teardown). */
+	static UTDStressBenchmarkSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Server: run one stage per entry of Counts (empty = DefaultCounts). Restarts a running benchmark. */
+	void Run(const TArray<int32>& Counts);
+
+	/** Abort the running benchmark and return its enemies to the pool. */
+	void Stop();
+
+	bool IsRunning() const { return Stage != EStage::Idle; }
+
+	// ===== UTickableWorldSubsystem =====
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return IsRunning(); }
+	virtual TStatId GetStatId() const override;
+
+protected:
+	/** Enemy counts run by default (and by -TDBenchmark without a value). */
+	UPROPERTY(config)
+	TArray<int32> DefaultCounts = { 100, 500, 1000 };
+
+	UPROPERTY(config)
+	TSoftClassPtr<ATDEnemyCharacter> EnemyClass;
+
+	/** Applied once to every enemy after it spawns. */
+	UPROPERTY(config)
+	TArray<TSoftClassPtr<UGameplayEffect>> InitEffects;
+
+	/** Periodic damage applied to every enemy (keep it below RegenEffect so the crowd size holds). */
+	UPROPERTY(config)
+	TSoftClassPtr<UGameplayEffect> DamageEffect;
+
+	/** Periodic regeneration applied to every enemy. */
+	UPROPERTY(config)
+	TSoftClassPtr<UGameplayEffect> RegenEffect;
+
+	/** Ability tag activated on a rotating slice of enemies (projectile abilities). */
+	UPROPERTY(config)
+	FGameplayTag ProjectileAbilityTag;
+
+	/** Fraction of the enemies firing ProjectileAbilityTag per second. */
+	UPROPERTY(config)
+	float ProjectileActivationsPerEnemyPerSecond = 0.5f;
+
+	/** Effect-actor zones swept through the crowd (e.g. ATDGameplayEffectActor subclasses with overlap effects). */
+	UPROPERTY(config)
+	TSoftClassPtr<AActor> EffectZoneClass;
+
+	UPROPERTY(config)
+	int32 NumEffectZones = 8;
+
+	/** Zone angular speed around the crowd centre (degrees per second). */
+	UPROPERTY(config)
+	float EffectZoneDegreesPerSecond = 45.f;
+
+	/** Grid spacing between spawned enemies (cm). */
+	UPROPERTY(config)
+	float SpawnSpacing = 200.f;
+
+	UPROPERTY(config)
+	float WarmupSeconds = 5.f;
+
+	UPROPERTY(config)
+	float MeasureSeconds = 20.f;
+
+private:
+	enum class EStage : uint8
+	{
+		Idle,
+		Warmup,
+		Measure
+	};
+
+	/** Spawn and load the enemies of the current stage. */
+	void BeginStage();
+
+	/** Report the current stage, release its enemies and go to the next one (or finish). */
+	void EndStage();
+
+	void ReleaseEnemies();
+
+	void ApplyEffect(UAbilitySystemComponent& AbilitySystem, TSubclassOf<UGameplayEffect> EffectClass) const;
+
+	/** Fire ProjectileAbilityTag on the next enemies of the rotation. */
+	void FireProjectiles(float DeltaTime);
+
+	void SweepEffectZones();
+
+	/** Per-stage snapshot of the profilers' per-ASC totals. */
+	void SampleTotals(double& OutGASMicroseconds, int64& OutBits) const;
+
+	float MeasureMemoryPerAbilitySystem() const;
+
+	void WriteSummary(const FString& Row) const;
+
+	/** Remaining enemy counts (front = current stage). */
+	TArray<int32> PendingCounts;
+
+	EStage Stage = EStage::Idle;
+
+	double StageStartTime = 0.0;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ATDEnemyCharacter>> Enemies;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AActor>> EffectZones;
+
+	FVector CrowdCenter = FVector::ZeroVector;
+
+	float CrowdRadius = 0.f;
+
+	/** Next enemy of the projectile rotation, and the fractional activations carried to the next frame. */
+	int32 NextProjectileEnemy = 0;
+	float PendingProjectileActivations = 0.f;
+
+	/** Measure window samples. */
+	TArray<float> GameThreadMs;
+	double StartGASMicroseconds = 0.0;
+	int64 StartBits = 0;
+	float MemoryPerAbilitySystem = 0.f;
+
+	/** Stages started the CSV capture (and stop it). */
+	bool bOwnsCsvCapture = false;
+
+	/** Profiler switches before the run (restored by Stop). */
+	bool bEffectProfilerWasEnabled = false;
+	bool bNetBandwidthWasEnabled = false;
+
+	/** Started from the command line: exit after the last stage. */
+	bool bExitWhenDone = false;
+};
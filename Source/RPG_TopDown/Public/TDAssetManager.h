@@ -15,6 +15,10 @@
  *
  * Central asset manager for the project.
  * - Serves as a bootstrap point to initialize native gameplay tags and other global systems.
+ * - Preloads every UGASCoreGameDataAsset's "Combat", "UI" and "Input" bundles asynchronously once the asset registry scan
+ *   completes (i.e., under the startup loading screen) and keeps them resident, so effects, abilities, attribute
+ *   info and message tables never load synchronously at first use. Anything that still does is reported by
+ *   GASCoreSyncLoadReporter in non-shipping builds.
  */
 UCLASS()
 class RPG_TOPDOWN_API UTDAssetManager : public UAssetManager
@@ -25,8 +29,23 @@ public:
 	/** Returns a reference to the project's AssetManager (cast from GEngine->AssetManager). */
 	static UTDAssetManager& Get();
 
+	/** True once the GAS game data bundles finished preloading. */
+	bool IsGameDataPreloaded() const { return bGameDataPreloaded; }
+
 protected:
 	/** Called during engine startup to initialize project-wide systems. */
 	virtual void StartInitialLoading() override;
+
+private:
+	/** Start the async bundle preload of every GASCoreGameData primary asset. */
+	void PreloadGameData();
+
+	/** Preload completion: register the loaded references with the sync load reporter. */
+	void OnGameDataPreloaded();
+
+	/** Keeps the preloaded game data and its bundles resident. */
+	TSharedPtr<FStreamableHandle> GameDataPreloadHandle;
+
+	bool bGameDataPreloaded = false;
 };
 
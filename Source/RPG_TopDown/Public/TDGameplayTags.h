@@ -4,9 +4,30 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "NativeGameplayTags.h"
+#include "AbilitySystem/Attributes/TDAttributeSchema.h"
+#include "Utilities/GASCoreNativeTagBits.h"
+
+/** Static native tag definitions (see TDGameplayTags.cpp). Prefer these in new code; FTDGameplayTags mirrors them. */
+namespace TDGameplayTags
+{
+	// Attribute tags come from the attribute schema (one per UTDAttributeSet attribute).
+	TD_ATTRIBUTE_SCHEMA(GASCORE_ATTRIBUTE_SCHEMA_DECLARE_TAG, UTDAttributeSet)
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(Attributes_Secondary_Evasion);
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(InputTag_LMB);
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(InputTag_RMB);
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(InputTag_QuickSlot_1);
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(InputTag_QuickSlot_2);
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(InputTag_QuickSlot_3);
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(InputTag_QuickSlot_4);
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(UI_Message);
+	UE_DECLARE_GAMEPLAY_TAG_EXTERN(GameplayCue_CombatText_Damage);
+}
 
 /**
- * Centralized registration and access for native Gameplay Tags.
+ * Centralized access for native Gameplay Tags.
+ * The tags are defined statically in the TDGameplayTags namespace; InitializeNativeGameplayTags copies them into
+ * this struct so legacy FTDGameplayTags::Get().X call sites keep working.
  */
 struct FTDGameplayTags
 {
@@ -60,6 +81,37 @@ public:
 	FGameplayTag InputTag_QuickSlot_3;
 	FGameplayTag InputTag_QuickSlot_4;
 
+	// -----------------------------------------------------------------------------
+	// UI Messages
+	// -----------------------------------------------------------------------------
+	FGameplayTag UI_Message;
+
+	// -----------------------------------------------------------------------------
+	// Gameplay Cues
+	// -----------------------------------------------------------------------------
+	FGameplayTag GameplayCue_CombatText_Damage;
+
+	// -----------------------------------------------------------------------------
+	// Packed bits (GASCoreNativeTagBits; every native tag above is registered)
+	// -----------------------------------------------------------------------------
+	uint64 InputTagBit_LMB = 0;
+	uint64 InputTagsMask = 0;
+	uint64 AttributeTagsMask = 0;
+	uint64 UIMessageBit = 0;
+
+	/** Tag is one of the native input tags. */
+	bool IsInputTag(const FGameplayTag& Tag) const { return GASCoreNativeTagBits::Get(Tag).MatchesExact(InputTagsMask); }
+
+	/** Tag is one of the native attribute tags. */
+	bool IsAttributeTag(const FGameplayTag& Tag) const { return GASCoreNativeTagBits::Get(Tag).MatchesExact(AttributeTagsMask); }
+
+	/** Tag is UI.Message or one of its children (hierarchical match: one cached lookup, then one AND). */
+	bool IsUIMessageTag(const FGameplayTag& Tag) const { return GASCoreNativeTagBits::Get(Tag).Matches(UIMessageBit); }
+
 private:
+	/** Register every native tag with GASCoreNativeTagBits and fill the masks above. */
+	void RegisterTagBits();
+
+
 	static FTDGameplayTags TDGameplayTags;
 };
\ No newline at end of file
@@ -7,6 +7,7 @@
 // ===== Engine & Module Includes =====
 #include "CoreMinimal.h"
 #include "GameFramework/HUD.h"
+#include "UI/WidgetControllers/GASCoreUIWidgetController.h" // FGASCoreUIWidgetControllerParams (cached for the lazy menu)
 
 #include "TDHUD.generated.h"
 
@@ -17,7 +18,7 @@ class UTDUserWidget;
 class UUserWidget;
 class UAttributeSet;
 class UAbilitySystemComponent;
-struct FGASCoreUIWidgetControllerParams;
+struct FStreamableHandle;
 
 /**
  * ATDHUD
@@ -25,6 +26,8 @@ struct FGASCoreUIWidgetControllerParams;
  * Custom HUD class for GAS-driven games.
  * - Creates and owns UI widgets and their controllers.
  * - Provides accessors to retrieve or lazily create controllers with correct references.
+ * - Only the overlay is created at possession. Attribute menu classes are soft references streamed in the background
+ *   from the frame after InitializeHUD; the menu widget itself is created on first OpenAttributeMenu.
  */
 UCLASS()
 class RPG_TOPDOWN_API ATDHUD : public AHUD
@@ -32,6 +35,8 @@ class RPG_TOPDOWN_API ATDHUD : public AHUD
 	GENERATED_BODY()
 
 public:
+	ATDHUD();
+
 	// ===== Controller accessors =====
 
 	/**
@@ -58,7 +63,30 @@ public:
 		UAbilitySystemComponent* InAbilitySystemComponent,
 		UAttributeSet* InAttributeSet);
 
+	// ===== Attribute menu =====
+
+	/**
+	 * Show the attribute menu, creating it (and its controller) on first open.
+	 * Falls back to a synchronous load if the background stream has not finished yet.
+	 */
+	UFUNCTION(BlueprintCallable, Category="UI|Attribute Menu")
+	UTDUserWidget* OpenAttributeMenu();
+
+	/** Hide the attribute menu and unbind its controller; the widget is kept for the next open. */
+	UFUNCTION(BlueprintCallable, Category="UI|Attribute Menu")
+	void CloseAttributeMenu();
+
+	/** True while the attribute menu is in the viewport. */
+	UFUNCTION(BlueprintPure, Category="UI|Attribute Menu")
+	bool IsAttributeMenuOpen() const;
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:
+	/** Stream the soft subwidget classes in the background (scheduled for the frame after InitializeHUD). */
+	void RequestSubWidgetClassesLoad();
+
 	// ===== Widget instances =====
 
 	/** On-screen HUD widget instance (your custom user widget). */
@@ -81,8 +109,29 @@ private:
 	UPROPERTY()
 	TObjectPtr<UTDAttributeMenuWidgetController> AttributeMenuWidgetController;
 
-	/** Concrete class used to instantiate the Attribute Menu widget controller (set in BP). */
+	/** Concrete class used to instantiate the Attribute Menu widget controller (defaults to BP_AttributeMenuWidgetController; streamed after the first frame). */
 	UPROPERTY(EditAnywhere, Category="UI|Classes")
-	TSubclassOf<UTDAttributeMenuWidgetController> AttributeMenuWidgetControllerClass;
+	TSoftClassPtr<UTDAttributeMenuWidgetController> AttributeMenuWidgetControllerClass;
+
+	/** Attribute menu widget class (defaults to WBP_AttributeMenu; streamed after the first frame, instantiated on first open). */
+	UPROPERTY(EditAnywhere, Category="UI|Classes")
+	TSoftClassPtr<UTDUserWidget> AttributeMenuWidgetClass;
+
+	/** Attribute menu widget instance (null until first open). */
+	UPROPERTY()
+	TObjectPtr<UTDUserWidget> AttributeMenuWidget;
+
+	/** References from InitializeHUD, used to build the lazily created menu controller. */
+	UPROPERTY()
+	FGASCoreUIWidgetControllerParams CachedWidgetControllerParams;
+
+	/** Background load of the soft subwidget classes (keeps them resident once loaded). */
+	TSharedPtr<FStreamableHandle> SubWidgetClassesHandle;
+
+	// ===== Combat text =====
+
+	/** Colour of floating damage numbers (GameplayCue.CombatText.Damage bursts). */
+	UPROPERTY(EditAnywhere, Category="UI|Combat Text")
+	FLinearColor DamageNumberColor = FLinearColor::White;
 }
 ;
\ No newline at end of file
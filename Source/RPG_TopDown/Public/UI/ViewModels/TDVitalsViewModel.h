@@ -0,0 +1,41 @@
+// © 2025 Heathrow (Derman). All rights reserved.This project is the intellectual property of Heathrow (Derman)
+// and is protected by copyright law. Unauthorized reproduction, distribution, or use of this material is strictly prohibited.
+// Unreal Engine and its associated trademarks are used under license from Epic Games.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UI/ViewModels/GASCoreUIAttributeViewModel.h"
+#include "TDVitalsViewModel.generated.h"
+
+/**
+ * UTDVitalsViewModel
+ *
+ * Field-notify view model for the HUD vitals (globes/bars). Field names match the UTDAttributeSet attribute names,
+ * so any attribute info data asset listing them binds automatically; widgets use MVVM view bindings instead of
+ * the OnXChanged delegates on UTDHUDWidgetController.
+ */
+UCLASS(BlueprintType, Blueprintable)
+class RPG_TOPDOWN_API UTDVitalsViewModel : public UGASCoreUIAttributeViewModel
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintReadOnly, FieldNotify, Category = "Vitals")
+	float Health = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, FieldNotify, Category = "Vitals")
+	float MaxHealth = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, FieldNotify, Category = "Vitals")
+	float Mana = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, FieldNotify, Category = "Vitals")
+	float MaxMana = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, FieldNotify, Category = "Vitals")
+	float Stamina = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, FieldNotify, Category = "Vitals")
+	float MaxStamina = 0.f;
+};
@@ -4,6 +4,7 @@
 
 // ===== Module Includes =====
 #include "CoreMinimal.h"
+#include "AttributeSet.h" // FGameplayAttribute (bound delegate handles)
 #include "UI/WidgetControllers/GASCoreUIWidgetController.h"
 
 // Forward declarations to keep compile-time dependencies minimal
@@ -16,6 +17,8 @@ struct FGameplayTag; // used by the private helper signature below
 // ===== Delegates =====
 // These are BlueprintAssignable so widgets can bind in BP to receive updates.
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAttributeInfoSignature, const FGASCoreAttributeInformation&, AttributeInfo);
+// Live updates carry only the row identity and its new value (name/description were sent with the initial values).
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FAttributeValueChangedSignature, FGameplayTag, AttributeTag, float, NewValue);
 
 /**
  * UTDAttributeMenuWidgetController
@@ -34,11 +37,19 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAttributeInfoSignature, const FGASC
  *
  * - BindCallbacksToDependencies():
  *     - For each row, subscribe to ASC's value change delegate keyed by the row's FGameplayAttribute.
- *     - On change, re-broadcast only that row (minimal UI update).
+ *     - On change, broadcast (AttributeTag, NewValue) through AttributeValueChangedDelegate, and the full row through
+ *       AttributeInfoDelegate while anything is still bound to it (widgets not yet migrated to the value delegate).
+ *
+ * Menu visibility:
+ * - Bindings exist only while the menu is open: BroadcastInitialValues (called when the menu opens) binds them and
+ *   resyncs every row once; UnbindCallbacksFromDependencies removes them again. It runs when the menu widget is
+ *   destructed (UTDUserWidget::NativeDestruct, however it was removed) and on ATDHUD::EndPlay.
+ *   A closed menu costs nothing on attribute changes (regen ticks included).
  *
  * Notes:
  * - This controller remains generic; adding/removing attributes is handled by editing the Data Asset.
- * - Widgets filter or react to updates by comparing their Tag to the incoming AttributeInfo.AttributeTag.
+ * - Widgets filter or react to updates by comparing their Tag to the incoming AttributeInfo.AttributeTag:
+ *   AttributeInfoDelegate once per row for the static text + initial value, AttributeValueChangedDelegate afterwards.
  */
 UCLASS(BlueprintType, Blueprintable)
 class RPG_TOPDOWN_API UTDAttributeMenuWidgetController : public UGASCoreUIWidgetController
@@ -61,12 +72,20 @@ public:
 	 */
 	virtual void BindCallbacksToDependencies() override;
 
+	/** Remove the live-update bindings (call when the menu closes; BroadcastInitialValues rebinds on the next open). */
+	UFUNCTION(BlueprintCallable, Category="Top Down|Attribute Widget Controller")
+	void UnbindCallbacksFromDependencies();
+
 	// ===== Delegates (UI consumption) =====
 
 	/** Multicast event for UI rows; widgets bind in BP and update when their Tag matches Info.AttributeTag. */
 	UPROPERTY(BlueprintAssignable, Category="Top Down|Attribute Widget Controller|Delegates")
 	FAttributeInfoSignature AttributeInfoDelegate;
 
+	/** Multicast event for live value changes; widgets update their number when their Tag matches AttributeTag. */
+	UPROPERTY(BlueprintAssignable, Category="Top Down|Attribute Widget Controller|Delegates")
+	FAttributeValueChangedSignature AttributeValueChangedDelegate;
+
 protected:
 	// ===== Data sources =====
 	
@@ -82,12 +101,15 @@ private:
 	// ===== Internal helpers =====
 
 	/**
-	 * Look up metadata by AttributeTag, compute the current numeric value via the row's AttributeGetter,
-	 * and broadcast a filled FGASCoreAttributeInformation to UI listeners.
-	 *
-	 * Expected to be called:
-	 * - During initial broadcast (for each row).
-	 * - From ASC change delegates (only for the changed row).
+	 * Compute row RowIndex's current numeric value (baked offset in cooked builds, else its AttributeGetter) and
+	 * broadcast a filled FGASCoreAttributeInformation to UI listeners. Called once per row during the initial broadcast,
+	 * and on live changes while AttributeInfoDelegate still has listeners.
 	 */
-	void BroadcastAttributeInfo(const FGameplayTag& AttributeTag) const;
+	void BroadcastAttributeInfo(int32 RowIndex) const;
+
+	/** Value change bindings made by BindCallbacksToDependencies (attribute, handle). */
+	TArray<TPair<FGameplayAttribute, FDelegateHandle>> AttributeChangeHandles;
+
+	/** AttributeChangeHandles are live. */
+	bool bCallbacksBound = false;
 };
\ No newline at end of file
@@ -10,6 +10,9 @@
 #include "TDHUDWidgetController.generated.h"
 
 class UTDUserWidget;
+class UGASCoreAttributeInfoDataAsset;
+class UGASCoreUIAttributeViewModel;
+class UGASCoreUIVitalsSmoother;
 
 // Declare multicast delegates for different HUD attribute changes.
 // These are BlueprintAssignable so widgets can bind in BP to receive updates.
@@ -20,8 +23,11 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAttributeChangedSignature, float,
  *
  * Bridges the GAS data model to HUD widgets:
  * - On setup, broadcasts initial attribute values so widgets can initialize their displays
- * - Subscribes to attribute change delegates, to push real-time updates
+ * - Subscribes to attribute change delegates (frame-coalesced by the base class), to push real-time updates
+ * - Health/Mana/Stamina optionally glide through a UGASCoreUIVitalsSmoother at a fixed UI refresh rate, targeting
+ *   the attribute set's extrapolated value so natively regenerating vitals fill smoothly between replicated writes
  * - Listens for GameplayEffect asset tags (from ASC) and forwards matching UI message rows
+ * - Optionally owns a field-notify vitals view model for widgets that use MVVM view bindings
  */
 UCLASS(BlueprintType, Blueprintable)
 class RPG_TOPDOWN_API UTDHUDWidgetController : public UGASCoreUIWidgetController
@@ -75,6 +81,21 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "GASCore|Widget Controller|UI")
 	FUIMessageWidgetRowSignature MessageWidgetRowDelegate;
 
+	/**
+	 * Fires after MessageWidgetRowDelegate for rows with a MessageWidget class, with a popup acquired from
+	 * UGASCoreUIWidgetPoolSubsystem. Add it to the overlay instead of calling CreateWidget, and call ReleaseToPool on
+	 * it when its fade ends (at the pool cap the oldest live popup is recycled).
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "GASCore|Widget Controller|UI")
+	FUIMessageWidgetSignature MessageWidgetDelegate;
+
+	/**
+	 * Vitals view model (null unless VitalsViewModelClass is set). Bound to the ASC in BindCallbacksToDependencies;
+	 * MVVM widgets take it as their view model so only the bound fields update.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "GASCore|HUD Widget Controller|View Model")
+	TObjectPtr<UGASCoreUIAttributeViewModel> VitalsViewModel;
+
 protected:
 
 	/**
@@ -85,6 +106,38 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category="GASCore|HUD Widget Controller|UI")
 	TObjectPtr<UDataTable> MessageWidgetDataTable;
 
+	/**
+	 * If true, OnHealthChanged/OnManaChanged/OnStaminaChanged carry client-side smoothed values published at the UI
+	 * refresh rate (GASCore.UI.VitalsSmoothing.*) instead of every replicated change. Max values are never smoothed.
+	 * Off by default; enable it on the controller Blueprint.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="GASCore|HUD Widget Controller|Attributes")
+	bool bSmoothVitals = false;
+
+	/** Smoothing channels for the current vitals (created on bind when bSmoothVitals is set). */
+	UPROPERTY(Transient)
+	TObjectPtr<UGASCoreUIVitalsSmoother> VitalsSmoother;
+
+	/** View model class to create for the vitals (e.g., UTDVitalsViewModel or a view model Blueprint). */
+	UPROPERTY(EditDefaultsOnly, Category="GASCore|HUD Widget Controller|View Model")
+	TSubclassOf<UGASCoreUIAttributeViewModel> VitalsViewModelClass;
+
+	/** Attribute rows to bind into VitalsViewModel; rows without a matching field are ignored. */
+	UPROPERTY(EditDefaultsOnly, Category="GASCore|HUD Widget Controller|View Model")
+	TObjectPtr<UGASCoreAttributeInfoDataAsset> VitalsAttributeInfo;
+
+	/**
+	 * Rebuild MessageRowsByTag from MessageWidgetDataTable (UI.Message.* rows only).
+	 * Called once at bind time so effect popups are a single hash lookup.
+	 */
+	void BuildMessageRowMap();
+
+	/** Acquire MessageRow's MessageWidget from the widget pool and fire MessageWidgetDelegate (if anything listens). */
+	void BroadcastPooledMessageWidget(const FGASCoreUIMessageWidgetRow& MessageRow);
+
+	/** Message tag -> row inside MessageWidgetDataTable (kept alive by the UPROPERTY above). */
+	TMap<FGameplayTag, const FGASCoreUIMessageWidgetRow*> MessageRowsByTag;
+
 	/**
 	 * Utility to fetch a DataTable row by gameplay tag.
 	 * - Template T is the row UStruct type (e.g., FUIMessageWidgetRow)
@@ -7,7 +7,11 @@
 #include "TDUserWidget.generated.h"
 
 /**
- * 
+ * UTDUserWidget
+ *
+ * Game-side base for widgets driven by a GASCoreUI widget controller.
+ * - NativeDestruct (the widget left the screen, however it was removed) releases the attribute menu controller's
+ *   ASC bindings, so a menu closed from Blueprint stops receiving attribute changes like one closed by ATDHUD.
  */
 UCLASS()
 class RPG_TOPDOWN_API UTDUserWidget : public UGASCoreUIUserWidget
@@ -17,4 +21,7 @@ class RPG_TOPDOWN_API UTDUserWidget : public UGASCoreUIUserWidget
 public:
 
 	virtual void SetWidgetController(UObject* InWidgetController) override;
+
+protected:
+	virtual void NativeDestruct() override;
 };
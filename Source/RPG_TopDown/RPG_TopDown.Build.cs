@@ -18,12 +18,17 @@ public class RPG_TopDown : ModuleRules
 			"GameplayTags", 
 			"GameplayTasks", 
 			"UMG", // For UI widgets
+			"FieldNotification", // Field-notify view models
 			"GASCore",
 			"GASCoreUI",
 			"ClickToMove"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] {  });
+		PrivateDependencyModuleNames.AddRange(new string[] { "NetCore" }); // Dynamic replication conditions (attribute tiers)
+		PrivateDependencyModuleNames.Add("ReplicationGraph"); // UTDReplicationGraph (spatialized relevancy)
+		PrivateDependencyModuleNames.Add("AnimationBudgetAllocator"); // Budgeted character body meshes
+		PrivateDependencyModuleNames.Add("NavigationSystem"); // Soak-test bots (random reachable move orders)
+		PublicDependencyModuleNames.AddRange(new string[] { "MassEntity", "MassCommon", "MassSpawner" }); // Crowd enemies (Mass fragments/traits in public headers)
 
 		// Uncomment if you are using Slate UI
 		// PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
@@ -2,5 +2,59 @@
 
 #include "RPG_TopDown.h"
 #include "Modules/ModuleManager.h"
+#include "Utilities/GASCoreMemoryReport.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, RPG_TopDown, "RPG_TopDown" );
+#if GASCORE_MEM_REPORT
+#include "Engine/World.h"
+#include "Interaction/HighlightManagerSubsystem.h"
+#include "Interaction/HighlightRegistrySubsystem.h"
+#include "Subsystems/ClickToMovePathFollowerSubsystem.h"
+#include "Subsystems/ClickToMovePathRequestSubsystem.h"
+#endif
+
+class FRPG_TopDownModule : public FDefaultGameModuleImpl
+{
+public:
+	virtual void StartupModule() override
+	{
+#if GASCORE_MEM_REPORT
+		// GASCore.MemReport lines for the plugins GASCore does not know about.
+		GASCoreMemoryReport::RegisterContributor(TEXT("ClickToMove path buffers"), [](const UWorld& World)
+		{
+			SIZE_T Bytes = 0;
+			if (const UClickToMovePathFollowerSubsystem* Followers = World.GetSubsystem<UClickToMovePathFollowerSubsystem>())
+			{
+				Bytes += Followers->GetAllocatedSize();
+			}
+			if (const UClickToMovePathRequestSubsystem* Requests = World.GetSubsystem<UClickToMovePathRequestSubsystem>())
+			{
+				Bytes += Requests->GetAllocatedSize();
+			}
+			return Bytes;
+		});
+		GASCoreMemoryReport::RegisterContributor(TEXT("Highlight registries"), [](const UWorld& World)
+		{
+			SIZE_T Bytes = 0;
+			if (const UHighlightRegistrySubsystem* Registry = World.GetSubsystem<UHighlightRegistrySubsystem>())
+			{
+				Bytes += Registry->GetAllocatedSize();
+			}
+			if (const UHighlightManagerSubsystem* Manager = World.GetSubsystem<UHighlightManagerSubsystem>())
+			{
+				Bytes += Manager->GetAllocatedSize();
+			}
+			return Bytes;
+		});
+#endif
+	}
+
+	virtual void ShutdownModule() override
+	{
+#if GASCORE_MEM_REPORT
+		GASCoreMemoryReport::UnregisterContributor(TEXT("ClickToMove path buffers"));
+		GASCoreMemoryReport::UnregisterContributor(TEXT("Highlight registries"));
+#endif
+	}
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FRPG_TopDownModule, RPG_TopDown, "RPG_TopDown" );